@@ -29,6 +29,16 @@
  *		- Changelist is an optional parameter than will only use upac files that contain the changelist in their filenames. If
  *			omitted, all files in the directory are used.
  *
+ *	- "AutoGenerateDictionaries Changelist Profile":
+ *		- As above, but only uses the captures of a dictionary profile, saved in "*Game*\Saved\Oodle\Server\*Profile*", and
+ *			generates "*Game**Profile**DirectoryName*.udic" (see OodleNetworkHandlerComponent for dictionary profiles).
+ *			Use "all" as the changelist, to use all files.
+ *
+ *		- Without a profile, the captures of every profile are used as well, so the default dictionary covers all traffic.
+ *
+ *		- With -CompressionTest, part of the captures is kept back, and used to report the compression ratio and the encode/decode
+ *			speed of the new dictionary, for comparing dictionary/hash table sizes against their CPU cost.
+ *
  *
  * Secondary/Testing Commands:
  *	- "Enable":
@@ -129,7 +139,7 @@ public:
 	 *
 	 * @return	Whether or not the command executed successfully
 	 */
-	bool HandleAutoGenerateDictionaries(int32 ChangelistNumber);
+	bool HandleAutoGenerateDictionaries(int32 ChangelistNumber, const FString& Profile=TEXT(""));
 
 
 	/**
@@ -184,8 +194,9 @@ private:
 	 *
 	 * @param bIsInput true if we are generating the dictionary for Input captures, false if it is Output
 	 * @param ChangelistNumber OFilters files with this changelist in their filename. Using -1 will find all files.
+	 * @param Profile The dictionary profile to generate the dictionary for, using only its captures. Empty for the default dictionary.
 	 */
-	bool GenerateDictionary(bool bIsInput, int32 ChangelistNumber);
+	bool GenerateDictionary(bool bIsInput, int32 ChangelistNumber, const FString& Profile);
 
 #endif // !UE_BUILD_SHIPPING || OODLE_DEV_SHIPPING
 #endif // USE_OODLE_TRAINER_COMMANDLET
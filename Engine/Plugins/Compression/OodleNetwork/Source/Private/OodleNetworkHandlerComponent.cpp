@@ -299,7 +299,7 @@ FOodleNetworkDictionary::~FOodleNetworkDictionary()
  * OodleNetworkHandlerComponent
  */
 
-OodleNetworkHandlerComponent::OodleNetworkHandlerComponent()
+OodleNetworkHandlerComponent::OodleNetworkHandlerComponent(const FString& InDictionaryProfile/*=TEXT("")*/)
 	: HandlerComponent(FName(TEXT("OodleNetworkHandlerComponent")))
 	, bEnableOodle(false)
 	, ServerEnableMode(EOodleEnableMode::AlwaysEnabled)
@@ -313,6 +313,7 @@ OodleNetworkHandlerComponent::OodleNetworkHandlerComponent()
 	, OodleReservedPacketBits(0)
 	, NetAnalyticsData()
 	, bOodleNetworkAnalytics(false)
+	, DictionaryProfile(InDictionaryProfile)
 	, ServerDictionary()
 	, ClientDictionary()
 	, bInitializedDictionaries(false)
@@ -682,9 +683,25 @@ bool OodleNetworkHandlerComponent::GetDictionaryPaths(FString& OutServerDictiona
 
 	FString ServerDictionaryPath;
 	FString ClientDictionaryPath;
+	FString DictionarySection = OODLE_INI_SECTION;
 
-	bSuccess = GConfig->GetString(OODLE_INI_SECTION, TEXT("ServerDictionary"), ServerDictionaryPath, GEngineIni);
-	bSuccess = bSuccess && GConfig->GetString(OODLE_INI_SECTION, TEXT("ClientDictionary"), ClientDictionaryPath, GEngineIni);
+	if (DictionaryProfile.Len() > 0)
+	{
+		FString ProfileSection = FString::Printf(TEXT("%s %s"), OODLE_INI_SECTION, *DictionaryProfile);
+
+		if (GConfig->DoesSectionExist(*ProfileSection, GEngineIni))
+		{
+			DictionarySection = ProfileSection;
+		}
+		else
+		{
+			UE_LOG(OodleNetworkHandlerComponentLog, Warning, TEXT("Oodle dictionary profile '%s' has no [%s] section, using the default dictionaries."),
+					*DictionaryProfile, *ProfileSection);
+		}
+	}
+
+	bSuccess = GConfig->GetString(*DictionarySection, TEXT("ServerDictionary"), ServerDictionaryPath, GEngineIni);
+	bSuccess = bSuccess && GConfig->GetString(*DictionarySection, TEXT("ClientDictionary"), ClientDictionaryPath, GEngineIni);
 
 	if (bSuccess && (ServerDictionaryPath.Len() <= 0 || ClientDictionaryPath.Len() <= 0))
 	{
@@ -851,6 +868,12 @@ void OodleNetworkHandlerComponent::InitializePacketLogs()
 		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 		FString ReadOutputLogDirectory = FPaths::Combine(*GOodleSaveDir, TEXT("Server"));
 		FString BaseFilename;
+
+		// Captures from each dictionary profile are kept apart, so that they can be trained separately
+		if (DictionaryProfile.Len() > 0)
+		{
+			ReadOutputLogDirectory = FPaths::Combine(*ReadOutputLogDirectory, *DictionaryProfile);
+		}
 		
 		#if OODLE_HANDLER_VERBOSE_LOG
 		UE_LOG(OodleNetworkHandlerComponentLog, Log, TEXT("ReadOutputLogDirectory : %s"), *ReadOutputLogDirectory );
@@ -1669,7 +1692,8 @@ FStaticSelfRegisteringExec OodleExecRegistration(&OodleExec);
 
 TSharedPtr<HandlerComponent> FOodleComponentModuleInterface::CreateComponentInstance(FString& Options)
 {
-	return MakeShareable(new OodleNetworkHandlerComponent);
+	// The options name the dictionary profile, e.g. OodleNetworkHandlerComponent(Deathmatch)
+	return MakeShareable(new OodleNetworkHandlerComponent(Options.TrimStartAndEnd()));
 }
 
 
@@ -176,7 +176,9 @@ int32 UOodleNetworkTrainerCommandlet::Main(const FString& Params)
 				}
 			}
 
-			HandleAutoGenerateDictionaries(ChangelistNumber);
+			FString Profile = (Tokens.Num() > 2 ? Tokens[2] : TEXT(""));
+
+			HandleAutoGenerateDictionaries(ChangelistNumber, Profile);
 		}
 		else if (MainCmd == TEXT("DebugDump"))
 		{
@@ -376,10 +378,10 @@ void UOodleNetworkTrainerCommandlet::GetCaptureFiles(FString FilenameFilter, int
 	IFileManager::Get().IterateDirectoryRecursively(*StartDirectory, DirIterator);
 }
 
-bool UOodleNetworkTrainerCommandlet::HandleAutoGenerateDictionaries(int32 ChangelistNumber)
+bool UOodleNetworkTrainerCommandlet::HandleAutoGenerateDictionaries(int32 ChangelistNumber, const FString& Profile/*=TEXT("")*/)
 {
-	return GenerateDictionary(true, ChangelistNumber) &&
-		GenerateDictionary(false, ChangelistNumber);
+	return GenerateDictionary(true, ChangelistNumber, Profile) &&
+		GenerateDictionary(false, ChangelistNumber, Profile);
 }
 
 bool UOodleNetworkTrainerCommandlet::HandleDebugDumpPackets(FString OutputDirectory, FString SourceDirectory, const TArray<FString>& DumpList)
@@ -458,12 +460,17 @@ bool UOodleNetworkTrainerCommandlet::HandleDebugDumpPackets(FString OutputDirect
 	return bSuccess;
 }
 
-bool UOodleNetworkTrainerCommandlet::GenerateDictionary(bool bIsInput, int32 ChangelistNumber)
+bool UOodleNetworkTrainerCommandlet::GenerateDictionary(bool bIsInput, int32 ChangelistNumber, const FString& Profile)
 {
 	// Get a list of all directories containing saved packet captures
 	FString OodleCaptureDir = FPaths::Combine(*GOodleSaveDir, TEXT("Server"));
 	TArray<FString> CaptureFiles;
 
+	if (Profile.Len() > 0)
+	{
+		OodleCaptureDir = FPaths::Combine(*OodleCaptureDir, *Profile);
+	}
+
 	FString InputOrOutput;
 	if (bIsInput)
 	{
@@ -482,7 +489,7 @@ bool UOodleNetworkTrainerCommandlet::GenerateDictionary(bool bIsInput, int32 Cha
 	{
 		UE_LOG(OodleNetworkHandlerComponentLog, Log, TEXT("Generating dictionaries for %s folder"), *InputOrOutput);
 
-		FString OutDic = FPaths::Combine(*GOodleContentDir, *FString::Printf(TEXT("%s%s.udic"), FApp::GetProjectName(), *InputOrOutput));
+		FString OutDic = FPaths::Combine(*GOodleContentDir, *FString::Printf(TEXT("%s%s%s.udic"), FApp::GetProjectName(), *Profile, *InputOrOutput));
 
 		UE_LOG(OodleNetworkHandlerComponentLog, Log, TEXT("Generating dictionary for folder '%s', outputting to: %s"), *InputOrOutput, *OutDic);
 
@@ -1071,8 +1078,12 @@ bool FOodleNetworkDictionaryGenerator::GenerateAndWriteDictionary()
 		UE_LOG(OodleNetworkHandlerComponentLog, Log, TEXT("Testing packet compression results..."));
 
 		uint8* CompressedData = new uint8[MAX_OODLE_BUFFER];
+		uint8* DecompressedData = new uint8[MAX_OODLE_BUFFER];
 		uint64 TotalUncompressed = 0;
 		uint64 TotalCompressed = 0;
+		double EncodeTime = 0.0;
+		double DecodeTime = 0.0;
+		int32 NumDecodeFailures = 0;
 
 		for (int32 CurPacketIdx=0; CurPacketIdx<CompressionTestPackets.Num(); CurPacketIdx++)
 		{
@@ -1080,12 +1091,32 @@ bool FOodleNetworkDictionaryGenerator::GenerateAndWriteDictionary()
 			int32 CurPacketSize = CompressionTestPacketSizes[CurPacketIdx];
 
 			SSIZE_T CompressedLengthSINT = 0;
-			
+
+			double StartTime = FPlatformTime::Seconds();
+
 			CompressedLengthSINT = OodleNetwork1UDP_Encode(CompressorState, SharedDictionary, CurPacket, CurPacketSize,
 																	CompressedData);
 
+			double MidTime = FPlatformTime::Seconds();
+
 			check(CompressedLengthSINT <= CurPacketSize);
 
+			// Packets which don't compress are sent uncompressed at runtime, so there is nothing to decode for them
+			if (CompressedLengthSINT < CurPacketSize)
+			{
+				bool bDecoded = !!OodleNetwork1UDP_Decode(CompressorState, SharedDictionary, CompressedData, CompressedLengthSINT,
+															DecompressedData, CurPacketSize);
+
+				DecodeTime += FPlatformTime::Seconds() - MidTime;
+
+				if (!bDecoded || FMemory::Memcmp(CurPacket, DecompressedData, CurPacketSize) != 0)
+				{
+					NumDecodeFailures++;
+				}
+			}
+
+			EncodeTime += MidTime - StartTime;
+
 			TotalUncompressed += CurPacketSize;
 			TotalCompressed += (uint64)CompressedLengthSINT;
 		}
@@ -1101,8 +1132,22 @@ bool FOodleNetworkDictionaryGenerator::GenerateAndWriteDictionary()
 		UE_LOG(OodleNetworkHandlerComponentLog, Log, TEXT("- Total Savings: %f%"),
 				((float)(TotalUncompressed - TotalCompressed) * 100.f) / (float)TotalUncompressed);
 
+		// Cost per uncompressed MB, comparable between dictionary and hash table sizes, and against the bandwidth saved
+		const double UncompressedMB = (double)TotalUncompressed / (1024.0 * 1024.0);
+
+		UE_LOG(OodleNetworkHandlerComponentLog, Log, TEXT("- Encode: %.3fms (%.1fMB/s), Decode: %.3fms (%.1fMB/s), HashTableSize: %i, DictionarySize: %i"),
+				EncodeTime * 1000.0, EncodeTime > 0.0 ? UncompressedMB / EncodeTime : 0.0,
+				DecodeTime * 1000.0, DecodeTime > 0.0 ? UncompressedMB / DecodeTime : 0.0,
+				HashTableSize, DictionarySize);
+
+		if (NumDecodeFailures > 0)
+		{
+			UE_LOG(OodleNetworkHandlerComponentLog, Error, TEXT("- %i packets failed to decode back to the original data"), NumDecodeFailures);
+		}
+
 
 		delete[] CompressedData;
+		delete[] DecompressedData;
 	}
 
 
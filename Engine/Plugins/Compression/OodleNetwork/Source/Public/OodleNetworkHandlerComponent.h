@@ -267,12 +267,30 @@ public:
  * PacketHandler component for implementing Oodle support.
  *
  * Implementation uses trained/dictionary-based UDP compression.
+ *
+ * Net drivers carrying different traffic (e.g. game modes with their own net driver definition, or beacons) can use their own
+ * dictionaries, by naming a dictionary profile in the component options of their PacketHandler profile. Both ends of a connection
+ * must use the same profile, and the profile dictionaries are read from a separate config section:
+ *
+ *	[GameNetDriver PacketHandlerProfileConfig]
+ *	+Components=OodleNetworkHandlerComponent(Deathmatch)
+ *
+ *	[OodleNetworkHandlerComponent Deathmatch]
+ *	ServerDictionary=Content/Oodle/MyGameDeathmatchOutput.udic
+ *	ClientDictionary=Content/Oodle/MyGameDeathmatchInput.udic
+ *
+ * Captures from a profile are saved to "Saved\Oodle\Server\*Profile*", and the dictionaries are generated with
+ * "OodleNetworkTrainerCommandlet AutoGenerateDictionaries all *Profile*".
  */
 class OODLENETWORKHANDLERCOMPONENT_API OodleNetworkHandlerComponent : public HandlerComponent
 {
 public:
-	/** Initializes default data */
-	OodleNetworkHandlerComponent();
+	/**
+	 * Initializes default data
+	 *
+	 * @param InDictionaryProfile	The dictionary profile to use, or empty for the default dictionaries
+	 */
+	OodleNetworkHandlerComponent(const FString& InDictionaryProfile=TEXT(""));
 
 	/** Default Destructor */
 	~OodleNetworkHandlerComponent();
@@ -311,7 +329,7 @@ public:
 	void FreeDictionary(TSharedPtr<FOodleNetworkDictionary>& InDictionary);
 
 	/**
-	 * Resolves and returns the default dictionary file paths.
+	 * Resolves and returns the dictionary file paths of the dictionary profile, or the default dictionary file paths.
 	 *
 	 * @param OutServerDictionary	The server dictionary path
 	 * @param OutClientDictionary	The client dictionary path
@@ -397,6 +415,9 @@ protected:
 	/** Whether or not Oodle analytics is enabled - cached from NetAnalyticsData, for fast checking */
 	bool bOodleNetworkAnalytics;
 
+	/** The dictionary profile set in the component options, selecting the config section the dictionary paths are read from */
+	FString DictionaryProfile;
+
 #if !UE_BUILD_SHIPPING
 public:
 #endif
@@ -0,0 +1,325 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GauntletTestControllerPerfTest.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "EngineGlobals.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "RenderCore.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace GauntletPerfTest
+{
+	static const TCHAR* const PercentileNames[] = { TEXT("P50"), TEXT("P95"), TEXT("P99") };
+	static const float Percentiles[] = { 50.0f, 95.0f, 99.0f };
+
+	/** Absolute budget in the baseline, checked against P95 */
+	static const TCHAR* const MaxMsName = TEXT("MaxMs");
+
+	/** Nearest rank percentile of already sorted values */
+	static float GetPercentile(const TArray<float>& SortedValues, float Percentile)
+	{
+		const int32 Rank = FMath::CeilToInt(Percentile / 100.0f * SortedValues.Num());
+		return SortedValues[FMath::Clamp(Rank - 1, 0, SortedValues.Num() - 1)];
+	}
+}
+
+void UGauntletTestControllerPerfTest::OnInit()
+{
+	Phase = EPhase::WaitingForStart;
+	PhaseStartTime = 0.0;
+	bUpdateBaseline = FParse::Param(FCommandLine::Get(), TEXT("perftest.updatebaseline"));
+	WarmupSeconds = 10.0f;
+	DurationSeconds = 60.0f;
+	TolerancePercent = 5.0f;
+	SlackMs = 0.25f;
+
+	FString StartStateString;
+	FString CommandsString;
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.name="), TestName);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.map="), StartMap);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.state="), StartStateString);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.cmds="), CommandsString, false);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.trace="), TraceChannels);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.baseline="), BaselinePath);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.warmup="), WarmupSeconds);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.duration="), DurationSeconds);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.tolerance="), TolerancePercent);
+	FParse::Value(FCommandLine::Get(), TEXT("perftest.slackms="), SlackMs);
+
+	StartState = StartStateString.Len() ? FName(*StartStateString) : NAME_None;
+	CommandsString.TrimQuotesInline();
+	CommandsString.ParseIntoArray(StartCommands, TEXT("+"), true);
+}
+
+void UGauntletTestControllerPerfTest::BeginDestroy()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	Super::BeginDestroy();
+}
+
+void UGauntletTestControllerPerfTest::OnPostMapChange(UWorld* World)
+{
+	if (Phase != EPhase::WaitingForStart || World == nullptr || !StartState.IsNone())
+	{
+		return;
+	}
+
+	if (StartMap.IsEmpty() || GetCurrentMap().Contains(StartMap))
+	{
+		StartTest();
+	}
+}
+
+void UGauntletTestControllerPerfTest::OnStateChange(FName OldState, FName NewState)
+{
+	if (Phase == EPhase::WaitingForStart && !StartState.IsNone() && NewState == StartState)
+	{
+		StartTest();
+	}
+}
+
+void UGauntletTestControllerPerfTest::OnTick(float TimeDelta)
+{
+	const double TimeInPhase = FPlatformTime::Seconds() - PhaseStartTime;
+
+	if (Phase == EPhase::Warmup && TimeInPhase >= WarmupSeconds)
+	{
+		BeginCapture();
+	}
+	else if (Phase == EPhase::Capture)
+	{
+		MarkHeartbeatActive();
+
+		if (TimeInPhase >= DurationSeconds)
+		{
+			EndCaptureAndEvaluate();
+		}
+	}
+}
+
+void UGauntletTestControllerPerfTest::StartTest()
+{
+	if (TestName.IsEmpty())
+	{
+		TestName = FPaths::GetBaseFilename(GetCurrentMap());
+	}
+
+	UE_LOG(LogGauntlet, Display, TEXT("PerfTest %s: starting, warming up for %.0fs"), *TestName, WarmupSeconds);
+
+	for (const FString& Command : StartCommands)
+	{
+		GEngine->Exec(GetWorld(), *Command);
+	}
+
+	Phase = EPhase::Warmup;
+	PhaseStartTime = FPlatformTime::Seconds();
+}
+
+void UGauntletTestControllerPerfTest::BeginCapture()
+{
+	MarkHeartbeatActive(FString::Printf(TEXT("Capturing for %.0fs"), DurationSeconds));
+
+#if CSV_PROFILER
+	FCsvProfiler::Get()->BeginCapture(-1, FString(), FString::Printf(TEXT("PerfTest_%s_%s.csv"), *TestName, *FDateTime::Now().ToString()));
+#endif
+	if (TraceChannels.Len())
+	{
+		GEngine->Exec(GetWorld(), *FString::Printf(TEXT("Trace.Start %s"), *TraceChannels));
+	}
+
+	for (TArray<float>& Times : FrameTimes)
+	{
+		Times.Reset();
+	}
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UGauntletTestControllerPerfTest::OnEndFrame);
+
+	Phase = EPhase::Capture;
+	PhaseStartTime = FPlatformTime::Seconds();
+}
+
+void UGauntletTestControllerPerfTest::OnEndFrame()
+{
+	// The thread and GPU times are those of the previous frame, which is fine when aggregating over many frames
+	FrameTimes[Budget_GameThread].Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	FrameTimes[Budget_RenderThread].Add(FPlatformTime::ToMilliseconds(GRenderThreadTime));
+	FrameTimes[Budget_GPU].Add(FPlatformTime::ToMilliseconds(GGPUFrameTime));
+	FrameTimes[Budget_Net].Add(float(GServerReplicateActorTimeSeconds * 1000.0));
+	FrameTimes[Budget_Frame].Add(float(FApp::GetDeltaTime() * 1000.0));
+}
+
+void UGauntletTestControllerPerfTest::EndCaptureAndEvaluate()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+	Phase = EPhase::Done;
+
+#if CSV_PROFILER
+	FCsvProfiler::Get()->EndCapture();
+#endif
+	if (TraceChannels.Len())
+	{
+		GEngine->Exec(GetWorld(), TEXT("Trace.Stop"));
+	}
+
+	TSharedRef<FJsonObject> Results = BuildResults();
+
+	FString ResultsString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultsString);
+	FJsonSerializer::Serialize(Results, Writer);
+
+	const FString ResultsPath = FPaths::ProfilingDir() / TEXT("PerfTest") / FString::Printf(TEXT("%s_%s.json"), *TestName, ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	FFileHelper::SaveStringToFile(ResultsString, *ResultsPath);
+	UE_LOG(LogGauntlet, Display, TEXT("PerfTest %s: %d frames captured, results written to %s"), *TestName, FrameTimes[Budget_Frame].Num(), *ResultsPath);
+
+	const FString Baseline = GetBaselinePath();
+	if (bUpdateBaseline)
+	{
+		const bool bSaved = FFileHelper::SaveStringToFile(ResultsString, *Baseline);
+		UE_LOG(LogGauntlet, Display, TEXT("PerfTest %s: %s baseline %s"), *TestName, bSaved ? TEXT("updated") : TEXT("failed to update"), *Baseline);
+		EndTest(bSaved ? 0 : 1);
+		return;
+	}
+
+	FString BaselineString;
+	TSharedPtr<FJsonObject> BaselineObject;
+	if (!FFileHelper::LoadFileToString(BaselineString, *Baseline)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineString), BaselineObject)
+		|| !BaselineObject.IsValid())
+	{
+		// Nothing to compare with yet. Not a failure, the results can be checked in as the baseline.
+		UE_LOG(LogGauntlet, Warning, TEXT("PerfTest %s: no baseline at %s, run with -perftest.updatebaseline to create one"), *TestName, *Baseline);
+		EndTest(0);
+		return;
+	}
+
+	const bool bPassed = CompareWithBaseline(*Results, *BaselineObject);
+	UE_LOG(LogGauntlet, Display, TEXT("PerfTest %s: %s"), *TestName, bPassed ? TEXT("passed") : TEXT("FAILED, performance regressed"));
+	EndTest(bPassed ? 0 : 1);
+}
+
+TSharedRef<FJsonObject> UGauntletTestControllerPerfTest::BuildResults() const
+{
+	using namespace GauntletPerfTest;
+
+	TSharedRef<FJsonObject> Budgets = MakeShared<FJsonObject>();
+	for (int32 Budget = 0; Budget < Budget_Count; ++Budget)
+	{
+		TArray<float> Sorted = FrameTimes[Budget];
+		if (Sorted.Num() == 0)
+		{
+			continue;
+		}
+
+		Sorted.Sort();
+		if (Sorted.Last() <= 0.0f)
+		{
+			continue;
+		}
+
+		TSharedRef<FJsonObject> Values = MakeShared<FJsonObject>();
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(Percentiles); ++Index)
+		{
+			Values->SetNumberField(PercentileNames[Index], GetPercentile(Sorted, Percentiles[Index]));
+		}
+		Budgets->SetObjectField(GetBudgetName(Budget), Values);
+	}
+
+	TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetStringField(TEXT("Name"), TestName);
+	Results->SetStringField(TEXT("Platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	Results->SetNumberField(TEXT("Frames"), FrameTimes[Budget_Frame].Num());
+	Results->SetObjectField(TEXT("Budgets"), Budgets);
+	return Results;
+}
+
+bool UGauntletTestControllerPerfTest::CompareWithBaseline(const FJsonObject& Results, const FJsonObject& Baseline) const
+{
+	using namespace GauntletPerfTest;
+
+	const TSharedPtr<FJsonObject>* BaselineBudgets = nullptr;
+	if (!Baseline.TryGetObjectField(TEXT("Budgets"), BaselineBudgets))
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("PerfTest %s: baseline has no Budgets"), *TestName);
+		return false;
+	}
+
+	// The baseline may override the tolerance, e.g. for noisy platforms
+	double Tolerance = TolerancePercent;
+	Baseline.TryGetNumberField(TEXT("TolerancePercent"), Tolerance);
+
+	bool bPassed = true;
+	const TSharedPtr<FJsonObject>& ResultBudgets = Results.GetObjectField(TEXT("Budgets"));
+	for (const auto& BaselineBudget : (*BaselineBudgets)->Values)
+	{
+		const TSharedPtr<FJsonObject>* BaselineValues = nullptr;
+		const TSharedPtr<FJsonObject>* ResultValues = nullptr;
+		if (!BaselineBudget.Value->TryGetObject(BaselineValues))
+		{
+			continue;
+		}
+		if (!ResultBudgets->TryGetObjectField(BaselineBudget.Key, ResultValues))
+		{
+			UE_LOG(LogGauntlet, Warning, TEXT("PerfTest %s: %s is in the baseline but wasn't measured"), *TestName, *BaselineBudget.Key);
+			continue;
+		}
+
+		for (const TCHAR* PercentileName : PercentileNames)
+		{
+			double BaselineMs = 0.0;
+			double ResultMs = 0.0;
+			if (!(*BaselineValues)->TryGetNumberField(PercentileName, BaselineMs) || !(*ResultValues)->TryGetNumberField(PercentileName, ResultMs))
+			{
+				continue;
+			}
+
+			const double LimitMs = FMath::Max(BaselineMs * (1.0 + Tolerance / 100.0), BaselineMs + SlackMs);
+			const bool bRegressed = ResultMs > LimitMs;
+			UE_LOG(LogGauntlet, Display, TEXT("PerfTest %s: %s %s %.2fms (baseline %.2fms, limit %.2fms)%s"),
+				*TestName, *BaselineBudget.Key, PercentileName, ResultMs, BaselineMs, LimitMs, bRegressed ? TEXT(" REGRESSED") : TEXT(""));
+			bPassed &= !bRegressed;
+		}
+
+		double MaxMs = 0.0;
+		double ResultP95 = 0.0;
+		if ((*BaselineValues)->TryGetNumberField(MaxMsName, MaxMs) && (*ResultValues)->TryGetNumberField(TEXT("P95"), ResultP95) && ResultP95 > MaxMs)
+		{
+			UE_LOG(LogGauntlet, Display, TEXT("PerfTest %s: %s P95 %.2fms is over the %.2fms budget"), *TestName, *BaselineBudget.Key, ResultP95, MaxMs);
+			bPassed = false;
+		}
+	}
+
+	return bPassed;
+}
+
+FString UGauntletTestControllerPerfTest::GetBaselinePath() const
+{
+	if (BaselinePath.Len())
+	{
+		return BaselinePath;
+	}
+	return FPaths::ProjectDir() / TEXT("Build/PerfBaselines") / ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()) / (TestName + TEXT(".json"));
+}
+
+const TCHAR* UGauntletTestControllerPerfTest::GetBudgetName(int32 Budget)
+{
+	switch (Budget)
+	{
+	case Budget_GameThread:		return TEXT("GameThread");
+	case Budget_RenderThread:	return TEXT("RenderThread");
+	case Budget_GPU:			return TEXT("GPU");
+	case Budget_Net:			return TEXT("Net");
+	case Budget_Frame:			return TEXT("Frame");
+	}
+	return TEXT("Unknown");
+}
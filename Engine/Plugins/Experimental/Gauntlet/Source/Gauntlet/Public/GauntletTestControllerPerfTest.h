@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GauntletTestController.h"
+#include "GauntletTestControllerPerfTest.generated.h"
+
+class FJsonObject;
+
+/**
+ *	Performance regression test, run with -gauntlet=PerfTest.
+ *
+ *	Once the test map is loaded (or the given Gauntlet state is entered) the controller runs the optional start
+ *	commands, e.g. to begin a flythrough sequence or add bots, waits for a warm up period and then records the frame
+ *	times of each budget (game thread, render thread, GPU, net and whole frame) for the capture duration. A CSV
+ *	profile and optionally a trace are captured alongside.
+ *
+ *	The percentiles of each budget are written to a results file and compared against a per platform baseline in the
+ *	same format. The test fails (exit code 1) if any percentile grew by more than the tolerance, or went over the
+ *	absolute budget given in the baseline.
+ *
+ *	Options:
+ *		-perftest.name=<Name>			Name of the test, used for the baseline and results files. Defaults to the map name.
+ *		-perftest.map=<Map>				Start once this map is loaded (default: the first map loaded).
+ *		-perftest.state=<State>			Start once Gauntlet enters this state instead.
+ *		-perftest.cmds=<Cmd+Cmd>		Console commands run when the test starts.
+ *		-perftest.warmup=<Seconds>		Time to let the game settle before capturing (default 10).
+ *		-perftest.duration=<Seconds>	Capture length (default 60).
+ *		-perftest.trace=<Channels>		Also capture a trace with these channels.
+ *		-perftest.baseline=<Path>		Baseline to compare with (default Build/PerfBaselines/<Platform>/<Name>.json).
+ *		-perftest.updatebaseline		Write the results over the baseline rather than comparing with it.
+ *		-perftest.tolerance=<Percent>	Allowed growth of a percentile over its baseline (default 5).
+ *		-perftest.slackms=<Ms>			Growth below this is never a regression, which keeps tiny budgets from flapping (default 0.25).
+ */
+UCLASS()
+class GAUNTLET_API UGauntletTestControllerPerfTest : public UGauntletTestController
+{
+	GENERATED_BODY()
+
+protected:
+
+	void	OnInit() override;
+	void	OnPostMapChange(UWorld* World) override;
+	void	OnStateChange(FName OldState, FName NewState) override;
+	void	OnTick(float TimeDelta) override;
+	void	BeginDestroy() override;
+
+private:
+
+	enum class EPhase : uint8
+	{
+		WaitingForStart,
+		Warmup,
+		Capture,
+		Done,
+	};
+
+	enum EBudget
+	{
+		Budget_GameThread,
+		Budget_RenderThread,
+		Budget_GPU,
+		Budget_Net,
+		Budget_Frame,
+		Budget_Count,
+	};
+
+	void	StartTest();
+	void	BeginCapture();
+	void	EndCaptureAndEvaluate();
+	void	OnEndFrame();
+
+	/** Builds the results in the baseline format, skipping budgets which weren't measured (e.g. GPU on a server) */
+	TSharedRef<FJsonObject>	BuildResults() const;
+
+	/** Returns true if none of the results regressed against the baseline */
+	bool	CompareWithBaseline(const FJsonObject& Results, const FJsonObject& Baseline) const;
+
+	FString	GetBaselinePath() const;
+
+	static const TCHAR* GetBudgetName(int32 Budget);
+
+	EPhase			Phase;
+	double			PhaseStartTime;
+
+	FString			TestName;
+	FString			StartMap;
+	FName			StartState;
+	TArray<FString>	StartCommands;
+	FString			TraceChannels;
+	FString			BaselinePath;
+	bool			bUpdateBaseline;
+	float			WarmupSeconds;
+	float			DurationSeconds;
+	float			TolerancePercent;
+	float			SlackMs;
+
+	/** Per frame times in milliseconds, for each budget */
+	TArray<float>	FrameTimes[Budget_Count];
+
+	FDelegateHandle	EndFrameHandle;
+};
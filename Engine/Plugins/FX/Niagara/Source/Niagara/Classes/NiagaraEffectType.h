@@ -169,6 +169,25 @@ struct FNiagaraEmitterScalabilitySettings
 	UPROPERTY(EditAnywhere, Category = "Scalability", meta = (EditCondition = "bScaleSpawnCount"))
 	float SpawnCountScale;
 
+	/** Enable scaling of spawn counts by the LOD distance of the owning system instance. */
+	UPROPERTY(EditAnywhere, Category = "Scalability", meta = (InlineEditConditionToggle))
+	uint32 bScaleSpawnCountByDistance : 1;
+
+	/** Distance at which spawn count scaling by distance begins. Closer than this the emitter spawns at full rate. */
+	UPROPERTY(EditAnywhere, Category = "Scalability", meta = (EditCondition = "bScaleSpawnCountByDistance", ClampMin = "0.0"))
+	float SpawnCountScaleNearDistance;
+
+	/** Distance at which spawn count scaling by distance reaches SpawnCountScaleAtFarDistance. */
+	UPROPERTY(EditAnywhere, Category = "Scalability", meta = (EditCondition = "bScaleSpawnCountByDistance", ClampMin = "0.0"))
+	float SpawnCountScaleFarDistance;
+
+	/** Scale factor applied to spawn counts for this emitter at or beyond SpawnCountScaleFarDistance. */
+	UPROPERTY(EditAnywhere, Category = "Scalability", meta = (EditCondition = "bScaleSpawnCountByDistance", ClampMin = "0.0", ClampMax = "1.0"))
+	float SpawnCountScaleAtFarDistance;
+
+	/** Returns the final spawn count scale for this emitter given the LOD distance of the owning system instance. */
+	float GetSpawnCountScale(float LODDistance) const;
+
 	FNiagaraEmitterScalabilitySettings();
 	void Clear();
 };
@@ -193,6 +212,10 @@ struct FNiagaraEmitterScalabilityOverride : public FNiagaraEmitterScalabilitySet
 	//Controls whether spawn count scale should be overridden.
 	UPROPERTY(EditAnywhere, Category = "Override")
 	uint32 bOverrideSpawnCountScale : 1;
+
+	//Controls whether spawn count scaling by distance should be overridden.
+	UPROPERTY(EditAnywhere, Category = "Override")
+	uint32 bOverrideSpawnCountScaleByDistance : 1;
 };
 
 /** Container struct for an array of emitter scalability overrides. Enables details customization and data validation. */
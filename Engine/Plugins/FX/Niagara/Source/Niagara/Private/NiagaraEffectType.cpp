@@ -183,10 +183,27 @@ void FNiagaraEmitterScalabilitySettings::Clear()
 {
 	SpawnCountScale = 1.0f;
 	bScaleSpawnCount = false;
+	bScaleSpawnCountByDistance = false;
+	SpawnCountScaleNearDistance = 1000.0f;
+	SpawnCountScaleFarDistance = 5000.0f;
+	SpawnCountScaleAtFarDistance = 0.25f;
+}
+
+float FNiagaraEmitterScalabilitySettings::GetSpawnCountScale(float LODDistance) const
+{
+	float Scale = bScaleSpawnCount ? SpawnCountScale : 1.0f;
+	if (bScaleSpawnCountByDistance)
+	{
+		const float Range = SpawnCountScaleFarDistance - SpawnCountScaleNearDistance;
+		const float Alpha = Range > SMALL_NUMBER ? FMath::Clamp((LODDistance - SpawnCountScaleNearDistance) / Range, 0.0f, 1.0f) : (LODDistance >= SpawnCountScaleFarDistance ? 1.0f : 0.0f);
+		Scale *= FMath::Lerp(1.0f, SpawnCountScaleAtFarDistance, Alpha);
+	}
+	return Scale;
 }
 
 FNiagaraEmitterScalabilityOverride::FNiagaraEmitterScalabilityOverride()
 	: bOverrideSpawnCountScale(false)
+	, bOverrideSpawnCountScaleByDistance(false)
 {
 }
 
@@ -2222,6 +2222,14 @@ void UNiagaraEmitter::ResolveScalabilitySettings()
 				CurrentScalabilitySettings.bScaleSpawnCount = Override.bScaleSpawnCount;
 				CurrentScalabilitySettings.SpawnCountScale = Override.SpawnCountScale;
 			}
+
+			if (Override.bOverrideSpawnCountScaleByDistance)
+			{
+				CurrentScalabilitySettings.bScaleSpawnCountByDistance = Override.bScaleSpawnCountByDistance;
+				CurrentScalabilitySettings.SpawnCountScaleNearDistance = Override.SpawnCountScaleNearDistance;
+				CurrentScalabilitySettings.SpawnCountScaleFarDistance = Override.SpawnCountScaleFarDistance;
+				CurrentScalabilitySettings.SpawnCountScaleAtFarDistance = Override.SpawnCountScaleAtFarDistance;
+			}
 		}
 	}
 }
@@ -1826,7 +1826,7 @@ void FNiagaraSystemInstance::TickInstanceParameters_GameThread(float DeltaSecond
 			CurrentEmitterParameters.EmitterRandomSeed = Emitter->GetRandomSeed();
 			CurrentEmitterParameters.EmitterInstanceSeed = Emitter->GetInstanceSeed();
 			const FNiagaraEmitterScalabilitySettings& ScalabilitySettings = Emitter->GetScalabilitySettings();
-			CurrentEmitterParameters.EmitterSpawnCountScale = ScalabilitySettings.bScaleSpawnCount ? ScalabilitySettings.SpawnCountScale : 1.0f;
+			CurrentEmitterParameters.EmitterSpawnCountScale = ScalabilitySettings.GetSpawnCountScale(GetLODDistance());
 			++GatheredInstanceParameters.NumAlive;
 		}
 		else
@@ -2155,6 +2155,27 @@ void FNiagaraSystemInstance::Tick_Concurrent(bool bEnqueueGPUTickIfNeeded)
 
 	FNiagaraCrashReporterScope CRScope(this);
 
+	TBitArray<TInlineAllocator<8>> EmittersShouldTick;
+	if ( !Tick_Concurrent_Begin(EmittersShouldTick) )
+	{
+		return;
+	}
+
+	FScopeCycleCounter SystemStat(GetSystem()->GetStatID(true, true));
+
+	int32 TotalCombinedParamStoreSize = 0;
+
+	// now tick all emitters
+	for (const FNiagaraEmitterExecutionIndex& EmitterExecIdx : GetEmitterExecutionOrder())
+	{
+		Tick_Concurrent_Emitter(EmitterExecIdx.EmitterIndex, EmittersShouldTick, TotalCombinedParamStoreSize);
+	}
+
+	Tick_Concurrent_End(TotalCombinedParamStoreSize, bEnqueueGPUTickIfNeeded);
+}
+
+bool FNiagaraSystemInstance::Tick_Concurrent_Begin(TBitArray<TInlineAllocator<8>>& OutEmittersShouldTick)
+{
 	// Reset values that will be accumulated during emitter tick.
 	TotalGPUParamSize = 0;
 	ActiveGPUEmitterCount = 0;
@@ -2163,7 +2184,7 @@ void FNiagaraSystemInstance::Tick_Concurrent(bool bEnqueueGPUTickIfNeeded)
 
 	if (IsComplete() || System == nullptr || CachedDeltaSeconds < SMALL_NUMBER)
 	{
-		return;
+		return false;
 	}
 
 	const int32 NumEmitters = Emitters.Num();
@@ -2171,8 +2192,7 @@ void FNiagaraSystemInstance::Tick_Concurrent(bool bEnqueueGPUTickIfNeeded)
 	checkSlow(EmitterExecutionOrder.Num() <= NumEmitters);
 
 	//Determine if any of our emitters should be ticking.
-	TBitArray<TInlineAllocator<8>> EmittersShouldTick;
-	EmittersShouldTick.Init(false, NumEmitters);
+	OutEmittersShouldTick.Init(false, NumEmitters);
 
 	bool bHasTickingEmitters = false;
 	for (const FNiagaraEmitterExecutionIndex& EmitterExecIdx : EmitterExecutionOrder)
@@ -2181,53 +2201,56 @@ void FNiagaraSystemInstance::Tick_Concurrent(bool bEnqueueGPUTickIfNeeded)
 		if (Inst.ShouldTick())
 		{
 			bHasTickingEmitters = true;
-			EmittersShouldTick.SetRange(EmitterExecIdx.EmitterIndex, 1, true);
+			OutEmittersShouldTick.SetRange(EmitterExecIdx.EmitterIndex, 1, true);
 		}
 	}
 
 	if ( !bHasTickingEmitters )
 	{
-		return;
+		return false;
 	}
 
-	FScopeCycleCounter SystemStat(System->GetStatID(true, true));
-
 	for (const FNiagaraEmitterExecutionIndex& EmitterExecIdx : EmitterExecutionOrder)
 	{
-		if (EmittersShouldTick[EmitterExecIdx.EmitterIndex])
+		if (OutEmittersShouldTick[EmitterExecIdx.EmitterIndex])
 		{
 			FNiagaraEmitterInstance& Inst = Emitters[EmitterExecIdx.EmitterIndex].Get();
 			Inst.PreTick();
 		}
 	}
 
-	int32 TotalCombinedParamStoreSize = 0;
+	return true;
+}
 
-	// now tick all emitters
-	for (const FNiagaraEmitterExecutionIndex& EmitterExecIdx : EmitterExecutionOrder)
+void FNiagaraSystemInstance::Tick_Concurrent_Emitter(int32 EmitterIndex, const TBitArray<TInlineAllocator<8>>& EmittersShouldTick, int32& InOutTotalCombinedParamStoreSize)
+{
+	FNiagaraEmitterInstance& Inst = Emitters[EmitterIndex].Get();
+	if (EmittersShouldTick[EmitterIndex])
 	{
-		FNiagaraEmitterInstance& Inst = Emitters[EmitterExecIdx.EmitterIndex].Get();
-		if (EmittersShouldTick[EmitterExecIdx.EmitterIndex])
-		{
-			Inst.Tick(CachedDeltaSeconds);
-		}
+		Inst.Tick(CachedDeltaSeconds);
+	}
 
-		if (Inst.GetCachedEmitter() && Inst.GetCachedEmitter()->SimTarget == ENiagaraSimTarget::GPUComputeSim && !Inst.IsComplete())
+	if (Inst.GetCachedEmitter() && Inst.GetCachedEmitter()->SimTarget == ENiagaraSimTarget::GPUComputeSim && !Inst.IsComplete())
+	{
+		// Handle edge case where an emitter was set to inactive on the first frame by scalability
+		// Since it will not tick we should not execute a GPU tick for it, this test must be symeterical with FNiagaraGPUSystemTick::Init
+		const bool bIsInactive = (Inst.GetExecutionState() == ENiagaraExecutionState::Inactive) || (Inst.GetExecutionState() == ENiagaraExecutionState::InactiveClear);
+		if (Inst.HasTicked() || !bIsInactive)
 		{
-			// Handle edge case where an emitter was set to inactive on the first frame by scalability
-			// Since it will not tick we should not execute a GPU tick for it, this test must be symeterical with FNiagaraGPUSystemTick::Init
-			const bool bIsInactive = (Inst.GetExecutionState() == ENiagaraExecutionState::Inactive) || (Inst.GetExecutionState() == ENiagaraExecutionState::InactiveClear);
-			if (Inst.HasTicked() || !bIsInactive)
+			if (const FNiagaraComputeExecutionContext* GPUContext = Inst.GetGPUContext())
 			{
-				if (const FNiagaraComputeExecutionContext* GPUContext = Inst.GetGPUContext())
-				{
-					TotalCombinedParamStoreSize += GPUContext->CombinedParamStore.GetPaddedParameterSizeInBytes();
-					GPUParamIncludeInterpolation = GPUContext->HasInterpolationParameters || GPUParamIncludeInterpolation;
-					ActiveGPUEmitterCount++;
-				}
+				InOutTotalCombinedParamStoreSize += GPUContext->CombinedParamStore.GetPaddedParameterSizeInBytes();
+				GPUParamIncludeInterpolation = GPUContext->HasInterpolationParameters || GPUParamIncludeInterpolation;
+				ActiveGPUEmitterCount++;
 			}
 		}
 	}
+}
+
+void FNiagaraSystemInstance::Tick_Concurrent_End(int32 TotalCombinedParamStoreSize, bool bEnqueueGPUTickIfNeeded)
+{
+	UNiagaraSystem* System = GetSystem();
+	check(System);
 
 	if (ActiveGPUEmitterCount)
 	{
@@ -88,6 +88,15 @@ static FAutoConsoleVariableRef CVarParallelSystemInstanceTickBatchSize(
 	ECVF_Default
 );
 
+static int32 GNiagaraSystemSimulationBatchEmitterTicks = 1;
+static FAutoConsoleVariableRef CVarNiagaraBatchEmitterTicks(
+	TEXT("fx.Niagara.SystemSimulation.BatchEmitterTicks"),
+	GNiagaraSystemSimulationBatchEmitterTicks,
+	TEXT("If > 0, each concurrent tick batch ticks the emitters of all its instances emitter by emitter rather than instance by instance.\n")
+	TEXT("This keeps each emitter's scripts and data hot in cache when there are many instances of a system.\n"),
+	ECVF_Default
+);
+
 static int32 GNiagaraSystemSimulationConcurrentGPUTickInit = 1;
 static FAutoConsoleVariableRef CVarNiagaraConcurrentGPUTickInit(
 	TEXT("fx.Niagara.SystemSimulation.ConcurrentGPUTickInit"),
@@ -411,14 +420,23 @@ struct FNiagaraSystemInstanceTickConcurrentTask
 		NiagaraSystemSimulationLocal::DebugDelayInstancesTask();
 #endif
 
+		const bool bBatchEmitterTicks = ShouldBatchEmitterTicks();
 		if (SystemSimulation->GetGPUTickHandlingMode() == ENiagaraGPUTickHandlingMode::ConcurrentBatched)
 		{
+			if (bBatchEmitterTicks)
+			{
+				TickEmitterBatched(false);
+			}
+
 			TArray<TPair<FNiagaraSystemGpuComputeProxy*, FNiagaraGPUSystemTick>, TInlineAllocator<NiagaraSystemTickBatchSize>> GPUTicks;
 			GPUTicks.Reserve(Batch.Num());
 			for (FNiagaraSystemInstance* Inst : Batch)
 			{
-				PARTICLE_PERF_STAT_CYCLES_GT(FParticlePerfStatsContext(GetInstancePerfStats(Inst)), TickConcurrent);
-				Inst->Tick_Concurrent(false);
+				if (!bBatchEmitterTicks)
+				{
+					PARTICLE_PERF_STAT_CYCLES_GT(FParticlePerfStatsContext(GetInstancePerfStats(Inst)), TickConcurrent);
+					Inst->Tick_Concurrent(false);
+				}
 				if (Inst->NeedsGPUTick())
 				{
 					auto& Tick = GPUTicks.AddDefaulted_GetRef();
@@ -440,6 +458,10 @@ struct FNiagaraSystemInstanceTickConcurrentTask
 				);
 			}
 		}
+		else if (bBatchEmitterTicks)
+		{
+			TickEmitterBatched(true);
+		}
 		else
 		{
 			for (FNiagaraSystemInstance* Inst : Batch)
@@ -450,6 +472,69 @@ struct FNiagaraSystemInstanceTickConcurrentTask
 		}
 	}
 
+	bool ShouldBatchEmitterTicks() const
+	{
+		return GNiagaraSystemSimulationBatchEmitterTicks != 0 && Batch.Num() > 1;
+	}
+
+	/**
+	Equivalent of calling Tick_Concurrent on each instance, but ticks the emitters emitter by emitter across the batch.
+	All instances share the system's emitter execution order so the per instance ordering of emitters is unchanged.
+	*/
+	void TickEmitterBatched(bool bEnqueueGPUTickIfNeeded)
+	{
+		TArray<FNiagaraSystemInstance*, TInlineAllocator<NiagaraSystemTickBatchSize>> TickingInstances;
+		TArray<TBitArray<TInlineAllocator<8>>, TInlineAllocator<NiagaraSystemTickBatchSize>> EmittersShouldTick;
+		TickingInstances.Reserve(Batch.Num());
+		EmittersShouldTick.Reserve(Batch.Num());
+
+		for (FNiagaraSystemInstance* Inst : Batch)
+		{
+			PARTICLE_PERF_STAT_CYCLES_GT(FParticlePerfStatsContext(GetInstancePerfStats(Inst)), TickConcurrent);
+			FNiagaraCrashReporterScope CRScope(Inst);
+
+			TBitArray<TInlineAllocator<8>>& ShouldTick = EmittersShouldTick.AddDefaulted_GetRef();
+			if (Inst->Tick_Concurrent_Begin(ShouldTick))
+			{
+				TickingInstances.Add(Inst);
+			}
+			else
+			{
+				EmittersShouldTick.Pop(false);
+			}
+		}
+
+		if (TickingInstances.Num() == 0)
+		{
+			return;
+		}
+
+		UNiagaraSystem* System = SystemSimulation->GetSystem();
+		FScopeCycleCounter SystemStat(System->GetStatID(true, true));
+
+		TArray<int32, TInlineAllocator<NiagaraSystemTickBatchSize>> TotalCombinedParamStoreSizes;
+		TotalCombinedParamStoreSizes.AddZeroed(TickingInstances.Num());
+
+		for (const FNiagaraEmitterExecutionIndex& EmitterExecIdx : System->GetEmitterExecutionOrder())
+		{
+			for (int32 i = 0; i < TickingInstances.Num(); ++i)
+			{
+				FNiagaraSystemInstance* Inst = TickingInstances[i];
+				PARTICLE_PERF_STAT_CYCLES_GT(FParticlePerfStatsContext(GetInstancePerfStats(Inst)), TickConcurrent);
+				FNiagaraCrashReporterScope CRScope(Inst);
+				Inst->Tick_Concurrent_Emitter(EmitterExecIdx.EmitterIndex, EmittersShouldTick[i], TotalCombinedParamStoreSizes[i]);
+			}
+		}
+
+		for (int32 i = 0; i < TickingInstances.Num(); ++i)
+		{
+			FNiagaraSystemInstance* Inst = TickingInstances[i];
+			PARTICLE_PERF_STAT_CYCLES_GT(FParticlePerfStatsContext(GetInstancePerfStats(Inst)), TickConcurrent);
+			FNiagaraCrashReporterScope CRScope(Inst);
+			Inst->Tick_Concurrent_End(TotalCombinedParamStoreSizes[i], bEnqueueGPUTickIfNeeded);
+		}
+	}
+
 	FNiagaraSystemSimulation* SystemSimulation = nullptr;
 	FNiagaraSystemTickBatch Batch;
 };
@@ -169,6 +169,15 @@ public:
 	void Tick_GameThread(float DeltaSeconds);
 	/** Secondary phase of the system instance tick that can be executed on any thread. */
 	void Tick_Concurrent(bool bEnqueueGPUTickIfNeeded = true);
+
+	/**
+		Tick_Concurrent split into its stages so that several instances of the same system can tick their emitters emitter by emitter, keeping each emitter's scripts hot in cache.
+		Tick_Concurrent_Begin returns false if there is nothing to tick, in which case the other stages must not be called.
+		Tick_Concurrent_Emitter is called for each entry of GetEmitterExecutionOrder() in order, then Tick_Concurrent_End.
+	*/
+	bool Tick_Concurrent_Begin(TBitArray<TInlineAllocator<8>>& OutEmittersShouldTick);
+	void Tick_Concurrent_Emitter(int32 EmitterIndex, const TBitArray<TInlineAllocator<8>>& EmittersShouldTick, int32& InOutTotalCombinedParamStoreSize);
+	void Tick_Concurrent_End(int32 TotalCombinedParamStoreSize, bool bEnqueueGPUTickIfNeeded = true);
 	/** 
 		Final phase of system instance tick. Must be executed on the game thread. 
 		Returns whether the Finalize was actually done. It's possible for the finalize in a task to have already been done earlier on the GT by a WaitForAsyncAndFinalize call.
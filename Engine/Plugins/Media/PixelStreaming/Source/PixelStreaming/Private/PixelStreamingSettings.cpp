@@ -122,6 +122,12 @@ namespace PixelStreamingSettings
 		3,
 		TEXT("Maximum number of back buffers to use. A value of 0 will not limit the number of back buffers."),
 		ECVF_Default);
+
+	TAutoConsoleVariable<bool> CVarPixelStreamingCaptureOnDemand(
+		TEXT("PixelStreaming.Capturer.CaptureOnDemand"),
+		true,
+		TEXT("Only copy the back buffer when the encoder is due for a frame, and submit it as soon as the copy is done. Otherwise every rendered frame is copied and the newest one is submitted at the stream rate."),
+		ECVF_Default);
 // End Capturer CVars
 
 // Begin WebRTC CVars
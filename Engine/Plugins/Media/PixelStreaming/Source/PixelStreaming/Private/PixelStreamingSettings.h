@@ -33,6 +33,7 @@ namespace PixelStreamingSettings
 	extern TAutoConsoleVariable<bool> CVarPixelStreamingUseBackBufferCaptureSize;
 	extern TAutoConsoleVariable<FString> CVarPixelStreamingCaptureSize;
 	extern TAutoConsoleVariable<int32> CVarPixelStreamingMaxNumBackBuffers;
+	extern TAutoConsoleVariable<bool> CVarPixelStreamingCaptureOnDemand;
 // End Capturer CVars
 
 // Begin WebRTC CVars
@@ -11,6 +11,7 @@ FPixelStreamingVideoSources::FPixelStreamingVideoSources()
     , bFixedResolution(PixelStreamingSettings::CVarPixelStreamingWebRTCDisableResolutionChange.GetValueOnAnyThread())
     , ThreadWaiter(FPlatformProcess::GetSynchEventFromPool(false))
     , bIsThreadRunning(true)
+    , bCaptureOnDemand(PixelStreamingSettings::CVarPixelStreamingCaptureOnDemand.GetValueOnAnyThread())
 {
 	this->FrameDelayMs = (1.0f / PixelStreamingSettings::CVarPixelStreamingWebRTCMaxFps.GetValueOnAnyThread()) * 1000.0f;
 
@@ -23,6 +24,7 @@ FPixelStreamingVideoSources::FPixelStreamingVideoSources(int Width, int Height)
     , bFixedResolution(true)
     , ThreadWaiter(FPlatformProcess::GetSynchEventFromPool(false))
     , bIsThreadRunning(true)
+    , bCaptureOnDemand(PixelStreamingSettings::CVarPixelStreamingCaptureOnDemand.GetValueOnAnyThread())
 {
     this->VideoSourcesThread = MakeUnique<FThread>(TEXT("VideoSourcesThread"), [this]() { this->RunVideoSourcesLoop_VideoSourcesThread(); });
 }
@@ -90,13 +92,28 @@ void FPixelStreamingVideoSources::OnFrameReady(const FTexture2DRHIRef& FrameBuff
         // Make FVideoEncoderInput at the appropriate resolution based on VideoSource settings
         this->StartResolution = this->bMatchFrameBufferResolution ? FrameBuffer->GetSizeXY() : this->StartResolution;
         this->VideoCapturerContext = MakeShared<FVideoCapturerContext, ESPMode::ThreadSafe>(this->StartResolution.X, this->StartResolution.Y, this->bFixedResolution);
+
+        if(this->bCaptureOnDemand)
+        {
+            // The frame can be submitted as soon as it has been copied
+            this->VideoCapturerContext->SetOnFrameCaptured([this]() { this->ThreadWaiter->Trigger(); });
+        }
+    }
+
+    // Rendered frames the encoder isn't due for yet aren't copied at all, only the first one to start the stream
+    if(this->bCaptureOnDemand && this->VideoCapturerContext->IsInitialized() && !this->VideoCapturerContext->IsCaptureRequested())
+    {
+        return;
     }
 
     // Copy frame.
     this->VideoCapturerContext->CaptureFrame(FrameBuffer);
 
-    // Backbuffer now has something captured, thread can wake up (if needed).
-    this->ThreadWaiter->Trigger();
+    if(!this->bCaptureOnDemand)
+    {
+        // Backbuffer now has something captured, thread can wake up (if needed).
+        this->ThreadWaiter->Trigger();
+    }
 }
 
 bool FPixelStreamingVideoSources::IsInVideoSourcesThread()
@@ -134,7 +151,30 @@ void FPixelStreamingVideoSources::RunVideoSourcesLoop_VideoSourcesThread()
         }
 
         // Submit Frame if we have a video source
-        if(this->VideoSources.Num() > 0 && this->VideoCapturerContext.IsValid() && this->VideoCapturerContext->IsInitialized())
+        if(this->bCaptureOnDemand && this->VideoSources.Num() > 0 && this->VideoCapturerContext.IsValid() && this->VideoCapturerContext->IsInitialized())
+        {
+            // Ask the render thread for the next frame and submit it as soon as it has been copied. If the game doesn't
+            // render one in time, the last frame is submitted again to keep the stream going.
+            const uint64 RequestCycles = FPlatformTime::Cycles64();
+            this->VideoCapturerContext->RequestCapture();
+
+            double ElapsedMs = 0.0;
+            while(this->bIsThreadRunning && !this->VideoCapturerContext->HasNewCapturedFrame() && ElapsedMs < this->FrameDelayMs)
+            {
+                this->ThreadWaiter->Wait(this->FrameDelayMs - ElapsedMs, false);
+                ElapsedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - RequestCycles);
+            }
+
+            this->SubmitFrame_VideoSourcesThread();
+
+            // The stream rate is kept by spacing out the requests, so the copy time doesn't add up between frames
+            ElapsedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - RequestCycles);
+            if(this->bIsThreadRunning && ElapsedMs < this->FrameDelayMs)
+            {
+                this->ThreadWaiter->Wait(this->FrameDelayMs - ElapsedMs, false);
+            }
+        }
+        else if(this->VideoSources.Num() > 0 && this->VideoCapturerContext.IsValid() && this->VideoCapturerContext->IsInitialized())
         {
 
             this->SubmitFrame_VideoSourcesThread();
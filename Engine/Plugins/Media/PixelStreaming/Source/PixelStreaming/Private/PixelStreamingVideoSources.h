@@ -58,4 +58,5 @@ class FPixelStreamingVideoSources
         TQueue<TFunction<void()>> QueuedTasks;
         FThreadSafeBool bIsThreadRunning;
 		float FrameDelayMs = (1.0 / 60.0f) * 1000.0f;
+		bool bCaptureOnDemand = true;
 };
\ No newline at end of file
@@ -53,6 +53,26 @@ bool FVideoCapturerContext::IsInitialized() const
     return this->bIsInitialized;
 }
 
+void FVideoCapturerContext::RequestCapture()
+{
+	this->bIsCaptureRequested = true;
+}
+
+bool FVideoCapturerContext::IsCaptureRequested() const
+{
+	return this->bIsCaptureRequested;
+}
+
+bool FVideoCapturerContext::HasNewCapturedFrame() const
+{
+	return this->bIsTempDirty;
+}
+
+void FVideoCapturerContext::SetOnFrameCaptured(TFunction<void()> InOnFrameCaptured)
+{
+	this->OnFrameCaptured = MoveTemp(InOnFrameCaptured);
+}
+
 FTexture2DRHIRef FVideoCapturerContext::MakeTexture()
 {
 	FRHIResourceCreateInfo CreateInfo(TEXT("VideoCapturerBackBuffer"));
@@ -93,6 +113,7 @@ void FVideoCapturerContext::CaptureFrame(const FTexture2DRHIRef& FrameBuffer)
 		FLatencyTester::RecordPreCaptureTime();
 	}
 
+	bIsCaptureRequested = false;
 	bIsEvenFrame = !bIsEvenFrame;
 	FVideoCaptureFrame& Frame = bIsEvenFrame ? EvenFrame : OddFrame;
 
@@ -123,6 +144,11 @@ void FVideoCapturerContext::CaptureFrame(const FTexture2DRHIRef& FrameBuffer)
 			bIsTempDirty = true;
 		}
 
+		if(OnFrameCaptured)
+		{
+			OnFrameCaptured();
+		}
+
 		uint64 PostWaitingOnCopy = FPlatformTime::Cycles64();
 
 		FPixelStreamingStats& Stats = FPixelStreamingStats::Get();
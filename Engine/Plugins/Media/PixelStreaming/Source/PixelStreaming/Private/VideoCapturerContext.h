@@ -36,6 +36,14 @@ class FVideoCapturerContext
         FTextureObtainer RequestNewestCapturedFrame();
         bool IsInitialized() const;
 
+        // Capture on demand: the next CaptureFrame is only wanted once the encoder asked for it.
+        void RequestCapture();
+        bool IsCaptureRequested() const;
+        // Whether a frame finished copying since the encoder last took one.
+        bool HasNewCapturedFrame() const;
+        // Called on a worker thread once a captured frame finished copying and can be submitted.
+        void SetOnFrameCaptured(TFunction<void()> InOnFrameCaptured);
+
     private:
         FTexture2DRHIRef MakeTexture();
         void Shutdown();
@@ -53,6 +61,8 @@ class FVideoCapturerContext
         FTexture2DRHIRef EncoderTexture;
 
 		FThreadSafeBool bIsTempDirty;
+		FThreadSafeBool bIsCaptureRequested;
+		TFunction<void()> OnFrameCaptured;
 
         FThreadSafeCounter NextFrameID;
         FThreadSafeBool bIsInitialized;
@@ -4,6 +4,8 @@
 
 #include "CoreTypes.h"
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Serialization/ArrayReader.h"
 #include "Misc/Guid.h"
 #include "Serialization/Archive.h"
 #include "IMessageContext.h"
@@ -251,8 +253,8 @@ namespace FUdpMessageSegment
 					<< SegmentNumber
 					<< SegmentOffset
 					<< Sequence
-					<< TotalSegments
-					<< Chunk.Data;
+					<< TotalSegments;
+				Chunk.SerializeData(Ar);
 				if (ProtocolVersion > 10)
 				{
 					Ar << MessageFlags;
@@ -296,9 +298,21 @@ namespace FUdpMessageSegment
 		/** Holds the segment data. */
 		TArray<uint8> Data;
 
+		/**
+		 * Non-owning view of the segment data, used instead of Data to avoid copying segments around.
+		 * When saving, it's serialized if Data is empty. When loading with LoadView, it points into the reader's buffer.
+		 */
+		TArrayView<const uint8> DataView;
+
 	public:
 		FDataChunk() = default;
 
+		/** @return the segment data, from either Data or DataView. */
+		TArrayView<const uint8> GetData() const
+		{
+			return Data.Num() > 0 ? TArrayView<const uint8>(Data) : DataView;
+		}
+
 		/**
 		 * Serializes the given header from or to the specified archive for the specified version.
 		 *
@@ -316,8 +330,8 @@ namespace FUdpMessageSegment
 					<< SegmentNumber
 					<< SegmentOffset
 					<< TotalSegments
-					<< Sequence
-					<< Data;
+					<< Sequence;
+				SerializeData(Ar);
 			}
 			// if previous version 10 or 11
 			else
@@ -326,6 +340,64 @@ namespace FUdpMessageSegment
 				PreviousV10_11.Serialize(Ar, ProtocolVersion);
 			}
 		}
+
+		/**
+		 * Loads the given header from the specified reader, without copying the segment data.
+		 *
+		 * DataView points into the reader's buffer afterwards, so it's only valid for as long as the reader is.
+		 * Previous protocol versions fall back to copying into Data.
+		 *
+		 * @param Ar The reader to load from.
+		 * @param ProtocolVersion The protocol version the Chunk is serialized in.
+		 */
+		void LoadView(FArrayReader& Ar, uint8 ProtocolVersion)
+		{
+			check(Ar.IsLoading());
+
+			if (ProtocolVersion > 11)
+			{
+				Ar	<< MessageId
+					<< MessageSize
+					<< MessageFlags
+					<< SegmentNumber
+					<< SegmentOffset
+					<< TotalSegments
+					<< Sequence;
+
+				int32 DataSize = 0;
+				Ar << DataSize;
+
+				if (DataSize < 0 || DataSize > Ar.TotalSize() - Ar.Tell())
+				{
+					Ar.SetError();
+					return;
+				}
+
+				Data.Reset();
+				DataView = MakeArrayView(Ar.GetData() + Ar.Tell(), DataSize);
+				Ar.Seek(Ar.Tell() + DataSize);
+			}
+			else
+			{
+				Serialize(Ar, ProtocolVersion);
+			}
+		}
+
+	private:
+		/** Serializes the segment data, wire compatible with serializing Data directly. */
+		void SerializeData(FArchive& Ar)
+		{
+			if (Ar.IsSaving() && Data.Num() == 0)
+			{
+				int32 DataSize = DataView.Num();
+				Ar << DataSize;
+				Ar.Serialize(const_cast<uint8*>(DataView.GetData()), DataSize);
+			}
+			else
+			{
+				Ar << Data;
+			}
+		}
 	};
 
 
@@ -61,6 +61,11 @@ void RunSegmentationTest(FAutomationTestBase& Test, uint32 MessageSize, uint16 S
 		Segmenter.GetNextPendingSegment(OutData, OutSegmentNumber);
 
 		Test.TestEqual(TEXT("The number of pending segments must not change when peeking at a pending segment"), Segmenter.GetPendingSendSegmentsCount(), (uint32)NumSegments);
+
+		TArrayView<const uint8> OutDataView;
+
+		Test.TestTrue(TEXT("A view of a pending segment must be returned"), Segmenter.GetPendingSegment(OutSegmentNumber, OutDataView));
+		Test.TestTrue(TEXT("The view of a pending segment must match its copied data"), OutDataView.Num() == OutData.Num() && FMemory::Memcmp(OutDataView.GetData(), OutData.GetData(), OutData.Num()) == 0);
 	}
 
 	uint32 GeneratedSegmentCount = 0;
@@ -609,8 +609,9 @@ void FUdpMessageProcessor::ProcessByeSegment(FInboundSegment& Segment, FNodeInfo
 
 void FUdpMessageProcessor::ProcessDataSegment(FInboundSegment& Segment, FNodeInfo& NodeInfo)
 {
+	// The segment data is reassembled straight out of the received packet
 	FUdpMessageSegment::FDataChunk DataChunk;
-	DataChunk.Serialize(*Segment.Data, NodeInfo.ProtocolVersion);
+	DataChunk.LoadView(*Segment.Data, NodeInfo.ProtocolVersion);
 
 	if (Segment.Data->IsError())
 	{
@@ -638,7 +639,7 @@ void FUdpMessageProcessor::ProcessDataSegment(FInboundSegment& Segment, FNodeInf
 	}
 
 	NodeInfo.Statistics.SegmentsReceived++;
-	ReassembledMessage->Reassemble(DataChunk.SegmentNumber, DataChunk.SegmentOffset, DataChunk.Data, CurrentTime);
+	ReassembledMessage->Reassemble(DataChunk.SegmentNumber, DataChunk.SegmentOffset, DataChunk.GetData(), CurrentTime);
 
 	// Deliver or re-sequence message
 	if (!ReassembledMessage->IsComplete() || ReassembledMessage->IsDelivered())
@@ -904,7 +905,8 @@ FUdpMessageSegment::FDataChunk FUdpMessageProcessor::GetDataChunk(FNodeInfo& Nod
 
 	// Track the segments we sent as we'll update the segmenter to keep track
 	TConstSetBitIterator<> BIt(Segmenter->GetPendingSendSegments());
-	Segmenter->GetPendingSegment(BIt.GetIndex(), DataChunk.Data);
+	// Reference the segment data in the serialized message, it's only copied once when writing the packet
+	Segmenter->GetPendingSegment(BIt.GetIndex(), DataChunk.DataView);
 	DataChunk.SegmentNumber = BIt.GetIndex();
 
 	DataChunk.MessageId = MessageId;
@@ -99,6 +99,34 @@ bool FUdpMessageSegmenter::GetPendingSegment(uint32 InSegment, TArray<uint8>& Ou
 }
 
 
+bool FUdpMessageSegmenter::GetPendingSegment(uint32 InSegment, TArrayView<const uint8>& OutData) const
+{
+	if (MessageReader == nullptr)
+	{
+		return false;
+	}
+
+	if (InSegment < (uint32)PendingSendSegments.Num() && PendingSendSegments[InSegment])
+	{
+		const TArray<uint8>& MessageData = SerializedMessage->GetDataArray();
+
+		uint64 SegmentOffset = static_cast<uint64>(InSegment) * SegmentSize;
+		uint64 ActualSegmentSize = MessageData.Num() - SegmentOffset;
+
+		if (ActualSegmentSize > SegmentSize)
+		{
+			ActualSegmentSize = SegmentSize;
+		}
+
+		OutData = MakeArrayView(MessageData.GetData() + SegmentOffset, static_cast<int32>(ActualSegmentSize));
+
+		return true;
+	}
+
+	return false;
+}
+
+
 void FUdpMessageSegmenter::Initialize()
 {
 	if (MessageReader != nullptr)
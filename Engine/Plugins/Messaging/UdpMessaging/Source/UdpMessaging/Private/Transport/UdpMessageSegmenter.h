@@ -4,6 +4,7 @@
 
 #include "CoreTypes.h"
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Containers/BitArray.h"
 #include "Templates/SharedPointer.h"
 #include "Misc/DateTime.h"
@@ -74,6 +75,17 @@ public:
 	 */
 	bool GetPendingSegment(uint32 InSegment, TArray<uint8>& OutData) const;
 
+	/**
+	 * Gets a view of the pending segment at, without copying its data.
+	 *
+	 * The view points into the serialized message, which this segmenter keeps alive, so it stays valid as long as the segmenter does.
+	 *
+	 * @param InSegment the segment number we are requesting the data for.
+	 * @param OutData Will hold the view of the segment data.
+	 * @return true if a segment was returned, false if that segment is no longer pending or the segment number is invalid.
+	 */
+	bool GetPendingSegment(uint32 InSegment, TArrayView<const uint8>& OutData) const;
+
 
 	/**
 	 * Get the pending segments array.
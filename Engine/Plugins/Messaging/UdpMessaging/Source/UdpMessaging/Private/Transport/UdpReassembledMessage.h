@@ -4,6 +4,7 @@
 
 #include "CoreTypes.h"
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Containers/BitArray.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "Misc/DateTime.h"
@@ -250,7 +251,7 @@ public:
 	 * @param SegmentData The segment data.
 	 * @param CurrentTime The current time.
 	 */
-	void Reassemble(int32 SegmentNumber, int32 SegmentOffset, const TArray<uint8>& SegmentData, const FDateTime& CurrentTime)
+	void Reassemble(int32 SegmentNumber, int32 SegmentOffset, TArrayView<const uint8> SegmentData, const FDateTime& CurrentTime)
 	{
 		if (IsMalformed() || !IsInitialized() || SegmentData.Num() == 0)
 		{
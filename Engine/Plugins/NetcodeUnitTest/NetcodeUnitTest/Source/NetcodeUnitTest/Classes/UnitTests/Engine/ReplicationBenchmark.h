@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "GameFramework/Actor.h"
+#include "ClientUnitTest.h"
+
+#include "ReplicationBenchmark.generated.h"
+
+class UMinimalClient;
+
+
+/**
+ * Replicated actor used as the synthetic actor population for UReplicationBenchmark.
+ * Serverside, it changes its replicated properties every tick, so every net update does property compares and sends data.
+ */
+UCLASS(NotPlaceable)
+class AReplicationBenchmarkActor : public AActor
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	/** Changes every tick */
+	UPROPERTY(Replicated)
+	int32 Counter;
+
+	/** Changes every tick */
+	UPROPERTY(Replicated)
+	FVector_NetQuantize100 Offset;
+
+	/** Only changes occasionally, so that compares find no changes most of the time */
+	UPROPERTY(Replicated)
+	TArray<uint8> Payload;
+
+public:
+	virtual void Tick(float DeltaSeconds) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+};
+
+
+/**
+ * Benchmark for ServerReplicateActors throughput.
+ *
+ * Launches a server, connects a number of minimal clients, spawns a synthetic population of AReplicationBenchmarkActor on the server,
+ * and then captures a CSV profile of the server (FCsvProfiler, 'Replication' category), which has per-frame replication timings,
+ * bytes per connection and FRepLayout compare cost. The CSV is written to the server's Profiling/CSV directory.
+ *
+ * Commandline parameters:
+ *	-RepBenchClients=	The number of minimal clients to connect (default 8)
+ *	-RepBenchActors=	The number of actors to spawn on the server (default 500)
+ *	-RepBenchFrames=	The number of server frames to capture (default 600)
+ */
+UCLASS()
+class UReplicationBenchmark : public UClientUnitTest
+{
+	GENERATED_UCLASS_BODY()
+
+private:
+	/** The number of minimal clients to connect, including the unit test's own minimal client */
+	int32 NumClients;
+
+	/** The number of benchmark actors to spawn on the server */
+	int32 NumActors;
+
+	/** The number of server frames to capture */
+	int32 NumCaptureFrames;
+
+	/** The additional minimal clients, besides MinClient */
+	UPROPERTY()
+	TArray<UMinimalClient*> ExtraMinClients;
+
+	/** The number of additional minimal clients that have connected */
+	int32 NumExtraClientsConnected;
+
+	/** Whether or not the CSV capture has been started on the server */
+	bool bStartedCapture;
+
+public:
+	virtual void InitializeEnvironmentSettings() override;
+
+	virtual void ExecuteClientUnitTest() override;
+
+	virtual void NotifyProcessLog(TWeakPtr<FUnitTestProcess> InProcess, const TArray<FString>& InLogLines) override;
+
+protected:
+	virtual void CleanupUnitTest(EUnitTestResetStage ResetStage) override;
+
+	virtual void UnitTick(float DeltaTime) override;
+
+private:
+	/** Connects the additional minimal clients */
+	void ConnectExtraClients();
+
+	/** Called when one of the additional minimal clients has connected */
+	void NotifyExtraClientConnected();
+
+	/** Spawns the benchmark actors on the server and starts the CSV capture, once all clients are connected */
+	void StartBenchmark();
+};
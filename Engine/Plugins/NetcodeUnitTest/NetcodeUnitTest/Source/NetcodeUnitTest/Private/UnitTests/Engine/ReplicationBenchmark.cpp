@@ -0,0 +1,268 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UnitTests/Engine/ReplicationBenchmark.h"
+
+#include "Misc/CommandLine.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+#include "UnitTestEnvironment.h"
+#include "MinimalClient.h"
+#include "NUTActor.h"
+
+
+/**
+ * Serverside command for spawning the benchmark actor population, triggered by the unit test through NMT_NUTControl
+ */
+static FAutoConsoleCommandWithWorldAndArgs GRepBenchSpawnActorsCmd(
+	TEXT("NUT.RepBench.SpawnActors"),
+	TEXT("Spawns the given number of AReplicationBenchmarkActor's in a grid around the world origin (used by the ReplicationBenchmark unit test)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+		[](const TArray<FString>& Args, UWorld* InWorld)
+		{
+			const int32 NumActors = (Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 0);
+
+			if (InWorld != nullptr && NumActors > 0)
+			{
+				const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)NumActors));
+				const float Spacing = 200.f;
+
+				FActorSpawnParameters SpawnParms;
+				SpawnParms.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+				for (int32 ActorIdx=0; ActorIdx<NumActors; ActorIdx++)
+				{
+					const FVector Location((ActorIdx % GridSize) * Spacing, (ActorIdx / GridSize) * Spacing, 0.f);
+
+					InWorld->SpawnActor<AReplicationBenchmarkActor>(Location, FRotator::ZeroRotator, SpawnParms);
+				}
+
+				UE_LOG(LogUnitTest, Log, TEXT("NUT.RepBench.SpawnActors: Spawned %i actors."), NumActors);
+			}
+		}));
+
+
+/**
+ * AReplicationBenchmarkActor
+ */
+
+AReplicationBenchmarkActor::AReplicationBenchmarkActor(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Counter(0)
+	, Offset(ForceInitToZero)
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	bReplicates = true;
+	SetReplicatingMovement(false);
+	NetCullDistanceSquared = FMath::Square(1000000.f);
+
+	Payload.SetNumZeroed(64);
+}
+
+void AReplicationBenchmarkActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (HasAuthority())
+	{
+		Counter++;
+		Offset = FVector(FMath::Sin(Counter * 0.1f), FMath::Cos(Counter * 0.1f), 0.f) * 100.f;
+
+		if ((Counter % 60) == 0)
+		{
+			Payload[(Counter / 60) % Payload.Num()]++;
+		}
+	}
+}
+
+void AReplicationBenchmarkActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AReplicationBenchmarkActor, Counter);
+	DOREPLIFETIME(AReplicationBenchmarkActor, Offset);
+	DOREPLIFETIME(AReplicationBenchmarkActor, Payload);
+}
+
+
+/**
+ * UReplicationBenchmark
+ */
+
+UReplicationBenchmark::UReplicationBenchmark(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, NumClients(8)
+	, NumActors(500)
+	, NumCaptureFrames(600)
+	, ExtraMinClients()
+	, NumExtraClientsConnected(0)
+	, bStartedCapture(false)
+{
+	UnitTestName = TEXT("ReplicationBenchmark");
+	UnitTestType = TEXT("Benchmark");
+
+	UnitTestDate = FDateTime(2020, 10, 14);
+
+	ExpectedResult.Add(TEXT("ShooterGame"), EUnitTestVerification::VerifiedFixed);
+	ExpectedResult.Add(TEXT("FortniteGame"), EUnitTestVerification::VerifiedFixed);
+
+	UnitTestTimeout = 300;
+
+	SetFlags<EUnitTestFlags::LaunchServer | EUnitTestFlags::AcceptPlayerController | EUnitTestFlags::RequireNUTActor,
+				EMinClientFlags::AcceptActors>();
+}
+
+void UReplicationBenchmark::InitializeEnvironmentSettings()
+{
+	const TCHAR* CmdLine = FCommandLine::Get();
+
+	FParse::Value(CmdLine, TEXT("RepBenchClients="), NumClients);
+	FParse::Value(CmdLine, TEXT("RepBenchActors="), NumActors);
+	FParse::Value(CmdLine, TEXT("RepBenchFrames="), NumCaptureFrames);
+
+	NumClients = FMath::Max(NumClients, 1);
+	NumActors = FMath::Max(NumActors, 0);
+	NumCaptureFrames = FMath::Max(NumCaptureFrames, 1);
+
+	BaseServerURL = UnitEnv->GetDefaultMap(UnitTestFlags);
+	BaseServerParameters = UnitEnv->GetDefaultServerParameters();
+
+	UnitEnv->InitializeUnitTasks();
+}
+
+void UReplicationBenchmark::ExecuteClientUnitTest()
+{
+	UNIT_LOG(ELogType::StatusImportant, TEXT("Benchmark ready - connecting %i clients, for %i actors over %i frames."), NumClients, NumActors,
+				NumCaptureFrames);
+
+	if (NumClients > 1)
+	{
+		ConnectExtraClients();
+	}
+	else
+	{
+		StartBenchmark();
+	}
+}
+
+void UReplicationBenchmark::ConnectExtraClients()
+{
+	FMinClientHooks Hooks;
+
+	Hooks.ConnectedDel = FOnMinClientConnected::CreateUObject(this, &UReplicationBenchmark::NotifyExtraClientConnected);
+	Hooks.NetworkFailureDel = FOnMinClientNetworkFailure::CreateUObject(this, &UClientUnitTest::NotifyNetworkFailure);
+
+	// The extra clients accept every actor, so that the server replicates the whole population to each of them
+	Hooks.RepActorSpawnDel = FOnMinClientRepActorSpawn::CreateLambda(
+		[](UClass* ActorClass, bool bActorChannel, bool& bBlockActor)
+		{
+			bBlockActor = false;
+		});
+
+	FMinClientParms Parms;
+
+	Parms.MinClientFlags = EMinClientFlags::AcceptActors;
+	Parms.ServerAddress = ServerAddress;
+	Parms.Timeout = UnitTestTimeout;
+
+	for (int32 ClientIdx=1; ClientIdx<NumClients; ClientIdx++)
+	{
+		UMinimalClient* CurClient = NewObject<UMinimalClient>(GetTransientPackage(), MinClientClass);
+
+		CurClient->SetInterface(this);
+
+		if (CurClient->Connect(Parms, Hooks))
+		{
+			ExtraMinClients.Add(CurClient);
+		}
+		else
+		{
+			UNIT_LOG(ELogType::StatusFailure, TEXT("Failed to connect benchmark client %i."), ClientIdx);
+
+			VerificationState = EUnitTestVerification::VerifiedNeedsUpdate;
+		}
+	}
+}
+
+void UReplicationBenchmark::NotifyExtraClientConnected()
+{
+	NumExtraClientsConnected++;
+
+	ResetTimeout(TEXT("NotifyExtraClientConnected"));
+
+	if (NumExtraClientsConnected == ExtraMinClients.Num() && VerificationState == EUnitTestVerification::Unverified)
+	{
+		StartBenchmark();
+	}
+}
+
+void UReplicationBenchmark::StartBenchmark()
+{
+	if (!bStartedCapture)
+	{
+		bStartedCapture = true;
+
+		UNIT_LOG(ELogType::StatusImportant, TEXT("All clients connected - spawning actors and starting the CSV capture."));
+
+		SendNUTControl(ENUTControlCommand::Command_NoResult, FString::Printf(TEXT("NUT.RepBench.SpawnActors %i"), NumActors));
+		SendNUTControl(ENUTControlCommand::Command_NoResult, TEXT("CsvCategory Replication 1"));
+		SendNUTControl(ENUTControlCommand::Command_NoResult, FString::Printf(TEXT("CsvProfile Frames=%i"), NumCaptureFrames));
+	}
+}
+
+void UReplicationBenchmark::NotifyProcessLog(TWeakPtr<FUnitTestProcess> InProcess, const TArray<FString>& InLogLines)
+{
+	Super::NotifyProcessLog(InProcess, InLogLines);
+
+	if (bStartedCapture && InProcess.HasSameObject(ServerHandle.Pin().Get()))
+	{
+		const TCHAR* CaptureEndedLog = TEXT("Capture Ended. Writing CSV to file : ");
+
+		for (const FString& CurLine : InLogLines)
+		{
+			const int32 LogIdx = CurLine.Find(CaptureEndedLog);
+
+			if (LogIdx != INDEX_NONE)
+			{
+				UNIT_LOG(ELogType::StatusImportant, TEXT("Benchmark CSV written to: %s"), *CurLine.Mid(LogIdx + FCString::Strlen(CaptureEndedLog)));
+
+				VerificationState = EUnitTestVerification::VerifiedFixed;
+				break;
+			}
+		}
+	}
+}
+
+void UReplicationBenchmark::UnitTick(float DeltaTime)
+{
+	Super::UnitTick(DeltaTime);
+
+	for (UMinimalClient* CurClient : ExtraMinClients)
+	{
+		if (CurClient != nullptr && CurClient->IsTickable())
+		{
+			CurClient->UnitTick(DeltaTime);
+		}
+	}
+}
+
+void UReplicationBenchmark::CleanupUnitTest(EUnitTestResetStage ResetStage)
+{
+	if (ResetStage <= EUnitTestResetStage::ResetConnection)
+	{
+		for (UMinimalClient* CurClient : ExtraMinClients)
+		{
+			if (CurClient != nullptr)
+			{
+				CurClient->Cleanup();
+			}
+		}
+
+		ExtraMinClients.Empty();
+		NumExtraClientsConnected = 0;
+		bStartedCapture = false;
+	}
+
+	Super::CleanupUnitTest(ResetStage);
+}
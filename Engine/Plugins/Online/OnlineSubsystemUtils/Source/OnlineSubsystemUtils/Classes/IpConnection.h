@@ -106,6 +106,13 @@ private:
 	/** Notifies us that we've encountered an error while receiving a packet. */
 	void HandleSocketRecvError(class UNetDriver* NetDriver, const FString& ErrorString);
 
+	/**
+	 * Hands the packet to the net driver's batched send queue, if net.UseSendMulti is enabled.
+	 *
+	 * @return	Whether or not the packet was queued (if not, it must be sent directly)
+	 */
+	bool QueueSendMulti(const uint8* Data, int32 CountBytes);
+
 	/** An array of sockets tied to every binding address. */
 	TArray<TSharedPtr<FSocket>> BindSockets;
 
@@ -23,6 +23,8 @@ class FInternetAddr;
 class FNetworkNotify;
 class FSocket;
 struct FRecvMulti;
+struct FSendMulti;
+class UIpConnection;
 
 
 // CVars
@@ -67,6 +69,7 @@ public:
 	virtual bool InitConnect( FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error ) override;
 	virtual bool InitListen( FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error ) override;
 	virtual void TickDispatch( float DeltaTime ) override;
+	virtual void TickFlush(float DeltaSeconds) override;
 	virtual void LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
 	virtual FString LowLevelGetNetworkNumber() override;
 	virtual void LowLevelDestroy() override;
@@ -212,6 +215,21 @@ public:
 	/** @return The address resolution timeout value */
 	float GetResolutionTimeoutValue() const { return ResolutionConnectionTimeout; }
 
+	/**
+	 * Queues a packet for sending with the next SendMulti flush, if net.UseSendMulti is enabled and supported.
+	 *
+	 * @param Connection	The connection the packet belongs to, which is notified of send errors (may be nullptr for connectionless packets)
+	 * @param InSocket		The socket the packet would have been sent on. Only packets for the driver socket are queued.
+	 * @param Data			The packet data, which is copied
+	 * @param CountBytes	The packet size in bytes
+	 * @param Address		The address to send the packet to
+	 * @return				Whether or not the packet was queued. If not, the caller should send it directly.
+	 */
+	bool QueueSendMulti(UIpConnection* Connection, FSocket* InSocket, const uint8* Data, int32 CountBytes, const FInternetAddr& Address);
+
+	/** Sends all packets queued through QueueSendMulti, with as few syscalls as possible */
+	void FlushSendMulti();
+
 private:
 	/**
 	 * Whether or not a socket receive failure Error indicates a blocking error, which should 'break;' the receive loop
@@ -293,12 +311,27 @@ private:
 		/** Running flag. The Run() function will return shortly after setting this to false. */
 		TAtomic<bool> bIsRunning;
 
+		/** Whether or not the thread receives with RecvMulti (net.UseRecvMulti), instead of one RecvFrom per packet */
+		bool IsUsingRecvMulti() const
+		{
+			return RecvMultiState.IsValid();
+		}
+
 	private:
 		bool DispatchPacket(FReceivedPacket&& IncomingPacket, int32 NbBytesRead);
 
+		/** Copies the packets from the last RecvMulti call into ReceiveQueue. Returns false if the queue filled up. */
+		bool DispatchRecvMultiPackets();
+
 	private:
 		UIpNetDriver* OwningNetDriver;
 		ISocketSubsystem* SocketSubsystem;
+
+		/** The preallocated state/buffers for RecvMulti, owned by the receive thread */
+		TUniquePtr<FRecvMulti> RecvMultiState;
+
+		/** Whether or not kernel receive timestamps are retrieved through RecvMultiState */
+		bool bRetrieveTimestamps = false;
 	};
 
 	/** Receive thread runnable object. */
@@ -310,6 +343,12 @@ private:
 	/** The preallocated state/buffers, for efficiently executing RecvMulti */
 	TUniquePtr<FRecvMulti> RecvMultiState;
 
+	/** The preallocated state/buffers, for queueing outgoing packets and sending them with SendMulti */
+	TUniquePtr<FSendMulti> SendMultiState;
+
+	/** The connection each packet in SendMultiState was queued for, so send errors can be routed back to it. Null for connectionless packets. */
+	TArray<TWeakObjectPtr<UIpConnection>> SendMultiConnections;
+
 	/** 
 	 * An array sockets created for every binding address a machine has in use for performing address resolution. 
 	 * This array empties after connections have been spun up.
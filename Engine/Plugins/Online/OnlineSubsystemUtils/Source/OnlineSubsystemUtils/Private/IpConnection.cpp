@@ -422,6 +422,13 @@ void UIpConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits&
 				NETWORK_PROFILER(GNetworkProfiler.FlushOutgoingBunches(this));
 				NETWORK_PROFILER(GNetworkProfiler.TrackSocketSendTo(Socket->GetDescription(), DataToSend, CountBytes, NumPacketIdBits, NumBunchBits, NumAckBits, NumPaddingBits, this));
 			}
+			else if (QueueSendMulti(DataToSend, CountBytes))
+			{
+				// Send errors for queued packets are routed back through HandleSocketSendResult when the driver flushes
+				UNCLOCK_CYCLES(Driver->SendCycles);
+				NETWORK_PROFILER(GNetworkProfiler.FlushOutgoingBunches(this));
+				NETWORK_PROFILER(GNetworkProfiler.TrackSocketSendTo(Socket->GetDescription(), DataToSend, CountBytes, NumPacketIdBits, NumBunchBits, NumAckBits, NumPaddingBits, this));
+			}
 			else
 			{
 				bool bWasSendSuccessful = false;
@@ -453,6 +460,13 @@ void UIpConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits&
 	}
 }
 
+bool UIpConnection::QueueSendMulti(const uint8* Data, int32 CountBytes)
+{
+	UIpNetDriver* IpDriver = Cast<UIpNetDriver>(Driver);
+
+	return IpDriver != nullptr && IpDriver->QueueSendMulti(this, Socket, Data, CountBytes, *RemoteAddr);
+}
+
 void UIpConnection::ReceivedRawPacket(void* Data, int32 Count)
 {
 	UE_CLOG(SocketError_RecvDelayStartTime > 0.0, LogNet, Log, TEXT("UIpConnection::ReceivedRawPacket: Recoverd from socket errors. %s Connection"), *Describe());
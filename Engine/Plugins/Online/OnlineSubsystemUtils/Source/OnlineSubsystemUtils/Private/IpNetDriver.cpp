@@ -39,6 +39,7 @@ Notes:
 DECLARE_CYCLE_STAT(TEXT("IpNetDriver Add new connection"), Stat_IpNetDriverAddNewConnection, STATGROUP_Net);
 DECLARE_CYCLE_STAT(TEXT("IpNetDriver Socket RecvFrom"), STAT_IpNetDriver_RecvFromSocket, STATGROUP_Net);
 DECLARE_CYCLE_STAT(TEXT("IpNetDriver Destroy WaitForReceiveThread"), STAT_IpNetDriver_Destroy_WaitForReceiveThread, STATGROUP_Net);
+DECLARE_CYCLE_STAT(TEXT("IpNetDriver Socket SendMulti"), STAT_IpNetDriver_SendMultiSocket, STATGROUP_Net);
 
 UIpNetDriver::FOnNetworkProcessingCausingSlowFrame UIpNetDriver::OnNetworkProcessingCausingSlowFrame;
 
@@ -88,6 +89,18 @@ TAutoConsoleVariable<int32> CVarRecvMultiCapacity(
 	TEXT("When RecvMulti is enabled, this is the number of packets it is allocated to handle per call - ")
 		TEXT("bigger is better (especially under a DDoS), but keep an eye on memory cost."));
 
+TAutoConsoleVariable<int32> CVarNetUseSendMulti(
+	TEXT("net.UseSendMulti"),
+	0,
+	TEXT("If true, and if running on a Unix/Linux server, outgoing packets are queued during the frame and sent with one syscall per batch ")
+		TEXT("when the net driver flushes, instead of one syscall per packet."));
+
+TAutoConsoleVariable<int32> CVarSendMultiCapacity(
+	TEXT("net.SendMultiCapacity"),
+	256,
+	TEXT("When SendMulti is enabled, this is the number of packets that can be queued before the queue is flushed early - ")
+		TEXT("bigger means fewer syscalls, but keep an eye on memory cost (each slot holds a full MAX_PACKET_SIZE buffer)."));
+
 TAutoConsoleVariable<int32> CVarNetUseRecvTimestamps(
 	TEXT("net.UseRecvTimestamps"),
 	0,
@@ -725,6 +738,20 @@ private:
 
 		return false;
 	}
+
+	static void HandleSocketSendResult(UIpConnection* Connection, ESocketErrors Error, ISocketSubsystem* SocketSubsystem)
+	{
+		UIpConnection::FSocketSendResult Result;
+
+		Result.Error = Error;
+
+		Connection->HandleSocketSendResult(Result, SocketSubsystem);
+	}
+
+	static bool IsRecoveringFromSocketSendError(const UIpConnection* Connection)
+	{
+		return (Connection->SocketErrorDisconnectDelay > 0.f) && (Connection->SocketError_SendDelayStartTime != 0.f);
+	}
 };
 
 /**
@@ -971,16 +998,26 @@ bool UIpNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const
 	}
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 	
+	bool bRecvMultiEnabled = CVarNetUseRecvMulti.GetValueOnAnyThread() != 0;
+	bool bRecvThreadEnabled = CVarNetIpNetDriverUseReceiveThread.GetValueOnAnyThread() != 0 && SocketSubsystem->IsSocketWaitSupported();
+
+	if (bRecvMultiEnabled && SocketSubsystem->IsSocketRecvMultiSupported() && CVarNetUseRecvTimestamps.GetValueOnAnyThread() != 0)
+	{
+		// Properly set this flag for every socket for each bind address.
+		for (TSharedPtr<FSocket>& SubSocket : BoundSockets)
+		{
+			SubSocket->SetRetrieveTimestamp(true);
+		}
+	}
+
 	// If the cvar is set and the socket subsystem supports it, create the receive thread.
-	if (CVarNetIpNetDriverUseReceiveThread.GetValueOnAnyThread() != 0 && SocketSubsystem->IsSocketWaitSupported())
+	// With RecvMulti also enabled, the receive thread drains the socket in batches and the game thread just consumes its queue.
+	if (bRecvThreadEnabled)
 	{
 		SocketReceiveThreadRunnable = MakeUnique<FReceiveThreadRunnable>(this);
 		SocketReceiveThread.Reset(FRunnableThread::Create(SocketReceiveThreadRunnable.Get(), *FString::Printf(TEXT("IpNetDriver Receive Thread"), *NetDriverName.ToString())));
 	}
 
-	bool bRecvMultiEnabled = CVarNetUseRecvMulti.GetValueOnAnyThread() != 0;
-	bool bRecvThreadEnabled = CVarNetIpNetDriverUseReceiveThread.GetValueOnAnyThread() != 0;
-
 	if (bRecvMultiEnabled && !bRecvThreadEnabled)
 	{
 		bool bSupportsRecvMulti = SocketSubsystem->IsSocketRecvMultiSupported();
@@ -989,15 +1026,6 @@ bool UIpNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const
 		{
 			bool bRetrieveTimestamps = CVarNetUseRecvTimestamps.GetValueOnAnyThread() != 0;
 
-			if (bRetrieveTimestamps)
-			{
-				// Properly set this flag for every socket for each bind address.
-				for (TSharedPtr<FSocket>& SubSocket : BoundSockets)
-				{
-					SubSocket->SetRetrieveTimestamp(true);
-				}
-			}
-
 			ERecvMultiFlags RecvMultiFlags = bRetrieveTimestamps ? ERecvMultiFlags::RetrieveTimestamps : ERecvMultiFlags::None;
 			int32 MaxRecvMultiPackets = FMath::Max(32, CVarRecvMultiCapacity.GetValueOnAnyThread());
 
@@ -1017,7 +1045,30 @@ bool UIpNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const
 	}
 	else if (bRecvMultiEnabled && bRecvThreadEnabled)
 	{
-		UE_LOG(LogNet, Warning, TEXT("NetDriver RecvMulti is not yet supported with the Receive Thread enabled."));
+		UE_LOG(LogNet, Log, TEXT("NetDriver RecvMulti enabled on the Receive Thread: %i"),
+				(uint32)SocketReceiveThreadRunnable->IsUsingRecvMulti());
+	}
+
+	// Clients can swap sockets during address resolution, so batched sends are only used by servers
+	if (CVarNetUseSendMulti.GetValueOnAnyThread() != 0 && !bInitAsClient)
+	{
+		if (SocketSubsystem->IsSocketSendMultiSupported())
+		{
+			int32 MaxSendMultiPackets = FMath::Max(32, CVarSendMultiCapacity.GetValueOnAnyThread());
+
+			SendMultiState = SocketSubsystem->CreateSendMulti(MaxSendMultiPackets, MAX_PACKET_SIZE);
+			SendMultiConnections.Reserve(MaxSendMultiPackets);
+
+			FArchiveCountMem MemArc(nullptr);
+
+			SendMultiState->CountBytes(MemArc);
+
+			UE_LOG(LogNet, Log, TEXT("NetDriver SendMulti state size: %i"), MemArc.GetMax());
+		}
+		else
+		{
+			UE_LOG(LogNet, Warning, TEXT("NetDriver could not enable SendMulti, as current socket subsystem does not support it."));
+		}
 	}
 
 	// Success.
@@ -1626,8 +1677,15 @@ void UIpNetDriver::LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* D
 
 		if (CountBits > 0)
 		{
+			const int32 CountBytes = FMath::DivideAndRoundUp(CountBits, 8);
+
 			CLOCK_CYCLES(SendCycles);
-			GetSocket()->SendTo(DataToSend, FMath::DivideAndRoundUp(CountBits, 8), BytesSent, *Address);
+
+			if (!QueueSendMulti(nullptr, GetSocket(), DataToSend, CountBytes, *Address))
+			{
+				GetSocket()->SendTo(DataToSend, CountBytes, BytesSent, *Address);
+			}
+
 			UNCLOCK_CYCLES(SendCycles);
 		}
 
@@ -1650,8 +1708,100 @@ FString UIpNetDriver::LowLevelGetNetworkNumber()
 	return LocalAddr.IsValid() ? LocalAddr->ToString(true) : FString(TEXT(""));
 }
 
+bool UIpNetDriver::QueueSendMulti(UIpConnection* Connection, FSocket* InSocket, const uint8* Data, int32 CountBytes, const FInternetAddr& Address)
+{
+	if (!SendMultiState.IsValid() || InSocket == nullptr || InSocket != GetSocket())
+	{
+		return false;
+	}
+
+	if (SendMultiState->IsFull())
+	{
+		FlushSendMulti();
+	}
+
+	if (!SendMultiState->AddPacket(Data, CountBytes, Address))
+	{
+		return false;
+	}
+
+	SendMultiConnections.Add(Connection);
+
+	return true;
+}
+
+void UIpNetDriver::FlushSendMulti()
+{
+	if (!SendMultiState.IsValid() || SendMultiState->GetNumPackets() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_SendMultiSocket);
+
+	FSocket* CurSocket = GetSocket();
+	ISocketSubsystem* SocketSubsystem = GetSocketSubsystem();
+	const int32 NumPackets = SendMultiState->GetNumPackets();
+	int32 PacketIdx = 0;
+
+	check(SendMultiConnections.Num() == NumPackets);
+
+	while (CurSocket != nullptr && PacketIdx < NumPackets)
+	{
+		int32 NumPacketsSent = 0;
+		const bool bSendMultiOk = CurSocket->SendMulti(*SendMultiState, PacketIdx, NumPacketsSent);
+
+		for (int32 SentIdx=PacketIdx; SentIdx<PacketIdx+NumPacketsSent; SentIdx++)
+		{
+			UIpConnection* Connection = SendMultiConnections[SentIdx].Get();
+
+			if (Connection != nullptr && FIpConnectionHelper::IsRecoveringFromSocketSendError(Connection))
+			{
+				FIpConnectionHelper::HandleSocketSendResult(Connection, SE_NO_ERROR, nullptr);
+			}
+		}
+
+		PacketIdx += NumPacketsSent;
+
+		if (bSendMultiOk)
+		{
+			break;
+		}
+
+		// The packet at PacketIdx failed - it is dropped, same as a failed SendTo, and its connection gets the error
+		const ESocketErrors SendMultiError = (SocketSubsystem != nullptr ? SocketSubsystem->GetLastErrorCode() : SE_NO_ERROR);
+		UIpConnection* FailedConnection = (PacketIdx < NumPackets ? SendMultiConnections[PacketIdx].Get() : nullptr);
+
+		if (FailedConnection != nullptr && SocketSubsystem != nullptr)
+		{
+			FIpConnectionHelper::HandleSocketSendResult(FailedConnection, SendMultiError, SocketSubsystem);
+		}
+
+		PacketIdx++;
+
+		// The socket send buffer is full, so the remaining packets would fail too
+		if (SendMultiError == SE_EWOULDBLOCK)
+		{
+			break;
+		}
+	}
+
+	SendMultiState->Reset();
+	SendMultiConnections.Reset();
+}
+
+void UIpNetDriver::TickFlush(float DeltaSeconds)
+{
+	Super::TickFlush(DeltaSeconds);
+
+	FlushSendMulti();
+}
+
 void UIpNetDriver::LowLevelDestroy()
 {
+	// Send anything still queued, before the socket goes away
+	FlushSendMulti();
+
 	Super::LowLevelDestroy();
 
 	// Close the socket.
@@ -1797,6 +1947,60 @@ UIpNetDriver::FReceiveThreadRunnable::FReceiveThreadRunnable(UIpNetDriver* InOwn
 	, OwningNetDriver(InOwningNetDriver)
 {
 	SocketSubsystem = OwningNetDriver->GetSocketSubsystem();
+
+	if (CVarNetUseRecvMulti.GetValueOnAnyThread() != 0 && SocketSubsystem != nullptr && SocketSubsystem->IsSocketRecvMultiSupported())
+	{
+		bRetrieveTimestamps = CVarNetUseRecvTimestamps.GetValueOnAnyThread() != 0;
+
+		ERecvMultiFlags RecvMultiFlags = bRetrieveTimestamps ? ERecvMultiFlags::RetrieveTimestamps : ERecvMultiFlags::None;
+		int32 MaxRecvMultiPackets = FMath::Max(32, CVarRecvMultiCapacity.GetValueOnAnyThread());
+
+		RecvMultiState = SocketSubsystem->CreateRecvMulti(MaxRecvMultiPackets, MAX_PACKET_SIZE, RecvMultiFlags);
+	}
+}
+
+bool UIpNetDriver::FReceiveThreadRunnable::DispatchRecvMultiPackets()
+{
+	const int32 NumPackets = RecvMultiState->GetNumPackets();
+	const double ReceiveTime = FPlatformTime::Seconds();
+
+	for (int32 PacketIdx=0; PacketIdx<NumPackets; PacketIdx++)
+	{
+		FReceivedPacketView PacketView;
+
+		RecvMultiState->GetPacket(PacketIdx, PacketView);
+
+		const int32 NumBytes = PacketView.DataView.NumBytes();
+
+		// Don't even queue empty packets, they can be ignored.
+		if (NumBytes == 0)
+		{
+			continue;
+		}
+
+		FReceivedPacket IncomingPacket;
+
+		// The FRecvMulti buffers and addresses are reused by the next RecvMulti call, so the game thread gets its own copy
+		IncomingPacket.PacketBytes.Append(PacketView.DataView.GetData(), NumBytes);
+		IncomingPacket.FromAddress = PacketView.Address->Clone();
+		IncomingPacket.PlatformTimeSeconds = ReceiveTime;
+
+		FPacketTimestamp KernelTimestamp;
+
+		// Prefer the time the kernel received the packet, which also covers time spent buffered in the socket
+		if (bRetrieveTimestamps && RecvMultiState->GetPacketTimestamp(PacketIdx, KernelTimestamp))
+		{
+			IncomingPacket.PlatformTimeSeconds = SocketSubsystem->TranslatePacketTimestamp(KernelTimestamp, ETimestampTranslation::LocalTimestamp);
+		}
+
+		// Add packet to queue. Since ReceiveQueue is a TCircularQueue, if the queue is full, this will simply return false without adding anything.
+		if (!ReceiveQueue.Enqueue(MoveTemp(IncomingPacket)))
+		{
+			return false;
+		}
+	}
+
+	return true;
 }
 
 bool UIpNetDriver::FReceiveThreadRunnable::DispatchPacket(FReceivedPacket&& IncomingPacket, int32 NbBytesRead)
@@ -1842,25 +2046,42 @@ uint32 UIpNetDriver::FReceiveThreadRunnable::Run()
 			bool bOk = false;
 			int32 BytesRead = 0;
 
-			IncomingPacket.FromAddress = SocketSubsystem->CreateInternetAddr();
-
-			IncomingPacket.PacketBytes.AddUninitialized(MAX_PACKET_SIZE);
-
+			if (RecvMultiState.IsValid())
 			{
-				SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_RecvFromSocket);
-				bOk = CurSocket->RecvFrom(IncomingPacket.PacketBytes.GetData(), IncomingPacket.PacketBytes.Num(), BytesRead, *IncomingPacket.FromAddress);
-			}
+				// Drain everything the socket has buffered with one syscall, rather than one wait/receive per packet
+				{
+					SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_RecvFromSocket);
+					bOk = CurSocket->RecvMulti(*RecvMultiState);
+				}
 
-			if (bOk)
-			{
-				// Don't even queue empty packets, they can be ignored.
-				if (BytesRead != 0)
+				if (bOk)
 				{
-					const bool bSuccess = DispatchPacket(MoveTemp(IncomingPacket), BytesRead);
-					bReceiveQueueFull = !bSuccess;
+					bReceiveQueueFull = !DispatchRecvMultiPackets();
 				}
 			}
 			else
+			{
+				IncomingPacket.FromAddress = SocketSubsystem->CreateInternetAddr();
+
+				IncomingPacket.PacketBytes.AddUninitialized(MAX_PACKET_SIZE);
+
+				{
+					SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_RecvFromSocket);
+					bOk = CurSocket->RecvFrom(IncomingPacket.PacketBytes.GetData(), IncomingPacket.PacketBytes.Num(), BytesRead, *IncomingPacket.FromAddress);
+				}
+
+				if (bOk)
+				{
+					// Don't even queue empty packets, they can be ignored.
+					if (BytesRead != 0)
+					{
+						const bool bSuccess = DispatchPacket(MoveTemp(IncomingPacket), BytesRead);
+						bReceiveQueueFull = !bSuccess;
+					}
+				}
+			}
+
+			if (!bOk)
 			{
 				// This relies on the platform's implementation using thread-local storage for the last socket error code.
 				ESocketErrors RecvFromError = SocketSubsystem->GetLastErrorCode();
@@ -0,0 +1,520 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "RemoteShaderControllerModule.h"
+#include "Features/IModularFeatures.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+// Sent by an agent as the first message on every connection. Must match ShaderCompileWorker's RemoteAgent.cpp.
+#define REMOTE_AGENT_HELLO_MAGIC 0x41535255 // 'URSA'
+
+DEFINE_LOG_CATEGORY_STATIC(LogRemoteShaderController, Log, Log);
+
+namespace RemoteShaderControllerVariables
+{
+	int32 Enabled = 0;
+	FAutoConsoleVariableRef CVarRemoteShaderControllerEnabled(
+		TEXT("r.RemoteShaderController.Enabled"),
+		Enabled,
+		TEXT("Enables or disables distributing build tasks to remote ShaderCompileWorker agents.\n")
+		TEXT("0: Local builds only (default).\n")
+		TEXT("1: Distribute builds to the agents listed in r.RemoteShaderController.Agents."),
+		ECVF_ReadOnly); // Must be set on start-up, e.g. via config ini
+
+	FString Agents;
+	FAutoConsoleVariableRef CVarRemoteShaderControllerAgents(
+		TEXT("r.RemoteShaderController.Agents"),
+		Agents,
+		TEXT("Comma separated list of host:port addresses of ShaderCompileWorker agents started with -remoteagent <port>."),
+		ECVF_ReadOnly);
+
+	int32 MaxConnectionsPerAgent = 32;
+	FAutoConsoleVariableRef CVarRemoteShaderControllerMaxConnectionsPerAgent(
+		TEXT("r.RemoteShaderController.MaxConnectionsPerAgent"),
+		MaxConnectionsPerAgent,
+		TEXT("Upper bound on the number of slots used on a single agent, regardless of how many it advertises. (default: 32)."),
+		ECVF_ReadOnly);
+}
+
+namespace RemoteShaderControllerUtils
+{
+	static bool SendMessage(FSocket* Socket, const TArray<uint8>& Payload)
+	{
+		uint32 Length = Payload.Num();
+		int32 BytesSent = 0;
+		if (!Socket->Send(reinterpret_cast<const uint8*>(&Length), sizeof(Length), BytesSent) || BytesSent != sizeof(Length))
+		{
+			return false;
+		}
+
+		for (int32 Offset = 0; Offset < Payload.Num(); Offset += BytesSent)
+		{
+			if (!Socket->Send(Payload.GetData() + Offset, Payload.Num() - Offset, BytesSent) || BytesSent <= 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool ReceiveBytes(FSocket* Socket, uint8* Data, int32 Count)
+	{
+		int32 BytesRead = 0;
+		for (int32 Offset = 0; Offset < Count; Offset += BytesRead)
+		{
+			if (!Socket->Recv(Data + Offset, Count - Offset, BytesRead, ESocketReceiveFlags::WaitAll) || BytesRead <= 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool ReceiveMessage(FSocket* Socket, TArray<uint8>& OutPayload)
+	{
+		uint32 Length = 0;
+		if (!ReceiveBytes(Socket, reinterpret_cast<uint8*>(&Length), sizeof(Length)))
+		{
+			return false;
+		}
+
+		OutPayload.Reset(Length);
+		OutPayload.AddUninitialized(Length);
+		return ReceiveBytes(Socket, OutPayload.GetData(), Length);
+	}
+
+	static void DestroySocket(FSocket*& Socket)
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			Socket = nullptr;
+		}
+	}
+}
+
+FRemoteShaderControllerModule::FRemoteShaderControllerModule()
+	: bSupported(false)
+	, bModuleInitialized(false)
+	, bControllerInitialized(false)
+	, RootWorkingDirectory(FString::Printf(TEXT("%sUnrealRemoteShaderWorkingDir/"), FPlatformProcess::UserTempDir()))
+	, WorkingDirectory(RootWorkingDirectory + FGuid::NewGuid().ToString(EGuidFormats::Digits))
+	, TasksCS(new FCriticalSection)
+	, bShutdown(false)
+	, TasksAvailableEvent(FPlatformProcess::GetSynchEventFromPool(false))
+{}
+
+FRemoteShaderControllerModule::~FRemoteShaderControllerModule()
+{
+	if (TasksAvailableEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(TasksAvailableEvent);
+		TasksAvailableEvent = nullptr;
+	}
+
+	if (TasksCS)
+	{
+		delete TasksCS;
+		TasksCS = nullptr;
+	}
+}
+
+FSocket* FRemoteShaderControllerModule::ConnectToAgent(const FString& AgentAddress, uint32* OutNumSlots)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+	FString Host, Port;
+	if (!SocketSubsystem || !AgentAddress.Split(TEXT(":"), &Host, &Port, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+	{
+		UE_LOG(LogRemoteShaderController, Warning, TEXT("Invalid agent address '%s', expected host:port."), *AgentAddress);
+		return nullptr;
+	}
+
+	FAddressInfoResult AddressInfo = SocketSubsystem->GetAddressInfo(*Host, *Port, EAddressInfoFlags::Default, NAME_None, SOCKTYPE_Streaming);
+	if (AddressInfo.ReturnCode != SE_NO_ERROR || AddressInfo.Results.Num() == 0)
+	{
+		UE_LOG(LogRemoteShaderController, Warning, TEXT("Unable to resolve agent address '%s'."), *AgentAddress);
+		return nullptr;
+	}
+
+	const TSharedRef<FInternetAddr> Address = AddressInfo.Results[0].Address;
+	FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("RemoteShaderController"), Address->GetProtocolType());
+	if (!Socket)
+	{
+		return nullptr;
+	}
+
+	// Task payloads are sent as single large messages, latency matters more than coalescing here.
+	Socket->SetNoDelay(true);
+
+	TArray<uint8> Hello;
+	uint32 Magic = 0;
+	uint32 NumSlots = 0;
+	if (!Socket->Connect(*Address) || !RemoteShaderControllerUtils::ReceiveMessage(Socket, Hello))
+	{
+		RemoteShaderControllerUtils::DestroySocket(Socket);
+		return nullptr;
+	}
+
+	FMemoryReader Reader(Hello);
+	Reader << Magic;
+	Reader << NumSlots;
+	if (Reader.IsError() || Magic != REMOTE_AGENT_HELLO_MAGIC)
+	{
+		UE_LOG(LogRemoteShaderController, Warning, TEXT("Agent '%s' did not respond with a valid handshake."), *AgentAddress);
+		RemoteShaderControllerUtils::DestroySocket(Socket);
+		return nullptr;
+	}
+
+	if (OutNumSlots)
+	{
+		*OutNumSlots = NumSlots;
+	}
+	return Socket;
+}
+
+bool FRemoteShaderControllerModule::IsSupported()
+{
+	if (bControllerInitialized)
+	{
+		return bSupported;
+	}
+
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		return false; // current implementation requires worker threads
+	}
+
+	// Check the command line to see if the controller has been enabled/disabled.
+	// This overrides the value of the console variable.
+	FString AgentsOverride;
+	if (FParse::Value(FCommandLine::Get(), TEXT("remoteshaderagents="), AgentsOverride))
+	{
+		RemoteShaderControllerVariables::Agents = AgentsOverride;
+		RemoteShaderControllerVariables::Enabled = 1;
+	}
+	if (FParse::Param(FCommandLine::Get(), TEXT("noremoteshadercontroller")) ||
+		FParse::Param(FCommandLine::Get(), TEXT("noshaderworker")))
+	{
+		RemoteShaderControllerVariables::Enabled = 0;
+	}
+
+	if (RemoteShaderControllerVariables::Enabled == 1 && AgentAddresses.Num() == 0)
+	{
+		TArray<FString> ConfiguredAgents;
+		RemoteShaderControllerVariables::Agents.ParseIntoArray(ConfiguredAgents, TEXT(","), true);
+
+		// Only keep the agents that are reachable right now, dead entries would otherwise be retried on every task.
+		for (FString& Agent : ConfiguredAgents)
+		{
+			Agent.TrimStartAndEndInline();
+
+			FSocket* Socket = ConnectToAgent(Agent, nullptr);
+			if (Socket)
+			{
+				RemoteShaderControllerUtils::DestroySocket(Socket);
+				AgentAddresses.Add(Agent);
+			}
+			else
+			{
+				UE_LOG(LogRemoteShaderController, Warning, TEXT("Remote shader agent '%s' is not reachable, it will not be used."), *Agent);
+			}
+		}
+
+		if (AgentAddresses.Num() == 0)
+		{
+			UE_LOG(LogRemoteShaderController, Log, TEXT("Cannot use the Remote Shader Controller as no agent is reachable."));
+			RemoteShaderControllerVariables::Enabled = 0;
+		}
+	}
+
+	return (bSupported = (RemoteShaderControllerVariables::Enabled == 1));
+}
+
+void FRemoteShaderControllerModule::CleanWorkingDirectory()
+{
+	// Only clean the directory if we are the only instance running,
+	// and we're not running in multi-process mode.
+	if ((GIsFirstInstance) && !FParse::Param(FCommandLine::Get(), TEXT("Multiprocess")))
+	{
+		UE_LOG(LogRemoteShaderController, Log, TEXT("Cleaning working directory: %s"), *RootWorkingDirectory);
+		IFileManager::Get().DeleteDirectory(*RootWorkingDirectory, false, true);
+	}
+}
+
+void FRemoteShaderControllerModule::StartupModule()
+{
+	check(!bModuleInitialized);
+
+	IModularFeatures::Get().RegisterModularFeature(GetModularFeatureType(), this);
+
+	bModuleInitialized = true;
+}
+
+void FRemoteShaderControllerModule::ShutdownModule()
+{
+	check(bModuleInitialized);
+
+	IModularFeatures::Get().UnregisterModularFeature(GetModularFeatureType(), this);
+
+	if (bControllerInitialized)
+	{
+		bShutdown = true;
+
+		// Closing the sockets unblocks connections that are waiting on an agent.
+		for (FAgentConnection* Connection : Connections)
+		{
+			if (Connection->Socket)
+			{
+				Connection->Socket->Close();
+			}
+		}
+
+		TasksAvailableEvent->Trigger();
+
+		for (FAgentConnection* Connection : Connections)
+		{
+			if (Connection->ThreadFuture.IsValid())
+			{
+				Connection->ThreadFuture.Wait();
+			}
+			RemoteShaderControllerUtils::DestroySocket(Connection->Socket);
+			delete Connection;
+		}
+		Connections.Empty();
+
+		// Cancel any remaining tasks
+		FTask* Task;
+		while (PendingTasks.Dequeue(Task))
+		{
+			FDistributedBuildTaskResult Result;
+			Result.ReturnCode = 0;
+			Result.bCompleted = false;
+			Task->Promise.SetValue(Result);
+			delete Task;
+		}
+	}
+
+	CleanWorkingDirectory();
+	bModuleInitialized = false;
+	bControllerInitialized = false;
+}
+
+void FRemoteShaderControllerModule::InitializeController()
+{
+	if (ensureAlwaysMsgf(!bControllerInitialized, TEXT("Multiple initialization of the Remote Shader controller!")))
+	{
+		CleanWorkingDirectory();
+		bShutdown = false;
+
+		if (IsSupported())
+		{
+			// One connection per advertised slot on every agent. Connections pull tasks independently,
+			// which load balances the pool without the controller having to track agent capacity.
+			for (const FString& AgentAddress : AgentAddresses)
+			{
+				uint32 NumSlots = 0;
+				FSocket* FirstSocket = ConnectToAgent(AgentAddress, &NumSlots);
+				if (!FirstSocket)
+				{
+					continue;
+				}
+
+				NumSlots = FMath::Clamp<uint32>(NumSlots, 1, FMath::Max(RemoteShaderControllerVariables::MaxConnectionsPerAgent, 1));
+				UE_LOG(LogRemoteShaderController, Display, TEXT("Using %u slots on remote shader agent '%s'."), NumSlots, *AgentAddress);
+
+				for (uint32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+				{
+					FAgentConnection* Connection = new FAgentConnection();
+					Connection->AgentAddress = AgentAddress;
+					Connection->Socket = (SlotIndex == 0) ? FirstSocket : ConnectToAgent(AgentAddress, nullptr);
+					if (!Connection->Socket)
+					{
+						delete Connection;
+						break;
+					}
+
+					NumLiveConnections.Increment();
+					Connections.Add(Connection);
+				}
+			}
+
+			for (FAgentConnection* Connection : Connections)
+			{
+				Connection->ThreadFuture = Async(EAsyncExecution::Thread, [this, Connection]() { ConnectionThreadProc(Connection); });
+			}
+
+			bControllerInitialized = true;
+		}
+	}
+}
+
+FTask* FRemoteShaderControllerModule::DequeueTask()
+{
+	FScopeLock Lock(TasksCS);
+
+	FTask* Task = nullptr;
+	PendingTasks.Dequeue(Task);
+	return Task;
+}
+
+void FRemoteShaderControllerModule::ConnectionThreadProc(FAgentConnection* Connection)
+{
+	while (!bShutdown && Connection->Socket)
+	{
+		FTask* Task = DequeueTask();
+		if (!Task)
+		{
+			// Triggers may coalesce when several tasks arrive at once, so poll as well.
+			TasksAvailableEvent->Wait(100);
+			continue;
+		}
+
+		RunTask(Connection, Task);
+	}
+
+	if (NumLiveConnections.Decrement() == 0 && !bShutdown)
+	{
+		// Every agent has gone away, fail whatever is left so the engine compiles it locally.
+		UE_LOG(LogRemoteShaderController, Warning, TEXT("Lost connection to all remote shader agents, remaining tasks will run locally."));
+		FailPendingTasks();
+	}
+}
+
+void FRemoteShaderControllerModule::RunTask(FAgentConnection* Connection, FTask* Task)
+{
+	// The worker arguments are "<WorkingDirectory>/" <ParentPID> <ThreadId> "<InputFile>" "<OutputFile>" <Extra...>.
+	// The agent substitutes its own working directory and PID, so only the extra arguments are forwarded.
+	const TCHAR* ArgsStream = *Task->CommandData.CommandArgs;
+	FString TaskWorkingDirectory, ParentPID, ThreadId, InputFileName, OutputFileName;
+	const bool bParsedArgs =
+		FParse::Token(ArgsStream, TaskWorkingDirectory, false) &&
+		FParse::Token(ArgsStream, ParentPID, false) &&
+		FParse::Token(ArgsStream, ThreadId, false) &&
+		FParse::Token(ArgsStream, InputFileName, false) &&
+		FParse::Token(ArgsStream, OutputFileName, false);
+	FString ExtraArguments(ArgsStream);
+	ExtraArguments.TrimStartInline();
+
+	TArray<uint8> InputData;
+	if (!bParsedArgs || !FFileHelper::LoadFileToArray(InputData, *Task->CommandData.InputFileName))
+	{
+		UE_LOG(LogRemoteShaderController, Error, TEXT("Unable to prepare remote task %u: %s"), Task->ID, *Task->CommandData.CommandArgs);
+		CompleteTask(Task, 1);
+		return;
+	}
+
+	TArray<uint8> Buffer;
+	{
+		FMemoryWriter Writer(Buffer);
+		Writer << Task->ID;
+		Writer << ExtraArguments;
+		Writer << InputData;
+	}
+	InputData.Empty();
+
+	uint32 ResponseID = 0;
+	int32 ReturnCode = 0;
+	TArray<uint8> OutputData;
+
+	bool bSucceeded = RemoteShaderControllerUtils::SendMessage(Connection->Socket, Buffer) && RemoteShaderControllerUtils::ReceiveMessage(Connection->Socket, Buffer);
+	if (bSucceeded)
+	{
+		FMemoryReader Reader(Buffer);
+		Reader << ResponseID;
+		Reader << ReturnCode;
+		Reader << OutputData;
+		bSucceeded = !Reader.IsError() && ResponseID == Task->ID;
+	}
+
+	if (!bSucceeded)
+	{
+		// The connection is in an unknown state, drop it. The task is completed without an output file,
+		// which makes the shader compiler fall back to compiling the batch locally.
+		if (!bShutdown)
+		{
+			UE_LOG(LogRemoteShaderController, Warning, TEXT("Lost connection to remote shader agent '%s'."), *Connection->AgentAddress);
+		}
+		RemoteShaderControllerUtils::DestroySocket(Connection->Socket);
+		CompleteTask(Task, 1);
+		return;
+	}
+
+	if (OutputData.Num() > 0)
+	{
+		FFileHelper::SaveArrayToFile(OutputData, *(TaskWorkingDirectory / OutputFileName));
+	}
+
+	CompleteTask(Task, ReturnCode);
+}
+
+void FRemoteShaderControllerModule::CompleteTask(FTask* Task, int32 ReturnCode)
+{
+	FDistributedBuildTaskResult Result;
+	Result.ReturnCode = ReturnCode;
+	Result.bCompleted = true;
+
+	Task->Promise.SetValue(Result);
+	delete Task;
+}
+
+void FRemoteShaderControllerModule::FailPendingTasks()
+{
+	while (FTask* Task = DequeueTask())
+	{
+		CompleteTask(Task, 1);
+	}
+}
+
+FString FRemoteShaderControllerModule::CreateUniqueFilePath()
+{
+	check(bSupported);
+	return FString::Printf(TEXT("%s/%d.rsc"), *WorkingDirectory, NextFileID.Increment());
+}
+
+TFuture<FDistributedBuildTaskResult> FRemoteShaderControllerModule::EnqueueTask(const FTaskCommandData& CommandData)
+{
+	check(bSupported);
+
+	TPromise<FDistributedBuildTaskResult> Promise;
+	TFuture<FDistributedBuildTaskResult> Future = Promise.GetFuture();
+
+	FTask* Task = new FTask(NextTaskID.Increment(), CommandData, MoveTemp(Promise));
+	if (NumLiveConnections.GetValue() == 0)
+	{
+		CompleteTask(Task, 1);
+		return MoveTemp(Future);
+	}
+
+	{
+		FScopeLock Lock(TasksCS);
+		PendingTasks.Enqueue(Task);
+	}
+
+	TasksAvailableEvent->Trigger();
+
+	// The last connection may have gone away while we were enqueuing.
+	if (NumLiveConnections.GetValue() == 0)
+	{
+		FailPendingTasks();
+	}
+
+	return MoveTemp(Future);
+}
+
+REMOTESHADERCONTROLLER_API FRemoteShaderControllerModule& FRemoteShaderControllerModule::Get()
+{
+	return FModuleManager::LoadModuleChecked<FRemoteShaderControllerModule>(TEXT("RemoteShaderController"));
+}
+
+IMPLEMENT_MODULE(FRemoteShaderControllerModule, RemoteShaderController);
@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "DistributedBuildInterface/Public/DistributedBuildControllerInterface.h"
+#include "Containers/Queue.h"
+
+class FSocket;
+
+/**
+ * Distributes build tasks to a pool of remote ShaderCompileWorker agents (started with -remoteagent <port>) over TCP.
+ * Each agent advertises a number of slots when first connected to, and the controller opens one connection per slot.
+ * Connections pull the next pending task as soon as they are idle, so faster agents naturally take on more work.
+ * Agents are expected to run the same engine build as the controller.
+ */
+class FRemoteShaderControllerModule : public IDistributedBuildController
+{
+	struct FAgentConnection
+	{
+		FString AgentAddress;
+		FSocket* Socket = nullptr;
+		TFuture<void> ThreadFuture;
+	};
+
+	bool bSupported;
+	bool bModuleInitialized;
+	bool bControllerInitialized;
+
+	FThreadSafeCounter NextFileID;
+	FThreadSafeCounter NextTaskID;
+
+	const FString RootWorkingDirectory;
+	const FString WorkingDirectory;
+
+	// Host:port of every agent in the pool, parsed from the config.
+	TArray<FString> AgentAddresses;
+
+	// Taken when accessing the PendingTasks member.
+	FCriticalSection* TasksCS;
+
+	// Queue of tasks submitted by the engine, but not yet picked up by an agent connection.
+	TQueue<FTask*> PendingTasks;
+
+	TArray<FAgentConnection*> Connections;
+	FThreadSafeCounter NumLiveConnections;
+
+	bool bShutdown;
+
+	// Triggered whenever a task is enqueued, to wake up idle connections.
+	FEvent* TasksAvailableEvent;
+
+	FTask* DequeueTask();
+	void ConnectionThreadProc(FAgentConnection* Connection);
+	void RunTask(FAgentConnection* Connection, FTask* Task);
+	void CompleteTask(FTask* Task, int32 ReturnCode);
+	void FailPendingTasks();
+
+	static FSocket* ConnectToAgent(const FString& AgentAddress, uint32* OutNumSlots);
+
+public:
+	FRemoteShaderControllerModule();
+	virtual ~FRemoteShaderControllerModule();
+
+	virtual void StartupModule() override final;
+	virtual void ShutdownModule() override final;
+
+	virtual void InitializeController() override final;
+
+	REMOTESHADERCONTROLLER_API virtual const FString GetName() override final { return FString("Remote Shader Controller"); };
+
+	REMOTESHADERCONTROLLER_API virtual bool IsSupported() override final;
+
+	virtual FString CreateUniqueFilePath() override final;
+	virtual TFuture<FDistributedBuildTaskResult> EnqueueTask(const FTaskCommandData& CommandData) override final;
+
+	REMOTESHADERCONTROLLER_API static FRemoteShaderControllerModule& Get();
+
+	void CleanWorkingDirectory();
+};
@@ -27,6 +27,9 @@ DECLARE_DWORD_COUNTER_STAT(TEXT("Always Tick"), STAT_AnimationBudgetAllocator_Al
 DECLARE_DWORD_COUNTER_STAT(TEXT("Throttled"), STAT_AnimationBudgetAllocator_Throttled, STATGROUP_AnimationBudgetAllocator);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Interpolated"), STAT_AnimationBudgetAllocator_Interpolated, STATGROUP_AnimationBudgetAllocator);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("SmoothedBudgetPressure"), STAT_AnimationBudgetAllocator_SmoothedBudgetPressure, STATGROUP_AnimationBudgetAllocator);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Far LOD"), STAT_AnimationBudgetAllocator_FarLOD, STATGROUP_AnimationBudgetAllocator);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Registered Generic Components"), STAT_AnimationBudgetAllocator_NumRegisteredGenericComponents, STATGROUP_AnimationBudgetAllocator);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Generic Throttled"), STAT_AnimationBudgetAllocator_GenericThrottled, STATGROUP_AnimationBudgetAllocator);
 
 
 CSV_DEFINE_CATEGORY(AnimationBudget, true);
@@ -54,6 +57,7 @@ FAnimBudgetAllocatorComponentData::FAnimBudgetAllocatorComponentData(USkeletalMe
 	, bAutoCalculateSignificance(false)
 	, bOnScreen(false)
 	, bNeverThrottle(true)
+	, bFarLOD(false)
 {}
 
 FAnimationBudgetAllocator::FAnimationBudgetAllocator(UWorld* InWorld)
@@ -155,6 +159,57 @@ void FAnimationBudgetAllocator::TickEnableHelper(USkeletalMeshComponent* InCompo
 	InComponent->PrimaryComponentTick.SetTickFunctionEnable(bInEnable);
 }
 
+bool FAnimationBudgetAllocator::UpdateFarLOD(FAnimBudgetAllocatorComponentData& InComponentData)
+{
+	// Far LOD components are not queued, so keep their significance and throttle up to date here
+	if(InComponentData.bFarLOD)
+	{
+		InComponentData.StateChangeThrottle = InComponentData.StateChangeThrottle < 0 ? InComponentData.StateChangeThrottle : InComponentData.StateChangeThrottle - 1;
+
+		if(InComponentData.bAutoCalculateSignificance)
+		{
+			check(USkeletalMeshComponentBudgeted::OnCalculateSignificance().IsBound());
+
+			InComponentData.Significance = USkeletalMeshComponentBudgeted::OnCalculateSignificance().Execute(InComponentData.Component);
+		}
+	}
+
+	const bool bWantsFarLOD = Parameters.FarLODSignificance > 0.0f
+		&& InComponentData.Significance < Parameters.FarLODSignificance
+		&& !InComponentData.bAlwaysTick
+		&& InComponentData.Component->OnFarLOD().IsBound();
+
+	if(bWantsFarLOD && !InComponentData.bFarLOD)
+	{
+		// Entering far LOD is throttled like other state changes, leaving it happens straight away to avoid visible pops
+		if(InComponentData.StateChangeThrottle < 0)
+		{
+			InComponentData.Component->OnFarLOD().Execute(InComponentData.Component, true);
+			InComponentData.bFarLOD = true;
+			InComponentData.StateChangeThrottle = Parameters.StateChangeThrottleInFrames;
+		}
+	}
+	else if(!bWantsFarLOD && InComponentData.bFarLOD)
+	{
+		ExitFarLOD(InComponentData);
+		InComponentData.StateChangeThrottle = Parameters.StateChangeThrottleInFrames;
+	}
+
+	return InComponentData.bFarLOD;
+}
+
+void FAnimationBudgetAllocator::ExitFarLOD(FAnimBudgetAllocatorComponentData& InComponentData)
+{
+	if(InComponentData.bFarLOD)
+	{
+		if(InComponentData.Component != nullptr && InComponentData.Component->OnFarLOD().IsBound())
+		{
+			InComponentData.Component->OnFarLOD().Execute(InComponentData.Component, false);
+		}
+		InComponentData.bFarLOD = false;
+	}
+}
+
 void FAnimationBudgetAllocator::QueueSortedComponentIndices(float InDeltaSeconds)
 {
 	const float WorldTime = World->TimeSeconds - 1.0f;
@@ -211,12 +266,19 @@ void FAnimationBudgetAllocator::QueueSortedComponentIndices(float InDeltaSeconds
 
 	uint8 MaxComponentTickFunctionIndex = 0;
 	int32 ComponentIndex = 0;
+	int32 NumFarLODComponents = 0;
 	for (FAnimBudgetAllocatorComponentData& ComponentData : AllComponentData)
 	{
 		if(ComponentData.bTickEnabled)
 		{
 			USkeletalMeshComponentBudgeted* Component = ComponentData.Component;
-			if (Component && Component->IsRegistered())
+			if (Component && Component->IsRegistered() && UpdateFarLOD(ComponentData))
+			{
+				// The far LOD representation is animated without the component, so skip all of its work
+				DisableComponentTick(ComponentData);
+				NumFarLODComponents++;
+			}
+			else if (Component && Component->IsRegistered())
 			{
 				auto ShouldComponentTick = [WorldTime](const USkeletalMeshComponentBudgeted* InComponent, const FAnimBudgetAllocatorComponentData& InComponentData)
 				{
@@ -285,6 +347,8 @@ void FAnimationBudgetAllocator::QueueSortedComponentIndices(float InDeltaSeconds
 		return ComponentData0.Significance > ComponentData1.Significance;
 	};
 
+	SET_DWORD_STAT(STAT_AnimationBudgetAllocator_FarLOD, NumFarLODComponents);
+
 	AllSortedComponentData.Sort(SignificanceSortPredicate);
 	ReducedWorkComponentData.Sort(SignificanceSortPredicate);
 	NonRenderedComponentData.Sort(SignificanceSortPredicate);
@@ -651,6 +715,91 @@ int32 FAnimationBudgetAllocator::CalculateWorkDistributionAndQueue(float InDelta
 	return NumTicked;
 }
 
+void FAnimationBudgetAllocator::UpdateGenericComponents(float InDeltaSeconds)
+{
+	SortedGenericComponentData.Reset();
+
+	for(int32 GenericIndex = 0; GenericIndex < AllGenericComponentData.Num(); ++GenericIndex)
+	{
+		FAnimBudgetAllocatorGenericComponentData& GenericData = AllGenericComponentData[GenericIndex];
+		if(GenericData.Component != nullptr && GenericData.Component->IsRegistered() && GenericData.Component->IsComponentTickEnabled())
+		{
+			GenericData.StateChangeThrottle = GenericData.StateChangeThrottle < 0 ? GenericData.StateChangeThrottle : GenericData.StateChangeThrottle - 1;
+			SortedGenericComponentData.Add(GenericIndex);
+		}
+	}
+
+	if(SortedGenericComponentData.Num() == 0)
+	{
+		SET_DWORD_STAT(STAT_AnimationBudgetAllocator_GenericThrottled, 0);
+		return;
+	}
+
+	// Sort 'always tick' components first, then by significance, largest first
+	SortedGenericComponentData.Sort([this](int32 InIndex0, int32 InIndex1)
+	{
+		const FAnimBudgetAllocatorGenericComponentData& GenericData0 = AllGenericComponentData[InIndex0];
+		const FAnimBudgetAllocatorGenericComponentData& GenericData1 = AllGenericComponentData[InIndex1];
+		if(GenericData0.bAlwaysTick != GenericData1.bAlwaysTick)
+		{
+			return GenericData0.bAlwaysTick > GenericData1.bAlwaysTick;
+		}
+		return GenericData0.Significance > GenericData1.Significance;
+	});
+
+	// Tick the most significant components every frame until their estimated cost uses up the budget
+	const bool bBudgetEnabled = Parameters.GenericComponentBudgetInMs > 0.0f;
+	float RemainingBudgetMs = Parameters.GenericComponentBudgetInMs;
+	int32 FullIndexEnd = 0;
+	for(; FullIndexEnd < SortedGenericComponentData.Num(); ++FullIndexEnd)
+	{
+		const FAnimBudgetAllocatorGenericComponentData& GenericData = AllGenericComponentData[SortedGenericComponentData[FullIndexEnd]];
+		if(bBudgetEnabled && !GenericData.bAlwaysTick && GenericData.EstimatedTickTimeMs > RemainingBudgetMs)
+		{
+			break;
+		}
+		RemainingBudgetMs -= GenericData.EstimatedTickTimeMs;
+	}
+
+	// Throttle the rest with the same linear ramp as skeletal mesh components: the midpoint rate is the ratio of remaining
+	// work to remaining budget, less significant components get a higher tick rate
+	float ThrottledTimeMs = 0.0f;
+	for(int32 SortedIndex = FullIndexEnd; SortedIndex < SortedGenericComponentData.Num(); ++SortedIndex)
+	{
+		ThrottledTimeMs += AllGenericComponentData[SortedGenericComponentData[SortedIndex]].EstimatedTickTimeMs;
+	}
+
+	const int32 NumThrottled = SortedGenericComponentData.Num() - FullIndexEnd;
+	const float ThrottleRateDenominator = FMath::Max(RemainingBudgetMs, KINDA_SMALL_NUMBER);
+	const float MaxThrottleRate = FMath::Min(FMath::CeilToFloat(FMath::Max(1.0f, ThrottledTimeMs / ThrottleRateDenominator) * 2.0f), (float)Parameters.GenericComponentMaxTickRate);
+	const float ThrottleDenominator = NumThrottled > 0 ? (float)NumThrottled : 1.0f;
+
+	SET_DWORD_STAT(STAT_AnimationBudgetAllocator_GenericThrottled, NumThrottled);
+
+	for(int32 SortedIndex = 0; SortedIndex < SortedGenericComponentData.Num(); ++SortedIndex)
+	{
+		FAnimBudgetAllocatorGenericComponentData& GenericData = AllGenericComponentData[SortedGenericComponentData[SortedIndex]];
+
+		uint8 DesiredTickRate = 1;
+		if(SortedIndex >= FullIndexEnd)
+		{
+			const float Alpha = ((float)(SortedIndex - FullIndexEnd) / ThrottleDenominator);
+			DesiredTickRate = (uint8)FMath::Clamp((int32)FMath::FloorToFloat(FMath::Lerp(2.0f, MaxThrottleRate, Alpha) + 0.5f), 1, Parameters.GenericComponentMaxTickRate);
+		}
+
+		// Speeding up happens straight away, slowing down is throttled to avoid noise in the budget causing constant changes
+		if(DesiredTickRate < GenericData.TickRate || (DesiredTickRate > GenericData.TickRate && GenericData.StateChangeThrottle < 0))
+		{
+			GenericData.TickRate = DesiredTickRate;
+			GenericData.StateChangeThrottle = Parameters.StateChangeThrottleInFrames;
+
+			// Throttle via the tick interval so the tick manager accumulates the delta time of skipped frames for us
+			const float TickInterval = GenericData.TickRate > 1 ? FMath::Max(GenericData.OriginalTickInterval, ((float)GenericData.TickRate - 0.5f) * InDeltaSeconds) : GenericData.OriginalTickInterval;
+			GenericData.Component->SetComponentTickInterval(TickInterval);
+		}
+	}
+}
+
 void FAnimationBudgetAllocator::OnWorldPreActorTick(UWorld* InWorld, ELevelTick InLevelTick, float InDeltaSeconds)
 {
 	if(World == InWorld && InLevelTick == LEVELTICK_All)
@@ -684,9 +833,12 @@ void FAnimationBudgetAllocator::Update(float DeltaSeconds)
 		float AverageTickRate = 0.0f;
 		const int32 NumTicked = CalculateWorkDistributionAndQueue(DeltaSeconds, AverageTickRate);
 
+		UpdateGenericComponents(DeltaSeconds);
+
 		// Update stats			
 		SET_DWORD_STAT(STAT_AnimationBudgetAllocator_NumTickedComponents, NumTicked);
 		SET_DWORD_STAT(STAT_AnimationBudgetAllocator_NumRegisteredComponents, AllComponentData.Num());
+		SET_DWORD_STAT(STAT_AnimationBudgetAllocator_NumRegisteredGenericComponents, AllGenericComponentData.Num());
 		BUDGET_CSV_STAT(AnimationBudget, NumTicked, NumTicked, ECsvCustomStatOp::Set);
 		BUDGET_CSV_STAT(AnimationBudget, AnimQuality, AllSortedComponentData.Num() > 0 ? (float)NumTicked / (float)AllSortedComponentData.Num() : 0.0f, ECsvCustomStatOp::Set);
 		BUDGET_CSV_STAT(AnimationBudget, AverageTickRate, AverageTickRate, ECsvCustomStatOp::Set);
@@ -849,6 +1001,8 @@ void FAnimationBudgetAllocator::RemoveHelper(int32 Index)
 {
 	if(AllComponentData.IsValidIndex(Index))
 	{
+		ExitFarLOD(AllComponentData[Index]);
+
 		if(AllComponentData[Index].Component != nullptr)
 		{
 			AllComponentData[Index].Component->SetAnimationBudgetHandle(INDEX_NONE);
@@ -868,6 +1022,22 @@ void FAnimationBudgetAllocator::RemoveHelper(int32 Index)
 	}
 }
 
+void FAnimationBudgetAllocator::RemoveGenericHelper(int32 Index)
+{
+	if(AllGenericComponentData.IsValidIndex(Index))
+	{
+		GenericComponentHandles.Remove(AllGenericComponentData[Index].Component);
+
+		AllGenericComponentData.RemoveAtSwap(Index, 1, false);
+
+		// Update handle of swapped component
+		if(Index != AllGenericComponentData.Num() && AllGenericComponentData[Index].Component != nullptr)
+		{
+			GenericComponentHandles.Add(AllGenericComponentData[Index].Component, Index);
+		}
+	}
+}
+
 static USkeletalMeshComponentBudgeted* FindRootPrerequisiteRecursive(USkeletalMeshComponentBudgeted* InComponent, TArray<USkeletalMeshComponentBudgeted*>& InVisitedComponents)
 {
 	InVisitedComponents.Add(InComponent);
@@ -940,6 +1110,43 @@ void FAnimationBudgetAllocator::UnregisterComponent(USkeletalMeshComponentBudget
 	}
 }
 
+void FAnimationBudgetAllocator::RegisterGenericComponent(UActorComponent* InComponent, float InEstimatedTickTimeMs)
+{
+	if (FAnimationBudgetAllocator::bCachedEnabled && bEnabled)
+	{
+		// Budgeted skeletal meshes have their own, more detailed, scheduling
+		if (InComponent != nullptr && ensure(!InComponent->IsA<USkeletalMeshComponentBudgeted>()) && !GenericComponentHandles.Contains(InComponent))
+		{
+			GenericComponentHandles.Add(InComponent, AllGenericComponentData.Num());
+			AllGenericComponentData.Emplace(InComponent, FMath::Max(InEstimatedTickTimeMs, KINDA_SMALL_NUMBER), InComponent->GetComponentTickInterval());
+		}
+	}
+}
+
+void FAnimationBudgetAllocator::UnregisterGenericComponent(UActorComponent* InComponent)
+{
+	// Not gated on the enabled flag so that components always get their tick interval back
+	if (const int32* ManagerHandle = GenericComponentHandles.Find(InComponent))
+	{
+		const int32 Index = *ManagerHandle;
+		InComponent->SetComponentTickInterval(AllGenericComponentData[Index].OriginalTickInterval);
+		RemoveGenericHelper(Index);
+	}
+}
+
+void FAnimationBudgetAllocator::SetGenericComponentSignificance(UActorComponent* InComponent, float Significance, bool bNeverSkip)
+{
+	if (FAnimationBudgetAllocator::bCachedEnabled && bEnabled)
+	{
+		if (const int32* ManagerHandle = GenericComponentHandles.Find(InComponent))
+		{
+			FAnimBudgetAllocatorGenericComponentData& GenericData = AllGenericComponentData[*ManagerHandle];
+			GenericData.Significance = Significance;
+			GenericData.bAlwaysTick = bNeverSkip;
+		}
+	}
+}
+
 void FAnimationBudgetAllocator::UpdateComponentTickPrerequsites(USkeletalMeshComponentBudgeted* InComponent)
 {
 	if (FAnimationBudgetAllocator::bCachedEnabled && bEnabled)
@@ -963,6 +1170,11 @@ void FAnimationBudgetAllocator::AddReferencedObjects(FReferenceCollector& Collec
 		Collector.AddReferencedObject(ComponentData.Component);
 		Collector.AddReferencedObject(ComponentData.RootPrerequisite);
 	}
+
+	for (FAnimBudgetAllocatorGenericComponentData& GenericData : AllGenericComponentData)
+	{
+		Collector.AddReferencedObject(GenericData.Component);
+	}
 }
 
 void FAnimationBudgetAllocator::HandlePostGarbageCollect()
@@ -983,6 +1195,26 @@ void FAnimationBudgetAllocator::HandlePostGarbageCollect()
 		}
 	}
 	while(bRemoved);
+
+	// Remove dead generic components. The handle map still has stale keys for them, so rebuild it.
+	bool bRemovedGeneric = false;
+	for(int32 DataIndex = AllGenericComponentData.Num() - 1; DataIndex >= 0; --DataIndex)
+	{
+		if(AllGenericComponentData[DataIndex].Component == nullptr)
+		{
+			AllGenericComponentData.RemoveAtSwap(DataIndex, 1, false);
+			bRemovedGeneric = true;
+		}
+	}
+
+	if(bRemovedGeneric)
+	{
+		GenericComponentHandles.Reset();
+		for(int32 DataIndex = 0; DataIndex < AllGenericComponentData.Num(); ++DataIndex)
+		{
+			GenericComponentHandles.Add(AllGenericComponentData[DataIndex].Component, DataIndex);
+		}
+	}
 }
 
 void FAnimationBudgetAllocator::SetGameThreadLastTickTimeMs(int32 InManagerHandle, float InGameThreadLastTickTimeMs)
@@ -1032,6 +1264,8 @@ void FAnimationBudgetAllocator::SetEnabled(bool bInEnabled)
 		for(int32 DataIndex = 0; DataIndex < AllComponentData.Num(); ++DataIndex)
 		{
 			FAnimBudgetAllocatorComponentData& ComponentData = AllComponentData[DataIndex];
+			ExitFarLOD(ComponentData);
+
 			if(ComponentData.Component != nullptr)
 			{
 				ComponentData.Component->SetAnimationBudgetHandle(INDEX_NONE);
@@ -1045,6 +1279,17 @@ void FAnimationBudgetAllocator::SetEnabled(bool bInEnabled)
 		}
 
 		AllComponentData.Reset();
+
+		for(FAnimBudgetAllocatorGenericComponentData& GenericData : AllGenericComponentData)
+		{
+			if(GenericData.Component != nullptr)
+			{
+				GenericData.Component->SetComponentTickInterval(GenericData.OriginalTickInterval);
+			}
+		}
+
+		AllGenericComponentData.Reset();
+		GenericComponentHandles.Reset();
 	}
 }
 
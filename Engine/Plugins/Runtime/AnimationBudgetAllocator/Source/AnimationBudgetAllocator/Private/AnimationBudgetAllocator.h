@@ -28,6 +28,7 @@ DECLARE_STATS_GROUP(TEXT("Animation Budget Allocator"), STATGROUP_AnimationBudge
 #endif
 
 class FAnimationBudgetAllocator;
+class UActorComponent;
 class USkeletalMeshComponentBudgeted;
 class SAnimationBudgetAllocatorDebug;
 class UGameViewportClient;
@@ -59,6 +60,7 @@ struct FAnimBudgetAllocatorComponentData
 		, bAutoCalculateSignificance(false)
 		, bOnScreen(false)
 		, bNeverThrottle(true)
+		, bFarLOD(false)
 	{}
 
 	FAnimBudgetAllocatorComponentData(USkeletalMeshComponentBudgeted* InComponent, float InGameThreadLastTickTimeMs, int32 InStateChangeThrottle);
@@ -128,6 +130,45 @@ public:
 
 	/** Whether we are allowing interpolation on this component (i.e. we dont just reduce tick rate). This is intended to allow higher-quality animation. */
 	uint8 bNeverThrottle : 1;
+
+	/** Whether this component is currently switched to its far LOD representation and not ticked */
+	uint8 bFarLOD : 1;
+};
+
+/** Data for a single generic (non-skeletal mesh) component */
+struct FAnimBudgetAllocatorGenericComponentData
+{
+	FAnimBudgetAllocatorGenericComponentData(UActorComponent* InComponent, float InEstimatedTickTimeMs, float InOriginalTickInterval)
+		: Component(InComponent)
+		, Significance(1.0f)
+		, EstimatedTickTimeMs(InEstimatedTickTimeMs)
+		, OriginalTickInterval(InOriginalTickInterval)
+		, TickRate(1)
+		, StateChangeThrottle(0)
+		, bAlwaysTick(false)
+	{}
+
+public:
+	/** The component that we are tracking */
+	UActorComponent* Component;
+
+	/** Significance of this component */
+	float Significance;
+
+	/** The expected time in MS a single tick of this component takes */
+	float EstimatedTickTimeMs;
+
+	/** The tick interval the component had when it was registered, restored when unregistered */
+	float OriginalTickInterval;
+
+	/** The tick rate (in frames) we are using for this component */
+	uint8 TickRate;
+
+	/** Counter used to prevent state changes from happening too often */
+	int8 StateChangeThrottle;
+
+	/** Whether we should never skip the tick of this component */
+	uint8 bAlwaysTick : 1;
 };
 
 class ANIMATIONBUDGETALLOCATOR_API FAnimationBudgetAllocator : public IAnimationBudgetAllocator, public FGCObject
@@ -146,6 +187,9 @@ public:
 	virtual void SetGameThreadLastTickTimeMs(int32 InManagerHandle, float InGameThreadLastTickTimeMs) override;
 	virtual void SetGameThreadLastCompletionTimeMs(int32 InManagerHandle, float InGameThreadLastCompletionTimeMs) override;
 	virtual void SetIsRunningReducedWork(USkeletalMeshComponentBudgeted* Component, bool bInReducedWork) override;
+	virtual void RegisterGenericComponent(UActorComponent* InComponent, float InEstimatedTickTimeMs = 0.02f) override;
+	virtual void UnregisterGenericComponent(UActorComponent* InComponent) override;
+	virtual void SetGenericComponentSignificance(UActorComponent* InComponent, float Significance, bool bNeverSkip = false) override;
 	virtual void Update(float DeltaSeconds) override;
 	virtual void SetEnabled(bool bInEnabled) override;
 	virtual bool GetEnabled() const override;
@@ -170,9 +214,21 @@ protected:
 	 */
 	int32 CalculateWorkDistributionAndQueue(float InDeltaSeconds, float& OutAverageTickRate);
 
+	/** Distributes the generic component budget by significance and sets the tick interval of each generic component */
+	void UpdateGenericComponents(float InDeltaSeconds);
+
 	/** Helper function for keeping handle indices in sync */
 	void RemoveHelper(int32 Index);
 
+	/** Helper function for keeping generic component handles in sync */
+	void RemoveGenericHelper(int32 Index);
+
+	/** Switches a component to/from far LOD depending on its significance. Returns whether the component is in far LOD. */
+	bool UpdateFarLOD(FAnimBudgetAllocatorComponentData& InComponentData);
+
+	/** Switches a component back from far LOD, e.g. when it stops being tracked */
+	void ExitFarLOD(FAnimBudgetAllocatorComponentData& InComponentData);
+
 	/** Helper function to enable/disable ticks */
 	void TickEnableHelper(USkeletalMeshComponent* InComponent, bool bInEnable);
 
@@ -214,6 +270,15 @@ protected:
 	/** All non-rendered components we might tick */
 	TArray<int32> NonRenderedComponentData;
 
+	/** All generic component data */
+	TArray<FAnimBudgetAllocatorGenericComponentData> AllGenericComponentData;
+
+	/** Map of generic component to its index in AllGenericComponentData, as we cannot store a handle on arbitrary components */
+	TMap<UActorComponent*, int32> GenericComponentHandles;
+
+	/** Generic component indices sorted by significance, updated each tick */
+	TArray<int32> SortedGenericComponentData;
+
 #if ENABLE_DRAW_DEBUG
 	/** Recorded debug times */
 	TArray<FVector2D> DebugTimes;
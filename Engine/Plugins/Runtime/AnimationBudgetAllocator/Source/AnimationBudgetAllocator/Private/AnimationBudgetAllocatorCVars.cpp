@@ -331,4 +331,41 @@ static FAutoConsoleVariableRef CVarSkelBatch_BudgetPressureBeforeEmergencyReduce
 		GBudgetParameters.BudgetPressureBeforeEmergencyReducedWork = FMath::Max(GBudgetParameters.BudgetPressureBeforeEmergencyReducedWork, 0.0f);
 		GOnCVarParametersChanged.Broadcast();
 	}),
-	ECVF_Scalability);
\ No newline at end of file
+	ECVF_Scalability);
+
+static FAutoConsoleVariableRef CVarSkelBatch_FarLODSignificance(
+	TEXT("a.Budget.FarLODSignificance"),
+	GBudgetParameters.FarLODSignificance,
+	TEXT("Range >= 0.0, Default = 0.0\n")
+	TEXT("Components with a significance below this value are switched to their far LOD representation (see USkeletalMeshComponentBudgeted::OnFarLOD) and stop ticking.\n")
+	TEXT("0.0 disables far LOD.\n"),
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* InVariable)
+	{
+		GBudgetParameters.FarLODSignificance = FMath::Max(GBudgetParameters.FarLODSignificance, 0.0f);
+		GOnCVarParametersChanged.Broadcast();
+	}),
+	ECVF_Scalability);
+static FAutoConsoleVariableRef CVarSkelBatch_GenericComponentBudget(
+	TEXT("a.Budget.GenericComponentBudgetMs"),
+	GBudgetParameters.GenericComponentBudgetInMs,
+	TEXT("Values >= 0.0, Default = 0.5\n")
+	TEXT("The time in milliseconds that we allocate for generic (non-skeletal mesh) components registered with the budget allocator.\n")
+	TEXT("0.0 means generic components are always ticked at their original rate.\n"),
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* InVariable)
+	{
+		GBudgetParameters.GenericComponentBudgetInMs = FMath::Max(GBudgetParameters.GenericComponentBudgetInMs, 0.0f);
+		GOnCVarParametersChanged.Broadcast();
+	}),
+	ECVF_Scalability);
+
+static FAutoConsoleVariableRef CVarSkelBatch_GenericComponentMaxTickRate(
+	TEXT("a.Budget.GenericComponentMaxTickRate"),
+	GBudgetParameters.GenericComponentMaxTickRate,
+	TEXT("Values >= 1, Default = 4\n")
+	TEXT("The maximum tick rate (in frames) we allow for generic components registered with the budget allocator.\n"),
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* InVariable)
+	{
+		GBudgetParameters.GenericComponentMaxTickRate = FMath::Clamp(GBudgetParameters.GenericComponentMaxTickRate, 1, 255);
+		GOnCVarParametersChanged.Broadcast();
+	}),
+	ECVF_Scalability);
@@ -155,4 +155,27 @@ struct FAnimationBudgetAllocatorParameters
 	 */
 	UPROPERTY(BlueprintReadWrite, Category = "Parameters")
 	float BudgetPressureBeforeEmergencyReducedWork = 2.5f;
+
+	/**
+	 * Range >= 0.0.
+	 * Components with a significance below this value are switched to their far LOD representation and stop ticking entirely.
+	 * Only applies to components that bind OnFarLOD and are not set to 'always tick'. 0.0 disables far LOD.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Parameters")
+	float FarLODSignificance = 0.0f;
+
+	/**
+	 * Values >= 0.0.
+	 * The time in milliseconds that we allocate for generic (non-skeletal mesh) component ticks registered via RegisterGenericComponent.
+	 * This budget is separate from BudgetInMs. 0.0 means generic components are always ticked at their original rate.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Parameters")
+	float GenericComponentBudgetInMs = 0.5f;
+
+	/**
+	 * Values >= 1.
+	 * The maximum tick rate (in frames) we allow for generic components.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Parameters")
+	int32 GenericComponentMaxTickRate = 4;
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #pragma once
 
+class UActorComponent;
 class USkeletalMeshComponentBudgeted;
 class UWorld;
 struct FAnimationBudgetAllocatorParameters;
@@ -59,6 +60,24 @@ public:
 	/** Set the completion task time */
 	virtual void SetGameThreadLastCompletionTimeMs(int32 InManagerHandle, float InGameThreadLastCompletionTimeMs) = 0;
 
+	/**
+	 * Register an arbitrary component (e.g. movement, AI, audio) whose primary tick should be throttled by significance.
+	 * Generic components share their own time budget (see FAnimationBudgetAllocatorParameters::GenericComponentBudgetInMs)
+	 * and are throttled by raising their tick interval, so their TickComponent receives the full elapsed time.
+	 * If the component is already registered this function does nothing.
+	 * @param	InEstimatedTickTimeMs	The expected cost of a single tick of this component, used to fit ticks into the budget
+	 */
+	virtual void RegisterGenericComponent(UActorComponent* InComponent, float InEstimatedTickTimeMs = 0.02f) = 0;
+
+	/** Unregister a generic component, restoring its original tick interval. If the component is not registered this function does nothing. */
+	virtual void UnregisterGenericComponent(UActorComponent* InComponent) = 0;
+
+	/**
+	 * Set the significance of the specified generic component, e.g. from a USignificanceManager significance function.
+	 * Generic components are sorted by significance and the most significant are ticked every frame.
+	 */
+	virtual void SetGenericComponentSignificance(UActorComponent* InComponent, float Significance, bool bNeverSkip = false) = 0;
+
 	/** Tick the system per-frame */
 	virtual void Update(float DeltaSeconds) = 0;
 
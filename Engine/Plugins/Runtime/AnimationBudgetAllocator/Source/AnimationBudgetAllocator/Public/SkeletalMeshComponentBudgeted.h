@@ -11,6 +11,12 @@ class USkeletalMeshComponentBudgeted;
 /** Delegate called to increase/decrease the amount of work a component performs */
 DECLARE_DELEGATE_TwoParams(FOnReduceWork, USkeletalMeshComponentBudgeted* /*InComponent*/, bool /*bReduce*/);
 
+/**
+ * Delegate called to switch a component to/from its far LOD representation, e.g. an instanced static mesh sampling baked
+ * vertex animation textures. The budget allocator does not tick components while they are in far LOD.
+ */
+DECLARE_DELEGATE_TwoParams(FOnFarLOD, USkeletalMeshComponentBudgeted* /*InComponent*/, bool /*bFarLOD*/);
+
 /** Delegate called to calculate significance if bAutoCalculateSignificance = true */
 DECLARE_DELEGATE_RetVal_OneParam(float, FOnCalculateSignificance, USkeletalMeshComponentBudgeted* /*InComponent*/);
 
@@ -44,6 +50,9 @@ public:
 	/** Get delegate called to increase/decrease the amount of work a component performs */
 	FOnReduceWork& OnReduceWork() { return OnReduceWorkDelegate; }
 
+	/** Get delegate called to switch this component to/from its far LOD representation */
+	FOnFarLOD& OnFarLOD() { return OnFarLODDelegate; }
+
 	/** Get delegate called to calculate significance if bAutoCalculateSignificance = true */
 	static FOnCalculateSignificance& OnCalculateSignificance() { return OnCalculateSignificanceDelegate; }
 
@@ -76,6 +85,9 @@ private:
 	/** Delegate called to increase/decrease the amount of work a component performs */
 	FOnReduceWork OnReduceWorkDelegate;
 
+	/** Delegate called to switch this component to/from its far LOD representation */
+	FOnFarLOD OnFarLODDelegate;
+
 	/** Delegate called to calculate significance if bAutoCalculateSignificance = true */
 	static FOnCalculateSignificance OnCalculateSignificanceDelegate;
 
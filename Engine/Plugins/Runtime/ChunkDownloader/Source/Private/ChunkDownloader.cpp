@@ -418,6 +418,11 @@ void FChunkDownloader::Initialize(const FString& InPlatformName, int32 TargetDow
 	TargetDownloadsInFlight = TargetDownloadsInFlightIn;
 	check(TargetDownloadsInFlight >= 1);
 
+	// read how pak file downloads are split into parallel range requests
+	GConfig->GetInt(TEXT("/Script/Plugins.ChunkDownloader"), TEXT("RangeRequestsPerDownload"), RangeRequestsPerDownload, GGameIni);
+	GConfig->GetInt(TEXT("/Script/Plugins.ChunkDownloader"), TEXT("MinRangeRequestSizeKB"), MinRangeRequestSizeKB, GGameIni);
+	RangeRequestsPerDownload = FMath::Max(RangeRequestsPerDownload, 1);
+
 	// figure out our base dirs
 	CacheFolder = FPaths::ProjectPersistentDownloadDir() / TEXT("PakCache/");
 	EmbeddedFolder = FPaths::ProjectContentDir() / TEXT("EmbeddedPaks/");
@@ -1265,6 +1270,19 @@ void FChunkDownloader::LoadManifest(const TArray<FPakFileEntry>& ManifestPakFile
 	TMap<int32,TSharedRef<FChunk>> OldChunks = MoveTemp(Chunks);
 	TMap<FString,TSharedRef<FPakFile>> OldPakFiles = MoveTemp(PakFiles);
 
+	// index fully cached pak files by content hash, so renamed but otherwise unchanged paks don't have to be downloaded again
+	// (only SHA1 versions identify content, other version strings are just unique per file name)
+	TMap<FString,FString> CachedPaksByHash;
+	for (const auto& It : OldPakFiles)
+	{
+		const TSharedRef<FPakFile>& File = It.Value;
+		if (File->bIsCached && !File->bIsMounted && !File->bIsEmbedded && !File->Download.IsValid() && File->Entry.FileVersion.StartsWith(TEXT("SHA1:")))
+		{
+			CachedPaksByHash.Add(File->Entry.FileVersion, It.Key);
+		}
+	}
+	IFileManager& FileManager = IFileManager::Get();
+
 	// loop over the new chunks
 	int32 NumChunks = 0, NumPaks = 0;
 	for (const auto& It : Manifest)
@@ -1324,6 +1342,34 @@ void FChunkDownloader::LoadManifest(const TArray<FPakFileEntry>& ManifestPakFile
 				}
 			}
 
+			// see if we have the same content cached under a different name
+			if (ExistingFilePtr == nullptr)
+			{
+				// the cached file may have been claimed by its own entry in the new manifest already
+				const FString* CachedFileName = CachedPaksByHash.Find(FileEntry.FileVersion);
+				const TSharedRef<FPakFile>* CachedFilePtr = CachedFileName != nullptr ? OldPakFiles.Find(*CachedFileName) : nullptr;
+				if (CachedFilePtr != nullptr)
+				{
+					TSharedRef<FPakFile> CachedFile = *CachedFilePtr;
+					const FString OldPathOnDisk = CacheFolder / CachedFile->Entry.FileName;
+					const FString NewPathOnDisk = CacheFolder / FileEntry.FileName;
+					if (CachedFile->Entry.FileSize == FileEntry.FileSize && !FileManager.FileExists(*NewPathOnDisk) && FileManager.Move(*NewPathOnDisk, *OldPathOnDisk))
+					{
+						UE_LOG(LogChunkDownloader, Log, TEXT("Reusing cached pak file %s as %s (same content)."), *CachedFile->Entry.FileName, *FileEntry.FileName);
+						bNeedsManifestSave = true;
+
+						// remove from old pak files list (the file on disk has moved, so it must not be deleted as an orphan)
+						OldPakFiles.Remove(CachedFile->Entry.FileName);
+						CachedPaksByHash.Remove(FileEntry.FileVersion);
+
+						CachedFile->Entry = FileEntry;
+						Chunk->PakFiles.Add(CachedFile);
+						PakFiles.Add(CachedFile->Entry.FileName, CachedFile);
+						continue;
+					}
+				}
+			}
+
 			// create a new entry
 			TSharedRef<FPakFile> NewFile = MakeShared<FPakFile>();
 			NewFile->Entry = FileEntry;
@@ -1383,7 +1429,6 @@ void FChunkDownloader::LoadManifest(const TArray<FPakFileEntry>& ManifestPakFile
 	}
 
 	// any files still left in OldPakFiles should be cancelled, unmounted, and deleted
-	IFileManager& FileManager = IFileManager::Get();
 	for (const auto& It : OldPakFiles)
 	{
 		const TSharedRef<FPakFile>& File = It.Value;
@@ -118,6 +118,12 @@ void FDownload::StartDownload(int TryNumber)
 	check(Downloader->BuildBaseUrls.Num() > 0);
 	FString Url = Downloader->BuildBaseUrls[TryNumber % Downloader->BuildBaseUrls.Num()] / PakFile->Entry.RelativeUrl;
 	UE_LOG(LogChunkDownloader, Log, TEXT("Downloading %s from %s"), *PakFile->Entry.FileName, *Url);
+	if (ShouldUseRangeRequests())
+	{
+		StartRangeDownload(Url, TryNumber);
+		return;
+	}
+
 	TWeakPtr<FDownload> WeakThisPtr = AsShared();
 	CancelCallback = PlatformStreamDownload(Url, TargetFile, [WeakThisPtr](int32 BytesReceived) {
 		TSharedPtr<FDownload> SharedThis = WeakThisPtr.Pin();
@@ -134,6 +140,206 @@ void FDownload::StartDownload(int TryNumber)
 	});
 }
 
+bool FDownload::ShouldUseRangeRequests() const
+{
+	const uint64 MinRangeSize = (uint64)FMath::Max(Downloader->MinRangeRequestSizeKB, 1) * 1024;
+	if (!bAllowRangeRequests || Downloader->RangeRequestsPerDownload <= 1 || PakFile->Entry.FileSize < 2 * MinRangeSize)
+	{
+		return false;
+	}
+
+	// a partial download from a single request is resumed by a single request
+	if (PakFile->SizeOnDisk > 0)
+	{
+		return false;
+	}
+
+	// the ranges are joined into the pak file once they have all been downloaded, which needs room for both
+	uint64 TotalDiskSpace = 0;
+	uint64 TotalDiskFreeSpace = 0;
+	if (FPlatformMisc::GetDiskTotalAndFreeSpace(Downloader->CacheFolder, TotalDiskSpace, TotalDiskFreeSpace))
+	{
+		return TotalDiskFreeSpace >= 2 * PakFile->Entry.FileSize;
+	}
+	return true;
+}
+
+void FDownload::StartRangeDownload(const FString& Url, int TryNumber)
+{
+	// split the file into ranges, retries keep the ranges so they resume from what their files already hold
+	if (Ranges.Num() == 0)
+	{
+		const uint64 FileSize = PakFile->Entry.FileSize;
+		const uint64 MinRangeSize = (uint64)FMath::Max(Downloader->MinRangeRequestSizeKB, 1) * 1024;
+		const int32 NumRanges = (int32)FMath::Min<uint64>(Downloader->RangeRequestsPerDownload, FileSize / MinRangeSize);
+		const uint64 RangeSize = FileSize / NumRanges;
+		Ranges.SetNum(NumRanges);
+		for (int32 i = 0; i < NumRanges; ++i)
+		{
+			FRange& Range = Ranges[i];
+			Range.TargetFile = FPaths::ChangeExtension(TargetFile, FString::Printf(TEXT("part%d.pak"), i));
+			Range.Offset = i * RangeSize;
+			Range.Size = (i == NumRanges - 1) ? FileSize - Range.Offset : RangeSize;
+		}
+	}
+
+	IFileManager& FileManager = IFileManager::Get();
+	TArray<FDownloadCancel> RangeCancelCallbacks;
+	TWeakPtr<FDownload> WeakThisPtr = AsShared();
+	NumRangesPending = 0;
+	for (int32 i = 0; i < Ranges.Num(); ++i)
+	{
+		FRange& Range = Ranges[i];
+		Range.BytesReceived = 0;
+		Range.HttpStatus = 0;
+
+		int64 FileSizeOnDisk = FileManager.FileSize(*Range.TargetFile);
+		uint64 SizeOnDisk = (FileSizeOnDisk > 0) ? (uint64)FileSizeOnDisk : 0;
+		Range.bIsComplete = (SizeOnDisk == Range.Size);
+		if (Range.bIsComplete)
+		{
+			continue;
+		}
+		if (SizeOnDisk > Range.Size)
+		{
+			IPlatformFile::GetPlatformPhysical().DeleteFile(*Range.TargetFile);
+		}
+
+		++NumRangesPending;
+		RangeCancelCallbacks.Add(PlatformStreamDownload(Url, Range.TargetFile, [WeakThisPtr, i](int32 BytesReceived) {
+			TSharedPtr<FDownload> SharedThis = WeakThisPtr.Pin();
+			if (SharedThis.IsValid() && !SharedThis->bHasCompleted)
+			{
+				SharedThis->Ranges[i].BytesReceived = BytesReceived;
+				int32 TotalBytesReceived = 0;
+				for (const FRange& Range : SharedThis->Ranges)
+				{
+					TotalBytesReceived += Range.BytesReceived;
+				}
+				SharedThis->OnDownloadProgress(TotalBytesReceived);
+			}
+		}, [WeakThisPtr, i, TryNumber, Url](int32 HttpStatus) {
+			TSharedPtr<FDownload> SharedThis = WeakThisPtr.Pin();
+			if (SharedThis.IsValid() && !SharedThis->bHasCompleted)
+			{
+				SharedThis->OnRangeDownloadComplete(i, Url, TryNumber, HttpStatus);
+			}
+		}, Range.Offset, Range.Size));
+	}
+
+	CancelCallback = [RangeCancelCallbacks]() {
+		for (const FDownloadCancel& RangeCancelCallback : RangeCancelCallbacks)
+		{
+			RangeCancelCallback();
+		}
+	};
+
+	// if every range was already on disk, finish next tick (completion may issue more downloads)
+	if (NumRangesPending == 0)
+	{
+		FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThisPtr, TryNumber, Url](float Unused) {
+			TSharedPtr<FDownload> SharedThis = WeakThisPtr.Pin();
+			if (SharedThis.IsValid() && !SharedThis->bHasCompleted)
+			{
+				SharedThis->FinishRangeDownload(Url, TryNumber);
+			}
+			return false;
+		}));
+	}
+}
+
+void FDownload::OnRangeDownloadComplete(int32 RangeIndex, const FString& Url, int TryNumber, int32 HttpStatus)
+{
+	FRange& Range = Ranges[RangeIndex];
+	Range.HttpStatus = HttpStatus;
+	Range.bIsComplete = (HttpStatus == EHttpResponseCodes::PartialContent);
+
+	check(NumRangesPending > 0);
+	if (--NumRangesPending == 0)
+	{
+		FinishRangeDownload(Url, TryNumber);
+	}
+}
+
+void FDownload::FinishRangeDownload(const FString& Url, int TryNumber)
+{
+	int32 HttpStatus = EHttpResponseCodes::PartialContent;
+	for (const FRange& Range : Ranges)
+	{
+		if (!Range.bIsComplete)
+		{
+			HttpStatus = Range.HttpStatus;
+			if (EHttpResponseCodes::IsOk(HttpStatus))
+			{
+				// the server ignored the Range header, fall back to downloading the file with a single request
+				UE_LOG(LogChunkDownloader, Warning, TEXT("%s does not support range requests, downloading %s with a single request"), *Url, *PakFile->Entry.FileName);
+				bAllowRangeRequests = false;
+				HttpStatus = 0;
+			}
+			break;
+		}
+	}
+
+	if (EHttpResponseCodes::IsOk(HttpStatus))
+	{
+		if (!AssembleRanges())
+		{
+			HttpStatus = 0;
+		}
+		DeleteRangeFiles();
+		Ranges.Empty();
+	}
+	else if (!bAllowRangeRequests)
+	{
+		DeleteRangeFiles();
+		Ranges.Empty();
+	}
+
+	OnDownloadComplete(Url, TryNumber, HttpStatus);
+}
+
+bool FDownload::AssembleRanges() const
+{
+	IPlatformFile& PlatformFile = IPlatformFile::GetPlatformPhysical();
+	TUniquePtr<IFileHandle> PakFileHandle(PlatformFile.OpenWrite(*TargetFile));
+	if (!PakFileHandle.IsValid())
+	{
+		UE_LOG(LogChunkDownloader, Error, TEXT("Unable to save file to %s"), *TargetFile);
+		return false;
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(1024 * 1024);
+	for (const FRange& Range : Ranges)
+	{
+		TUniquePtr<IFileHandle> RangeFileHandle(PlatformFile.OpenRead(*Range.TargetFile));
+		bool bSuccess = RangeFileHandle.IsValid() && RangeFileHandle->Size() == (int64)Range.Size;
+		for (uint64 Remaining = Range.Size; bSuccess && Remaining > 0;)
+		{
+			const int64 BytesToCopy = (int64)FMath::Min<uint64>(Remaining, Buffer.Num());
+			bSuccess = RangeFileHandle->Read(Buffer.GetData(), BytesToCopy) && PakFileHandle->Write(Buffer.GetData(), BytesToCopy);
+			Remaining -= BytesToCopy;
+		}
+
+		if (!bSuccess)
+		{
+			UE_LOG(LogChunkDownloader, Error, TEXT("Failed to copy %s into %s"), *Range.TargetFile, *TargetFile);
+			PakFileHandle.Reset();
+			PlatformFile.DeleteFile(*TargetFile);
+			return false;
+		}
+	}
+	return true;
+}
+
+void FDownload::DeleteRangeFiles() const
+{
+	for (const FRange& Range : Ranges)
+	{
+		IPlatformFile::GetPlatformPhysical().DeleteFile(*Range.TargetFile);
+	}
+}
+
 void FDownload::OnDownloadProgress(int32 BytesReceived)
 {
 	Downloader->LoadingModeStats.BytesDownloaded -= LastBytesReceived;
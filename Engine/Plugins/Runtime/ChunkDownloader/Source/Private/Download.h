@@ -31,7 +31,29 @@ protected:
 	void OnDownloadComplete(const FString& Url, int TryNumber, int32 HttpStatus);
 	void OnCompleted(bool bSuccess, const FText& ErrorText);
 
+	bool ShouldUseRangeRequests() const;
+	void StartRangeDownload(const FString& Url, int TryNumber);
+	void OnRangeDownloadComplete(int32 RangeIndex, const FString& Url, int TryNumber, int32 HttpStatus);
+	void FinishRangeDownload(const FString& Url, int TryNumber);
+	bool AssembleRanges() const;
+	void DeleteRangeFiles() const;
+
 private:
+	// one of the parallel range requests a pak file download is split into
+	struct FRange
+	{
+		FString TargetFile;
+		uint64 Offset = 0;
+		uint64 Size = 0;
+		int32 BytesReceived = 0;
+		int32 HttpStatus = 0;
+		bool bIsComplete = false;
+	};
+
+	TArray<FRange> Ranges;
+	int32 NumRangesPending = 0;
+	bool bAllowRangeRequests = true;
+
 	bool bIsCancelled = false;
 	FDownloadCancel CancelCallback;
 	bool bHasCompleted = false;
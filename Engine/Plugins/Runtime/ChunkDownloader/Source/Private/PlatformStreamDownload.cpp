@@ -9,7 +9,7 @@
 // Android
 // https://developer.android.com/reference/android/app/DownloadManager.html
 #error "TODO: android"
-FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback)
+FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback, uint64 RangeOffset, uint64 RangeSize)
 {
 	// TODO: write me
 	Callback(0);
@@ -23,7 +23,7 @@ FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& Target
 // iOS
 // https://developer.apple.com/library/content/documentation/iPhone/Conceptual/iPhoneOSProgrammingGuide/BackgroundExecution/BackgroundExecution.html
 #error "TODO: ios"
-FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback)
+FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback, uint64 RangeOffset, uint64 RangeSize)
 {
 	// TODO: write me
 	Callback(0);
@@ -36,7 +36,7 @@ FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& Target
 
 // NOTE: this implementation does not stream the file, it loads the whole thing into memory
 // then saves it (not optimal). It does attempt to resume interrupted downloads (for use in testing), but since it doesn't do partial writes, those probably won't occur in the wild.
-FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback)
+FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback, uint64 RangeOffset, uint64 RangeSize)
 {
 	// how much of the file do we currently have on disk (if any)
 	IFileManager& FileManager = IFileManager::Get();
@@ -48,10 +48,18 @@ FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& Target
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = HttpModule.Get().CreateRequest();
 	Request->SetURL(Url);
 	Request->SetVerb(TEXT("GET"));
-	if (SizeOnDisk > 0)
+	const uint64 RangeStart = RangeOffset + SizeOnDisk;
+	const bool bRequiresRange = RangeOffset > 0 || RangeSize > 0;
+	if (RangeSize > 0)
+	{
+		// request only the missing part of the given range
+		check(SizeOnDisk < RangeSize);
+		Request->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%llu-%llu"), RangeStart, RangeOffset + RangeSize - 1));
+	}
+	else if (RangeStart > 0)
 	{
 		// try to request a specific range
-		Request->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%llu-"), SizeOnDisk));
+		Request->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%llu-"), RangeStart));
 	}
 
 	// bind the progress delegate
@@ -63,7 +71,7 @@ FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& Target
 	}
 	
 	// bind a completion delegate
-	Request->OnProcessRequestComplete().BindLambda([Callback, TargetFile, SizeOnDisk](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSuccess) {
+	Request->OnProcessRequestComplete().BindLambda([Callback, TargetFile, SizeOnDisk, RangeStart, bRequiresRange](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSuccess) {
 		// check response
 		int32 HttpStatus = 0;
 		if (HttpResponse.IsValid())
@@ -75,7 +83,7 @@ FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& Target
 			{
 				static const FString ContentRangeHeader = TEXT("Content-Range");
 				// if we got partial content, make sure the Content-Range header is what we expect
-				FString ExpectedHeaderPrefix = FString::Printf(TEXT("bytes %llu-"), SizeOnDisk);
+				FString ExpectedHeaderPrefix = FString::Printf(TEXT("bytes %llu-"), RangeStart);
 				FString HeaderValue = HttpResponse->GetHeader(ContentRangeHeader);
 				if (!HeaderValue.StartsWith(ExpectedHeaderPrefix))
 				{
@@ -83,6 +91,12 @@ FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& Target
 					bHeadersOk = false;
 				}
 			}
+			else if (bHeadersOk && bRequiresRange)
+			{
+				// the whole file is no use when only a range of it was asked for (callers check for a non-206 status)
+				UE_LOG(LogChunkDownloader, Error, TEXT("Range request for %s returned HTTP %d instead of partial content"), *HttpRequest->GetURL(), HttpStatus);
+				bHeadersOk = false;
+			}
 
 			// see if the headers are alright
 			if (bHeadersOk)
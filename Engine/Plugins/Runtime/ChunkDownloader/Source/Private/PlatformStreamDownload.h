@@ -6,4 +6,6 @@ typedef TFunction<void(int32 HttpStatus)> FDownloadComplete;
 typedef TFunction<void(int32 BytesReceived)> FDownloadProgress;
 typedef TFunction<void(void)> FDownloadCancel;
 
-extern FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback);
+// downloads Url to TargetFile, resuming from whatever is already on disk. A non-zero RangeSize downloads only RangeSize bytes
+// starting at RangeOffset in the remote file (TargetFile then holds just that range).
+extern FDownloadCancel PlatformStreamDownload(const FString& Url, const FString& TargetFile, const FDownloadProgress& Progress, const FDownloadComplete& Callback, uint64 RangeOffset = 0, uint64 RangeSize = 0);
@@ -266,6 +266,12 @@ private:
 	// maximum number of downloads to allow concurrently
 	int32 TargetDownloadsInFlight = 1;
 
+	// number of parallel HTTP range requests a pak file download is split into (1 downloads each pak file with a single request)
+	int32 RangeRequestsPerDownload = 1;
+
+	// pak files are only split into ranges of at least this size
+	int32 MinRangeRequestSizeKB = 4096;
+
 	// list of pak files that have been requested
 	TArray<TSharedRef<FPakFile>> DownloadRequests;
 };
@@ -20,6 +20,7 @@
 DEFINE_LOG_CATEGORY(LogAbilitySystemComponent);
 
 DECLARE_CYCLE_STAT(TEXT("AbilitySystemComp ApplyGameplayEffectSpecToTarget"), STAT_AbilitySystemComp_ApplyGameplayEffectSpecToTarget, STATGROUP_AbilitySystem);
+DECLARE_CYCLE_STAT(TEXT("AbilitySystemComp ApplyGameplayEffectSpecToTargets"), STAT_AbilitySystemComp_ApplyGameplayEffectSpecToTargets, STATGROUP_AbilitySystem);
 DECLARE_CYCLE_STAT(TEXT("AbilitySystemComp ApplyGameplayEffectSpecToSelf"), STAT_AbilitySystemComp_ApplyGameplayEffectSpecToSelf, STATGROUP_AbilitySystem);
 DECLARE_CYCLE_STAT(TEXT("AbilitySystemComp OnImmunityBlockGameplayEffect"), STAT_AbilitySystemComp_OnImmunityBlockGameplayEffect, STATGROUP_AbilitySystem);
 DECLARE_CYCLE_STAT(TEXT("AbilitySystemComp InvokeGameplayCueEvent"), STAT_AbilitySystemComp_InvokeGameplayCueEvent, STATGROUP_AbilitySystem);
@@ -634,6 +635,25 @@ FActiveGameplayEffectHandle UAbilitySystemComponent::ApplyGameplayEffectSpecToTa
 	return ReturnHandle;
 }
 
+void UAbilitySystemComponent::ApplyGameplayEffectSpecToTargets(const FGameplayEffectSpec& Spec, TArrayView<UAbilitySystemComponent* const> Targets, TArray<FActiveGameplayEffectHandle>& OutHandles, FPredictionKey PredictionKey)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbilitySystemComp_ApplyGameplayEffectSpecToTargets);
+
+	// Group the cues of all targets, instead of sending them as each target is applied to
+	FScopedGameplayCueSendContext GameplayCueSendContext;
+
+	TSet<UAbilitySystemComponent*, DefaultKeyFuncs<UAbilitySystemComponent*>, TInlineSetAllocator<64>> AppliedTargets;
+
+	OutHandles.Reset(Targets.Num());
+	for (UAbilitySystemComponent* Target : Targets)
+	{
+		bool bAlreadyApplied = false;
+		AppliedTargets.Add(Target, &bAlreadyApplied);
+
+		OutHandles.Add(bAlreadyApplied ? FActiveGameplayEffectHandle() : ApplyGameplayEffectSpecToTarget(Spec, Target, PredictionKey));
+	}
+}
+
 FActiveGameplayEffectHandle UAbilitySystemComponent::ApplyGameplayEffectSpecToSelf(const FGameplayEffectSpec &Spec, FPredictionKey PredictionKey)
 {
 #if WITH_SERVER_CODE
@@ -891,6 +911,17 @@ FActiveGameplayEffectHandle UAbilitySystemComponent::BP_ApplyGameplayEffectSpecT
 	return ReturnHandle;
 }
 
+TArray<FActiveGameplayEffectHandle> UAbilitySystemComponent::BP_ApplyGameplayEffectSpecToTargets(const FGameplayEffectSpecHandle& SpecHandle, const TArray<UAbilitySystemComponent*>& Targets)
+{
+	TArray<FActiveGameplayEffectHandle> ReturnHandles;
+	if (SpecHandle.IsValid())
+	{
+		ApplyGameplayEffectSpecToTargets(*SpecHandle.Data.Get(), Targets, ReturnHandles);
+	}
+
+	return ReturnHandles;
+}
+
 FActiveGameplayEffectHandle UAbilitySystemComponent::BP_ApplyGameplayEffectSpecToSelf(const FGameplayEffectSpecHandle& SpecHandle)
 {
 	FActiveGameplayEffectHandle ReturnHandle;
@@ -284,6 +284,16 @@ class GAMEPLAYABILITIES_API UAbilitySystemComponent : public UGameplayTasksCompo
 
 	virtual FActiveGameplayEffectHandle ApplyGameplayEffectSpecToTarget(const FGameplayEffectSpec& GameplayEffect, UAbilitySystemComponent *Target, FPredictionKey PredictionKey=FPredictionKey());
 
+	/** Applies a previously created gameplay effect spec to each target, e.g. everything caught in an explosion. Handles are returned in the order of the targets. */
+	UFUNCTION(BlueprintCallable, Category = GameplayEffects, meta = (DisplayName = "ApplyGameplayEffectSpecToTargets", ScriptName = "ApplyGameplayEffectSpecToTargets"))
+	TArray<FActiveGameplayEffectHandle> BP_ApplyGameplayEffectSpecToTargets(const FGameplayEffectSpecHandle& SpecHandle, const TArray<UAbilitySystemComponent*>& Targets);
+
+	/**
+	 * Applies the spec to each target, with the gameplay cues of all of them sent once they've all been applied to.
+	 * Targets listed more than once, e.g. actors overlapping the area with several shapes, only get it once and have an invalid handle for the repeats.
+	 */
+	void ApplyGameplayEffectSpecToTargets(const FGameplayEffectSpec& GameplayEffect, TArrayView<UAbilitySystemComponent* const> Targets, TArray<FActiveGameplayEffectHandle>& OutHandles, FPredictionKey PredictionKey = FPredictionKey());
+
 	/** Applies a previously created gameplay effect spec to this component */
 	UFUNCTION(BlueprintCallable, Category = GameplayEffects, meta = (DisplayName = "ApplyGameplayEffectSpecToSelf", ScriptName = "ApplyGameplayEffectSpecToSelf"))
 	FActiveGameplayEffectHandle BP_ApplyGameplayEffectSpecToSelf(const FGameplayEffectSpecHandle& SpecHandle);
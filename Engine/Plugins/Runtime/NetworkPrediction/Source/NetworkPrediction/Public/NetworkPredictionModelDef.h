@@ -45,6 +45,10 @@ struct FNetworkPredictionModelDef
 	static const TCHAR* GetName() { return nullptr; }
 
 	static constexpr int32 GetSortPriority() { return (int32)ENetworkPredictionSortPriority::Last; }
+
+	// Whether instances of this model can be ticked in parallel with each other by the tick and rollback services.
+	// Only return true if SimulationTick reads and writes nothing but its own input/sync/aux state and cues: no UObjects, scene queries or shared data.
+	static constexpr bool AllowsParallelTick() { return false; }
 };
 
 // ----------------------------------------------------------------------
@@ -1,9 +1,17 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #pragma once
+#include "Async/ParallelFor.h"
+#include "NetworkPredictionCVars.h"
 #include "NetworkPredictionSimulation.h"
 #include "NetworkPredictionInstanceData.h"
 
+namespace NetworkPredictionCVars
+{
+	NETSIM_DEVCVAR_SHIPCONST_INT(DisableParallelTick, 0, "np.ParallelTick.Disable", "Tick all simulation instances on the game thread, even for models that allow parallel ticking");
+	NETSIM_DEVCVAR_SHIPCONST_INT(ParallelTickMinInstances, 16, "np.ParallelTick.MinInstances", "Minimum number of instances of a model before its instances are ticked in parallel");
+}
+
 // Common util used by the ticking services. Might make sense to move to FNetworkPredictionDriverBase if needed elsewhere
 template<typename ModelDef>
 struct TTickUtil
@@ -44,6 +52,23 @@ struct TTickUtil
 		UE_NP_TRACE_PHYSICS_STATE_CURRENT(ModelDef, Instance.Info.Driver);
 	}
 
+	// Whether NumInstances instances of this model should be ticked with ParallelFor. Tracing writes to shared state, so it forces ticking on the game thread.
+	static bool ShouldTickInParallel(const int32 NumInstances)
+	{
+		if (!ModelDef::AllowsParallelTick() || NetworkPredictionCVars::DisableParallelTick() || NumInstances < FMath::Max(NetworkPredictionCVars::ParallelTickMinInstances(), 2))
+		{
+			return false;
+		}
+
+#if UE_NP_TRACE_ENABLED
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(NetworkPredictionChannel))
+		{
+			return false;
+		}
+#endif
+		return true;
+	}
+
 	template<typename SimulationType = typename ModelDef::Simulation>
 	static typename TEnableIf<TIsSame<SimulationType, void>::Value>::Type DoTick(TInstanceData<ModelDef>& Instance, FrameDataType& InputFrameData, FrameDataType& OutputFrameData, const FNetSimTimeStep& Step, const int32 EndTimeMS, ESimulationTickContext TickContext)
 	{
@@ -106,6 +131,13 @@ public:
 
 protected:
 
+	struct FInstance
+	{
+		int32 TraceID;
+		int32 InstanceIdx; // idx into TModelDataStore::Instances
+		int32 FrameBufferIdx; // idx into TModelDataStore::Frames
+	};
+
 	template<bool bIsResim>
 	void Tick_Internal(const FNetSimTimeStep& Step, const FServiceTimeStep& ServiceStep)
 	{
@@ -115,25 +147,47 @@ protected:
 		const int32 StartTime = Step.TotalSimulationTime;
 		const int32 EndTime = ServiceStep.EndTotalSimulationTime;
 
+		if (TTickUtil<ModelDef>::ShouldTickInParallel(InstancesToTick.Num()))
+		{
+			// Instances don't share any state, so each one can be ticked as its own task. Resims after a correction benefit most, since every instance is replayed.
+			ParallelInstances.Reset(InstancesToTick.Num());
+			for (auto It : InstancesToTick)
+			{
+				ParallelInstances.Add(It.Value);
+			}
+
+			ParallelFor(ParallelInstances.Num(), [&](int32 Idx)
+			{
+				TickInstance<bIsResim>(ParallelInstances[Idx], InputFrame, OutputFrame, Step, EndTime);
+			});
+			return;
+		}
+
 		for (auto It : InstancesToTick)
 		{
-			TInstanceData<ModelDef>& Instance = DataStore->Instances.GetByIndexChecked(It.Value.InstanceIdx);
-			TInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(It.Value.FrameBufferIdx);
+			TickInstance<bIsResim>(It.Value, InputFrame, OutputFrame, Step, EndTime);
+		}
+	}
 
-			typename TInstanceFrameState<ModelDef>::FFrame& InputFrameData = Frames.Buffer[InputFrame];
-			typename TInstanceFrameState<ModelDef>::FFrame& OutputFrameData = Frames.Buffer[OutputFrame];
+	template<bool bIsResim>
+	void TickInstance(const FInstance& InstanceToTick, const int32 InputFrame, const int32 OutputFrame, const FNetSimTimeStep& Step, const int32 EndTime)
+	{
+		TInstanceData<ModelDef>& Instance = DataStore->Instances.GetByIndexChecked(InstanceToTick.InstanceIdx);
+		TInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(InstanceToTick.FrameBufferIdx);
 
-			UE_NP_TRACE_SIM_TICK(It.Value.TraceID);
+		typename TInstanceFrameState<ModelDef>::FFrame& InputFrameData = Frames.Buffer[InputFrame];
+		typename TInstanceFrameState<ModelDef>::FFrame& OutputFrameData = Frames.Buffer[OutputFrame];
 
-			// Copy current input into the output frame. This is redundant in the case where we are polling
-			// local input but is needed in the other cases. Simpler to just copy it always.
-			if (!bIsResim || Instance.NetRole == ROLE_SimulatedProxy)
-			{
-				OutputFrameData.InputCmd = InputFrameData.InputCmd;
-			}
+		UE_NP_TRACE_SIM_TICK(InstanceToTick.TraceID);
 
-			TTickUtil<ModelDef>::DoTick(Instance, InputFrameData, OutputFrameData, Step, EndTime, GetTickContext<bIsResim>(Instance.NetRole));
+		// Copy current input into the output frame. This is redundant in the case where we are polling
+		// local input but is needed in the other cases. Simpler to just copy it always.
+		if (!bIsResim || Instance.NetRole == ROLE_SimulatedProxy)
+		{
+			OutputFrameData.InputCmd = InputFrameData.InputCmd;
 		}
+
+		TTickUtil<ModelDef>::DoTick(Instance, InputFrameData, OutputFrameData, Step, EndTime, GetTickContext<bIsResim>(Instance.NetRole));
 	}
 
 	template<bool bIsResim>
@@ -171,14 +225,8 @@ protected:
 		return ESimulationTickContext::None;
 	}
 
-	struct FInstance
-	{
-		int32 TraceID;
-		int32 InstanceIdx; // idx into TModelDataStore::Instances
-		int32 FrameBufferIdx; // idx into TModelDataStore::Frames
-	};
-
 	TSortedMap<int32, FInstance> InstancesToTick;
+	TArray<FInstance> ParallelInstances; // Scratch list of InstancesToTick used when ticking in parallel
 	TModelDataStore<ModelDef>* DataStore;
 	
 };
@@ -244,82 +292,103 @@ public:
 		const float fEngineFrameDeltaTimeMS = DeltaTimeSeconds * 1000.f;
 		const int32 CueTimeMS = VariableTickState->Frames[VariableTickState->PendingFrame].TotalMS; // This time stamp is what will get replicated to SP clients for Cues.
 
+		if (TTickUtil<ModelDef>::ShouldTickInParallel(InstanceBitArray.CountSetBits()))
+		{
+			ParallelRecvIndices.Reset();
+			for (TConstSetBitIterator<> BitIt(InstanceBitArray); BitIt; ++BitIt)
+			{
+				ParallelRecvIndices.Add(BitIt.GetIndex());
+			}
+
+			ParallelFor(ParallelRecvIndices.Num(), [&](int32 Idx)
+			{
+				TickInstance(ParallelRecvIndices[Idx], fEngineFrameDeltaTimeMS, CueTimeMS);
+			});
+			return;
+		}
+
 		for (TConstSetBitIterator<> BitIt(InstanceBitArray); BitIt; ++BitIt)
 		{
-			const int32 ServerRecvIdx = BitIt.GetIndex();
-			TServerRecvData_Independent<ModelDef>& ServerRecvData = DataStore->ServerRecv_IndependentTick.GetByIndexChecked(ServerRecvIdx);
-			ServerRecvData.UnspentTimeMS += fEngineFrameDeltaTimeMS;
+			TickInstance(BitIt.GetIndex(), fEngineFrameDeltaTimeMS, CueTimeMS);
+		}
+	}
 
-			TInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(ServerRecvData.FramesIdx);
-			TInstanceData<ModelDef>& InstanceData = DataStore->Instances.GetByIndexChecked(ServerRecvData.InstanceIdx);
+private:
+
+	// Consumes as many received input cmds as the unspent time allows for a single remote client
+	void TickInstance(const int32 ServerRecvIdx, const float fEngineFrameDeltaTimeMS, const int32 CueTimeMS)
+	{
+		TServerRecvData_Independent<ModelDef>& ServerRecvData = DataStore->ServerRecv_IndependentTick.GetByIndexChecked(ServerRecvIdx);
+		ServerRecvData.UnspentTimeMS += fEngineFrameDeltaTimeMS;
 
-			int32 TotalFrames = 0;
-			int32 TotalMS = 0;
+		TInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(ServerRecvData.FramesIdx);
+		TInstanceData<ModelDef>& InstanceData = DataStore->Instances.GetByIndexChecked(ServerRecvData.InstanceIdx);
 
-			const int32 TraceID = ServerRecvData.TraceID;
+		int32 TotalFrames = 0;
+		int32 TotalMS = 0;
 
-			while (ServerRecvData.LastConsumedFrame < ServerRecvData.LastRecvFrame)
+		const int32 TraceID = ServerRecvData.TraceID;
+
+		while (ServerRecvData.LastConsumedFrame < ServerRecvData.LastRecvFrame)
+		{
+			const int32 NextFrame = ++ServerRecvData.LastConsumedFrame;
+			typename TServerRecvData_Independent<ModelDef>::FFrame& NextRecvData = ServerRecvData.InputBuffer[NextFrame];
+
+			if (NextRecvData.DeltaTimeMS == 0)
 			{
-				const int32 NextFrame = ++ServerRecvData.LastConsumedFrame;
-				typename TServerRecvData_Independent<ModelDef>::FFrame& NextRecvData = ServerRecvData.InputBuffer[NextFrame];
+				// Dropped cmd, just skip and pretend nothing happened (expect client to be corrected)
+				continue;
+			}
 
-				if (NextRecvData.DeltaTimeMS == 0)
-				{
-					// Dropped cmd, just skip and pretend nothing happened (expect client to be corrected)
-					continue;
-				}
+			const int32 InputCmdMS = FMath::Clamp(NextRecvData.DeltaTimeMS, MinRemoteClientStepMS, MaxRemoteClientTotalMSPerFrame);
 
-				const int32 InputCmdMS = FMath::Clamp(NextRecvData.DeltaTimeMS, MinRemoteClientStepMS, MaxRemoteClientTotalMSPerFrame);
+			if (InputCmdMS > (int32)ServerRecvData.UnspentTimeMS)
+			{
+				break;
+			}
 
-				if (InputCmdMS > (int32)ServerRecvData.UnspentTimeMS)
-				{
-					break;
-				}
+			const int32 NewTotalMS = TotalMS + InputCmdMS;
+			if (NewTotalMS > MaxRemoteClientTotalMSPerFrame)
+			{
+				break;
+			}
 
-				const int32 NewTotalMS = TotalMS + InputCmdMS;
-				if (NewTotalMS > MaxRemoteClientTotalMSPerFrame)
+			// Tick
+			{
+				TotalMS = NewTotalMS;
+				ServerRecvData.UnspentTimeMS -= (float)InputCmdMS;
+				if (FMath::IsNearlyZero(ServerRecvData.UnspentTimeMS))
 				{
-					break;
+					ServerRecvData.UnspentTimeMS = 0.f;
 				}
 
-				// Tick
-				{
-					TotalMS = NewTotalMS;
-					ServerRecvData.UnspentTimeMS -= (float)InputCmdMS;
-					if (FMath::IsNearlyZero(ServerRecvData.UnspentTimeMS))
-					{
-						ServerRecvData.UnspentTimeMS = 0.f;
-					}
+				const int32 InputFrame = ServerRecvData.PendingFrame++;
+				const int32 OutputFrame = ServerRecvData.PendingFrame;
 
-					const int32 InputFrame = ServerRecvData.PendingFrame++;
-					const int32 OutputFrame = ServerRecvData.PendingFrame;
+				Frames.Buffer[InputFrame].InputCmd = NextRecvData.InputCmd;
 
-					Frames.Buffer[InputFrame].InputCmd = NextRecvData.InputCmd;
+				typename TInstanceFrameState<ModelDef>::FFrame& InputFrameData = Frames.Buffer[InputFrame];
+				typename TInstanceFrameState<ModelDef>::FFrame& OutputFrameData = Frames.Buffer[OutputFrame];
 
-					typename TInstanceFrameState<ModelDef>::FFrame& InputFrameData = Frames.Buffer[InputFrame];
-					typename TInstanceFrameState<ModelDef>::FFrame& OutputFrameData = Frames.Buffer[OutputFrame];
+				FNetSimTimeStep Step {InputCmdMS, ServerRecvData.TotalSimTimeMS, OutputFrame };
 
-					FNetSimTimeStep Step {InputCmdMS, ServerRecvData.TotalSimTimeMS, OutputFrame };
+				ServerRecvData.TotalSimTimeMS += InputCmdMS;
 
-					ServerRecvData.TotalSimTimeMS += InputCmdMS;
+				UE_NP_TRACE_PUSH_TICK(Step.TotalSimulationTime, Step.StepMS, Step.Frame);
+				UE_NP_TRACE_SIM_TICK(TraceID);
 
-					UE_NP_TRACE_PUSH_TICK(Step.TotalSimulationTime, Step.StepMS, Step.Frame);
-					UE_NP_TRACE_SIM_TICK(TraceID);
-
-					TTickUtil<ModelDef>::DoTick(InstanceData, InputFrameData, OutputFrameData, Step, CueTimeMS, ESimulationTickContext::Authority);
-					
-				}
+				TTickUtil<ModelDef>::DoTick(InstanceData, InputFrameData, OutputFrameData, Step, CueTimeMS, ESimulationTickContext::Authority);
+				
+			}
 
-				if (++TotalFrames == MaxRemoteClientStepsPerFrame)
-				{
-					break;
-				}
+			if (++TotalFrames == MaxRemoteClientStepsPerFrame)
+			{
+				break;
 			}
 		}
 	}
 
-private:
-
 	TBitArray<> InstanceBitArray; // Indices into DataStore->ServerRecv_IndependentTick that we are managing
+	TArray<int32> ParallelRecvIndices; // Scratch list of set bits in InstanceBitArray used when ticking in parallel
 	TModelDataStore<ModelDef>* DataStore;
 };
\ No newline at end of file
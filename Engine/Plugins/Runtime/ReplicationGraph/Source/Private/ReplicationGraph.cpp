@@ -58,6 +58,8 @@
 #include "UObject/UObjectGlobals.h"
 #include "DrawDebugHelpers.h"
 #include "Misc/ScopeExit.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 #include "Net/NetworkGranularMemoryLogging.h"
 #include "Net/Core/Trace/NetTrace.h"
 #include "Engine/ServerStatReplicator.h"
@@ -110,6 +112,15 @@ int32 CVar_RepGraph_DormantDynamicActorsDestruction = 0;
 static FAutoConsoleVariableRef CVarRepGraphDormantDynamicActorsDestruction(TEXT("Net.RepGraph.DormantDynamicActorsDestruction"), CVar_RepGraph_DormantDynamicActorsDestruction,
 	TEXT("If true, irrelevant dormant actors will be destroyed on the client"), ECVF_Default);
 
+int32 CVar_RepGraph_ParallelGather = 0;
+static FAutoConsoleVariableRef CVarRepGraphParallelGather(TEXT("Net.RepGraph.ParallelGather"), CVar_RepGraph_ParallelGather,
+	TEXT("If true, GatherActorListsForConnection runs for all connections in parallel before any connection replicates. ")
+	TEXT("Nodes that don't return true from SupportsParallelGather (including custom nodes that don't override it) are still gathered on the game thread."), ECVF_Default);
+
+int32 CVar_RepGraph_ParallelGatherMinConnections = 4;
+static FAutoConsoleVariableRef CVarRepGraphParallelGatherMinConnections(TEXT("Net.RepGraph.ParallelGather.MinConnections"), CVar_RepGraph_ParallelGatherMinConnections,
+	TEXT("Minimum number of connections required before Net.RepGraph.ParallelGather is used."), ECVF_Default);
+
 float CVar_RepGraph_OutOfRangeDistanceCheckRatio = 0.5f;
 static FAutoConsoleVariableRef CVarRepGraphOutOfRangeDistanceCheckRatio(TEXT("Net.RepGraph.OutOfRangeDistanceCheckRatio"), CVar_RepGraph_OutOfRangeDistanceCheckRatio,
 	TEXT("The ratio of DestructInfoMaxDistance that gives the distance traveled before we reevaluate the out of range destroyed actors list"), ECVF_Default);
@@ -901,6 +912,96 @@ int32 UReplicationGraph::ServerReplicateActors(float DeltaSeconds)
 		}
 	}
 
+	auto BuildConnectionViewers = [this](UNetConnection* NetConnection, FNetViewerArray& OutViewers)
+	{
+		OutViewers.Emplace(NetConnection, 0.f);
+
+		// Splitscreen connections are viewers as well
+		for (UNetConnection* ChildConnection : NetConnection->Children)
+		{
+			if (ChildConnection && ChildConnection->PlayerController && ChildConnection->ViewTarget)
+			{
+				OutViewers.Emplace(ChildConnection, 0.f);
+			}
+		}
+
+		// treat all other non-replay connections as viewers
+		if (NetConnection->IsReplay())
+		{
+			for (UNetReplicationGraphConnection* RepGraphConn : Connections)
+			{
+				if ((RepGraphConn->NetConnection != NetConnection) && !RepGraphConn->NetConnection->IsReplay() && RepGraphConn->PrepareForReplication())
+				{
+					OutViewers.Emplace(RepGraphConn->NetConnection, 0.f);
+				}
+			}
+
+			AddReplayViewers(NetConnection, OutViewers);
+		}
+	};
+
+	// -------------------------------------------------------
+	//	GATHER (Parallel, optional)
+	// -------------------------------------------------------
+
+	/** Everything a connection needs to gather off the game thread. Indices match Connections. */
+	struct FParallelGatherContext
+	{
+		UNetReplicationGraphConnection* ConnectionManager = nullptr;
+		FNetViewerArray Viewers;
+		TSet<FName> VisibleLevelNames;
+		FGatheredReplicationActorLists GatheredReplicationLists;
+		TArray<UReplicationGraphNode*> DeferredGatherNodes;
+	};
+
+	TArray<FParallelGatherContext> ParallelGatherContexts;
+	const bool bParallelGather = CVar_RepGraph_ParallelGather > 0 && Connections.Num() >= FMath::Max(CVar_RepGraph_ParallelGatherMinConnections, 2) && FApp::ShouldUseThreadingForPerformance();
+
+	if (bParallelGather)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(NET_ReplicateActors_ParallelGather);
+
+		ParallelGatherContexts.SetNum(Connections.Num());
+
+		for (int32 ConnectionIdx = 0; ConnectionIdx < Connections.Num(); ++ConnectionIdx)
+		{
+			UNetReplicationGraphConnection* ConnectionManager = Connections[ConnectionIdx];
+			UNetConnection* const NetConnection = ConnectionManager->NetConnection;
+
+			if (ConnectionManager->PrepareForReplication() == false || (NetConnection->IsReplay() && !NetConnection->IsReplayReady()))
+			{
+				continue;
+			}
+
+			FParallelGatherContext& Context = ParallelGatherContexts[ConnectionIdx];
+			Context.ConnectionManager = ConnectionManager;
+			BuildConnectionViewers(NetConnection, Context.Viewers);
+			ConnectionManager->GetClientVisibleLevelNames(Context.VisibleLevelNames);
+		}
+
+		ParallelFor(ParallelGatherContexts.Num(), [this, &ParallelGatherContexts, FrameNum](int32 ConnectionIdx)
+		{
+			FParallelGatherContext& Context = ParallelGatherContexts[ConnectionIdx];
+			if (Context.ConnectionManager == nullptr)
+			{
+				return;
+			}
+
+			FConnectionGatherActorListParameters Parameters(Context.Viewers, *Context.ConnectionManager, Context.VisibleLevelNames, FrameNum, Context.GatheredReplicationLists);
+			Parameters.DeferredGatherNodes = &Context.DeferredGatherNodes;
+
+			for (UReplicationGraphNode* Node : GlobalGraphNodes)
+			{
+				UReplicationGraphNode::ConditionalGatherActorListsForConnection(Node, Parameters);
+			}
+
+			for (UReplicationGraphNode* Node : Context.ConnectionManager->ConnectionGraphNodes)
+			{
+				UReplicationGraphNode::ConditionalGatherActorListsForConnection(Node, Parameters);
+			}
+		});
+	}
+
 	// -------------------------------------------------------
 	// For Each Connection
 	// -------------------------------------------------------
@@ -908,8 +1009,10 @@ int32 UReplicationGraph::ServerReplicateActors(float DeltaSeconds)
 	// Total number of children processed, added to all the connections later for stat tracking purposes.
 	int32 NumChildrenConnectionsProcessed = 0;
 
-	for (UNetReplicationGraphConnection* ConnectionManager: Connections)
+	for (int32 ConnectionIdx = 0; ConnectionIdx < Connections.Num(); ++ConnectionIdx)
 	{
+		UNetReplicationGraphConnection* ConnectionManager = Connections[ConnectionIdx];
+
 		// Prepare for Replication also handles children as well.
 		if (ConnectionManager->PrepareForReplication() == false)
 		{
@@ -934,8 +1037,6 @@ int32 UReplicationGraph::ServerReplicateActors(float DeltaSeconds)
 
 		CSV_SCOPED_TIMING_STAT_EXCLUSIVE_CONDITIONAL(ReplayNetConnection, bReplayConnection);
 
-		ConnectionViewers.Emplace(NetConnection, 0.f);
-		
 		// Send ClientAdjustments (movement RPCs) do this first and never let bandwidth saturation suppress these.
 		if (PC)
 		{
@@ -949,25 +1050,20 @@ int32 UReplicationGraph::ServerReplicateActors(float DeltaSeconds)
 			if (ChildConnection && ChildConnection->PlayerController && ChildConnection->ViewTarget)
 			{
 				ChildConnection->PlayerController->SendClientAdjustment();
-
-				ConnectionViewers.Emplace(ChildConnection, 0.f);
 			}
 		}
 
 		NumChildrenConnectionsProcessed += NetConnection->Children.Num();
 
-		// treat all other non-replay connections as viewers
-		if (bReplayConnection)
+		FParallelGatherContext* ParallelGatherContext = nullptr;
+		if (bParallelGather && ParallelGatherContexts[ConnectionIdx].ConnectionManager == ConnectionManager)
 		{
-			for (UNetReplicationGraphConnection* RepGraphConn : Connections)
-			{
-				if ((RepGraphConn->NetConnection != NetConnection) && !RepGraphConn->NetConnection->IsReplay() && RepGraphConn->PrepareForReplication())
-				{
-					ConnectionViewers.Emplace(RepGraphConn->NetConnection, 0.f);
-				}
-			}
-
-			AddReplayViewers(NetConnection, ConnectionViewers);
+			ParallelGatherContext = &ParallelGatherContexts[ConnectionIdx];
+			ConnectionViewers = ParallelGatherContext->Viewers;
+		}
+		else
+		{
+			BuildConnectionViewers(NetConnection, ConnectionViewers);
 		}
 
 		ON_SCOPE_EXIT
@@ -984,7 +1080,8 @@ int32 UReplicationGraph::ServerReplicateActors(float DeltaSeconds)
 		// GATHER list of ReplicationLists for this connection
 		// --------------------------------------------------------------------------------------------------------------
 		
-		FGatheredReplicationActorLists GatheredReplicationListsForConnection;
+		FGatheredReplicationActorLists LocalGatheredReplicationLists;
+		FGatheredReplicationActorLists& GatheredReplicationListsForConnection = ParallelGatherContext ? ParallelGatherContext->GatheredReplicationLists : LocalGatheredReplicationLists;
 
 		TSet<FName> AllVisibleLevelNames;
 		ConnectionManager->GetClientVisibleLevelNames(AllVisibleLevelNames);
@@ -993,14 +1090,25 @@ int32 UReplicationGraph::ServerReplicateActors(float DeltaSeconds)
 		{
 			QUICK_SCOPE_CYCLE_COUNTER(NET_ReplicateActors_GatherForConnection);
 
-			for (UReplicationGraphNode* Node : GlobalGraphNodes)
+			if (ParallelGatherContext)
 			{
-				Node->GatherActorListsForConnection(Parameters);
+				// Everything else was already gathered in parallel, only the nodes that had to be deferred are left
+				for (UReplicationGraphNode* Node : ParallelGatherContext->DeferredGatherNodes)
+				{
+					Node->GatherActorListsForConnection(Parameters);
+				}
 			}
-
-			for (UReplicationGraphNode* Node : ConnectionManager->ConnectionGraphNodes)
+			else
 			{
-				Node->GatherActorListsForConnection(Parameters);
+				for (UReplicationGraphNode* Node : GlobalGraphNodes)
+				{
+					Node->GatherActorListsForConnection(Parameters);
+				}
+
+				for (UReplicationGraphNode* Node : ConnectionManager->ConnectionGraphNodes)
+				{
+					Node->GatherActorListsForConnection(Parameters);
+				}
 			}
 
 			ConnectionManager->UpdateGatherLocationsForConnection(ConnectionViewers, DestructionSettings);
@@ -2763,6 +2871,18 @@ UReplicationGraphNode::UReplicationGraphNode()
 
 }
 
+void UReplicationGraphNode::ConditionalGatherActorListsForConnection(UReplicationGraphNode* Node, const FConnectionGatherActorListParameters& Params)
+{
+	if (Params.IsParallelGather() && !Node->SupportsParallelGather())
+	{
+		Params.DeferredGatherNodes->Add(Node);
+	}
+	else
+	{
+		Node->GatherActorListsForConnection(Params);
+	}
+}
+
 void UReplicationGraphNode::NotifyResetAllNetworkActors()
 {
 	for (UReplicationGraphNode* ChildNode : AllChildNodes)
@@ -3031,7 +3151,7 @@ void UReplicationGraphNode_ActorList::GatherActorListsForConnection(const FConne
 	StreamingLevelCollection.Gather(Params);
 	for (UReplicationGraphNode* ChildNode : AllChildNodes)
 	{
-		ChildNode->GatherActorListsForConnection(Params);
+		ConditionalGatherActorListsForConnection(ChildNode, Params);
 	}
 }
 
@@ -4216,6 +4336,11 @@ void UReplicationGraphNode_DormancyNode::GatherActorListsForConnection(const FCo
 	{
 		ConnectionNode->GatherActorListsForConnection(Params);
 	}
+	else if (Params.IsParallelGather())
+	{
+		// Connection nodes are UObjects, so the first gather for a connection has to create it on the game thread
+		Params.DeferredGatherNodes->Add(this);
+	}
 	else
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(RepGraphNode_ConnectionDormancy_NewNodeFirstGather);
@@ -4855,310 +4980,452 @@ static FAutoConsoleVariableRef CVarRepGraphSpatialDebugDynamic(TEXT("Net.RepGrap
 int32 CVar_RepGraph_Spatial_BiasCreep = 0.f;
 static FAutoConsoleVariableRef CVarRepGraphSpatialBiasCreep(TEXT("Net.RepGraph.Spatial.BiasCreep"), CVar_RepGraph_Spatial_BiasCreep, TEXT("Changes bias each frame by this much and force rebuld. For stress test debugging"), ECVF_Default );
 
-void UReplicationGraphNode_GridSpatialization2D::PrepareForReplication()
-{
-	RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_GridSpatialization2D_PrepareForReplication);
-
-	FGlobalActorReplicationInfoMap* GlobalRepMap = GraphGlobals.IsValid() ? GraphGlobals->GlobalActorReplicationInfoMap : nullptr;
+int32 CVar_RepGraph_Spatial_BatchedDynamicCellInfo = 0;
+static FAutoConsoleVariableRef CVarRepGraphSpatialBatchedDynamicCellInfo(TEXT("Net.RepGraph.Spatial.BatchedDynamicCellInfo"), CVar_RepGraph_Spatial_BatchedDynamicCellInfo, TEXT("When enabled, dynamic actor locations and cull distances are packed into contiguous arrays each frame and their grid cells are computed four at a time with vector math before the cell lists are updated."), ECVF_Default );
 
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	if (CVar_RepGraph_Spatial_BiasCreep != 0.f)
-	{
-		SpatialBias.X += CVar_RepGraph_Spatial_BiasCreep;
-		SpatialBias.Y += CVar_RepGraph_Spatial_BiasCreep;
-		bNeedsRebuild = true;
-	}
+void UReplicationGraphNode_GridSpatialization2D::UpdateDynamicActorCells(FActorRepListType DynamicActor, FCachedDynamicActorInfo& DynamicActorInfo, const FActorCellInfo& NewCellInfo)
+{
+	FActorCellInfo& PreviousCellInfo = DynamicActorInfo.CellInfo;
+	FNewReplicatedActorInfo& ActorInfo = DynamicActorInfo.ActorInfo;
 
-	// -------------------------------------------
-	//	Update dynamic actors
-	// -------------------------------------------
-	if (CVar_RepGraph_Spatial_PauseDynamic == 0)
-#endif
+	if (PreviousCellInfo.IsValid())
 	{
-		RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_GridSpatialization2D_BuildDynamic);
+		bool bDirty = false;
 
-		for (auto& MapIt : DynamicSpatializedActors)
+		if (UNLIKELY(NewCellInfo.StartX > PreviousCellInfo.EndX || NewCellInfo.EndX < PreviousCellInfo.StartX ||
+				NewCellInfo.StartY > PreviousCellInfo.EndY || NewCellInfo.EndY < PreviousCellInfo.StartY))
 		{
-			FActorRepListType& DynamicActor = MapIt.Key;
-			FCachedDynamicActorInfo& DynamicActorInfo = MapIt.Value;
-			FActorCellInfo& PreviousCellInfo = DynamicActorInfo.CellInfo;
-			FNewReplicatedActorInfo& ActorInfo = DynamicActorInfo.ActorInfo;
+			// No longer intersecting, we just have to remove from all previous nodes and add to all new nodes
+			
+			bDirty = true;
 
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-			if (!IsActorValidForReplicationGather(DynamicActor))
+			GetGridNodesForActor(DynamicActor, PreviousCellInfo, GatheredNodes);
+			for (UReplicationGraphNode_GridCell* Node : GatheredNodes)
 			{
-				UE_LOG(LogReplicationGraph, Warning, TEXT("UReplicationGraphNode_GridSpatialization2D::PrepareForReplication: Dynamic Actor no longer ready for replication"));
-				UE_LOG(LogReplicationGraph, Warning, TEXT("%s"), *GetNameSafe(DynamicActor));
-				continue;
+				Node->RemoveDynamicActor(ActorInfo);
 			}
-#endif
 
-			// Update location
-			FGlobalActorReplicationInfo& ActorRepInfo = GlobalRepMap->Get(DynamicActor);
+			GetGridNodesForActor(DynamicActor, NewCellInfo, GatheredNodes);
+			for (UReplicationGraphNode_GridCell* Node : GatheredNodes)
+			{
+				Node->AddDynamicActor(ActorInfo);
+			}
+		}
+		else
+		{
+			// Some overlap so lets find out what cells need to be added or removed
 
-			// Check if this resets spatial bias
-			const FVector Location3D = DynamicActor->GetActorLocation();
-			ActorRepInfo.WorldLocation = Location3D;
+			if (PreviousCellInfo.StartX < NewCellInfo.StartX)
+			{
+				// We lost columns on the left side
+				bDirty = true;
 			
-			if (WillActorLocationGrowSpatialBounds(Location3D))
+				for (int32 X = PreviousCellInfo.StartX; X < NewCellInfo.StartX; ++X)
+				{
+					auto& GridX = GetGridX(X);
+					for (int32 Y = PreviousCellInfo.StartY; Y <= PreviousCellInfo.EndY; ++Y)
+					{
+						if (auto& Node = GetCell(GridX, Y))
+						{
+							Node->RemoveDynamicActor(ActorInfo);
+						}
+					}
+				}
+			}
+			else if(PreviousCellInfo.StartX > NewCellInfo.StartX)
 			{
-				HandleActorOutOfSpatialBounds(DynamicActor, Location3D, false);
+				// We added columns on the left side
+				bDirty = true;
+
+				for (int32 X = NewCellInfo.StartX; X < PreviousCellInfo.StartX; ++X)
+				{
+					auto& GridX = GetGridX(X);
+					for (int32 Y = NewCellInfo.StartY; Y <= NewCellInfo.EndY; ++Y)
+					{
+						GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
+					}
+				}
+
 			}
 
-			if (!bNeedsRebuild)
+			if (PreviousCellInfo.EndX < NewCellInfo.EndX)
 			{
-				// Get the new CellInfo
-				const FActorCellInfo NewCellInfo = GetCellInfoForActor(DynamicActor, Location3D, ActorRepInfo.Settings.GetCullDistance());
+				// We added columns on the right side
+				bDirty = true;
 
-				if (PreviousCellInfo.IsValid())
+				for (int32 X = PreviousCellInfo.EndX+1; X <= NewCellInfo.EndX; ++X)
 				{
-					bool bDirty = false;
-
-					if (UNLIKELY(NewCellInfo.StartX > PreviousCellInfo.EndX || NewCellInfo.EndX < PreviousCellInfo.StartX ||
-							NewCellInfo.StartY > PreviousCellInfo.EndY || NewCellInfo.EndY < PreviousCellInfo.StartY))
+					auto& GridX = GetGridX(X);
+					for (int32 Y = NewCellInfo.StartY; Y <= NewCellInfo.EndY; ++Y)
 					{
-						// No longer intersecting, we just have to remove from all previous nodes and add to all new nodes
-						
-						bDirty = true;
+						GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
+					}
+				}
+			
+			}
+			else if(PreviousCellInfo.EndX > NewCellInfo.EndX)
+			{
+				// We lost columns on the right side
+				bDirty = true;
 
-						GetGridNodesForActor(DynamicActor, PreviousCellInfo, GatheredNodes);
-						for (UReplicationGraphNode_GridCell* Node : GatheredNodes)
+				for (int32 X = NewCellInfo.EndX+1; X <= PreviousCellInfo.EndX; ++X)
+				{
+					auto& GridX = GetGridX(X);
+					for (int32 Y = PreviousCellInfo.StartY; Y <= PreviousCellInfo.EndY; ++Y)
+					{
+						if (auto& Node = GetCell(GridX, Y))
 						{
 							Node->RemoveDynamicActor(ActorInfo);
 						}
+					}
+				}
+			}
+
+			// --------------------------------------------------
 
-						GetGridNodesForActor(DynamicActor, NewCellInfo, GatheredNodes);
-						for (UReplicationGraphNode_GridCell* Node : GatheredNodes)
+			// We've handled left/right sides. So while handling top and bottom we only need to worry about this run of X cells
+			const int32 StartX = FMath::Max<int32>(NewCellInfo.StartX, PreviousCellInfo.StartX);
+			const int32 EndX = FMath::Min<int32>(NewCellInfo.EndX, PreviousCellInfo.EndX);
+
+			if (PreviousCellInfo.StartY < NewCellInfo.StartY)
+			{
+				// We lost rows on the top side
+				bDirty = true;
+				
+				for (int32 X = StartX; X <= EndX; ++X)
+				{
+					auto& GridX = GetGridX(X);
+					for (int32 Y = PreviousCellInfo.StartY; Y < NewCellInfo.StartY; ++Y)
+					{
+						if (auto& Node = GetCell(GridX, Y))
 						{
-							Node->AddDynamicActor(ActorInfo);
+							Node->RemoveDynamicActor(ActorInfo);
 						}
 					}
-					else
+				}
+			}
+			else if(PreviousCellInfo.StartY > NewCellInfo.StartY)
+			{
+				// We added rows on the top side
+				bDirty = true;
+				
+				for (int32 X = StartX; X <= EndX; ++X)
+				{
+					auto& GridX = GetGridX(X);
+					for (int32 Y = NewCellInfo.StartY; Y < PreviousCellInfo.StartY; ++Y)
 					{
-						// Some overlap so lets find out what cells need to be added or removed
+						GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
+					}
+				}
+			}
 
-						if (PreviousCellInfo.StartX < NewCellInfo.StartX)
+			if (PreviousCellInfo.EndY < NewCellInfo.EndY)
+			{
+				// We added rows on the bottom side
+				bDirty = true;
+				
+				for (int32 X = StartX; X <= EndX; ++X)
+				{
+					auto& GridX = GetGridX(X);
+					for (int32 Y = PreviousCellInfo.EndY+1; Y <= NewCellInfo.EndY; ++Y)
+					{
+						GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
+					}
+				}
+			}
+			else if (PreviousCellInfo.EndY > NewCellInfo.EndY)
+			{
+				// We lost rows on the bottom side
+				bDirty = true;
+				
+				for (int32 X = StartX; X <= EndX; ++X)
+				{
+					auto& GridX = GetGridX(X);
+					for (int32 Y = NewCellInfo.EndY+1; Y <= PreviousCellInfo.EndY; ++Y)
+					{
+						if (auto& Node = GetCell(GridX, Y))
 						{
-							// We lost columns on the left side
-							bDirty = true;
-						
-							for (int32 X = PreviousCellInfo.StartX; X < NewCellInfo.StartX; ++X)
-							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = PreviousCellInfo.StartY; Y <= PreviousCellInfo.EndY; ++Y)
-								{
-									if (auto& Node = GetCell(GridX, Y))
-									{
-										Node->RemoveDynamicActor(ActorInfo);
-									}
-								}
-							}
+							Node->RemoveDynamicActor(ActorInfo);
 						}
-						else if(PreviousCellInfo.StartX > NewCellInfo.StartX)
-						{
-							// We added columns on the left side
-							bDirty = true;
+					}
+				}
+			}
+		}
 
-							for (int32 X = NewCellInfo.StartX; X < PreviousCellInfo.StartX; ++X)
-							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = NewCellInfo.StartY; Y <= NewCellInfo.EndY; ++Y)
-								{
-									GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
-								}
-							}
+		if (bDirty)
+		{
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+			if (CVar_RepGraph_Spatial_DebugDynamic)
+			{
+				auto CellInfoStr = [](const FActorCellInfo& CellInfo) { return FString::Printf(TEXT("[%d,%d]-[%d,%d]"), CellInfo.StartX, CellInfo.StartY, CellInfo.EndX, CellInfo.EndY); };
+				UE_LOG(LogReplicationGraph, Display, TEXT("%s moved cells. From %s to %s"), *GetActorRepListTypeDebugString(DynamicActor), *CellInfoStr(PreviousCellInfo), *CellInfoStr(NewCellInfo));
 
-						}
+				const int32 MinX = FMath::Min<int32>(PreviousCellInfo.StartX, NewCellInfo.StartX);
+				const int32 MinY = FMath::Min<int32>(PreviousCellInfo.StartY, NewCellInfo.StartY);
+				const int32 MaxX = FMath::Max<int32>(PreviousCellInfo.EndX, NewCellInfo.EndX);
+				const int32 MaxY = FMath::Max<int32>(PreviousCellInfo.EndY, NewCellInfo.EndY);
 
-						if (PreviousCellInfo.EndX < NewCellInfo.EndX)
-						{
-							// We added columns on the right side
-							bDirty = true;
+				
+				for (int32 Y = MinY; Y <= MaxY; ++Y)
+				{
+					FString Str = FString::Printf(TEXT("[%d]   "), Y);
+					for (int32 X = MinX; X <= MaxX; ++X)
+					{
+						const bool bShouldBeInOld = (X >= PreviousCellInfo.StartX && X <= PreviousCellInfo.EndX) && (Y >= PreviousCellInfo.StartY && Y <= PreviousCellInfo.EndY);
+						const bool bShouldBeInNew = (X >= NewCellInfo.StartX && X <= NewCellInfo.EndX) && (Y >= NewCellInfo.StartY && Y <= NewCellInfo.EndY);
 
-							for (int32 X = PreviousCellInfo.EndX+1; X <= NewCellInfo.EndX; ++X)
-							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = NewCellInfo.StartY; Y <= NewCellInfo.EndY; ++Y)
-								{
-									GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
-								}
-							}
-						
-						}
-						else if(PreviousCellInfo.EndX > NewCellInfo.EndX)
+						bool bInCell = false;
+						if (auto& Node = GetCell(GetGridX(X),Y))
 						{
-							// We lost columns on the right side
-							bDirty = true;
-
-							for (int32 X = NewCellInfo.EndX+1; X <= PreviousCellInfo.EndX; ++X)
+							TArray<FActorRepListType> ActorsInCell;
+							Node->GetAllActorsInNode_Debugging(ActorsInCell);
+							for (auto ActorInCell : ActorsInCell)
 							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = PreviousCellInfo.StartY; Y <= PreviousCellInfo.EndY; ++Y)
+								if (ActorInCell == DynamicActor)
 								{
-									if (auto& Node = GetCell(GridX, Y))
+									if (bInCell)
 									{
-										Node->RemoveDynamicActor(ActorInfo);
+										UE_LOG(LogReplicationGraph, Warning, TEXT("  Actor is in cell multiple times! [%d, %d]"), X, Y);
 									}
+									bInCell = true;
 								}
 							}
 						}
 
-						// --------------------------------------------------
-
-						// We've handled left/right sides. So while handling top and bottom we only need to worry about this run of X cells
-						const int32 StartX = FMath::Max<int32>(NewCellInfo.StartX, PreviousCellInfo.StartX);
-						const int32 EndX = FMath::Min<int32>(NewCellInfo.EndX, PreviousCellInfo.EndX);
-
-						if (PreviousCellInfo.StartY < NewCellInfo.StartY)
+						if (bShouldBeInOld && bShouldBeInNew && bInCell)
 						{
-							// We lost rows on the top side
-							bDirty = true;
-							
-							for (int32 X = StartX; X <= EndX; ++X)
-							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = PreviousCellInfo.StartY; Y < NewCellInfo.StartY; ++Y)
-								{
-									if (auto& Node = GetCell(GridX, Y))
-									{
-										Node->RemoveDynamicActor(ActorInfo);
-									}
-								}
-							}
+							// All good, didn't move
+							Str += "* ";
 						}
-						else if(PreviousCellInfo.StartY > NewCellInfo.StartY)
+						else if (!bShouldBeInOld && bShouldBeInNew && bInCell)
 						{
-							// We added rows on the top side
-							bDirty = true;
-							
-							for (int32 X = StartX; X <= EndX; ++X)
-							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = NewCellInfo.StartY; Y < PreviousCellInfo.StartY; ++Y)
-								{
-									GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
-								}
-							}
+							// All good, add
+							Str += "+ ";
 						}
-
-						if (PreviousCellInfo.EndY < NewCellInfo.EndY)
+						else if (bShouldBeInOld && !bShouldBeInNew && !bInCell)
 						{
-							// We added rows on the bottom side
-							bDirty = true;
-							
-							for (int32 X = StartX; X <= EndX; ++X)
-							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = PreviousCellInfo.EndY+1; Y <= NewCellInfo.EndY; ++Y)
-								{
-									GetCellNode(GetCell(GridX,Y))->AddDynamicActor(ActorInfo);
-								}
-							}
+							// All good, removed
+							Str += "- ";
 						}
-						else if (PreviousCellInfo.EndY > NewCellInfo.EndY)
+						else if (!bShouldBeInOld && !bShouldBeInNew && !bInCell)
 						{
-							// We lost rows on the bottom side
-							bDirty = true;
-							
-							for (int32 X = StartX; X <= EndX; ++X)
-							{
-								auto& GridX = GetGridX(X);
-								for (int32 Y = NewCellInfo.EndY+1; Y <= PreviousCellInfo.EndY; ++Y)
-								{
-									if (auto& Node = GetCell(GridX, Y))
-									{
-										Node->RemoveDynamicActor(ActorInfo);
-									}
-								}
-							}
+							// nada
+							Str += "  ";
+						}
+						else
+						{
+							UE_LOG(LogReplicationGraph, Warning, TEXT("  Bad update! Cell [%d,%d]. ShouldBeInOld: %d. ShouldBeInNew: %d. IsInCell: %d"), X, Y, bShouldBeInOld, bShouldBeInNew, bInCell);
+							Str += "! ";
 						}
 					}
 
-					if (bDirty)
-					{
+					UE_LOG(LogReplicationGraph, Display, TEXT("%s"), *Str);
+				}
+			}
+#endif
+
+			PreviousCellInfo = NewCellInfo;
+		}
+	}
+	else
+	{
+		// First time - Just add
+		GetGridNodesForActor(DynamicActor, NewCellInfo, GatheredNodes);
+		for (UReplicationGraphNode_GridCell* Node : GatheredNodes)
+		{
+			Node->AddDynamicActor(ActorInfo);
+		}
+
+		PreviousCellInfo = NewCellInfo;
+	}
+}
+
+void UReplicationGraphNode_GridSpatialization2D::UpdateDynamicActors_Batched(FGlobalActorReplicationInfoMap* GlobalRepMap)
+{
+	FDynamicActorBatch& Batch = DynamicActorBatch;
+	Batch.Reset(DynamicSpatializedActors.Num());
+
+	// Refresh world locations and pack the inputs of the cell calculation into contiguous arrays
+	{
+		RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_GridSpatialization2D_BatchGather);
+
+		for (auto& MapIt : DynamicSpatializedActors)
+		{
+			FActorRepListType& DynamicActor = MapIt.Key;
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-						if (CVar_RepGraph_Spatial_DebugDynamic)
-						{
-							auto CellInfoStr = [](const FActorCellInfo& CellInfo) { return FString::Printf(TEXT("[%d,%d]-[%d,%d]"), CellInfo.StartX, CellInfo.StartY, CellInfo.EndX, CellInfo.EndY); };
-							UE_LOG(LogReplicationGraph, Display, TEXT("%s moved cells. From %s to %s"), *GetActorRepListTypeDebugString(DynamicActor), *CellInfoStr(PreviousCellInfo), *CellInfoStr(NewCellInfo));
+			if (!IsActorValidForReplicationGather(DynamicActor))
+			{
+				UE_LOG(LogReplicationGraph, Warning, TEXT("UReplicationGraphNode_GridSpatialization2D::PrepareForReplication: Dynamic Actor no longer ready for replication"));
+				UE_LOG(LogReplicationGraph, Warning, TEXT("%s"), *GetNameSafe(DynamicActor));
+				continue;
+			}
+#endif
 
-							const int32 MinX = FMath::Min<int32>(PreviousCellInfo.StartX, NewCellInfo.StartX);
-							const int32 MinY = FMath::Min<int32>(PreviousCellInfo.StartY, NewCellInfo.StartY);
-							const int32 MaxX = FMath::Max<int32>(PreviousCellInfo.EndX, NewCellInfo.EndX);
-							const int32 MaxY = FMath::Max<int32>(PreviousCellInfo.EndY, NewCellInfo.EndY);
+			FGlobalActorReplicationInfo& ActorRepInfo = GlobalRepMap->Get(DynamicActor);
 
-							
-							for (int32 Y = MinY; Y <= MaxY; ++Y)
-							{
-								FString Str = FString::Printf(TEXT("[%d]   "), Y);
-								for (int32 X = MinX; X <= MaxX; ++X)
-								{
-									const bool bShouldBeInOld = (X >= PreviousCellInfo.StartX && X <= PreviousCellInfo.EndX) && (Y >= PreviousCellInfo.StartY && Y <= PreviousCellInfo.EndY);
-									const bool bShouldBeInNew = (X >= NewCellInfo.StartX && X <= NewCellInfo.EndX) && (Y >= NewCellInfo.StartY && Y <= NewCellInfo.EndY);
+			const FVector Location3D = DynamicActor->GetActorLocation();
+			ActorRepInfo.WorldLocation = Location3D;
 
-									bool bInCell = false;
-									if (auto& Node = GetCell(GetGridX(X),Y))
-									{
-										TArray<FActorRepListType> ActorsInCell;
-										Node->GetAllActorsInNode_Debugging(ActorsInCell);
-										for (auto ActorInCell : ActorsInCell)
-										{
-											if (ActorInCell == DynamicActor)
-											{
-												if (bInCell)
-												{
-													UE_LOG(LogReplicationGraph, Warning, TEXT("  Actor is in cell multiple times! [%d, %d]"), X, Y);
-												}
-												bInCell = true;
-											}
-										}
-									}
+			if (WillActorLocationGrowSpatialBounds(Location3D))
+			{
+				HandleActorOutOfSpatialBounds(DynamicActor, Location3D, false);
+			}
 
-									if (bShouldBeInOld && bShouldBeInNew && bInCell)
-									{
-										// All good, didn't move
-										Str += "* ";
-									}
-									else if (!bShouldBeInOld && bShouldBeInNew && bInCell)
-									{
-										// All good, add
-										Str += "+ ";
-									}
-									else if (bShouldBeInOld && !bShouldBeInNew && !bInCell)
-									{
-										// All good, removed
-										Str += "- ";
-									}
-									else if (!bShouldBeInOld && !bShouldBeInNew && !bInCell)
-									{
-										// nada
-										Str += "  ";
-									}
-									else
-									{
-										UE_LOG(LogReplicationGraph, Warning, TEXT("  Bad update! Cell [%d,%d]. ShouldBeInOld: %d. ShouldBeInNew: %d. IsInCell: %d"), X, Y, bShouldBeInOld, bShouldBeInNew, bInCell);
-										Str += "! ";
-									}
-								}
+			// Once a rebuild is queued every dynamic actor is re-added from scratch, so only the locations need refreshing
+			if (bNeedsRebuild)
+			{
+				continue;
+			}
 
-								UE_LOG(LogReplicationGraph, Display, TEXT("%s"), *Str);
-							}
-						}
+			const float CullDistance = ActorRepInfo.Settings.GetCullDistance();
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+			if (CullDistance <= 0.f)
+			{
+				UE_LOG(LogReplicationGraph, Warning, TEXT("::GetGridNodesForActor called on %s when its CullDistance = %.2f. (Must be > 0)"), *GetActorRepListTypeDebugString(DynamicActor), CullDistance);
+			}
 #endif
 
-						PreviousCellInfo = NewCellInfo;
-					}
+			FVector ClampedLocation = Location3D;
+			if (Location3D.X < -HALF_WORLD_MAX || Location3D.X > HALF_WORLD_MAX ||
+				Location3D.Y < -HALF_WORLD_MAX || Location3D.Y > HALF_WORLD_MAX ||
+				Location3D.Z < -HALF_WORLD_MAX || Location3D.Z > HALF_WORLD_MAX)
+			{
+				UE_LOG(LogReplicationGraph, Warning, TEXT("GetCellInfoForActor: Actor %s is outside world bounds with a location of %s. Clamping grid location to world bounds."), *GetFullNameSafe(DynamicActor), *Location3D.ToString());
+				ClampedLocation = Location3D.BoundToCube(HALF_WORLD_MAX);
+			}
+
+			Batch.Actors.Add(DynamicActor);
+			Batch.CachedInfos.Add(&MapIt.Value);
+			Batch.LocationX.Add(ClampedLocation.X);
+			Batch.LocationY.Add(ClampedLocation.Y);
+			Batch.CullDistance.Add(CullDistance);
+		}
+	}
+
+	if (bNeedsRebuild)
+	{
+		return;
+	}
+
+	const int32 NumActors = Batch.Actors.Num();
+
+	// Compute the cell rects four actors at a time. This mirrors GetCellInfoForActor exactly: truncating float->int conversion, clamped to zero.
+	{
+		RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_GridSpatialization2D_BatchCellInfo);
+
+		// Pad the inputs so the last iteration can do a full load/store
+		const int32 NumPadded = Align(NumActors, 4);
+		Batch.LocationX.SetNumZeroed(NumPadded);
+		Batch.LocationY.SetNumZeroed(NumPadded);
+		Batch.CullDistance.SetNumZeroed(NumPadded);
+		Batch.StartX.SetNumUninitialized(NumPadded);
+		Batch.StartY.SetNumUninitialized(NumPadded);
+		Batch.EndX.SetNumUninitialized(NumPadded);
+		Batch.EndY.SetNumUninitialized(NumPadded);
+
+		const FVector BoundSize = GridBounds.IsValid ? GridBounds.GetSize() : FVector(MAX_flt);
+
+		const VectorRegister VecZero = VectorZero();
+		const VectorRegister VecBiasX = VectorSetFloat1(SpatialBias.X);
+		const VectorRegister VecBiasY = VectorSetFloat1(SpatialBias.Y);
+		const VectorRegister VecBoundX = VectorSetFloat1(BoundSize.X);
+		const VectorRegister VecBoundY = VectorSetFloat1(BoundSize.Y);
+		const VectorRegister VecCellSize = VectorSetFloat1(CellSize);
+
+		for (int32 Idx = 0; Idx < NumPadded; Idx += 4)
+		{
+			const VectorRegister LocationBiasX = VectorSubtract(VectorLoad(&Batch.LocationX[Idx]), VecBiasX);
+			const VectorRegister LocationBiasY = VectorSubtract(VectorLoad(&Batch.LocationY[Idx]), VecBiasY);
+			const VectorRegister Dist = VectorLoad(&Batch.CullDistance[Idx]);
+
+			const VectorRegister MinX = VectorSubtract(LocationBiasX, Dist);
+			const VectorRegister MinY = VectorSubtract(LocationBiasY, Dist);
+			const VectorRegister MaxX = VectorMin(VectorAdd(LocationBiasX, Dist), VecBoundX);
+			const VectorRegister MaxY = VectorMin(VectorAdd(LocationBiasY, Dist), VecBoundY);
+
+			// Clamping to zero before the truncation gives the same result as FMath::Max<int32>(0, Value) after it
+			VectorIntStore(VectorFloatToInt(VectorMax(VecZero, VectorDivide(MinX, VecCellSize))), &Batch.StartX[Idx]);
+			VectorIntStore(VectorFloatToInt(VectorMax(VecZero, VectorDivide(MinY, VecCellSize))), &Batch.StartY[Idx]);
+			VectorIntStore(VectorFloatToInt(VectorMax(VecZero, VectorDivide(MaxX, VecCellSize))), &Batch.EndX[Idx]);
+			VectorIntStore(VectorFloatToInt(VectorMax(VecZero, VectorDivide(MaxY, VecCellSize))), &Batch.EndY[Idx]);
+		}
+	}
+
+	// Apply the cell changes. Actors whose cells did not change do no list work in UpdateDynamicActorCells.
+	for (int32 Idx = 0; Idx < NumActors; ++Idx)
+	{
+		FActorCellInfo NewCellInfo;
+		NewCellInfo.StartX = Batch.StartX[Idx];
+		NewCellInfo.StartY = Batch.StartY[Idx];
+		NewCellInfo.EndX = Batch.EndX[Idx];
+		NewCellInfo.EndY = Batch.EndY[Idx];
+
+		UpdateDynamicActorCells(Batch.Actors[Idx], *Batch.CachedInfos[Idx], NewCellInfo);
+	}
+}
+
+void UReplicationGraphNode_GridSpatialization2D::PrepareForReplication()
+{
+	RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_GridSpatialization2D_PrepareForReplication);
+
+	FGlobalActorReplicationInfoMap* GlobalRepMap = GraphGlobals.IsValid() ? GraphGlobals->GlobalActorReplicationInfoMap : nullptr;
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	if (CVar_RepGraph_Spatial_BiasCreep != 0.f)
+	{
+		SpatialBias.X += CVar_RepGraph_Spatial_BiasCreep;
+		SpatialBias.Y += CVar_RepGraph_Spatial_BiasCreep;
+		bNeedsRebuild = true;
+	}
+
+	// -------------------------------------------
+	//	Update dynamic actors
+	// -------------------------------------------
+	if (CVar_RepGraph_Spatial_PauseDynamic == 0)
+#endif
+	{
+		RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_GridSpatialization2D_BuildDynamic);
+
+		if (CVar_RepGraph_Spatial_BatchedDynamicCellInfo > 0)
+		{
+			UpdateDynamicActors_Batched(GlobalRepMap);
+		}
+		else
+		{
+			for (auto& MapIt : DynamicSpatializedActors)
+			{
+				FActorRepListType& DynamicActor = MapIt.Key;
+				FCachedDynamicActorInfo& DynamicActorInfo = MapIt.Value;
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+				if (!IsActorValidForReplicationGather(DynamicActor))
+				{
+					UE_LOG(LogReplicationGraph, Warning, TEXT("UReplicationGraphNode_GridSpatialization2D::PrepareForReplication: Dynamic Actor no longer ready for replication"));
+					UE_LOG(LogReplicationGraph, Warning, TEXT("%s"), *GetNameSafe(DynamicActor));
+					continue;
+				}
+#endif
+
+				// Update location
+				FGlobalActorReplicationInfo& ActorRepInfo = GlobalRepMap->Get(DynamicActor);
+
+				// Check if this resets spatial bias
+				const FVector Location3D = DynamicActor->GetActorLocation();
+				ActorRepInfo.WorldLocation = Location3D;
+				
+				if (WillActorLocationGrowSpatialBounds(Location3D))
+				{
+					HandleActorOutOfSpatialBounds(DynamicActor, Location3D, false);
 				}
-				else
+
+				if (!bNeedsRebuild)
 				{
-					// First time - Just add
-					GetGridNodesForActor(DynamicActor, NewCellInfo, GatheredNodes);
-					for (UReplicationGraphNode_GridCell* Node : GatheredNodes)
-					{
-						Node->AddDynamicActor(ActorInfo);
-					}
+					// Get the new CellInfo
+					const FActorCellInfo NewCellInfo = GetCellInfoForActor(DynamicActor, Location3D, ActorRepInfo.Settings.GetCullDistance());
 
-					PreviousCellInfo = NewCellInfo;
+					UpdateDynamicActorCells(DynamicActor, DynamicActorInfo, NewCellInfo);
 				}
 			}
 		}
@@ -5350,16 +5617,29 @@ void UReplicationGraphNode_GridSpatialization2D::GatherActorListsForConnection(c
 		// If we have not operated on this cell yet (meaning it's not shared by anyone else), gather for it.
 		if (!UniqueCurrentLocations.Contains(NewPlayerCell.CurLocation))
 		{
-			TArray<UReplicationGraphNode_GridCell*>& GridX = GetGridX(CellX);
-			if (GridX.Num() <= CellY)
+			UReplicationGraphNode_GridCell* CellNode = nullptr;
+			if (Params.IsParallelGather())
 			{
-				GridX.SetNum(CellY + 1);
+				// Other connections may be reading the grid, so don't grow it. Cells outside of it can't have a node anyway.
+				if (Grid.IsValidIndex(CellX) && Grid[CellX].IsValidIndex(CellY))
+				{
+					CellNode = Grid[CellX][CellY];
+				}
+			}
+			else
+			{
+				TArray<UReplicationGraphNode_GridCell*>& GridX = GetGridX(CellX);
+				if (GridX.Num() <= CellY)
+				{
+					GridX.SetNum(CellY + 1);
+				}
+
+				CellNode = GridX[CellY];
 			}
 
-			UReplicationGraphNode_GridCell* CellNode = GridX[CellY];
 			if (CellNode)
 			{
-				CellNode->GatherActorListsForConnection(Params);
+				ConditionalGatherActorListsForConnection(CellNode, Params);
 			}
 
 			UniqueCurrentLocations.Add(NewPlayerCell.CurLocation);
@@ -5453,6 +5733,12 @@ void UReplicationGraphNode_GridSpatialization2D::GatherActorListsForConnection(c
 	}
 }
 
+bool UReplicationGraphNode_GridSpatialization2D::SupportsParallelGather() const
+{
+	// Dormant dynamic actor destruction reuses GatheredNodes and may grow the grid, neither is safe across connections
+	return !(bDestroyDormantDynamicActors && CVar_RepGraph_DormantDynamicActorsDestruction > 0);
+}
+
 void UReplicationGraphNode_GridSpatialization2D::NotifyActorCullDistChange(AActor* Actor, FGlobalActorReplicationInfo& GlobalInfo, float OldDist)
 {
 	RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_GridSpatialization2D_NotifyActorCullDistChange);
@@ -5575,7 +5861,7 @@ void UReplicationGraphNode_AlwaysRelevant::AddAlwaysRelevantClass(UClass* Class)
 
 void UReplicationGraphNode_AlwaysRelevant::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
 {
-	ChildNode->GatherActorListsForConnection(Params);
+	ConditionalGatherActorListsForConnection(ChildNode, Params);
 }
 
 // -------------------------------------------------------
@@ -92,6 +92,16 @@ public:
 	
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) PURE_VIRTUAL(UReplicationGraphNode::GatherActorListsForConnection, );
 
+	/**
+	 * Whether GatherActorListsForConnection may run on a worker thread while other connections gather from this node (see Net.RepGraph.ParallelGather).
+	 * Nodes returning true must only read shared graph state when gathering; per connection state (like the connection's ActorInfoMap) may be modified.
+	 * Child nodes should be gathered through ConditionalGatherActorListsForConnection so they are deferred to the game thread if they don't support this.
+	 */
+	virtual bool SupportsParallelGather() const { return false; }
+
+	/** Gathers from Node right away, or defers it to the game thread if this is a parallel gather and Node doesn't support it. */
+	static void ConditionalGatherActorListsForConnection(UReplicationGraphNode* Node, const FConnectionGatherActorListParameters& Params);
+
 	/** Called once per frame prior to replication ONLY on root nodes (nodes created via UReplicationGraph::CreateNode) has RequiresPrepareForReplicationCall=true */
 	virtual void PrepareForReplication() { };
 
@@ -208,6 +218,7 @@ public:
 	virtual void NotifyResetAllNetworkActors() override;
 	
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual bool SupportsParallelGather() const override { return true; }
 
 	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
 
@@ -282,6 +293,7 @@ public:
 	virtual void NotifyResetAllNetworkActors() override;
 	
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual bool SupportsParallelGather() const override { return true; }
 
 	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
 
@@ -323,6 +335,9 @@ public:
 	
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
 
+	/** This node replicates actors while gathering, so it always gathers on the game thread. */
+	virtual bool SupportsParallelGather() const override { return false; }
+
 	// --------------------------------------------------------
 
 	struct FSpatializationZone
@@ -575,6 +590,7 @@ public:
 	virtual void NotifyResetAllNetworkActors() override;
 	virtual void PrepareForReplication() override;
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual bool SupportsParallelGather() const override;
 
 	void AddActor_Static(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& ActorRepInfo) { AddActorInternal_Static(ActorInfo, ActorRepInfo, false); }
 	void AddActor_Dynamic(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& ActorRepInfo) { AddActorInternal_Dynamic(ActorInfo); }
@@ -731,6 +747,36 @@ private:
 	// This is a reused TArray for gathering actor nodes. Just to prevent using a stack based TArray everywhere or static/reset patten.
 	TArray<UReplicationGraphNode_GridCell*> GatheredNodes;
 
+	/** Moves a dynamic actor from its previous cells to the cells in NewCellInfo */
+	void UpdateDynamicActorCells(FActorRepListType DynamicActor, FCachedDynamicActorInfo& DynamicActorInfo, const FActorCellInfo& NewCellInfo);
+
+	/** Per frame dynamic actor update used when Net.RepGraph.Spatial.BatchedDynamicCellInfo is enabled */
+	void UpdateDynamicActors_Batched(FGlobalActorReplicationInfoMap* GlobalRepMap);
+
+	/** Structure of arrays scratch data for UpdateDynamicActors_Batched. Kept as a member so the allocations are reused every frame. */
+	struct FDynamicActorBatch
+	{
+		TArray<FActorRepListType> Actors;
+		TArray<FCachedDynamicActorInfo*> CachedInfos;
+		TArray<float> LocationX;
+		TArray<float> LocationY;
+		TArray<float> CullDistance;
+		TArray<int32> StartX;
+		TArray<int32> StartY;
+		TArray<int32> EndX;
+		TArray<int32> EndY;
+
+		void Reset(int32 NumExpected)
+		{
+			Actors.Reset(NumExpected);
+			CachedInfos.Reset(NumExpected);
+			LocationX.Reset(NumExpected);
+			LocationY.Reset(NumExpected);
+			CullDistance.Reset(NumExpected);
+		}
+	};
+	FDynamicActorBatch DynamicActorBatch;
+
 	friend class AReplicationGraphDebugActor;
 };
 
@@ -751,6 +797,7 @@ public:
 	virtual void NotifyResetAllNetworkActors() override { }
 	virtual void PrepareForReplication() override;
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual bool SupportsParallelGather() const override { return true; }
 
 	void AddAlwaysRelevantClass(UClass* Class);
 
@@ -795,6 +842,9 @@ public:
 	
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
 
+	/** Updates cull distances of the viewer's actors, which can add entries to the global actor info map. */
+	virtual bool SupportsParallelGather() const override { return false; }
+
 	virtual void TearDown() override;
 
 	/** Rebuilt-every-frame list based on UNetConnection state */
@@ -840,6 +890,7 @@ public:
 	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound=true) override { return false; }
 	virtual void NotifyResetAllNetworkActors() override { TearOffActors.Reset(); }
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual bool SupportsParallelGather() const override { return true; }
 	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
 
 	void NotifyTearOffActor(AActor* Actor, uint32 FrameNum);
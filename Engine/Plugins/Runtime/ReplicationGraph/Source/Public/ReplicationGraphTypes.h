@@ -19,6 +19,7 @@ class AController;
 class UNetConnection;
 class UNetReplicationGraphConnection;
 class UReplicationGraph;
+class UReplicationGraphNode;
 
 struct FActorDestructionInfo;
 
@@ -1288,6 +1289,17 @@ struct FConnectionGatherActorListParameters
 	/** Out: The data nodes are going to add to */
 	FGatheredReplicationActorLists& OutGatheredReplicationLists;
 
+	/**
+	 * Only set while gathering off the game thread (see Net.RepGraph.ParallelGather).
+	 * Nodes that can't gather in parallel are added here and gathered again on the game thread once the parallel phase is done.
+	 */
+	TArray<UReplicationGraphNode*>* DeferredGatherNodes = nullptr;
+
+	bool IsParallelGather() const
+	{
+		return DeferredGatherNodes != nullptr;
+	}
+
 	bool CheckClientVisibilityForLevel(const FName& StreamingLevelName) const
 	{
 		if (StreamingLevelName == LastCheckedVisibleLevelName)
@@ -6,6 +6,9 @@
 #include "GameFramework/HUD.h"
 #include "Engine/Engine.h"
 #include "Async/ParallelFor.h"
+#include "Algo/IsSorted.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
 #if ALLOW_CONSOLE
 #include "Engine/Console.h"
 #include "ConsoleSettings.h"
@@ -22,8 +25,56 @@ DECLARE_CYCLE_STAT(TEXT("Register Object"), STAT_SignificanceManager_RegisterObj
 DECLARE_CYCLE_STAT(TEXT("Initial Significance Update"), STAT_SignificanceManager_InitialSignificanceUpdate, STATGROUP_SignificanceManager);
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num Managed Objects"), STAT_SignificanceManager_NumObjects, STATGROUP_SignificanceManager);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Skipped Significance Updates"), STAT_SignificanceManager_NumSkippedUpdates, STATGROUP_SignificanceManager);
+
 DEFINE_LOG_CATEGORY(LogSignificance);
 
+static int32 GSignificanceManagerIncrementalUpdate = 0;
+static FAutoConsoleVariableRef CVarSignificanceManagerIncrementalUpdate(
+	TEXT("SigMan.IncrementalUpdate"),
+	GSignificanceManagerIncrementalUpdate,
+	TEXT("If non-zero, actors and scene components that have not moved since their significance was last calculated keep their significance,\n")
+	TEXT("as long as no viewpoint has moved by more than SigMan.IncrementalUpdate.Distance / turned by more than SigMan.IncrementalUpdate.Angle since the last full update.\n")
+	TEXT("Only suitable for games whose significance functions depend on object and viewpoint transforms.\n")
+	);
+
+static float GSignificanceManagerIncrementalUpdateDistance = 50.f;
+static FAutoConsoleVariableRef CVarSignificanceManagerIncrementalUpdateDistance(
+	TEXT("SigMan.IncrementalUpdate.Distance"),
+	GSignificanceManagerIncrementalUpdateDistance,
+	TEXT("Distance an object or viewpoint has to move before significance is recalculated when SigMan.IncrementalUpdate is enabled.\n")
+	);
+
+static float GSignificanceManagerIncrementalUpdateAngle = 5.f;
+static FAutoConsoleVariableRef CVarSignificanceManagerIncrementalUpdateAngle(
+	TEXT("SigMan.IncrementalUpdate.Angle"),
+	GSignificanceManagerIncrementalUpdateAngle,
+	TEXT("Angle in degrees a viewpoint has to turn before all significance is recalculated when SigMan.IncrementalUpdate is enabled.\n")
+	);
+
+static int32 GSignificanceManagerIncrementalUpdateMaxSkipped = 10;
+static FAutoConsoleVariableRef CVarSignificanceManagerIncrementalUpdateMaxSkipped(
+	TEXT("SigMan.IncrementalUpdate.MaxSkipped"),
+	GSignificanceManagerIncrementalUpdateMaxSkipped,
+	TEXT("Maximum number of consecutive updates an object's significance calculation can be skipped for when SigMan.IncrementalUpdate is enabled.\n")
+	);
+
+// Returns the location of actors and scene components. Other objects have no location and are always updated.
+static bool GetManagedObjectLocation(const UObject* Object, FVector& OutLocation)
+{
+	if (const AActor* Actor = Cast<AActor>(Object))
+	{
+		OutLocation = Actor->GetActorLocation();
+		return true;
+	}
+	else if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Object))
+	{
+		OutLocation = SceneComponent->GetComponentLocation();
+		return true;
+	}
+	return false;
+}
+
 bool CompareBySignificanceAscending(const USignificanceManager::FManagedObjectInfo& A, const USignificanceManager::FManagedObjectInfo& B) 
 { 
 	return A.GetSignificance() < B.GetSignificance(); 
@@ -392,6 +443,25 @@ void USignificanceManager::FManagedObjectInfo::UpdateSignificance(const TArray<F
 	}
 }
 
+bool USignificanceManager::FManagedObjectInfo::CanSkipSignificanceUpdate()
+{
+	FVector Location;
+	if (!GetManagedObjectLocation(Object, Location))
+	{
+		return false;
+	}
+
+	if (NumSkippedUpdates < FMath::Min(GSignificanceManagerIncrementalUpdateMaxSkipped, MAX_uint8 - 1) && FVector::DistSquared(Location, LastUpdateLocation) <= FMath::Square(GSignificanceManagerIncrementalUpdateDistance))
+	{
+		++NumSkippedUpdates;
+		return true;
+	}
+
+	LastUpdateLocation = Location;
+	NumSkippedUpdates = 0;
+	return false;
+}
+
 void USignificanceManager::Update(TArrayView<const FTransform> InViewpoints)
 {
 	Viewpoints.Reset(InViewpoints.Num());
@@ -399,6 +469,26 @@ void USignificanceManager::Update(TArrayView<const FTransform> InViewpoints)
 
 	SCOPE_CYCLE_COUNTER(STAT_SignificanceManager_Update);
 
+	// Incremental updates are only valid while the viewpoints stay close to where they were at the last full update
+	bool bIncrementalUpdate = GSignificanceManagerIncrementalUpdate != 0 && Viewpoints.Num() > 0 && FullUpdateViewpoints.Num() == Viewpoints.Num();
+	if (bIncrementalUpdate)
+	{
+		const float MaxDistSquared = FMath::Square(GSignificanceManagerIncrementalUpdateDistance);
+		const float MinCosAngle = FMath::Cos(FMath::DegreesToRadians(GSignificanceManagerIncrementalUpdateAngle));
+		for (int32 Index = 0; Index < Viewpoints.Num() && bIncrementalUpdate; ++Index)
+		{
+			const FTransform& Viewpoint = Viewpoints[Index];
+			const FTransform& FullUpdateViewpoint = FullUpdateViewpoints[Index];
+			bIncrementalUpdate = FVector::DistSquared(Viewpoint.GetLocation(), FullUpdateViewpoint.GetLocation()) <= MaxDistSquared
+				&& (Viewpoint.GetUnitAxis(EAxis::X) | FullUpdateViewpoint.GetUnitAxis(EAxis::X)) >= MinCosAngle;
+		}
+	}
+
+	if (!bIncrementalUpdate)
+	{
+		FullUpdateViewpoints = Viewpoints;
+	}
+
 	{
 		SCOPE_CYCLE_COUNTER(STAT_SignificanceManager_SignificanceUpdate);
 
@@ -424,9 +514,42 @@ void USignificanceManager::Update(TArrayView<const FTransform> InViewpoints)
 
 			checkSlow(ObjectInfo->GetObject()->IsValidLowLevel());
 
+			if (bIncrementalUpdate)
+			{
+				if (ObjectInfo->CanSkipSignificanceUpdate())
+				{
+					if (ObjectInfo->PostSignificanceType == EPostSignificanceType::Concurrent)
+					{
+						ObjectInfo->PostSignificanceFunction(ObjectInfo, ObjectInfo->Significance, ObjectInfo->Significance, false);
+					}
+					return;
+				}
+			}
+			else
+			{
+				ObjectInfo->NumSkippedUpdates = 0;
+				GetManagedObjectLocation(ObjectInfo->GetObject(), ObjectInfo->LastUpdateLocation);
+			}
+
 			ObjectInfo->UpdateSignificance(Viewpoints,bSortSignificanceAscending);
 		});
 
+#if STATS
+		if (bIncrementalUpdate)
+		{
+			int32 NumSkippedUpdates = 0;
+			for (const FManagedObjectInfo* ObjectInfo : ObjArray)
+			{
+				NumSkippedUpdates += (ObjectInfo->NumSkippedUpdates > 0 ? 1 : 0);
+			}
+			SET_DWORD_STAT(STAT_SignificanceManager_NumSkippedUpdates, NumSkippedUpdates);
+		}
+		else
+		{
+			SET_DWORD_STAT(STAT_SignificanceManager_NumSkippedUpdates, 0);
+		}
+#endif
+
 		for (const FSequentialPostWorkPair& SequentialPostWorkPair : ObjWithSequentialPostWork)
 		{
 			FManagedObjectInfo* ObjectInfo = SequentialPostWorkPair.ObjectInfo; 
@@ -439,9 +562,15 @@ void USignificanceManager::Update(TArrayView<const FTransform> InViewpoints)
 
 	{
 		SCOPE_CYCLE_COUNTER(STAT_SignificanceManager_SignificanceSort);
+		auto CompareFunction = PickCompareBySignificance(bSortSignificanceAscending);
+		auto ComparePointers = [&CompareFunction](const FManagedObjectInfo* A, const FManagedObjectInfo* B) { return CompareFunction(*A, *B); };
 		for (TPair<FName, TArray<FManagedObjectInfo*>>& TagToObjectInfoArrayPair : ManagedObjectsByTag)
 		{
-			TagToObjectInfoArrayPair.Value.StableSort(PickCompareBySignificance(bSortSignificanceAscending));
+			// Significance of most objects is often unchanged (e.g. during incremental updates), so avoid re-sorting tags that are still in order
+			if (!Algo::IsSorted(TagToObjectInfoArrayPair.Value, ComparePointers))
+			{
+				TagToObjectInfoArrayPair.Value.StableSort(CompareFunction);
+			}
 		}
 	}
 }
@@ -104,6 +104,8 @@ public:
 			: Object(nullptr)
 			, Significance(-1.0f)
 			, PostSignificanceType(EPostSignificanceType::None)
+			, LastUpdateLocation(FVector::ZeroVector)
+			, NumSkippedUpdates(MAX_uint8)
 		{
 		}
 
@@ -114,6 +116,8 @@ public:
 			, PostSignificanceType(InPostSignificanceType)
 			, SignificanceFunction(MoveTemp(InSignificanceFunction))
 			, PostSignificanceFunction(MoveTemp(InPostSignificanceFunction))
+			, LastUpdateLocation(FVector::ZeroVector)
+			, NumSkippedUpdates(MAX_uint8)
 		{
 			if (PostSignificanceFunction)
 			{
@@ -144,8 +148,17 @@ public:
 		FManagedObjectSignificanceFunction SignificanceFunction;
 		FManagedObjectPostSignificanceFunction PostSignificanceFunction;
 
+		// Location of the object when its significance was last calculated, used by incremental updates
+		FVector LastUpdateLocation;
+
+		// Number of incremental updates that have skipped calculating significance for this object since it was last calculated
+		uint8 NumSkippedUpdates;
+
 		void UpdateSignificance(const TArray<FTransform>& ViewPoints, const bool bSortSignificanceAscending);
 
+		// Returns true if the significance calculation can be skipped this update, i.e. the object has not moved since it was last calculated
+		bool CanSkipSignificanceUpdate();
+
 		// Allow SignificanceManager to call UpdateSignificance
 		friend USignificanceManager;
 	};
@@ -219,6 +232,9 @@ protected:
 	// The cached viewpoints for significance for calculating when a new object is registered
 	TArray<FTransform> Viewpoints;
 
+	// The viewpoints at the last full (non-incremental) update
+	TArray<FTransform> FullUpdateViewpoints;
+
 private:
 
 	uint32 ManagedObjectsWithSequentialPostWork;
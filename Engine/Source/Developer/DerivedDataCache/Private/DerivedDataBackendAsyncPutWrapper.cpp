@@ -137,6 +137,46 @@ bool FDerivedDataBackendAsyncPutWrapper::CachedDataProbablyExists(const TCHAR* C
 	return Result;
 }
 
+TBitArray<> FDerivedDataBackendAsyncPutWrapper::CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys)
+{
+	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+
+	TBitArray<> Result;
+	if (InflightCache)
+	{
+		Result = InflightCache->CachedDataProbablyExistsBatch(CacheKeys);
+		check(Result.Num() == CacheKeys.Num());
+	}
+	else
+	{
+		Result.Init(false, CacheKeys.Num());
+	}
+
+	TArray<FString> InnerKeys;
+	TArray<int32> InnerKeyIndices;
+	for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+	{
+		if (!Result[KeyIndex])
+		{
+			InnerKeys.Add(CacheKeys[KeyIndex]);
+			InnerKeyIndices.Add(KeyIndex);
+		}
+	}
+
+	if (InnerKeys.Num() > 0)
+	{
+		const TBitArray<> InnerResult = InnerBackend->CachedDataProbablyExistsBatch(InnerKeys);
+		check(InnerResult.Num() == InnerKeys.Num());
+		for (int32 InnerIndex = 0; InnerIndex < InnerKeys.Num(); ++InnerIndex)
+		{
+			Result[InnerKeyIndices[InnerIndex]] = InnerResult[InnerIndex];
+		}
+	}
+
+	COOK_STAT(if (Result.Contains(true)) { Timer.AddHit(0); });
+	return Result;
+}
+
 bool FDerivedDataBackendAsyncPutWrapper::TryToPrefetch(const TCHAR* CacheKey)
 {
 	COOK_STAT(auto Timer = UsageStats.TimePrefetch());
@@ -83,6 +83,11 @@ public:
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override;
 
+	/**
+	 * Synchronous test for the existence of multiple cache items, keys with a put still in flight are not forwarded to the inner backend
+	 */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys) override;
+
 	/**
 	 * Attempts to make sure the cached data will be available as optimally as possible. This is left up to the implementation to do
 	 * @param	CacheKey	Alphanumeric+underscore key of this cache item
@@ -115,6 +115,14 @@ public:
 		}
 		return Result;
 	}
+
+	virtual TBitArray<> CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		TBitArray<> Result = InnerBackend->CachedDataProbablyExistsBatch(CacheKeys);
+		COOK_STAT(if (Result.Contains(true)) { Timer.AddHit(0); });
+		return Result;
+	}
 	/**
 	 * Synchronous retrieve of a cache item
 	 *
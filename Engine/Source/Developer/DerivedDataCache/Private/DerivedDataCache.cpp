@@ -505,6 +505,24 @@ public:
 		return bResult;
 	}
 
+	virtual TBitArray<> CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys) override
+	{
+		DDC_SCOPE_CYCLE_COUNTER(DDC_CachedDataProbablyExistsBatch);
+		for (const FString& CacheKey : CacheKeys)
+		{
+			ValidateCacheKey(*CacheKey);
+		}
+		TBitArray<> Result;
+		INC_DWORD_STAT_BY(STAT_DDC_NumExist, CacheKeys.Num());
+		STAT(double ThisTime = 0);
+		{
+			SCOPE_SECONDS_COUNTER(ThisTime);
+			Result = FDerivedDataBackend::Get().GetRoot().CachedDataProbablyExistsBatch(CacheKeys);
+		}
+		INC_FLOAT_STAT_BY(STAT_DDC_ExistTime, (float)ThisTime);
+		return Result;
+	}
+
 	void NotifyBootComplete() override
 	{
 		DDC_SCOPE_CYCLE_COUNTER(DDC_NotifyBootComplete);
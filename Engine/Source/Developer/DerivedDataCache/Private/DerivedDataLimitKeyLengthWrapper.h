@@ -64,6 +64,20 @@ public:
 		return Result;
 	}
 
+	virtual TBitArray<> CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		TArray<FString> NewKeys;
+		NewKeys.Reserve(CacheKeys.Num());
+		for (const FString& CacheKey : CacheKeys)
+		{
+			ShortenKey(*CacheKey, NewKeys.AddDefaulted_GetRef());
+		}
+		TBitArray<> Result = InnerBackend->CachedDataProbablyExistsBatch(NewKeys);
+		COOK_STAT(if (Result.Contains(true)) { Timer.AddHit(0); });
+		return Result;
+	}
+
 	/**
 	 * Attempts to make sure the cached data will be available as optimally as possible. This is left up to the implementation to do
 	 * @param	CacheKey	Alphanumeric+underscore key of this cache item
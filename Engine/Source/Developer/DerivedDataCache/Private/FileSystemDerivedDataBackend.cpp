@@ -11,6 +11,7 @@
 #include "Misc/Paths.h"
 #include "Misc/Guid.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/Compression.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "Async/Async.h"
 
@@ -76,6 +77,8 @@ public:
 		, bReadOnly(false)
 		, bTouch(false)
 		, bPurgeTransient(false)
+		, bCompress(false)
+		, CompressionFormat(NAME_Zlib)
 		, DaysToDeleteUnusedFiles(15)
 		, bDisabled(false)
 		, TotalEstimatedBuildTime(0)
@@ -93,6 +96,25 @@ public:
 		bPurgeTransient = GetParsedBool(InParams, TEXT("PurgeTransient="));
 		FParse::Value(InParams, TEXT("UnusedFileAge="), DaysToDeleteUnusedFiles);
 
+		// Compressed payloads are recognized on read regardless of this setting, so it only needs to be enabled on the writers
+		bCompress = GetParsedBool(InParams, TEXT("Compress="));
+		if (bCompress)
+		{
+			FString CompressionFormatName;
+			if (FParse::Value(InParams, TEXT("CompressionFormat="), CompressionFormatName))
+			{
+				const FName RequestedFormat(*CompressionFormatName);
+				if (FCompression::IsFormatValid(RequestedFormat) && CompressionFormatName.Len() < UE_ARRAY_COUNT(FCompressedPayloadHeader::Format))
+				{
+					CompressionFormat = RequestedFormat;
+				}
+				else
+				{
+					UE_LOG(LogDerivedDataCache, Warning, TEXT("%s: Compression format %s is not available, using %s"), *CachePath, *CompressionFormatName, *CompressionFormat.ToString());
+				}
+			}
+		}
+
 		// Params that are used when setting up our path
 		const bool bClean = GetParsedBool(InParams, TEXT("Clean="));
 		const bool bFlush = GetParsedBool(InParams, TEXT("Flush="));
@@ -553,7 +575,7 @@ public:
 			return false;
 		}
 
-		if (FFileHelper::LoadFileToArray(Data,*Filename,FILEREAD_Silent))
+		if (FFileHelper::LoadFileToArray(Data,*Filename,FILEREAD_Silent) && DecompressPayload(Data, Filename))
 		{
 			double ReadDuration = FPlatformTime::Seconds() - StartTime;
 			double ReadSpeed = (Data.Num() / ReadDuration) / (1024.0 * 1024.0);
@@ -628,17 +650,25 @@ public:
 			{
 				COOK_STAT(Timer.AddHit(Data.Num()));
 				check(Data.Num());
+
+				TArray<uint8> CompressedData;
+				TArrayView<const uint8> FileData = Data;
+				if (bCompress && CompressPayload(Data, CompressedData))
+				{
+					FileData = CompressedData;
+				}
+
 				FString Filename = BuildFilename(CacheKey);
 				FString TempFilename(TEXT("temp.")); 
 				TempFilename += FGuid::NewGuid().ToString();
 				TempFilename = FPaths::GetPath(Filename) / TempFilename;
 				bool bResult;
 				{
-					bResult = FFileHelper::SaveArrayToFile(Data, *TempFilename, &IFileManager::Get(), FILEWRITE_Silent);
+					bResult = FFileHelper::SaveArrayToFile(FileData, *TempFilename, &IFileManager::Get(), FILEWRITE_Silent);
 				}
 				if (bResult)
 				{
-					if (IFileManager::Get().FileSize(*TempFilename) == Data.Num())
+					if (IFileManager::Get().FileSize(*TempFilename) == FileData.Num())
 					{
 						bool DoMove = !CachedDataProbablyExists(CacheKey);
 						if (bPutEvenIfExists && !DoMove)
@@ -762,6 +792,78 @@ public:
 private:
 	FDerivedDataCacheUsageStats UsageStats;
 
+	/** Prefixed to payloads stored compressed. Payloads without it are stored as is. */
+	struct FCompressedPayloadHeader
+	{
+		static const uint32 ExpectedMagic = 0x5A444455; // 'UDDZ'
+
+		uint32 Magic;
+		int32 UncompressedSize;
+		ANSICHAR Format[8];
+	};
+
+	/**
+	 * Compresses a payload for storage, prefixed with an FCompressedPayloadHeader.
+	 *
+	 * @return	false if compression failed or did not make the payload smaller, in which case it should be stored uncompressed
+	 */
+	bool CompressPayload(TArrayView<const uint8> Data, TArray<uint8>& OutCompressedData) const
+	{
+		const int32 HeaderSize = sizeof(FCompressedPayloadHeader);
+		int32 CompressedSize = FCompression::CompressMemoryBound(CompressionFormat, Data.Num());
+		OutCompressedData.SetNumUninitialized(HeaderSize + CompressedSize);
+		if (!FCompression::CompressMemory(CompressionFormat, OutCompressedData.GetData() + HeaderSize, CompressedSize, Data.GetData(), Data.Num())
+			|| HeaderSize + CompressedSize >= Data.Num())
+		{
+			return false;
+		}
+
+		FCompressedPayloadHeader Header;
+		FMemory::Memzero(Header);
+		Header.Magic = FCompressedPayloadHeader::ExpectedMagic;
+		Header.UncompressedSize = Data.Num();
+		FCStringAnsi::Strncpy(Header.Format, TCHAR_TO_ANSI(*CompressionFormat.ToString()), UE_ARRAY_COUNT(Header.Format));
+		FMemory::Memcpy(OutCompressedData.GetData(), &Header, HeaderSize);
+		OutCompressedData.SetNum(HeaderSize + CompressedSize, false);
+		return true;
+	}
+
+	/**
+	 * Decompresses a payload in place if it was stored compressed, leaves it untouched otherwise.
+	 *
+	 * @return	false if the payload was compressed and could not be decompressed
+	 */
+	bool DecompressPayload(TArray<uint8>& Data, const FString& Filename) const
+	{
+		const int32 HeaderSize = sizeof(FCompressedPayloadHeader);
+		FCompressedPayloadHeader Header;
+		if (Data.Num() <= HeaderSize)
+		{
+			return true;
+		}
+		FMemory::Memcpy(&Header, Data.GetData(), HeaderSize);
+		if (Header.Magic != FCompressedPayloadHeader::ExpectedMagic || Header.UncompressedSize <= 0)
+		{
+			return true;
+		}
+
+		ANSICHAR FormatString[UE_ARRAY_COUNT(Header.Format) + 1] = {};
+		FMemory::Memcpy(FormatString, Header.Format, sizeof(Header.Format));
+		const FName Format(ANSI_TO_TCHAR(FormatString));
+
+		TArray<uint8> UncompressedData;
+		UncompressedData.SetNumUninitialized(Header.UncompressedSize);
+		if (!FCompression::IsFormatValid(Format)
+			|| !FCompression::UncompressMemory(Format, UncompressedData.GetData(), Header.UncompressedSize, Data.GetData() + HeaderSize, Data.Num() - HeaderSize))
+		{
+			UE_LOG(LogDerivedDataCache, Warning, TEXT("%s: Unable to decompress %s (%s), treating it as a miss"), *GetName(), *Filename, *Format.ToString());
+			return false;
+		}
+
+		Data = MoveTemp(UncompressedData);
+		return true;
+	}
+
 	/**
 	 * Threadsafe method to compute the filename from the cachekey, currently just adds a path and an extension.
 	 *
@@ -784,6 +886,10 @@ private:
 	bool		bTouch;
 	/** If true, allow transient data to be removed from the cache. */
 	bool		bPurgeTransient;
+	/** If true, payloads are compressed before being written. */
+	bool		bCompress;
+	/** Format used to compress payloads when bCompress is set. */
+	FName		CompressionFormat;
 	/** Age of file when it should be deleted from DDC cache. */
 	int32		DaysToDeleteUnusedFiles;
 
@@ -123,6 +123,58 @@ public:
 		return false;
 	}
 
+	/**
+	 * Synchronous test for the existence of multiple cache items. Each fast inner backend is asked once for all of the keys
+	 * that have not been found yet.
+	 */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		TBitArray<> Result(false, CacheKeys.Num());
+
+		TArray<FString> RemainingKeys(CacheKeys.GetData(), CacheKeys.Num());
+		TArray<int32> RemainingIndices;
+		RemainingIndices.Reserve(CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			RemainingIndices.Add(KeyIndex);
+		}
+
+		for (int32 CacheIndex = 0; CacheIndex < InnerBackends.Num() && RemainingKeys.Num() > 0; CacheIndex++)
+		{
+			// Skip slow caches for the same reason as CachedDataProbablyExists
+			bool bFastCache = InnerBackends[CacheIndex]->GetSpeedClass() >= ESpeedClass::Fast;
+			if (!bFastCache)
+			{
+				continue;
+			}
+
+			const TBitArray<> InnerResult = InnerBackends[CacheIndex]->CachedDataProbablyExistsBatch(RemainingKeys);
+			check(InnerResult.Num() == RemainingKeys.Num());
+
+			// Only keep asking the next backends for the keys that were not found
+			int32 NumStillRemaining = 0;
+			for (int32 RemainingIndex = 0; RemainingIndex < RemainingKeys.Num(); ++RemainingIndex)
+			{
+				if (InnerResult[RemainingIndex])
+				{
+					Result[RemainingIndices[RemainingIndex]] = true;
+				}
+				else
+				{
+					RemainingKeys[NumStillRemaining] = MoveTemp(RemainingKeys[RemainingIndex]);
+					RemainingIndices[NumStillRemaining] = RemainingIndices[RemainingIndex];
+					++NumStillRemaining;
+				}
+			}
+			RemainingKeys.SetNum(NumStillRemaining, false);
+			RemainingIndices.SetNum(NumStillRemaining, false);
+		}
+
+		COOK_STAT(if (RemainingKeys.Num() < CacheKeys.Num()) { Timer.AddHit(0); });
+		return Result;
+	}
+
 	/**
 	 * Attempts to make sure the cached data will be available as optimally as possible. This is left up to the implementation to do
 	 * @param	CacheKey	Alphanumeric+underscore key of this cache item
@@ -11,6 +11,7 @@
 #if PLATFORM_WINDOWS || PLATFORM_HOLOLENS
 #include "Windows/HideWindowsPlatformTypes.h"
 #endif
+#include "Async/ParallelFor.h"
 #include "Containers/StaticArray.h"
 #include "Containers/Ticker.h"
 #include "Dom/JsonObject.h"
@@ -1152,6 +1153,28 @@ bool FHttpDerivedDataBackend::CachedDataProbablyExists(const TCHAR* CacheKey)
 	return false;
 }
 
+TBitArray<> FHttpDerivedDataBackend::CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(HttpDDC_ExistBatch);
+
+	// Keep up to UE_HTTPDDC_REQUEST_POOL_SIZE queries in flight rather than paying a full round trip per key.
+	// Each query blocks on a pooled request, so the pool bounds the concurrency.
+	TArray<bool> KeyExists;
+	KeyExists.SetNumZeroed(CacheKeys.Num());
+	ParallelFor(CacheKeys.Num(), [this, &CacheKeys, &KeyExists](int32 Index)
+	{
+		KeyExists[Index] = CachedDataProbablyExists(*CacheKeys[Index]);
+	});
+
+	TBitArray<> Result;
+	Result.Reserve(CacheKeys.Num());
+	for (bool bExists : KeyExists)
+	{
+		Result.Add(bExists);
+	}
+	return Result;
+}
+
 bool FHttpDerivedDataBackend::GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(HttpDDC_Get);
@@ -106,6 +106,25 @@ public:
 	 * @return				true if the data probably will be found, this can't be guaranteed because of concurrency in the backends, corruption, etc
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey)=0;
+
+	/**
+	 * Synchronous test for the existence of multiple cache items. Backends with per-request latency should override this to
+	 * test the keys together rather than one round trip at a time.
+	 *
+	 * @param	CacheKeys	Alphanumeric+underscore keys of the cache items
+	 * @return				A bit array with bits indicating whether the data for the corresponding key will probably be found
+	 */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys)
+	{
+		TBitArray<> Result;
+		Result.Reserve(CacheKeys.Num());
+		for (const FString& CacheKey : CacheKeys)
+		{
+			Result.Add(CachedDataProbablyExists(*CacheKey));
+		}
+		return Result;
+	}
+
 	/**
 	 * Synchronous retrieve of a cache item
 	 *
@@ -196,6 +196,13 @@ public:
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) = 0;
 
+	/**
+	 * Synchronously checks the cache for the existence of multiple keys at once, letting remote backends batch the queries
+	 * @param	CacheKeys	Keys to look for
+	 * @return				A bit array with bits indicating whether the data for the corresponding key will probably be found
+	 */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(TConstArrayView<FString> CacheKeys) = 0;
+
 	//--------------------
 	// System Interface
 	//--------------------
@@ -493,6 +493,7 @@ struct FContainerTargetFile
 	FString DestinationPath;
 	uint64 SourceSize = 0;
 	uint64 IdealOrder = 0;
+	uint64 AccessOrder = MAX_uint64;
 	FIoChunkId ChunkId;
 	TArray<uint8> PackageHeaderData;
 	TArray<int32> NameIndices;
@@ -524,6 +525,7 @@ struct FIoStoreArguments
 	FCookedFileStatMap CookedFileStatMap;
 	TMap<FName, uint64> GameOrderMap;
 	TMap<FName, uint64> CookerOrderMap;
+	TMap<FIoChunkId, uint64> ChunkAccessOrderMap;
 	FKeyChain KeyChain;
 	FKeyChain PatchKeyChain;
 	FString DLCPluginPath;
@@ -1218,7 +1220,8 @@ static void CreateDiskLayout(
 	const TArray<FContainerTargetSpec*>& ContainerTargets,
 	const TArray<FPackage*>& Packages,
 	const TMap<FName, uint64> PackageOrderMap,
-	const TMap<FName, uint64>& CookerOrderMap)
+	const TMap<FName, uint64>& CookerOrderMap,
+	const TMap<FIoChunkId, uint64>& ChunkAccessOrderMap)
 {
 	IOSTORE_CPU_SCOPE(CreateDiskLayout);
 
@@ -1228,16 +1231,29 @@ static void CreateDiskLayout(
 	{
 		TArray<FContainerTargetFile*> SortedTargetFiles;
 		SortedTargetFiles.Reserve(ContainerTarget->TargetFiles.Num());
+		int32 AccessOrderedCount = 0;
 		for (FContainerTargetFile& TargetFile : ContainerTarget->TargetFiles)
 		{
+			const uint64* FindAccessOrder = ChunkAccessOrderMap.Find(TargetFile.ChunkId);
+			TargetFile.AccessOrder = FindAccessOrder ? *FindAccessOrder : MAX_uint64;
+			AccessOrderedCount += FindAccessOrder ? 1 : 0;
 			SortedTargetFiles.Add(&TargetFile);
 		}
+		if (ChunkAccessOrderMap.Num())
+		{
+			UE_LOG(LogIoStore, Display, TEXT("Ordered %d/%d chunks in '%s' using chunk access order"), AccessOrderedCount, SortedTargetFiles.Num(), *ContainerTarget->Name.ToString());
+		}
 		Algo::Sort(SortedTargetFiles, [](const FContainerTargetFile* A, const FContainerTargetFile* B)
 		{
 			if (A->bIsMemoryMappedBulkData != B->bIsMemoryMappedBulkData)
 			{
 				return B->bIsMemoryMappedBulkData;
 			}
+			// Chunks read at runtime go first, package data and bulk data interleaved the way they were read
+			if (A->AccessOrder != B->AccessOrder)
+			{
+				return A->AccessOrder < B->AccessOrder;
+			}
 			if (A->bIsBulkData != B->bIsBulkData)
 			{
 				return B->bIsBulkData;
@@ -3937,7 +3953,7 @@ int32 CreateTarget(const FIoStoreArguments& Arguments, const FIoStoreWriterSetti
 	}
 
 	UE_LOG(LogIoStore, Display, TEXT("Creating disk layout..."));
-	CreateDiskLayout(ContainerTargets, Packages, Arguments.GameOrderMap, Arguments.CookerOrderMap);
+	CreateDiskLayout(ContainerTargets, Packages, Arguments.GameOrderMap, Arguments.CookerOrderMap, Arguments.ChunkAccessOrderMap);
 
 	for (FContainerTargetSpec* ContainerTarget : ContainerTargets)
 	{
@@ -4040,6 +4056,12 @@ int32 CreateTarget(const FIoStoreArguments& Arguments, const FIoStoreWriterSetti
 
 	FIoStoreProgressReporter* IoStoreProgressReporter = new FIoStoreProgressReporter(*IoStoreWriterContext);
 
+	// Queue every container for compression up front so that compression of later containers overlaps with writing the earlier ones
+	for (FIoStoreWriter* IoStoreWriter : IoStoreWriters)
+	{
+		IoStoreWriter->BeginFlush();
+	}
+
 	TArray<FIoStoreWriterResult> IoStoreWriterResults;
 	IoStoreWriterResults.Reserve(IoStoreWriters.Num());
 	for (FIoStoreWriter* IoStoreWriter : IoStoreWriters)
@@ -5552,6 +5574,55 @@ static bool ParsePakOrderFile(const TCHAR* FilePath, TMap<FName, uint64>& OutMap
 	return true;
 }
 
+/**
+ * Parses a chunk access log written by the runtime with -IoChunkAccessLog. Chunks are ordered by load phase first,
+ * so when several logs are merged each phase ends up as one contiguous region, and by first access within a phase.
+ */
+static bool ParseChunkAccessOrderFile(const TCHAR* FilePath, TMap<FIoChunkId, uint64>& OutMap)
+{
+	TArray<FString> OrderFileContents;
+	if (!FFileHelper::LoadFileToStringArray(OrderFileContents, FilePath))
+	{
+		UE_LOG(LogIoStore, Error, TEXT("Failed to read chunk access order file '%s'."), FilePath);
+		return false;
+	}
+
+	uint64 LineNumber = OutMap.Num();
+	for (const FString& OrderLine : OrderFileContents)
+	{
+		if (OrderLine.IsEmpty() || OrderLine.StartsWith(TEXT(";")))
+		{
+			continue;
+		}
+		const TCHAR* OrderLinePtr = *OrderLine;
+		FString ChunkIdString;
+		uint32 Phase = 0;
+		uint8 ChunkIdData[FIoChunkId::GetSize()];
+		if (!FParse::Token(OrderLinePtr, ChunkIdString, false) ||
+			ChunkIdString.Len() != 2 * FIoChunkId::GetSize() ||
+			HexToBytes(ChunkIdString, ChunkIdData) != FIoChunkId::GetSize() ||
+			!LexTryParseString(Phase, *FParse::Token(OrderLinePtr, false)))
+		{
+			UE_LOG(LogIoStore, Error, TEXT("Invalid line in chunk access order file '%s'."), *OrderLine);
+			return false;
+		}
+
+		FIoChunkId ChunkId;
+		ChunkId.Set(ChunkIdData, sizeof ChunkIdData);
+		const uint64 Order = (uint64(Phase) << 40) | LineNumber++;
+		uint64* ExistingOrder = OutMap.Find(ChunkId);
+		if (!ExistingOrder)
+		{
+			OutMap.Add(ChunkId, Order);
+		}
+		else if (Order < *ExistingOrder)
+		{
+			*ExistingOrder = Order;
+		}
+	}
+	return true;
+}
+
 class FCookedFileVisitor : public IPlatformFile::FDirectoryStatVisitor
 {
 	FCookedFileStatMap& CookedFileStatMap;
@@ -5734,6 +5805,21 @@ int32 CreateIoStoreContainerFiles(const TCHAR* CmdLine)
 		}
 	}
 
+	FString ChunkAccessOrderFileStr;
+	if (FParse::Value(FCommandLine::Get(), TEXT("ChunkAccessOrder="), ChunkAccessOrderFileStr, false))
+	{
+		TArray<FString> ChunkAccessOrderFilePaths;
+		ChunkAccessOrderFileStr.ParseIntoArray(ChunkAccessOrderFilePaths, TEXT(","), true);
+		for (FString& ChunkAccessOrderFile : ChunkAccessOrderFilePaths)
+		{
+			if (!ParseChunkAccessOrderFile(*ChunkAccessOrderFile, Arguments.ChunkAccessOrderMap))
+			{
+				return -1;
+			}
+		}
+		UE_LOG(LogIoStore, Display, TEXT("Loaded access order for %d chunks"), Arguments.ChunkAccessOrderMap.Num());
+	}
+
 	FIoStoreWriterSettings GeneralIoWriterSettings { DefaultCompressionMethod, DefaultCompressionBlockSize, false };
 	GeneralIoWriterSettings.bEnableCsvOutput = FParse::Param(CmdLine, TEXT("-csvoutput"));
 
@@ -5,6 +5,7 @@
 #include "Containers/IndirectArray.h"
 #include "Stats/Stats.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
 #include "HAL/IConsoleManager.h"
 #include "ImageCore.h"
 #include "Modules/ModuleManager.h"
@@ -309,7 +310,8 @@ static bool CompressImageUsingNVTT(
 	const int32 ImageBlocksY = FMath::Max(SizeY / BlockSizeY, 1);
 	const int32 BlocksPerBatch = FMath::Max<int32>(ImageBlocksX, FMath::RoundUpToPowerOfTwo(CompressionSettings::BlocksPerBatch));
 	const int32 RowsPerBatch = BlocksPerBatch / ImageBlocksX;
-	const int32 NumBatches = ImageBlocksY / RowsPerBatch;
+	// The last batch takes the remaining rows when the image height is not a multiple of the batch height
+	const int32 NumBatches = FMath::DivideAndRoundUp(ImageBlocksY, RowsPerBatch);
 
 	// nvtt doesn't support 64-bit output sizes.
 	int64 OutDataSize = (int64)ImageBlocksX * ImageBlocksY * BlockBytes;
@@ -322,9 +324,9 @@ static bool CompressImageUsingNVTT(
 	OutCompressedData.Empty(OutDataSize);
 	OutCompressedData.AddUninitialized(OutDataSize);
 
-	if (ImageBlocksX * ImageBlocksY <= BlocksPerBatch ||
-		BlocksPerBatch % ImageBlocksX != 0 ||
-		RowsPerBatch * NumBatches != ImageBlocksY)
+	if (NumBatches <= 1 ||
+		SizeX % BlockSizeX != 0 ||
+		SizeY % BlockSizeY != 0)
 	{
 		FNVTTCompressor* Compressor = NULL;
 		{
@@ -362,15 +364,16 @@ static bool CompressImageUsingNVTT(
 		uint8* Dest = OutCompressedData.GetData();
 		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
 		{
+			const int32 BatchRows = FMath::Min(RowsPerBatch, ImageBlocksY - BatchIndex * RowsPerBatch);
 			Compressors.Add(new FNVTTCompressor(
 				Src,
 				PixelFormat,
 				SizeX,
-				RowsPerBatch * BlockSizeY,
+				BatchRows * BlockSizeY,
 				bSRGB,
 				bIsNormalMap,
 				Dest,
-				CompressedStride
+				BatchRows * ImageBlocksX * BlockBytes
 			));
 			Src += UncompressedStride;
 			Dest += CompressedStride;
@@ -508,10 +511,15 @@ class FTextureFormatDXT : public ITextureFormat
 		}
 		else
 		{
-			for (int32 SliceIndex = 0; SliceIndex < Image.NumSlices && bCompressionSucceeded; ++SliceIndex)
+			// Slices (cube faces, array and volume slices) are independent, compress them in parallel and append them in order
+			TArray<TArray64<uint8>> CompressedSlices;
+			TArray<bool> SliceSucceeded;
+			CompressedSlices.SetNum(Image.NumSlices);
+			SliceSucceeded.Init(false, Image.NumSlices);
+
+			ParallelFor(Image.NumSlices, [&](int32 SliceIndex)
 			{
-				TArray64<uint8> CompressedSliceData;
-				bCompressionSucceeded = CompressImageUsingNVTT(
+				SliceSucceeded[SliceIndex] = CompressImageUsingNVTT(
 					(&Image.AsBGRA8()[0]) + SliceIndex * SliceSize,
 					CompressedPixelFormat,
 					Image.SizeX,
@@ -519,9 +527,14 @@ class FTextureFormatDXT : public ITextureFormat
 					Image.IsGammaCorrected(),
 					bIsNormalMap,
 					false, // Daniel Lamb: Testing with this set to true didn't give large performance gain to lightmaps.  Encoding of 140 lightmaps was 19.2seconds with preview 20.1 without preview.  11/30/2015
-					CompressedSliceData
+					CompressedSlices[SliceIndex]
 					);
-				OutCompressedImage.RawData.Append(MoveTemp(CompressedSliceData));
+			});
+
+			for (int32 SliceIndex = 0; SliceIndex < Image.NumSlices && bCompressionSucceeded; ++SliceIndex)
+			{
+				bCompressionSucceeded = SliceSucceeded[SliceIndex];
+				OutCompressedImage.RawData.Append(MoveTemp(CompressedSlices[SliceIndex]));
 			}
 		}
 
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "CpuSamplingTraceAnalysis.h"
+#include "AnalysisServicePrivate.h"
+#include "Model/CpuSamplingPrivate.h"
+
+FCpuSamplingAnalyzer::FCpuSamplingAnalyzer(Trace::IAnalysisSession& InSession, Trace::FCpuSamplingProvider& InCpuSamplingProvider)
+	: Session(InSession)
+	, CpuSamplingProvider(InCpuSamplingProvider)
+{
+}
+
+void FCpuSamplingAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	auto& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_Sample, "CpuSampling", "Sample");
+	Builder.RouteEvent(RouteId_Symbol, "CpuSampling", "Symbol");
+}
+
+void FCpuSamplingAnalyzer::OnThreadInfo(const FThreadInfo& ThreadInfo)
+{
+	if (uint32 SystemId = ThreadInfo.GetSystemId())
+	{
+		SystemIdToThreadIdMap.Add(SystemId, ThreadInfo.GetId());
+	}
+}
+
+bool FCpuSamplingAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	Trace::FAnalysisSessionEditScope _(Session);
+
+	const auto& EventData = Context.EventData;
+	switch (RouteId)
+	{
+	case RouteId_Sample:
+	{
+		// Samples of threads which haven't been announced can't be matched with their timing events, so are dropped.
+		const uint32* ThreadId = SystemIdToThreadIdMap.Find(EventData.GetValue<uint32>("SystemThreadId"));
+		if (ThreadId == nullptr)
+		{
+			break;
+		}
+
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Session.UpdateDurationSeconds(Time);
+		const uint64* Frames = reinterpret_cast<const uint64*>(EventData.GetAttachment());
+		const uint32 NumFrames = EventData.GetAttachmentSize() / sizeof(uint64);
+		CpuSamplingProvider.AddSample(*ThreadId, Time, Frames, NumFrames);
+		break;
+	}
+	case RouteId_Symbol:
+	{
+		uint64 Address = EventData.GetValue<uint64>("Address");
+		const ANSICHAR* Name = reinterpret_cast<const ANSICHAR*>(EventData.GetAttachment());
+		CpuSamplingProvider.AddSymbol(Address, ANSI_TO_TCHAR(Name));
+		break;
+	}
+	}
+
+	return true;
+}
@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Trace/Analyzer.h"
+#include "Containers/Map.h"
+
+namespace Trace
+{
+	class IAnalysisSession;
+	class FCpuSamplingProvider;
+}
+
+class FCpuSamplingAnalyzer
+	: public Trace::IAnalyzer
+{
+public:
+	FCpuSamplingAnalyzer(Trace::IAnalysisSession& Session, Trace::FCpuSamplingProvider& CpuSamplingProvider);
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual void OnThreadInfo(const FThreadInfo& ThreadInfo) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+	enum : uint16
+	{
+		RouteId_Sample,
+		RouteId_Symbol,
+	};
+
+	Trace::IAnalysisSession& Session;
+	Trace::FCpuSamplingProvider& CpuSamplingProvider;
+
+	// Samples are taken by another thread and identify the sampled thread by its system id.
+	TMap<uint32, uint32> SystemIdToThreadIdMap;
+};
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "MemorySamplingTraceAnalysis.h"
+#include "AnalysisServicePrivate.h"
+#include "Model/MemorySamplingPrivate.h"
+
+FMemorySamplingAnalyzer::FMemorySamplingAnalyzer(Trace::IAnalysisSession& InSession, Trace::FMemorySamplingProvider& InMemorySamplingProvider)
+	: Session(InSession)
+	, MemorySamplingProvider(InMemorySamplingProvider)
+{
+}
+
+void FMemorySamplingAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	auto& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_Alloc, "MemSampling", "Alloc");
+	Builder.RouteEvent(RouteId_Free, "MemSampling", "Free");
+	Builder.RouteEvent(RouteId_Symbol, "MemSampling", "Symbol");
+}
+
+void FMemorySamplingAnalyzer::OnThreadInfo(const FThreadInfo& ThreadInfo)
+{
+	if (uint32 SystemId = ThreadInfo.GetSystemId())
+	{
+		SystemIdToThreadIdMap.Add(SystemId, ThreadInfo.GetId());
+	}
+}
+
+bool FMemorySamplingAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	Trace::FAnalysisSessionEditScope _(Session);
+
+	const auto& EventData = Context.EventData;
+	switch (RouteId)
+	{
+	case RouteId_Alloc:
+	{
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Session.UpdateDurationSeconds(Time);
+		const uint32* ThreadId = SystemIdToThreadIdMap.Find(EventData.GetValue<uint32>("SystemThreadId"));
+		const uint64* Frames = reinterpret_cast<const uint64*>(EventData.GetAttachment());
+		const uint32 NumFrames = EventData.GetAttachmentSize() / sizeof(uint64);
+		MemorySamplingProvider.AddAlloc(
+			EventData.GetValue<uint32>("Id"),
+			Time,
+			EventData.GetValue<uint64>("Address"),
+			EventData.GetValue<uint64>("Size"),
+			EventData.GetValue<uint32>("SampleInterval"),
+			ThreadId ? *ThreadId : 0,
+			Frames,
+			NumFrames);
+		break;
+	}
+	case RouteId_Free:
+	{
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Session.UpdateDurationSeconds(Time);
+		MemorySamplingProvider.AddFree(EventData.GetValue<uint32>("Id"), Time);
+		break;
+	}
+	case RouteId_Symbol:
+	{
+		uint64 Address = EventData.GetValue<uint64>("Address");
+		const ANSICHAR* Name = reinterpret_cast<const ANSICHAR*>(EventData.GetAttachment());
+		MemorySamplingProvider.AddSymbol(Address, ANSI_TO_TCHAR(Name));
+		break;
+	}
+	}
+
+	return true;
+}
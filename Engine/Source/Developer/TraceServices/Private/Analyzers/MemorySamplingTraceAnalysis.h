@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Trace/Analyzer.h"
+#include "Containers/Map.h"
+
+namespace Trace
+{
+	class IAnalysisSession;
+	class FMemorySamplingProvider;
+}
+
+class FMemorySamplingAnalyzer
+	: public Trace::IAnalyzer
+{
+public:
+	FMemorySamplingAnalyzer(Trace::IAnalysisSession& Session, Trace::FMemorySamplingProvider& MemorySamplingProvider);
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual void OnThreadInfo(const FThreadInfo& ThreadInfo) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+	enum : uint16
+	{
+		RouteId_Alloc,
+		RouteId_Free,
+		RouteId_Symbol,
+	};
+
+	Trace::IAnalysisSession& Session;
+	Trace::FMemorySamplingProvider& MemorySamplingProvider;
+
+	// Allocations identify their thread by its system id.
+	TMap<uint32, uint32> SystemIdToThreadIdMap;
+};
@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "TaskGraphTraceAnalysis.h"
+#include "AnalysisServicePrivate.h"
+#include "Model/TaskGraphPrivate.h"
+
+FTaskGraphAnalyzer::FTaskGraphAnalyzer(Trace::IAnalysisSession& InSession, Trace::FTaskGraphProvider& InTaskGraphProvider)
+	: Session(InSession)
+	, TaskGraphProvider(InTaskGraphProvider)
+{
+}
+
+void FTaskGraphAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	auto& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_Created, "TaskGraph", "Created");
+	Builder.RouteEvent(RouteId_Prerequisite, "TaskGraph", "Prerequisite");
+	Builder.RouteEvent(RouteId_Started, "TaskGraph", "Started");
+	Builder.RouteEvent(RouteId_Finished, "TaskGraph", "Finished");
+	Builder.RouteEvent(RouteId_Completed, "TaskGraph", "Completed");
+	Builder.RouteEvent(RouteId_WaitBegin, "TaskGraph", "WaitBegin");
+	Builder.RouteEvent(RouteId_WaitEnd, "TaskGraph", "WaitEnd");
+}
+
+bool FTaskGraphAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	Trace::FAnalysisSessionEditScope _(Session);
+
+	const auto& EventData = Context.EventData;
+	const uint32 ThreadId = Context.ThreadInfo.GetId();
+	switch (RouteId)
+	{
+	case RouteId_Created:
+	{
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		TaskGraphProvider.TaskCreated(EventData.GetValue<uint64>("TaskId"), EventData.GetValue<uint64>("CompletesTaskId"), EventData.GetValue<uint32>("ThreadToExecuteOn"), ThreadId, Time);
+		break;
+	}
+	case RouteId_Prerequisite:
+	{
+		TaskGraphProvider.AddPrerequisite(EventData.GetValue<uint64>("TaskId"), EventData.GetValue<uint64>("PrerequisiteTaskId"));
+		break;
+	}
+	case RouteId_Started:
+	{
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Session.UpdateDurationSeconds(Time);
+		TaskGraphProvider.TaskStarted(EventData.GetValue<uint64>("TaskId"), ThreadId, Time);
+		break;
+	}
+	case RouteId_Finished:
+	{
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Session.UpdateDurationSeconds(Time);
+		TaskGraphProvider.TaskFinished(EventData.GetValue<uint64>("TaskId"), ThreadId, Time);
+		break;
+	}
+	case RouteId_Completed:
+	{
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		TaskGraphProvider.TaskCompleted(EventData.GetValue<uint64>("TaskId"), Time);
+		break;
+	}
+	case RouteId_WaitBegin:
+	{
+		FOpenWait& Wait = OpenWaits.FindOrAdd(ThreadId).AddDefaulted_GetRef();
+		Wait.StartTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		const uint64* TaskIds = reinterpret_cast<const uint64*>(EventData.GetAttachment());
+		Wait.TaskIds.Append(TaskIds, EventData.GetAttachmentSize() / sizeof(uint64));
+		break;
+	}
+	case RouteId_WaitEnd:
+	{
+		// A trace can start in the middle of a wait, in which case there's no begin to match
+		TArray<FOpenWait>* ThreadWaits = OpenWaits.Find(ThreadId);
+		if (ThreadWaits == nullptr || ThreadWaits->Num() == 0)
+		{
+			break;
+		}
+
+		const FOpenWait Wait = ThreadWaits->Pop(false);
+		double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Session.UpdateDurationSeconds(Time);
+		TaskGraphProvider.AddWait(ThreadId, Wait.StartTime, Time, Wait.TaskIds.GetData(), Wait.TaskIds.Num());
+		break;
+	}
+	}
+
+	return true;
+}
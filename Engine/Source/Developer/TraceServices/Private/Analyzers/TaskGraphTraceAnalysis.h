@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Trace/Analyzer.h"
+#include "Containers/Map.h"
+
+namespace Trace
+{
+	class IAnalysisSession;
+	class FTaskGraphProvider;
+}
+
+class FTaskGraphAnalyzer
+	: public Trace::IAnalyzer
+{
+public:
+	FTaskGraphAnalyzer(Trace::IAnalysisSession& Session, Trace::FTaskGraphProvider& TaskGraphProvider);
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+	enum : uint16
+	{
+		RouteId_Created,
+		RouteId_Prerequisite,
+		RouteId_Started,
+		RouteId_Finished,
+		RouteId_Completed,
+		RouteId_WaitBegin,
+		RouteId_WaitEnd,
+	};
+
+	struct FOpenWait
+	{
+		double StartTime;
+		TArray<uint64> TaskIds;
+	};
+
+	Trace::IAnalysisSession& Session;
+	Trace::FTaskGraphProvider& TaskGraphProvider;
+
+	// Waits in progress per thread. Named threads process tasks while they wait, which can wait in turn.
+	TMap<uint32, TArray<FOpenWait>> OpenWaits;
+};
@@ -0,0 +1,232 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TraceServices/Model/CpuSampling.h"
+#include "Model/CpuSamplingPrivate.h"
+#include "Model/TimingProfilerPrivate.h"
+#include "AnalysisServicePrivate.h"
+#include "Common/SlabAllocator.h"
+#include "Templates/Tuple.h"
+
+namespace Trace
+{
+
+class FCpuSamplingFlameGraph
+	: public ICpuSamplingFlameGraph
+{
+public:
+	FCpuSamplingFlameGraph();
+	virtual ~FCpuSamplingFlameGraph() = default;
+	virtual const FCpuSamplingFlameGraphNode& GetRoot() const override { return *Root; }
+
+private:
+	FCpuSamplingFlameGraphNode* FindOrAddChild(FCpuSamplingFlameGraphNode* Parent, const FTimingProfilerTimer* Timer, uint64 Address, const TCHAR* Name);
+
+	typedef TTuple<const FCpuSamplingFlameGraphNode*, const FTimingProfilerTimer*, uint64> FChildKey;
+
+	FSlabAllocator Allocator;
+	TPagedArray<FCpuSamplingFlameGraphNode> Nodes;
+	TMap<FChildKey, FCpuSamplingFlameGraphNode*> ChildMap;
+	FCpuSamplingFlameGraphNode* Root;
+
+	friend class FCpuSamplingProvider;
+};
+
+FCpuSamplingFlameGraph::FCpuSamplingFlameGraph()
+	: Allocator(2 << 20)
+	, Nodes(Allocator, 1024)
+{
+	Root = &Nodes.PushBack();
+}
+
+FCpuSamplingFlameGraphNode* FCpuSamplingFlameGraph::FindOrAddChild(FCpuSamplingFlameGraphNode* Parent, const FTimingProfilerTimer* Timer, uint64 Address, const TCHAR* Name)
+{
+	FCpuSamplingFlameGraphNode*& Child = ChildMap.FindOrAdd(FChildKey(Parent, Timer, Address));
+	if (Child == nullptr)
+	{
+		Child = &Nodes.PushBack();
+		Child->Timer = Timer;
+		Child->Address = Address;
+		Child->Name = Name;
+		Child->Parent = Parent;
+		Parent->Children.Add(Child);
+	}
+	return Child;
+}
+
+FCpuSamplingProvider::FCpuSamplingProvider(IAnalysisSession& InSession, const FTimingProfilerProvider& InTimingProfilerProvider)
+	: Session(InSession)
+	, TimingProfilerProvider(InTimingProfilerProvider)
+{
+}
+
+FCpuSamplingProvider::~FCpuSamplingProvider()
+{
+	for (auto& KV : ThreadSamplesMap)
+	{
+		delete KV.Value;
+	}
+}
+
+void FCpuSamplingProvider::AddSymbol(uint64 Address, const TCHAR* Name)
+{
+	Session.WriteAccessCheck();
+
+	SymbolMap.Add(Address, Session.StoreString(Name));
+}
+
+void FCpuSamplingProvider::AddSample(uint32 ThreadId, double Time, const uint64* Frames, uint32 NumFrames)
+{
+	Session.WriteAccessCheck();
+
+	FThreadSamples*& ThreadSamples = ThreadSamplesMap.FindOrAdd(ThreadId);
+	if (ThreadSamples == nullptr)
+	{
+		ThreadSamples = new FThreadSamples(Session.GetLinearAllocator(), 4096);
+	}
+
+	uint64* StoredFrames = reinterpret_cast<uint64*>(Session.GetLinearAllocator().Allocate(NumFrames * sizeof(uint64)));
+	FMemory::Memcpy(StoredFrames, Frames, NumFrames * sizeof(uint64));
+
+	FSampleInternal& Sample = ThreadSamples->PushBack();
+	Sample.Time = Time;
+	Sample.Frames = StoredFrames;
+	Sample.NumFrames = NumFrames;
+
+	++SampleCount;
+}
+
+template <typename SamplesType>
+static uint64 LowerBoundSampleIndex(const SamplesType& Samples, double Time)
+{
+	// Samples come from a single sampling thread so they are in time order.
+	uint64 First = 0;
+	uint64 Count = Samples.Num();
+	while (Count > 0)
+	{
+		const uint64 Step = Count / 2;
+		if (Samples[First + Step].Time < Time)
+		{
+			First += Step + 1;
+			Count -= Step + 1;
+		}
+		else
+		{
+			Count = Step;
+		}
+	}
+	return First;
+}
+
+void FCpuSamplingProvider::EnumerateSamples(uint32 ThreadId, double IntervalStart, double IntervalEnd, TFunctionRef<void(const FCpuSample&)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	FThreadSamples* const* ThreadSamples = ThreadSamplesMap.Find(ThreadId);
+	if (ThreadSamples == nullptr)
+	{
+		return;
+	}
+
+	const FThreadSamples& Samples = **ThreadSamples;
+	for (uint64 Index = LowerBoundSampleIndex(Samples, IntervalStart); Index < Samples.Num() && Samples[Index].Time <= IntervalEnd; ++Index)
+	{
+		const FSampleInternal& SampleInternal = Samples[Index];
+
+		FCpuSample Sample;
+		Sample.Time = SampleInternal.Time;
+		Sample.ThreadId = ThreadId;
+		Sample.Frames = TArrayView<const uint64>(SampleInternal.Frames, SampleInternal.NumFrames);
+		Callback(Sample);
+	}
+}
+
+const TCHAR* FCpuSamplingProvider::GetSymbolName(uint64 Address) const
+{
+	Session.ReadAccessCheck();
+
+	const TCHAR* const* Name = SymbolMap.Find(Address);
+	return Name ? *Name : nullptr;
+}
+
+ICpuSamplingFlameGraph* FCpuSamplingProvider::CreateFlameGraph(double IntervalStart, double IntervalEnd, TFunctionRef<bool(uint32)> ThreadFilter) const
+{
+	Session.ReadAccessCheck();
+
+	FCpuSamplingFlameGraph* FlameGraph = new FCpuSamplingFlameGraph();
+
+	TArray<const FTimingProfilerTimer*> ScopeStack;
+	ScopeStack.Reserve(1024);
+
+	auto AddSample = [this, FlameGraph, &ScopeStack](const FSampleInternal& Sample)
+	{
+		FCpuSamplingFlameGraphNode* Node = FlameGraph->Root;
+		++Node->InclusiveCount;
+
+		for (const FTimingProfilerTimer* Timer : ScopeStack)
+		{
+			Node = FlameGraph->FindOrAddChild(Node, Timer, 0, Timer->Name);
+			++Node->InclusiveCount;
+		}
+
+		for (int32 FrameIndex = int32(Sample.NumFrames) - 1; FrameIndex >= 0; --FrameIndex)
+		{
+			const uint64 Address = Sample.Frames[FrameIndex];
+			Node = FlameGraph->FindOrAddChild(Node, nullptr, Address, GetSymbolName(Address));
+			++Node->InclusiveCount;
+		}
+
+		++Node->ExclusiveCount;
+	};
+
+	for (const auto& KV : ThreadSamplesMap)
+	{
+		const uint32 ThreadId = KV.Key;
+		if (!ThreadFilter(ThreadId))
+		{
+			continue;
+		}
+
+		const FThreadSamples& Samples = *KV.Value;
+		uint64 SampleIndex = LowerBoundSampleIndex(Samples, IntervalStart);
+		ScopeStack.Reset();
+
+		// Walk the thread's timing events in order, adding the samples taken before each event with the scope stack
+		// as it was at the time.
+		uint32 TimelineIndex;
+		if (TimingProfilerProvider.GetCpuThreadTimelineIndex(ThreadId, TimelineIndex))
+		{
+			TimingProfilerProvider.ReadTimeline(TimelineIndex, [this, IntervalStart, IntervalEnd, &Samples, &SampleIndex, &ScopeStack, &AddSample](const ITimingProfilerProvider::Timeline& Timeline)
+			{
+				Timeline.EnumerateEvents(IntervalStart, IntervalEnd, [this, IntervalEnd, &Samples, &SampleIndex, &ScopeStack, &AddSample](bool bIsEnter, double Time, const FTimingProfilerEvent& Event)
+				{
+					for (; SampleIndex < Samples.Num() && Samples[SampleIndex].Time < Time && Samples[SampleIndex].Time <= IntervalEnd; ++SampleIndex)
+					{
+						AddSample(Samples[SampleIndex]);
+					}
+
+					if (bIsEnter)
+					{
+						const FTimingProfilerTimer* Timer = TimingProfilerProvider.GetTimer(Event.TimerIndex);
+						check(Timer != nullptr);
+						ScopeStack.Push(Timer);
+					}
+					else if (ScopeStack.Num())
+					{
+						ScopeStack.Pop(false);
+					}
+
+					return EEventEnumerate::Continue;
+				});
+			});
+		}
+
+		for (; SampleIndex < Samples.Num() && Samples[SampleIndex].Time <= IntervalEnd; ++SampleIndex)
+		{
+			AddSample(Samples[SampleIndex]);
+		}
+	}
+
+	return FlameGraph;
+}
+
+}
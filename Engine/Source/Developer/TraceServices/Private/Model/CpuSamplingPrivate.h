@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "TraceServices/Model/CpuSampling.h"
+#include "Common/PagedArray.h"
+#include "Containers/Map.h"
+
+namespace Trace
+{
+
+class FTimingProfilerProvider;
+
+class FCpuSamplingProvider
+	: public ICpuSamplingProvider
+{
+public:
+	FCpuSamplingProvider(IAnalysisSession& Session, const FTimingProfilerProvider& TimingProfilerProvider);
+	virtual ~FCpuSamplingProvider();
+	void AddSymbol(uint64 Address, const TCHAR* Name);
+	void AddSample(uint32 ThreadId, double Time, const uint64* Frames, uint32 NumFrames);
+	virtual uint64 GetSampleCount() const override { return SampleCount; }
+	virtual void EnumerateSamples(uint32 ThreadId, double IntervalStart, double IntervalEnd, TFunctionRef<void(const FCpuSample&)> Callback) const override;
+	virtual const TCHAR* GetSymbolName(uint64 Address) const override;
+	virtual ICpuSamplingFlameGraph* CreateFlameGraph(double IntervalStart, double IntervalEnd, TFunctionRef<bool(uint32)> ThreadFilter) const override;
+
+private:
+	struct FSampleInternal
+	{
+		double Time;
+		const uint64* Frames;
+		uint32 NumFrames;
+	};
+
+	typedef TPagedArray<FSampleInternal> FThreadSamples;
+
+	IAnalysisSession& Session;
+	const FTimingProfilerProvider& TimingProfilerProvider;
+	TMap<uint32, FThreadSamples*> ThreadSamplesMap;
+	TMap<uint64, const TCHAR*> SymbolMap;
+	uint64 SampleCount = 0;
+};
+
+}
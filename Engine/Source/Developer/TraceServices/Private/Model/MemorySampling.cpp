@@ -0,0 +1,180 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TraceServices/Model/MemorySampling.h"
+#include "Model/MemorySamplingPrivate.h"
+#include "AnalysisServicePrivate.h"
+#include "Misc/Crc.h"
+
+namespace Trace
+{
+
+FMemorySamplingProvider::FMemorySamplingProvider(IAnalysisSession& InSession)
+	: Session(InSession)
+	, Allocations(InSession.GetLinearAllocator(), 4096)
+{
+}
+
+void FMemorySamplingProvider::AddSymbol(uint64 Address, const TCHAR* Name)
+{
+	Session.WriteAccessCheck();
+
+	SymbolMap.Add(Address, Session.StoreString(Name));
+}
+
+uint32 FMemorySamplingProvider::AddCallstack(const uint64* Frames, uint32 NumFrames)
+{
+	const uint32 Hash = FCrc::MemCrc32(Frames, NumFrames * sizeof(uint64));
+	TArray<uint32, TInlineAllocator<4>> Candidates;
+	CallstackHashToId.MultiFind(Hash, Candidates);
+	for (uint32 Candidate : Candidates)
+	{
+		const TArrayView<const uint64>& Callstack = Callstacks[Candidate];
+		if (uint32(Callstack.Num()) == NumFrames && FMemory::Memcmp(Callstack.GetData(), Frames, NumFrames * sizeof(uint64)) == 0)
+		{
+			return Candidate;
+		}
+	}
+
+	uint64* StoredFrames = reinterpret_cast<uint64*>(Session.GetLinearAllocator().Allocate(NumFrames * sizeof(uint64)));
+	FMemory::Memcpy(StoredFrames, Frames, NumFrames * sizeof(uint64));
+
+	const uint32 CallstackId = Callstacks.Add(TArrayView<const uint64>(StoredFrames, NumFrames));
+	CallstackHashToId.Add(Hash, CallstackId);
+	return CallstackId;
+}
+
+void FMemorySamplingProvider::AddAlloc(uint32 Id, double Time, uint64 Address, uint64 Size, uint32 SampleInterval, uint32 ThreadId, const uint64* Frames, uint32 NumFrames)
+{
+	Session.WriteAccessCheck();
+
+	FMemorySamplingAllocation& Allocation = Allocations.PushBack();
+	Allocation.Address = Address;
+	Allocation.Size = Size;
+	Allocation.AllocTime = Time;
+	Allocation.FreeTime = DBL_MAX;
+	Allocation.SampleInterval = FMath::Max(SampleInterval, 1u);
+	Allocation.ThreadId = ThreadId;
+	Allocation.CallstackId = AddCallstack(Frames, NumFrames);
+
+	double FreeTime;
+	if (EarlyFrees.RemoveAndCopyValue(Id, FreeTime))
+	{
+		Allocation.FreeTime = FreeTime;
+	}
+	else
+	{
+		LiveAllocations.Add(Id, Allocations.Num() - 1);
+	}
+}
+
+void FMemorySamplingProvider::AddFree(uint32 Id, double Time)
+{
+	Session.WriteAccessCheck();
+
+	uint64 AllocationIndex;
+	if (LiveAllocations.RemoveAndCopyValue(Id, AllocationIndex))
+	{
+		Allocations[AllocationIndex].FreeTime = Time;
+	}
+	else
+	{
+		EarlyFrees.Add(Id, Time);
+	}
+}
+
+TArrayView<const uint64> FMemorySamplingProvider::GetCallstack(uint32 CallstackId) const
+{
+	Session.ReadAccessCheck();
+
+	return Callstacks.IsValidIndex(CallstackId) ? Callstacks[CallstackId] : TArrayView<const uint64>();
+}
+
+const TCHAR* FMemorySamplingProvider::GetSymbolName(uint64 Address) const
+{
+	Session.ReadAccessCheck();
+
+	const TCHAR* const* Name = SymbolMap.Find(Address);
+	return Name ? *Name : nullptr;
+}
+
+void FMemorySamplingProvider::EnumerateAllocations(double IntervalStart, double IntervalEnd, TFunctionRef<void(const FMemorySamplingAllocation&)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	// Allocations are stored in the order they were analyzed, which is only roughly in time order across threads.
+	for (uint64 Index = 0; Index < Allocations.Num(); ++Index)
+	{
+		const FMemorySamplingAllocation& Allocation = Allocations[Index];
+		if (Allocation.AllocTime >= IntervalStart && Allocation.AllocTime <= IntervalEnd)
+		{
+			Callback(Allocation);
+		}
+	}
+}
+
+void FMemorySamplingProvider::GetEstimatedLiveTotals(double Time, double& OutCount, double& OutBytes) const
+{
+	Session.ReadAccessCheck();
+
+	OutCount = 0.0;
+	OutBytes = 0.0;
+	for (uint64 Index = 0; Index < Allocations.Num(); ++Index)
+	{
+		const FMemorySamplingAllocation& Allocation = Allocations[Index];
+		if (Allocation.AllocTime <= Time && Allocation.FreeTime > Time)
+		{
+			OutCount += Allocation.SampleInterval;
+			OutBytes += double(Allocation.Size) * Allocation.SampleInterval;
+		}
+	}
+}
+
+void FMemorySamplingProvider::GetGrowthByCallstack(double IntervalStart, double IntervalEnd, TArray<FMemorySamplingCallstackStats>& OutStats) const
+{
+	Session.ReadAccessCheck();
+
+	OutStats.Reset();
+
+	TMap<uint32, int32> CallstackToStatsIndex;
+	TArray<double> TotalLifetimes;
+	EnumerateAllocations(IntervalStart, IntervalEnd, [this, IntervalEnd, &OutStats, &CallstackToStatsIndex, &TotalLifetimes](const FMemorySamplingAllocation& Allocation)
+	{
+		int32& StatsIndex = CallstackToStatsIndex.FindOrAdd(Allocation.CallstackId, INDEX_NONE);
+		if (StatsIndex == INDEX_NONE)
+		{
+			StatsIndex = OutStats.AddDefaulted();
+			TotalLifetimes.Add(0.0);
+			OutStats[StatsIndex].CallstackId = Allocation.CallstackId;
+			OutStats[StatsIndex].Frames = Callstacks[Allocation.CallstackId];
+		}
+
+		FMemorySamplingCallstackStats& Stats = OutStats[StatsIndex];
+		++Stats.SampleCount;
+		if (Allocation.FreeTime > IntervalEnd)
+		{
+			Stats.EstimatedCount += Allocation.SampleInterval;
+			Stats.EstimatedBytes += double(Allocation.Size) * Allocation.SampleInterval;
+		}
+		else
+		{
+			++Stats.FreedSampleCount;
+			TotalLifetimes[StatsIndex] += Allocation.FreeTime - Allocation.AllocTime;
+		}
+	});
+
+	for (int32 StatsIndex = 0; StatsIndex < OutStats.Num(); ++StatsIndex)
+	{
+		FMemorySamplingCallstackStats& Stats = OutStats[StatsIndex];
+		if (Stats.FreedSampleCount)
+		{
+			Stats.AverageLifetime = TotalLifetimes[StatsIndex] / double(Stats.FreedSampleCount);
+		}
+	}
+
+	OutStats.Sort([](const FMemorySamplingCallstackStats& A, const FMemorySamplingCallstackStats& B)
+	{
+		return A.EstimatedBytes > B.EstimatedBytes;
+	});
+}
+
+}
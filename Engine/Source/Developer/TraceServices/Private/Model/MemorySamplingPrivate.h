@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "TraceServices/Model/MemorySampling.h"
+#include "Common/PagedArray.h"
+#include "Containers/Map.h"
+
+namespace Trace
+{
+
+class FMemorySamplingProvider
+	: public IMemorySamplingProvider
+{
+public:
+	explicit FMemorySamplingProvider(IAnalysisSession& Session);
+	void AddSymbol(uint64 Address, const TCHAR* Name);
+	void AddAlloc(uint32 Id, double Time, uint64 Address, uint64 Size, uint32 SampleInterval, uint32 ThreadId, const uint64* Frames, uint32 NumFrames);
+	void AddFree(uint32 Id, double Time);
+	virtual uint64 GetSampleCount() const override { return Allocations.Num(); }
+	virtual TArrayView<const uint64> GetCallstack(uint32 CallstackId) const override;
+	virtual const TCHAR* GetSymbolName(uint64 Address) const override;
+	virtual void EnumerateAllocations(double IntervalStart, double IntervalEnd, TFunctionRef<void(const FMemorySamplingAllocation&)> Callback) const override;
+	virtual void GetEstimatedLiveTotals(double Time, double& OutCount, double& OutBytes) const override;
+	virtual void GetGrowthByCallstack(double IntervalStart, double IntervalEnd, TArray<FMemorySamplingCallstackStats>& OutStats) const override;
+
+private:
+	uint32 AddCallstack(const uint64* Frames, uint32 NumFrames);
+
+	IAnalysisSession& Session;
+	TPagedArray<FMemorySamplingAllocation> Allocations;
+	TArray<TArrayView<const uint64>> Callstacks;
+	TMultiMap<uint32, uint32> CallstackHashToId;
+	TMap<uint64, const TCHAR*> SymbolMap;
+
+	// Allocations which haven't been freed yet, by the id the runtime gave them. Events from different threads may be
+	// analyzed out of order, so a free can also arrive before its allocation.
+	TMap<uint32, uint64> LiveAllocations;
+	TMap<uint32, double> EarlyFrees;
+};
+
+}
@@ -0,0 +1,433 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TraceServices/Model/TaskGraph.h"
+#include "Model/TaskGraphPrivate.h"
+#include "Model/TimingProfilerPrivate.h"
+#include "AnalysisServicePrivate.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Reverse.h"
+
+namespace Trace
+{
+
+FTaskGraphProvider::FTaskGraphProvider(IAnalysisSession& InSession, const FTimingProfilerProvider& InTimingProfilerProvider)
+	: Session(InSession)
+	, TimingProfilerProvider(InTimingProfilerProvider)
+	, Tasks(InSession.GetLinearAllocator(), 4096)
+{
+}
+
+FTaskGraphProvider::~FTaskGraphProvider()
+{
+	for (auto& KV : ThreadActivities)
+	{
+		delete KV.Value;
+	}
+}
+
+FTaskGraphTask& FTaskGraphProvider::GetOrAddTask(uint64 TaskId)
+{
+	// Events of the same task come from different threads, so any of them may be the first one analyzed
+	if (const uint64* Index = TaskIdToIndex.Find(TaskId))
+	{
+		return Tasks[*Index];
+	}
+
+	FTaskGraphTask& Task = Tasks.PushBack();
+	Task.Id = TaskId;
+	TaskIdToIndex.Add(TaskId, Tasks.Num() - 1);
+	return Task;
+}
+
+FTaskGraphProvider::FThreadActivity& FTaskGraphProvider::GetThreadActivity(uint32 ThreadId)
+{
+	FThreadActivity*& Activity = ThreadActivities.FindOrAdd(ThreadId);
+	if (Activity == nullptr)
+	{
+		Activity = new FThreadActivity();
+	}
+	return *Activity;
+}
+
+void FTaskGraphProvider::TaskCreated(uint64 TaskId, uint64 CompletesTaskId, uint32 ThreadToExecuteOn, uint32 ThreadId, double Time)
+{
+	Session.WriteAccessCheck();
+
+	FTaskGraphTask& Task = GetOrAddTask(TaskId);
+	Task.CompletesTaskId = CompletesTaskId;
+	Task.ThreadToExecuteOn = ThreadToExecuteOn;
+	Task.CreatedThreadId = ThreadId;
+	Task.CreatedTime = Time;
+
+	if (CompletesTaskId)
+	{
+		CompletesTaskIdToGatherTaskId.Add(CompletesTaskId, TaskId);
+	}
+}
+
+void FTaskGraphProvider::AddPrerequisite(uint64 TaskId, uint64 PrerequisiteTaskId)
+{
+	Session.WriteAccessCheck();
+
+	// The array's storage doesn't move when the map grows, so the task can keep a view of it
+	TArray<uint64>& Prerequisites = PrerequisiteMap.FindOrAdd(TaskId);
+	Prerequisites.Add(PrerequisiteTaskId);
+	GetOrAddTask(TaskId).Prerequisites = Prerequisites;
+}
+
+void FTaskGraphProvider::TaskStarted(uint64 TaskId, uint32 ThreadId, double Time)
+{
+	Session.WriteAccessCheck();
+
+	FTaskGraphTask& Task = GetOrAddTask(TaskId);
+	Task.ExecutedThreadId = ThreadId;
+	Task.StartedTime = Time;
+
+	FThreadActivity& Activity = GetThreadActivity(ThreadId);
+	FExecution& Execution = Activity.Executions.AddDefaulted_GetRef();
+	Execution.TaskId = TaskId;
+	Execution.StartedTime = Time;
+	Execution.FinishedTime = DBL_MAX;
+	Execution.Depth = Activity.OpenExecutions.Num();
+	Activity.OpenExecutions.Push(Activity.Executions.Num() - 1);
+}
+
+void FTaskGraphProvider::TaskFinished(uint64 TaskId, uint32 ThreadId, double Time)
+{
+	Session.WriteAccessCheck();
+
+	GetOrAddTask(TaskId).FinishedTime = Time;
+
+	FThreadActivity& Activity = GetThreadActivity(ThreadId);
+	if (Activity.OpenExecutions.Num() && Activity.Executions[Activity.OpenExecutions.Last()].TaskId == TaskId)
+	{
+		Activity.Executions[Activity.OpenExecutions.Pop(false)].FinishedTime = Time;
+	}
+}
+
+void FTaskGraphProvider::TaskCompleted(uint64 TaskId, double Time)
+{
+	Session.WriteAccessCheck();
+
+	GetOrAddTask(TaskId).CompletedTime = Time;
+}
+
+void FTaskGraphProvider::AddWait(uint32 ThreadId, double StartTime, double EndTime, const uint64* TaskIds, uint32 NumTaskIds)
+{
+	Session.WriteAccessCheck();
+
+	uint64* StoredTaskIds = reinterpret_cast<uint64*>(Session.GetLinearAllocator().Allocate(NumTaskIds * sizeof(uint64)));
+	FMemory::Memcpy(StoredTaskIds, TaskIds, NumTaskIds * sizeof(uint64));
+
+	FWait& Wait = GetThreadActivity(ThreadId).Waits.AddDefaulted_GetRef();
+	Wait.StartTime = StartTime;
+	Wait.EndTime = EndTime;
+	Wait.TaskIds = TArrayView<const uint64>(StoredTaskIds, NumTaskIds);
+}
+
+const FTaskGraphTask* FTaskGraphProvider::GetTask(uint64 TaskId) const
+{
+	Session.ReadAccessCheck();
+
+	const uint64* Index = TaskIdToIndex.Find(TaskId);
+	return Index ? &Tasks[*Index] : nullptr;
+}
+
+const TCHAR* FTaskGraphProvider::GetTaskName(const FTaskGraphTask& Task) const
+{
+	Session.ReadAccessCheck();
+
+	const TCHAR* Name = nullptr;
+	uint32 TimelineIndex;
+	if (Task.StartedTime > 0.0 && TimingProfilerProvider.GetCpuThreadTimelineIndex(Task.ExecutedThreadId, TimelineIndex))
+	{
+		TimingProfilerProvider.ReadTimeline(TimelineIndex, [this, &Task, &Name](const ITimingProfilerProvider::Timeline& Timeline)
+		{
+			Timeline.EnumerateEvents(Task.StartedTime, Task.FinishedTime, [this, &Task, &Name](bool bIsEnter, double Time, const FTimingProfilerEvent& Event)
+			{
+				// Scopes which were already open when the task started are reported first, skip those
+				if (bIsEnter && Time >= Task.StartedTime)
+				{
+					if (const FTimingProfilerTimer* Timer = TimingProfilerProvider.GetTimer(Event.TimerIndex))
+					{
+						Name = Timer->Name;
+					}
+					return EEventEnumerate::Stop;
+				}
+				return EEventEnumerate::Continue;
+			});
+		});
+	}
+	return Name;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+class FTaskGraphProvider::FCriticalPathBuilder
+{
+public:
+	FCriticalPathBuilder(const FTaskGraphProvider& InProvider, TArray<FTaskGraphCriticalPathSegment>& InSegments)
+		: Provider(InProvider)
+		, Segments(InSegments)
+	{
+	}
+
+	/**
+	 * Adds the segments of the thread from Time back to Bound. OwnerTaskId is the task the thread is executing over the
+	 * whole range, zero when walking the thread's own code. Waits for tasks are followed into the task chain they
+	 * waited for.
+	 */
+	void WalkThread(uint32 ThreadId, double Time, double Bound, uint64 OwnerTaskId)
+	{
+		const FThreadActivity* Activity = Provider.FindThreadActivity(ThreadId);
+		while (Time > Bound && StepsLeft-- > 0)
+		{
+			const FWait* Wait = Activity ? FindLastWaitEndingIn(*Activity, Bound, Time) : nullptr;
+			if (Wait == nullptr)
+			{
+				break;
+			}
+
+			AddThreadWork(ThreadId, Wait->EndTime, Time, OwnerTaskId);
+
+			const double WaitStart = FMath::Max(Wait->StartTime, Bound);
+			double Reached = Wait->EndTime;
+			if (const FTaskGraphTask* Task = FindLastCompleted(*Wait))
+			{
+				// Time between the task completing and this thread resuming
+				const double CompletedTime = FMath::Clamp(Task->CompletedTime, WaitStart, Wait->EndTime);
+				AddSegment(ETaskGraphCriticalPathSegmentType::Waiting, CompletedTime, Wait->EndTime, ThreadId, OwnerTaskId);
+				Reached = WalkTaskChain(Task, CompletedTime, WaitStart, ThreadId);
+			}
+
+			// Whatever the chain couldn't explain, e.g. a task created by untraced code
+			AddSegment(ETaskGraphCriticalPathSegmentType::Waiting, WaitStart, Reached, ThreadId, OwnerTaskId);
+			Time = WaitStart;
+		}
+
+		AddThreadWork(ThreadId, Bound, Time, OwnerTaskId);
+	}
+
+	void Finish()
+	{
+		Algo::Reverse(Segments);
+	}
+
+private:
+	/**
+	 * Follows what held up the task from EndTime back to Bound: its own execution, then the last prerequisite to
+	 * complete or, if it was created after that, whatever created it.
+	 * @return How far back the chain was followed, Bound unless the chain was lost.
+	 */
+	double WalkTaskChain(const FTaskGraphTask* Task, double EndTime, double Bound, uint32 WaitingThreadId)
+	{
+		while (Task != nullptr && StepsLeft-- > 0)
+		{
+			if (Task->StartedTime <= 0.0 || Task->FinishedTime <= 0.0)
+			{
+				return EndTime;
+			}
+
+			// Completion held back by DontCompleteUntil, the event fired once the gather task ran
+			if (EndTime > Task->FinishedTime)
+			{
+				const uint64* GatherTaskId = Provider.CompletesTaskIdToGatherTaskId.Find(Task->Id);
+				const FTaskGraphTask* GatherTask = GatherTaskId ? Provider.GetTask(*GatherTaskId) : nullptr;
+				if (GatherTask && GatherTask->FinishedTime > 0.0 && GatherTask->FinishedTime <= EndTime)
+				{
+					Task = GatherTask;
+					continue;
+				}
+			}
+
+			const double ExecutionEnd = FMath::Min(EndTime, Task->FinishedTime);
+			AddSegment(ETaskGraphCriticalPathSegmentType::Task, ExecutionEnd, EndTime, Task->ExecutedThreadId, Task->Id);
+			WalkThread(Task->ExecutedThreadId, ExecutionEnd, FMath::Max(Task->StartedTime, Bound), Task->Id);
+			if (Task->StartedTime <= Bound)
+			{
+				return Bound;
+			}
+
+			// Ready once the last prerequisite completed, or once it was created if that was later
+			double ReadyTime = Task->CreatedTime > 0.0 ? Task->CreatedTime : Task->StartedTime;
+			const FTaskGraphTask* LastPrerequisite = nullptr;
+			for (uint64 PrerequisiteId : Task->Prerequisites)
+			{
+				const FTaskGraphTask* Prerequisite = Provider.GetTask(PrerequisiteId);
+				if (Prerequisite && Prerequisite->CompletedTime > ReadyTime && Prerequisite->CompletedTime <= Task->StartedTime)
+				{
+					ReadyTime = Prerequisite->CompletedTime;
+					LastPrerequisite = Prerequisite;
+				}
+			}
+
+			AddSegment(ETaskGraphCriticalPathSegmentType::Queued, FMath::Max(ReadyTime, Bound), Task->StartedTime, 0, Task->Id);
+			if (ReadyTime <= Bound)
+			{
+				return Bound;
+			}
+
+			if (LastPrerequisite)
+			{
+				Task = LastPrerequisite;
+				EndTime = ReadyTime;
+				continue;
+			}
+
+			// A gather task is created as the task it completes finishes
+			if (Task->CompletesTaskId)
+			{
+				const FTaskGraphTask* CompletedTask = Provider.GetTask(Task->CompletesTaskId);
+				if (CompletedTask == nullptr)
+				{
+					return ReadyTime;
+				}
+				Task = CompletedTask;
+				EndTime = FMath::Min(ReadyTime, CompletedTask->FinishedTime);
+				continue;
+			}
+
+			// Created by another task, continue in that task up to the point it created this one
+			const FThreadActivity* CreatorActivity = Provider.FindThreadActivity(Task->CreatedThreadId);
+			const FExecution* Creator = CreatorActivity ? FindExecutionAt(*CreatorActivity, ReadyTime) : nullptr;
+			if (Creator)
+			{
+				Task = Provider.GetTask(Creator->TaskId);
+				EndTime = ReadyTime;
+				continue;
+			}
+
+			// Created by a thread's own code. The waiting thread carries on from the start of its wait by itself.
+			if (Task->CreatedThreadId == WaitingThreadId)
+			{
+				return ReadyTime;
+			}
+
+			WalkThread(Task->CreatedThreadId, ReadyTime, Bound, 0);
+			return Bound;
+		}
+
+		return EndTime;
+	}
+
+	/** Adds the thread's work between the two times, split into the tasks it executed if it doesn't have an owner */
+	void AddThreadWork(uint32 ThreadId, double StartTime, double EndTime, uint64 OwnerTaskId)
+	{
+		const FThreadActivity* Activity = Provider.FindThreadActivity(ThreadId);
+		if (OwnerTaskId || Activity == nullptr)
+		{
+			AddSegment(OwnerTaskId ? ETaskGraphCriticalPathSegmentType::Task : ETaskGraphCriticalPathSegmentType::Thread, StartTime, EndTime, ThreadId, OwnerTaskId);
+			return;
+		}
+
+		double Cursor = EndTime;
+		const TArray<FExecution>& Executions = Activity->Executions;
+		for (int32 Index = Algo::UpperBoundBy(Executions, EndTime, &FExecution::StartedTime) - 1; Index >= 0; --Index)
+		{
+			const FExecution& Execution = Executions[Index];
+			if (Execution.Depth != 0)
+			{
+				continue;
+			}
+			if (Execution.FinishedTime <= StartTime)
+			{
+				break;
+			}
+
+			const double ExecutionStart = FMath::Max(Execution.StartedTime, StartTime);
+			const double ExecutionEnd = FMath::Min(Execution.FinishedTime, Cursor);
+			AddSegment(ETaskGraphCriticalPathSegmentType::Thread, ExecutionEnd, Cursor, ThreadId, 0);
+			AddSegment(ETaskGraphCriticalPathSegmentType::Task, ExecutionStart, ExecutionEnd, ThreadId, Execution.TaskId);
+			Cursor = ExecutionStart;
+		}
+
+		AddSegment(ETaskGraphCriticalPathSegmentType::Thread, StartTime, Cursor, ThreadId, 0);
+	}
+
+	/** Segments are added latest first, consecutive ones of the same work are merged */
+	void AddSegment(ETaskGraphCriticalPathSegmentType Type, double StartTime, double EndTime, uint32 ThreadId, uint64 TaskId)
+	{
+		if (EndTime <= StartTime)
+		{
+			return;
+		}
+
+		if (Segments.Num())
+		{
+			FTaskGraphCriticalPathSegment& Last = Segments.Last();
+			if (Last.Type == Type && Last.ThreadId == ThreadId && Last.TaskId == TaskId && Last.StartTime <= EndTime)
+			{
+				Last.StartTime = FMath::Min(Last.StartTime, StartTime);
+				return;
+			}
+		}
+
+		FTaskGraphCriticalPathSegment& Segment = Segments.AddDefaulted_GetRef();
+		Segment.Type = Type;
+		Segment.StartTime = StartTime;
+		Segment.EndTime = EndTime;
+		Segment.ThreadId = ThreadId;
+		Segment.TaskId = TaskId;
+		if (const FTaskGraphTask* Task = TaskId ? Provider.GetTask(TaskId) : nullptr)
+		{
+			Segment.Name = Provider.GetTaskName(*Task);
+		}
+	}
+
+	/** The latest wait which ended within (Bound, Time] */
+	static const FWait* FindLastWaitEndingIn(const FThreadActivity& Activity, double Bound, double Time)
+	{
+		const int32 Index = Algo::UpperBoundBy(Activity.Waits, Time, &FWait::EndTime) - 1;
+		return Index >= 0 && Activity.Waits[Index].EndTime > Bound ? &Activity.Waits[Index] : nullptr;
+	}
+
+	/** The innermost task executing at the given time */
+	static const FExecution* FindExecutionAt(const FThreadActivity& Activity, double Time)
+	{
+		for (int32 Index = Algo::LowerBoundBy(Activity.Executions, Time, &FExecution::StartedTime) - 1; Index >= 0; --Index)
+		{
+			const FExecution& Execution = Activity.Executions[Index];
+			if (Execution.FinishedTime >= Time)
+			{
+				return &Execution;
+			}
+			if (Execution.Depth == 0)
+			{
+				break;
+			}
+		}
+		return nullptr;
+	}
+
+	const FTaskGraphTask* FindLastCompleted(const FWait& Wait) const
+	{
+		const FTaskGraphTask* LastCompleted = nullptr;
+		for (uint64 TaskId : Wait.TaskIds)
+		{
+			const FTaskGraphTask* Task = Provider.GetTask(TaskId);
+			if (Task && Task->CompletedTime > 0.0 && (LastCompleted == nullptr || Task->CompletedTime > LastCompleted->CompletedTime))
+			{
+				LastCompleted = Task;
+			}
+		}
+		return LastCompleted;
+	}
+
+	const FTaskGraphProvider& Provider;
+	TArray<FTaskGraphCriticalPathSegment>& Segments;
+
+	// Guards against cycles in broken or truncated traces
+	int32 StepsLeft = 1 << 20;
+};
+
+void FTaskGraphProvider::GetCriticalPath(uint32 ThreadId, double IntervalStart, double IntervalEnd, TArray<FTaskGraphCriticalPathSegment>& OutSegments) const
+{
+	Session.ReadAccessCheck();
+
+	OutSegments.Reset();
+	FCriticalPathBuilder Builder(*this, OutSegments);
+	Builder.WalkThread(ThreadId, IntervalEnd, IntervalStart, 0);
+	Builder.Finish();
+}
+
+}
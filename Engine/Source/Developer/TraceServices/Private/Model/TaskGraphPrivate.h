@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "TraceServices/Model/TaskGraph.h"
+#include "Common/PagedArray.h"
+#include "Containers/Map.h"
+
+namespace Trace
+{
+
+class FTimingProfilerProvider;
+
+class FTaskGraphProvider
+	: public ITaskGraphProvider
+{
+public:
+	FTaskGraphProvider(IAnalysisSession& Session, const FTimingProfilerProvider& TimingProfilerProvider);
+	virtual ~FTaskGraphProvider();
+	void TaskCreated(uint64 TaskId, uint64 CompletesTaskId, uint32 ThreadToExecuteOn, uint32 ThreadId, double Time);
+	void AddPrerequisite(uint64 TaskId, uint64 PrerequisiteTaskId);
+	void TaskStarted(uint64 TaskId, uint32 ThreadId, double Time);
+	void TaskFinished(uint64 TaskId, uint32 ThreadId, double Time);
+	void TaskCompleted(uint64 TaskId, double Time);
+	void AddWait(uint32 ThreadId, double StartTime, double EndTime, const uint64* TaskIds, uint32 NumTaskIds);
+	virtual uint64 GetTaskCount() const override { return Tasks.Num(); }
+	virtual const FTaskGraphTask* GetTask(uint64 TaskId) const override;
+	virtual const TCHAR* GetTaskName(const FTaskGraphTask& Task) const override;
+	virtual void GetCriticalPath(uint32 ThreadId, double IntervalStart, double IntervalEnd, TArray<FTaskGraphCriticalPathSegment>& OutSegments) const override;
+
+private:
+	struct FWait
+	{
+		double StartTime;
+		double EndTime;
+		TArrayView<const uint64> TaskIds;
+	};
+
+	struct FExecution
+	{
+		uint64 TaskId;
+		double StartedTime;
+		double FinishedTime;
+		uint32 Depth; // Named threads run other tasks while they wait, so executions can nest
+	};
+
+	// Events of a thread are analyzed in order, so executions are sorted by start time and waits by end time.
+	struct FThreadActivity
+	{
+		TArray<FExecution> Executions;
+		TArray<FWait> Waits;
+		TArray<int32> OpenExecutions;
+	};
+
+	class FCriticalPathBuilder;
+
+	FTaskGraphTask& GetOrAddTask(uint64 TaskId);
+	FThreadActivity& GetThreadActivity(uint32 ThreadId);
+	const FThreadActivity* FindThreadActivity(uint32 ThreadId) const { return ThreadActivities.FindRef(ThreadId); }
+
+	IAnalysisSession& Session;
+	const FTimingProfilerProvider& TimingProfilerProvider;
+	TPagedArray<FTaskGraphTask> Tasks;
+	TMap<uint64, uint64> TaskIdToIndex;
+	TMap<uint64, uint64> CompletesTaskIdToGatherTaskId;
+	TMap<uint64, TArray<uint64>> PrerequisiteMap;
+	TMap<uint32, FThreadActivity*> ThreadActivities;
+};
+
+}
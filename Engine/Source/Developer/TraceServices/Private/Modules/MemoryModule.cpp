@@ -3,7 +3,9 @@
 #include "MemoryModule.h"
 #include "Analyzers/AllocationsAnalysis.h"
 #include "Analyzers/MemoryAnalysis.h"
+#include "Analyzers/MemorySamplingTraceAnalysis.h"
 #include "Model/AllocationsProvider.h"
+#include "Model/MemorySamplingPrivate.h"
 #include "TraceServices/Model/AnalysisSession.h"
 
 #if defined(UE_USE_ALLOCATIONS_PROVIDER)
@@ -83,6 +85,7 @@ namespace Trace
 {
 
 static const FName MemoryModuleName("TraceModule_Memory");
+static const FName MemorySamplingProviderName("MemorySamplingProvider");
 
 void FMemoryModule::GetModuleInfo(FModuleInfo& OutModuleInfo)
 {
@@ -101,11 +104,21 @@ void FMemoryModule::OnAnalysisBegin(IAnalysisSession& Session)
 #endif // UE_USE_ALLOCATIONS_PROVIDER
 
 	Session.AddAnalyzer(new FMemoryAnalyzer(Session));
+
+	FMemorySamplingProvider* MemorySamplingProvider = new FMemorySamplingProvider(Session);
+	Session.AddProvider(MemorySamplingProviderName, MemorySamplingProvider);
+	Session.AddAnalyzer(new FMemorySamplingAnalyzer(Session, *MemorySamplingProvider));
 }
 
 void FMemoryModule::GetLoggers(TArray<const TCHAR *>& OutLoggers)
 {
 	OutLoggers.Add(TEXT("Memory"));
+	OutLoggers.Add(TEXT("MemSampling"));
+}
+
+const IMemorySamplingProvider* ReadMemorySamplingProvider(const IAnalysisSession& Session)
+{
+	return Session.ReadProvider<IMemorySamplingProvider>(MemorySamplingProviderName);
 }
 
 }
@@ -2,8 +2,12 @@
 
 #include "TimingProfilerModule.h"
 #include "Analyzers/CpuProfilerTraceAnalysis.h"
+#include "Analyzers/CpuSamplingTraceAnalysis.h"
 #include "Analyzers/GpuProfilerTraceAnalysis.h"
+#include "Analyzers/TaskGraphTraceAnalysis.h"
 #include "AnalysisServicePrivate.h"
+#include "Model/CpuSamplingPrivate.h"
+#include "Model/TaskGraphPrivate.h"
 #include "Model/ThreadsPrivate.h"
 #include "Model/TimingProfilerPrivate.h"
 
@@ -12,6 +16,8 @@ namespace Trace
 
 static const FName TimingProfilerModuleName("TraceModule_TimingProfiler");
 static const FName TimingProfilerProviderName("TimingProfilerProvider");
+static const FName CpuSamplingProviderName("CpuSamplingProvider");
+static const FName TaskGraphProviderName("TaskGraphProvider");
 
 void FTimingProfilerModule::GetModuleInfo(FModuleInfo& OutModuleInfo)
 {
@@ -30,12 +36,22 @@ void FTimingProfilerModule::OnAnalysisBegin(IAnalysisSession& InSession)
 	Session.AddProvider(TimingProfilerProviderName, TimingProfilerProvider);
 	Session.AddAnalyzer(new FCpuProfilerAnalyzer(Session, *TimingProfilerProvider, *ThreadProvider));
 	Session.AddAnalyzer(new FGpuProfilerAnalyzer(Session, *TimingProfilerProvider));
+
+	FCpuSamplingProvider* CpuSamplingProvider = new FCpuSamplingProvider(Session, *TimingProfilerProvider);
+	Session.AddProvider(CpuSamplingProviderName, CpuSamplingProvider);
+	Session.AddAnalyzer(new FCpuSamplingAnalyzer(Session, *CpuSamplingProvider));
+
+	FTaskGraphProvider* TaskGraphProvider = new FTaskGraphProvider(Session, *TimingProfilerProvider);
+	Session.AddProvider(TaskGraphProviderName, TaskGraphProvider);
+	Session.AddAnalyzer(new FTaskGraphAnalyzer(Session, *TaskGraphProvider));
 }
 
 void FTimingProfilerModule::GetLoggers(TArray<const TCHAR *>& OutLoggers)
 {
 	OutLoggers.Add(TEXT("CpuProfiler"));
 	OutLoggers.Add(TEXT("GpuProfiler"));
+	OutLoggers.Add(TEXT("CpuSampling"));
+	OutLoggers.Add(TEXT("TaskGraph"));
 }
 
 const ITimingProfilerProvider* ReadTimingProfilerProvider(const IAnalysisSession& Session)
@@ -43,4 +59,14 @@ const ITimingProfilerProvider* ReadTimingProfilerProvider(const IAnalysisSession
 	return Session.ReadProvider<ITimingProfilerProvider>(TimingProfilerProviderName);
 }
 
+const ICpuSamplingProvider* ReadCpuSamplingProvider(const IAnalysisSession& Session)
+{
+	return Session.ReadProvider<ICpuSamplingProvider>(CpuSamplingProviderName);
+}
+
+const ITaskGraphProvider* ReadTaskGraphProvider(const IAnalysisSession& Session)
+{
+	return Session.ReadProvider<ITaskGraphProvider>(TaskGraphProviderName);
+}
+
 }
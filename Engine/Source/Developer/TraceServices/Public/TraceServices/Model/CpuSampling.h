@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "TraceServices/Model/AnalysisSession.h"
+#include "TraceServices/Model/TimingProfiler.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Templates/Function.h"
+
+namespace Trace
+{
+
+struct FCpuSample
+{
+	double Time = 0.0;
+	uint32 ThreadId = 0;
+	TArrayView<const uint64> Frames; // Innermost frame first
+};
+
+struct FCpuSamplingFlameGraphNode
+{
+	// Nodes are either an instrumented scope (Timer is set) or a sampled callstack frame (Address is set).
+	const FTimingProfilerTimer* Timer = nullptr;
+	uint64 Address = 0;
+	const TCHAR* Name = nullptr;
+	uint64 InclusiveCount = 0;
+	uint64 ExclusiveCount = 0;
+	const FCpuSamplingFlameGraphNode* Parent = nullptr;
+	TArray<FCpuSamplingFlameGraphNode*> Children;
+};
+
+class ICpuSamplingFlameGraph
+{
+public:
+	virtual ~ICpuSamplingFlameGraph() = default;
+	virtual const FCpuSamplingFlameGraphNode& GetRoot() const = 0;
+};
+
+class ICpuSamplingProvider
+	: public IProvider
+{
+public:
+	virtual ~ICpuSamplingProvider() = default;
+	virtual uint64 GetSampleCount() const = 0;
+	virtual void EnumerateSamples(uint32 ThreadId, double IntervalStart, double IntervalEnd, TFunctionRef<void(const FCpuSample&)> Callback) const = 0;
+	virtual const TCHAR* GetSymbolName(uint64 Address) const = 0;
+
+	/**
+	 * Aggregates the samples of the threads passing the filter into a single tree. Each sample is placed below the
+	 * instrumented scopes (CPU timing events) which were active on its thread at the time it was taken, followed by
+	 * its callstack frames, so untimed code shows up within the scope it ran in. Counts are in samples.
+	 */
+	virtual ICpuSamplingFlameGraph* CreateFlameGraph(double IntervalStart, double IntervalEnd, TFunctionRef<bool(uint32)> ThreadFilter) const = 0;
+};
+
+TRACESERVICES_API const ICpuSamplingProvider* ReadCpuSamplingProvider(const IAnalysisSession& Session);
+
+}
@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "TraceServices/Model/AnalysisSession.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Templates/Function.h"
+
+namespace Trace
+{
+
+struct FMemorySamplingAllocation
+{
+	uint64 Address = 0;
+	uint64 Size = 0;
+	double AllocTime = 0.0;
+	double FreeTime = 0.0; // DBL_MAX while the allocation is live
+	uint32 SampleInterval = 1; // The sample stands for this many allocations
+	uint32 ThreadId = 0; // 0 if the allocating thread wasn't announced in the trace
+	uint32 CallstackId = 0;
+};
+
+struct FMemorySamplingCallstackStats
+{
+	uint32 CallstackId = 0;
+	TArrayView<const uint64> Frames; // Innermost frame first
+	uint64 SampleCount = 0;
+
+	// Estimated number and size of the allocations made from this callstack which are still live at the end of the
+	// interval, i.e. each sample scaled by its sample interval.
+	double EstimatedCount = 0.0;
+	double EstimatedBytes = 0.0;
+
+	// Samples from this callstack which were freed within the interval, and their average lifetime in seconds.
+	uint64 FreedSampleCount = 0;
+	double AverageLifetime = 0.0;
+};
+
+class IMemorySamplingProvider
+	: public IProvider
+{
+public:
+	virtual ~IMemorySamplingProvider() = default;
+	virtual uint64 GetSampleCount() const = 0;
+	virtual TArrayView<const uint64> GetCallstack(uint32 CallstackId) const = 0;
+	virtual const TCHAR* GetSymbolName(uint64 Address) const = 0;
+
+	/** Enumerates the sampled allocations made within the interval, in no particular order. */
+	virtual void EnumerateAllocations(double IntervalStart, double IntervalEnd, TFunctionRef<void(const FMemorySamplingAllocation&)> Callback) const = 0;
+
+	/** Estimated number and total size of all live allocations at the given time. */
+	virtual void GetEstimatedLiveTotals(double Time, double& OutCount, double& OutBytes) const = 0;
+
+	/**
+	 * Groups the allocations made within the interval by callstack, sorted by the estimated bytes still live at the end
+	 * of the interval. With IntervalStart at the start of the session this is a breakdown of live memory, with a later
+	 * start it shows where memory grew.
+	 */
+	virtual void GetGrowthByCallstack(double IntervalStart, double IntervalEnd, TArray<FMemorySamplingCallstackStats>& OutStats) const = 0;
+};
+
+TRACESERVICES_API const IMemorySamplingProvider* ReadMemorySamplingProvider(const IAnalysisSession& Session);
+
+}
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "TraceServices/Model/AnalysisSession.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+
+namespace Trace
+{
+
+struct FTaskGraphTask
+{
+	uint64 Id = 0;
+	uint64 CompletesTaskId = 0; // For DontCompleteUntil gather tasks, the task whose completion event they fire
+	uint32 ThreadToExecuteOn = 0; // ENamedThreads value the task was queued for
+	uint32 CreatedThreadId = 0;
+	uint32 ExecutedThreadId = 0;
+	double CreatedTime = 0.0;
+	double StartedTime = 0.0;
+	double FinishedTime = 0.0;
+	double CompletedTime = 0.0; // When its completion event fired, after FinishedTime if it used DontCompleteUntil
+	TArrayView<const uint64> Prerequisites;
+};
+
+enum class ETaskGraphCriticalPathSegmentType : uint8
+{
+	Thread, // Work of the thread outside of any traced task
+	Task, // Execution of a task
+	Queued, // The task was ready to run but no thread picked it up yet
+	Waiting, // The thread was blocked without a traced cause, or was slow to resume after the wait was satisfied
+};
+
+struct FTaskGraphCriticalPathSegment
+{
+	ETaskGraphCriticalPathSegmentType Type = ETaskGraphCriticalPathSegmentType::Thread;
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+	uint32 ThreadId = 0; // Zero for queued segments
+	uint64 TaskId = 0;
+	const TCHAR* Name = nullptr; // The task's outermost CPU timing event, if there is one
+};
+
+class ITaskGraphProvider
+	: public IProvider
+{
+public:
+	virtual ~ITaskGraphProvider() = default;
+	virtual uint64 GetTaskCount() const = 0;
+	virtual const FTaskGraphTask* GetTask(uint64 TaskId) const = 0;
+
+	/** @return The name of the outermost CPU timing event within the task's execution, or null. */
+	virtual const TCHAR* GetTaskName(const FTaskGraphTask& Task) const = 0;
+
+	/**
+	 * Walks back from the end of the interval on the given thread, following each wait for tasks to the task which
+	 * completed last, then that task's latest finishing prerequisite (or the task which created it) and so on. The
+	 * result is the chain of work which the interval's length depended on, in time order and covering the interval.
+	 * For the critical path of a frame pass the game thread and the frame's start and end times; segments on other
+	 * threads are the dependency chains worth parallelizing or shortening.
+	 */
+	virtual void GetCriticalPath(uint32 ThreadId, double IntervalStart, double IntervalEnd, TArray<FTaskGraphCriticalPathSegment>& OutSegments) const = 0;
+};
+
+TRACESERVICES_API const ITaskGraphProvider* ReadTaskGraphProvider(const IAnalysisSession& Session);
+
+}
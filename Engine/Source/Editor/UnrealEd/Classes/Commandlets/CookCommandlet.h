@@ -77,6 +77,20 @@ class UCookCommandlet
 	/** Cooks for specified targets */
 	bool CookByTheBook(const TArray<ITargetPlatform*>& Platforms);
 
+	/**
+	 * Multi-process cook director (-CookProcessCount=N). Partitions the maps to cook by dependency cluster across N worker
+	 * cook processes sharing the DDC, waits for them, then merges their cooked output and development asset registries
+	 * into OutputDirectory so the iterative cook run by this process afterwards only has to verify and finalize them.
+	 *
+	 * @param  Platforms			Platforms being cooked
+	 * @param  CookMaps				Maps to partition across the workers
+	 * @param  NumWorkers			Number of worker processes to launch
+	 * @param  OutputDirectory		Cooked output directory of this process, containing a [Platform] token
+	 *
+	 * @return true if every worker succeeded, false otherwise (the iterative cook picks up whatever is missing).
+	 */
+	bool RunCookWorkers(const TArray<ITargetPlatform*>& Platforms, const TArray<FString>& CookMaps, int32 NumWorkers, const FString& OutputDirectory);
+
 	/**	Process deferred commands */
 	void ProcessDeferredCommands();
 
@@ -968,9 +968,177 @@ void FAssetRegistryGenerator::Initialize(const TArray<FName> &InStartupPackages)
 	FGameDelegates::Get().GetAssignLayerChunkDelegate() = FAssignLayerChunkDelegate::CreateStatic(AssignLayerChunkDelegate);
 }
 
+void FAssetRegistryGenerator::ComputePackageCookKeys(const FMD5Hash& CookSettingsHash)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAssetRegistryGenerator::ComputePackageCookKeys);
+
+	// Script packages are left out of the graph, referencing one only hashes its name
+	TArray<FName> PackageNames;
+	TMap<FName, int32> PackageIndices;
+	for (const TPair<FName, const FAssetPackageData*>& PackagePair : State.GetAssetPackageDataMap())
+	{
+		if (!FPackageName::IsScriptPackage(PackagePair.Key.ToString()))
+		{
+			PackageIndices.Add(PackagePair.Key, PackageNames.Add(PackagePair.Key));
+		}
+	}
+
+	// Dependencies are sorted by name so that the keys do not depend on the order they were gathered in
+	TArray<TArray<FName>> Dependencies;
+	Dependencies.SetNum(PackageNames.Num());
+	TArray<FAssetIdentifier> DependencyIdentifiers;
+	for (int32 PackageIndex = 0; PackageIndex < PackageNames.Num(); PackageIndex++)
+	{
+		DependencyIdentifiers.Reset();
+		State.GetDependencies(PackageNames[PackageIndex], DependencyIdentifiers, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		for (const FAssetIdentifier& DependencyIdentifier : DependencyIdentifiers)
+		{
+			if (DependencyIdentifier.PackageName != PackageNames[PackageIndex])
+			{
+				Dependencies[PackageIndex].AddUnique(DependencyIdentifier.PackageName);
+			}
+		}
+		Dependencies[PackageIndex].Sort(FNameLexicalLess());
+	}
+
+	auto UpdateName = [](FMD5& Md5, FName Name)
+	{
+		const FString NameString = Name.ToString();
+		Md5.Update(reinterpret_cast<const uint8*>(*NameString), NameString.Len() * sizeof(TCHAR));
+	};
+
+	// Hashes a strongly connected component of the dependency graph once all of its external dependencies have a key
+	TArray<FMD5Hash> CookKeys;
+	CookKeys.SetNum(PackageNames.Num());
+	auto ComputeComponentKey = [&](TArray<int32>& Component)
+	{
+		Component.Sort([&PackageNames](int32 A, int32 B) { return PackageNames[A].LexicalLess(PackageNames[B]); });
+
+		FMD5 Md5;
+		Md5.Update(CookSettingsHash.GetBytes(), CookSettingsHash.GetSize());
+		for (int32 PackageIndex : Component)
+		{
+			UpdateName(Md5, PackageNames[PackageIndex]);
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			const FGuid PackageGuid = State.GetAssetPackageData(PackageNames[PackageIndex])->PackageGuid;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			Md5.Update(reinterpret_cast<const uint8*>(&PackageGuid), sizeof(PackageGuid));
+		}
+		for (int32 PackageIndex : Component)
+		{
+			for (FName Dependency : Dependencies[PackageIndex])
+			{
+				UpdateName(Md5, Dependency);
+				const int32* DependencyIndex = PackageIndices.Find(Dependency);
+				if (DependencyIndex && CookKeys[*DependencyIndex].IsValid())
+				{
+					Md5.Update(CookKeys[*DependencyIndex].GetBytes(), CookKeys[*DependencyIndex].GetSize());
+				}
+			}
+		}
+
+		FMD5Hash ComponentKey;
+		ComponentKey.Set(Md5);
+		for (int32 PackageIndex : Component)
+		{
+			CookKeys[PackageIndex] = ComponentKey;
+		}
+	};
+
+	// Iterative Tarjan, components are completed in dependency order so dependencies are always hashed before their referencers.
+	// Members of the component being hashed have no key yet, so edges inside a cycle only contribute the dependency name.
+	struct FVisit
+	{
+		int32 PackageIndex;
+		int32 NextDependency;
+	};
+	const int32 Unvisited = INDEX_NONE;
+	TArray<int32> VisitOrder;
+	TArray<int32> LowLink;
+	TBitArray<> OnStack(false, PackageNames.Num());
+	VisitOrder.Init(Unvisited, PackageNames.Num());
+	LowLink.Init(Unvisited, PackageNames.Num());
+	TArray<int32> ComponentStack;
+	TArray<FVisit> VisitStack;
+	TArray<int32> Component;
+	int32 NextVisitOrder = 0;
+
+	for (int32 RootIndex = 0; RootIndex < PackageNames.Num(); RootIndex++)
+	{
+		if (VisitOrder[RootIndex] != Unvisited)
+		{
+			continue;
+		}
+
+		VisitStack.Add({ RootIndex, 0 });
+		while (VisitStack.Num())
+		{
+			FVisit& Visit = VisitStack.Last();
+			const int32 PackageIndex = Visit.PackageIndex;
+			if (Visit.NextDependency == 0)
+			{
+				VisitOrder[PackageIndex] = LowLink[PackageIndex] = NextVisitOrder++;
+				ComponentStack.Add(PackageIndex);
+				OnStack[PackageIndex] = true;
+			}
+
+			bool bDescended = false;
+			while (Visit.NextDependency < Dependencies[PackageIndex].Num())
+			{
+				const int32* DependencyIndex = PackageIndices.Find(Dependencies[PackageIndex][Visit.NextDependency++]);
+				if (!DependencyIndex)
+				{
+					continue;
+				}
+				if (VisitOrder[*DependencyIndex] == Unvisited)
+				{
+					// Visit is invalidated by the Add, the dependency's low link is folded in when it is popped
+					VisitStack.Add({ *DependencyIndex, 0 });
+					bDescended = true;
+					break;
+				}
+				if (OnStack[*DependencyIndex])
+				{
+					LowLink[PackageIndex] = FMath::Min(LowLink[PackageIndex], VisitOrder[*DependencyIndex]);
+				}
+			}
+			if (bDescended)
+			{
+				continue;
+			}
+
+			if (LowLink[PackageIndex] == VisitOrder[PackageIndex])
+			{
+				Component.Reset();
+				int32 MemberIndex;
+				do
+				{
+					MemberIndex = ComponentStack.Pop(false);
+					OnStack[MemberIndex] = false;
+					Component.Add(MemberIndex);
+				} while (MemberIndex != PackageIndex);
+				ComputeComponentKey(Component);
+			}
+
+			VisitStack.Pop(false);
+			if (VisitStack.Num())
+			{
+				const int32 ParentIndex = VisitStack.Last().PackageIndex;
+				LowLink[ParentIndex] = FMath::Min(LowLink[ParentIndex], LowLink[PackageIndex]);
+			}
+		}
+	}
+
+	for (int32 PackageIndex = 0; PackageIndex < PackageNames.Num(); PackageIndex++)
+	{
+		State.CreateOrGetAssetPackageData(PackageNames[PackageIndex])->CookKey = CookKeys[PackageIndex];
+	}
+}
+
 void FAssetRegistryGenerator::ComputePackageDifferences(TSet<FName>& ModifiedPackages, TSet<FName>& NewPackages, TSet<FName>& RemovedPackages, TSet<FName>& IdenticalCookedPackages, TSet<FName>& IdenticalUncookedPackages, bool bRecurseModifications, bool bRecurseScriptModifications)
 {
 	TArray<FName> ModifiedScriptPackages;
+	TArray<FName> ModifiedPackagesWithoutCookKey;
 
 	for (const TPair<FName, const FAssetPackageData*>& PackagePair : State.GetAssetPackageDataMap())
 	{
@@ -982,10 +1150,15 @@ void FAssetRegistryGenerator::ComputePackageDifferences(TSet<FName>& ModifiedPac
 		if (!PreviousPackageData)
 		{
 			NewPackages.Add(PackageName);
+			continue;
 		}
+
+		const bool bCompareCookKeys = CurrentPackageData->CookKey.IsValid() && PreviousPackageData->CookKey.IsValid();
 		PRAGMA_DISABLE_DEPRECATION_WARNINGS
-		else if (CurrentPackageData->PackageGuid == PreviousPackageData->PackageGuid)
+		const bool bIdentical = bCompareCookKeys ? CurrentPackageData->CookKey == PreviousPackageData->CookKey : CurrentPackageData->PackageGuid == PreviousPackageData->PackageGuid;
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+		if (bIdentical)
 		{
 			if (PreviousPackageData->DiskSize < 0)
 			{
@@ -1004,10 +1177,14 @@ void FAssetRegistryGenerator::ComputePackageDifferences(TSet<FName>& ModifiedPac
 			}
 			else
 			{
-			ModifiedPackages.Add(PackageName);
+				ModifiedPackages.Add(PackageName);
+				if (!bCompareCookKeys)
+				{
+					ModifiedPackagesWithoutCookKey.Add(PackageName);
+				}
+			}
 		}
 	}
-	}
 
 	for (const TPair<FName, const FAssetPackageData*>& PackagePair : PreviousState.GetAssetPackageDataMap())
 	{
@@ -1024,8 +1201,8 @@ void FAssetRegistryGenerator::ComputePackageDifferences(TSet<FName>& ModifiedPac
 
 	if (bRecurseModifications)
 	{
-		// Recurse modified packages to their dependencies. This is needed because we only compare package guids
-		TArray<FName> ModifiedPackagesToRecurse = ModifiedPackages.Array();
+		// Recurse modified packages to their dependencies. This is needed for packages compared by package guid, cook keys already include the dependencies
+		TArray<FName> ModifiedPackagesToRecurse = MoveTemp(ModifiedPackagesWithoutCookKey);
 
 		if (bRecurseScriptModifications)
 		{
@@ -41,6 +41,8 @@
 #include "HAL/MemoryMisc.h"
 #include "ProfilingDebugging/CookStats.h"
 #include "AssetRegistryModule.h"
+#include "AssetRegistryState.h"
+#include "Serialization/MemoryReader.h"
 #include "StudioAnalytics.h"
 #include "Cooker/CookProfiling.h"
 
@@ -323,6 +325,256 @@ namespace DetailedCookStats
 }
 #endif
 
+namespace CookDirector
+{
+	/** Work assigned to one worker cook process */
+	struct FWorkerPartition
+	{
+		TArray<FString> Maps;
+		TSet<FName> Packages;
+	};
+
+	/** Resolves a map as given on the command line (short name, long package name or filename) to its long package name */
+	static FName ResolveMapPackageName(const FString& MapName)
+	{
+		FString LongPackageName;
+		if (FPackageName::IsValidLongPackageName(MapName))
+		{
+			return FName(*MapName);
+		}
+		if (FPackageName::TryConvertFilenameToLongPackageName(MapName, LongPackageName))
+		{
+			return FName(*LongPackageName);
+		}
+		if (FPackageName::SearchForPackageOnDisk(MapName + FPackageName::GetMapPackageExtension(), &LongPackageName))
+		{
+			return FName(*LongPackageName);
+		}
+		return NAME_None;
+	}
+
+	/** Gathers the packages cooking a map will pull in, i.e. its transitive package dependencies */
+	static void GatherDependencyCluster(const IAssetRegistry& AssetRegistry, FName RootPackageName, TSet<FName>& OutCluster)
+	{
+		TArray<FName> PackagesToVisit;
+		TArray<FName> Dependencies;
+		PackagesToVisit.Add(RootPackageName);
+		while (PackagesToVisit.Num() > 0)
+		{
+			const FName PackageName = PackagesToVisit.Pop(false);
+
+			bool bAlreadyVisited = false;
+			OutCluster.Add(PackageName, &bAlreadyVisited);
+			if (bAlreadyVisited)
+			{
+				continue;
+			}
+
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(PackageName, Dependencies);
+			for (FName Dependency : Dependencies)
+			{
+				if (!FPackageName::IsScriptPackage(Dependency.ToString()))
+				{
+					PackagesToVisit.Add(Dependency);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Splits the maps across NumWorkers partitions. Largest clusters go first, each to the worker whose package count after taking
+	 * it would be lowest, so maps sharing most of their content land on the same worker and shared packages are cooked once.
+	 */
+	static TArray<FWorkerPartition> PartitionMaps(const TArray<FString>& CookMaps, int32 NumWorkers)
+	{
+		IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+		AssetRegistry.SearchAllAssets(true);
+
+		struct FMapCluster
+		{
+			FString MapName;
+			TSet<FName> Packages;
+		};
+
+		TArray<FMapCluster> Clusters;
+		Clusters.Reserve(CookMaps.Num());
+		for (const FString& MapName : CookMaps)
+		{
+			FMapCluster& Cluster = Clusters.AddDefaulted_GetRef();
+			Cluster.MapName = MapName;
+
+			const FName MapPackageName = ResolveMapPackageName(MapName);
+			if (MapPackageName != NAME_None)
+			{
+				GatherDependencyCluster(AssetRegistry, MapPackageName, Cluster.Packages);
+			}
+		}
+
+		Clusters.Sort([](const FMapCluster& A, const FMapCluster& B)
+		{
+			return A.Packages.Num() > B.Packages.Num();
+		});
+
+		TArray<FWorkerPartition> Partitions;
+		Partitions.SetNum(NumWorkers);
+		for (FMapCluster& Cluster : Clusters)
+		{
+			int32 BestWorkerIndex = 0;
+			int32 BestCost = MAX_int32;
+			for (int32 WorkerIndex = 0; WorkerIndex < Partitions.Num(); ++WorkerIndex)
+			{
+				const TSet<FName>& WorkerPackages = Partitions[WorkerIndex].Packages;
+				int32 Cost = WorkerPackages.Num() + 1;
+				for (FName PackageName : Cluster.Packages)
+				{
+					Cost += WorkerPackages.Contains(PackageName) ? 0 : 1;
+				}
+
+				if (Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestWorkerIndex = WorkerIndex;
+				}
+			}
+
+			Partitions[BestWorkerIndex].Maps.Add(MoveTemp(Cluster.MapName));
+			Partitions[BestWorkerIndex].Packages.Append(Cluster.Packages);
+		}
+
+		return Partitions;
+	}
+
+	/** Builds the command line of a worker from the director's switches, replacing the director's own work assignment */
+	static FString BuildWorkerCommandLine(const TArray<FString>& Switches, int32 WorkerIndex, const FWorkerPartition& Partition, const FString& WorkerOutputDirectory)
+	{
+		FString CommandLine;
+		if (FPaths::IsProjectFilePathSet())
+		{
+			CommandLine = FString::Printf(TEXT("\"%s\" "), *FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()));
+		}
+		CommandLine += TEXT("-run=cook");
+
+		for (const FString& Switch : Switches)
+		{
+			if (Switch.StartsWith(TEXT("CookProcessCount=")) || Switch.StartsWith(TEXT("MAP=")) || Switch.StartsWith(TEXT("OutputDir=")) ||
+				Switch.StartsWith(TEXT("run=")) || Switch.StartsWith(TEXT("abslog=")))
+			{
+				continue;
+			}
+
+			// Content that isn't reached through the partitioned maps is only cooked by the first worker
+			if (WorkerIndex > 0 && (Switch == TEXT("CookAll") || Switch.StartsWith(TEXT("COOKDIR=")) || Switch.StartsWith(TEXT("MAPINISECTION="))))
+			{
+				continue;
+			}
+
+			int32 EqualsIndex = INDEX_NONE;
+			if (Switch.Contains(TEXT(" ")) && Switch.FindChar(TEXT('='), EqualsIndex))
+			{
+				CommandLine += FString::Printf(TEXT(" -%s=\"%s\""), *Switch.Left(EqualsIndex), *Switch.Mid(EqualsIndex + 1).TrimQuotes());
+			}
+			else
+			{
+				CommandLine += TEXT(" -") + Switch;
+			}
+		}
+
+		CommandLine += FString::Printf(TEXT(" -MAP=%s -OutputDir=\"%s\" -abslog=\"%s\" -Multiprocess"),
+			*FString::Join(Partition.Maps, TEXT("+")),
+			*(WorkerOutputDirectory / TEXT("[Platform]")),
+			*(WorkerOutputDirectory / TEXT("Cook.log")));
+
+		if (WorkerIndex > 0)
+		{
+			CommandLine += TEXT(" -NoGameAlwaysCook -NoDefaultMaps");
+		}
+
+		return CommandLine;
+	}
+
+	/** Copies a worker's cooked files into the director's output, collecting its development asset registry for merging */
+	static void GatherWorkerOutput(const FString& WorkerPlatformDirectory, const FString& OutputPlatformDirectory, const FString& RegistryRelativePath, TSet<FString>& InOutCopiedFiles, TArray<FString>& OutRegistryFiles)
+	{
+		TArray<FString> Files;
+		IFileManager::Get().FindFilesRecursive(Files, *WorkerPlatformDirectory, TEXT("*"), true, false);
+
+		for (const FString& File : Files)
+		{
+			FString RelativePath = File;
+			if (!FPaths::MakePathRelativeTo(RelativePath, *(WorkerPlatformDirectory / TEXT(""))))
+			{
+				continue;
+			}
+
+			if (RelativePath == RegistryRelativePath)
+			{
+				OutRegistryFiles.Add(File);
+				continue;
+			}
+
+			// Shared packages are cooked by several workers with identical results, the first copy wins
+			bool bAlreadyCopied = false;
+			InOutCopiedFiles.Add(RelativePath, &bAlreadyCopied);
+			if (!bAlreadyCopied && IFileManager::Get().Copy(*(OutputPlatformDirectory / RelativePath), *File) != COPY_OK)
+			{
+				UE_LOG(LogCookCommandlet, Warning, TEXT("Failed to copy worker cooked file %s, it will be cooked again."), *File);
+			}
+		}
+	}
+
+	/** Merges the development asset registries of the workers, so the director's iterative cook recognizes their packages as cooked */
+	static void MergeDevelopmentAssetRegistries(const ITargetPlatform* TargetPlatform, const TArray<FString>& RegistryFiles, const FString& OutputFilename)
+	{
+		const IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+		FAssetRegistrySerializationOptions DevelopmentOptions;
+		AssetRegistry.InitializeSerializationOptions(DevelopmentOptions, TargetPlatform->IniPlatformName());
+		DevelopmentOptions.ModifyForDevelopment();
+
+		FAssetRegistryState MergedState;
+		TSet<FName> MergedPackages;
+		for (const FString& RegistryFile : RegistryFiles)
+		{
+			TArray<uint8> SerializedRegistry;
+			FAssetRegistryState WorkerState;
+			if (!FFileHelper::LoadFileToArray(SerializedRegistry, *RegistryFile))
+			{
+				continue;
+			}
+
+			FMemoryReader Reader(SerializedRegistry);
+			if (!WorkerState.Load(Reader))
+			{
+				UE_LOG(LogCookCommandlet, Warning, TEXT("Failed to load worker asset registry %s."), *RegistryFile);
+				continue;
+			}
+
+			// Appending an asset that is already in the merged state would duplicate it, drop shared packages first
+			TSet<FName> DuplicatePackages;
+			TSet<FName> WorkerPackages;
+			for (const TPair<FName, const FAssetData*>& Pair : WorkerState.GetObjectPathToAssetDataMap())
+			{
+				WorkerPackages.Add(Pair.Value->PackageName);
+				if (MergedPackages.Contains(Pair.Value->PackageName))
+				{
+					DuplicatePackages.Add(Pair.Value->PackageName);
+				}
+			}
+			if (DuplicatePackages.Num() > 0)
+			{
+				WorkerState.PruneAssetData(TSet<FName>(), DuplicatePackages, DevelopmentOptions);
+			}
+
+			MergedState.InitializeFromExisting(WorkerState, DevelopmentOptions, FAssetRegistryState::EInitializationMode::Append);
+			MergedPackages.Append(WorkerPackages);
+		}
+
+		FArrayWriter SerializedMergedRegistry;
+		MergedState.Save(SerializedMergedRegistry, DevelopmentOptions);
+		FFileHelper::SaveArrayToFile(SerializedMergedRegistry, *OutputFilename);
+	}
+}
+
 UCookCommandlet::UCookCommandlet( const FObjectInitializer& ObjectInitializer )
 	: Super(ObjectInitializer)
 {
@@ -744,6 +996,20 @@ bool UCookCommandlet::CookByTheBook( const TArray<ITargetPlatform*>& Platforms)
 		CmdLineCultEntries += GetSwitchValueElements(TEXT("COOKCULTURES"));
 	}
 
+	// Multi-process cook: this process directs the workers, then finishes with an iterative cook over their merged output.
+	// The workers run with this process' configuration, so their ini snapshot is trusted instead of wiping the merged sandbox.
+	int32 CookProcessCount = 0;
+	FParse::Value(*Params, TEXT("CookProcessCount="), CookProcessCount);
+	const bool bCookDirector = CookProcessCount > 1 && !bCookSinglePackage && DLCName.IsEmpty();
+	if (bCookDirector)
+	{
+		CookFlags |= ECookInitializationFlags::Iterative | ECookInitializationFlags::IgnoreIniSettingsOutOfDate;
+	}
+	else if (CookProcessCount > 1)
+	{
+		UE_LOG(LogCook, Warning, TEXT("-CookProcessCount is not supported for DLC or single package cooks, cooking in this process only."));
+	}
+
 	CookOnTheFlyServer->Initialize(ECookMode::CookByTheBook, CookFlags, OutputDirectoryOverride);
 
 	// Add any map sections specified on command line
@@ -908,6 +1174,26 @@ bool UCookCommandlet::CookByTheBook( const TArray<ITargetPlatform*>& Platforms)
 		}
 	});
 	
+	if (bCookDirector)
+	{
+		TArray<FString> DirectorMaps = StartupOptions.CookMaps;
+		if (DirectorMaps.Num() == 0)
+		{
+			for (const FFilePath& MapToCook : GetDefault<UProjectPackagingSettings>()->MapsToCook)
+			{
+				DirectorMaps.Add(MapToCook.FilePath);
+			}
+		}
+
+		// Same default as UCookOnTheFlyServer::GetOutputDirectoryOverride. An override without [Platform] is only valid for a single platform.
+		FString DirectorOutputDirectory = OutputDirectoryOverride.IsEmpty()
+			? FPaths::Combine(*FPaths::ProjectDir(), TEXT("Saved"), TEXT("Cooked"), TEXT("[Platform]"))
+			: OutputDirectoryOverride;
+		DirectorOutputDirectory = FPaths::ConvertRelativePathToFull(DirectorOutputDirectory);
+
+		RunCookWorkers(StartupOptions.TargetPlatforms, DirectorMaps, CookProcessCount, DirectorOutputDirectory);
+	}
+
 	do
 	{
 		{
@@ -1071,6 +1357,115 @@ bool UCookCommandlet::CookByTheBook( const TArray<ITargetPlatform*>& Platforms)
 	return true;
 }
 
+bool UCookCommandlet::RunCookWorkers(const TArray<ITargetPlatform*>& Platforms, const TArray<FString>& CookMaps, int32 NumWorkers, const FString& OutputDirectory)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(RunCookWorkers, CookChannel);
+
+	if (CookMaps.Num() == 0)
+	{
+		UE_LOG(LogCook, Warning, TEXT("-CookProcessCount was specified but there are no maps to partition, cooking in this process only."));
+		return false;
+	}
+
+	NumWorkers = FMath::Min(NumWorkers, CookMaps.Num());
+	TArray<CookDirector::FWorkerPartition> Partitions = CookDirector::PartitionMaps(CookMaps, NumWorkers);
+
+	struct FWorkerProcess
+	{
+		FString OutputDirectory;
+		FProcHandle Handle;
+		int32 ReturnCode = -1;
+	};
+
+	TArray<FWorkerProcess> Workers;
+	Workers.SetNum(Partitions.Num());
+	for (int32 WorkerIndex = 0; WorkerIndex < Partitions.Num(); ++WorkerIndex)
+	{
+		FWorkerProcess& Worker = Workers[WorkerIndex];
+		Worker.OutputDirectory = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("CookWorkers") / FString::Printf(TEXT("Worker%d"), WorkerIndex));
+
+		if (Partitions[WorkerIndex].Maps.Num() == 0)
+		{
+			continue;
+		}
+
+		const FString WorkerCommandLine = CookDirector::BuildWorkerCommandLine(Switches, WorkerIndex, Partitions[WorkerIndex], Worker.OutputDirectory);
+		UE_LOG(LogCook, Display, TEXT("Launching cook worker %d with %d maps (%d packages): %s"), WorkerIndex, Partitions[WorkerIndex].Maps.Num(), Partitions[WorkerIndex].Packages.Num(), *WorkerCommandLine);
+
+		Worker.Handle = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *WorkerCommandLine, false, true, true, nullptr, 0, nullptr, nullptr);
+		if (!Worker.Handle.IsValid())
+		{
+			UE_LOG(LogCook, Error, TEXT("Failed to launch cook worker %d."), WorkerIndex);
+		}
+	}
+
+	// Wait for the workers, reporting progress now and then
+	double LastStatusTime = FPlatformTime::Seconds();
+	for (;;)
+	{
+		int32 NumRunning = 0;
+		for (FWorkerProcess& Worker : Workers)
+		{
+			if (Worker.Handle.IsValid())
+			{
+				if (FPlatformProcess::IsProcRunning(Worker.Handle))
+				{
+					++NumRunning;
+				}
+				else
+				{
+					FPlatformProcess::GetProcReturnCode(Worker.Handle, &Worker.ReturnCode);
+					FPlatformProcess::CloseProc(Worker.Handle);
+				}
+			}
+		}
+
+		if (NumRunning == 0)
+		{
+			break;
+		}
+
+		if (FPlatformTime::Seconds() - LastStatusTime > 60.0)
+		{
+			UE_LOG(LogCook, Display, TEXT("Waiting for %d cook workers..."), NumRunning);
+			LastStatusTime = FPlatformTime::Seconds();
+		}
+		FPlatformProcess::Sleep(1.0f);
+	}
+
+	bool bAllSucceeded = true;
+	for (int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); ++WorkerIndex)
+	{
+		if (Partitions[WorkerIndex].Maps.Num() > 0 && Workers[WorkerIndex].ReturnCode != 0)
+		{
+			UE_LOG(LogCook, Warning, TEXT("Cook worker %d exited with code %d (see %s), its remaining packages will be cooked by this process."),
+				WorkerIndex, Workers[WorkerIndex].ReturnCode, *(Workers[WorkerIndex].OutputDirectory / TEXT("Cook.log")));
+			bAllSucceeded = false;
+		}
+	}
+
+	// Merge the worker output into ours. The iterative cook started next verifies it against the source packages,
+	// recooks anything missing or out of date, and writes the final asset registries and manifests.
+	const FString RegistryRelativePath = FString(FApp::GetProjectName()) / TEXT("Metadata") / TEXT("DevelopmentAssetRegistry.bin");
+	for (const ITargetPlatform* TargetPlatform : Platforms)
+	{
+		const FString PlatformName = TargetPlatform->PlatformName();
+		const FString OutputPlatformDirectory = OutputDirectory.Replace(TEXT("[Platform]"), *PlatformName);
+
+		TSet<FString> CopiedFiles;
+		TArray<FString> RegistryFiles;
+		for (const FWorkerProcess& Worker : Workers)
+		{
+			CookDirector::GatherWorkerOutput(Worker.OutputDirectory / PlatformName, OutputPlatformDirectory, RegistryRelativePath, CopiedFiles, RegistryFiles);
+		}
+
+		UE_LOG(LogCook, Display, TEXT("Merged %d cooked files and %d asset registries from cook workers for %s."), CopiedFiles.Num(), RegistryFiles.Num(), *PlatformName);
+		CookDirector::MergeDevelopmentAssetRegistries(TargetPlatform, RegistryFiles, OutputPlatformDirectory / RegistryRelativePath);
+	}
+
+	return bAllSucceeded;
+}
+
 void UCookCommandlet::ProcessDeferredCommands()
 {
 #if PLATFORM_MAC
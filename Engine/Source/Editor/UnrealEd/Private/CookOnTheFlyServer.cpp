@@ -4844,6 +4844,7 @@ void UCookOnTheFlyServer::PopulateCookedPackagesFromDisk(const TArrayView<const
 		TSet<FName> ModifiedPackages, NewPackages, RemovedPackages, IdenticalCookedPackages, IdenticalUncookedPackages;
 
 		// We recurse modifications up the reference chain because it is safer, if this ends up being a significant issue in some games we can add a command line flag
+		// Packages with a cook key in both registries do not need it, their keys change when any of their dependencies change
 		bool bRecurseModifications = true;
 		bool bRecurseScriptModifications = !IsCookFlagSet(ECookInitializationFlags::IgnoreScriptPackagesOutOfDate);
 		PlatformAssetRegistry->ComputePackageDifferences(ModifiedPackages, NewPackages, RemovedPackages, IdenticalCookedPackages, IdenticalUncookedPackages, bRecurseModifications, bRecurseScriptModifications);
@@ -5119,6 +5120,25 @@ void UCookOnTheFlyServer::GenerateAssetRegistry()
 	}
 }
 
+/** Hashes the versioned settings that affect every cooked package for the platform, this is part of every package cook key */
+static FMD5Hash GetCookSettingsHash(const ITargetPlatform* TargetPlatform)
+{
+	TMap<FString, FString> IniVersionMap;
+	GetAdditionalCurrentIniVersionStrings(TargetPlatform, IniVersionMap);
+	IniVersionMap.KeySort(TLess<FString>());
+
+	FMD5 Md5;
+	for (const TPair<FString, FString>& IniVersion : IniVersionMap)
+	{
+		Md5.Update(reinterpret_cast<const uint8*>(*IniVersion.Key), IniVersion.Key.Len() * sizeof(TCHAR));
+		Md5.Update(reinterpret_cast<const uint8*>(*IniVersion.Value), IniVersion.Value.Len() * sizeof(TCHAR));
+	}
+
+	FMD5Hash Hash;
+	Hash.Set(Md5);
+	return Hash;
+}
+
 void UCookOnTheFlyServer::RefreshPlatformAssetRegistries(const TArrayView<const ITargetPlatform* const>& TargetPlatforms)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCookOnTheFlyServer::RefreshPlatformAssetRegistries);
@@ -5136,6 +5156,7 @@ void UCookOnTheFlyServer::RefreshPlatformAssetRegistries(const TArrayView<const
 			RegistryGenerator->CleanManifestDirectories();
 		}
 		RegistryGenerator->Initialize(CookByTheBookOptions ? CookByTheBookOptions->StartupPackages : TArray<FName>());
+		RegistryGenerator->ComputePackageCookKeys(GetCookSettingsHash(TargetPlatform));
 	}
 }
 
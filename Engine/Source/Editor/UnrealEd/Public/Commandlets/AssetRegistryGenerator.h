@@ -44,8 +44,20 @@ public:
 	 */
 	bool LoadPreviousAssetRegistry(const FString& Filename);
 
+	/**
+	 * Computes the cook key of every package in the current asset registry. The key of a package hashes the source package,
+	 * the keys of its hard package dependencies and the cook settings, so it changes whenever anything the cooked package
+	 * was built from changes. Packages in a dependency cycle share a single key. Script packages are not hashed,
+	 * modifications to them are handled by ComputePackageDifferences.
+	 *
+	 * @param CookSettingsHash hash of the settings that affect every cooked package for this platform
+	 */
+	void ComputePackageCookKeys(const FMD5Hash& CookSettingsHash);
+
 	/**
 	 * Computes differences between the previous asset registry and the current one 
+	 * Packages that have a cook key in both registries are compared by key, and are not recursed to their referencers since
+	 * the keys of the referencers already include them. Other packages are compared by package guid.
 	 *
 	 * @param ModifiedPackages list of packages which existed before and now, but need to be recooked
 	 * @param NewPackages list of packages that did not exist before, but exist now
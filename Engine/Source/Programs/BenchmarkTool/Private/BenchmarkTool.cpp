@@ -6,10 +6,14 @@
 
 #include "Templates/RefCounting.h"
 #include "Templates/SharedPointer.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
 
 #include "RequiredProgramMainCPPInclude.h"
 #include <locale.h>
-#include <iterator>
 #include <atomic>
 
 DEFINE_LOG_CATEGORY_STATIC(LogBenchmarkTool, Log, All);
@@ -18,144 +22,10 @@ IMPLEMENT_APPLICATION(BenchmarkTool, "BenchTool");
 
 //////////////////////////////////////////////////////////////////////////
 
-class alignas(PLATFORM_CACHE_LINE_SIZE) BenchmarkState
-{
-public:
-	struct BenchmarkIterator;
-
-	BenchmarkState() = default;
-
-	FORCEINLINE void SetIterationCount(int InIterationCount) { IterationCount = InIterationCount; }
-
-	FORCEINLINE BenchmarkIterator begin();
-	FORCEINLINE BenchmarkIterator end();
-
-private:
-	int		IterationCount = 1000;
-};
-
-struct BenchmarkState::BenchmarkIterator
-{
-public:
-	BenchmarkIterator() = default;
-
-	FORCEINLINE BenchmarkIterator(BenchmarkState* InState, int IterationCount)
-	:	State(InState)
-	,	Counter(IterationCount)
-	{
-	}
-
-	FORCEINLINE BenchmarkIterator& operator++() { --Counter; return *this; }
-
-	// This always assumes it compares to an end iterator
-	FORCEINLINE bool operator!=(const BenchmarkIterator& Rhs)
-	{
-		if (Counter == 0)
-		{
-			return false;
-		}
-
-		return true;
-	}
-
-	// Let's just pretend we're an actual iterator
-
-	struct Dummy {};
-	typedef std::forward_iterator_tag	iterator_category;
-	typedef Dummy						value_type;
-	typedef Dummy						reference;
-	typedef Dummy						pointer;
-	typedef std::ptrdiff_t				difference_type;
-
-	Dummy operator*() const { return Dummy(); }
-
-private:
-	BenchmarkState* State = nullptr;
-	int				Counter = 0;
-};
-
-BenchmarkState::BenchmarkIterator BenchmarkState::begin() 
-{ 
-	return BenchmarkIterator(this, IterationCount); 
-}
-
-BenchmarkState::BenchmarkIterator BenchmarkState::end()
-{
-	return BenchmarkIterator();
-}
-
-//////////////////////////////////////////////////////////////////////////
-
 FORCENOINLINE void UseCharPointer(char const volatile*) {}
 
 //////////////////////////////////////////////////////////////////////////
 
-typedef void(BenchFunction)(BenchmarkState&);
-
-class Benchmark
-{
-public:
-	Benchmark(const TCHAR* InName) : Name(InName) 
-	{
-	}
-
-	virtual ~Benchmark() = default;
-
-	Benchmark(const Benchmark&) = delete;
-	Benchmark& operator=(const Benchmark&) = delete;
-
-	virtual void DoRun(BenchmarkState& State)
-	{
-		UE_LOG(LogBenchmarkTool, Log, TEXT("Running '%s'..."), *this->Name);
-
-		const uint64 StartTime = FPlatformTime::Cycles64();
-
-		Run(State);
-
-		Duration = FPlatformTime::Cycles64() - StartTime;
-	}
-
-	virtual Benchmark* Iterations(uint64 InIterationCount)	{ IterationCount = InIterationCount; return this; }
-	virtual Benchmark* Threads(uint16 ThreadCount)			{ ThreadCounts.Add(ThreadCount); return this; }
-
-	static Benchmark* RegisterBenchmarkInternal(Benchmark* InBenchmark);
-
-protected:
-	FString			Name;
-	uint64			IterationCount = 0;
-	TArray<uint16>	ThreadCounts;
-	uint64			Duration = 0;			// This is in Cycles64 units
-
-	friend class BenchmarkRegistry;
-
-private:
-	virtual void Run(BenchmarkState& State) = 0;
-};
-
-class BenchmarkFixture : public Benchmark
-{
-public:
-	virtual void SetUp(BenchmarkState& State)
-	{
-	}
-
-	virtual void TearDown(BenchmarkState& State)
-	{
-	}
-
-	virtual void DoRun(BenchmarkState& State) override
-	{
-		SetUp(State);
-		BenchmarkCase(State);
-		TearDown(State);
-	}
-
-protected:
-	virtual void BenchmarkCase(BenchmarkState&) = 0;
-};
-
-//////////////////////////////////////////////////////////////////////////
-
 class BenchmarkReporter
 {
 public:
@@ -169,7 +39,15 @@ public:
 	{
 		FString	Name;
 		uint64	IterationCount = 0;
-		double	DurationMs = 0;
+		uint64	ItemsPerIteration = 1;
+
+		// Statistics over the repetitions, in nanoseconds per iteration. The minimum is the most stable figure to
+		// compare between machines and versions, the spread shows how noisy the run was.
+		double	MinNs = 0;
+		double	MedianNs = 0;
+		double	MeanNs = 0;
+		double	StdDevNs = 0;
+		TArray<double> RepetitionNs;
 	};
 
 	virtual void Start() {};
@@ -199,33 +77,73 @@ public:
 		return InBenchmark;
 	}
 
-	void RunBenchmarks()
+	/**
+	 * Runs each benchmark whose name contains Filter (all of them if empty) once to warm up caches and lazily
+	 * initialized state, then Repetitions times, and reports the statistics of the repetitions.
+	 */
+	void RunBenchmarks(const FString& Filter, int32 Repetitions, TArrayView<BenchmarkReporter* const> Reporters)
 	{
 		TArray<BenchmarkReporter::Run> RunResults;
 		RunResults.Reserve(Benchmarks.Num());
 
+		for (BenchmarkReporter* Reporter : Reporters)
+		{
+			Reporter->Start();
+		}
+
 		for (auto& Bench : Benchmarks)
 		{
-			BenchmarkState State;
-			State.SetIterationCount(Bench->IterationCount);
+			if (!Filter.IsEmpty() && !Bench->Name.Contains(Filter))
+			{
+				continue;
+			}
 
-			Bench->DoRun(State);
+			UE_LOG(LogBenchmarkTool, Log, TEXT("Running '%s'..."), *Bench->Name);
 
 			BenchmarkReporter::Run& RunResult = *new(RunResults) BenchmarkReporter::Run;
-
 			RunResult.Name				= Bench->Name;
 			RunResult.IterationCount	= Bench->IterationCount;
-			RunResult.DurationMs		= FPlatformTime::ToMilliseconds64(Bench->Duration);
+
+			for (int32 Repetition = -1; Repetition < Repetitions; ++Repetition)
+			{
+				BenchmarkState State;
+				State.SetIterationCount(Bench->IterationCount);
+
+				const uint64 StartTime = FPlatformTime::Cycles64();
+				Bench->DoRun(State);
+				const uint64 Duration = State.HasRunLoop() ? State.GetLoopCycles() : FPlatformTime::Cycles64() - StartTime;
+
+				RunResult.ItemsPerIteration = State.GetItemsPerIteration();
+				if (Repetition >= 0)
+				{
+					RunResult.RepetitionNs.Add(FPlatformTime::ToMilliseconds64(Duration) * 1000000.0 / FMath::Max<uint64>(Bench->IterationCount, 1));
+				}
+			}
+
+			TArray<double> Sorted = RunResult.RepetitionNs;
+			Sorted.Sort();
+			RunResult.MinNs = Sorted[0];
+			RunResult.MedianNs = Sorted[Sorted.Num() / 2];
+
+			double Sum = 0;
+			for (double Value : Sorted)
+			{
+				Sum += Value;
+			}
+			RunResult.MeanNs = Sum / Sorted.Num();
+
+			double SquaredDeviations = 0;
+			for (double Value : Sorted)
+			{
+				SquaredDeviations += FMath::Square(Value - RunResult.MeanNs);
+			}
+			RunResult.StdDevNs = FMath::Sqrt(SquaredDeviations / Sorted.Num());
 		}
 
-		for (BenchmarkReporter::Run& Line : RunResults)
+		for (BenchmarkReporter* Reporter : Reporters)
 		{
-			UE_LOG(LogBenchmarkTool, Log, 
-				TEXT("%-30s %10ld iterations took %5ld ms (%f us/iteration)"),
-				*Line.Name,
-				Line.IterationCount,
-				(uint64)Line.DurationMs,
-				Line.DurationMs * 1000. / Line.IterationCount);
+			Reporter->ReportRuns(RunResults);
+			Reporter->Finalize();
 		}
 	}
 
@@ -237,24 +155,6 @@ Benchmark* Benchmark::RegisterBenchmarkInternal(Benchmark* InBenchmark)
 	return BenchmarkRegistry::Get().Register(InBenchmark);
 }
 
-class FunctionBenchmark : public Benchmark
-{
-public:
-	FunctionBenchmark(const TCHAR* Name, BenchFunction* InFunction) 
-	:	Benchmark(Name)
-	,	Function(InFunction)
-	{
-	}
-
-	virtual void Run(BenchmarkState& State) override
-	{
-		Function(State);
-	}
-
-private:
-	BenchFunction*	Function = nullptr;
-};
-
 //////////////////////////////////////////////////////////////////////////
 
 class ConsoleReporter : public BenchmarkReporter
@@ -270,53 +170,91 @@ public:
 
 	virtual void ReportRuns(const TArray<Run>& Runs) override
 	{
+		for (const Run& Line : Runs)
+		{
+			UE_LOG(LogBenchmarkTool, Log,
+				TEXT("%-50s %12llu iterations %12.2f ns/iteration (median %.2f, +/- %.1f%%)"),
+				*Line.Name,
+				Line.IterationCount,
+				Line.MinNs,
+				Line.MedianNs,
+				Line.MeanNs > 0 ? Line.StdDevNs * 100.0 / Line.MeanNs : 0.0);
+		}
 	}
 
 private:
 };
 
-//////////////////////////////////////////////////////////////////////////
-//
-// Benchmark macros
-//
-
-#if defined(__COUNTER__) && (__COUNTER__ + 1 == __COUNTER__ + 0)
-#	define UE_BENCHMARK_UID __COUNTER__
-#else
-#	define UE_BENCHMARK_UID __LINE__
-#endif
-
-#define UE_BENCHMARK_NAME_(Name)		UE_BENCHMARK_CONCAT_(_benchmark_, UE_BENCHMARK_UID, Name)
-#define UE_BENCHMARK_CONCAT_(a, b, c)	UE_BENCHMARK_CONCAT2_(a, b, c)
-#define UE_BENCHMARK_CONCAT2_(a, b, c)	a##b##c
-
-#define UE_BENCHMARK_DECLARE_(n)		static /*[[unused]]*/ ::Benchmark* UE_BENCHMARK_NAME_(n)
-
-#define UE_BENCHMARK(n)					UE_BENCHMARK_DECLARE_(n) = (::Benchmark::RegisterBenchmarkInternal(new ::FunctionBenchmark(TEXT(#n), n)))
-
-#define UE_BENCHMARK_CAPTURE(Func, Name, ...)	UE_BENCHMARK_DECLARE_(Func) = (::Benchmark::RegisterBenchmarkInternal(new ::FunctionBenchmark(TEXT(#Func "/" #Name), [](::BenchmarkState& State) { Func(State, __VA_ARGS__); })))
+/** Writes the runs along with a description of the machine and build, for comparing hardware and engine versions */
+class JsonReporter : public BenchmarkReporter
+{
+public:
+	explicit JsonReporter(const FString& InFilename)
+	:	Filename(InFilename)
+	{
+	}
 
-//////////////////////////////////////////////////////////////////////////
+	virtual void ReportRuns(const TArray<Run>& Runs) override
+	{
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		Writer->WriteObjectStart();
+
+		Writer->WriteObjectStart(TEXT("Context"));
+		Writer->WriteValue(TEXT("Date"), FDateTime::UtcNow().ToIso8601());
+		Writer->WriteValue(TEXT("Platform"), FString(ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName())));
+		Writer->WriteValue(TEXT("Configuration"), FString(LexToString(FApp::GetBuildConfiguration())));
+		Writer->WriteValue(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+		Writer->WriteValue(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Writer->WriteValue(TEXT("PhysicalCores"), FPlatformMisc::NumberOfCores());
+		Writer->WriteValue(TEXT("LogicalCores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		Writer->WriteValue(TEXT("WorkerThreads"), FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+		Writer->WriteValue(TEXT("MemoryGB"), (int32)FPlatformMemory::GetConstants().TotalPhysicalGB);
+		Writer->WriteObjectEnd();
+
+		Writer->WriteArrayStart(TEXT("Benchmarks"));
+		for (const Run& Line : Runs)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("Name"), Line.Name);
+			Writer->WriteValue(TEXT("Iterations"), (double)Line.IterationCount);
+			Writer->WriteValue(TEXT("MinNs"), Line.MinNs);
+			Writer->WriteValue(TEXT("MedianNs"), Line.MedianNs);
+			Writer->WriteValue(TEXT("MeanNs"), Line.MeanNs);
+			Writer->WriteValue(TEXT("StdDevNs"), Line.StdDevNs);
+			if (Line.ItemsPerIteration > 1)
+			{
+				Writer->WriteValue(TEXT("ItemsPerSecond"), Line.ItemsPerIteration * 1e9 / Line.MinNs);
+			}
+			Writer->WriteArrayStart(TEXT("RepetitionsNs"));
+			for (double Value : Line.RepetitionNs)
+			{
+				Writer->WriteValue(Value);
+			}
+			Writer->WriteArrayEnd();
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
 
-#if defined(_MSC_VER)
-template <class T>
-FORCEINLINE void DoNotOptimize(const T& Value) 
-{
-	UseCharPointer(&reinterpret_cast<char const volatile&>(Value));
-	_ReadWriteBarrier();
-}
+		Writer->WriteObjectEnd();
+		Writer->Close();
+	}
 
-inline FORCENOINLINE void ClobberMemory() { _ReadWriteBarrier(); }
-#else
-template <class T>
-FORCEINLINE void DoNotOptimize(const T& Value) 
-{
-	/* TODO */
-  UseCharPointer(&reinterpret_cast<char const volatile&>(Value));
-}
-inline FORCENOINLINE void ClobberMemory() { /* TODO */ }
-#endif
+	virtual void Finalize() override
+	{
+		if (FFileHelper::SaveStringToFile(Output, *Filename))
+		{
+			UE_LOG(LogBenchmarkTool, Log, TEXT("Results written to %s"), *Filename);
+		}
+		else
+		{
+			UE_LOG(LogBenchmarkTool, Error, TEXT("Failed to write results to %s"), *Filename);
+		}
+	}
 
+private:
+	FString Filename;
+	FString Output;
+};
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -611,10 +549,33 @@ UE_BENCHMARK(BM_TSharedPtrAssign_NoTS)->Iterations(100000000);
 
 //////////////////////////////////////////////////////////////////////////
 
+/**
+ * Usage: BenchmarkTool [-filter=<Substring>] [-repetitions=<Count>] [-json=<File>]
+ */
 INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 {
 	GEngineLoop.PreInit(ArgC, ArgV);
-	BenchmarkRegistry::Get().RunBenchmarks();
+
+	FString Filter;
+	FParse::Value(FCommandLine::Get(), TEXT("-filter="), Filter);
+
+	int32 Repetitions = 5;
+	FParse::Value(FCommandLine::Get(), TEXT("-repetitions="), Repetitions);
+
+	FString JsonFilename;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("-json="), JsonFilename))
+	{
+		JsonFilename = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("BenchmarkTool-%s.json"), *FDateTime::Now().ToString());
+	}
+
+	ConsoleReporter Console;
+	JsonReporter Json(JsonFilename);
+	BenchmarkReporter* Reporters[] = { &Console, &Json };
+
+	BenchmarkRegistry::Get().RunBenchmarks(Filter, FMath::Max(Repetitions, 1), Reporters);
+
+	FEngineLoop::AppPreExit();
+	FEngineLoop::AppExit();
 
 	return 0;
 }
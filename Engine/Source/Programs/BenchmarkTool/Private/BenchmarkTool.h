@@ -3,4 +3,208 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <iterator>
 
+//////////////////////////////////////////////////////////////////////////
+
+class alignas(PLATFORM_CACHE_LINE_SIZE) BenchmarkState
+{
+public:
+	struct BenchmarkIterator;
+
+	BenchmarkState() = default;
+
+	FORCEINLINE void SetIterationCount(uint64 InIterationCount) { IterationCount = InIterationCount; }
+	FORCEINLINE uint64 GetIterationCount() const { return IterationCount; }
+
+	/** Work items processed per iteration, so results can also be reported as a rate (e.g. lookups per second) */
+	FORCEINLINE void SetItemsPerIteration(uint64 InItemsPerIteration) { ItemsPerIteration = InItemsPerIteration; }
+	FORCEINLINE uint64 GetItemsPerIteration() const { return ItemsPerIteration; }
+
+	/** Time spent in the benchmark loop only, so that set up before the loop isn't measured */
+	FORCEINLINE uint64 GetLoopCycles() const { return LoopEndCycles - LoopStartCycles; }
+	FORCEINLINE bool HasRunLoop() const { return LoopEndCycles != 0; }
+
+	FORCEINLINE BenchmarkIterator begin();
+	FORCEINLINE BenchmarkIterator end();
+
+private:
+	uint64	IterationCount = 1000;
+	uint64	ItemsPerIteration = 1;
+	uint64	LoopStartCycles = 0;
+	uint64	LoopEndCycles = 0;
+};
+
+struct BenchmarkState::BenchmarkIterator
+{
+public:
+	BenchmarkIterator() = default;
+
+	FORCEINLINE BenchmarkIterator(BenchmarkState* InState, uint64 IterationCount)
+	:	State(InState)
+	,	Counter(IterationCount)
+	{
+	}
+
+	FORCEINLINE BenchmarkIterator& operator++() { --Counter; return *this; }
+
+	// This always assumes it compares to an end iterator
+	FORCEINLINE bool operator!=(const BenchmarkIterator& Rhs)
+	{
+		if (Counter == 0)
+		{
+			State->LoopEndCycles = FPlatformTime::Cycles64();
+			return false;
+		}
+
+		return true;
+	}
+
+	// Let's just pretend we're an actual iterator
+
+	struct Dummy {};
+	typedef std::forward_iterator_tag	iterator_category;
+	typedef Dummy						value_type;
+	typedef Dummy						reference;
+	typedef Dummy						pointer;
+	typedef std::ptrdiff_t				difference_type;
+
+	Dummy operator*() const { return Dummy(); }
+
+private:
+	BenchmarkState* State = nullptr;
+	uint64			Counter = 0;
+};
+
+BenchmarkState::BenchmarkIterator BenchmarkState::begin()
+{
+	LoopStartCycles = FPlatformTime::Cycles64();
+	return BenchmarkIterator(this, IterationCount);
+}
+
+BenchmarkState::BenchmarkIterator BenchmarkState::end()
+{
+	return BenchmarkIterator();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+FORCENOINLINE void UseCharPointer(char const volatile*);
+
+//////////////////////////////////////////////////////////////////////////
+
+typedef void(BenchFunction)(BenchmarkState&);
+
+class Benchmark
+{
+public:
+	Benchmark(const TCHAR* InName) : Name(InName)
+	{
+	}
+
+	virtual ~Benchmark() = default;
+
+	Benchmark(const Benchmark&) = delete;
+	Benchmark& operator=(const Benchmark&) = delete;
+
+	virtual void DoRun(BenchmarkState& State)
+	{
+		Run(State);
+	}
+
+	virtual Benchmark* Iterations(uint64 InIterationCount)	{ IterationCount = InIterationCount; return this; }
+	virtual Benchmark* Threads(uint16 ThreadCount)			{ ThreadCounts.Add(ThreadCount); return this; }
+
+	static Benchmark* RegisterBenchmarkInternal(Benchmark* InBenchmark);
+
+protected:
+	FString			Name;
+	uint64			IterationCount = 0;
+	TArray<uint16>	ThreadCounts;
+
+	friend class BenchmarkRegistry;
+
+private:
+	virtual void Run(BenchmarkState& State) = 0;
+};
+
+class BenchmarkFixture : public Benchmark
+{
+public:
+	virtual void SetUp(BenchmarkState& State)
+	{
+	}
+
+	virtual void TearDown(BenchmarkState& State)
+	{
+	}
+
+	virtual void DoRun(BenchmarkState& State) override
+	{
+		SetUp(State);
+		BenchmarkCase(State);
+		TearDown(State);
+	}
+
+protected:
+	virtual void BenchmarkCase(BenchmarkState&) = 0;
+};
+
+class FunctionBenchmark : public Benchmark
+{
+public:
+	FunctionBenchmark(const TCHAR* Name, BenchFunction* InFunction)
+	:	Benchmark(Name)
+	,	Function(InFunction)
+	{
+	}
+
+	virtual void Run(BenchmarkState& State) override
+	{
+		Function(State);
+	}
+
+private:
+	BenchFunction*	Function = nullptr;
+};
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Benchmark macros
+//
+
+#if defined(__COUNTER__) && (__COUNTER__ + 1 == __COUNTER__ + 0)
+#	define UE_BENCHMARK_UID __COUNTER__
+#else
+#	define UE_BENCHMARK_UID __LINE__
+#endif
+
+#define UE_BENCHMARK_NAME_(Name)		UE_BENCHMARK_CONCAT_(_benchmark_, UE_BENCHMARK_UID, Name)
+#define UE_BENCHMARK_CONCAT_(a, b, c)	UE_BENCHMARK_CONCAT2_(a, b, c)
+#define UE_BENCHMARK_CONCAT2_(a, b, c)	a##b##c
+
+#define UE_BENCHMARK_DECLARE_(n)		static /*[[unused]]*/ ::Benchmark* UE_BENCHMARK_NAME_(n)
+
+#define UE_BENCHMARK(n)					UE_BENCHMARK_DECLARE_(n) = (::Benchmark::RegisterBenchmarkInternal(new ::FunctionBenchmark(TEXT(#n), n)))
+
+#define UE_BENCHMARK_CAPTURE(Func, Name, ...)	UE_BENCHMARK_DECLARE_(Func) = (::Benchmark::RegisterBenchmarkInternal(new ::FunctionBenchmark(TEXT(#Func "/" #Name), [](::BenchmarkState& State) { Func(State, __VA_ARGS__); })))
+
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER)
+template <class T>
+FORCEINLINE void DoNotOptimize(const T& Value)
+{
+	UseCharPointer(&reinterpret_cast<char const volatile&>(Value));
+	_ReadWriteBarrier();
+}
+
+inline FORCENOINLINE void ClobberMemory() { _ReadWriteBarrier(); }
+#else
+template <class T>
+FORCEINLINE void DoNotOptimize(const T& Value)
+{
+	asm volatile("" : : "r,m"(Value) : "memory");
+}
+inline FORCENOINLINE void ClobberMemory() { asm volatile("" : : : "memory"); }
+#endif
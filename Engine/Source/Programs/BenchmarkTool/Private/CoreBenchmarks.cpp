@@ -0,0 +1,434 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BenchmarkTool.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Math/RandomStream.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// Microbenchmarks of core engine hot paths. All random data comes from fixed seeds so that every run does the
+// same work and results can be compared between machines and engine versions.
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Container lookups
+//
+
+static TArray<int32> MakeRandomKeys(int32 Count, int32 Seed)
+{
+	FRandomStream Random(Seed);
+	TSet<int32> Unique;
+	while (Unique.Num() < Count)
+	{
+		Unique.Add(Random.RandRange(0, MAX_int32 - 1));
+	}
+	return Unique.Array();
+}
+
+static void BM_TMapFind(BenchmarkState& State, int32 Size)
+{
+	const TArray<int32> Keys = MakeRandomKeys(Size, 1);
+	TMap<int32, int32> Map;
+	for (int32 Key : Keys)
+	{
+		Map.Add(Key, Key);
+	}
+
+	int32 Index = 0;
+	for (auto _ : State)
+	{
+		const int32* Value = Map.Find(Keys[Index]);
+		DoNotOptimize(Value);
+		Index = (Index + 1) % Size;
+	}
+}
+
+static void BM_TMapFindMiss(BenchmarkState& State, int32 Size)
+{
+	const TArray<int32> Keys = MakeRandomKeys(Size * 2, 1);
+	TMap<int32, int32> Map;
+	for (int32 Index = 0; Index < Size; ++Index)
+	{
+		Map.Add(Keys[Index], Index);
+	}
+
+	int32 Index = 0;
+	for (auto _ : State)
+	{
+		const int32* Value = Map.Find(Keys[Size + Index]);
+		DoNotOptimize(Value);
+		Index = (Index + 1) % Size;
+	}
+}
+
+static void BM_TMapFindString(BenchmarkState& State, int32 Size)
+{
+	TArray<FString> Keys;
+	TMap<FString, int32> Map;
+	for (int32 Key : MakeRandomKeys(Size, 2))
+	{
+		Keys.Add(FString::Printf(TEXT("Key_%d"), Key));
+		Map.Add(Keys.Last(), Key);
+	}
+
+	int32 Index = 0;
+	for (auto _ : State)
+	{
+		const int32* Value = Map.Find(Keys[Index]);
+		DoNotOptimize(Value);
+		Index = (Index + 1) % Size;
+	}
+}
+
+static void BM_TSetContains(BenchmarkState& State, int32 Size)
+{
+	const TArray<int32> Keys = MakeRandomKeys(Size, 3);
+	TSet<int32> Set(Keys);
+
+	int32 Index = 0;
+	for (auto _ : State)
+	{
+		bool bContains = Set.Contains(Keys[Index]);
+		DoNotOptimize(bContains);
+		Index = (Index + 1) % Size;
+	}
+}
+
+static void BM_TMapAddRemove(BenchmarkState& State, int32 Size)
+{
+	const TArray<int32> Keys = MakeRandomKeys(Size, 4);
+	TMap<int32, int32> Map;
+	Map.Reserve(Size);
+
+	for (auto _ : State)
+	{
+		for (int32 Key : Keys)
+		{
+			Map.Add(Key, Key);
+		}
+		for (int32 Key : Keys)
+		{
+			Map.Remove(Key);
+		}
+		DoNotOptimize(Map);
+	}
+	State.SetItemsPerIteration(Size);
+}
+
+UE_BENCHMARK_CAPTURE(BM_TMapFind, 16, 16)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TMapFind, 1024, 1024)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TMapFind, 1M, 1024 * 1024)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TMapFindMiss, 1024, 1024)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TMapFindString, 1024, 1024)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TSetContains, 16, 16)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TSetContains, 1024, 1024)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TSetContains, 1M, 1024 * 1024)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_TMapAddRemove, 1024, 1024)->Iterations(10000);
+
+//////////////////////////////////////////////////////////////////////////
+//
+// FName
+//
+
+static void BM_FNameFind(BenchmarkState& State)
+{
+	// Names which already exist, the common case when creating names from data at runtime
+	TArray<FString> Strings;
+	for (int32 Index = 0; Index < 1024; ++Index)
+	{
+		Strings.Add(FString::Printf(TEXT("BenchmarkName_%d"), Index));
+		FName(*Strings.Last());
+	}
+
+	int32 Index = 0;
+	for (auto _ : State)
+	{
+		FName Name(*Strings[Index]);
+		DoNotOptimize(Name);
+		Index = (Index + 1) & 1023;
+	}
+}
+
+static void BM_FNameFindNumbered(BenchmarkState& State)
+{
+	// The number suffix is split off and stored in the FName, so these all share one name entry
+	TArray<FString> Strings;
+	for (int32 Index = 0; Index < 1024; ++Index)
+	{
+		Strings.Add(FString::Printf(TEXT("BenchmarkActor_%d"), Index + 1));
+	}
+
+	int32 Index = 0;
+	for (auto _ : State)
+	{
+		FName Name(*Strings[Index]);
+		DoNotOptimize(Name);
+		Index = (Index + 1) & 1023;
+	}
+}
+
+static void BM_FNameAdd(BenchmarkState& State)
+{
+	// New names, which are never freed. Strings are prepared up front and the run number keeps them unique
+	// across repetitions.
+	static int32 RunNumber = 0;
+	++RunNumber;
+
+	TArray<FString> Strings;
+	Strings.Reserve(State.GetIterationCount());
+	for (uint64 Index = 0; Index < State.GetIterationCount(); ++Index)
+	{
+		Strings.Add(FString::Printf(TEXT("BenchmarkNewName_%d_%llu_x"), RunNumber, Index));
+	}
+
+	int32 Index = 0;
+	for (auto _ : State)
+	{
+		FName Name(*Strings[Index++]);
+		DoNotOptimize(Name);
+	}
+}
+
+static void BM_FNameToString(BenchmarkState& State)
+{
+	const FName Name(TEXT("BenchmarkName_ToString"));
+
+	for (auto _ : State)
+	{
+		FString String = Name.ToString();
+		DoNotOptimize(String);
+	}
+}
+
+UE_BENCHMARK(BM_FNameFind)->Iterations(10000000);
+UE_BENCHMARK(BM_FNameFindNumbered)->Iterations(10000000);
+UE_BENCHMARK(BM_FNameAdd)->Iterations(100000);
+UE_BENCHMARK(BM_FNameToString)->Iterations(10000000);
+
+//////////////////////////////////////////////////////////////////////////
+//
+// FMemory, per allocation size. Sizes are picked to land in small, medium and large bins of the binned allocators.
+//
+
+static void BM_MallocFree(BenchmarkState& State, SIZE_T Size)
+{
+	for (auto _ : State)
+	{
+		void* Ptr = FMemory::Malloc(Size);
+		DoNotOptimize(Ptr);
+		FMemory::Free(Ptr);
+	}
+}
+
+static void BM_MallocFreeBatch(BenchmarkState& State, SIZE_T Size)
+{
+	// Allocating a batch before freeing it defeats the free list handing back the block that was just freed
+	const int32 BatchSize = 256;
+	void* Ptrs[BatchSize];
+
+	for (auto _ : State)
+	{
+		for (int32 Index = 0; Index < BatchSize; ++Index)
+		{
+			Ptrs[Index] = FMemory::Malloc(Size);
+		}
+		ClobberMemory();
+		for (int32 Index = 0; Index < BatchSize; ++Index)
+		{
+			FMemory::Free(Ptrs[Index]);
+		}
+	}
+	State.SetItemsPerIteration(BatchSize);
+}
+
+static void BM_Realloc(BenchmarkState& State, SIZE_T MaxSize)
+{
+	for (auto _ : State)
+	{
+		void* Ptr = nullptr;
+		for (SIZE_T Size = 16; Size <= MaxSize; Size *= 2)
+		{
+			Ptr = FMemory::Realloc(Ptr, Size);
+		}
+		FMemory::Free(Ptr);
+	}
+}
+
+UE_BENCHMARK_CAPTURE(BM_MallocFree, 16, 16)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_MallocFree, 64, 64)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_MallocFree, 256, 256)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_MallocFree, 1K, 1024)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_MallocFree, 4K, 4096)->Iterations(10000000);
+UE_BENCHMARK_CAPTURE(BM_MallocFree, 32K, 32 * 1024)->Iterations(1000000);
+UE_BENCHMARK_CAPTURE(BM_MallocFree, 1M, 1024 * 1024)->Iterations(10000);
+UE_BENCHMARK_CAPTURE(BM_MallocFreeBatch, 16, 16)->Iterations(100000);
+UE_BENCHMARK_CAPTURE(BM_MallocFreeBatch, 256, 256)->Iterations(100000);
+UE_BENCHMARK_CAPTURE(BM_MallocFreeBatch, 4K, 4096)->Iterations(10000);
+UE_BENCHMARK_CAPTURE(BM_Realloc, 64K, 64 * 1024)->Iterations(100000);
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Task graph and ParallelFor
+//
+
+static void BM_TaskGraphRoundTrip(BenchmarkState& State)
+{
+	// Latency from dispatching a task until the dispatching thread sees it completed
+	for (auto _ : State)
+	{
+		FGraphEventRef Event = FFunctionGraphTask::CreateAndDispatchWhenReady([]() {}, TStatId(), nullptr, ENamedThreads::AnyThread);
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Event);
+	}
+}
+
+static void BM_TaskGraphFanOut(BenchmarkState& State, int32 NumTasks)
+{
+	FGraphEventArray Events;
+	Events.Reserve(NumTasks);
+
+	for (auto _ : State)
+	{
+		Events.Reset();
+		for (int32 Index = 0; Index < NumTasks; ++Index)
+		{
+			Events.Add(FFunctionGraphTask::CreateAndDispatchWhenReady([]() {}, TStatId(), nullptr, ENamedThreads::AnyThread));
+		}
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(Events);
+	}
+	State.SetItemsPerIteration(NumTasks);
+}
+
+static void BM_ParallelFor(BenchmarkState& State, int32 NumChunks)
+{
+	// The same total amount of work split into more and more chunks, shows how well it scales across workers and
+	// where the per chunk overhead starts to dominate
+	const int32 NumElements = 1 << 20;
+	TArray<float> Values;
+	Values.SetNumUninitialized(NumElements);
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		Values[Index] = float(Index);
+	}
+
+	const int32 ChunkSize = NumElements / NumChunks;
+	for (auto _ : State)
+	{
+		ParallelFor(NumChunks, [&Values, ChunkSize](int32 Chunk)
+		{
+			float* Data = Values.GetData() + Chunk * ChunkSize;
+			for (int32 Index = 0; Index < ChunkSize; ++Index)
+			{
+				Data[Index] = FMath::Sqrt(Data[Index] * 1.0001f + 1.0f);
+			}
+		});
+		ClobberMemory();
+	}
+	State.SetItemsPerIteration(NumElements);
+}
+
+UE_BENCHMARK(BM_TaskGraphRoundTrip)->Iterations(100000);
+UE_BENCHMARK_CAPTURE(BM_TaskGraphFanOut, 64, 64)->Iterations(10000);
+UE_BENCHMARK_CAPTURE(BM_ParallelFor, 1, 1)->Iterations(200);
+UE_BENCHMARK_CAPTURE(BM_ParallelFor, 2, 2)->Iterations(200);
+UE_BENCHMARK_CAPTURE(BM_ParallelFor, 4, 4)->Iterations(200);
+UE_BENCHMARK_CAPTURE(BM_ParallelFor, 8, 8)->Iterations(200);
+UE_BENCHMARK_CAPTURE(BM_ParallelFor, 16, 16)->Iterations(200);
+UE_BENCHMARK_CAPTURE(BM_ParallelFor, 64, 64)->Iterations(200);
+UE_BENCHMARK_CAPTURE(BM_ParallelFor, 1024, 1024)->Iterations(200);
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Serialization
+//
+
+struct FBenchmarkRecord
+{
+	FVector Location;
+	FQuat Rotation;
+	int32 Id;
+	uint8 Flags;
+	FString Label;
+
+	friend FArchive& operator<<(FArchive& Ar, FBenchmarkRecord& Record)
+	{
+		return Ar << Record.Location << Record.Rotation << Record.Id << Record.Flags << Record.Label;
+	}
+};
+
+static TArray<FBenchmarkRecord> MakeBenchmarkRecords(int32 Count)
+{
+	FRandomStream Random(5);
+	TArray<FBenchmarkRecord> Records;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FBenchmarkRecord& Record = Records.AddDefaulted_GetRef();
+		Record.Location = Random.GetUnitVector() * 1000.0f;
+		Record.Rotation = FQuat(Random.GetUnitVector(), Random.FRand());
+		Record.Id = Index;
+		Record.Flags = uint8(Random.RandHelper(256));
+		Record.Label = FString::Printf(TEXT("Record_%d"), Index);
+	}
+	return Records;
+}
+
+static void BM_MemoryWriter(BenchmarkState& State)
+{
+	TArray<FBenchmarkRecord> Records = MakeBenchmarkRecords(1024);
+	TArray<uint8> Bytes;
+
+	for (auto _ : State)
+	{
+		Bytes.Reset();
+		FMemoryWriter Writer(Bytes);
+		Writer << Records;
+		DoNotOptimize(Bytes);
+	}
+	State.SetItemsPerIteration(Records.Num());
+}
+
+static void BM_MemoryReader(BenchmarkState& State)
+{
+	TArray<FBenchmarkRecord> Records = MakeBenchmarkRecords(1024);
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << Records;
+
+	TArray<FBenchmarkRecord> ReadRecords;
+	for (auto _ : State)
+	{
+		FMemoryReader Reader(Bytes);
+		Reader << ReadRecords;
+		DoNotOptimize(ReadRecords);
+	}
+	State.SetItemsPerIteration(Records.Num());
+}
+
+static void BM_BitWriter(BenchmarkState& State)
+{
+	// The bit packed path used by replication: ranged ints, packed ints and the net serialized math types
+	TArray<FBenchmarkRecord> Records = MakeBenchmarkRecords(1024);
+
+	for (auto _ : State)
+	{
+		FBitWriter Writer(0, true);
+		bool bSuccess = true;
+		for (FBenchmarkRecord& Record : Records)
+		{
+			uint32 Flags = Record.Flags;
+			Writer.SerializeInt(Flags, 256);
+			uint32 Id = Record.Id;
+			Writer.SerializeIntPacked(Id);
+			Record.Location.NetSerialize(Writer, nullptr, bSuccess);
+			Record.Rotation.NetSerialize(Writer, nullptr, bSuccess);
+		}
+		DoNotOptimize(Writer);
+	}
+	State.SetItemsPerIteration(Records.Num());
+}
+
+UE_BENCHMARK(BM_MemoryWriter)->Iterations(10000);
+UE_BENCHMARK(BM_MemoryReader)->Iterations(10000);
+UE_BENCHMARK(BM_BitWriter)->Iterations(10000);
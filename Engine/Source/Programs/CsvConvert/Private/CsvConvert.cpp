@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CsvConvert.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfilerBinary.h"
+
+#include "RequiredProgramMainCPPInclude.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCsvConvert, Log, All);
+
+IMPLEMENT_APPLICATION(CsvConvert, "CsvConvert");
+
+/**
+ * Converts binary CSV profiler captures (.csvbin, see FCsvBinaryFormat) to text .csv files.
+ *
+ * Usage: CsvConvert <BinaryFile> [<BinaryFile>...] [-o=<TextFile>]
+ * Without -o each file is converted next to itself, with a .csv extension.
+ */
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	GEngineLoop.PreInit(ArgC, ArgV);
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	FCommandLine::Parse(FCommandLine::Get(), Tokens, Switches);
+
+	FString OutputFilename;
+	FParse::Value(FCommandLine::Get(), TEXT("-o="), OutputFilename);
+
+	int32 Result = 0;
+	if (Tokens.Num() == 0 || (OutputFilename.Len() > 0 && Tokens.Num() > 1))
+	{
+		UE_LOG(LogCsvConvert, Display, TEXT("Usage: CsvConvert <BinaryFile> [<BinaryFile>...] [-o=<TextFile>]"));
+		Result = 1;
+	}
+	else
+	{
+		for (const FString& BinaryFilename : Tokens)
+		{
+			const FString TextFilename = OutputFilename.Len() > 0 ? OutputFilename : FPaths::ChangeExtension(BinaryFilename, TEXT(".csv"));
+			if (FCsvBinaryFormat::ConvertToText(*BinaryFilename, *TextFilename))
+			{
+				UE_LOG(LogCsvConvert, Display, TEXT("Converted %s to %s"), *BinaryFilename, *TextFilename);
+			}
+			else
+			{
+				Result = 1;
+			}
+		}
+	}
+
+	FEngineLoop::AppExit();
+	return Result;
+}
@@ -0,0 +1,237 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "ChaosPerf/ChaosPerf.h"
+
+#include "Chaos/AABBTree.h"
+#include "Chaos/Box.h"
+#include "Chaos/ParticleHandle.h"
+#include "Chaos/PBDRigidsEvolutionGBF.h"
+#include "Chaos/PBDRigidsSOAs.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+//
+// Large-scale scenarios. Stepped scenarios call NextFrame() after each step so that the output CSV
+// has one row per simulation step. Run with -csvCategories=PhysicsVerbose to also get the per-phase
+// solver timings (integrate, collision detection, island solve etc.) in each row.
+//
+namespace ChaosPerf
+{
+	using namespace Chaos;
+
+	static int32 RigidPileNumBodies = 10000;
+	static FAutoConsoleVariableRef CVarRigidPileNumBodies(TEXT("ChaosPerf.RigidPile.NumBodies"), RigidPileNumBodies, TEXT("Number of dynamic boxes in the RigidPile scenario"));
+
+	static int32 RigidPileNumSteps = 300;
+	static FAutoConsoleVariableRef CVarRigidPileNumSteps(TEXT("ChaosPerf.RigidPile.NumSteps"), RigidPileNumSteps, TEXT("Number of fixed steps to run in the RigidPile scenario"));
+
+	static int32 RaycastBatchNumRays = 1000000;
+	static FAutoConsoleVariableRef CVarRaycastBatchNumRays(TEXT("ChaosPerf.RaycastBatch.NumRays"), RaycastBatchNumRays, TEXT("Number of rays to cast in the RaycastBatch scenario"));
+
+	static int32 RaycastBatchNumBoxes = 100000;
+	static FAutoConsoleVariableRef CVarRaycastBatchNumBoxes(TEXT("ChaosPerf.RaycastBatch.NumBoxes"), RaycastBatchNumBoxes, TEXT("Number of boxes in the RaycastBatch acceleration structure"));
+
+	// Enable collisions between all shapes on a particle (same as the HeadlessChaos unit tests)
+	static void SetParticleSimDataToCollide(FGeometryParticleHandle* Particle)
+	{
+		for (const TUniquePtr<FPerShapeData>& Shape : Particle->ShapesArray())
+		{
+			Shape->ModifySimData([](auto& SimData)
+			{
+				SimData.Word3 = 1;
+				SimData.Word1 = 1;
+			});
+		}
+	}
+
+	//
+	// A pile of dynamic boxes dropped onto a static ground box
+	//
+	class FRigidPilePerfTest : public FPerfTest
+	{
+	public:
+		FRigidPilePerfTest(const FString& InTestName)
+			: FPerfTest(InTestName)
+		{
+		}
+
+	protected:
+		virtual void CreateTest() override
+		{
+			const FReal BoxSize = 100;
+			const int32 NumBodies = FMath::Max(RigidPileNumBodies, 1);
+			const int32 NumPerSide = FMath::Max(FMath::CeilToInt(FMath::Sqrt((FReal)NumBodies / 10)), 1);
+			const FReal Spacing = BoxSize * 1.1f;
+			const FReal GroundHalfSize = 0.5f * (FReal)NumPerSide * Spacing + BoxSize;
+
+			Particles = MakeUnique<FPBDRigidsSOAs>(UniqueIndices);
+			Evolution = MakeUnique<FPBDRigidsEvolutionGBF>(*Particles, PhysicalMaterials);
+
+			GroundGeom = MakeUnique<TBox<FReal, 3>>(FVec3(-GroundHalfSize, -GroundHalfSize, -BoxSize), FVec3(GroundHalfSize, GroundHalfSize, 0));
+			BoxGeom = MakeUnique<TBox<FReal, 3>>(FVec3(-0.5f * BoxSize), FVec3(0.5f * BoxSize));
+
+			FGeometryParticleHandle* Ground = Evolution->CreateStaticParticles(1)[0];
+			Ground->SetGeometry(MakeSerializable(GroundGeom));
+			Ground->UpdateWorldSpaceState(FRigidTransform3(Ground->X(), Ground->R()), FVec3(0));
+			SetParticleSimDataToCollide(Ground);
+			Evolution->DirtyParticle(*Ground);
+
+			// Stack the boxes in layers of NumPerSide x NumPerSide with a small random offset so the pile collapses
+			FRandomStream Random(1234);
+			const FReal Mass = 1;
+			const FReal Inertia = Mass * BoxSize * BoxSize / 6;
+			TArray<FPBDRigidParticleHandle*> Dynamics = Evolution->CreateDynamicParticles(NumBodies);
+			for (int32 Index = 0; Index < NumBodies; ++Index)
+			{
+				const int32 Layer = Index / (NumPerSide * NumPerSide);
+				const int32 Row = (Index / NumPerSide) % NumPerSide;
+				const int32 Col = Index % NumPerSide;
+
+				FPBDRigidParticleHandle* Dynamic = Dynamics[Index];
+				Dynamic->SetGeometry(MakeSerializable(BoxGeom));
+				Dynamic->X() = FVec3(
+					((FReal)Col - 0.5f * NumPerSide) * Spacing + Random.FRandRange(-10, 10),
+					((FReal)Row - 0.5f * NumPerSide) * Spacing + Random.FRandRange(-10, 10),
+					((FReal)Layer + 0.5f) * Spacing);
+				Dynamic->P() = Dynamic->X();
+				Dynamic->M() = Mass;
+				Dynamic->InvM() = 1 / Mass;
+				Dynamic->I() = TVec3<FRealSingle>(Inertia);
+				Dynamic->InvI() = TVec3<FRealSingle>(1 / Inertia);
+				SetParticleSimDataToCollide(Dynamic);
+				Evolution->DirtyParticle(*Dynamic);
+			}
+		}
+
+		virtual void DestroyTest() override
+		{
+			Evolution.Reset();
+			Particles.Reset();
+			BoxGeom.Reset();
+			GroundGeom.Reset();
+		}
+
+		void Step(const FReal Dt)
+		{
+			Evolution->AdvanceOneTimeStep(Dt);
+			Evolution->EndFrame(Dt);
+		}
+
+	private:
+		FParticleUniqueIndicesMultithreaded UniqueIndices;
+		THandleArray<FChaosPhysicsMaterial> PhysicalMaterials;
+		TUniquePtr<FPBDRigidsSOAs> Particles;
+		TUniquePtr<FPBDRigidsEvolutionGBF> Evolution;
+		TUniquePtr<FImplicitObject> GroundGeom;
+		TUniquePtr<FImplicitObject> BoxGeom;
+	};
+
+	CHAOSPERF_TEST_CUSTOM(FRigidPilePerfTest, Scenario, RigidPile)
+	{
+		const FReal Dt = 1.0f / 60.0f;
+		for (int32 StepIndex = 0; StepIndex < RigidPileNumSteps; ++StepIndex)
+		{
+			Step(Dt);
+			NextFrame();
+		}
+	}
+
+
+	//
+	// A large batch of random rays against an AABB tree of boxes
+	//
+	struct FRaycastCountVisitor : public ISpatialVisitor<int32>
+	{
+		virtual bool Overlap(const TSpatialVisitorData<int32>& Instance) override
+		{
+			return true;
+		}
+
+		virtual bool Raycast(const TSpatialVisitorData<int32>& Instance, FQueryFastData& CurData) override
+		{
+			++NumHits;
+			return true;
+		}
+
+		virtual bool Sweep(const TSpatialVisitorData<int32>& Instance, FQueryFastData& CurData) override
+		{
+			return true;
+		}
+
+		int32 NumHits = 0;
+	};
+
+	class FRaycastBatchPerfTest : public FPerfTest
+	{
+	public:
+		using FTree = TAABBTree<int32, TAABBTreeLeafArray<int32>>;
+
+		FRaycastBatchPerfTest(const FString& InTestName)
+			: FPerfTest(InTestName)
+		{
+		}
+
+	protected:
+		virtual void CreateTest() override
+		{
+			const FReal BoxSize = 100;
+			const int32 NumBoxes = FMath::Max(RaycastBatchNumBoxes, 1);
+			const int32 NumPerSide = FMath::Max(FMath::CeilToInt(FMath::Pow((FReal)NumBoxes, 1.0f / 3.0f)), 1);
+			WorldSize = (FReal)NumPerSide * BoxSize * 2;
+
+			FRandomStream Random(1234);
+			BoxGeom = MakeUnique<TBox<FReal, 3>>(FVec3(0), FVec3(BoxSize));
+			Boxes = MakeUnique<FGeometryParticles>();
+			Boxes->AddParticles(NumBoxes);
+			for (int32 Index = 0; Index < NumBoxes; ++Index)
+			{
+				Boxes->X(Index) = FVec3(Random.FRandRange(0, WorldSize), Random.FRandRange(0, WorldSize), Random.FRandRange(0, WorldSize));
+				Boxes->R(Index) = FRotation3::Identity;
+				Boxes->SetGeometry(Index, MakeSerializable(BoxGeom));
+			}
+
+			// Build the tree outside of the timed section (no timeslicing)
+			Tree = MakeUnique<FTree>(MakeParticleView(Boxes.Get()), FTree::DefaultMaxChildrenInLeaf, FTree::DefaultMaxTreeDepth, FTree::DefaultMaxPayloadBounds, 0);
+
+			const int32 NumRays = FMath::Max(RaycastBatchNumRays, 0);
+			RayStarts.SetNumUninitialized(NumRays);
+			RayDirs.SetNumUninitialized(NumRays);
+			for (int32 Index = 0; Index < NumRays; ++Index)
+			{
+				RayStarts[Index] = FVec3(Random.FRandRange(0, WorldSize), Random.FRandRange(0, WorldSize), Random.FRandRange(0, WorldSize));
+				RayDirs[Index] = FVec3(Random.GetUnitVector());
+			}
+		}
+
+		virtual void DestroyTest() override
+		{
+			UE_LOG(LogChaosPerf, Display, TEXT("RaycastBatch: %d rays, %d hits"), RayStarts.Num(), NumHits);
+
+			RayStarts.Empty();
+			RayDirs.Empty();
+			Tree.Reset();
+			Boxes.Reset();
+			BoxGeom.Reset();
+		}
+
+		TUniquePtr<FTree> Tree;
+		TArray<FVec3> RayStarts;
+		TArray<FVec3> RayDirs;
+		FReal WorldSize = 0;
+		int32 NumHits = 0;
+
+	private:
+		TUniquePtr<TBox<FReal, 3>> BoxGeom;
+		TUniquePtr<FGeometryParticles> Boxes;
+	};
+
+	CHAOSPERF_TEST_CUSTOM(FRaycastBatchPerfTest, Scenario, RaycastBatch)
+	{
+		const FReal RayLength = 0.1f * WorldSize;
+		FRaycastCountVisitor Visitor;
+		for (int32 Index = 0; Index < RayStarts.Num(); ++Index)
+		{
+			Tree->Raycast(RayStarts[Index], RayDirs[Index], RayLength, Visitor);
+		}
+		NumHits = Visitor.NumHits;
+	}
+}
@@ -6,7 +6,8 @@
 namespace ChaosPerf
 {
 	//
-	// Base class for a one-shot perf test (i.e., no frame subdivisions in the output data)
+	// Base class for a perf test. By default a test is one-shot (i.e., no frame subdivisions in the output data),
+	// but a test that steps a simulation may call NextFrame() after each step to get one CSV row per step.
 	//
 	class FPerfTest
 	{
@@ -30,6 +31,16 @@ namespace ChaosPerf
 		// Override to do teardown outside of the timing capture
 		virtual void DestroyTest() {}
 
+		// Close the current CSV frame and start a new one so that per-step stats (e.g., the Chaos
+		// PhysicsVerbose phase timers) are written as separate rows in the output file.
+		void NextFrame()
+		{
+			FCsvProfiler::EndStat("Test", CSV_CATEGORY_INDEX(ChaosPerf));
+			CSVProfiler->EndFrame();
+			CSVProfiler->BeginFrame();
+			FCsvProfiler::BeginStat("Test", CSV_CATEGORY_INDEX(ChaosPerf));
+		}
+
 	private:
 		friend class FPerfTestRegistry;
 
@@ -150,7 +161,7 @@ namespace ChaosPerf
 		class TEST_CLASS : public BASE_CLASS	\
 		{ \
 		public: \
-			TEST_CLASS() : FPerfTest(#TEST_NAME) {} \
+			TEST_CLASS() : BASE_CLASS(#TEST_NAME) {} \
 			virtual void RunTest() override final; \
 		}; \
 		TSharedPtr<TEST_CLASS> Test_ ## TEST_NAME = MakeShared<TEST_CLASS>(); \
@@ -179,6 +190,9 @@ namespace ChaosPerf
 	// If you also need custom setup and shutdown, see CHAOSPERF_TEST_CUSTOM
 	#define CHAOSPERF_TEST_BASIC(CAT_ID, TEST_ID) CHAOSPERF_TEST_BASE(FPerfTest, CAT_ID ## TEST_ID)
 
-	// 
+	// Test macro for tests that need setup and teardown outside of the timing capture.
+	// TEST_BASE must derive from FPerfTest, have a constructor taking the test name, and
+	// override CreateTest() and DestroyTest() as required. The code in the braces following
+	// the macro is the implementation of RunTest().
 	#define CHAOSPERF_TEST_CUSTOM(TEST_BASE, CAT_ID, TEST_ID) CHAOSPERF_TEST_BASE(TEST_BASE, CAT_ID ## TEST_ID)
 }
\ No newline at end of file
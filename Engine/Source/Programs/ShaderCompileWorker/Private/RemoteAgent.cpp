@@ -0,0 +1,243 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+#include "IPAddress.h"
+#include "LaunchEngineLoop.h"
+
+// First message sent on every connection. Must match REMOTE_AGENT_HELLO_MAGIC in the RemoteShaderController plugin.
+#define REMOTE_AGENT_HELLO_MAGIC 0x41535255 // 'URSA'
+
+// Remote agent mode serves the RemoteShaderController plugin. Each connection from the engine carries one
+// task at a time: the serialized worker input is written to a local directory, a regular worker process
+// compiles it, and the output file is sent back along with the process return code.
+class FRemoteAgent
+{
+	const FString WorkingDirectory;
+	const uint32 NumSlots;
+
+	FSocket* ListenSocket;
+
+	static bool SendMessage(FSocket* Socket, const TArray<uint8>& Payload);
+	static bool ReceiveMessage(FSocket* Socket, TArray<uint8>& OutPayload);
+
+	void ConnectionThreadProc(FSocket* Socket);
+	int32 RunTask(const FString& Arguments, const TArray<uint8>& InputData, TArray<uint8>& OutOutputData);
+
+public:
+	FRemoteAgent(uint32 NumSlots);
+	~FRemoteAgent();
+
+	bool Init(int32 Port);
+
+	void Run();
+};
+
+FRemoteAgent::FRemoteAgent(uint32 InNumSlots)
+	: WorkingDirectory(FString::Printf(TEXT("%sUnrealRemoteShaderAgent/%s/"), FPlatformProcess::UserTempDir(), *FGuid::NewGuid().ToString(EGuidFormats::Digits)))
+	, NumSlots(InNumSlots)
+	, ListenSocket(nullptr)
+{}
+
+FRemoteAgent::~FRemoteAgent()
+{
+	if (ListenSocket)
+	{
+		ListenSocket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+	}
+
+	IFileManager::Get().DeleteDirectory(*WorkingDirectory, false, true);
+}
+
+bool FRemoteAgent::SendMessage(FSocket* Socket, const TArray<uint8>& Payload)
+{
+	uint32 Length = Payload.Num();
+	int32 BytesSent = 0;
+	if (!Socket->Send(reinterpret_cast<const uint8*>(&Length), sizeof(Length), BytesSent) || BytesSent != sizeof(Length))
+	{
+		return false;
+	}
+
+	for (int32 Offset = 0; Offset < Payload.Num(); Offset += BytesSent)
+	{
+		if (!Socket->Send(Payload.GetData() + Offset, Payload.Num() - Offset, BytesSent) || BytesSent <= 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FRemoteAgent::ReceiveMessage(FSocket* Socket, TArray<uint8>& OutPayload)
+{
+	uint32 Length = 0;
+	int32 BytesRead = 0;
+	for (int32 Offset = 0; Offset < (int32)sizeof(Length); Offset += BytesRead)
+	{
+		if (!Socket->Recv(reinterpret_cast<uint8*>(&Length) + Offset, sizeof(Length) - Offset, BytesRead, ESocketReceiveFlags::WaitAll) || BytesRead <= 0)
+		{
+			return false;
+		}
+	}
+
+	OutPayload.Reset(Length);
+	OutPayload.AddUninitialized(Length);
+	for (int32 Offset = 0; Offset < OutPayload.Num(); Offset += BytesRead)
+	{
+		if (!Socket->Recv(OutPayload.GetData() + Offset, OutPayload.Num() - Offset, BytesRead, ESocketReceiveFlags::WaitAll) || BytesRead <= 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FRemoteAgent::Init(int32 Port)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!SocketSubsystem)
+		return false;
+
+	TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+	Address->SetAnyAddress();
+	Address->SetPort(Port);
+
+	ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("RemoteShaderAgent"), Address->GetProtocolType());
+	if (!ListenSocket)
+		return false;
+
+	ListenSocket->SetReuseAddr(true);
+	return ListenSocket->Bind(*Address) && ListenSocket->Listen(64);
+}
+
+void FRemoteAgent::Run()
+{
+	UE_LOG(LogInit, Display, TEXT("Remote shader agent listening with %u slots."), NumSlots);
+
+	while (FSocket* Socket = ListenSocket->Accept(TEXT("RemoteShaderAgentConnection")))
+	{
+		Socket->SetNoDelay(true);
+
+		// Connections are long lived (one per controller slot), so each gets its own thread.
+		Async(EAsyncExecution::Thread, [this, Socket]() { ConnectionThreadProc(Socket); });
+	}
+}
+
+void FRemoteAgent::ConnectionThreadProc(FSocket* Socket)
+{
+	TArray<uint8> Buffer;
+	{
+		FMemoryWriter Writer(Buffer);
+		uint32 Magic = REMOTE_AGENT_HELLO_MAGIC;
+		uint32 Slots = NumSlots;
+		Writer << Magic;
+		Writer << Slots;
+	}
+
+	bool bConnected = SendMessage(Socket, Buffer);
+	while (bConnected && ReceiveMessage(Socket, Buffer))
+	{
+		uint32 TaskID = 0;
+		FString Arguments;
+		TArray<uint8> InputData;
+		{
+			FMemoryReader Reader(Buffer);
+			Reader << TaskID;
+			Reader << Arguments;
+			Reader << InputData;
+			if (Reader.IsError())
+				break;
+		}
+
+		TArray<uint8> OutputData;
+		int32 ReturnCode = RunTask(Arguments, InputData, OutputData);
+
+		Buffer.Reset();
+		{
+			FMemoryWriter Writer(Buffer);
+			Writer << TaskID;
+			Writer << ReturnCode;
+			Writer << OutputData;
+		}
+		bConnected = SendMessage(Socket, Buffer);
+	}
+
+	Socket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+}
+
+int32 FRemoteAgent::RunTask(const FString& Arguments, const TArray<uint8>& InputData, TArray<uint8>& OutOutputData)
+{
+	const FString TaskDirectory = WorkingDirectory / FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	const FString InputFileName(TEXT("Worker.in"));
+	const FString OutputFileName(TEXT("Worker.out"));
+
+	int32 ReturnCode = 1;
+	if (FFileHelper::SaveArrayToFile(InputData, *(TaskDirectory / InputFileName)))
+	{
+		// Same argument layout as the engine uses for local workers, with this process as the parent.
+		const FString WorkerParameters = FString::Printf(TEXT("\"%s/\" %d 0 \"%s\" \"%s\" %s"),
+			*TaskDirectory,
+			FPlatformProcess::GetCurrentProcessId(),
+			*InputFileName,
+			*OutputFileName,
+			*Arguments);
+
+		FProcHandle Handle = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *WorkerParameters, true, false, false, nullptr, 0, nullptr, nullptr);
+		if (Handle.IsValid())
+		{
+			FPlatformProcess::WaitForProc(Handle);
+			FPlatformProcess::GetProcReturnCode(Handle, &ReturnCode);
+			FPlatformProcess::CloseProc(Handle);
+
+			FFileHelper::LoadFileToArray(OutOutputData, *(TaskDirectory / OutputFileName), FILEREAD_Silent);
+		}
+	}
+
+	IFileManager::Get().DeleteDirectory(*TaskDirectory, false, true);
+	return ReturnCode;
+}
+
+// Selects the remote agent mode according to the command line, returning true and a
+// return code if it was run. Usage: ShaderCompileWorker -remoteagent <port> [-slots=<count>]
+bool RemoteAgentMain(int ArgC, TCHAR* ArgV[], int32& ReturnCode)
+{
+	if (ArgC < 3 || FCString::Strcmp(ArgV[1], TEXT("-remoteagent")) != 0)
+	{
+		return false;
+	}
+
+	GEngineLoop.PreInit(ArgC, ArgV, TEXT("-NOPACKAGECACHE -Multiprocess"));
+
+	int32 NumSlots = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	FParse::Value(FCommandLine::Get(), TEXT("slots="), NumSlots);
+
+	{
+		FRemoteAgent Instance(FMath::Max(NumSlots, 1));
+		if (Instance.Init(FCString::Atoi(ArgV[2])))
+		{
+			Instance.Run();
+			ReturnCode = 0;
+		}
+		else
+		{
+			// Failed to open the listen socket.
+			ReturnCode = 2;
+		}
+	}
+
+	FEngineLoop::AppPreExit();
+	FEngineLoop::AppExit();
+
+	return true;
+}
@@ -13,6 +13,8 @@
 #include "Interfaces/ITargetPlatformManagerModule.h"
 #include "RHIShaderFormatDefinitions.inl"
 #include "ShaderCompilerCommon.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #define DEBUG_USING_CONSOLE	0
 
@@ -232,26 +234,33 @@ public:
 
 				UE_LOG(LogShaders, Log, TEXT("Processing shader"));
 
-				ProcessInputFromArchive(InputFilePtr, SingleJobResults, PipelineJobResults);
-
-				LastCompileTime = FPlatformTime::Seconds();
+				// Pull the whole input into memory with a single read. Deserializing a large batch straight from
+				// the file reader turns every small property into a refill of its internal buffer.
+				InputBuffer.Reset();
+				InputBuffer.AddUninitialized(InputFilePtr->TotalSize());
+				InputFilePtr->Serialize(InputBuffer.GetData(), InputBuffer.Num());
 
 				// Close the input file.
 				delete InputFilePtr;
+
+				FMemoryReader InputReader(InputBuffer);
+				ProcessInputFromArchive(&InputReader, SingleJobResults, PipelineJobResults);
+
+				LastCompileTime = FPlatformTime::Seconds();
 			}
 
-			// Prepare for output
-#if UE_BUILD_DEBUG
-			TArray<uint8> MemBlock;
-			FMemoryWriter MemWriter(MemBlock);
-			FArchive* OutputFilePtr = &MemWriter;
-#else
+			// Prepare for output. Results are serialized to memory first so the output file is written in one go.
+			OutputBuffer.Reset();
+			{
+				FMemoryWriter MemWriter(OutputBuffer);
+				WriteToOutputArchive(&MemWriter, SingleJobResults, PipelineJobResults);
+			}
+
+#if !UE_BUILD_DEBUG
 			FArchive* OutputFilePtr = CreateOutputArchive();
 			check(OutputFilePtr);
-#endif
-			WriteToOutputArchive(OutputFilePtr, SingleJobResults, PipelineJobResults);
+			OutputFilePtr->Serialize(OutputBuffer.GetData(), OutputBuffer.Num());
 
-#if !UE_BUILD_DEBUG
 			// Close the output file.
 			delete OutputFilePtr;
 #endif
@@ -300,6 +309,14 @@ private:
 	TMap<FString, uint32> FormatVersionMap;
 	FString TempFilePath;
 
+	// Reused between batches to avoid reallocating for every input and output file.
+	TArray<uint8> InputBuffer;
+	TArray<uint8> OutputBuffer;
+
+	// How long after a batch completes to keep polling for the next input file at a short interval.
+	// The engine usually hands out the next batch right after reading the results of the previous one.
+	static constexpr double FastPollWindowSeconds = 1.0;
+
 	/** Opens an input file, trying multiple times if necessary. */
 	FArchive* OpenInputFile()
 	{
@@ -313,8 +330,9 @@ private:
 			if(!InputFile && !bFirstOpenTry)
 			{
 				CheckExitConditions();
-				// Give up CPU time while we are waiting
-				FPlatformProcess::Sleep(0.01f);
+				// Give up CPU time while we are waiting, polling more often right after finishing a batch
+				const bool bFastPoll = (FPlatformTime::Seconds() - LastCompileTime) < FastPollWindowSeconds;
+				FPlatformProcess::Sleep(bFastPoll ? 0.001f : 0.01f);
 			}
 			bFirstOpenTry = false;
 		}
@@ -1101,6 +1119,16 @@ INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 		}
 	}
 
+	// Redirect for the remote agent used by the RemoteShaderController plugin...
+	extern bool RemoteAgentMain(int ArgC, TCHAR* ArgV[], int32& ReturnCode);
+	{
+		int32 ReturnCode;
+		if (RemoteAgentMain(ArgC, ArgV, ReturnCode))
+		{
+			return ReturnCode;
+		}
+	}
+
 	FString OutputFilePath;
 
 	bool bDirectMode = false;
@@ -379,6 +379,9 @@ bool TLightingCache<SampleType>::InterpolateLighting(
 	SampleType SecondAccumulatedLighting(ForceInit);
 	float SecondTotalWeight = 0.0f;
 	float AccumulatedBackfacingHitsFraction = 0.0f;
+	const float NonGradientLighting = bShowGradientsOnly ? 0.0f : 1.0f;
+	const float SecondAngleNormalization = FMath::Lerp(InterpolationAngleNormalization, AngleNormalization, SecondInterpolationSmoothnessReduction);
+	const bool bDebugRecords = bVisualizeIrradianceSamples && bDebugThisSample && BounceNumber == 1;
 
 	// Iterate over the octree nodes containing the query point.
 	for( typename LightingOctreeType::template TConstElementBoxIterator<> OctreeIt(
@@ -399,6 +402,19 @@ bool TLightingCache<SampleType>::InterpolateLighting(
 
 		const float Distance = FMath::Sqrt(DistanceSquared);
 
+		const float EffectiveRadius = bFirstPass ? LightingRecord.Radius : LightingRecord.InterpolationRadius;
+		const float SecondEffectiveRadius = FMath::Lerp(LightingRecord.Radius, EffectiveRadius, SecondInterpolationSmoothnessReduction);
+		const float NormalDot = Dot3(LightingRecord.Vertex.WorldTangentZ, Vertex.WorldTangentZ);
+		const float NormalError = FMath::Sqrt(FMath::Max(1.0f - NormalDot, 0.0f));
+
+		// Most records overlapping the query point are rejected by both interpolations on distance or normal error alone,
+		// skip the plane and gradient math for those. The total error is a max, so neither can bring the error back below 1.
+		if (!bDebugRecords
+			&& (Distance > FMath::Max(EffectiveRadius, SecondEffectiveRadius) || FMath::Min(AngleNormalization, SecondAngleNormalization) * NormalError >= 1.0f))
+		{
+			continue;
+		}
+
 		// Don't use a lighting record if it's in front of the query point.
 		// Query points behind the lighting record may have nearby occluders that the lighting record does not see.
 		const FVector4 RecordToVertexVector = Vertex.WorldPosition - LightingRecord.Vertex.WorldPosition;
@@ -408,9 +424,6 @@ bool TLightingCache<SampleType>::InterpolateLighting(
 		// Setup an error metric that goes from 0 if the points are coplanar, to 1 if the point being shaded is at the angle corresponding to MinCosPointBehindPlane behind the plane
 		const float PointBehindPlaneError = FMath::Max(PlaneDistance / MinCosPointBehindPlane, 0.0f);
 
-		const float NormalDot = Dot3(LightingRecord.Vertex.WorldTangentZ, Vertex.WorldTangentZ);
-
-		const float NonGradientLighting = bShowGradientsOnly ? 0.0f : 1.0f;
 		float RotationalGradientContribution = 0.0f;
 		float TranslationalGradientContribution = 0.0f;
 
@@ -425,11 +438,9 @@ bool TLightingCache<SampleType>::InterpolateLighting(
 		// This error metric has the advantages (over Ward's original metric from "A Ray Tracing Solution to Diffuse Interreflection")
 		// That it goes to 0 at the record's radius, which avoids discontinuities,
 		// And it is finite at the record's center, which allows filtering the records to be more effective.
-		const float EffectiveRadius = bFirstPass ? LightingRecord.Radius : LightingRecord.InterpolationRadius;
-
 		{
 			const float DistanceRatio = Distance / EffectiveRadius;
-			const float NormalRatio = AngleNormalization * FMath::Sqrt(FMath::Max(1.0f - NormalDot, 0.0f));
+			const float NormalRatio = AngleNormalization * NormalError;
 			// The total error is the max of the distance, normal and plane errors
 			float RecordError = FMath::Max(DistanceRatio, NormalRatio);
 			RecordError = FMath::Max(RecordError, PointBehindPlaneError);
@@ -449,7 +460,7 @@ bool TLightingCache<SampleType>::InterpolateLighting(
 					RecordCollector->AddInfluencingRecord(LightingRecord.Id, RecordWeight);
 				}
 
-				if (bVisualizeIrradianceSamples && bDebugThisSample && BounceNumber == 1)
+				if (bDebugRecords)
 				{
 					for (int32 i = 0; i < DebugCacheRecords.Num(); i++)
 					{
@@ -468,9 +479,8 @@ bool TLightingCache<SampleType>::InterpolateLighting(
 		// This is useful for lighting components like AO and sky shadowing where less smoothing is needed to hide noise
 		// This interpolation is done in the same pass to prevent another traversal of the octree
 		{
-			const float DistanceRatio = Distance / FMath::Lerp(LightingRecord.Radius, EffectiveRadius, SecondInterpolationSmoothnessReduction);
-			const float SecondAngleNormalization = FMath::Lerp(InterpolationAngleNormalization, AngleNormalization, SecondInterpolationSmoothnessReduction);
-			const float NormalRatio = SecondAngleNormalization * FMath::Sqrt(FMath::Max(1.0f - NormalDot, 0.0f));
+			const float DistanceRatio = Distance / SecondEffectiveRadius;
+			const float NormalRatio = SecondAngleNormalization * NormalError;
 			// The total error is the max of the distance, normal and plane errors
 			float RecordError = FMath::Max(DistanceRatio, NormalRatio);
 			RecordError = FMath::Max(RecordError, PointBehindPlaneError);
@@ -486,7 +496,7 @@ bool TLightingCache<SampleType>::InterpolateLighting(
 			}
 		}
 
-		if (bVisualizeIrradianceSamples && bDebugThisSample && BounceNumber == 1)
+		if (bDebugRecords)
 		{
 			for (int32 i = 0; i < DebugCacheRecords.Num(); i++)
 			{
@@ -252,6 +252,9 @@ protected:
 	/** offsets in ValueMemory for each key */
 	TArray<uint16> ValueOffsets;
 
+	/** key IDs of BlackboardAsset by name, avoids walking keys of whole parent chain in name based accessors */
+	TMap<FName, FBlackboard::FKey> KeyIDCache;
+
 	/** instanced keys with custom data allocations */
 	UPROPERTY(transient)
 	TArray<UBlackboardKeyType*> KeyInstances;
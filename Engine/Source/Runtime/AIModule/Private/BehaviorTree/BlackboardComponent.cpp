@@ -130,6 +130,7 @@ bool UBlackboardComponent::InitializeBlackboard(UBlackboardData& NewAsset)
 	BlackboardAsset = &NewAsset;
 	ValueMemory.Reset();
 	ValueOffsets.Reset();
+	KeyIDCache.Reset();
 	bSynchronizedKeyPopulated = false;
 
 	bool bSuccess = true;
@@ -147,6 +148,9 @@ bool UBlackboardComponent::InitializeBlackboard(UBlackboardData& NewAsset)
 		{
 			for (int32 KeyIndex = 0; KeyIndex < It->Keys.Num(); KeyIndex++)
 			{
+				// keys closer to BlackboardAsset win, same as UBlackboardData::GetKeyID
+				KeyIDCache.FindOrAdd(It->Keys[KeyIndex].EntryName, KeyIndex + It->GetFirstKeyID());
+
 				UBlackboardKeyType* KeyType = It->Keys[KeyIndex].KeyType;
 				if (KeyType)
 				{
@@ -284,6 +288,11 @@ FName UBlackboardComponent::GetKeyName(FBlackboard::FKey KeyID) const
 
 FBlackboard::FKey UBlackboardComponent::GetKeyID(const FName& KeyName) const
 {
+	if (const FBlackboard::FKey* CachedKeyID = KeyIDCache.Find(KeyName))
+	{
+		return *CachedKeyID;
+	}
+
 	return BlackboardAsset ? BlackboardAsset->GetKeyID(KeyName) : FBlackboard::InvalidKey;
 }
 
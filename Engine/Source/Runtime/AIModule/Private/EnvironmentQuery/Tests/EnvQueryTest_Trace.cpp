@@ -7,9 +7,19 @@
 #include "Engine/World.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "EnvQueryGenerator"
 
+namespace FEnvQueryTestTraceCVars
+{
+	/** number of items traced together on worker threads, 0 runs traces one by one on calling thread */
+	int32 ParallelBatchSize = 32;
+	FAutoConsoleVariableRef CVarParallelBatchSize(TEXT("ai.eqs.TraceParallelBatchSize"), ParallelBatchSize,
+		TEXT("Number of items traced in parallel by EQS trace test before their scores are stored.\n0: Disable"), ECVF_Default);
+}
+
 UEnvQueryTest_Trace::UEnvQueryTest_Trace(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	Cost = EEnvTestCost::High;
@@ -77,6 +87,46 @@ void UEnvQueryTest_Trace::RunTest(FEnvQueryInstance& QueryInstance) const
 		ContextLocations[ContextIndex].Z += ContextZ;
 	}
 
+	const int32 BatchSize = FEnvQueryTestTraceCVars::ParallelBatchSize;
+	if (BatchSize > 0 && ContextLocations.Num() > 0 && FApp::ShouldUseThreadingForPerformance())
+	{
+		// scene queries only read physics scene, so traces of a batch can run on worker threads;
+		// scores are still stored in item order by the iterator, which keeps time slicing and single result mode intact
+		TArray<FVector> BatchLocations;
+		TArray<AActor*> BatchActors;
+		TArray<bool> BatchHits;
+
+		FEnvQueryInstance::ItemIterator It(this, QueryInstance);
+		while (It)
+		{
+			BatchLocations.Reset();
+			BatchActors.Reset();
+			for (FEnvQueryInstance::FConstItemIterator BatchIt(QueryInstance, It.GetIndex()); BatchIt && BatchLocations.Num() < BatchSize; ++BatchIt)
+			{
+				BatchLocations.Add(GetItemLocation(QueryInstance, BatchIt.GetIndex()) + FVector(0, 0, ItemZ));
+				BatchActors.Add(GetItemActor(QueryInstance, BatchIt.GetIndex()));
+			}
+
+			const int32 NumContexts = ContextLocations.Num();
+			BatchHits.SetNumUninitialized(BatchLocations.Num() * NumContexts);
+			ParallelFor(BatchHits.Num(), [&](int32 TraceIndex)
+			{
+				const int32 BatchItemIndex = TraceIndex / NumContexts;
+				BatchHits[TraceIndex] = TraceFunc.Execute(BatchLocations[BatchItemIndex], ContextLocations[TraceIndex % NumContexts], BatchActors[BatchItemIndex], QueryInstance.World, TraceCollisionChannel, TraceParams, TraceExtent);
+			});
+
+			for (int32 BatchItemIndex = 0; BatchItemIndex < BatchLocations.Num() && It; BatchItemIndex++, ++It)
+			{
+				for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+				{
+					It.SetScore(TestPurpose, FilterType, BatchHits[BatchItemIndex * NumContexts + ContextIndex], bWantsHit);
+				}
+			}
+		}
+
+		return;
+	}
+
 	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
 	{
 		const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex()) + FVector(0, 0, ItemZ);
@@ -9,6 +9,8 @@
 #include "VisualLogger/VisualLogger.h"
 #include "AIModuleLog.h"
 #include "Engine/Engine.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_RECAST
 #include "NavMesh/RecastHelpers.h"
@@ -36,6 +38,14 @@ DECLARE_CYCLE_STAT(TEXT("Step: movement"), STAT_AI_Crowd_StepMovementTime, STATG
 DECLARE_CYCLE_STAT(TEXT("Agent Update Time"), STAT_AI_Crowd_AgentUpdateTime, STATGROUP_AICrowd);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Agents"), STAT_AI_Crowd_NumAgents, STATGROUP_AICrowd);
 
+namespace FCrowdParallelUpdate
+{
+	/** minimal number of active agents for gathering their position and velocity in parallel, 0 disables it */
+	int32 MinAgentsForParallelPrepare = 128;
+	FAutoConsoleVariableRef CVarMinAgentsForParallelPrepare(TEXT("ai.crowd.ParallelPrepareMinAgents"), MinAgentsForParallelPrepare,
+		TEXT("Minimal number of active crowd agents to prepare their simulation step in parallel.\n0: Disable"), ECVF_Default);
+}
+
 namespace FCrowdDebug
 {
 	/** if set, debug information will be displayed for agent selected in editor */
@@ -261,13 +271,38 @@ void UCrowdManager::Tick(float DeltaTime)
 		{
 			MyNavData->BeginBatchQuery();
 
-			for (auto It = ActiveAgents.CreateIterator(); It; ++It)
+			const bool bPrepareInParallel = FCrowdParallelUpdate::MinAgentsForParallelPrepare > 0
+				&& ActiveAgents.Num() >= FCrowdParallelUpdate::MinAgentsForParallelPrepare
+				&& FApp::ShouldUseThreadingForPerformance();
+
+			if (bPrepareInParallel)
+			{
+				// each agent writes only to its own dtCrowdAgent and FCrowdAgentData
+				TArray<TPair<const ICrowdAgentInterface*, FCrowdAgentData*>> AgentsToPrepare;
+				AgentsToPrepare.Reserve(ActiveAgents.Num());
+				for (auto It = ActiveAgents.CreateIterator(); It; ++It)
+				{
+					if (It.Value().IsValid())
+					{
+						AgentsToPrepare.Emplace(It.Key(), &It.Value());
+					}
+				}
+
+				ParallelFor(AgentsToPrepare.Num(), [this, &AgentsToPrepare, DeltaTime](int32 Index)
+				{
+					PrepareAgentStep(AgentsToPrepare[Index].Key, *AgentsToPrepare[Index].Value, DeltaTime);
+				});
+			}
+			else
 			{
-				// collect position and velocity
-				FCrowdAgentData& AgentData = It.Value();
-				if (AgentData.IsValid())
+				for (auto It = ActiveAgents.CreateIterator(); It; ++It)
 				{
-					PrepareAgentStep(It.Key(), AgentData, DeltaTime);
+					// collect position and velocity
+					FCrowdAgentData& AgentData = It.Value();
+					if (AgentData.IsValid())
+					{
+						PrepareAgentStep(It.Key(), AgentData, DeltaTime);
+					}
 				}
 			}
 
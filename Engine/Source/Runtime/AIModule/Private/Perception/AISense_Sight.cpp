@@ -11,6 +11,8 @@
 #include "VisualLogger/VisualLogger.h"
 #include "Perception/AISightTargetInterface.h"
 #include "Perception/AISenseConfig_Sight.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
 
 #define DO_SIGHT_VLOGGING (0 && ENABLE_VISUAL_LOG)
 
@@ -33,6 +35,14 @@ DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Remove To Target"), STAT_AI_Se
 static const int32 DefaultMaxTracesPerTick = 6;
 static const int32 DefaultMinQueriesPerTimeSliceCheck = 40;
 
+namespace FAISenseSightCVars
+{
+	/** if set, line of sight traces done by sense itself are gathered during update and run in parallel at its end */
+	int32 ParallelTraces = 1;
+	FAutoConsoleVariableRef CVarParallelTraces(TEXT("ai.perception.sight.ParallelTraces"), ParallelTraces,
+		TEXT("Run line of sight traces of a sight sense update in parallel.\n0: Disable, 1: Enable"), ECVF_Default);
+}
+
 enum class EForEachResult : uint8
 {
 	Break,
@@ -228,6 +238,63 @@ float UAISense_Sight::Update()
 
 	AIPerception::FListenerMap& ListenersMap = *GetListeners();
 
+	auto ApplyLineOfSightResult = [this](FAISightQuery& SightQuery, FPerceptionListener& Listener, AActor* TargetActor, const FVector& TargetLocation, const bool bHit, const FHitResult& HitResult)
+	{
+		auto HitResultActorIsOwnedByTargetActor = [&HitResult, TargetActor]()
+		{
+			AActor* HitResultActor = HitResult.Actor.Get();
+			return (HitResultActor ? HitResultActor->IsOwnedBy(TargetActor) : false);
+		};
+
+		if (bHit == false || HitResultActorIsOwnedByTargetActor())
+		{
+			Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, TargetLocation, Listener.CachedLocation));
+			SightQuery.bLastResult = true;
+			SightQuery.LastSeenLocation = TargetLocation;
+		}
+		// communicate failure only if we've seen give actor before
+		else if (SightQuery.bLastResult == true)
+		{
+			Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+			SightQuery.bLastResult = false;
+			SightQuery.LastSeenLocation = FAISystem::InvalidLocation;
+		}
+
+		if (SightQuery.bLastResult == false)
+		{
+			SIGHT_LOG_LOCATION(Listener.Listener->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
+		}
+	};
+
+	auto FinishQuery = [this, &QueryOperations](FAISightQuery& SightQuery, const FPerceptionListener& Listener, const FVector& TargetLocation, const float SightRadiusSq, const bool bIsInRangeQuery, const int32 QueryListIndex)
+	{
+		SightQuery.Importance = CalcQueryImportance(Listener, TargetLocation, SightRadiusSq);
+		const bool bShouldBeInRange = SightQuery.Importance > 0.0f;
+		if (bIsInRangeQuery != bShouldBeInRange)
+		{
+			QueryOperations.Add(FQueryOperation(bIsInRangeQuery, EOperationType::SwapList, QueryListIndex));
+		}
+
+		// restart query
+		SightQuery.OnProcessed();
+	};
+
+	// line of sight traces waiting for the end of query loop, query lists are not modified until then
+	struct FDeferredSightTrace
+	{
+		FAISightQuery* SightQuery;
+		FPerceptionListener* Listener;
+		AActor* TargetActor;
+		FVector TargetLocation;
+		float SightRadiusSq;
+		int32 QueryListIndex;
+		bool bIsInRangeQuery;
+		bool bHit;
+		FHitResult HitResult;
+	};
+	TArray<FDeferredSightTrace> DeferredTraces;
+	const bool bDeferTraces = FAISenseSightCVars::ParallelTraces && FApp::ShouldUseThreadingForPerformance();
+
 	int32 InRangeItr = 0;
 	int32 OutOfRangeItr = 0;
 	for (int32 QueryIndex = 0; QueryIndex < SightQueriesInRange.Num() + SightQueriesOutOfRange.Num(); ++QueryIndex)
@@ -320,6 +387,22 @@ float UAISense_Sight::Update()
 
 						TracesCount += NumberOfLoSChecksPerformed;
 					}
+					else if (bDeferTraces)
+					{
+						// we need to do tests ourselves, trace is run together with others at the end of update
+						FDeferredSightTrace& DeferredTrace = DeferredTraces.AddDefaulted_GetRef();
+						DeferredTrace.SightQuery = SightQuery;
+						DeferredTrace.Listener = &Listener;
+						DeferredTrace.TargetActor = TargetActor;
+						DeferredTrace.TargetLocation = TargetLocation;
+						DeferredTrace.SightRadiusSq = SightRadiusSq;
+						DeferredTrace.QueryListIndex = bIsInRangeQuery ? InRangeIndex : OutOfRangeIndex;
+						DeferredTrace.bIsInRangeQuery = bIsInRangeQuery;
+						DeferredTrace.bHit = false;
+
+						++TracesCount;
+						continue;
+					}
 					else
 					{
 						// we need to do tests ourselves
@@ -330,30 +413,7 @@ float UAISense_Sight::Update()
 
 						++TracesCount;
 
-						auto HitResultActorIsOwnedByTargetActor = [&HitResult, TargetActor]()
-						{
-							AActor* HitResultActor = HitResult.Actor.Get();
-							return (HitResultActor ? HitResultActor->IsOwnedBy(TargetActor) : false);
-						};
-
-						if (bHit == false || HitResultActorIsOwnedByTargetActor())
-						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, TargetLocation, Listener.CachedLocation));
-							SightQuery->bLastResult = true;
-							SightQuery->LastSeenLocation = TargetLocation;
-						}
-						// communicate failure only if we've seen give actor before
-						else if (SightQuery->bLastResult == true)
-						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-							SightQuery->bLastResult = false;
-							SightQuery->LastSeenLocation = FAISystem::InvalidLocation;
-						}
-
-						if (SightQuery->bLastResult == false)
-						{
-							SIGHT_LOG_LOCATION(ListenerPtr->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
-						}
+						ApplyLineOfSightResult(*SightQuery, Listener, TargetActor, TargetLocation, bHit, HitResult);
 					}
 				}
 				// communicate failure only if we've seen give actor before
@@ -364,15 +424,7 @@ float UAISense_Sight::Update()
 					SightQuery->bLastResult = false;
 				}
 
-				SightQuery->Importance = CalcQueryImportance(Listener, TargetLocation, SightRadiusSq);
-				const bool bShouldBeInRange = SightQuery->Importance > 0.0f;
-				if (bIsInRangeQuery != bShouldBeInRange)
-				{
-					QueryOperations.Add(FQueryOperation(bIsInRangeQuery, EOperationType::SwapList, bIsInRangeQuery ? InRangeIndex : OutOfRangeIndex));
-				}
-
-				// restart query
-				SightQuery->OnProcessed();
+				FinishQuery(*SightQuery, Listener, TargetLocation, SightRadiusSq, bIsInRangeQuery, bIsInRangeQuery ? InRangeIndex : OutOfRangeIndex);
 			}
 			else
 			{
@@ -389,6 +441,24 @@ float UAISense_Sight::Update()
 			break;
 		}
 	}
+
+	if (DeferredTraces.Num() > 0)
+	{
+		ParallelFor(DeferredTraces.Num(), [this, World, &DeferredTraces](int32 TraceIndex)
+		{
+			FDeferredSightTrace& DeferredTrace = DeferredTraces[TraceIndex];
+			DeferredTrace.bHit = World->LineTraceSingleByChannel(DeferredTrace.HitResult, DeferredTrace.Listener->CachedLocation, DeferredTrace.TargetLocation
+				, DefaultSightCollisionChannel
+				, FCollisionQueryParams(SCENE_QUERY_STAT(AILineOfSight), true, DeferredTrace.Listener->GetBodyActor()));
+		});
+
+		for (FDeferredSightTrace& DeferredTrace : DeferredTraces)
+		{
+			ApplyLineOfSightResult(*DeferredTrace.SightQuery, *DeferredTrace.Listener, DeferredTrace.TargetActor, DeferredTrace.TargetLocation, DeferredTrace.bHit, DeferredTrace.HitResult);
+			FinishQuery(*DeferredTrace.SightQuery, *DeferredTrace.Listener, DeferredTrace.TargetLocation, DeferredTrace.SightRadiusSq, DeferredTrace.bIsInRangeQuery, DeferredTrace.QueryListIndex);
+		}
+	}
+
 	NextOutOfRangeIndex = SightQueriesOutOfRange.Num() > 0 ? (NextOutOfRangeIndex + OutOfRangeItr) % SightQueriesOutOfRange.Num() : 0;
 
 #ifdef AISENSE_SIGHT_TIMESLICING_DEBUG
@@ -22,6 +22,8 @@
 #include "Misc/RedirectCollector.h"
 #include "Async/Async.h"
 #include "Serialization/LargeMemoryReader.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFilemanager.h"
 #include "Misc/ScopeExit.h"
 #include "HAL/ThreadHeartBeat.h"
 #include "HAL/PlatformMisc.h"
@@ -75,6 +77,13 @@ static FAutoConsoleVariableRef CVarLoadPremadeRegistryInEditor(
 	TEXT(""));
 #endif
 
+static bool bMapCookedAssetRegistry = false;
+static FAutoConsoleVariableRef CVarMapCookedAssetRegistry(
+	TEXT("AssetRegistry.MapCookedRegistry"),
+	bMapCookedAssetRegistry,
+	TEXT("If true, the cooked AssetRegistry.bin is deserialized from a memory mapped view of the file when the platform file supports it,\n")
+	TEXT("instead of first being read into a temporary buffer the size of the whole file. Lowers the peak memory of loading the registry."));
+
 /** This will always read the ini, public version may return cache */
 static void InitializeSerializationOptionsFromIni(FAssetRegistrySerializationOptions& Options, const FString& PlatformIniName);
 
@@ -82,6 +91,18 @@ static bool LoadAssetRegistry(const TCHAR* Path, const FAssetRegistryLoadOptions
 {
 	check(Path);
 
+	if (bMapCookedAssetRegistry)
+	{
+		// Load copies everything out of the archive, so the mapping only needs to live until it returns
+		TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(Path));
+		TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile ? MappedFile->MapRegion(0, MAX_int64, true) : nullptr);
+		if (MappedRegion)
+		{
+			FLargeMemoryReader MemoryReader(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+			return Out.Load(MemoryReader, Options);
+		}
+	}
+
 	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(Path));
 	if (FileReader)
 	{
@@ -1143,6 +1143,25 @@ void FAssetRegistryState::Load(Archive&& Ar, FAssetRegistryVersion::Type Version
 	int32 LocalNumPackageData = 0;
 	Ar << LocalNumPackageData;
 
+	auto LoadPackageData = [&Ar, Version](FAssetPackageData& PackageData)
+	{
+		if (Version < FAssetRegistryVersion::AddedPackageCookKey)
+		{
+			Ar << PackageData.DiskSize;
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			Ar << PackageData.PackageGuid;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			if (Version >= FAssetRegistryVersion::AddedCookedMD5Hash)
+			{
+				Ar << PackageData.CookedHash;
+			}
+		}
+		else
+		{
+			PackageData.SerializeForCache(Ar);
+		}
+	};
+
 	if (LocalNumPackageData > 0)
 	{
 		if (Options.bLoadPackageData)
@@ -1155,17 +1174,7 @@ void FAssetRegistryState::Load(Archive&& Ar, FAssetRegistryVersion::Type Version
 				FName PackageName;
 				Ar << PackageName;
 		
-				if (Version < FAssetRegistryVersion::AddedCookedMD5Hash)
-				{
-					Ar << NewPackageData.DiskSize;
-					PRAGMA_DISABLE_DEPRECATION_WARNINGS
-					Ar << NewPackageData.PackageGuid;
-					PRAGMA_ENABLE_DEPRECATION_WARNINGS
-				}
-				else
-				{
-					NewPackageData.SerializeForCache(Ar);
-				}
+				LoadPackageData(NewPackageData);
 
 				CachedPackageData.Add(PackageName, &NewPackageData);
 			}	
@@ -1178,7 +1187,7 @@ void FAssetRegistryState::Load(Archive&& Ar, FAssetRegistryVersion::Type Version
 				Ar << PackageName;
 
 				FAssetPackageData FakeData;
-				FakeData.SerializeForCache(Ar);
+				LoadPackageData(FakeData);
 			}
 		}
 	}
@@ -13,6 +13,7 @@
 #include "SoundFieldRendering.h"
 #include "ProfilingDebugging/CsvProfiler.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Stats/Stats.h"
 
 // Link to "Audio" profiling category
@@ -25,6 +26,14 @@ FAutoConsoleVariableRef CVarDisableParallelSourceProcessing(
 	TEXT("0: Not Disabled, 1: Disabled"),
 	ECVF_Default);
 
+static int32 ParallelSourceProcessingBatchSizeCvar = 0;
+FAutoConsoleVariableRef CVarParallelSourceProcessingBatchSize(
+	TEXT("au.ParallelSourceProcessingBatchSize"),
+	ParallelSourceProcessingBatchSizeCvar,
+	TEXT("When parallel source processing is enabled, splits sources into batches of this many voices and processes them with ParallelFor rather than the fixed set of source workers.\n")
+	TEXT("0: Use the fixed source workers, >0: Number of sources per batch"),
+	ECVF_Default);
+
 static int32 DisableFilteringCvar = 0;
 FAutoConsoleVariableRef CVarDisableFiltering(
 	TEXT("au.DisableFiltering"),
@@ -2415,7 +2424,19 @@ namespace Audio
 			return;
 		}
 
-		if (NumSourceWorkers > 0 && !DisableParallelSourceProcessingCvar)
+		if (ParallelSourceProcessingBatchSizeCvar > 0 && !DisableParallelSourceProcessingCvar)
+		{
+			// Smaller batches let the task graph balance the load when active voices are unevenly spread across source ids
+			const int32 BatchSize = ParallelSourceProcessingBatchSizeCvar;
+			const int32 NumBatches = FMath::DivideAndRoundUp(NumTotalSources, BatchSize);
+			ParallelFor(NumBatches, [this, bGenerateBuses, BatchSize](int32 BatchIndex)
+			{
+				const int32 SourceIdStart = BatchIndex * BatchSize;
+				const int32 SourceIdEnd = FMath::Min(SourceIdStart + BatchSize, NumTotalSources);
+				GenerateSourceAudio(bGenerateBuses, SourceIdStart, SourceIdEnd);
+			});
+		}
+		else if (NumSourceWorkers > 0 && !DisableParallelSourceProcessingCvar)
 		{
 			AUDIO_MIXER_CHECK(SourceWorkers.Num() == NumSourceWorkers);
 			for (int32 i = 0; i < SourceWorkers.Num(); ++i)
@@ -18,6 +18,7 @@
 #include "Misc/ScopeLock.h"
 #include "Containers/LockFreeList.h"
 #include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
 #include "Stats/Stats.h"
 #include "Misc/CoreStats.h"
 #include "Math/RandomStream.h"
@@ -31,6 +32,8 @@
 #include "ProfilingDebugging/ExternalProfiler.h"
 #include "ProfilingDebugging/MiscTrace.h"
 #include "ProfilingDebugging/ScopedTimers.h"
+
+#include <atomic>
 #include "Misc/ConfigCacheIni.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogTaskGraph, Log, All);
@@ -80,6 +83,20 @@ static FAutoConsoleVariableRef CVarTestDontCompleteUntilForAlreadyComplete(
 	TEXT("If 1, then we before spawning a gather task, we just check if all of the subtasks are complete, and in that case we can skip the gather.")
 );
 
+static int32 GTaskGraphUseWorkStealing = 0;
+static FAutoConsoleVariableRef CVarTaskGraphUseWorkStealing(
+	TEXT("TaskGraph.UseWorkStealing"),
+	GTaskGraphUseWorkStealing,
+	TEXT("If 1, normal task priority tasks spawned from a worker thread are queued on that worker's own deque, which idle workers of the same priority set steal from, instead of the shared queue.")
+);
+
+static int32 GTaskGraphWorkStealingSpinCount = 32;
+static FAutoConsoleVariableRef CVarTaskGraphWorkStealingSpinCount(
+	TEXT("TaskGraph.WorkStealingSpinCount"),
+	GTaskGraphWorkStealingSpinCount,
+	TEXT("When TaskGraph.UseWorkStealing is enabled, the number of times an idle worker yields and looks for work again before it stalls and waits to be woken up.")
+);
+
 UE_DEPRECATED(4.26, "No longer supported") CORE_API int32 GEnablePowerSavingThreadPriorityReductionCVar = 0;
 
 CORE_API bool GAllowTaskGraphForkMultithreading = true;
@@ -1154,6 +1171,140 @@ struct FWorkerThread
 	}
 };
 
+/**
+ *	FWorkStealingDeque
+ *	Bounded Chase-Lev deque of tasks owned by one worker thread.
+ *	The owner pushes and pops at the bottom (LIFO), other workers steal from the top (FIFO).
+**/
+class FWorkStealingDeque
+{
+public:
+	FWorkStealingDeque()
+		: Top(0)
+		, Bottom(0)
+	{
+		for (std::atomic<FBaseGraphTask*>& Slot : Tasks)
+		{
+			Slot.store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	/** Owner only. @return false if the deque is full, in which case the task was not queued. */
+	bool Push(FBaseGraphTask* Task)
+	{
+		const int64 LocalBottom = Bottom.load(std::memory_order_relaxed);
+		const int64 LocalTop = Top.load(std::memory_order_acquire);
+		if (LocalBottom - LocalTop >= Capacity)
+		{
+			return false;
+		}
+
+		Tasks[LocalBottom & (Capacity - 1)].store(Task, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Bottom.store(LocalBottom + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/** Owner only. @return the most recently pushed task, or nullptr if the deque is empty. */
+	FBaseGraphTask* Pop()
+	{
+		const int64 LocalBottom = Bottom.load(std::memory_order_relaxed) - 1;
+		Bottom.store(LocalBottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 LocalTop = Top.load(std::memory_order_relaxed);
+
+		if (LocalTop > LocalBottom)
+		{
+			Bottom.store(LocalBottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		FBaseGraphTask* Task = Tasks[LocalBottom & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (LocalTop == LocalBottom)
+		{
+			// last task, race against the thieves for it
+			if (!Top.compare_exchange_strong(LocalTop, LocalTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				Task = nullptr;
+			}
+			Bottom.store(LocalBottom + 1, std::memory_order_relaxed);
+		}
+		return Task;
+	}
+
+	/** Any thread. @return the oldest task, or nullptr if the deque is empty or another thread won the race for it. */
+	FBaseGraphTask* Steal()
+	{
+		int64 LocalTop = Top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64 LocalBottom = Bottom.load(std::memory_order_acquire);
+
+		if (LocalTop >= LocalBottom)
+		{
+			return nullptr;
+		}
+
+		FBaseGraphTask* Task = Tasks[LocalTop & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (!Top.compare_exchange_strong(LocalTop, LocalTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+		return Task;
+	}
+
+private:
+	/** Number of tasks the deque can hold, must be a power of two. Tasks that don't fit go to the shared queue. */
+	static constexpr int64 Capacity = 256;
+
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int64> Top;
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int64> Bottom;
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<FBaseGraphTask*> Tasks[Capacity];
+};
+
+/** Traces the calling thread blocking on a set of tasks, so analysis can tell which task a thread was waiting for */
+struct FTaskGraphWaitTraceScope
+{
+#if TASKGRAPHTRACE_ENABLED
+	explicit FTaskGraphWaitTraceScope(const FGraphEventArray& Tasks)
+		: bTraced(false)
+	{
+		if (!TRACE_TASKGRAPH_ENABLED())
+		{
+			return;
+		}
+
+		TArray<uint64, TInlineAllocator<16>> TaskIds;
+		for (const FGraphEventRef& Task : Tasks)
+		{
+			if (Task.GetReference() && Task->GetTraceId())
+			{
+				TaskIds.Add(Task->GetTraceId());
+			}
+		}
+
+		if (TaskIds.Num())
+		{
+			FTaskGraphTrace::WaitBegin(TaskIds.GetData(), TaskIds.Num());
+			bTraced = true;
+		}
+	}
+
+	~FTaskGraphWaitTraceScope()
+	{
+		if (bTraced)
+		{
+			FTaskGraphTrace::WaitEnd();
+		}
+	}
+
+	bool bTraced;
+#else
+	explicit FTaskGraphWaitTraceScope(const FGraphEventArray& Tasks)
+	{
+	}
+#endif
+};
+
 /**
 *	FTaskGraphImplementation
 *	Implementation of the centralized part of the task graph system.
@@ -1235,6 +1386,16 @@ public:
 		ReentrancyCheck.Increment(); // just checking for reentrancy
 		PerThreadIDTLSSlot = FPlatformTLS::AllocTlsSlot();
 
+		// The deques are always created when multithreaded, so TaskGraph.UseWorkStealing can be toggled at runtime
+		if (FTaskGraphInterface::IsMultithread())
+		{
+			LocalTaskDeques.Reserve(NumThreads - NumNamedThreads);
+			for (int32 ThreadIndex = NumNamedThreads; ThreadIndex < NumThreads; ThreadIndex++)
+			{
+				LocalTaskDeques.Add(MakeUnique<FWorkStealingDeque>());
+			}
+		}
+
 		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
 		{
 			check(!WorkerThreads[ThreadIndex].bAttached); // reentrant?
@@ -1384,6 +1545,14 @@ public:
 				}
 				uint32 PriIndex = TaskPriority ? 0 : 1;
 				check(Priority >= 0 && Priority < MAX_THREAD_PRIORITIES);
+				if (PriIndex == 1 && GTaskGraphUseWorkStealing && LocalTaskDeques.Num() > 0)
+				{
+					Task = QueueTaskOnLocalDeque(Task, Priority);
+					if (!Task)
+					{
+						return;
+					}
+				}
 				{
 					TASKGRAPH_SCOPE_CYCLE_COUNTER(4, STAT_TaskGraph_QueueTask_IncomingAnyThreadTasks_Push);
 					int32 IndexToStart = IncomingAnyThreadTasks[Priority].Push(Task, PriIndex);
@@ -1527,6 +1696,7 @@ public:
 				}
 			}
 			// named thread process tasks while we wait
+			FTaskGraphWaitTraceScope WaitTraceScope(Tasks);
 			TGraphTask<FReturnGraphTask>::CreateTask(&Tasks, CurrentThread).ConstructAndDispatchWhenReady(CurrentThread);
 			ProcessThreadUntilRequestReturn(CurrentThread);
 		}
@@ -1551,6 +1721,7 @@ public:
 				UE_LOG(LogTaskGraph, Fatal, TEXT("Recursive waits are not allowed in single threaded mode."));
 			}
 			// We will just stall this thread on an event while we wait
+			FTaskGraphWaitTraceScope WaitTraceScope(Tasks);
 			FScopedEvent Event;
 			TriggerEventWhenTasksComplete(Event.Get(), Tasks, CurrentThreadIfKnown);
 		}
@@ -1629,7 +1800,91 @@ public:
 			MyIndex < (PLATFORM_64BITS ? 63 : 32) &&
 			Priority >= 0 && Priority < ENamedThreads::NumThreadPriorities);
 
-		return IncomingAnyThreadTasks[Priority].Pop(MyIndex, true);
+		if (LocalTaskDeques.Num() == 0)
+		{
+			return IncomingAnyThreadTasks[Priority].Pop(MyIndex, true);
+		}
+
+		// The shared queue goes first, so high task priority tasks and tasks from named threads keep their ordering
+		const int32 SpinCount = GTaskGraphUseWorkStealing ? GTaskGraphWorkStealingSpinCount : 0;
+		for (int32 SpinIndex = 0; ; SpinIndex++)
+		{
+			if (FBaseGraphTask* Task = IncomingAnyThreadTasks[Priority].Pop(MyIndex, false))
+			{
+				return Task;
+			}
+			if (FBaseGraphTask* Task = LocalTaskDeques[Priority * NumTaskThreadsPerSet + MyIndex]->Pop())
+			{
+				return Task;
+			}
+			if (FBaseGraphTask* Task = StealWork(Priority, MyIndex))
+			{
+				return Task;
+			}
+			if (SpinIndex >= SpinCount)
+			{
+				break;
+			}
+			FPlatformProcess::YieldThread();
+		}
+
+		if (FBaseGraphTask* Task = IncomingAnyThreadTasks[Priority].Pop(MyIndex, true))
+		{
+			return Task;
+		}
+
+		// We are marked as stalled now. A worker may have pushed to its deque before it could see that, so look once more, see QueueTaskOnLocalDeque.
+		if (FBaseGraphTask* Task = StealWork(Priority, MyIndex))
+		{
+			IncomingAnyThreadTasks[Priority].Unstall(MyIndex);
+			return Task;
+		}
+		return nullptr;
+	}
+
+	/**
+	 *	Queues a task spawned from a worker thread of the given priority set on that worker's own deque.
+	 *	@return the task if it still needs to be queued on the shared queue, nullptr if it was queued locally.
+	**/
+	FBaseGraphTask* QueueTaskOnLocalDeque(FBaseGraphTask* Task, int32 Priority)
+	{
+		const int32 CurrentThreadIndex = ENamedThreads::GetThreadIndex(GetCurrentThread());
+		if (CurrentThreadIndex < NumNamedThreads || ThreadIndexToPriorityIndex(CurrentThreadIndex) != Priority)
+		{
+			return Task;
+		}
+
+		// Only queue locally if nobody is stalled, stalled workers need the shared queue to be woken up
+		FStallingTaskQueue<FBaseGraphTask, PLATFORM_CACHE_LINE_SIZE, 2>& SharedQueue = IncomingAnyThreadTasks[Priority];
+		FWorkStealingDeque& LocalDeque = *LocalTaskDeques[CurrentThreadIndex - NumNamedThreads];
+		if (SharedQueue.HasStalledThreads() || !LocalDeque.Push(Task))
+		{
+			return Task;
+		}
+
+		// Pairs with the stalling Pop in FindWork: either we see the worker that stalled meanwhile here,
+		// or it sees our task when it looks for work to steal after stalling.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (SharedQueue.HasStalledThreads())
+		{
+			// hand a task over to the shared queue so the stalled worker gets woken up
+			return LocalDeque.Pop();
+		}
+		return nullptr;
+	}
+
+	/** Steals a task from the deques of the other workers of the same priority set, starting with the next worker index. */
+	FBaseGraphTask* StealWork(int32 Priority, int32 MyIndex)
+	{
+		for (int32 Offset = 1; Offset < NumTaskThreadsPerSet; Offset++)
+		{
+			const int32 VictimIndex = (MyIndex + Offset) % NumTaskThreadsPerSet;
+			if (FBaseGraphTask* Task = LocalTaskDeques[Priority * NumTaskThreadsPerSet + VictimIndex]->Steal())
+			{
+				return Task;
+			}
+		}
+		return nullptr;
 	}
 
 	void StallForTuning(int32 Index, bool Stall)
@@ -1737,6 +1992,9 @@ private:
 	TArray<TFunction<void()> > ShutdownCallbacks;
 
 	FStallingTaskQueue<FBaseGraphTask, PLATFORM_CACHE_LINE_SIZE, 2>	IncomingAnyThreadTasks[MAX_THREAD_PRIORITIES];
+
+	/** Per worker thread deques used when TaskGraph.UseWorkStealing is enabled, indexed by the thread index minus NumNamedThreads. **/
+	TArray<TUniquePtr<FWorkStealingDeque>> LocalTaskDeques;
 };
 
 
@@ -1794,6 +2052,41 @@ void FBaseGraphTask::LogPossiblyInvalidSubsequentsTask(const TCHAR* TaskName)
 }
 #endif
 
+#if TASKGRAPHTRACE_ENABLED
+void FBaseGraphTask::TraceCreated(FGraphEvent* CompletionEvent, const FGraphEventArray* Prerequisites)
+{
+	TraceId = FTaskGraphTrace::NewTaskId();
+
+	// A gather task created for DontCompleteUntil takes over the completion event of the task which used it, the
+	// event keeps the id of that task so waits on it still point to it.
+	uint64 CompletesTaskId = 0;
+	if (CompletionEvent)
+	{
+		if (CompletionEvent->TraceId)
+		{
+			CompletesTaskId = CompletionEvent->TraceId;
+		}
+		else
+		{
+			CompletionEvent->TraceId = TraceId;
+		}
+	}
+
+	FTaskGraphTrace::Created(TraceId, CompletesTaskId, uint32(ThreadToExecuteOn));
+
+	if (Prerequisites)
+	{
+		for (FGraphEvent* Prerequisite : *Prerequisites)
+		{
+			if (Prerequisite && Prerequisite->TraceId)
+			{
+				FTaskGraphTrace::Prerequisite(TraceId, Prerequisite->TraceId);
+			}
+		}
+	}
+}
+#endif
+
 static TLockFreeClassAllocator_TLSCache<FGraphEvent, PLATFORM_CACHE_LINE_SIZE> TheGraphEventAllocator;
 
 FGraphEventRef FGraphEvent::CreateGraphEvent()
@@ -1852,6 +2145,13 @@ void FGraphEvent::DispatchSubsequents(TArray<FBaseGraphTask*>& NewTasks, ENamedT
 		}
 	}
 
+#if TASKGRAPHTRACE_ENABLED
+	if (TraceId)
+	{
+		FTaskGraphTrace::Completed(TraceId);
+	}
+#endif
+
 	SubsequentList.PopAllAndClose(NewTasks);
 	for (int32 Index = NewTasks.Num() - 1; Index >= 0 ; Index--) // reverse the order since PopAll is implicitly backwards
 	{
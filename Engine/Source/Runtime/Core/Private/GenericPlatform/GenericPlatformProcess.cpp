@@ -19,6 +19,7 @@
 #include "Misc/LazySingleton.h"
 #include "Misc/Fork.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/LockTrace.h"
 #include "Async/TaskGraphInterfaces.h"
 
 #ifndef DEFAULT_NO_THREADING
@@ -398,6 +399,11 @@ bool FPThreadEvent::Wait(uint32 WaitTime, const bool bIgnoreThreadIdleStats /*=
 		gettimeofday(&StartTime, NULL);
 	}
 
+#if LOCKTRACE_ENABLED
+	const uint64 WaitStartCycles = FLockTrace::GetWaitStartCycles();
+	bool bBlocked = false;
+#endif
+
 	LockEventMutex();
 
 	bool bRetVal = false;
@@ -424,6 +430,9 @@ bool FPThreadEvent::Wait(uint32 WaitTime, const bool bIgnoreThreadIdleStats /*=
 		else if (WaitTime != 0)  // not just polling, wait on the condition variable.
 		{
 			WaitingThreads++;
+#if LOCKTRACE_ENABLED
+			bBlocked = true;
+#endif
 			if (WaitTime == ((uint32)-1)) // infinite wait?
 			{
 				int rc = pthread_cond_wait(&Condition, &Mutex);  // unlocks Mutex while blocking...
@@ -453,6 +462,13 @@ bool FPThreadEvent::Wait(uint32 WaitTime, const bool bIgnoreThreadIdleStats /*=
 	} while ((!bRetVal) && (WaitTime != 0));
 
 	UnlockEventMutex();
+
+#if LOCKTRACE_ENABLED
+	if (bBlocked)
+	{
+		FLockTrace::EventWait(this, WaitStartCycles, bRetVal);
+	}
+#endif
 	return bRetVal;
 }
 
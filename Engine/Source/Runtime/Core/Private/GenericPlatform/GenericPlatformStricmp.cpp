@@ -2,6 +2,16 @@
 
 #include "GenericPlatform/GenericPlatformStricmp.h"
 #include "Misc/Char.h"
+#include "Templates/AreTypesEqual.h"
+#include "Templates/ChooseClass.h"
+
+// The vectorized prefix skip reads past terminators within a page, which is safe but trips the address sanitizer
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY && !USING_ADDRESS_SANITISER
+	#define UE_STRICMP_USE_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define UE_STRICMP_USE_SSE2 0
+#endif
 
 static constexpr uint8 LowerAscii[128] = {
 	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
@@ -20,9 +30,96 @@ FORCEINLINE bool BothAscii(CharType1 C1, CharType2 C2)
 	return (((uint32)C1 | (uint32)C2) & 0xffffff80) == 0;
 }
 
+#if UE_STRICMP_USE_SSE2
+
+/** Smallest page size of any x86 target, used to keep block loads from crossing into a page which may not be mapped. */
+static constexpr UPTRINT StricmpPageSize = 4096;
+
+FORCEINLINE bool CanLoadBlock(const void* Ptr)
+{
+	return ((UPTRINT)Ptr & (StricmpPageSize - 1)) <= StricmpPageSize - sizeof(__m128i);
+}
+
+FORCEINLINE __m128i LowerAsciiBlock(__m128i Block, uint8)
+{
+	const __m128i IsUpper = _mm_and_si128(_mm_cmpgt_epi8(Block, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), Block));
+	return _mm_add_epi8(Block, _mm_and_si128(IsUpper, _mm_set1_epi8('a' - 'A')));
+}
+
+FORCEINLINE __m128i LowerAsciiBlock(__m128i Block, uint16)
+{
+	const __m128i IsUpper = _mm_and_si128(_mm_cmpgt_epi16(Block, _mm_set1_epi16('A' - 1)), _mm_cmpgt_epi16(_mm_set1_epi16('Z' + 1), Block));
+	return _mm_add_epi16(Block, _mm_and_si128(IsUpper, _mm_set1_epi16('a' - 'A')));
+}
+
+FORCEINLINE __m128i FindNullInBlock(__m128i Block, uint8)
+{
+	return _mm_cmpeq_epi8(Block, _mm_setzero_si128());
+}
+
+FORCEINLINE __m128i FindNullInBlock(__m128i Block, uint16)
+{
+	return _mm_cmpeq_epi16(Block, _mm_setzero_si128());
+}
+
+/**
+ * Skips the leading 16 byte blocks of two strings which are equal ignoring ASCII case and don't contain a terminator.
+ * Only A-Z are folded, so a block compares equal exactly when the scalar loop would find no difference in it.
+ * Blocks are only loaded when neither load crosses a page boundary, so reading past a terminator never faults.
+ *
+ * @return The number of characters skipped, after which the scalar loop finishes the comparison within the next block.
+ */
+template<typename CharType>
+FORCEINLINE SIZE_T SkipEqualBlocks(const CharType* String1, const CharType* String2, SIZE_T MaxCount)
+{
+	typedef typename TChooseClass<sizeof(CharType) == 1, uint8, uint16>::Result LaneType;
+	constexpr SIZE_T CharsPerBlock = sizeof(__m128i) / sizeof(CharType);
+
+	SIZE_T Skipped = 0;
+	while (MaxCount - Skipped >= CharsPerBlock && CanLoadBlock(String1 + Skipped) && CanLoadBlock(String2 + Skipped))
+	{
+		const __m128i Block1 = _mm_loadu_si128((const __m128i*)(String1 + Skipped));
+		const __m128i Block2 = _mm_loadu_si128((const __m128i*)(String2 + Skipped));
+
+		// A terminator in String1 which matches String2 means both end in this block
+		const __m128i Equal = _mm_cmpeq_epi8(LowerAsciiBlock(Block1, LaneType()), LowerAsciiBlock(Block2, LaneType()));
+		const __m128i Ended = FindNullInBlock(Block1, LaneType());
+		if (_mm_movemask_epi8(_mm_andnot_si128(Ended, Equal)) != 0xFFFF)
+		{
+			break;
+		}
+
+		Skipped += CharsPerBlock;
+	}
+
+	return Skipped;
+}
+
+#endif
+
+/** Skips a prefix which is known to compare equal, for the string pairs which have a vectorized path. */
+template<typename CharType1, typename CharType2>
+FORCEINLINE SIZE_T SkipEqualPrefix(const CharType1* String1, const CharType2* String2, SIZE_T MaxCount)
+{
+#if UE_STRICMP_USE_SSE2
+	if constexpr (TAreTypesEqual<CharType1, CharType2>::Value && (sizeof(CharType1) == 1 || sizeof(CharType1) == 2))
+	{
+		return SkipEqualBlocks(String1, String2, MaxCount);
+	}
+	else
+#endif
+	{
+		return 0;
+	}
+}
+
 template<typename CharType1, typename CharType2>
 int32 StricmpImpl(const CharType1* String1, const CharType2* String2)
 {
+	const SIZE_T Skipped = SkipEqualPrefix(String1, String2, ~SIZE_T(0));
+	String1 += Skipped;
+	String2 += Skipped;
+
 	while (true)
 	{
 		CharType1 C1 = *String1++;
@@ -56,6 +153,11 @@ int32 StricmpImpl(const CharType1* String1, const CharType2* String2)
 template<typename CharType1, typename CharType2>
 int32 StrnicmpImpl(const CharType1* String1, const CharType2* String2, SIZE_T Count)
 {
+	const SIZE_T Skipped = SkipEqualPrefix(String1, String2, Count);
+	String1 += Skipped;
+	String2 += Skipped;
+	Count -= Skipped;
+
 	for (; Count > 0; --Count)
 	{
 		CharType1 C1 = *String1++;
@@ -110,6 +212,8 @@ int32 FGenericPlatformStricmp::Strnicmp(const WIDECHAR* Str1, const ANSICHAR* St
 
 #if WITH_DEV_AUTOMATION_TESTS 
 
+#include "Containers/Array.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/AutomationTest.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGenericPlatformStricmpTest, "System.Core.GenericPlatform.Stricmp", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
@@ -169,6 +273,34 @@ void RunStricmpTests(FAutomationTestBase& Test)
 	TestStricmp(HelloLower, HelloMixed1, Test);
 	TestStricmp(HelloLower, HelloMixed2, Test);
 	TestStricmp(HelloLower, Hell0, Test);
+
+	// Test strings long enough to take the vectorized path, differing or ending at every position
+	const int32 LongLen = 40;
+	CharType LongLower[LongLen + 1];
+	CharType LongUpper[LongLen + 1];
+	for (int32 Index = 0; Index < LongLen; ++Index)
+	{
+		LongLower[Index] = (CharType)('a' + Index % 26);
+		LongUpper[Index] = (CharType)('A' + Index % 26);
+	}
+	LongLower[LongLen] = LongUpper[LongLen] = '\0';
+
+	TestStricmp(LongLower, LongUpper, Test);
+	for (int32 Index = 0; Index < LongLen; ++Index)
+	{
+		const CharType Original = LongUpper[Index];
+
+		LongUpper[Index] = '0';
+		TestStricmp(LongLower, LongUpper, Test);
+		TestStricmp(LongUpper, LongLower, Test);
+		Test.TestEqual("Strnicmp() before the difference", StrnicmpImpl(LongLower, LongUpper, Index), 0);
+
+		LongUpper[Index] = '\0';
+		TestStricmp(LongLower, LongUpper, Test);
+		Test.TestEqual("Strnicmp() past the end", StrnicmpImpl(LongUpper, LongUpper, LongLen), 0);
+
+		LongUpper[Index] = Original;
+	}
 }
 
 bool FGenericPlatformStricmpTest::RunTest(const FString& Parameters)
@@ -179,4 +311,50 @@ bool FGenericPlatformStricmpTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGenericPlatformStricmpPerfTest, "System.Core.GenericPlatform.StricmpPerf", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+template<typename CharType>
+void RunStricmpBenchmark(FAutomationTestBase& Test, const TCHAR* TypeName)
+{
+	const int32 NumIterations = 1000000;
+
+	for (int32 Len : { 8, 24, 64, 200 })
+	{
+		TArray<CharType> Lower;
+		TArray<CharType> Upper;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			Lower.Add((CharType)('a' + Index % 26));
+			Upper.Add((CharType)('A' + Index % 26));
+		}
+		Lower.Add('\0');
+		Upper.Add('\0');
+
+		// The sum is an observable result which keeps the loops from being optimized away
+		int32 Sum = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Sum += StricmpImpl(Lower.GetData(), Upper.GetData());
+		}
+		const double MidTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Sum += StricmpExpected(Lower.GetData(), Upper.GetData());
+		}
+		const double EndTime = FPlatformTime::Seconds();
+
+		Test.AddInfo(FString::Printf(TEXT("%s length %d: Stricmp %.2fms, reference %.2fms (%d)"), TypeName, Len, (MidTime - StartTime) * 1000.0, (EndTime - MidTime) * 1000.0, Sum));
+	}
+}
+
+bool FGenericPlatformStricmpPerfTest::RunTest(const FString& Parameters)
+{
+	RunStricmpBenchmark<ANSICHAR>(*this, TEXT("ANSICHAR"));
+	RunStricmpBenchmark<WIDECHAR>(*this, TEXT("WIDECHAR"));
+
+	return true;
+}
+
 #endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -13,10 +13,20 @@
 #include "Misc/CoreDelegates.h"
 #include "HAL/MallocTimer.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CountersTrace.h"
 #if CSV_PROFILER
 CSV_DEFINE_CATEGORY_MODULE(CORE_API, FMemory, true);
 #endif
 
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+TRACE_DECLARE_INT_COUNTER(MallocBinned2CacheHits, TEXT("MallocBinned2/CacheHits"));
+TRACE_DECLARE_INT_COUNTER(MallocBinned2CacheMisses, TEXT("MallocBinned2/CacheMisses"));
+TRACE_DECLARE_INT_COUNTER(MallocBinned2PoolAllocs, TEXT("MallocBinned2/PoolAllocs"));
+TRACE_DECLARE_INT_COUNTER(MallocBinned2PoolFrees, TEXT("MallocBinned2/PoolFrees"));
+TRACE_DECLARE_INT_COUNTER(MallocBinned2OSPageAllocs, TEXT("MallocBinned2/OSPageAllocs"));
+TRACE_DECLARE_INT_COUNTER(MallocBinned2OSPageFrees, TEXT("MallocBinned2/OSPageFrees"));
+#endif
+
 PRAGMA_DISABLE_UNSAFE_TYPECAST_WARNINGS
 
 #if BINNED2_ALLOW_RUNTIME_TWEAKING
@@ -58,6 +68,36 @@ static FAutoConsoleVariableRef GMallocBinned2AllocExtraCVar(
 
 #endif
 
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+static int32 GMallocBinned2PerBinCsvStats = 0;
+static FAutoConsoleVariableRef GMallocBinned2PerBinCsvStatsCVar(
+	TEXT("MallocBinned2.PerBinCsvStats"),
+	GMallocBinned2PerBinCsvStats,
+	TEXT("If > 0, UpdateStats records per-frame cache hits/misses and pool allocs/frees for every small block size into the FMemory CSV category, not just the totals.")
+	);
+#endif
+
+static float GMallocBinned2AdaptiveTrimInterval = 0.0f;
+static FAutoConsoleVariableRef GMallocBinned2AdaptiveTrimIntervalCVar(
+	TEXT("MallocBinned2.AdaptiveTrimInterval"),
+	GMallocBinned2AdaptiveTrimInterval,
+	TEXT("If > 0, the minimum time in seconds between periodic trims done from UpdateStats. The interval doubles (up to 8x) while trims find nothing to release, and resets when one does. 0 disables periodic trimming.")
+	);
+
+static int32 GMallocBinned2AdaptiveTrimThresholdMB = 64;
+static FAutoConsoleVariableRef GMallocBinned2AdaptiveTrimThresholdMBCVar(
+	TEXT("MallocBinned2.AdaptiveTrimThresholdMB"),
+	GMallocBinned2AdaptiveTrimThresholdMB,
+	TEXT("Periodic trims only release the cached free OS pages when there are at least this many MB of them.")
+	);
+
+static int32 GMallocBinned2AdaptiveTrimThreadCaches = 0;
+static FAutoConsoleVariableRef GMallocBinned2AdaptiveTrimThreadCachesCVar(
+	TEXT("MallocBinned2.AdaptiveTrimThreadCaches"),
+	GMallocBinned2AdaptiveTrimThreadCaches,
+	TEXT("If > 0, periodic trims also flush the per-thread caches before releasing the cached OS pages. This broadcasts to the named threads, so it has a cost.")
+	);
+
 float GMallocBinned2FlushThreadCacheMaxWaitTime = 0.02f;
 static FAutoConsoleVariableRef GMallocBinned2FlushThreadCacheMaxWaitTimeCVar(
 	TEXT("MallocBinned2.FlushThreadCacheMaxWaitTime"),
@@ -78,6 +118,12 @@ int64 Binned2HashMemory = 0;
 int64 Binned2TLSMemory = 0;
 #endif
 
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+// the following are covered by the critical section called Mutex
+static uint64 Binned2NumLargeOSAllocs = 0;
+static uint64 Binned2NumLargeOSFrees = 0;
+#endif
+
 #if BINNED2_ALLOCATOR_STATS_VALIDATION
 int64 AllocatedSmallPoolMemoryValidation = 0;
 FCriticalSection ValidationCriticalSection;
@@ -113,6 +159,12 @@ FMallocBinned2::FPoolList::FPoolList()
 
 FMallocBinned2::FPoolTable::FPoolTable()
 	: BlockSize(0)
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	, NumPoolAllocs(0)
+	, NumPoolFrees(0)
+	, NumOSPageAllocs(0)
+	, NumOSPageFrees(0)
+#endif
 {
 }
 
@@ -521,6 +573,10 @@ struct FMallocBinned2::Private
 					check(NodePool->FirstFreeBlock->Canary == 0 || NodePool->FirstFreeBlock->IsCanaryOk());
 				}
 
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+				Table.NumPoolFrees++;
+#endif
+
 				// Free a pooled allocation.
 				FFreeBlock* Free = (FFreeBlock*)Node;
 				Free->NumFreeBlocks = 1;
@@ -542,6 +598,9 @@ struct FMallocBinned2::Private
 					Allocator.CachedOSPageAllocator.Free(BasePtrOfNode, Allocator.PageSize);
 #if BINNED2_ALLOCATOR_STATS
 					AllocatedOSSmallPoolMemory -= ((int64)Allocator.PageSize);
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+					Table.NumOSPageFrees++;
 #endif
 				}
 
@@ -586,8 +645,139 @@ struct FMallocBinned2::Private
 #endif
 #if BINNED2_ALLOCATOR_STATS
 		FMallocBinned2::FPerThreadFreeBlockLists::ConsolidatedMemory += FreeBlockLists->AllocatedMemory;
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; ++PoolIndex)
+		{
+			FCacheStats& Consolidated = FMallocBinned2::FPerThreadFreeBlockLists::ConsolidatedCacheStats[PoolIndex];
+			const FCacheStats& ThreadStats = FreeBlockLists->CacheStats[PoolIndex];
+			Consolidated.Hits   += ThreadStats.Hits;
+			Consolidated.Misses += ThreadStats.Misses;
+			Consolidated.Frees  += ThreadStats.Frees;
+		}
 #endif
 	}
+
+	static void TickAdaptiveTrim(FMallocBinned2& Allocator)
+	{
+		static double LastTrimTime = 0.0;
+		static float IntervalScale = 1.0f;
+
+		if (GMallocBinned2AdaptiveTrimInterval <= 0.0f)
+		{
+			return;
+		}
+
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (CurrentTime - LastTrimTime < GMallocBinned2AdaptiveTrimInterval * IntervalScale)
+		{
+			return;
+		}
+		LastTrimTime = CurrentTime;
+
+		const uint64 ThresholdBytes = (uint64)FMath::Max(GMallocBinned2AdaptiveTrimThresholdMB, 0) * 1024 * 1024;
+		if (Allocator.CachedOSPageAllocator.GetCachedFreeTotal() < ThresholdBytes)
+		{
+			// nothing worth releasing, back off
+			IntervalScale = FMath::Min(IntervalScale * 2.0f, 8.0f);
+			return;
+		}
+
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_FMallocBinned2_AdaptiveTrim);
+
+		if (GMallocBinned2AdaptiveTrimThreadCaches)
+		{
+			// flushing the thread caches can return whole pages to the page cache, which Trim then releases along with the rest
+			Allocator.Trim(true);
+		}
+		else
+		{
+			FScopeLock Lock(&Allocator.Mutex);
+			Allocator.CachedOSPageAllocator.FreeAll(&Allocator.Mutex);
+		}
+
+		IntervalScale = 1.0f;
+	}
+
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	static void PublishBinStats(FMallocBinned2& Allocator)
+	{
+		static FBinStats LastBinStats[BINNED2_SMALL_POOL_COUNT] = {};
+
+		FBinStats BinStats[BINNED2_SMALL_POOL_COUNT];
+		Allocator.GetBinStats(BinStats);
+
+		FBinStats FrameTotals = {};
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; ++PoolIndex)
+		{
+			const FBinStats& Current = BinStats[PoolIndex];
+			const FBinStats& Last = LastBinStats[PoolIndex];
+
+			FrameTotals.CacheHits    += Current.CacheHits - Last.CacheHits;
+			FrameTotals.CacheMisses  += Current.CacheMisses - Last.CacheMisses;
+			FrameTotals.PoolAllocs   += Current.PoolAllocs - Last.PoolAllocs;
+			FrameTotals.PoolFrees    += Current.PoolFrees - Last.PoolFrees;
+			FrameTotals.OSPageAllocs += Current.OSPageAllocs - Last.OSPageAllocs;
+			FrameTotals.OSPageFrees  += Current.OSPageFrees - Last.OSPageFrees;
+
+#if CSV_PROFILER
+			if (GMallocBinned2PerBinCsvStats)
+			{
+				struct FBinStatNames
+				{
+					FName CacheHits;
+					FName CacheMisses;
+					FName PoolAllocs;
+					FName PoolFrees;
+				};
+				static FBinStatNames StatNames[BINNED2_SMALL_POOL_COUNT];
+				if (StatNames[PoolIndex].CacheHits.IsNone())
+				{
+					StatNames[PoolIndex].CacheHits   = FName(*FString::Printf(TEXT("Binned2_%u_CacheHits"), Current.BlockSize));
+					StatNames[PoolIndex].CacheMisses = FName(*FString::Printf(TEXT("Binned2_%u_CacheMisses"), Current.BlockSize));
+					StatNames[PoolIndex].PoolAllocs  = FName(*FString::Printf(TEXT("Binned2_%u_PoolAllocs"), Current.BlockSize));
+					StatNames[PoolIndex].PoolFrees   = FName(*FString::Printf(TEXT("Binned2_%u_PoolFrees"), Current.BlockSize));
+				}
+
+				FCsvProfiler::RecordCustomStat(StatNames[PoolIndex].CacheHits, CSV_CATEGORY_INDEX(FMemory), (int32)(Current.CacheHits - Last.CacheHits), ECsvCustomStatOp::Set);
+				FCsvProfiler::RecordCustomStat(StatNames[PoolIndex].CacheMisses, CSV_CATEGORY_INDEX(FMemory), (int32)(Current.CacheMisses - Last.CacheMisses), ECsvCustomStatOp::Set);
+				FCsvProfiler::RecordCustomStat(StatNames[PoolIndex].PoolAllocs, CSV_CATEGORY_INDEX(FMemory), (int32)(Current.PoolAllocs - Last.PoolAllocs), ECsvCustomStatOp::Set);
+				FCsvProfiler::RecordCustomStat(StatNames[PoolIndex].PoolFrees, CSV_CATEGORY_INDEX(FMemory), (int32)(Current.PoolFrees - Last.PoolFrees), ECsvCustomStatOp::Set);
+			}
+#endif
+
+			LastBinStats[PoolIndex] = Current;
+		}
+
+		static uint64 LastLargeOSAllocs = 0;
+		static uint64 LastLargeOSFrees = 0;
+		uint64 LargeOSAllocs;
+		uint64 LargeOSFrees;
+		{
+			FScopeLock Lock(&Allocator.Mutex);
+			LargeOSAllocs = Binned2NumLargeOSAllocs;
+			LargeOSFrees = Binned2NumLargeOSFrees;
+		}
+		FrameTotals.OSPageAllocs += LargeOSAllocs - LastLargeOSAllocs;
+		FrameTotals.OSPageFrees  += LargeOSFrees - LastLargeOSFrees;
+		LastLargeOSAllocs = LargeOSAllocs;
+		LastLargeOSFrees = LargeOSFrees;
+
+		CSV_CUSTOM_STAT(FMemory, Binned2CacheHits, (int32)FrameTotals.CacheHits, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FMemory, Binned2CacheMisses, (int32)FrameTotals.CacheMisses, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FMemory, Binned2PoolAllocs, (int32)FrameTotals.PoolAllocs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FMemory, Binned2PoolFrees, (int32)FrameTotals.PoolFrees, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FMemory, Binned2OSAllocs, (int32)FrameTotals.OSPageAllocs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FMemory, Binned2OSFrees, (int32)FrameTotals.OSPageFrees, ECsvCustomStatOp::Set);
+
+		TRACE_COUNTER_SET(MallocBinned2CacheHits, FrameTotals.CacheHits);
+		TRACE_COUNTER_SET(MallocBinned2CacheMisses, FrameTotals.CacheMisses);
+		TRACE_COUNTER_SET(MallocBinned2PoolAllocs, FrameTotals.PoolAllocs);
+		TRACE_COUNTER_SET(MallocBinned2PoolFrees, FrameTotals.PoolFrees);
+		TRACE_COUNTER_SET(MallocBinned2OSPageAllocs, FrameTotals.OSPageAllocs);
+		TRACE_COUNTER_SET(MallocBinned2OSPageFrees, FrameTotals.OSPageFrees);
+	}
+#endif
 };
 
 FMallocBinned2::Private::FGlobalRecycler FMallocBinned2::Private::GGlobalRecycler;
@@ -595,6 +785,9 @@ FMallocBinned2::Private::FGlobalRecycler FMallocBinned2::Private::GGlobalRecycle
 #if BINNED2_ALLOCATOR_STATS
 int64 FMallocBinned2::FPerThreadFreeBlockLists::ConsolidatedMemory = 0;
 #endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+FMallocBinned2::FCacheStats FMallocBinned2::FPerThreadFreeBlockLists::ConsolidatedCacheStats[BINNED2_SMALL_POOL_COUNT] = {};
+#endif
 
 FORCEINLINE bool FMallocBinned2::FPoolList::IsEmpty() const
 {
@@ -632,6 +825,9 @@ FMallocBinned2::FPoolInfo& FMallocBinned2::FPoolList::PushNewPoolToFront(FMalloc
 	FFreeBlock* Free = new (FreePtr) FFreeBlock(LocalPageSize, InBlockSize, InPoolIndex);
 #if BINNED2_ALLOCATOR_STATS
 	AllocatedOSSmallPoolMemory += (int64)LocalPageSize;
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	Allocator.SmallPoolTables[InPoolIndex].NumOSPageAllocs++;
 #endif
 	check(IsAligned(Free, LocalPageSize));
 	// Create pool
@@ -753,10 +949,16 @@ void* FMallocBinned2::MallocExternalSmall(SIZE_T Size, uint32 Alignment)
 #if BINNED2_ALLOCATOR_STATS
 				uint32 BlockSize = PoolIndexToBlockSize(PoolIndex);
 				Lists->AllocatedMemory += BlockSize;
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+				Lists->CacheStats[PoolIndex].Hits++;
 #endif
 				return Result;
 			}
 		}
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+		Lists->CacheStats[PoolIndex].Misses++;
+#endif
 	}
 
 	FScopeLock Lock(&Mutex);
@@ -778,6 +980,9 @@ void* FMallocBinned2::MallocExternalSmall(SIZE_T Size, uint32 Alignment)
 #if BINNED2_ALLOCATOR_STATS
 	AllocatedSmallPoolMemory += PoolIndexToBlockSize(PoolIndex);
 #endif // BINNED2_ALLOCATOR_STATS
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	Table.NumPoolAllocs++;
+#endif
 	if (GMallocBinned2AllocExtra)
 	{
 		if (Lists)
@@ -790,6 +995,9 @@ void* FMallocBinned2::MallocExternalSmall(SIZE_T Size, uint32 Alignment)
 					break;
 				}
 				Result = Pool->AllocateRegularBlock();
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+				Table.NumPoolAllocs++;
+#endif
 			}
 		}
 	}
@@ -827,6 +1035,9 @@ void* FMallocBinned2::MallocExternalLarge(SIZE_T Size, uint32 Alignment)
 		}
 
 		Pool = Private::GetOrCreatePoolInfo(*this, Result, FPoolInfo::ECanary::FirstFreeBlockIsOSAllocSize, false);
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+		Binned2NumLargeOSAllocs++;
+#endif
 	}
 
 	UE_CLOG(!IsAligned(Result, Alignment) ,LogMemory, Fatal, TEXT("FMallocBinned2 alignment was too large for OS. Alignment=%d   Ptr=%p"), Alignment, Result);
@@ -952,6 +1163,9 @@ void FMallocBinned2::FreeExternal(void* Ptr)
 			check(bPushed);
 #if BINNED2_ALLOCATOR_STATS
 			Lists->AllocatedMemory -= BlockSize;
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+			Lists->CacheStats[PoolIndex].Frees++;
 #endif
 		}
 		else
@@ -993,6 +1207,9 @@ void FMallocBinned2::FreeExternal(void* Ptr)
 		Pool->SetCanary(FPoolInfo::ECanary::Unassigned, true, false);
 		// Free an OS allocation.
 		CachedOSPageAllocator.Free(Ptr, PoolOsBytes, &Mutex);
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+		Binned2NumLargeOSFrees++;
+#endif
 	}
 }
 
@@ -1325,7 +1542,65 @@ void FMallocBinned2::DumpAllocatorStats(class FOutputDevice& Ar)
 #else
 	Ar.Logf(TEXT("Allocator Stats for binned2 are not in this build set BINNED2_ALLOCATOR_STATS 1 in MallocBinned2.cpp"));
 #endif
+
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	FBinStats BinStats[BINNED2_SMALL_POOL_COUNT];
+	GetBinStats(BinStats);
+
+	Ar.Logf(TEXT("Per bin stats (since startup):"));
+	Ar.Logf(TEXT("%9s %12s %12s %7s %12s %12s %10s %10s"), TEXT("BlockSize"), TEXT("CacheHits"), TEXT("CacheMisses"), TEXT("Hit%"), TEXT("PoolAllocs"), TEXT("PoolFrees"), TEXT("PageAllocs"), TEXT("PageFrees"));
+	for (const FBinStats& Bin : BinStats)
+	{
+		const uint64 NumCacheAllocs = Bin.CacheHits + Bin.CacheMisses;
+		const double HitPercent = NumCacheAllocs ? 100.0 * (double)Bin.CacheHits / (double)NumCacheAllocs : 0.0;
+		Ar.Logf(TEXT("%9u %12llu %12llu %6.2f%% %12llu %12llu %10llu %10llu"), Bin.BlockSize, Bin.CacheHits, Bin.CacheMisses, HitPercent, Bin.PoolAllocs, Bin.PoolFrees, Bin.OSPageAllocs, Bin.OSPageFrees);
+	}
+#endif
 }
+
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+void FMallocBinned2::GetBinStats(FBinStats (&OutBinStats)[BINNED2_SMALL_POOL_COUNT])
+{
+	for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; ++PoolIndex)
+	{
+		FBinStats& Bin = OutBinStats[PoolIndex];
+		FMemory::Memzero(Bin);
+		Bin.BlockSize = PoolIndexToBlockSize(PoolIndex);
+	}
+
+	{
+		// the thread counters are read without synchronization, like AllocatedMemory in GetTotalAllocatedSmallPoolMemory; they're only used for reporting
+		FScopeLock Lock(&Private::GetFreeBlockListsRegistrationMutex());
+		for (const FPerThreadFreeBlockLists* FreeBlockLists : Private::GetRegisteredFreeBlockLists())
+		{
+			for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; ++PoolIndex)
+			{
+				OutBinStats[PoolIndex].CacheHits   += FreeBlockLists->CacheStats[PoolIndex].Hits;
+				OutBinStats[PoolIndex].CacheMisses += FreeBlockLists->CacheStats[PoolIndex].Misses;
+				OutBinStats[PoolIndex].CacheFrees  += FreeBlockLists->CacheStats[PoolIndex].Frees;
+			}
+		}
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; ++PoolIndex)
+		{
+			OutBinStats[PoolIndex].CacheHits   += FPerThreadFreeBlockLists::ConsolidatedCacheStats[PoolIndex].Hits;
+			OutBinStats[PoolIndex].CacheMisses += FPerThreadFreeBlockLists::ConsolidatedCacheStats[PoolIndex].Misses;
+			OutBinStats[PoolIndex].CacheFrees  += FPerThreadFreeBlockLists::ConsolidatedCacheStats[PoolIndex].Frees;
+		}
+	}
+
+	{
+		FScopeLock Lock(&Mutex);
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; ++PoolIndex)
+		{
+			const FPoolTable& Table = SmallPoolTables[PoolIndex];
+			OutBinStats[PoolIndex].PoolAllocs   = Table.NumPoolAllocs;
+			OutBinStats[PoolIndex].PoolFrees    = Table.NumPoolFrees;
+			OutBinStats[PoolIndex].OSPageAllocs = Table.NumOSPageAllocs;
+			OutBinStats[PoolIndex].OSPageFrees  = Table.NumOSPageFrees;
+		}
+	}
+}
+#endif
 #if !BINNED2_INLINE
 	#if PLATFORM_USES_FIXED_GMalloc_CLASS && !FORCE_ANSI_ALLOCATOR && USE_MALLOC_BINNED2
 		//#define FMEMORY_INLINE_FUNCTION_DECORATOR  FORCEINLINE
@@ -1339,6 +1614,11 @@ void FMallocBinned2::UpdateStats()
 #if CSV_PROFILER
 	CSV_CUSTOM_STAT(FMemory, AllocatorCachedSlackMB, (int32)(CachedOSPageAllocator.GetCachedFreeTotal()/(1024*1024)), ECsvCustomStatOp::Set);
 #endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	Private::PublishBinStats(*this);
+#endif
+
+	Private::TickAdaptiveTrim(*this);
 
 	CachedOSPageAllocator.UpdateStats();
 	FScopedVirtualMallocTimer::UpdateStats();
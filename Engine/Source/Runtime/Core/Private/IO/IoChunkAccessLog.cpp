@@ -0,0 +1,172 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "IO/IoChunkAccessLog.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/Archive.h"
+
+int32 GIoDispatcherReadaheadChunkCount = 16;
+static FAutoConsoleVariableRef CVar_IoDispatcherReadaheadChunkCount(
+	TEXT("s.IoDispatcherReadaheadChunkCount"),
+	GIoDispatcherReadaheadChunkCount,
+	TEXT("Number of chunks read ahead from the -IoChunkReadahead log when a logged chunk is requested.")
+);
+
+static TAtomic<uint32> GIoChunkAccessLogPhase{ 0 };
+
+static FAutoConsoleCommand CVar_IoDispatcherMarkAccessLogPhase(
+	TEXT("IoDispatcher.MarkAccessLogPhase"),
+	TEXT("Starts a new load phase in the -IoChunkAccessLog chunk access log."),
+	FConsoleCommandDelegate::CreateStatic(&FIoChunkAccessLog::MarkPhase)
+);
+
+namespace UE4IoChunkAccessLog_Private
+{
+	static bool ParseChunkId(const FString& String, FIoChunkId& OutChunkId)
+	{
+		uint8 Data[FIoChunkId::GetSize()];
+		if (String.Len() != 2 * FIoChunkId::GetSize() || HexToBytes(String, Data) != FIoChunkId::GetSize())
+		{
+			return false;
+		}
+		OutChunkId.Set(Data, sizeof Data);
+		return true;
+	}
+}
+
+FIoChunkAccessLog::FIoChunkAccessLog()
+{
+}
+
+FIoChunkAccessLog::~FIoChunkAccessLog()
+{
+	FCoreDelegates::OnPreExit.RemoveAll(this);
+	FlushLog();
+	LogArchive.Reset();
+}
+
+void FIoChunkAccessLog::Initialize()
+{
+	FString LogFilePath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("IoChunkAccessLog="), LogFilePath))
+	{
+		LogArchive.Reset(IFileManager::Get().CreateFileWriter(*LogFilePath));
+		if (LogArchive)
+		{
+			LogArchive->SetIsTextFormat(true);
+			LogArchive->Logf(TEXT("; Chunk access log, <chunk id> <phase> <milliseconds since startup>"));
+			StartTime = FPlatformTime::Seconds();
+			FCoreDelegates::OnPostEngineInit.AddStatic(&FIoChunkAccessLog::MarkPhase);
+			FCoreDelegates::OnFEngineLoopInitComplete.AddStatic(&FIoChunkAccessLog::MarkPhase);
+			FCoreDelegates::OnPreExit.AddRaw(this, &FIoChunkAccessLog::FlushLog);
+			UE_LOG(LogIoDispatcher, Display, TEXT("Logging chunk accesses to '%s'"), *LogFilePath);
+		}
+		else
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Failed to create chunk access log '%s'"), *LogFilePath);
+		}
+	}
+
+	FString ReadaheadFilePath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("IoChunkReadahead="), ReadaheadFilePath))
+	{
+		if (LoadPredictedChunks(*ReadaheadFilePath))
+		{
+			UE_LOG(LogIoDispatcher, Display, TEXT("Reading ahead %d chunks from '%s'"), PredictedChunks.Num(), *ReadaheadFilePath);
+		}
+		else
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Failed to load chunk readahead log '%s'"), *ReadaheadFilePath);
+		}
+	}
+}
+
+bool FIoChunkAccessLog::LoadPredictedChunks(const TCHAR* FilePath)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, FilePath))
+	{
+		return false;
+	}
+
+	for (const FString& Line : Lines)
+	{
+		const TCHAR* LinePtr = *Line;
+		FString ChunkIdString;
+		if (Line.StartsWith(TEXT(";")) || !FParse::Token(LinePtr, ChunkIdString, false))
+		{
+			continue;
+		}
+		FIoChunkId ChunkId;
+		if (!UE4IoChunkAccessLog_Private::ParseChunkId(ChunkIdString, ChunkId))
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Invalid line '%s' in chunk readahead log '%s'"), *Line, FilePath);
+			continue;
+		}
+		if (!PredictedChunkIndices.Contains(ChunkId))
+		{
+			PredictedChunkIndices.Add(ChunkId, PredictedChunks.Add(ChunkId));
+		}
+	}
+	RequestedPredictedChunks.Init(false, PredictedChunks.Num());
+	return PredictedChunks.Num() > 0;
+}
+
+void FIoChunkAccessLog::OnChunkRequested(const FIoChunkId& ChunkId, TArray<FIoChunkId>& OutReadahead)
+{
+	if (LogArchive)
+	{
+		bool bIsAlreadyLogged = false;
+		LoggedChunks.Add(ChunkId, &bIsAlreadyLogged);
+		if (!bIsAlreadyLogged)
+		{
+			const uint32 Phase = GIoChunkAccessLogPhase.Load(EMemoryOrder::Relaxed);
+			const uint64 Milliseconds = uint64((FPlatformTime::Seconds() - StartTime) * 1000.0);
+			FScopeLock _(&LogCritical);
+			LogArchive->Logf(TEXT("%s %u %llu"), *BytesToHex(ChunkId.GetData(), FIoChunkId::GetSize()), Phase, Milliseconds);
+			if (Phase != LoggedPhase)
+			{
+				LoggedPhase = Phase;
+				LogArchive->Flush();
+			}
+		}
+	}
+
+	const int32* PredictedIndex = PredictedChunkIndices.Find(ChunkId);
+	if (!PredictedIndex)
+	{
+		return;
+	}
+	RequestedPredictedChunks[*PredictedIndex] = true;
+
+	// Chunks requested or read ahead before are skipped, so following the recorded order costs one readahead per chunk
+	const int32 ReadaheadEnd = FMath::Min(*PredictedIndex + 1 + FMath::Max(GIoDispatcherReadaheadChunkCount, 0), PredictedChunks.Num());
+	for (int32 Index = *PredictedIndex + 1; Index < ReadaheadEnd; ++Index)
+	{
+		if (!RequestedPredictedChunks[Index])
+		{
+			RequestedPredictedChunks[Index] = true;
+			OutReadahead.Add(PredictedChunks[Index]);
+		}
+	}
+}
+
+void FIoChunkAccessLog::MarkPhase()
+{
+	++GIoChunkAccessLogPhase;
+}
+
+void FIoChunkAccessLog::FlushLog()
+{
+	FScopeLock _(&LogCritical);
+	if (LogArchive)
+	{
+		LogArchive->Flush();
+	}
+}
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "HAL/CriticalSection.h"
+#include "IO/IoDispatcher.h"
+#include "Templates/UniquePtr.h"
+
+class FArchive;
+
+/**
+ * Chunk level access tracking for the IoDispatcher.
+ *
+ * With -IoChunkAccessLog=<file> the first read of every chunk is written to a text file, one
+ * "<chunk id> <phase> <milliseconds>" line per chunk in access order. The phase advances after engine init,
+ * when the engine loop init completes and on IoDispatcher.MarkAccessLogPhase. UnrealPak -CreateGlobalContainer
+ * takes the file with -ChunkAccessOrder=<file> to lay chunks out in the order they were read.
+ *
+ * With -IoChunkReadahead=<file> a previously recorded log is used to predict reads: whenever a logged chunk is
+ * requested, the next s.IoDispatcherReadaheadChunkCount chunks from the log are read at minimum priority so they
+ * are in the block cache (s.IoDispatcherCacheSizeMB) or the OS file cache by the time they are needed.
+ *
+ * OnChunkRequested is called from the dispatcher thread only.
+ */
+class FIoChunkAccessLog
+{
+public:
+	FIoChunkAccessLog();
+	~FIoChunkAccessLog();
+
+	void Initialize();
+
+	bool IsEnabled() const
+	{
+		return LogArchive.IsValid() || PredictedChunks.Num() > 0;
+	}
+
+	/** Called for every chunk read requested by the engine. Appends the chunks to read ahead to OutReadahead. */
+	void OnChunkRequested(const FIoChunkId& ChunkId, TArray<FIoChunkId>& OutReadahead);
+
+	/** Starts a new load phase in the recorded log. Thread safe. */
+	static void MarkPhase();
+
+private:
+	bool LoadPredictedChunks(const TCHAR* FilePath);
+	void FlushLog();
+
+	FCriticalSection LogCritical;
+	TUniquePtr<FArchive> LogArchive;
+	TSet<FIoChunkId> LoggedChunks;
+	uint32 LoggedPhase = 0;
+	double StartTime = 0.0;
+
+	TArray<FIoChunkId> PredictedChunks;
+	TMap<FIoChunkId, int32> PredictedChunkIndices;
+	TBitArray<> RequestedPredictedChunks;
+};
@@ -4,6 +4,7 @@
 #include "IO/IoDispatcherPrivate.h"
 #include "IO/IoStore.h"
 #include "IO/IoDispatcherFileBackend.h"
+#include "IO/IoChunkAccessLog.h"
 #include "Misc/ScopeRWLock.h"
 #include "Misc/CoreDelegates.h"
 #include "Math/RandomStream.h"
@@ -162,6 +163,7 @@ public:
 	bool InitializePostSettings()
 	{
 		FileIoStore.Initialize();
+		ChunkAccessLog.Initialize();
 		Thread = FRunnableThread::Create(this, TEXT("IoDispatcher"), 0, TPri_AboveNormal, FPlatformAffinity::GetIoDispatcherThreadMask());
 		return true;
 	}
@@ -531,6 +533,28 @@ private:
 					Request->ReleaseRef();
 					continue;
 				}
+				if (!Request->bIsReadahead && ChunkAccessLog.IsEnabled())
+				{
+					TArray<FIoChunkId> ReadaheadChunkIds;
+					ChunkAccessLog.OnChunkRequested(Request->ChunkId, ReadaheadChunkIds);
+					for (const FIoChunkId& ReadaheadChunkId : ReadaheadChunkIds)
+					{
+						// Nothing holds on to the result, the read is only there to get the blocks cached before they're needed
+						FIoRequestImpl* ReadaheadRequest = AllocRequest(ReadaheadChunkId, FIoReadOptions());
+						ReadaheadRequest->Priority = IoDispatcherPriority_Min;
+						ReadaheadRequest->bIsReadahead = true;
+						ReadaheadRequest->AddRef();
+						if (RequestsToSubmitTail)
+						{
+							RequestsToSubmitTail->NextRequest = ReadaheadRequest;
+						}
+						else
+						{
+							RequestsToSubmitHead = ReadaheadRequest;
+						}
+						RequestsToSubmitTail = ReadaheadRequest;
+					}
+				}
 			}
 			else
 			{
@@ -585,6 +609,7 @@ private:
 
 	FIoSignatureErrorEvent SignatureErrorEvent;
 	FFileIoStore FileIoStore;
+	FIoChunkAccessLog ChunkAccessLog;
 	FRequestAllocator RequestAllocator;
 	FBatchAllocator BatchAllocator;
 	FRunnableThread* Thread = nullptr;
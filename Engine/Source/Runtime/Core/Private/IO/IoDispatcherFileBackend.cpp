@@ -12,9 +12,11 @@
 #include "HAL/RunnableThread.h"
 #include "Misc/ScopeLock.h"
 #include "Misc/Paths.h"
+#include "Algo/StableSort.h"
 
 TRACE_DECLARE_MEMORY_COUNTER(IoDispatcherTotalBytesRead, TEXT("IoDispatcher/TotalBytesRead"));
 TRACE_DECLARE_MEMORY_COUNTER(IoDispatcherTotalBytesScattered, TEXT("IoDispatcher/TotalBytesScattered"));
+TRACE_DECLARE_MEMORY_COUNTER(IoDispatcherTotalBytesMapped, TEXT("IoDispatcher/TotalBytesMapped"));
 TRACE_DECLARE_INT_COUNTER(IoDispatcherCacheHits, TEXT("IoDispatcher/CacheHits"));
 TRACE_DECLARE_INT_COUNTER(IoDispatcherCacheMisses, TEXT("IoDispatcher/CacheMisses"));
 
@@ -48,6 +50,20 @@ static FAutoConsoleVariableRef CVar_IoDispatcherDecompressionWorkerCount(
 	TEXT("IoDispatcher decompression worker count.")
 );
 
+int32 GIoDispatcherDecompressionBatchSizeKB = 128;
+static FAutoConsoleVariableRef CVar_IoDispatcherDecompressionBatchSizeKB(
+	TEXT("s.IoDispatcherDecompressionBatchSizeKB"),
+	GIoDispatcherDecompressionBatchSizeKB,
+	TEXT("Uncompressed size (in kilobytes) up to which small IoDispatcher blocks are decompressed together by one task.")
+);
+
+int32 GIoDispatcherEnableMappedReads = 1;
+static FAutoConsoleVariableRef CVar_IoDispatcherEnableMappedReads(
+	TEXT("s.IoDispatcherEnableMappedReads"),
+	GIoDispatcherEnableMappedReads,
+	TEXT("Return uncompressed chunks requested with FIoReadOptions::SetAllowMapped as views of the memory mapped container.")
+);
+
 int32 GIoDispatcherCacheSizeMB = 0;
 static FAutoConsoleVariableRef CVar_IoDispatcherCacheSizeMB(
 	TEXT("s.IoDispatcherCacheSizeMB"),
@@ -83,6 +99,7 @@ void FFileIoStoreBufferAllocator::Initialize(uint64 MemorySize, uint64 BufferSiz
 	uint64 BufferCount = MemorySize / BufferSize;
 	MemorySize = BufferCount * BufferSize;
 	BufferMemory = reinterpret_cast<uint8*>(FMemory::Malloc(MemorySize, BufferAlignment));
+	BufferMemorySize = MemorySize;
 	for (uint64 BufferIndex = 0; BufferIndex < BufferCount; ++BufferIndex)
 	{
 		FFileIoStoreBuffer* Buffer = new FFileIoStoreBuffer();
@@ -381,6 +398,7 @@ IMappedFileHandle* FFileIoStoreReader::GetMappedContainerFileHandle(uint64 TocOf
 {
 	int32 PartitionIndex = int32(TocOffset / ContainerFile.PartitionSize);
 	FFileIoStoreContainerFilePartition& Partition = ContainerFile.Partitions[PartitionIndex];
+	FScopeLock _(&MappedRegionsCritical);
 	if (!Partition.MappedFileHandle)
 	{
 		IPlatformFile& Ipf = FPlatformFileManager::Get().GetPlatformFile();
@@ -391,6 +409,57 @@ IMappedFileHandle* FFileIoStoreReader::GetMappedContainerFileHandle(uint64 TocOf
 	return new FMappedFileProxy(Partition.MappedFileHandle.Get(), Partition.FileSize);
 }
 
+const uint8* FFileIoStoreReader::GetMappedUncompressedRange(uint64 ResolvedOffset, uint64 ResolvedSize)
+{
+	if (!FPlatformProperties::SupportsMemoryMappedFiles() || IsEncrypted() || IsSigned())
+	{
+		return nullptr;
+	}
+
+	// The range has to be stored as is and in one piece, which holds for uncompressed blocks written back to back
+	const uint64 CompressionBlockSize = ContainerFile.CompressionBlockSize;
+	const int32 BeginBlockIndex = int32(ResolvedOffset / CompressionBlockSize);
+	const int32 EndBlockIndex = int32((ResolvedOffset + ResolvedSize - 1) / CompressionBlockSize);
+	const uint64 BeginBlockOffset = ContainerFile.CompressionBlocks[BeginBlockIndex].GetOffset();
+	for (int32 BlockIndex = BeginBlockIndex; BlockIndex <= EndBlockIndex; ++BlockIndex)
+	{
+		const FIoStoreTocCompressedBlockEntry& CompressionBlockEntry = ContainerFile.CompressionBlocks[BlockIndex];
+		if (CompressionBlockEntry.GetCompressionMethodIndex() != 0 || CompressionBlockEntry.GetOffset() != BeginBlockOffset + (BlockIndex - BeginBlockIndex) * CompressionBlockSize)
+		{
+			return nullptr;
+		}
+	}
+
+	const uint64 FileOffset = BeginBlockOffset + ResolvedOffset % CompressionBlockSize;
+	const int32 PartitionIndex = int32(FileOffset / ContainerFile.PartitionSize);
+	if (int32((FileOffset + ResolvedSize - 1) / ContainerFile.PartitionSize) != PartitionIndex)
+	{
+		return nullptr;
+	}
+
+	// Partitions are mapped in full on first use and stay mapped until the container goes away
+	FFileIoStoreContainerFilePartition& Partition = ContainerFile.Partitions[PartitionIndex];
+	FScopeLock _(&MappedRegionsCritical);
+	if (!Partition.MappedFileRegion)
+	{
+		if (!Partition.MappedFileHandle)
+		{
+			IPlatformFile& Ipf = FPlatformFileManager::Get().GetPlatformFile();
+			Partition.MappedFileHandle.Reset(Ipf.OpenMapped(*Partition.FilePath));
+			if (!Partition.MappedFileHandle)
+			{
+				return nullptr;
+			}
+		}
+		Partition.MappedFileRegion.Reset(Partition.MappedFileHandle->MapRegion(0, Partition.FileSize));
+		if (!Partition.MappedFileRegion)
+		{
+			return nullptr;
+		}
+	}
+	return Partition.MappedFileRegion->GetMappedPtr() + FileOffset % ContainerFile.PartitionSize;
+}
+
 FFileIoStoreResolvedRequest::FFileIoStoreResolvedRequest(
 	FIoRequestImpl& InDispatcherRequest,
 	const FFileIoStoreContainerFile& InContainerFile,
@@ -713,6 +782,17 @@ EIoStoreResolveResult FFileIoStore::Resolve(FIoRequestImpl* Request)
 
 			if (ResolvedSize > 0)
 			{
+				if (GIoDispatcherEnableMappedReads && Request->Options.IsMappedAllowed() && !Request->Options.GetTargetVa())
+				{
+					if (const uint8* MappedData = Reader->GetMappedUncompressedRange(ResolvedOffset, ResolvedSize))
+					{
+						TRACE_COUNTER_ADD(IoDispatcherTotalBytesMapped, ResolvedSize);
+						Request->IoBuffer = FIoBuffer(FIoBuffer::Wrap, MappedData, ResolvedSize);
+						CompleteDispatcherRequest(ResolvedRequest);
+						return IoStoreResolveResult_OK;
+					}
+				}
+
 				if (void* TargetVa = Request->Options.GetTargetVa())
 				{
 					Request->IoBuffer = FIoBuffer(FIoBuffer::Wrap, TargetVa, ResolvedSize);
@@ -810,19 +890,39 @@ FAutoConsoleTaskPriority CPrio_IoDispatcherTaskPriority(
 	ENamedThreads::NormalTaskPriority // if we don't have background threads, then use normal priority threads at normal task priority instead
 );
 
-ENamedThreads::Type FFileIoStore::FDecompressAsyncTask::GetDesiredThread()
+ENamedThreads::Type FFileIoStore::FDecompressAsyncTask::GetDesiredThread() const
 {
-	return CPrio_IoDispatcherTaskPriority.Get();
+	// Don't let blocks needed by high priority requests queue up behind background work
+	return bIsHighPriority ? ENamedThreads::AnyHiPriThreadHiPriTask : CPrio_IoDispatcherTaskPriority.Get();
+}
+
+void FFileIoStore::ScatterBlocksAsync(const FCompressedBlockBatch& CompressedBlocks)
+{
+	FFileIoStoreCompressionContext* CompressionContext = CompressedBlocks[0]->CompressionContext;
+	for (FFileIoStoreCompressedBlock* CompressedBlock : CompressedBlocks)
+	{
+		// The owning requests may have been cancelled while the task was queued
+		if (!CompressedBlock->bCancelled)
+		{
+			ScatterBlock(CompressedBlock, CompressionContext);
+		}
+	}
+
+	FScopeLock Lock(&DecompressedBlocksCritical);
+	for (FFileIoStoreCompressedBlock* CompressedBlock : CompressedBlocks)
+	{
+		CompressedBlock->Next = FirstDecompressedBlock;
+		FirstDecompressedBlock = CompressedBlock;
+	}
+	EventQueue.DispatcherNotify();
 }
 
-void FFileIoStore::ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, bool bIsAsync)
+void FFileIoStore::ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, FFileIoStoreCompressionContext* CompressionContext)
 {
 	LLM_SCOPE(ELLMTag::FileSystem);
 	TRACE_CPUPROFILER_EVENT_SCOPE(IoDispatcherScatter);
 	
 	check(!CompressedBlock->bFailed);
-
-	FFileIoStoreCompressionContext* CompressionContext = CompressedBlock->CompressionContext;
 	check(CompressionContext);
 	uint8* CompressedBuffer;
 	if (CompressedBlock->RawBlocks.Num() > 1)
@@ -873,6 +973,19 @@ void FFileIoStore::ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, bo
 		{
 			UncompressedBuffer = CompressedBuffer;
 		}
+		else if (CompressedBlock->ScatterList.Num() == 1 && CompressedBlock->ScatterList[0].SrcOffset == 0 && CompressedBlock->ScatterList[0].Size == CompressedBlock->UncompressedSize)
+		{
+			// The whole block goes to a single request, e.g. a streamed mip read into locked RHI memory through FIoReadOptions::SetTargetVa,
+			// so decompress straight into the destination instead of going through the context's buffer and copying
+			FFileIoStoreBlockScatter& Scatter = CompressedBlock->ScatterList[0];
+			uint8* Dest = Scatter.Request->GetIoBuffer().Data() + Scatter.DstOffset;
+			if (!FCompression::UncompressMemory(CompressedBlock->CompressionMethod, Dest, int32(CompressedBlock->UncompressedSize), CompressedBuffer, int32(CompressedBlock->CompressedSize)))
+			{
+				UE_LOG(LogIoDispatcher, Warning, TEXT("Failed decompressing block"));
+				CompressedBlock->bFailed = true;
+			}
+			UncompressedBuffer = nullptr;
+		}
 		else
 		{
 			if (CompressionContext->UncompressedBufferSize < CompressedBlock->UncompressedSize)
@@ -891,20 +1004,96 @@ void FFileIoStore::ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, bo
 			}
 		}
 
-		for (FFileIoStoreBlockScatter& Scatter : CompressedBlock->ScatterList)
+		if (UncompressedBuffer)
 		{
-			FMemory::Memcpy(Scatter.Request->GetIoBuffer().Data() + Scatter.DstOffset, UncompressedBuffer + Scatter.SrcOffset, Scatter.Size);
+			for (FFileIoStoreBlockScatter& Scatter : CompressedBlock->ScatterList)
+			{
+				FMemory::Memcpy(Scatter.Request->GetIoBuffer().Data() + Scatter.DstOffset, UncompressedBuffer + Scatter.SrcOffset, Scatter.Size);
+			}
 		}
 	}
+}
 
-	if (bIsAsync)
+void FFileIoStore::DispatchReadyBlocks()
+{
+	if (ReadyForDecompression.Num() == 0)
 	{
-		FScopeLock Lock(&DecompressedBlocksCritical);
-		CompressedBlock->Next = FirstDecompressedBlock;
-		FirstDecompressedBlock = CompressedBlock;
+		return;
+	}
+
+	// Priorities can change while blocks wait for a compression context, so order them by their most urgent request
+	// on every pass. The sort is stable to keep blocks of equal priority in the order they were read.
+	for (FFileIoStoreCompressedBlock* CompressedBlock : ReadyForDecompression)
+	{
+		int32 Priority = IoDispatcherPriority_Min;
+		for (const FFileIoStoreBlockScatter& Scatter : CompressedBlock->ScatterList)
+		{
+			Priority = FMath::Max(Priority, Scatter.Request->GetPriority());
+		}
+		CompressedBlock->Priority = Priority;
+	}
+	Algo::StableSort(ReadyForDecompression, [](const FFileIoStoreCompressedBlock* A, const FFileIoStoreCompressedBlock* B)
+	{
+		return A->Priority > B->Priority;
+	});
 
-		EventQueue.DispatcherNotify();
+	const uint64 BatchSizeLimit = uint64(FMath::Max(GIoDispatcherDecompressionBatchSizeKB, 0)) << 10;
+	FCompressedBlockBatch Batch;
+	uint64 BatchSize = 0;
+	auto DispatchBatch = [this, &Batch, &BatchSize]()
+	{
+		if (Batch.Num())
+		{
+			const bool bIsHighPriority = Batch[0]->Priority >= IoDispatcherPriority_High;
+			TGraphTask<FDecompressAsyncTask>::CreateTask().ConstructAndDispatchWhenReady(*this, MoveTemp(Batch), bIsHighPriority);
+			Batch.Reset();
+			BatchSize = 0;
+		}
+	};
+
+	int32 DispatchedCount = 0;
+	for (int32 BlockCount = ReadyForDecompression.Num(); DispatchedCount < BlockCount; ++DispatchedCount)
+	{
+		FFileIoStoreCompressedBlock* BlockToDecompress = ReadyForDecompression[DispatchedCount];
+		if (BlockToDecompress->bFailed | BlockToDecompress->bCancelled)
+		{
+			FinalizeCompressedBlock(BlockToDecompress);
+			continue;
+		}
+
+		// Scatter block asynchronous when the block is compressed, encrypted or signed
+		const bool bScatterAsync = bIsMultithreaded && (!BlockToDecompress->CompressionMethod.IsNone() || BlockToDecompress->EncryptionKey.IsValid() || BlockToDecompress->SignatureHash);
+		if (bScatterAsync)
+		{
+			// Small blocks share a task, and the context owned by the first block in the batch
+			if (!Batch.Num())
+			{
+				BlockToDecompress->CompressionContext = AllocCompressionContext();
+				if (!BlockToDecompress->CompressionContext)
+				{
+					break;
+				}
+			}
+			Batch.Add(BlockToDecompress);
+			BatchSize += BlockToDecompress->UncompressedSize;
+			if (BatchSize >= BatchSizeLimit)
+			{
+				DispatchBatch();
+			}
+		}
+		else
+		{
+			BlockToDecompress->CompressionContext = AllocCompressionContext();
+			if (!BlockToDecompress->CompressionContext)
+			{
+				break;
+			}
+			ScatterBlock(BlockToDecompress, BlockToDecompress->CompressionContext);
+			FinalizeCompressedBlock(BlockToDecompress);
+		}
 	}
+	DispatchBatch();
+	ReadyForDecompression.RemoveAt(0, DispatchedCount, false);
 }
 
 void FFileIoStore::CompleteDispatcherRequest(FFileIoStoreResolvedRequest* ResolvedRequest)
@@ -955,7 +1144,7 @@ void FFileIoStore::FinalizeCompressedBlock(FFileIoStoreCompressedBlock* Compress
 			}
 		}
 	}
-	check(CompressedBlock->CompressionContext || CompressedBlock->bCancelled || CompressedBlock->bFailed);
+	// Only the first block of a decompression batch owns a context
 	if (CompressedBlock->CompressionContext)
 	{
 		FreeCompressionContext(CompressedBlock->CompressionContext);
@@ -1050,16 +1239,7 @@ FIoRequestImpl* FFileIoStore::GetCompletedRequests()
 				if (--CompressedBlock->UnfinishedRawBlocksCount == 0)
 				{
 					RequestTracker.RemoveCompressedBlock(CompressedBlock);
-					if (!ReadyForDecompressionTail)
-					{
-						ReadyForDecompressionHead = ReadyForDecompressionTail = CompressedBlock;
-					}
-					else
-					{
-						ReadyForDecompressionTail->Next = CompressedBlock;
-						ReadyForDecompressionTail = CompressedBlock;
-					}
-					CompressedBlock->Next = nullptr;
+					ReadyForDecompression.Add(CompressedBlock);
 				}
 			}
 		}
@@ -1095,40 +1275,7 @@ FIoRequestImpl* FFileIoStore::GetCompletedRequests()
 		BlockToReap = Next;
 	}
 
-	FFileIoStoreCompressedBlock* BlockToDecompress = ReadyForDecompressionHead;
-	while (BlockToDecompress)
-	{
-		FFileIoStoreCompressedBlock* Next = BlockToDecompress->Next;
-		if (BlockToDecompress->bFailed | BlockToDecompress->bCancelled)
-		{
-			FinalizeCompressedBlock(BlockToDecompress);
-			BlockToDecompress = Next;
-			continue;
-		}
-		
-		BlockToDecompress->CompressionContext = AllocCompressionContext();
-		if (!BlockToDecompress->CompressionContext)
-		{
-			break;
-		}
-		// Scatter block asynchronous when the block is compressed, encrypted or signed
-		const bool bScatterAsync = bIsMultithreaded && (!BlockToDecompress->CompressionMethod.IsNone() || BlockToDecompress->EncryptionKey.IsValid() || BlockToDecompress->SignatureHash);
-		if (bScatterAsync)
-		{
-			TGraphTask<FDecompressAsyncTask>::CreateTask().ConstructAndDispatchWhenReady(*this, BlockToDecompress);
-		}
-		else
-		{
-			ScatterBlock(BlockToDecompress, false);
-			FinalizeCompressedBlock(BlockToDecompress);
-		}
-		BlockToDecompress = Next;
-	}
-	ReadyForDecompressionHead = BlockToDecompress;
-	if (!ReadyForDecompressionHead)
-	{
-		ReadyForDecompressionTail = nullptr;
-	}
+	DispatchReadyBlocks();
 
 	FIoRequestImpl* Result = CompletedRequestsHead;
 	CompletedRequestsHead = CompletedRequestsTail = nullptr;
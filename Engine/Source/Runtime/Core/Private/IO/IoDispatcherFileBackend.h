@@ -15,6 +15,7 @@
 #include "GenericPlatform/GenericPlatformFile.h"
 
 class IMappedFileHandle;
+class IMappedFileRegion;
 
 struct FFileIoStoreCompressionContext
 {
@@ -41,6 +42,7 @@ public:
 	const FIoOffsetAndLength* Resolve(const FIoChunkId& ChunkId) const;
 	const FFileIoStoreContainerFile& GetContainerFile() const { return ContainerFile; }
 	IMappedFileHandle* GetMappedContainerFileHandle(uint64 TocOffset);
+	const uint8* GetMappedUncompressedRange(uint64 ResolvedOffset, uint64 ResolvedSize);
 	const FIoContainerId& GetContainerId() const { return ContainerId; }
 	int32 GetOrder() const { return Order; }
 	bool IsEncrypted() const { return EnumHasAnyFlags(ContainerFile.ContainerFlags, EIoContainerFlags::Encrypted); }
@@ -54,6 +56,7 @@ private:
 
 	TMap<FIoChunkId, FIoOffsetAndLength> Toc;
 	FFileIoStoreContainerFile ContainerFile;
+	FCriticalSection MappedRegionsCritical;
 	FIoContainerId ContainerId;
 	uint32 Index;
 	int32 Order;
@@ -107,12 +110,16 @@ public:
 	virtual void Stop() override;
 
 private:
+	typedef TArray<FFileIoStoreCompressedBlock*, TInlineAllocator<8>> FCompressedBlockBatch;
+
+	/** Decompresses and scatters a batch of blocks sharing one compression context, the context is owned by the first block. */
 	class FDecompressAsyncTask
 	{
 	public:
-		FDecompressAsyncTask(FFileIoStore& InOuter, FFileIoStoreCompressedBlock* InCompressedBlock)
+		FDecompressAsyncTask(FFileIoStore& InOuter, FCompressedBlockBatch&& InCompressedBlocks, bool bInIsHighPriority)
 			: Outer(InOuter)
-			, CompressedBlock(InCompressedBlock)
+			, CompressedBlocks(MoveTemp(InCompressedBlocks))
+			, bIsHighPriority(bInIsHighPriority)
 		{
 
 		}
@@ -122,7 +129,7 @@ private:
 			RETURN_QUICK_DECLARE_CYCLE_STAT(FIoStoreDecompressTask, STATGROUP_TaskGraphTasks);
 		}
 
-		static ENamedThreads::Type GetDesiredThread();
+		ENamedThreads::Type GetDesiredThread() const;
 
 		FORCEINLINE static ESubsequentsMode::Type GetSubsequentsMode()
 		{
@@ -131,12 +138,13 @@ private:
 
 		void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 		{
-			Outer.ScatterBlock(CompressedBlock, true);
+			Outer.ScatterBlocksAsync(CompressedBlocks);
 		}
 
 	private:
 		FFileIoStore& Outer;
-		FFileIoStoreCompressedBlock* CompressedBlock;
+		FCompressedBlockBatch CompressedBlocks;
+		bool bIsHighPriority;
 	};
 
 	void OnNewPendingRequestsAdded();
@@ -144,7 +152,9 @@ private:
 	void FreeBuffer(FFileIoStoreBuffer& Buffer);
 	FFileIoStoreCompressionContext* AllocCompressionContext();
 	void FreeCompressionContext(FFileIoStoreCompressionContext* CompressionContext);
-	void ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, bool bIsAsync);
+	void ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, FFileIoStoreCompressionContext* CompressionContext);
+	void ScatterBlocksAsync(const FCompressedBlockBatch& CompressedBlocks);
+	void DispatchReadyBlocks();
 	void CompleteDispatcherRequest(FFileIoStoreResolvedRequest* ResolvedRequest);
 	void FinalizeCompressedBlock(FFileIoStoreCompressedBlock* CompressedBlock);
 	void UpdateAsyncIOMinimumPriority();
@@ -165,8 +175,7 @@ private:
 	TArray<FFileIoStoreReader*> UnorderedIoStoreReaders;
 	TArray<FFileIoStoreReader*> OrderedIoStoreReaders;
 	FFileIoStoreCompressionContext* FirstFreeCompressionContext = nullptr;
-	FFileIoStoreCompressedBlock* ReadyForDecompressionHead = nullptr;
-	FFileIoStoreCompressedBlock* ReadyForDecompressionTail = nullptr;
+	TArray<FFileIoStoreCompressedBlock*> ReadyForDecompression;
 	FCriticalSection DecompressedBlocksCritical;
 	FFileIoStoreCompressedBlock* FirstDecompressedBlock = nullptr;
 	FIoRequestImpl* CompletedRequestsHead = nullptr;
@@ -14,6 +14,7 @@ struct FFileIoStoreContainerFilePartition
 	uint32 ContainerFileIndex = 0;
 	FString FilePath;
 	TUniquePtr<IMappedFileHandle> MappedFileHandle;
+	TUniquePtr<IMappedFileRegion> MappedFileRegion;
 };
 
 struct FFileIoStoreContainerFile
@@ -93,6 +94,7 @@ struct FFileIoStoreCompressedBlock
 	uint8* CompressedDataBuffer = nullptr;
 	FAES::FAESKey EncryptionKey;
 	const FSHAHash* SignatureHash = nullptr;
+	int32 Priority = 0;
 	bool bFailed = false;
 	bool bCancelled = false;
 };
@@ -196,9 +198,18 @@ public:
 	void Initialize(uint64 MemorySize, uint64 BufferSize, uint32 BufferAlignment);
 	FFileIoStoreBuffer* AllocBuffer();
 	void FreeBuffer(FFileIoStoreBuffer* Buffer);
+	uint8* GetBufferMemory() const
+	{
+		return BufferMemory;
+	}
+	uint64 GetBufferMemorySize() const
+	{
+		return BufferMemorySize;
+	}
 
 private:
 	uint8* BufferMemory = nullptr;
+	uint64 BufferMemorySize = 0;
 	FCriticalSection BuffersCritical;
 	FFileIoStoreBuffer* FirstFreeBuffer = nullptr;
 };
@@ -629,19 +629,14 @@ public:
 		Entry->Request->PrepareSourceBufferAsync(Entry->HashBarrier);
 	}
 
-	UE_NODISCARD TIoStatusOr<FIoStoreWriterResult> Flush()
+	void BeginFlush()
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FlushContainer);
-
-		if (!IsMetadataDirty)
+		if (!IsMetadataDirty || bCompressionQueued)
 		{
-			return Result;
+			return;
 		}
 
-		IsMetadataDirty = false;
-
-		const FIoStoreWriterSettings& Settings = WriterContext->GetSettings();
-		uint64 UncompressedFileOffset = 0;
+		bCompressionQueued = true;
 
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(WaitForChunkHashes);
@@ -661,6 +656,23 @@ public:
 		{
 			WriterContext->BeginCompress(Entry);
 		}
+	}
+
+	UE_NODISCARD TIoStatusOr<FIoStoreWriterResult> Flush()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FlushContainer);
+
+		if (!IsMetadataDirty)
+		{
+			return Result;
+		}
+
+		BeginFlush();
+		IsMetadataDirty = false;
+		bCompressionQueued = false;
+
+		const FIoStoreWriterSettings& Settings = WriterContext->GetSettings();
+		uint64 UncompressedFileOffset = 0;
 
 		const uint64 MaxPartitionSize = Settings.MaxPartitionSize > 0 ? Settings.MaxPartitionSize : MAX_uint64;
 		uint64 TotalEntryUncompressedSize = 0;
@@ -1102,6 +1114,9 @@ private:
 		return FIoStatus::Ok;
 	}
 
+	/** Chunks with fewer compression blocks than this are compressed on the task that owns the chunk */
+	static constexpr int32 ParallelCompressionMinBlocks = 16;
+
 	static void CreateChunkBlocks(
 		FIoStoreWriteQueueEntry* Entry,
 		const FIoContainerSettings& ContainerSettings,
@@ -1152,18 +1167,20 @@ private:
 		{
 			check(!WriterSettings.CompressionMethod.IsNone());
 
-			const uint8* UncompressedBlock = Entry->ChunkBuffer.Data();
+			const int32 NumBlocks = int32(NumChunkBlocks);
 			TArray<TUniquePtr<uint8[]>> CompressedBlocks;
-			CompressedBlocks.Reserve(int32(NumChunkBlocks));
-
-			uint64 BytesToProcess	= Entry->ChunkBuffer.DataSize();
-			uint64 BlockOffset		= 0;
+			CompressedBlocks.SetNum(NumBlocks);
+			Entry->ChunkBlocks.SetNum(NumBlocks);
 
-			while (BytesToProcess > 0)
+			// Blocks are compressed independently, so large chunks (e.g. bulk data) are split across workers instead of
+			// compressing on a single task while the writer waits for them. Offsets are assigned once all blocks are done.
+			ParallelFor(NumBlocks, [Entry, &CompressedBlocks, &WriterSettings](int32 BlockIndex)
 			{
-				const int32 UncompressedBlockSize = static_cast<int32>(FMath::Min(BytesToProcess, WriterSettings.CompressionBlockSize));
+				const uint64 UncompressedOffset = uint64(BlockIndex) * WriterSettings.CompressionBlockSize;
+				const uint8* UncompressedBlock = Entry->ChunkBuffer.Data() + UncompressedOffset;
+				const int32 UncompressedBlockSize = static_cast<int32>(FMath::Min(Entry->ChunkBuffer.DataSize() - UncompressedOffset, WriterSettings.CompressionBlockSize));
 				int32 CompressedBlockSize = FCompression::CompressMemoryBound(WriterSettings.CompressionMethod, UncompressedBlockSize);
-				TUniquePtr<uint8[]>& CompressedBlock = CompressedBlocks.AddDefaulted_GetRef();
+				TUniquePtr<uint8[]>& CompressedBlock = CompressedBlocks[BlockIndex];
 				CompressedBlock = MakeUnique<uint8[]>(CompressedBlockSize);
 
 				FName CompressionMethod = WriterSettings.CompressionMethod;
@@ -1203,11 +1220,14 @@ private:
 					CompressedBlock.Reset(AlignedBlock.Release());
 				}
 
-				Entry->ChunkBlocks.Add(FChunkBlock { BlockOffset, AlignedCompressedBlockSize, uint64(CompressedBlockSize), uint64(UncompressedBlockSize), CompressionMethod });
+				Entry->ChunkBlocks[BlockIndex] = FChunkBlock { 0, AlignedCompressedBlockSize, uint64(CompressedBlockSize), uint64(UncompressedBlockSize), CompressionMethod };
+			}, NumBlocks < ParallelCompressionMinBlocks ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-				BytesToProcess		-= UncompressedBlockSize;
-				BlockOffset			+= AlignedCompressedBlockSize;
-				UncompressedBlock	+= UncompressedBlockSize;
+			uint64 BlockOffset = 0;
+			for (FChunkBlock& ChunkBlock : Entry->ChunkBlocks)
+			{
+				ChunkBlock.Offset = BlockOffset;
+				BlockOffset += ChunkBlock.Size;
 			}
 
 			Entry->CompressedSize = BlockOffset;
@@ -1265,6 +1285,7 @@ private:
 	uint64						UncompressedContainerSize = 0;
 	uint64						CompressedContainerSize = 0;
 	bool						IsMetadataDirty = true;
+	bool						bCompressionQueued = false;
 };
 
 FIoStoreWriter::FIoStoreWriter(FIoStoreEnvironment& InEnvironment)
@@ -1327,6 +1348,11 @@ void FIoStoreWriter::Append(const FIoChunkId& ChunkId, IIoStoreWriteRequest* Req
 	Impl->Append(ChunkId, Request, WriteOptions);
 }
 
+void FIoStoreWriter::BeginFlush()
+{
+	Impl->BeginFlush();
+}
+
 TIoStatusOr<FIoStoreWriterResult> FIoStoreWriter::Flush()
 {
 	return Impl->Flush();
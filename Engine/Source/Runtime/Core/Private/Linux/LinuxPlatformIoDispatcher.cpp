@@ -0,0 +1,596 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Linux/LinuxPlatformIoDispatcher.h"
+#include "IO/IoDispatcherFileBackend.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//PRAGMA_DISABLE_OPTIMIZATION
+
+// The io_uring ABI is declared here rather than taken from <linux/io_uring.h>, since the sysroots we build against
+// predate it. The layouts and values are fixed by the kernel ABI.
+namespace UE4LinuxIoUring_Private
+{
+	enum : long
+	{
+		Syscall_Setup = 425,
+		Syscall_Enter = 426,
+		Syscall_Register = 427,
+	};
+
+	enum : uint8
+	{
+		Op_ReadV = 1,
+		Op_ReadFixed = 4,
+	};
+
+	enum : uint32
+	{
+		SqeFlag_FixedFile = 1u << 0,
+		EnterFlag_GetEvents = 1u << 0,
+		Feature_SingleMmap = 1u << 0,
+		Register_Buffers = 0,
+		Register_Files = 2,
+		Register_FilesUpdate = 6,
+	};
+
+	enum : uint64
+	{
+		MmapOffset_SqRing = 0ull,
+		MmapOffset_CqRing = 0x8000000ull,
+		MmapOffset_Sqes = 0x10000000ull,
+	};
+
+	struct FSqRingOffsets
+	{
+		uint32 Head;
+		uint32 Tail;
+		uint32 RingMask;
+		uint32 RingEntries;
+		uint32 Flags;
+		uint32 Dropped;
+		uint32 Array;
+		uint32 Reserved1;
+		uint64 Reserved2;
+	};
+
+	struct FCqRingOffsets
+	{
+		uint32 Head;
+		uint32 Tail;
+		uint32 RingMask;
+		uint32 RingEntries;
+		uint32 Overflow;
+		uint32 Cqes;
+		uint32 Flags;
+		uint32 Reserved1;
+		uint64 Reserved2;
+	};
+
+	struct FParams
+	{
+		uint32 SqEntries;
+		uint32 CqEntries;
+		uint32 Flags;
+		uint32 SqThreadCpu;
+		uint32 SqThreadIdle;
+		uint32 Features;
+		uint32 WqFd;
+		uint32 Reserved[3];
+		FSqRingOffsets SqOffsets;
+		FCqRingOffsets CqOffsets;
+	};
+
+	struct FFilesUpdate
+	{
+		uint32 Offset;
+		uint32 Reserved;
+		uint64 Fds;
+	};
+
+	static_assert(sizeof(FParams) == 120, "io_uring_params layout mismatch");
+	static_assert(sizeof(FFilesUpdate) == 16, "io_uring_files_update layout mismatch");
+
+	/** Number of reads kept in flight at once, also the size of the submission ring. */
+	static const uint32 QueueDepth = 32;
+
+	/** Number of slots in the fixed file table, registered sparse up front so containers can be added as they are mounted. */
+	static const uint32 MaxFixedFiles = 1024;
+
+	static const uint32 MaxRetries = 10;
+
+	FORCEINLINE int Setup(uint32 Entries, FParams& Params)
+	{
+		return int(syscall(Syscall_Setup, Entries, &Params));
+	}
+
+	FORCEINLINE int Enter(int RingFd, uint32 ToSubmit, uint32 MinComplete, uint32 Flags)
+	{
+		return int(syscall(Syscall_Enter, RingFd, ToSubmit, MinComplete, Flags, nullptr, 0));
+	}
+
+	FORCEINLINE int Register(int RingFd, uint32 Opcode, const void* Arg, uint32 NumArgs)
+	{
+		return int(syscall(Syscall_Register, RingFd, Opcode, Arg, NumArgs));
+	}
+
+	FORCEINLINE uint32 LoadAcquire(volatile const uint32* Src)
+	{
+		return uint32(FPlatformAtomics::AtomicRead(reinterpret_cast<volatile const int32*>(Src)));
+	}
+
+	FORCEINLINE void StoreRelease(volatile uint32* Dest, uint32 Value)
+	{
+		FPlatformAtomics::AtomicStore(reinterpret_cast<volatile int32*>(Dest), int32(Value));
+	}
+
+	/** Container file handles hold the file descriptor in the low 32 bits and the fixed file index plus one in the high 32 bits. */
+	FORCEINLINE uint64 MakeFileHandle(int32 Fd, int32 FixedIndex)
+	{
+		return uint64(uint32(Fd)) | (uint64(uint32(FixedIndex + 1)) << 32);
+	}
+
+	FORCEINLINE int32 GetFileDescriptor(uint64 FileHandle)
+	{
+		return int32(uint32(FileHandle));
+	}
+
+	FORCEINLINE int32 GetFixedFileIndex(uint64 FileHandle)
+	{
+		return int32(uint32(FileHandle >> 32)) - 1;
+	}
+}
+
+struct FIoUringSqe
+{
+	uint8 Opcode;
+	uint8 Flags;
+	uint16 IoPriority;
+	int32 Fd;
+	uint64 Offset;
+	uint64 Address;
+	uint32 Length;
+	uint32 ReadWriteFlags;
+	uint64 UserData;
+	uint16 BufferIndex;
+	uint16 Personality;
+	int32 SpliceFdIn;
+	uint64 Padding[2];
+};
+
+struct FIoUringCqe
+{
+	uint64 UserData;
+	int32 Result;
+	uint32 Flags;
+};
+
+static_assert(sizeof(FIoUringSqe) == 64, "io_uring_sqe layout mismatch");
+static_assert(sizeof(FIoUringCqe) == 16, "io_uring_cqe layout mismatch");
+
+FLinuxFileIoStoreImpl::FLinuxFileIoStoreImpl(FGenericIoDispatcherEventQueue& InEventQueue, FFileIoStoreBufferAllocator& InBufferAllocator, FFileIoStoreBlockCache& InBlockCache)
+	: EventQueue(InEventQueue)
+	, BufferAllocator(InBufferAllocator)
+	, BlockCache(InBlockCache)
+	, FallbackImpl(InEventQueue, InBufferAllocator, InBlockCache)
+{
+	bUseIoUring = !FParse::Param(FCommandLine::Get(), TEXT("NoIoUring")) && InitializeRing();
+}
+
+FLinuxFileIoStoreImpl::~FLinuxFileIoStoreImpl()
+{
+	ShutdownRing();
+}
+
+bool FLinuxFileIoStoreImpl::InitializeRing()
+{
+	using namespace UE4LinuxIoUring_Private;
+
+	FParams Params;
+	FMemory::Memzero(Params);
+	RingFd = Setup(QueueDepth, Params);
+	if (RingFd < 0)
+	{
+		UE_LOG(LogIoDispatcher, Log, TEXT("io_uring is not available (errno %d), using blocking reads"), errno);
+		RingFd = -1;
+		return false;
+	}
+
+	SqRingMemorySize = Params.SqOffsets.Array + Params.SqEntries * sizeof(uint32);
+	CqRingMemorySize = Params.CqOffsets.Cqes + Params.CqEntries * sizeof(FIoUringCqe);
+	if (Params.Features & Feature_SingleMmap)
+	{
+		SqRingMemorySize = CqRingMemorySize = FMath::Max(SqRingMemorySize, CqRingMemorySize);
+	}
+
+	SqRingMemory = mmap(nullptr, SqRingMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, MmapOffset_SqRing);
+	if (SqRingMemory == MAP_FAILED)
+	{
+		SqRingMemory = nullptr;
+		ShutdownRing();
+		return false;
+	}
+
+	if (Params.Features & Feature_SingleMmap)
+	{
+		CqRingMemory = SqRingMemory;
+	}
+	else
+	{
+		CqRingMemory = mmap(nullptr, CqRingMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, MmapOffset_CqRing);
+		if (CqRingMemory == MAP_FAILED)
+		{
+			CqRingMemory = nullptr;
+			ShutdownRing();
+			return false;
+		}
+	}
+
+	SqesMemorySize = Params.SqEntries * sizeof(FIoUringSqe);
+	void* SqesMemory = mmap(nullptr, SqesMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, MmapOffset_Sqes);
+	if (SqesMemory == MAP_FAILED)
+	{
+		ShutdownRing();
+		return false;
+	}
+	Sqes = reinterpret_cast<FIoUringSqe*>(SqesMemory);
+
+	uint8* SqRing = reinterpret_cast<uint8*>(SqRingMemory);
+	SqHead = reinterpret_cast<volatile uint32*>(SqRing + Params.SqOffsets.Head);
+	SqTail = reinterpret_cast<volatile uint32*>(SqRing + Params.SqOffsets.Tail);
+	SqArray = reinterpret_cast<uint32*>(SqRing + Params.SqOffsets.Array);
+	SqRingMask = *reinterpret_cast<uint32*>(SqRing + Params.SqOffsets.RingMask);
+
+	uint8* CqRing = reinterpret_cast<uint8*>(CqRingMemory);
+	CqHead = reinterpret_cast<volatile uint32*>(CqRing + Params.CqOffsets.Head);
+	CqTail = reinterpret_cast<volatile uint32*>(CqRing + Params.CqOffsets.Tail);
+	Cqes = reinterpret_cast<FIoUringCqe*>(CqRing + Params.CqOffsets.Cqes);
+	CqRingMask = *reinterpret_cast<uint32*>(CqRing + Params.CqOffsets.RingMask);
+
+	const uint32 NumSlots = FMath::Min(QueueDepth, Params.SqEntries);
+	InFlightReads.SetNum(NumSlots);
+	FreeSlots.Reserve(NumSlots);
+	for (uint32 SlotIndex = NumSlots; SlotIndex > 0; --SlotIndex)
+	{
+		FreeSlots.Add(SlotIndex - 1);
+	}
+
+	// Sparse file tables need a 5.5 kernel, older ones just use plain file descriptors
+	TArray<int32> EmptyFileTable;
+	EmptyFileTable.Init(-1, MaxFixedFiles);
+	bUseFixedFiles = Register(RingFd, Register_Files, EmptyFileTable.GetData(), MaxFixedFiles) == 0;
+
+	UE_LOG(LogIoDispatcher, Log, TEXT("Using io_uring for IoStore reads (queue depth %u, fixed files %s)"), NumSlots, bUseFixedFiles ? TEXT("on") : TEXT("off"));
+	return true;
+}
+
+void FLinuxFileIoStoreImpl::ShutdownRing()
+{
+	if (Sqes)
+	{
+		munmap(Sqes, SqesMemorySize);
+		Sqes = nullptr;
+	}
+	if (CqRingMemory && CqRingMemory != SqRingMemory)
+	{
+		munmap(CqRingMemory, CqRingMemorySize);
+	}
+	CqRingMemory = nullptr;
+	if (SqRingMemory)
+	{
+		munmap(SqRingMemory, SqRingMemorySize);
+		SqRingMemory = nullptr;
+	}
+	if (RingFd >= 0)
+	{
+		close(RingFd);
+		RingFd = -1;
+	}
+
+	for (int32 Fd : OpenFiles)
+	{
+		close(Fd);
+	}
+	OpenFiles.Empty();
+}
+
+void FLinuxFileIoStoreImpl::RegisterBuffers()
+{
+	using namespace UE4LinuxIoUring_Private;
+
+	// The buffer memory is allocated when the store is initialized, after this has been constructed
+	bTriedRegisteringBuffers = true;
+
+	struct iovec BufferMemory;
+	BufferMemory.iov_base = BufferAllocator.GetBufferMemory();
+	BufferMemory.iov_len = BufferAllocator.GetBufferMemorySize();
+	if (!BufferMemory.iov_base || !BufferMemory.iov_len)
+	{
+		return;
+	}
+
+	// Registered buffers are pinned and count against RLIMIT_MEMLOCK, reads use READV instead when that is too low
+	if (Register(RingFd, Register_Buffers, &BufferMemory, 1) == 0)
+	{
+		RegisteredBufferMemory = BufferAllocator.GetBufferMemory();
+		RegisteredBufferMemorySize = BufferAllocator.GetBufferMemorySize();
+	}
+	else
+	{
+		UE_LOG(LogIoDispatcher, Log, TEXT("Failed registering %llu bytes of IoStore read buffers with io_uring (errno %d)"), BufferAllocator.GetBufferMemorySize(), errno);
+	}
+}
+
+bool FLinuxFileIoStoreImpl::OpenContainer(const TCHAR* ContainerFilePath, uint64& ContainerFileHandle, uint64& ContainerFileSize)
+{
+	using namespace UE4LinuxIoUring_Private;
+
+	if (!bUseIoUring)
+	{
+		return FallbackImpl.OpenContainer(ContainerFilePath, ContainerFileHandle, ContainerFileSize);
+	}
+
+	const FString FullPath = IPlatformFile::GetPlatformPhysical().ConvertToAbsolutePathForExternalAppForRead(ContainerFilePath);
+	const int32 Fd = open(TCHAR_TO_UTF8(*FullPath), O_RDONLY | O_CLOEXEC);
+	if (Fd < 0)
+	{
+		return false;
+	}
+
+	struct stat FileInfo;
+	if (fstat(Fd, &FileInfo) != 0)
+	{
+		close(Fd);
+		return false;
+	}
+
+	FScopeLock _(&FilesCritical);
+	int32 FixedIndex = -1;
+	if (bUseFixedFiles && OpenFiles.Num() < int32(MaxFixedFiles))
+	{
+		FFilesUpdate Update;
+		Update.Offset = uint32(OpenFiles.Num());
+		Update.Reserved = 0;
+		Update.Fds = uint64(UPTRINT(&Fd));
+		if (Register(RingFd, Register_FilesUpdate, &Update, 1) == 1)
+		{
+			FixedIndex = OpenFiles.Num();
+		}
+	}
+	OpenFiles.Add(Fd);
+
+	ContainerFileHandle = MakeFileHandle(Fd, FixedIndex);
+	ContainerFileSize = uint64(FileInfo.st_size);
+	return true;
+}
+
+void FLinuxFileIoStoreImpl::QueueRead(uint32 SlotIndex)
+{
+	using namespace UE4LinuxIoUring_Private;
+
+	FInFlightRead& Read = InFlightReads[SlotIndex];
+	const FFileIoStoreReadRequest* Request = Read.Request;
+	uint8* Dest = Read.Dest + Read.BytesRead;
+	const uint64 BytesLeft = Request->Size - Read.BytesRead;
+
+	// This thread is the only producer, so the tail only needs to be published after the entry is written
+	const uint32 Tail = *SqTail;
+	const uint32 Index = Tail & SqRingMask;
+	FIoUringSqe& Sqe = Sqes[Index];
+	FMemory::Memzero(Sqe);
+
+	const int32 FixedIndex = GetFixedFileIndex(Request->FileHandle);
+	if (FixedIndex >= 0)
+	{
+		Sqe.Fd = FixedIndex;
+		Sqe.Flags = SqeFlag_FixedFile;
+	}
+	else
+	{
+		Sqe.Fd = GetFileDescriptor(Request->FileHandle);
+	}
+	Sqe.Offset = Request->Offset + Read.BytesRead;
+	Sqe.UserData = SlotIndex;
+
+	if (RegisteredBufferMemory && Dest >= RegisteredBufferMemory && Dest + BytesLeft <= RegisteredBufferMemory + RegisteredBufferMemorySize)
+	{
+		Sqe.Opcode = Op_ReadFixed;
+		Sqe.Address = uint64(UPTRINT(Dest));
+		Sqe.Length = uint32(BytesLeft);
+		Sqe.BufferIndex = 0;
+	}
+	else
+	{
+		// Immediate scatters read straight into the request's own buffer, which isn't registered
+		Read.Vec.iov_base = Dest;
+		Read.Vec.iov_len = BytesLeft;
+		Sqe.Opcode = Op_ReadV;
+		Sqe.Address = uint64(UPTRINT(&Read.Vec));
+		Sqe.Length = 1;
+	}
+
+	SqArray[Index] = Index;
+	StoreRelease(SqTail, Tail + 1);
+	++NumUnsubmitted;
+}
+
+bool FLinuxFileIoStoreImpl::Submit(uint32 MinComplete)
+{
+	using namespace UE4LinuxIoUring_Private;
+
+	const uint32 Flags = MinComplete ? EnterFlag_GetEvents : 0;
+	for (;;)
+	{
+		const int Result = Enter(RingFd, NumUnsubmitted, MinComplete, Flags);
+		if (Result >= 0)
+		{
+			NumUnsubmitted -= FMath::Min(uint32(Result), NumUnsubmitted);
+			return true;
+		}
+		if (errno != EINTR && errno != EAGAIN)
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("io_uring_enter failed (errno %d)"), errno);
+			return false;
+		}
+	}
+}
+
+bool FLinuxFileIoStoreImpl::ReapCompletions()
+{
+	using namespace UE4LinuxIoUring_Private;
+
+	bool bCompletedAny = false;
+	uint32 Head = *CqHead;
+	const uint32 Tail = LoadAcquire(CqTail);
+	for (; Head != Tail; ++Head)
+	{
+		const FIoUringCqe& Cqe = Cqes[Head & CqRingMask];
+		const uint32 SlotIndex = uint32(Cqe.UserData);
+		FInFlightRead& Read = InFlightReads[SlotIndex];
+		FFileIoStoreReadRequest* Request = Read.Request;
+
+		if (Cqe.Result > 0)
+		{
+			Read.BytesRead += uint64(Cqe.Result);
+			if (Read.BytesRead < Request->Size)
+			{
+				// Short read, queue the rest
+				QueueRead(SlotIndex);
+				continue;
+			}
+			Request->bFailed = false;
+			BlockCache.Store(Request);
+		}
+		else if ((Cqe.Result == -EINTR || Cqe.Result == -EAGAIN) && Read.RetryCount++ < MaxRetries)
+		{
+			QueueRead(SlotIndex);
+			continue;
+		}
+		else
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Failed reading %lld bytes at offset %lld (error %d)"), Request->Size, Request->Offset, -Cqe.Result);
+			Request->bFailed = true;
+		}
+
+		Read.Request = nullptr;
+		FreeSlots.Add(SlotIndex);
+		AddCompletedRequest(Request);
+		bCompletedAny = true;
+	}
+	StoreRelease(CqHead, Head);
+
+	return bCompletedAny;
+}
+
+bool FLinuxFileIoStoreImpl::StartRequests(FFileIoStoreRequestQueue& RequestQueue)
+{
+	if (!bUseIoUring)
+	{
+		return FallbackImpl.StartRequests(RequestQueue);
+	}
+
+	if (!bTriedRegisteringBuffers)
+	{
+		RegisterBuffers();
+	}
+
+	bool bCompletedAny = false;
+	while (FreeSlots.Num() > 0)
+	{
+		FFileIoStoreReadRequest* NextRequest = RequestQueue.Pop();
+		if (!NextRequest)
+		{
+			break;
+		}
+
+		if (NextRequest->bCancelled)
+		{
+			AddCompletedRequest(NextRequest);
+			bCompletedAny = true;
+			continue;
+		}
+
+		uint8* Dest;
+		if (!NextRequest->ImmediateScatter.Request)
+		{
+			NextRequest->Buffer = BufferAllocator.AllocBuffer();
+			if (!NextRequest->Buffer)
+			{
+				RequestQueue.Push(*NextRequest);
+				break;
+			}
+			Dest = NextRequest->Buffer->Memory;
+		}
+		else
+		{
+			Dest = NextRequest->ImmediateScatter.Request->GetIoBuffer().Data() + NextRequest->ImmediateScatter.DstOffset;
+		}
+
+		if (BlockCache.Read(NextRequest))
+		{
+			AddCompletedRequest(NextRequest);
+			bCompletedAny = true;
+			continue;
+		}
+
+		const uint32 SlotIndex = FreeSlots.Pop(false);
+		FInFlightRead& Read = InFlightReads[SlotIndex];
+		Read.Request = NextRequest;
+		Read.Dest = Dest;
+		Read.BytesRead = 0;
+		Read.RetryCount = 0;
+		QueueRead(SlotIndex);
+	}
+
+	const bool bHasInFlightReads = FreeSlots.Num() < InFlightReads.Num();
+	if (bHasInFlightReads)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(ReadBlocksFromFile);
+
+		// Only block for a completion when nothing else could be done, more requests or buffers may be waiting on one
+		Submit(NumUnsubmitted || bCompletedAny ? 0 : 1);
+		bCompletedAny |= ReapCompletions();
+
+		// Send out retries and the rest of short reads queued while reaping
+		if (NumUnsubmitted)
+		{
+			Submit(0);
+		}
+	}
+
+	if (bCompletedAny)
+	{
+		EventQueue.DispatcherNotify();
+	}
+
+	return bCompletedAny || bHasInFlightReads;
+}
+
+void FLinuxFileIoStoreImpl::AddCompletedRequest(FFileIoStoreReadRequest* Request)
+{
+	FScopeLock _(&CompletedRequestsCritical);
+	CompletedRequests.Add(Request);
+}
+
+void FLinuxFileIoStoreImpl::GetCompletedRequests(FFileIoStoreReadRequestList& OutRequests)
+{
+	if (!bUseIoUring)
+	{
+		FallbackImpl.GetCompletedRequests(OutRequests);
+		return;
+	}
+
+	FScopeLock _(&CompletedRequestsCritical);
+	OutRequests.Append(CompletedRequests);
+	CompletedRequests.Clear();
+}
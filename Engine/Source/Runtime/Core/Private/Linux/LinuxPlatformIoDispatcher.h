@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GenericPlatform/GenericPlatformIoDispatcher.h"
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+#include "IO/IoDispatcherFileBackendTypes.h"
+#include <sys/uio.h>
+
+typedef FGenericIoDispatcherEventQueue FIoDispatcherEventQueue;
+
+struct FIoUringSqe;
+struct FIoUringCqe;
+
+/**
+ * IoStore file backend reading container files through an io_uring submission/completion ring.
+ *
+ * The service thread queues up to a fixed number of reads at once and reaps their completions itself, so reads
+ * overlap without a thread per request. Container files are registered as fixed files and the read buffer memory
+ * as a registered buffer when the kernel and the memlock limit allow it. If io_uring isn't available at all, or
+ * -NoIoUring is on the command line, all calls are forwarded to the generic blocking implementation.
+ */
+class FLinuxFileIoStoreImpl
+{
+public:
+	FLinuxFileIoStoreImpl(FGenericIoDispatcherEventQueue& InEventQueue, FFileIoStoreBufferAllocator& InBufferAllocator, FFileIoStoreBlockCache& InBlockCache);
+	~FLinuxFileIoStoreImpl();
+	bool OpenContainer(const TCHAR* ContainerFilePath, uint64& ContainerFileHandle, uint64& ContainerFileSize);
+	bool CreateCustomRequests(FFileIoStoreRequestAllocator& RequestAllocator, FFileIoStoreResolvedRequest& ResolvedRequest, FFileIoStoreReadRequestList& OutRequests)
+	{
+		return false;
+	}
+	bool StartRequests(FFileIoStoreRequestQueue& RequestQueue);
+	void GetCompletedRequests(FFileIoStoreReadRequestList& OutRequests);
+
+private:
+	struct FInFlightRead
+	{
+		FFileIoStoreReadRequest* Request = nullptr;
+		uint8* Dest = nullptr;
+		uint64 BytesRead = 0;
+		uint32 RetryCount = 0;
+		struct iovec Vec;
+	};
+
+	bool InitializeRing();
+	void ShutdownRing();
+	void RegisterBuffers();
+	void QueueRead(uint32 SlotIndex);
+	bool Submit(uint32 MinComplete);
+	bool ReapCompletions();
+	void AddCompletedRequest(FFileIoStoreReadRequest* Request);
+
+	FGenericIoDispatcherEventQueue& EventQueue;
+	FFileIoStoreBufferAllocator& BufferAllocator;
+	FFileIoStoreBlockCache& BlockCache;
+	FGenericFileIoStoreImpl FallbackImpl;
+	bool bUseIoUring = false;
+
+	int32 RingFd = -1;
+	void* SqRingMemory = nullptr;
+	SIZE_T SqRingMemorySize = 0;
+	void* CqRingMemory = nullptr;
+	SIZE_T CqRingMemorySize = 0;
+	FIoUringSqe* Sqes = nullptr;
+	SIZE_T SqesMemorySize = 0;
+	volatile uint32* SqHead = nullptr;
+	volatile uint32* SqTail = nullptr;
+	uint32* SqArray = nullptr;
+	uint32 SqRingMask = 0;
+	volatile uint32* CqHead = nullptr;
+	volatile uint32* CqTail = nullptr;
+	FIoUringCqe* Cqes = nullptr;
+	uint32 CqRingMask = 0;
+
+	TArray<FInFlightRead> InFlightReads;
+	TArray<uint32> FreeSlots;
+	uint32 NumUnsubmitted = 0;
+
+	uint8* RegisteredBufferMemory = nullptr;
+	uint64 RegisteredBufferMemorySize = 0;
+	bool bTriedRegisteringBuffers = false;
+
+	FCriticalSection FilesCritical;
+	TArray<int32> OpenFiles;
+	bool bUseFixedFiles = false;
+
+	FCriticalSection CompletedRequestsCritical;
+	FFileIoStoreReadRequestList CompletedRequests;
+};
+
+typedef FLinuxFileIoStoreImpl FFileIoStoreImpl;
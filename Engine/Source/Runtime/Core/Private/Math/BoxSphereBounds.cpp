@@ -58,6 +58,64 @@ FBoxSphereBounds FBoxSphereBounds::TransformBy(const FMatrix& M) const
 	return Result;
 }
 
+void FBoxSphereBounds::TransformByBatch(const FMatrix* Matrices, FBoxSphereBounds* OutBounds, int32 Num) const
+{
+	const VectorRegister VecOrigin = VectorLoadFloat3(&Origin);
+	const VectorRegister VecExtent = VectorLoadFloat3(&BoxExtent);
+
+	// Replicated once for the whole batch rather than once per matrix
+	const VectorRegister Origin0 = VectorReplicate(VecOrigin, 0);
+	const VectorRegister Origin1 = VectorReplicate(VecOrigin, 1);
+	const VectorRegister Origin2 = VectorReplicate(VecOrigin, 2);
+	const VectorRegister Extent0 = VectorReplicate(VecExtent, 0);
+	const VectorRegister Extent1 = VectorReplicate(VecExtent, 1);
+	const VectorRegister Extent2 = VectorReplicate(VecExtent, 2);
+
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		const FMatrix& M = Matrices[Index];
+		FBoxSphereBounds& Result = OutBounds[Index];
+
+#if ENABLE_NAN_DIAGNOSTIC
+		if (M.ContainsNaN())
+		{
+			logOrEnsureNanError(TEXT("Input Matrix contains NaN/Inf! %s"), *M.ToString());
+			Result = TransformBy(FMatrix::Identity);
+			continue;
+		}
+#endif
+
+		const VectorRegister m0 = VectorLoadAligned(M.M[0]);
+		const VectorRegister m1 = VectorLoadAligned(M.M[1]);
+		const VectorRegister m2 = VectorLoadAligned(M.M[2]);
+		const VectorRegister m3 = VectorLoadAligned(M.M[3]);
+
+		VectorRegister NewOrigin = VectorMultiply(Origin0, m0);
+		NewOrigin = VectorMultiplyAdd(Origin1, m1, NewOrigin);
+		NewOrigin = VectorMultiplyAdd(Origin2, m2, NewOrigin);
+		NewOrigin = VectorAdd(NewOrigin, m3);
+
+		VectorRegister NewExtent = VectorAbs(VectorMultiply(Extent0, m0));
+		NewExtent = VectorAdd(NewExtent, VectorAbs(VectorMultiply(Extent1, m1)));
+		NewExtent = VectorAdd(NewExtent, VectorAbs(VectorMultiply(Extent2, m2)));
+
+		VectorStoreFloat3(NewExtent, &Result.BoxExtent);
+		VectorStoreFloat3(NewOrigin, &Result.Origin);
+
+		VectorRegister MaxRadius = VectorMultiply(m0, m0);
+		MaxRadius = VectorMultiplyAdd(m1, m1, MaxRadius);
+		MaxRadius = VectorMultiplyAdd(m2, m2, MaxRadius);
+		MaxRadius = VectorMax(VectorMax(MaxRadius, VectorReplicate(MaxRadius, 1)), VectorReplicate(MaxRadius, 2));
+		Result.SphereRadius = FMath::Sqrt(VectorGetComponent(MaxRadius, 0)) * SphereRadius;
+
+		// For non-uniform scaling, computing sphere radius from a box results in a smaller sphere.
+		float const BoxExtentMagnitude = FMath::Sqrt(VectorGetComponent(VectorDot3(NewExtent, NewExtent), 0));
+		Result.SphereRadius = FMath::Min(Result.SphereRadius, BoxExtentMagnitude);
+
+		Result.DiagnosticCheckNaN();
+	}
+}
+
 FBoxSphereBounds FBoxSphereBounds::TransformBy(const FTransform& M) const
 {
 #if ENABLE_NAN_DIAGNOSTIC
@@ -19,6 +19,7 @@
 #include "Misc/ConfigManifest.h"
 #include "Misc/DataDrivenPlatformInfoRegistry.h"
 #include "Misc/StringBuilder.h"
+#include "Misc/SecureHash.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/LargeMemoryReader.h"
@@ -3945,6 +3946,114 @@ bool FConfigCacheIni::CreateGConfigFromSaved(const TCHAR* Filename)
 	return true;
 }
 
+namespace ConfigStartupCache
+{
+	static const uint32 Magic = 0x43464743; // CGFC
+	static const int32 Version = 1;
+}
+
+void FConfigCacheIni::GatherStartupCacheDependencies(FArchive& Ar) const
+{
+	check(Ar.IsSaving());
+
+	const FString ExecutablePath = FPlatformProcess::ExecutablePath();
+	FDateTime ExecutableTimeStamp = IFileManager::Get().GetTimeStamp(*ExecutablePath);
+	int64 ExecutableSize = IFileManager::Get().FileSize(*ExecutablePath);
+	uint32 CommandLineHash = FCrc::StrCrc32(FCommandLine::GetOriginal());
+	Ar << ExecutableTimeStamp << ExecutableSize << CommandLineHash;
+
+	// Files missing from the hierarchies are hashed too, with an invalid hash, so the cache is dropped once they're added
+	TArray<FString> SourceFilenames;
+	for (const TPair<FString, FConfigFile>& Pair : *this)
+	{
+		for (const TPair<int32, FIniFilename>& Layer : Pair.Value.SourceIniHierarchy)
+		{
+			SourceFilenames.AddUnique(Layer.Value.Filename);
+		}
+	}
+	SourceFilenames.Sort();
+
+	TArray<uint8> ScratchBuffer;
+	for (FString& SourceFilename : SourceFilenames)
+	{
+		FMD5Hash Hash = FMD5Hash::HashFile(*SourceFilename, &ScratchBuffer);
+		Ar << SourceFilename << Hash;
+	}
+}
+
+void FConfigCacheIni::SaveStartupCache(const FString& Filename)
+{
+	TArray<uint8> FileContent;
+	{
+		FMemoryWriter MemoryWriter(FileContent, true);
+
+		uint32 Magic = ConfigStartupCache::Magic;
+		int32 Version = ConfigStartupCache::Version;
+		MemoryWriter << Magic << Version;
+
+		TArray<uint8> Dependencies;
+		FMemoryWriter DependencyWriter(Dependencies);
+		GatherStartupCacheDependencies(DependencyWriter);
+		MemoryWriter << Dependencies;
+
+		// The bootstrap state leaves out the names of the ini files added after it
+		SerializeStateForBootstrap_Impl(MemoryWriter);
+		MemoryWriter << GInstallBundleIni << GDeviceProfilesIni << GGameplayTagsIni;
+	}
+
+	if (FFileHelper::SaveArrayToFile(FileContent, *Filename))
+	{
+		UE_LOG(LogConfig, Log, TEXT("Saved config startup cache %s (%d bytes)"), *Filename, FileContent.Num());
+	}
+}
+
+bool FConfigCacheIni::CreateGConfigFromStartupCache(const FString& Filename)
+{
+	SCOPED_BOOT_TIMING("FConfigCacheIni::CreateGConfigFromStartupCache");
+
+	TArray<uint8> FileContent;
+	if (!FFileHelper::LoadFileToArray(FileContent, *Filename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader MemoryReader(FileContent, true);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	TArray<uint8> SavedDependencies;
+	MemoryReader << Magic << Version;
+	if (Magic != ConfigStartupCache::Magic || Version != ConfigStartupCache::Version)
+	{
+		return false;
+	}
+	MemoryReader << SavedDependencies;
+
+	FConfigCacheIni* CachedConfig = new FConfigCacheIni(EConfigCacheType::Temporary);
+	CachedConfig->SerializeStateForBootstrap_Impl(MemoryReader);
+	MemoryReader << GInstallBundleIni << GDeviceProfilesIni << GGameplayTagsIni;
+
+	// The hierarchies in the cache tell which files to check
+	TArray<uint8> CurrentDependencies;
+	FMemoryWriter DependencyWriter(CurrentDependencies);
+	CachedConfig->GatherStartupCacheDependencies(DependencyWriter);
+
+	if (MemoryReader.IsError() || CurrentDependencies != SavedDependencies)
+	{
+		UE_LOG(LogConfig, Log, TEXT("Config startup cache %s is out of date"), *Filename);
+		delete CachedConfig;
+		return false;
+	}
+
+	UE_LOG(LogInit, Display, TEXT("Loading GConfig from startup cache %s"), *Filename);
+
+	GConfig = CachedConfig;
+	GConfig->Type = EConfigCacheType::DiskBacked;
+	GConfig->bIsReadyForUse = true;
+	FCoreDelegates::ConfigReadyForUse.Broadcast();
+	return true;
+}
+
 void FConfigCacheIni::InitializeConfigSystem()
 {
 #if PLATFORM_SUPPORTS_BINARYCONFIG
@@ -3983,6 +4092,14 @@ void FConfigCacheIni::InitializeConfigSystem()
 		}
 	}
 
+	// The editor upgrades and migrates its user settings while loading, so only games and servers use the cache
+	const bool bUseStartupCache = !WITH_EDITOR && FParse::Param(FCommandLine::Get(), TEXT("ConfigCache"));
+	const FString StartupCacheFilename = FPaths::Combine(FPaths::GeneratedConfigDir(), TEXT("ConfigCache.bin"));
+	if (bUseStartupCache && CreateGConfigFromStartupCache(StartupCacheFilename))
+	{
+		return;
+	}
+
 	UE_LOG(LogInit, Display, TEXT("Loading text-based GConfig...."));
 
 	// Perform any upgrade we need before we load any configuration files
@@ -4069,6 +4186,12 @@ void FConfigCacheIni::InitializeConfigSystem()
 
 	// now we can make use of GConfig
 	GConfig->bIsReadyForUse = true;
+
+	if (bUseStartupCache)
+	{
+		GConfig->SaveStartupCache(StartupCacheFilename);
+	}
+
 	FCoreDelegates::ConfigReadyForUse.Broadcast();
 }
 
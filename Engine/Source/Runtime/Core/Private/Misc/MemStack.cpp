@@ -6,12 +6,15 @@
 #include "Stats/Stats.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/CoreDelegates.h"
+#include "HAL/LowLevelMemTracker.h"
 #include <atomic>
 
 DECLARE_MEMORY_STAT(TEXT("MemStack Large Block"), STAT_MemStackLargeBLock,STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("PageAllocator Free"), STAT_PageAllocatorFree, STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("PageAllocator Used"), STAT_PageAllocatorUsed, STATGROUP_Memory);
 
+LLM_DEFINE_TAG(FrameMemStack);
+
 FPageAllocator& FPageAllocator::Get()
 {
 	static std::atomic<FPageAllocator*> ThePageAllocator;
@@ -375,4 +378,59 @@ bool FMemStackBase::ContainsPointer(const void* Pointer) const
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+/*-----------------------------------------------------------------------------
+	FFrameMemStack implementation.
+-----------------------------------------------------------------------------*/
+
+FFrameMemStack::FFrameMemStack()
+	: Stacks{ 0, 0 }
+	, StackFrames{ MAX_uint64, MAX_uint64 }
+	, CurrentFrame(MAX_uint64)
+{
+}
+
+void FFrameMemStack::BeginFrame(uint64 FrameCounter)
+{
+	const int32 StackIndex = (int32)(FrameCounter & 1);
+
+	// The stack for this frame parity was last used two or more frames ago, so its allocations are no longer valid
+	if (StackFrames[StackIndex] != FrameCounter)
+	{
+		Stacks[StackIndex].FreeChunks(nullptr);
+		StackFrames[StackIndex] = FrameCounter;
+	}
+
+	// If this thread skipped a frame, the other stack is stale as well
+	const int32 OtherIndex = StackIndex ^ 1;
+	if (StackFrames[OtherIndex] != MAX_uint64 && StackFrames[OtherIndex] + 1 < FrameCounter)
+	{
+		Stacks[OtherIndex].FreeChunks(nullptr);
+		StackFrames[OtherIndex] = MAX_uint64;
+	}
+
+	CurrentFrame = FrameCounter;
+}
+
+void* FFrameMemStack::AllocSlow(FMemStackBase& Stack, int32 AllocSize, int32 Alignment)
+{
+	LLM_SCOPE_BYTAG(FrameMemStack);
+
+	Stack.AllocateNewChunk(AllocSize + Alignment);
+
+	uint8* Result = Align(Stack.Top, Alignment);
+	Stack.Top = Result + AllocSize;
+
+	return Result;
+}
+
+int32 FFrameMemStack::GetByteCount() const
+{
+	return Stacks[0].GetByteCount() + Stacks[1].GetByteCount();
+}
+
+bool FFrameMemStack::ContainsPointer(const void* Pointer) const
+{
+	return Stacks[0].ContainsPointer(Pointer) || Stacks[1].ContainsPointer(Pointer);
+}
@@ -116,6 +116,7 @@ FModuleManager::~FModuleManager()
 IModuleInterface* FModuleManager::GetModulePtr_Internal(FName ModuleName)
 {
 	FModuleManager& ModuleManager = FModuleManager::Get();
+	ModuleManager.LoadIfDeferred(ModuleName);
 
 	ModuleInfoPtr ModuleInfo = ModuleManager.FindModule(ModuleName);
 	if (!ModuleInfo.IsValid())
@@ -132,6 +133,32 @@ IModuleInterface* FModuleManager::GetModulePtr_Internal(FName ModuleName)
 	return ModuleInfo->Module.Get();
 }
 
+void FModuleManager::AddDeferredModule(const FName InModuleName)
+{
+	check(IsInGameThread());
+
+	if (!IsModuleLoaded(InModuleName))
+	{
+		UE_LOG(LogModuleManager, Verbose, TEXT("Deferring startup of module '%s' to its first use"), *InModuleName.ToString());
+		DeferredModules.Add(InModuleName);
+	}
+}
+
+bool FModuleManager::IsModuleDeferred(const FName InModuleName) const
+{
+	return IsInGameThread() && DeferredModules.Contains(InModuleName);
+}
+
+void FModuleManager::LoadIfDeferred(const FName InModuleName)
+{
+	// Other threads can't load modules, they only see a deferred module once the game thread used it
+	if (DeferredModules.Num() > 0 && IsInGameThread() && DeferredModules.Remove(InModuleName) > 0)
+	{
+		UE_LOG(LogModuleManager, Log, TEXT("Loading deferred module '%s' on first use"), *InModuleName.ToString());
+		LoadModule(InModuleName);
+	}
+}
+
 void FModuleManager::FindModules(const TCHAR* WildcardWithoutExtension, TArray<FName>& OutModules) const
 {
 	// @todo plugins: Try to convert existing use cases to use plugins, and get rid of this function
@@ -368,6 +395,12 @@ IModuleInterface* FModuleManager::LoadModuleWithFailureReason(const FName InModu
 	ensureMsgf(IsInGameThread(), TEXT("ModuleManager: Attempting to load '%s' outside the main thread.  Please call LoadModule on the main/game thread only.  You can use GetModule or GetModuleChecked instead, those are safe to call outside the game thread."), *InModuleName.ToString());
 #endif
 
+	// An explicit load starts a deferred module for good
+	if (DeferredModules.Num() > 0 && IsInGameThread())
+	{
+		DeferredModules.Remove(InModuleName);
+	}
+
 	IModuleInterface* LoadedModule = nullptr;
 	OutFailureReason = EModuleLoadResult::Success;
 
@@ -735,6 +768,8 @@ void FModuleManager::UnloadModulesAtShutdown()
 
 IModuleInterface* FModuleManager::GetModule( const FName InModuleName )
 {
+	LoadIfDeferred(InModuleName);
+
 	// Do we even know about this module?
 	ModuleInfoPtr ModuleInfo = FindModule(InModuleName);
 
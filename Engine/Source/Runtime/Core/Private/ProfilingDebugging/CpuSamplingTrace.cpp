@@ -0,0 +1,187 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "ProfilingDebugging/CpuSamplingTrace.h"
+
+#if CPUSAMPLINGTRACE_ENABLED
+
+#include "Containers/Set.h"
+#include "CoreGlobals.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformStackWalk.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/CString.h"
+#include "Templates/Atomic.h"
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL(CpuSamplingChannel)
+
+// One callstack of a thread. The attachment is the array of uint64 program counters, innermost frame first.
+UE_TRACE_EVENT_BEGIN(CpuSampling, Sample)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, SystemThreadId)
+UE_TRACE_EVENT_END()
+
+// Sent the first time an address is seen in a sample. The attachment is the ANSI "Module!Function" name.
+UE_TRACE_EVENT_BEGIN(CpuSampling, Symbol)
+	UE_TRACE_EVENT_FIELD(uint64, Address)
+UE_TRACE_EVENT_END()
+
+static int32 GCpuSamplingRate = 200;
+static FAutoConsoleVariableRef CVarCpuSamplingRate(
+	TEXT("Trace.CpuSampling.Rate"),
+	GCpuSamplingRate,
+	TEXT("Number of times per second each thread's callstack is sampled while the CpuSampling trace channel is enabled.")
+);
+
+class FCpuSamplingThread : public FRunnable
+{
+public:
+	FCpuSamplingThread()
+		: bStopRequested(false)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("CpuSamplingTrace"), 64 * 1024, TPri_AboveNormal);
+	}
+
+	virtual ~FCpuSamplingThread()
+	{
+		if (Thread != nullptr)
+		{
+			Thread->Kill(true);
+			delete Thread;
+		}
+	}
+
+	virtual bool Init() override
+	{
+		FPlatformStackWalk::InitStackWalking();
+		return true;
+	}
+
+	virtual uint32 Run() override
+	{
+		const uint32 SamplerThreadId = FPlatformTLS::GetCurrentThreadId();
+
+		// Refresh the thread list periodically rather than for every sample, it means taking the thread manager's lock.
+		const int32 ThreadListRefreshInterval = 64;
+		int32 SamplesUntilRefresh = 0;
+
+		while (!bStopRequested)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+
+			if (SamplesUntilRefresh-- <= 0)
+			{
+				ThreadIds.Reset();
+				ThreadIds.Add(GGameThreadId);
+				FThreadManager::Get().ForEachThread([this, SamplerThreadId](uint32 ThreadId, FRunnableThread*)
+				{
+					if (ThreadId != SamplerThreadId && ThreadId != GGameThreadId)
+					{
+						ThreadIds.Add(ThreadId);
+					}
+				});
+				SamplesUntilRefresh = ThreadListRefreshInterval;
+			}
+
+			for (uint32 ThreadId : ThreadIds)
+			{
+				SampleThread(ThreadId);
+			}
+
+			const double Interval = 1.0 / FMath::Clamp(GCpuSamplingRate, 1, 10000);
+			const double Remaining = Interval - (FPlatformTime::Seconds() - StartTime);
+			FPlatformProcess::SleepNoStats(float(FMath::Max(Remaining, 0.0)));
+		}
+
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopRequested = true;
+	}
+
+private:
+	void SampleThread(uint32 ThreadId)
+	{
+		const uint32 MaxFrames = 64;
+		uint64 Frames[MaxFrames];
+		const uint64 Cycle = FPlatformTime::Cycles64();
+		const uint32 NumFrames = FPlatformStackWalk::CaptureThreadStackBackTrace(ThreadId, Frames, MaxFrames);
+		if (NumFrames == 0)
+		{
+			return;
+		}
+
+		// Symbols are resolved here once per address so that the trace can be read without the binaries' symbols.
+		for (uint32 Index = 0; Index < NumFrames; ++Index)
+		{
+			bool bAlreadyKnown = false;
+			KnownAddresses.Add(Frames[Index], &bAlreadyKnown);
+			if (!bAlreadyKnown)
+			{
+				TraceSymbol(Frames[Index]);
+			}
+		}
+
+		const uint16 FramesSize = uint16(NumFrames * sizeof(uint64));
+		UE_TRACE_LOG(CpuSampling, Sample, CpuSamplingChannel, FramesSize)
+			<< Sample.Cycle(Cycle)
+			<< Sample.SystemThreadId(ThreadId)
+			<< Sample.Attachment(Frames, FramesSize);
+	}
+
+	static void TraceSymbol(uint64 Address)
+	{
+		FProgramCounterSymbolInfo SymbolInfo;
+		FPlatformStackWalk::ProgramCounterToSymbolInfo(Address, SymbolInfo);
+
+		ANSICHAR Name[512];
+		if (SymbolInfo.FunctionName[0] != '\0')
+		{
+			FCStringAnsi::Snprintf(Name, sizeof(Name), "%s!%s", SymbolInfo.ModuleName, SymbolInfo.FunctionName);
+		}
+		else
+		{
+			FCStringAnsi::Snprintf(Name, sizeof(Name), "%s!0x%llx", SymbolInfo.ModuleName, (unsigned long long)Address);
+		}
+
+		const uint16 NameSize = uint16(FCStringAnsi::Strlen(Name) + 1);
+		UE_TRACE_LOG(CpuSampling, Symbol, CpuSamplingChannel, NameSize)
+			<< Symbol.Address(Address)
+			<< Symbol.Attachment(Name, NameSize);
+	}
+
+	FRunnableThread* Thread;
+	TAtomic<bool> bStopRequested;
+	TArray<uint32> ThreadIds;
+	TSet<uint64> KnownAddresses;
+};
+
+static FCpuSamplingThread* GCpuSamplingThread = nullptr;
+
+void FCpuSamplingTrace::Update()
+{
+	const bool bEnabled = UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuSamplingChannel) && FPlatformProcess::SupportsMultithreading();
+	if (bEnabled && GCpuSamplingThread == nullptr)
+	{
+		GCpuSamplingThread = new FCpuSamplingThread();
+	}
+	else if (!bEnabled && GCpuSamplingThread != nullptr)
+	{
+		// A new thread is created when re-enabled, which also resends all symbols to whoever is now listening.
+		Shutdown();
+	}
+}
+
+void FCpuSamplingTrace::Shutdown()
+{
+	delete GCpuSamplingThread;
+	GCpuSamplingThread = nullptr;
+}
+
+#endif // CPUSAMPLINGTRACE_ENABLED
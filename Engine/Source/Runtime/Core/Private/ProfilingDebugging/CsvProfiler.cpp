@@ -6,6 +6,7 @@
 */
 
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CsvProfilerBinary.h"
 #include "CoreGlobals.h"
 #include "HAL/RunnableThread.h"
 #include "HAL/ThreadManager.h"
@@ -28,6 +29,9 @@
 #include "Misc/Compression.h"
 #include "Misc/Fork.h"
 #include "Misc/Guid.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MemoryWriter.h"
 
 #include "HAL/PlatformMisc.h"
 
@@ -126,6 +130,22 @@ TAutoConsoleVariable<int32> CVarCsvWriteBufferSize(
 	ECVF_Default
 );
 
+TAutoConsoleVariable<int32> CVarCsvWriteBinary(
+	TEXT("csv.WriteBinary"),
+	0,
+	TEXT("If 1, captures are written in the binary columnar .csvbin format, which is smaller and cheaper to write than text.\r\n")
+	TEXT("Convert them back to .csv with the CsvConvert program or the \"CsvProfile CONVERT <file>\" command."),
+	ECVF_Default
+);
+
+static bool GCsvParallelProcessing = true;
+static FAutoConsoleVariableRef CVarCsvParallelProcessing(
+	TEXT("csv.ParallelProcessing"),
+	GCsvParallelProcessing,
+	TEXT("If true, the per-thread stat data is processed in parallel on task graph workers rather than on the CSV processing thread alone."),
+	ECVF_Default
+);
+
 static bool GCsvUseProcessingThread = true;
 static int32 GCsvRepeatCount = 0;
 static int32 GCsvRepeatFrameCount = 0;
@@ -160,6 +180,9 @@ static bool GCsvExitOnCompletion = false;
 
 static thread_local bool GCsvThreadLocalWaitsEnabled = false;
 
+// Set on task graph workers while they process thread data on behalf of the CSV processing thread
+static thread_local bool GCsvIsParallelProcessingWorker = false;
+
 bool IsContinuousWriteEnabled(bool bGameThread)
 {
 	int CVarValue = -1;
@@ -471,6 +494,11 @@ int32 FCsvProfiler::RegisterCategory(const FString& CategoryName, bool bEnableBy
 
 bool IsInCsvProcessingThread()
 {
+	if (GCsvIsParallelProcessingWorker)
+	{
+		return true;
+	}
+
 	uint32 ProcessingThreadId = GGameThreadIsCsvProcessingThread ? GGameThreadId : GCsvProcessingThreadId;
 	return FPlatformTLS::GetCurrentThreadId() == ProcessingThreadId;
 }
@@ -499,6 +527,20 @@ static void HandleCSVProfileCommand(const TArray<FString>& Args)
 	{
 		GCsvExitOnCompletion = true;
 	}
+	else if (Param == TEXT("CONVERT"))
+	{
+		// csvprofile convert <file.csvbin> [output.csv]
+		if (Args.Num() < 2)
+		{
+			UE_LOG(LogCsvProfiler, Warning, TEXT("Usage: CsvProfile CONVERT <BinaryFile> [TextFile]"));
+			return;
+		}
+		const FString TextFilename = Args.Num() > 2 ? Args[2] : FPaths::ChangeExtension(Args[1], TEXT(".csv"));
+		if (FCsvBinaryFormat::ConvertToText(*Args[1], *TextFilename))
+		{
+			UE_LOG(LogCsvProfiler, Display, TEXT("Converted %s to %s"), *Args[1], *TextFilename);
+		}
+	}
 	else
 	{
 		int32 CaptureFrames = 0;
@@ -771,32 +813,41 @@ public:
 			const_cast<FFrameBoundaries*>(this)->Update(Timeline);
 		}
 
+		return GetFrameNumberForTimestamp(Timeline, Timestamp, CurrentReadFrameIndex);
+	}
+
+	/**
+	 * Version which doesn't fetch new frame boundaries and uses the caller's read position, so that it can be called
+	 * concurrently. Call Update() first.
+	 */
+	int32 GetFrameNumberForTimestamp(ECsvTimeline::Type Timeline, uint64 Timestamp, int32& InOutReadFrameIndex) const
+	{
 		const TArray<uint64>& ThreadTimestamps = FrameBoundaryTimestamps[Timeline];
 		if (ThreadTimestamps.Num() == 0 || Timestamp < ThreadTimestamps[0])
 		{
 			// This timestamp is before the first frame, or there are no valid timestamps
-			CurrentReadFrameIndex = 0;
+			InOutReadFrameIndex = 0;
 			return -1;
 		}
 
-		if (CurrentReadFrameIndex >= ThreadTimestamps.Num())
+		if (InOutReadFrameIndex >= ThreadTimestamps.Num())
 		{
-			CurrentReadFrameIndex = ThreadTimestamps.Num() - 1;
+			InOutReadFrameIndex = ThreadTimestamps.Num() - 1;
 		}
 
 
 		// Check if we need to rewind
-		if (CurrentReadFrameIndex > 0 && ThreadTimestamps[CurrentReadFrameIndex - 1] > Timestamp)
+		if (InOutReadFrameIndex > 0 && ThreadTimestamps[InOutReadFrameIndex - 1] > Timestamp)
 		{
 			// Binary search to < 4 and then resume linear searching
 			int32 StartPos = 0;
-			int32 EndPos = CurrentReadFrameIndex;
+			int32 EndPos = InOutReadFrameIndex;
 			while (true)
 			{
 				int32 Diff = (EndPos - StartPos);
 				if (Diff <= 4)
 				{
-					CurrentReadFrameIndex = StartPos;
+					InOutReadFrameIndex = StartPos;
 					break;
 				}
 				int32 MidPos = (EndPos + StartPos) / 2;
@@ -811,12 +862,12 @@ public:
 			}
 		}
 
-		for (; CurrentReadFrameIndex < ThreadTimestamps.Num(); CurrentReadFrameIndex++)
+		for (; InOutReadFrameIndex < ThreadTimestamps.Num(); InOutReadFrameIndex++)
 		{
-			if (Timestamp < ThreadTimestamps[CurrentReadFrameIndex])
+			if (Timestamp < ThreadTimestamps[InOutReadFrameIndex])
 			{
 				// Might return -1 if this was before the first frame
-				return CurrentReadFrameIndex - 1;
+				return InOutReadFrameIndex - 1;
 			}
 		}
 		return ThreadTimestamps.Num() - 1;
@@ -843,7 +894,6 @@ public:
 		FrameBoundaryTimestampsWriteBuffer[Timeline].CommitElement();
 	}
 
-private:
 	void Update(ECsvTimeline::Type Timeline = ECsvTimeline::Count)
 	{
 		check(IsInCsvProcessingThread());
@@ -860,6 +910,8 @@ private:
 		}
 	}
 
+private:
+
 	TSingleProducerSingleConsumerList<uint64, 16> FrameBoundaryTimestampsWriteBuffer[ECsvTimeline::Count];
 	TArray<uint64> FrameBoundaryTimestamps[ECsvTimeline::Count];
 	mutable int32 CurrentReadFrameIndex;
@@ -870,11 +922,15 @@ static FFrameBoundaries GFrameBoundaries;
 static TMap<const ANSICHAR*, uint32> CharPtrToStringIndex;
 static TMap<FString, uint32> UniqueNonFNameStatIDStrings;
 static TArray<FString> UniqueNonFNameStatIDIndices;
+static FCriticalSection AnsiStringRegisterCS;
 
 struct FAnsiStringRegister
 {
+	// Only used when a data processor sees a stat for the first time, but processors can run in parallel
 	static uint32 GetUniqueStringIndex(const ANSICHAR* AnsiStr)
 	{
+		FScopeLock Lock(&AnsiStringRegisterCS);
+
 		uint32* IndexPtr = CharPtrToStringIndex.Find(AnsiStr);
 		if (IndexPtr)
 		{
@@ -900,6 +956,7 @@ struct FAnsiStringRegister
 
 	static FString GetString(uint32 Index)
 	{
+		FScopeLock Lock(&AnsiStringRegisterCS);
 		return UniqueNonFNameStatIDIndices[Index];
 	}
 };
@@ -1165,17 +1222,29 @@ struct FCsvStatSeriesValue
 class FCsvWriterHelper
 {
 public:
-	FCsvWriterHelper(const TSharedRef<FArchive>& InOutputFile, int32 InBufferSize, bool bInCompressOutput)
+	/**
+	 * @param bInBinaryBlocks	Write each flushed buffer as a block prefixed by its sizes, compressed with zlib rather than
+	 *							as a gzip member. Used by the binary format, see FCsvBinaryFormat.
+	 */
+	FCsvWriterHelper(const TSharedRef<FArchive>& InOutputFile, int32 InBufferSize, bool bInCompressOutput, bool bInBinaryBlocks = false)
 		: OutputFile(InOutputFile)
 		, bIsLineStart(true)
+		, bCompressOutput(bInCompressOutput && InBufferSize > 0)
+		, bBinaryBlocks(bInBinaryBlocks)
 		, BytesInBuffer(0)
 	{
 		if (InBufferSize > 0)
 		{
 			Buffer.SetNumUninitialized(InBufferSize);
-			if (bInCompressOutput)
+			if (bCompressOutput)
 			{
 				GZipBuffer.SetNumUninitialized(InBufferSize);
+
+				// Compression happens on a worker, so it needs a second buffer to keep filling in the meantime
+				if (FPlatformProcess::SupportsMultithreading() && GThreadPool != nullptr)
+				{
+					FlushBuffer.SetNumUninitialized(InBufferSize);
+				}
 			}
 		}
 	}
@@ -1183,6 +1252,12 @@ public:
 	~FCsvWriterHelper()
 	{
 		Flush();
+		WaitForPendingFlush();
+	}
+
+	void WriteBinary(const void* Data, int32 NumBytes)
+	{
+		SerializeInternal(const_cast<void*>(Data), NumBytes);
 	}
 
 	void WriteSemicolonSeparatedStringList(const TArray<FString>& Strings)
@@ -1307,65 +1382,100 @@ private:
 	{
 		if (BytesInBuffer > 0)
 		{
-			if (GZipBuffer.Num() > 0)
+			if (bCompressOutput && FlushBuffer.Num() > 0)
 			{
-				// Compression is enabled.
-				int32 CompressedSize;
-				{
-					while (true)
-					{
-						// Compress the data in Buffer into the GZipBuffer array
-						CompressedSize = GZipBuffer.Num();
-						if (FCompression::CompressMemory(
-							NAME_Gzip,
-							GZipBuffer.GetData(), CompressedSize,
-							Buffer.GetData(), BytesInBuffer,
-							ECompressionFlags::COMPRESS_BiasSpeed))
-						{
-							break;
-						}
-
-						// Compression failed.
-						if (CompressedSize > GZipBuffer.Num())
-						{
-							// Failed because the buffer size was too small. Increase the buffer size.
-							GZipBuffer.SetNumUninitialized(CompressedSize);
-						}
-						else
-						{
-							// Buffer was already large enough. Unknown error. Nothing we can do here but discard the data.
-							UE_LOG(LogCsvProfiler, Error, TEXT("CSV data compression failed."));
-							BytesInBuffer = 0;
-							return;
-						}
-					}
-				}
+				// Compress and write the data on a worker while we carry on filling the other buffer. Only one flush
+				// is in flight at a time, so the data still reaches the file in order.
+				WaitForPendingFlush();
+				Swap(Buffer, FlushBuffer);
 
+				const int32 NumBytes = BytesInBuffer;
+				PendingFlush = Async(EAsyncExecution::ThreadPool, [this, NumBytes]()
 				{
-					OutputFile->Serialize(GZipBuffer.GetData(), CompressedSize);
-				}
+					LLM_SCOPE(ELLMTag::CsvProfiler);
+					WriteBlock(FlushBuffer.GetData(), NumBytes);
+				});
 			}
 			else
 			{
-				// No compression. Write directly to the output file
-				OutputFile->Serialize(Buffer.GetData(), BytesInBuffer);
+				WriteBlock(Buffer.GetData(), BytesInBuffer);
 			}
 
 			BytesInBuffer = 0;
 		}
 	}
 
+	void WaitForPendingFlush()
+	{
+		if (PendingFlush.IsValid())
+		{
+			PendingFlush.Wait();
+			PendingFlush = TFuture<void>();
+		}
+	}
+
+	void WriteBlock(const uint8* Data, int32 NumBytes)
+	{
+		const uint8* BlockData = Data;
+		int32 BlockSize = NumBytes;
+
+		if (bCompressOutput)
+		{
+			const FName CompressionFormat = bBinaryBlocks ? NAME_Zlib : NAME_Gzip;
+			while (true)
+			{
+				// Compress the data into the GZipBuffer array
+				BlockSize = GZipBuffer.Num();
+				if (FCompression::CompressMemory(
+					CompressionFormat,
+					GZipBuffer.GetData(), BlockSize,
+					Data, NumBytes,
+					ECompressionFlags::COMPRESS_BiasSpeed))
+				{
+					break;
+				}
+
+				// Compression failed.
+				if (BlockSize > GZipBuffer.Num())
+				{
+					// Failed because the buffer size was too small. Increase the buffer size.
+					GZipBuffer.SetNumUninitialized(BlockSize);
+				}
+				else
+				{
+					// Buffer was already large enough. Unknown error. Nothing we can do here but discard the data.
+					UE_LOG(LogCsvProfiler, Error, TEXT("CSV data compression failed."));
+					return;
+				}
+			}
+			BlockData = GZipBuffer.GetData();
+		}
+
+		if (bBinaryBlocks)
+		{
+			uint32 BlockHeader[2] = { (uint32)NumBytes, (uint32)BlockSize };
+			OutputFile->Serialize(BlockHeader, sizeof(BlockHeader));
+		}
+		OutputFile->Serialize(const_cast<uint8*>(BlockData), BlockSize);
+	}
+
 	TSharedRef<FArchive> OutputFile;
 	bool bIsLineStart;
+	const bool bCompressOutput;
+	const bool bBinaryBlocks;
 
 	int32 BytesInBuffer;
 	TArray<uint8> Buffer;
 	TArray<uint8> GZipBuffer;
 
+	/** Data being compressed and written by PendingFlush */
+	TArray<uint8> FlushBuffer;
+	TFuture<void> PendingFlush;
+
 public:
 	inline uint64 GetAllocatedSize() const
 	{
-		return Buffer.GetAllocatedSize() + GZipBuffer.GetAllocatedSize();
+		return Buffer.GetAllocatedSize() + GZipBuffer.GetAllocatedSize() + FlushBuffer.GetAllocatedSize();
 	}
 };
 
@@ -1388,6 +1498,34 @@ struct FCsvProcessedEvent
 
 typedef int32 FCsvStatID;
 
+struct FCsvStatSeries;
+
+/**
+ * Writer updates made by a thread data processor while processors run in parallel. They are applied to the writer
+ * in processor order once all of them are done, so the output doesn't depend on how the work was scheduled.
+ */
+struct FCsvPendingWrites
+{
+	struct FValue
+	{
+		FCsvStatSeries* Series;
+		int64 FrameNumber;
+		FCsvStatSeriesValue Value;
+	};
+
+	TArray<FCsvStatSeries*> NewSeries;
+	TArray<FValue> Values;
+	TArray<FCsvProcessedEvent> Events;
+
+	/** Set while the owning processor runs; series flushed outside of processing (when finalizing rows) go straight to the writer */
+	bool bDeferring = false;
+
+	inline uint64 GetAllocatedSize() const
+	{
+		return NewSeries.GetAllocatedSize() + Values.GetAllocatedSize() + Events.GetAllocatedSize();
+	}
+};
+
 struct FCsvStatSeries
 {
 	enum class EType : uint8
@@ -1397,7 +1535,7 @@ struct FCsvStatSeries
 		CustomStatFloat
 	};
 
-	FCsvStatSeries(EType InSeriesType, const FCsvStatID& InStatID, FCsvStreamWriter* InWriter, FCsvStatRegister& StatRegister, const FString& ThreadName);
+	FCsvStatSeries(EType InSeriesType, const FCsvStatID& InStatID, FCsvStreamWriter* InWriter, FCsvPendingWrites* InPendingWrites, FCsvStatRegister& StatRegister, const FString& ThreadName);
 	void FlushIfDirty();
 
 	void SetTimerValue(uint32 DataFrameNumber, uint64 ElapsedCycles)
@@ -1517,6 +1655,7 @@ struct FCsvStatSeries
 	} CurrentValue;
 
 	FCsvStreamWriter* Writer;
+	FCsvPendingWrites* PendingWrites;
 
 	int32 ColumnIndex;
 
@@ -1567,8 +1706,20 @@ class FCsvStreamWriter
 	int64 ReadFrameIndex;
 
 	const bool bContinuousWrites;
+	const bool bBinary;
 	bool bFirstRow;
 
+	// Binary output: rows are gathered into batches which are written column by column, see FCsvBinaryFormat
+	static const int32 BinaryRowsPerRecord = 256;
+	struct FBinaryRows
+	{
+		TArray<FString> Events;
+		TArray<TArray<uint32>> Columns;
+	};
+	FBinaryRows BinaryRows;
+	int32 NumBinarySeriesWritten;
+	TArray<uint8> BinaryRecord;
+
 	TArray<FCsvStatSeries*> AllSeries;
 	TArray<class FCsvProfilerThreadDataProcessor*> DataProcessors;
 
@@ -1576,7 +1727,7 @@ class FCsvStreamWriter
 	uint32 RHIThreadId;
 
 public:
-	FCsvStreamWriter(const TSharedRef<FArchive>& InOutputFile, bool bInContinuousWrites, int32 InBufferSize, bool bInCompressOutput, uint32 RenderThreadId, uint32 RHIThreadId);
+	FCsvStreamWriter(const TSharedRef<FArchive>& InOutputFile, bool bInContinuousWrites, int32 InBufferSize, bool bInCompressOutput, bool bInBinary, uint32 RenderThreadId, uint32 RHIThreadId);
 	~FCsvStreamWriter();
 
 	void AddSeries(FCsvStatSeries* Series);
@@ -1586,17 +1737,29 @@ public:
 
 	void FinalizeNextRow();
 	void Process(FCsvProcessThreadDataStats& OutStats);
+	void CommitPendingWrites(FCsvPendingWrites& PendingWrites);
 
 	void Finalize(const TMap<FString, FString>& Metadata);
 
 	inline uint64 GetAllocatedSize() const;
+
+private:
+	void WriteTextRow(const FCsvRow& Row);
+	void WriteTextFooter(const TMap<FString, FString>& Metadata);
+
+	void AddBinaryRow(const FCsvRow& Row);
+	void WriteBinaryRows();
+	void WriteBinarySeriesDefs();
+	void WriteBinaryMetadata(const TMap<FString, FString>& Metadata);
+	void WriteBinaryRecord();
 };
 
-FCsvStatSeries::FCsvStatSeries(EType InSeriesType, const FCsvStatID& InStatID, FCsvStreamWriter* InWriter, FCsvStatRegister& StatRegister, const FString& ThreadName)
+FCsvStatSeries::FCsvStatSeries(EType InSeriesType, const FCsvStatID& InStatID, FCsvStreamWriter* InWriter, FCsvPendingWrites* InPendingWrites, FCsvStatRegister& StatRegister, const FString& ThreadName)
 	: StatID(InStatID)
 	, SeriesType(InSeriesType)
 	, CurrentWriteFrameNumber(-1)
 	, Writer(InWriter)
+	, PendingWrites(InPendingWrites)
 	, ColumnIndex(-1)
 	, bDirty(false)
 {
@@ -1625,7 +1788,14 @@ FCsvStatSeries::FCsvStatSeries(EType InSeriesType, const FCsvStatID& InStatID, F
 		Name = TEXT("COUNTS/") + Name;
 	}
 
-	Writer->AddSeries(this);
+	if (PendingWrites->bDeferring)
+	{
+		PendingWrites->NewSeries.Add(this);
+	}
+	else
+	{
+		Writer->AddSeries(this);
+	}
 }
 
 void FCsvStatSeries::FlushIfDirty()
@@ -1645,7 +1815,14 @@ void FCsvStatSeries::FlushIfDirty()
 			Value.Value.AsFloat = CurrentValue.AsFloatValue;
 			break;
 		}
-		Writer->PushValue(this, CurrentWriteFrameNumber, Value);
+		if (PendingWrites->bDeferring)
+		{
+			PendingWrites->Values.Add({ this, CurrentWriteFrameNumber, Value });
+		}
+		else
+		{
+			Writer->PushValue(this, CurrentWriteFrameNumber, Value);
+		}
 		CurrentValue.AsTimerCycles = 0;
 		bDirty = false;
 	}
@@ -1923,13 +2100,24 @@ class FCsvProfilerThreadDataProcessor
 	uint32 RenderThreadId;
 	uint32 RHIThreadId;
 
+	// Raw data read from the thread by FlushResults, waiting for ProcessResults
+	TArray<FCsvTimingMarker> ThreadMarkers;
+	TArray<FCsvCustomStat> CustomStats;
+	TArray<FCsvEvent> Events;
+
+	// Our own read position in the frame boundaries, since processors can run in parallel
+	int32 FrameBoundaryReadIndex;
+
 public:
+	FCsvPendingWrites PendingWrites;
+
 	FCsvProfilerThreadDataProcessor(FCsvProfilerThreadData::FSharedPtr InThreadData, FCsvStreamWriter* InWriter, uint32 InRenderThreadId, uint32 InRHIThreadId)
 		: ThreadData(InThreadData)
 		, Writer(InWriter)
 		, LastProcessedTimestamp(0)
 		, RenderThreadId(InRenderThreadId)
 		, RHIThreadId(InRHIThreadId)
+		, FrameBoundaryReadIndex(0)
 	{
 		check(ThreadData->DataProcessor == nullptr);
 		ThreadData->DataProcessor = this;
@@ -1954,10 +2142,18 @@ public:
 			((uint64)ExclusiveMarkerStack.GetAllocatedSize()) +
 			((uint64)StatSeriesArray.GetAllocatedSize()) +
 			((uint64)StatSeriesArray.Num() * sizeof(FCsvStatSeries)) +
+			((uint64)ThreadMarkers.GetAllocatedSize()) +
+			((uint64)CustomStats.GetAllocatedSize()) +
+			((uint64)Events.GetAllocatedSize()) +
+			((uint64)PendingWrites.GetAllocatedSize()) +
 			((uint64)ThreadData->GetAllocatedSize());
 	}
 
-	void Process(FCsvProcessThreadDataStats& OutStats, int32& OutMinFrameNumberProcessed);
+	/** Reads the raw data recorded by the thread. Must be called for all processors before updating the frame boundaries. */
+	void FlushResults(FCsvProcessThreadDataStats& OutStats);
+
+	/** Turns the raw data into stat values. Writer updates go to PendingWrites, so processors can run in parallel. */
+	void ProcessResults(int32& OutMinFrameNumberProcessed);
 
 private:
 	FCsvStatSeries* FindOrCreateStatSeries(const FCsvStatBase& Stat, FCsvStatSeries::EType SeriesType, bool bIsCountStat)
@@ -1972,7 +2168,7 @@ private:
 		}
 		if (StatSeriesArray[StatIndex] == nullptr)
 		{
-			Series = new FCsvStatSeries(SeriesType, StatIndex, Writer, StatRegister, ThreadData->ThreadName);
+			Series = new FCsvStatSeries(SeriesType, StatIndex, Writer, &PendingWrites, StatRegister, ThreadData->ThreadName);
 			StatSeriesArray[StatIndex] = Series;
 		}
 		else
@@ -1987,15 +2183,26 @@ private:
 	}
 };
 
-FCsvStreamWriter::FCsvStreamWriter(const TSharedRef<FArchive>& InOutputFile, bool bInContinuousWrites, int32 InBufferSize, bool bInCompressOutput, uint32 InRenderThreadId, uint32 InRHIThreadId)
-	: Stream(InOutputFile, InBufferSize, bInCompressOutput)
+FCsvStreamWriter::FCsvStreamWriter(const TSharedRef<FArchive>& InOutputFile, bool bInContinuousWrites, int32 InBufferSize, bool bInCompressOutput, bool bInBinary, uint32 InRenderThreadId, uint32 InRHIThreadId)
+	: Stream(InOutputFile, InBufferSize, bInCompressOutput, bInBinary)
 	, WriteFrameIndex(-1)
 	, ReadFrameIndex(-1)
 	, bContinuousWrites(bInContinuousWrites)
+	, bBinary(bInBinary)
 	, bFirstRow(true)
+	, NumBinarySeriesWritten(0)
 	, RenderThreadId(InRenderThreadId)
 	, RHIThreadId(InRHIThreadId)
-{}
+{
+	if (bBinary)
+	{
+		// Nothing has gone through the stream yet, so the header can be written to the file directly
+		uint64 Magic = FCsvBinaryFormat::Magic;
+		uint32 Version = FCsvBinaryFormat::Version;
+		uint32 Flags = (bInCompressOutput && InBufferSize > 0) ? FCsvBinaryFormat::CompressedBlocks : 0;
+		*InOutputFile << Magic << Version << Flags;
+	}
+}
 
 FCsvStreamWriter::~FCsvStreamWriter()
 {
@@ -2039,7 +2246,7 @@ void FCsvStreamWriter::FinalizeNextRow()
 {
 	ReadFrameIndex++;
 
-	if (bFirstRow)
+	if (bFirstRow && !bBinary)
 	{
 		// Write the first header row
 		Stream.WriteString("EVENTS");
@@ -2057,55 +2264,70 @@ void FCsvStreamWriter::FinalizeNextRow()
 	FCsvRow* Row = Rows.Find(ReadFrameIndex);
 	if (Row)
 	{
-		if (Row->Events.Num() > 0)
+		for (FCsvStatSeries* Series : AllSeries)
 		{
-			// Write the events for this row
-			TArray<FString> EventStrings;
-			EventStrings.Reserve(Row->Events.Num());
-			for (FCsvProcessedEvent& Event : Row->Events)
-			{
-				EventStrings.Add(Event.GetFullName());
-			}
+			// Stat values are held in the series until a new value arrives.
+			// If we've caught up with the last value written to the series,
+			// we need to flush to get the correct value for this frame.
+			if (Series->CurrentWriteFrameNumber == ReadFrameIndex)
+				Series->FlushIfDirty();
+		}
 
-			Stream.WriteSemicolonSeparatedStringList(EventStrings);
+		if (bBinary)
+		{
+			AddBinaryRow(*Row);
 		}
 		else
 		{
-			// No events. Insert empty string at the start of the line
-			Stream.WriteEmptyString();
+			WriteTextRow(*Row);
 		}
 
-		for (FCsvStatSeries* Series : AllSeries)
+		// Finally remove the frame data
+		Rows.FindAndRemoveChecked(ReadFrameIndex);
+	}
+}
+
+void FCsvStreamWriter::WriteTextRow(const FCsvRow& Row)
+{
+	if (Row.Events.Num() > 0)
+	{
+		// Write the events for this row
+		TArray<FString> EventStrings;
+		EventStrings.Reserve(Row.Events.Num());
+		for (const FCsvProcessedEvent& Event : Row.Events)
 		{
-			// Stat values are held in the series until a new value arrives.
-			// If we've caught up with the last value written to the series,
-			// we need to flush to get the correct value for this frame.
-			if (Series->CurrentWriteFrameNumber == ReadFrameIndex)
-				Series->FlushIfDirty();
+			EventStrings.Add(Event.GetFullName());
+		}
 
-			if (Row->Values.IsValidIndex(Series->ColumnIndex))
+		Stream.WriteSemicolonSeparatedStringList(EventStrings);
+	}
+	else
+	{
+		// No events. Insert empty string at the start of the line
+		Stream.WriteEmptyString();
+	}
+
+	for (FCsvStatSeries* Series : AllSeries)
+	{
+		if (Row.Values.IsValidIndex(Series->ColumnIndex))
+		{
+			const FCsvStatSeriesValue& Value = Row.Values[Series->ColumnIndex];
+			if (Series->SeriesType == FCsvStatSeries::EType::CustomStatInt)
 			{
-				const FCsvStatSeriesValue& Value = Row->Values[Series->ColumnIndex];
-				if (Series->SeriesType == FCsvStatSeries::EType::CustomStatInt)
-				{
-					Stream.WriteValue(Value.Value.AsInt);
-				}
-				else
-				{
-					Stream.WriteValue(Value.Value.AsFloat);
-				}
+				Stream.WriteValue(Value.Value.AsInt);
 			}
 			else
 			{
-				Stream.WriteValue(0);
+				Stream.WriteValue(Value.Value.AsFloat);
 			}
 		}
-
-		Stream.NewLine();
-
-		// Finally remove the frame data
-		Rows.FindAndRemoveChecked(ReadFrameIndex);
+		else
+		{
+			Stream.WriteValue(0);
+		}
 	}
+
+	Stream.NewLine();
 }
 
 void FCsvStreamWriter::Finalize(const TMap<FString, FString>& Metadata)
@@ -2116,6 +2338,19 @@ void FCsvStreamWriter::Finalize(const TMap<FString, FString>& Metadata)
 		FinalizeNextRow();
 	}
 
+	if (bBinary)
+	{
+		WriteBinaryRows();
+		WriteBinaryMetadata(Metadata);
+	}
+	else
+	{
+		WriteTextFooter(Metadata);
+	}
+}
+
+void FCsvStreamWriter::WriteTextFooter(const TMap<FString, FString>& Metadata)
+{
 	// Write a final summary header row
 	Stream.WriteString("EVENTS");
 	for (FCsvStatSeries* Series : AllSeries)
@@ -2146,6 +2381,141 @@ void FCsvStreamWriter::Finalize(const TMap<FString, FString>& Metadata)
 	}
 }
 
+void FCsvStreamWriter::AddBinaryRow(const FCsvRow& Row)
+{
+	const int32 RowIndex = BinaryRows.Events.Num();
+
+	FString& EventsString = BinaryRows.Events.AddDefaulted_GetRef();
+	for (const FCsvProcessedEvent& Event : Row.Events)
+	{
+		FString SanitizedText = Event.GetFullName();
+
+		// Same rules as the text output, so converted files are identical
+		SanitizedText.ReplaceInline(TEXT(";"), TEXT("."));
+		SanitizedText.ReplaceInline(TEXT(","), TEXT("."));
+
+		if (EventsString.Len() > 0)
+		{
+			EventsString += TEXT(';');
+		}
+		EventsString += SanitizedText;
+	}
+
+	// Series added since the start of the batch get zeros for the rows before they existed
+	while (BinaryRows.Columns.Num() < AllSeries.Num())
+	{
+		BinaryRows.Columns.AddDefaulted_GetRef().AddZeroed(RowIndex);
+	}
+
+	for (int32 ColumnIndex = 0; ColumnIndex < BinaryRows.Columns.Num(); ++ColumnIndex)
+	{
+		// Ints and floats are stored as their raw bits
+		BinaryRows.Columns[ColumnIndex].Add(Row.Values.IsValidIndex(ColumnIndex) ? (uint32)Row.Values[ColumnIndex].Value.AsInt : 0);
+	}
+
+	if (BinaryRows.Events.Num() >= BinaryRowsPerRecord)
+	{
+		WriteBinaryRows();
+	}
+}
+
+void FCsvStreamWriter::WriteBinaryRows()
+{
+	WriteBinarySeriesDefs();
+
+	uint32 NumRows = BinaryRows.Events.Num();
+	if (NumRows == 0)
+	{
+		return;
+	}
+
+	uint32 NumColumns = BinaryRows.Columns.Num();
+
+	FMemoryWriter Ar(BinaryRecord);
+	FCsvBinaryFormat::ERecordType RecordType = FCsvBinaryFormat::ERecordType::Rows;
+	Ar << RecordType << NumRows << NumColumns;
+	for (FString& Events : BinaryRows.Events)
+	{
+		Ar << Events;
+	}
+	for (TArray<uint32>& Column : BinaryRows.Columns)
+	{
+		check(Column.Num() == NumRows);
+		Ar.Serialize(Column.GetData(), Column.Num() * sizeof(uint32));
+		Column.Reset();
+	}
+	BinaryRows.Events.Reset();
+
+	WriteBinaryRecord();
+}
+
+void FCsvStreamWriter::WriteBinarySeriesDefs()
+{
+	uint32 NumNewSeries = AllSeries.Num() - NumBinarySeriesWritten;
+	if (NumNewSeries == 0)
+	{
+		return;
+	}
+
+	FMemoryWriter Ar(BinaryRecord);
+	FCsvBinaryFormat::ERecordType RecordType = FCsvBinaryFormat::ERecordType::SeriesDefs;
+	Ar << RecordType << NumNewSeries;
+	for (int32 SeriesIndex = NumBinarySeriesWritten; SeriesIndex < AllSeries.Num(); ++SeriesIndex)
+	{
+		FCsvStatSeries* Series = AllSeries[SeriesIndex];
+		FCsvBinaryFormat::ESeriesType SeriesType = (Series->SeriesType == FCsvStatSeries::EType::CustomStatInt) ? FCsvBinaryFormat::ESeriesType::Int : FCsvBinaryFormat::ESeriesType::Float;
+		Ar << SeriesType << Series->Name;
+	}
+	NumBinarySeriesWritten = AllSeries.Num();
+
+	WriteBinaryRecord();
+}
+
+void FCsvStreamWriter::WriteBinaryMetadata(const TMap<FString, FString>& Metadata)
+{
+	// The converter takes care of writing the commandline last
+	FMemoryWriter Ar(BinaryRecord);
+	FCsvBinaryFormat::ERecordType RecordType = FCsvBinaryFormat::ERecordType::Metadata;
+	uint32 NumEntries = Metadata.Num();
+	Ar << RecordType << NumEntries;
+	for (const auto& Pair : Metadata)
+	{
+		FString Key = Pair.Key;
+		FString Value = Pair.Value;
+		Ar << Key << Value;
+	}
+
+	WriteBinaryRecord();
+}
+
+void FCsvStreamWriter::WriteBinaryRecord()
+{
+	Stream.WriteBinary(BinaryRecord.GetData(), BinaryRecord.Num());
+	BinaryRecord.Reset();
+}
+
+void FCsvStreamWriter::CommitPendingWrites(FCsvPendingWrites& PendingWrites)
+{
+	check(!PendingWrites.bDeferring);
+
+	for (FCsvStatSeries* Series : PendingWrites.NewSeries)
+	{
+		AddSeries(Series);
+	}
+	for (const FCsvPendingWrites::FValue& PendingValue : PendingWrites.Values)
+	{
+		PushValue(PendingValue.Series, PendingValue.FrameNumber, PendingValue.Value);
+	}
+	for (const FCsvProcessedEvent& Event : PendingWrites.Events)
+	{
+		PushEvent(Event);
+	}
+
+	PendingWrites.NewSeries.Reset();
+	PendingWrites.Values.Reset();
+	PendingWrites.Events.Reset();
+}
+
 void FCsvStreamWriter::Process(FCsvProcessThreadDataStats& OutStats)
 {
 	TArray<FCsvProfilerThreadData::FSharedPtr> TlsData;
@@ -2159,10 +2529,32 @@ void FCsvStreamWriter::Process(FCsvProcessThreadDataStats& OutStats)
 		}
 	}
 
-	int32 MinFrameNumberProcessed = MAX_int32;
 	for (FCsvProfilerThreadDataProcessor* DataProcessor : DataProcessors)
 	{
-		DataProcessor->Process(OutStats, MinFrameNumberProcessed);
+		DataProcessor->FlushResults(OutStats);
+	}
+
+	// Flush the frame boundaries after the stat data. This way, we ensure the frame boundary data is up to date
+	// (we do not want to encounter markers from a frame which hasn't been registered yet)
+	FPlatformMisc::MemoryBarrier();
+	GFrameBoundaries.Update();
+
+	// Each processor only touches its own thread's data and series, so they can run in parallel. Their writes to
+	// this writer are deferred and committed below, in the same order as when processing serially.
+	TArray<int32, TInlineAllocator<64>> MinFrameNumbers;
+	MinFrameNumbers.Init(MAX_int32, DataProcessors.Num());
+	const bool bForceSingleThread = !GCsvParallelProcessing || DataProcessors.Num() < 2 || !FApp::ShouldUseThreadingForPerformance();
+	ParallelFor(DataProcessors.Num(), [this, &MinFrameNumbers, bForceSingleThread](int32 Index)
+	{
+		TGuardValue<bool> ParallelWorker(GCsvIsParallelProcessingWorker, !bForceSingleThread);
+		DataProcessors[Index]->ProcessResults(MinFrameNumbers[Index]);
+	}, bForceSingleThread);
+
+	int32 MinFrameNumberProcessed = MAX_int32;
+	for (int32 Index = 0; Index < DataProcessors.Num(); ++Index)
+	{
+		CommitPendingWrites(DataProcessors[Index]->PendingWrites);
+		MinFrameNumberProcessed = FMath::Min(MinFrameNumberProcessed, MinFrameNumbers[Index]);
 	}
 
 	if (bContinuousWrites && MinFrameNumberProcessed < MAX_int32)
@@ -2181,11 +2573,15 @@ uint64 FCsvStreamWriter::GetAllocatedSize() const
 		((uint64)Rows.GetAllocatedSize()) +
 		((uint64)AllSeries.GetAllocatedSize()) +
 		((uint64)DataProcessors.GetAllocatedSize()) +
+		((uint64)BinaryRows.Events.GetAllocatedSize()) +
+		((uint64)BinaryRows.Columns.GetAllocatedSize()) +
+		((uint64)BinaryRecord.GetAllocatedSize()) +
 		((uint64)Stream.GetAllocatedSize());
 
 	for (const auto& Pair          : Rows)           { Size += (uint64)Pair.Value.GetAllocatedSize();     }
 	for (const auto& Series        : AllSeries)      { Size += (uint64)Series->GetAllocatedSize();        }
 	for (const auto& DataProcessor : DataProcessors) { Size += (uint64)DataProcessor->GetAllocatedSize(); }
+	for (const auto& Column        : BinaryRows.Columns) { Size += (uint64)Column.GetAllocatedSize();     }
 
 	return Size;
 }
@@ -2267,26 +2663,29 @@ private:
 	FCsvProfiler& CsvProfiler;
 };
 
-void FCsvProfilerThreadDataProcessor::Process(FCsvProcessThreadDataStats& OutStats, int32& OutMinFrameNumberProcessed)
+void FCsvProfilerThreadDataProcessor::FlushResults(FCsvProcessThreadDataStats& OutStats)
 {
-	QUICK_SCOPE_CYCLE_COUNTER(STAT_FCsvProfilerThreadData_ProcessThreadData);
-
 	// We can call this from the game thread just before reading back the data, or from the CSV processing thread
 	check(IsInCsvProcessingThread());
 
 	// Read the raw CSV data
-	TArray<FCsvTimingMarker> ThreadMarkers;
-	TArray<FCsvCustomStat> CustomStats;
-	TArray<FCsvEvent> Events;
+	ThreadMarkers.Reset();
+	CustomStats.Reset();
+	Events.Reset();
 	ThreadData->FlushResults(ThreadMarkers, CustomStats, Events);
 
 	OutStats.TimestampCount += ThreadMarkers.Num();
 	OutStats.CustomStatCount += CustomStats.Num();
 	OutStats.EventCount += Events.Num();
+}
+
+void FCsvProfilerThreadDataProcessor::ProcessResults(int32& OutMinFrameNumberProcessed)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FCsvProfilerThreadData_ProcessThreadData);
+
+	check(IsInCsvProcessingThread());
+	TGuardValue<bool> DeferWrites(PendingWrites.bDeferring, true);
 
-	// Flush the frame boundaries after the stat data. This way, we ensure the frame boundary data is up to date
-	// (we do not want to encounter markers from a frame which hasn't been registered yet)
-	FPlatformMisc::MemoryBarrier();
 	ECsvTimeline::Type Timeline = (ThreadData->ThreadId == RenderThreadId || ThreadData->ThreadId == RHIThreadId) ? ECsvTimeline::Renderthread : ECsvTimeline::Gamethread;
 
 	if (ThreadMarkers.Num() > 0)
@@ -2351,7 +2750,7 @@ void FCsvProfilerThreadDataProcessor::Process(FCsvProcessThreadDataStats& OutSta
 		bAllowExclusiveMarkerInsertion = !bInsertExtraMarker;
 
 		FCsvTimingMarker& Marker = *MarkerPtr;
-		int32 FrameNumber = GFrameBoundaries.GetFrameNumberForTimestamp(Timeline, Marker.GetTimestamp());
+		int32 FrameNumber = GFrameBoundaries.GetFrameNumberForTimestamp(Timeline, Marker.GetTimestamp(), FrameBoundaryReadIndex);
 		OutMinFrameNumberProcessed = FMath::Min(FrameNumber, OutMinFrameNumberProcessed);
 		if (Marker.IsBeginMarker())
 		{
@@ -2416,7 +2815,7 @@ void FCsvProfilerThreadDataProcessor::Process(FCsvProcessThreadDataStats& OutSta
 	for (int i = 0; i < CustomStats.Num(); i++)
 	{
 		FCsvCustomStat& CustomStat = CustomStats[i];
-		int32 FrameNumber = GFrameBoundaries.GetFrameNumberForTimestamp(Timeline, CustomStat.GetTimestamp());
+		int32 FrameNumber = GFrameBoundaries.GetFrameNumberForTimestamp(Timeline, CustomStat.GetTimestamp(), FrameBoundaryReadIndex);
 		OutMinFrameNumberProcessed = FMath::Min(FrameNumber, OutMinFrameNumberProcessed);
 		if (FrameNumber >= 0)
 		{
@@ -2444,7 +2843,7 @@ void FCsvProfilerThreadDataProcessor::Process(FCsvProcessThreadDataStats& OutSta
 	for (int i = 0; i < Events.Num(); i++)
 	{
 		FCsvEvent& Event = Events[i];
-		int32 FrameNumber = GFrameBoundaries.GetFrameNumberForTimestamp(Timeline, Event.Timestamp);
+		int32 FrameNumber = GFrameBoundaries.GetFrameNumberForTimestamp(Timeline, Event.Timestamp, FrameBoundaryReadIndex);
 		OutMinFrameNumberProcessed = FMath::Min(FrameNumber, OutMinFrameNumberProcessed);
 		if (FrameNumber >= 0)
 		{
@@ -2452,7 +2851,7 @@ void FCsvProfilerThreadDataProcessor::Process(FCsvProcessThreadDataStats& OutSta
 			ProcessedEvent.EventText = Event.EventText;
 			ProcessedEvent.FrameNumber = FrameNumber;
 			ProcessedEvent.CategoryIndex = Event.CategoryIndex;
-			Writer->PushEvent(ProcessedEvent);
+			PendingWrites.Events.Add(MoveTemp(ProcessedEvent));
 		}
 	}
 }
@@ -2581,6 +2980,13 @@ void FCsvProfiler::BeginFrame()
 				int32 BufferSize = FMath::Max(CVarCsvWriteBufferSize.GetValueOnAnyThread(), 0);
 				bool bContinuousWrites = IsContinuousWriteEnabled(true);
 
+				// The binary format is written in blocks, so it always needs a write buffer
+				const bool bWriteBinary = CVarCsvWriteBinary.GetValueOnGameThread() != 0;
+				if (bWriteBinary && BufferSize == 0)
+				{
+					BufferSize = 128 * 1024;
+				}
+
 				// Allow overriding of compression based on the "csv.CompressionMode" CVar
 				bool bCompressOutput;
 				switch (CVarCsvCompressionMode.GetValueOnGameThread())
@@ -2598,7 +3004,8 @@ void FCsvProfiler::BeginFrame()
 					break;
 				}
 
-				const TCHAR* CsvExtension = bCompressOutput ? TEXT(".csv.gz") : TEXT(".csv");
+				// Binary files are compressed internally, see FCsvBinaryFormat
+				const TCHAR* CsvExtension = bWriteBinary ? TEXT(".csvbin") : bCompressOutput ? TEXT(".csv.gz") : TEXT(".csv");
 
 				// Determine the output path and filename based on override params
 				FString DestinationFolder = CurrentCommand.DestinationFolder.IsEmpty() ? FPaths::ProfilingDir() + TEXT("CSV/") : CurrentCommand.DestinationFolder + TEXT("/");
@@ -2613,7 +3020,7 @@ void FCsvProfiler::BeginFrame()
 				else
 				{
 					
-					CsvWriter = new FCsvStreamWriter(OutputFile.ToSharedRef(), bContinuousWrites, BufferSize, bCompressOutput, RenderThreadId, RHIThreadId);
+					CsvWriter = new FCsvStreamWriter(OutputFile.ToSharedRef(), bContinuousWrites, BufferSize, bCompressOutput, bWriteBinary, RenderThreadId, RHIThreadId);
 
 					NumFramesToCapture = CurrentCommand.Value;
 					GCsvRepeatFrameCount = NumFramesToCapture;
@@ -3271,6 +3678,10 @@ void FCsvProfiler::Init()
 	{
 		CVarCsvStatCounts.AsVariable()->Set(1);
 	}
+	if (FParse::Param(FCommandLine::Get(), TEXT("csvBinary")))
+	{
+		CVarCsvWriteBinary.AsVariable()->Set(1);
+	}
 	int32 NumCsvFrames = 0;
 	if (FParse::Value(FCommandLine::Get(), TEXT("csvCaptureFrames="), NumCsvFrames))
 	{
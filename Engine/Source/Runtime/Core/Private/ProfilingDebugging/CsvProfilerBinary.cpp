@@ -0,0 +1,293 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/CsvProfilerBinary.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "HAL/FileManager.h"
+#include "Logging/LogMacros.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Templates/UniquePtr.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCsvBinary, Log, All);
+
+namespace CsvBinaryPrivate
+{
+	/** Writes text in the same way as the CSV profiler's own text writer, so converted files match directly written ones */
+	class FTextWriter
+	{
+	public:
+		explicit FTextWriter(FArchive& InAr)
+			: Ar(InAr)
+			, bIsLineStart(true)
+		{
+		}
+
+		void WriteString(const FString& Str)
+		{
+			WriteSeparator();
+			auto AnsiStr = StringCast<ANSICHAR>(*Str);
+			Ar.Serialize((void*)AnsiStr.Get(), AnsiStr.Length());
+		}
+
+		void WriteValue(double Value)
+		{
+			WriteSeparator();
+
+			int32 StrLen;
+			ANSICHAR StringBuffer[256];
+			if (FMath::Frac((float)Value) == 0.0f)
+			{
+				StrLen = FCStringAnsi::Snprintf(StringBuffer, 256, "%d", int(Value));
+			}
+			else if (FMath::Abs(Value) < 0.1)
+			{
+				StrLen = FCStringAnsi::Snprintf(StringBuffer, 256, "%.6f", Value);
+			}
+			else
+			{
+				StrLen = FCStringAnsi::Snprintf(StringBuffer, 256, "%.4f", Value);
+			}
+			Ar.Serialize(StringBuffer, StrLen);
+		}
+
+		void NewLine()
+		{
+			ANSICHAR Char = '\n';
+			Ar.Serialize(&Char, 1);
+			bIsLineStart = true;
+		}
+
+	private:
+		void WriteSeparator()
+		{
+			if (!bIsLineStart)
+			{
+				ANSICHAR Char = ',';
+				Ar.Serialize(&Char, 1);
+			}
+			bIsLineStart = false;
+		}
+
+		FArchive& Ar;
+		bool bIsLineStart;
+	};
+
+	struct FSeries
+	{
+		FCsvBinaryFormat::ESeriesType Type;
+		FString Name;
+	};
+
+	static void WriteHeaderRow(FTextWriter& Writer, const TArray<FSeries>& Series)
+	{
+		Writer.WriteString(TEXT("EVENTS"));
+		for (const FSeries& Entry : Series)
+		{
+			Writer.WriteString(Entry.Name);
+		}
+		Writer.NewLine();
+	}
+
+	/** Reads the file and unpacks its blocks into a single record stream */
+	static bool ReadRecordStream(const TCHAR* BinaryFilename, TArray<uint8>& OutStream)
+	{
+		TArray<uint8> FileData;
+		if (!FFileHelper::LoadFileToArray(FileData, BinaryFilename))
+		{
+			UE_LOG(LogCsvBinary, Error, TEXT("Failed to read \"%s\"."), BinaryFilename);
+			return false;
+		}
+
+		FMemoryReader Reader(FileData);
+		uint64 Magic = 0;
+		uint32 Version = 0;
+		uint32 Flags = 0;
+		Reader << Magic << Version << Flags;
+		if (Reader.IsError() || Magic != FCsvBinaryFormat::Magic)
+		{
+			UE_LOG(LogCsvBinary, Error, TEXT("\"%s\" is not a binary CSV capture."), BinaryFilename);
+			return false;
+		}
+		if (Version > FCsvBinaryFormat::Version)
+		{
+			UE_LOG(LogCsvBinary, Error, TEXT("\"%s\" has version %u, only up to %u is supported."), BinaryFilename, Version, FCsvBinaryFormat::Version);
+			return false;
+		}
+
+		const bool bCompressed = (Flags & FCsvBinaryFormat::CompressedBlocks) != 0;
+		while (Reader.TotalSize() - Reader.Tell() >= 2 * sizeof(uint32))
+		{
+			uint32 UncompressedSize = 0;
+			uint32 StoredSize = 0;
+			Reader << UncompressedSize << StoredSize;
+			if (StoredSize > Reader.TotalSize() - Reader.Tell())
+			{
+				// The capture was cut short (e.g. the process was killed); keep what we have
+				UE_LOG(LogCsvBinary, Warning, TEXT("\"%s\" is truncated."), BinaryFilename);
+				break;
+			}
+
+			const uint8* StoredData = FileData.GetData() + Reader.Tell();
+			const int32 StreamOffset = OutStream.AddUninitialized(UncompressedSize);
+			if (bCompressed)
+			{
+				if (!FCompression::UncompressMemory(NAME_Zlib, OutStream.GetData() + StreamOffset, UncompressedSize, StoredData, StoredSize))
+				{
+					UE_LOG(LogCsvBinary, Error, TEXT("Failed to decompress a block of \"%s\"."), BinaryFilename);
+					OutStream.SetNum(StreamOffset, false);
+					break;
+				}
+			}
+			else
+			{
+				FMemory::Memcpy(OutStream.GetData() + StreamOffset, StoredData, StoredSize);
+			}
+			Reader.Seek(Reader.Tell() + StoredSize);
+		}
+
+		return true;
+	}
+}
+
+bool FCsvBinaryFormat::ConvertToText(const TCHAR* BinaryFilename, const TCHAR* TextFilename)
+{
+	using namespace CsvBinaryPrivate;
+
+	TArray<uint8> Stream;
+	if (!ReadRecordStream(BinaryFilename, Stream))
+	{
+		return false;
+	}
+
+	TUniquePtr<FArchive> OutputFile(IFileManager::Get().CreateFileWriter(TextFilename));
+	if (!OutputFile)
+	{
+		UE_LOG(LogCsvBinary, Error, TEXT("Failed to create \"%s\"."), TextFilename);
+		return false;
+	}
+
+	FTextWriter Writer(*OutputFile);
+	FMemoryReader Reader(Stream);
+
+	TArray<FSeries> Series;
+	TArray<FString> RowEvents;
+	TArray<uint32> Values;
+	bool bFirstRow = true;
+
+	while (!Reader.AtEnd() && !Reader.IsError())
+	{
+		ERecordType RecordType;
+		Reader << RecordType;
+
+		switch (RecordType)
+		{
+		case ERecordType::SeriesDefs:
+		{
+			uint32 NumSeries = 0;
+			Reader << NumSeries;
+			for (uint32 Index = 0; Index < NumSeries && !Reader.IsError(); ++Index)
+			{
+				FSeries& Entry = Series.AddDefaulted_GetRef();
+				Reader << Entry.Type << Entry.Name;
+			}
+			break;
+		}
+
+		case ERecordType::Rows:
+		{
+			uint32 NumRows = 0;
+			uint32 NumColumns = 0;
+			Reader << NumRows << NumColumns;
+			if (NumColumns > (uint32)Series.Num() || uint64(NumRows) * NumColumns * sizeof(uint32) > uint64(Reader.TotalSize() - Reader.Tell()))
+			{
+				Reader.SetError();
+				break;
+			}
+
+			RowEvents.SetNum(NumRows);
+			for (FString& Events : RowEvents)
+			{
+				Reader << Events;
+			}
+
+			Values.SetNumUninitialized(NumRows * NumColumns);
+			Reader.Serialize(Values.GetData(), Values.Num() * sizeof(uint32));
+
+			if (bFirstRow)
+			{
+				WriteHeaderRow(Writer, Series);
+				bFirstRow = false;
+			}
+
+			for (uint32 Row = 0; Row < NumRows; ++Row)
+			{
+				Writer.WriteString(RowEvents[Row]);
+				for (uint32 Column = 0; Column < NumColumns; ++Column)
+				{
+					const uint32 Bits = Values[Column * NumRows + Row];
+					if (Series[Column].Type == ESeriesType::Int)
+					{
+						Writer.WriteValue((int32)Bits);
+					}
+					else
+					{
+						float Value;
+						FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+						Writer.WriteValue(Value);
+					}
+				}
+				Writer.NewLine();
+			}
+			break;
+		}
+
+		case ERecordType::Metadata:
+		{
+			// Same footer as the text writer: a final header row listing every column, then the metadata with the
+			// commandline last (which is required for parsing)
+			WriteHeaderRow(Writer, Series);
+			Writer.WriteString(TEXT("[HasHeaderRowAtEnd]"));
+			Writer.WriteString(TEXT("1"));
+
+			uint32 NumEntries = 0;
+			Reader << NumEntries;
+			FString Commandline;
+			bool bHasCommandline = false;
+			for (uint32 Index = 0; Index < NumEntries && !Reader.IsError(); ++Index)
+			{
+				FString Key, Value;
+				Reader << Key << Value;
+				if (Key == TEXT("Commandline"))
+				{
+					Commandline = MoveTemp(Value);
+					bHasCommandline = true;
+				}
+				else
+				{
+					Writer.WriteString(FString::Printf(TEXT("[%s]"), *Key));
+					Writer.WriteString(Value);
+				}
+			}
+			if (bHasCommandline)
+			{
+				Writer.WriteString(TEXT("[Commandline]"));
+				Writer.WriteString(Commandline);
+			}
+			break;
+		}
+
+		default:
+			Reader.SetError();
+			break;
+		}
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogCsvBinary, Warning, TEXT("\"%s\" contains invalid data, the output was truncated."), BinaryFilename);
+	}
+
+	return OutputFile->Close();
+}
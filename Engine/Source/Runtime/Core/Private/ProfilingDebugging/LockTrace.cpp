@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "ProfilingDebugging/LockTrace.h"
+
+#if LOCKTRACE_ENABLED
+
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformTime.h"
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL(LockChannel)
+
+UE_TRACE_EVENT_BEGIN(Lock, Contended)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, WaitCycles)
+	UE_TRACE_EVENT_FIELD(uint64, Lock)
+	UE_TRACE_EVENT_FIELD(uint64, CallSite)
+	UE_TRACE_EVENT_FIELD(uint8, Type)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Lock, Hold)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, HoldCycles)
+	UE_TRACE_EVENT_FIELD(uint64, Lock)
+	UE_TRACE_EVENT_FIELD(uint32, NumWaiters)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Lock, EventWait)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, WaitCycles)
+	UE_TRACE_EVENT_FIELD(uint64, Event)
+	UE_TRACE_EVENT_FIELD(bool, Signaled)
+UE_TRACE_EVENT_END()
+
+uint64 FLockTrace::BeginWait(FLockTraceState& State)
+{
+	FPlatformAtomics::InterlockedIncrement(&State.NumWaiters);
+	return GetWaitStartCycles();
+}
+
+void FLockTrace::EndWait(const void* Lock, FLockTraceState& State, uint64 StartCycles, ELockTraceType Type, const void* CallSite)
+{
+	FPlatformAtomics::InterlockedDecrement(&State.NumWaiters);
+
+	// A zero start means the channel was disabled when the wait started
+	if (StartCycles == 0 || !UE_TRACE_CHANNELEXPR_IS_ENABLED(LockChannel))
+	{
+		return;
+	}
+
+	UE_TRACE_LOG(Lock, Contended, LockChannel)
+		<< Contended.Cycle(StartCycles)
+		<< Contended.WaitCycles(FPlatformTime::Cycles64() - StartCycles)
+		<< Contended.Lock(uint64(Lock))
+		<< Contended.CallSite(uint64(CallSite))
+		<< Contended.Type(uint8(Type));
+}
+
+void FLockTrace::Acquired(FLockTraceState& State)
+{
+	// Recursive locks are only timed from their outermost acquisition
+	if (State.RecursionCount++ == 0)
+	{
+		State.AcquireCycles = GetWaitStartCycles();
+	}
+}
+
+void FLockTrace::Released(const void* Lock, FLockTraceState& State)
+{
+	if (--State.RecursionCount != 0 || State.AcquireCycles == 0)
+	{
+		return;
+	}
+
+	const int32 NumWaiters = FPlatformAtomics::AtomicRead(&State.NumWaiters);
+	if (NumWaiters > 0 && UE_TRACE_CHANNELEXPR_IS_ENABLED(LockChannel))
+	{
+		UE_TRACE_LOG(Lock, Hold, LockChannel)
+			<< Hold.Cycle(State.AcquireCycles)
+			<< Hold.HoldCycles(FPlatformTime::Cycles64() - State.AcquireCycles)
+			<< Hold.Lock(uint64(Lock))
+			<< Hold.NumWaiters(uint32(NumWaiters));
+	}
+	State.AcquireCycles = 0;
+}
+
+void FLockTrace::EventWait(const void* Event, uint64 StartCycles, bool bSignaled)
+{
+	if (StartCycles == 0 || !UE_TRACE_CHANNELEXPR_IS_ENABLED(LockChannel))
+	{
+		return;
+	}
+
+	UE_TRACE_LOG(Lock, EventWait, LockChannel)
+		<< EventWait.Cycle(StartCycles)
+		<< EventWait.WaitCycles(FPlatformTime::Cycles64() - StartCycles)
+		<< EventWait.Event(uint64(Event))
+		<< EventWait.Signaled(bSignaled);
+}
+
+uint64 FLockTrace::GetWaitStartCycles()
+{
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(LockChannel) ? FPlatformTime::Cycles64() : 0;
+}
+
+#endif // LOCKTRACE_ENABLED
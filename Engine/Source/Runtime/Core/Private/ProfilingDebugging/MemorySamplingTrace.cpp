@@ -0,0 +1,423 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "ProfilingDebugging/MemorySamplingTrace.h"
+
+#if MEMORYSAMPLINGTRACE_ENABLED
+
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformStackWalk.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/CString.h"
+#include "Misc/ScopeLock.h"
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL(MemSamplingChannel)
+
+// A sampled allocation. Id identifies it in the matching Free event. The attachment is the array of uint64 program
+// counters, innermost frame first.
+UE_TRACE_EVENT_BEGIN(MemSampling, Alloc)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, Address)
+	UE_TRACE_EVENT_FIELD(uint64, Size)
+	UE_TRACE_EVENT_FIELD(uint32, Id)
+	UE_TRACE_EVENT_FIELD(uint32, SampleInterval)
+	UE_TRACE_EVENT_FIELD(uint32, SystemThreadId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MemSampling, Free)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Id)
+UE_TRACE_EVENT_END()
+
+// Sent once for each address seen in a sampled callstack. The attachment is the ANSI "Module!Function" name.
+UE_TRACE_EVENT_BEGIN(MemSampling, Symbol)
+	UE_TRACE_EVENT_FIELD(uint64, Address)
+UE_TRACE_EVENT_END()
+
+static int32 GMemSamplingInterval = 1000;
+static FAutoConsoleVariableRef CVarMemSamplingInterval(
+	TEXT("Trace.MemSampling.Interval"),
+	GMemSamplingInterval,
+	TEXT("On average, one in this many allocations is traced while the MemSampling trace channel is enabled.")
+);
+
+static int32 GMemSamplingAlwaysSampleSize = 1024 * 1024;
+static FAutoConsoleVariableRef CVarMemSamplingAlwaysSampleSize(
+	TEXT("Trace.MemSampling.AlwaysSampleSize"),
+	GMemSamplingAlwaysSampleSize,
+	TEXT("Allocations of at least this many bytes are always traced, as they are too rare to show up reliably in samples.")
+);
+
+static int32 GMemSamplingMaxSymbolsPerFrame = 256;
+static FAutoConsoleVariableRef CVarMemSamplingMaxSymbolsPerFrame(
+	TEXT("Trace.MemSampling.MaxSymbolsPerFrame"),
+	GMemSamplingMaxSymbolsPerFrame,
+	TEXT("Maximum number of callstack addresses resolved to names each frame, to spread the cost of resolving over several frames.")
+);
+
+/**
+ * FMalloc proxy which traces a random subset of allocations and the frees of those allocations.
+ *
+ * Each thread counts down the allocations until its next sample, with the gap drawn at random so that sampling
+ * doesn't alias with allocation patterns. The common case is a thread local decrement. Frees are looked up in a
+ * counting filter indexed by address hash, and only the (rare) frees which hit a non-zero slot take a lock to check
+ * the set of sampled addresses.
+ */
+class FMallocSamplingProxy final : public FMalloc
+{
+public:
+	explicit FMallocSamplingProxy(FMalloc* InMalloc)
+		: UsedMalloc(InMalloc)
+		, NextSampleId(0)
+	{
+		FreeFilter = (volatile int16*)UsedMalloc->Malloc(FreeFilterSize * sizeof(int16));
+		FMemory::Memzero((void*)FreeFilter, FreeFilterSize * sizeof(int16));
+	}
+
+	// FMalloc interface begin
+	virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+	{
+		void* Ptr = UsedMalloc->Malloc(Size, Alignment);
+		SampleAlloc(Ptr, Size);
+		return Ptr;
+	}
+
+	virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+	{
+		void* Ptr = UsedMalloc->TryMalloc(Size, Alignment);
+		SampleAlloc(Ptr, Size);
+		return Ptr;
+	}
+
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		// The free is handled first since the address may be handed out to another thread as soon as it is released.
+		// A realloc is treated as a new allocation, so a sampled block which is grown is sampled again with its new size.
+		TrackFree(Ptr);
+		void* NewPtr = UsedMalloc->Realloc(Ptr, NewSize, Alignment);
+		SampleAlloc(NewPtr, NewSize);
+		return NewPtr;
+	}
+
+	virtual void* TryRealloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		TrackFree(Ptr);
+		void* NewPtr = UsedMalloc->TryRealloc(Ptr, NewSize, Alignment);
+		SampleAlloc(NewPtr, NewSize);
+		return NewPtr;
+	}
+
+	virtual void Free(void* Ptr) override
+	{
+		TrackFree(Ptr);
+		UsedMalloc->Free(Ptr);
+	}
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		return UsedMalloc->QuantizeSize(Count, Alignment);
+	}
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{
+		return UsedMalloc->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual void Trim(bool bTrimThreadCaches) override
+	{
+		UsedMalloc->Trim(bTrimThreadCaches);
+	}
+
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->SetupTLSCachesOnCurrentThread();
+	}
+
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
+	virtual void InitializeStatsMetadata() override
+	{
+		UsedMalloc->InitializeStatsMetadata();
+	}
+
+	virtual bool Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar) override
+	{
+		return UsedMalloc->Exec(InWorld, Cmd, Ar);
+	}
+
+	virtual void UpdateStats() override
+	{
+		UsedMalloc->UpdateStats();
+	}
+
+	virtual void GetAllocatorStats(FGenericMemoryStats& out_Stats) override
+	{
+		UsedMalloc->GetAllocatorStats(out_Stats);
+	}
+
+	virtual void DumpAllocatorStats(class FOutputDevice& Ar) override
+	{
+		UsedMalloc->DumpAllocatorStats(Ar);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return UsedMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual bool ValidateHeap() override
+	{
+		return UsedMalloc->ValidateHeap();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		return UsedMalloc->GetDescriptiveName();
+	}
+
+	virtual void OnMallocInitialized() override
+	{
+		UsedMalloc->OnMallocInitialized();
+	}
+	// FMalloc interface end
+
+	void UpdateSymbols()
+	{
+		TArray<uint64> Addresses;
+		{
+			FGuardSampling Guard;
+			FScopeLock Lock(&SymbolsCritical);
+			const int32 NumToResolve = FMath::Min(PendingSymbols.Num(), FMath::Max(GMemSamplingMaxSymbolsPerFrame, 1));
+			Addresses.Append(PendingSymbols.GetData(), NumToResolve);
+			PendingSymbols.RemoveAt(0, NumToResolve, false);
+		}
+
+		// Resolving may allocate, which is fine as long as no lock is held.
+		for (uint64 Address : Addresses)
+		{
+			TraceSymbol(Address);
+		}
+	}
+
+private:
+	enum
+	{
+		MaxFrames = 64,
+		NumShards = 16,
+		FreeFilterBits = 18,
+		FreeFilterSize = 1 << FreeFilterBits,
+	};
+
+	/** Keeps the proxy's own allocations (and anything they trigger) from being sampled or looked up. */
+	struct FGuardSampling
+	{
+		FGuardSampling() { ++Depth; }
+		~FGuardSampling() { --Depth; }
+		static bool IsActive() { return Depth != 0; }
+
+		static thread_local int32 Depth;
+	};
+
+	struct FShard
+	{
+		FCriticalSection Critical;
+		TMap<uint64, uint32> AddressToId;
+	};
+
+	static FORCEINLINE uint32 HashAddress(uint64 Address)
+	{
+		// Allocations are at least 16 byte aligned so the low bits carry no information
+		return uint32(((Address >> 4) * 0x9E3779B97F4A7C15ull) >> (64 - FreeFilterBits));
+	}
+
+	FORCEINLINE void SampleAlloc(void* Ptr, SIZE_T Size)
+	{
+		if (Ptr == nullptr)
+		{
+			return;
+		}
+
+		if (Size >= SIZE_T(GMemSamplingAlwaysSampleSize))
+		{
+			SampleAllocSlow(Ptr, Size, 1);
+		}
+		else if (--AllocsUntilSample <= 0)
+		{
+			// Also reached on each thread's first allocation, which picks its first gap
+			const uint32 Interval = uint32(FMath::Max(GMemSamplingInterval, 1));
+			AllocsUntilSample = DrawAllocsUntilSample(Interval);
+			SampleAllocSlow(Ptr, Size, Interval);
+		}
+	}
+
+	FORCEINLINE void TrackFree(void* Ptr)
+	{
+		if (Ptr != nullptr && FPlatformAtomics::AtomicRead_Relaxed(&FreeFilter[HashAddress(uint64(Ptr))]) != 0 && !FGuardSampling::IsActive())
+		{
+			TrackFreeSlow(uint64(Ptr));
+		}
+	}
+
+	FORCENOINLINE void SampleAllocSlow(void* Ptr, SIZE_T Size, uint32 Interval)
+	{
+		if (FGuardSampling::IsActive() || !UE_TRACE_CHANNELEXPR_IS_ENABLED(MemSamplingChannel))
+		{
+			return;
+		}
+
+		FGuardSampling Guard;
+
+		uint64 Frames[MaxFrames + SkipFrames];
+		const uint32 NumCaptured = FPlatformStackWalk::CaptureStackBackTrace(Frames, MaxFrames + SkipFrames);
+		const uint32 NumFrames = NumCaptured > SkipFrames ? NumCaptured - SkipFrames : 0;
+		QueueSymbols(Frames + SkipFrames, NumFrames);
+
+		const uint64 Address = uint64(Ptr);
+		const uint32 Id = uint32(FPlatformAtomics::InterlockedIncrement(&NextSampleId));
+		const uint32 HashIndex = HashAddress(Address);
+		{
+			FShard& Shard = Shards[HashIndex % NumShards];
+			FScopeLock Lock(&Shard.Critical);
+			Shard.AddressToId.Add(Address, Id);
+		}
+		FPlatformAtomics::InterlockedIncrement(&FreeFilter[HashIndex]);
+
+		const uint16 FramesSize = uint16(NumFrames * sizeof(uint64));
+		UE_TRACE_LOG(MemSampling, Alloc, MemSamplingChannel, FramesSize)
+			<< Alloc.Cycle(FPlatformTime::Cycles64())
+			<< Alloc.Address(Address)
+			<< Alloc.Size(uint64(Size))
+			<< Alloc.Id(Id)
+			<< Alloc.SampleInterval(Interval)
+			<< Alloc.SystemThreadId(FPlatformTLS::GetCurrentThreadId())
+			<< Alloc.Attachment(Frames + SkipFrames, FramesSize);
+	}
+
+	FORCENOINLINE void TrackFreeSlow(uint64 Address)
+	{
+		FGuardSampling Guard;
+
+		// The filter only says the address might have been sampled
+		const uint32 HashIndex = HashAddress(Address);
+		uint32 Id;
+		{
+			FShard& Shard = Shards[HashIndex % NumShards];
+			FScopeLock Lock(&Shard.Critical);
+			if (!Shard.AddressToId.RemoveAndCopyValue(Address, Id))
+			{
+				return;
+			}
+		}
+		FPlatformAtomics::InterlockedDecrement(&FreeFilter[HashIndex]);
+
+		// Sampled while the channel was enabled; if it has been disabled since then the free is simply not sent.
+		UE_TRACE_LOG(MemSampling, Free, MemSamplingChannel)
+			<< Free.Cycle(FPlatformTime::Cycles64())
+			<< Free.Id(Id);
+	}
+
+	int32 DrawAllocsUntilSample(uint32 Interval)
+	{
+		if (Interval <= 1)
+		{
+			return 1;
+		}
+
+		// Geometric distribution, the number of allocations up to and including the next one which passes a 1/Interval
+		// chance. xorshift32 per thread, since FMath::Rand isn't thread safe and this must not allocate.
+		if (RandomState == 0)
+		{
+			RandomState = (FPlatformTLS::GetCurrentThreadId() * 0x9E3779B9u) ^ uint32(FPlatformTime::Cycles64()) | 1;
+		}
+		RandomState ^= RandomState << 13;
+		RandomState ^= RandomState >> 17;
+		RandomState ^= RandomState << 5;
+
+		const double Uniform = (double(RandomState) + 1.0) / 4294967296.0;
+		const double Gap = 1.0 + FMath::FloorToDouble(FMath::Loge(Uniform) / FMath::Loge(1.0 - 1.0 / double(Interval)));
+		return int32(FMath::Min(Gap, double(MAX_int32)));
+	}
+
+	void QueueSymbols(const uint64* Frames, uint32 NumFrames)
+	{
+		FScopeLock Lock(&SymbolsCritical);
+		for (uint32 Index = 0; Index < NumFrames; ++Index)
+		{
+			bool bAlreadyKnown = false;
+			KnownAddresses.Add(Frames[Index], &bAlreadyKnown);
+			if (!bAlreadyKnown)
+			{
+				PendingSymbols.Add(Frames[Index]);
+			}
+		}
+	}
+
+	static void TraceSymbol(uint64 Address)
+	{
+		FProgramCounterSymbolInfo SymbolInfo;
+		FPlatformStackWalk::ProgramCounterToSymbolInfo(Address, SymbolInfo);
+
+		ANSICHAR Name[512];
+		if (SymbolInfo.FunctionName[0] != '\0')
+		{
+			FCStringAnsi::Snprintf(Name, sizeof(Name), "%s!%s", SymbolInfo.ModuleName, SymbolInfo.FunctionName);
+		}
+		else
+		{
+			FCStringAnsi::Snprintf(Name, sizeof(Name), "%s!0x%llx", SymbolInfo.ModuleName, (unsigned long long)Address);
+		}
+
+		const uint16 NameSize = uint16(FCStringAnsi::Strlen(Name) + 1);
+		UE_TRACE_LOG(MemSampling, Symbol, MemSamplingChannel, NameSize)
+			<< Symbol.Address(Address)
+			<< Symbol.Attachment(Name, NameSize);
+	}
+
+	/** Frames inside the proxy (SampleAllocSlow and the FMalloc entry point) */
+	static const uint32 SkipFrames = 2;
+
+	static thread_local int32 AllocsUntilSample;
+	static thread_local uint32 RandomState;
+
+	FMalloc* UsedMalloc;
+	volatile int16* FreeFilter;
+	volatile int32 NextSampleId;
+	FShard Shards[NumShards];
+
+	FCriticalSection SymbolsCritical;
+	TSet<uint64> KnownAddresses;
+	TArray<uint64> PendingSymbols;
+};
+
+thread_local int32 FMallocSamplingProxy::FGuardSampling::Depth = 0;
+thread_local int32 FMallocSamplingProxy::AllocsUntilSample = 0;
+thread_local uint32 FMallocSamplingProxy::RandomState = 0;
+
+static FMallocSamplingProxy* GMallocSamplingProxy = nullptr;
+
+FMalloc* FMemorySamplingTrace::OverrideIfEnabled(FMalloc* InUsedAlloc)
+{
+	if (GMallocSamplingProxy == nullptr && UE_TRACE_CHANNELEXPR_IS_ENABLED(MemSamplingChannel))
+	{
+		GMallocSamplingProxy = new FMallocSamplingProxy(InUsedAlloc);
+		return GMallocSamplingProxy;
+	}
+	return InUsedAlloc;
+}
+
+void FMemorySamplingTrace::Update()
+{
+	if (GMallocSamplingProxy != nullptr)
+	{
+		GMallocSamplingProxy->UpdateSymbols();
+	}
+}
+
+#endif // MEMORYSAMPLINGTRACE_ENABLED
@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "ProfilingDebugging/TaskGraphTrace.h"
+
+#if TASKGRAPHTRACE_ENABLED
+
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformTime.h"
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL_DEFINE(TaskGraphChannel)
+
+UE_TRACE_EVENT_BEGIN(TaskGraph, Created)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TaskId)
+	UE_TRACE_EVENT_FIELD(uint64, CompletesTaskId)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadToExecuteOn)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(TaskGraph, Prerequisite)
+	UE_TRACE_EVENT_FIELD(uint64, TaskId)
+	UE_TRACE_EVENT_FIELD(uint64, PrerequisiteTaskId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(TaskGraph, Started)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TaskId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(TaskGraph, Finished)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TaskId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(TaskGraph, Completed)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TaskId)
+UE_TRACE_EVENT_END()
+
+// The attachment is the array of uint64 ids of the tasks waited for.
+UE_TRACE_EVENT_BEGIN(TaskGraph, WaitBegin)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(TaskGraph, WaitEnd)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+UE_TRACE_EVENT_END()
+
+static volatile int64 GNextTaskGraphTraceId = 0;
+
+uint64 FTaskGraphTrace::NewTaskId()
+{
+	return uint64(FPlatformAtomics::InterlockedIncrement(&GNextTaskGraphTraceId));
+}
+
+void FTaskGraphTrace::Created(uint64 TaskId, uint64 CompletesTaskId, uint32 ThreadToExecuteOn)
+{
+	UE_TRACE_LOG(TaskGraph, Created, TaskGraphChannel)
+		<< Created.Cycle(FPlatformTime::Cycles64())
+		<< Created.TaskId(TaskId)
+		<< Created.CompletesTaskId(CompletesTaskId)
+		<< Created.ThreadToExecuteOn(ThreadToExecuteOn);
+}
+
+void FTaskGraphTrace::Prerequisite(uint64 TaskId, uint64 PrerequisiteTaskId)
+{
+	UE_TRACE_LOG(TaskGraph, Prerequisite, TaskGraphChannel)
+		<< Prerequisite.TaskId(TaskId)
+		<< Prerequisite.PrerequisiteTaskId(PrerequisiteTaskId);
+}
+
+void FTaskGraphTrace::Started(uint64 TaskId)
+{
+	UE_TRACE_LOG(TaskGraph, Started, TaskGraphChannel)
+		<< Started.Cycle(FPlatformTime::Cycles64())
+		<< Started.TaskId(TaskId);
+}
+
+void FTaskGraphTrace::Finished(uint64 TaskId)
+{
+	UE_TRACE_LOG(TaskGraph, Finished, TaskGraphChannel)
+		<< Finished.Cycle(FPlatformTime::Cycles64())
+		<< Finished.TaskId(TaskId);
+}
+
+void FTaskGraphTrace::Completed(uint64 TaskId)
+{
+	UE_TRACE_LOG(TaskGraph, Completed, TaskGraphChannel)
+		<< Completed.Cycle(FPlatformTime::Cycles64())
+		<< Completed.TaskId(TaskId);
+}
+
+void FTaskGraphTrace::WaitBegin(const uint64* TaskIds, uint32 NumTaskIds)
+{
+	const uint32 IdsSize = NumTaskIds * sizeof(uint64);
+	UE_TRACE_LOG(TaskGraph, WaitBegin, TaskGraphChannel, IdsSize)
+		<< WaitBegin.Cycle(FPlatformTime::Cycles64())
+		<< WaitBegin.Attachment(TaskIds, IdsSize);
+}
+
+void FTaskGraphTrace::WaitEnd()
+{
+	UE_TRACE_LOG(TaskGraph, WaitEnd, TaskGraphChannel)
+		<< WaitEnd.Cycle(FPlatformTime::Cycles64());
+}
+
+#endif // TASKGRAPHTRACE_ENABLED
@@ -14,6 +14,7 @@
 #include "HAL/FileManager.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/App.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/CoreDelegates.h"
@@ -22,6 +23,8 @@
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 #include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuSamplingTrace.h"
+#include "ProfilingDebugging/MemorySamplingTrace.h"
 #include "ProfilingDebugging/MiscTrace.h"
 #include "ProfilingDebugging/PlatformFileTrace.h"
 #include "String/ParseTokens.h"
@@ -49,6 +52,8 @@ public:
 	template <class T> void	ReadChannels(T&& Callback) const;
 	void					AddChannels(const TCHAR* ChannelList);
 	bool					Connect(ETraceConnectType Type, const TCHAR* Parameter);
+	void					StartTail();
+	bool					WriteSnapshot(const TCHAR* Path);
 	void					EnableChannels();
 	void					DisableChannels();
 
@@ -68,8 +73,10 @@ private:
 
 	void					AddChannel(const TCHAR* Name);
 	void					AddChannels(const TCHAR* Name, bool bResolvePresets);
+	void					AddDefaultChannels();
 	void					EnableChannel(FChannel& Channel);
 	bool					SendToHost(const TCHAR* Host);
+	bool					GetWritePath(const TCHAR* Path, FString& OutNativePath);
 	bool					WriteToFile(const TCHAR* Path=nullptr);
 
 	TMap<uint32, FChannel>	Channels;
@@ -159,21 +166,61 @@ bool FTraceAuxiliaryImpl::Connect(ETraceConnectType Type, const TCHAR* Parameter
 	// some defaults for the user. Less futzing.
 	if (!Channels.Num())
 	{
-		FString Value;
-		if (!GConfig->GetString(TEXT("Trace.ChannelPresets"), TEXT("Default"), Value, GEngineIni))
-		{
-			Value = TEXT("cpu,frame,log,bookmark");
-		}
+		AddDefaultChannels();
+	}
 
-		AddChannels(*Value);
+	EnableChannels();
+
+	State = EState::Tracing;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void FTraceAuxiliaryImpl::StartTail()
+{
+	// Like Connect(), but there is nowhere to send the data. It is just kept in
+	// Trace's tail until a snapshot is written.
+	if (!Channels.Num())
+	{
+		AddDefaultChannels();
 	}
 
 	EnableChannels();
 
 	State = EState::Tracing;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool FTraceAuxiliaryImpl::WriteSnapshot(const TCHAR* Path)
+{
+	FString NativePath;
+	if (!GetWritePath(Path, NativePath))
+	{
+		return false;
+	}
+
+	if (!Trace::WriteSnapshotTo(*NativePath))
+	{
+		UE_LOG(LogCore, Warning, TEXT("Unable to write trace snapshot to '%s'"), *NativePath);
+		return false;
+	}
+
+	UE_LOG(LogCore, Log, TEXT("Writing trace snapshot to '%s'"), *NativePath);
 	return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void FTraceAuxiliaryImpl::AddDefaultChannels()
+{
+	FString Value;
+	if (!GConfig->GetString(TEXT("Trace.ChannelPresets"), TEXT("Default"), Value, GEngineIni))
+	{
+		Value = TEXT("cpu,frame,log,bookmark");
+	}
+
+	AddChannels(*Value);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void FTraceAuxiliaryImpl::EnableChannel(FChannel& Channel)
 {
@@ -232,11 +279,31 @@ bool FTraceAuxiliaryImpl::SendToHost(const TCHAR* Host)
 
 ////////////////////////////////////////////////////////////////////////////////
 bool FTraceAuxiliaryImpl::WriteToFile(const TCHAR* Path)
+{
+	FString NativePath;
+	if (!GetWritePath(Path, NativePath))
+	{
+		return false;
+	}
+
+	// Finally, tell trace to write the trace to a file.
+	if (!Trace::WriteTo(*NativePath))
+	{
+		UE_LOG(LogCore, Warning, TEXT("Unable to trace to file '%s'"), *NativePath);
+		return false;
+	}
+
+	TraceDest = MoveTemp(NativePath);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool FTraceAuxiliaryImpl::GetWritePath(const TCHAR* Path, FString& OutNativePath)
 {
 	if (Path == nullptr || *Path == '\0')
 	{
 		FString Name = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S.utrace"));
-		return WriteToFile(*Name);
+		return GetWritePath(*Name, OutNativePath);
 	}
 
 	FString WritePath;
@@ -274,15 +341,7 @@ bool FTraceAuxiliaryImpl::WriteToFile(const TCHAR* Path)
 		return false;
 	}
 
-	// Finally, tell trace to write the trace to a file.
-	FString NativePath = FileManager.ConvertToAbsolutePathForExternalAppForWrite(*WritePath);
-	if (!Trace::WriteTo(*NativePath))
-	{
-		UE_LOG(LogCore, Warning, TEXT("Unable to trace to file '%s'"), *WritePath);
-		return false;
-	}
-
-	TraceDest = MoveTemp(NativePath);
+	OutNativePath = FileManager.ConvertToAbsolutePathForExternalAppForWrite(*WritePath);
 	return true;
 }
 
@@ -340,6 +399,61 @@ static void TraceAuxiliaryStop()
 	UE_LOG(LogConsoleResponse, Log, TEXT("Tracing stopped. Use 'Trace.Start' to resume"));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+static void TraceAuxiliarySnapshot(const TArray<FString>& Args)
+{
+	if (!GTraceAuxiliary.WriteSnapshot(Args.Num() > 0 ? *(Args[0]) : nullptr))
+	{
+		UE_LOG(LogConsoleResponse, Warning, TEXT("Failed to write a trace snapshot. Is -tracetail=<MB> set?"));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static float GTraceSnapshotHitchThresholdMs = 0.0f;
+static FAutoConsoleVariableRef CVarTraceSnapshotHitchThresholdMs(
+	TEXT("Trace.Snapshot.HitchThresholdMs"),
+	GTraceSnapshotHitchThresholdMs,
+	TEXT("When -tracetail is in use, a frame taking longer than this writes a trace snapshot to the profiling directory. Zero disables.")
+);
+
+static float GTraceSnapshotCooldown = 60.0f;
+static FAutoConsoleVariableRef CVarTraceSnapshotCooldown(
+	TEXT("Trace.Snapshot.Cooldown"),
+	GTraceSnapshotCooldown,
+	TEXT("Minimum number of seconds between hitch-triggered trace snapshots.")
+);
+
+////////////////////////////////////////////////////////////////////////////////
+static void TraceAuxiliaryUpdateHitchSnapshot()
+{
+	static double LastEndFrameTime = 0.0;
+	static double LastSnapshotTime = 0.0;
+
+	const double Now = FPlatformTime::Seconds();
+	const double FrameTimeMs = (Now - LastEndFrameTime) * 1000.0;
+	const bool bFirstFrame = (LastEndFrameTime == 0.0);
+	LastEndFrameTime = Now;
+
+	if (bFirstFrame || GTraceSnapshotHitchThresholdMs <= 0.0f || FrameTimeMs < GTraceSnapshotHitchThresholdMs)
+	{
+		return;
+	}
+
+	if (LastSnapshotTime != 0.0 && Now - LastSnapshotTime < GTraceSnapshotCooldown)
+	{
+		return;
+	}
+
+	// The snapshot is written by Trace's worker, so the hitching frame's events
+	// have been drained into the tail by the time it is written out.
+	UE_LOG(LogCore, Log, TEXT("Frame took %.1fms, writing a trace snapshot"), FrameTimeMs);
+	FString Name = FDateTime::Now().ToString(TEXT("Hitch_%Y%m%d_%H%M%S.utrace"));
+	if (GTraceAuxiliary.WriteSnapshot(*Name))
+	{
+		LastSnapshotTime = Now;
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 static FAutoConsoleCommand TraceAuxiliaryStartCmd(
 	TEXT("Trace.Start"),
@@ -357,6 +471,16 @@ static FAutoConsoleCommand TraceAuxiliaryStopCmd(
 	FConsoleCommandDelegate::CreateStatic(TraceAuxiliaryStop)
 );
 
+////////////////////////////////////////////////////////////////////////////////
+static FAutoConsoleCommand TraceAuxiliarySnapshotCmd(
+	TEXT("Trace.Snapshot"),
+	TEXT(
+		"Writes the trace data held in memory to a file; Trace.Snapshot [Path]."
+		" Only available when the process was started with -tracetail=<MB>."
+	),
+	FConsoleCommandWithArgsDelegate::CreateStatic(TraceAuxiliarySnapshot)
+);
+
 #endif // UE_TRACE_ENABLED
 
 
@@ -389,12 +513,26 @@ void FTraceAuxiliary::Initialize(const TCHAR* CommandLine)
 		<< Session2.ConfigurationType(uint8(FApp::GetBuildConfiguration()))
 		<< Session2.TargetType(uint8(FApp::GetBuildTargetType()));
 
+	// Optionally keep the most recent trace data in memory so that snapshots of
+	// it can be written out (on hitches, or with Trace.Snapshot) without needing
+	// to trace everything to a file or host.
+	int32 TailSizeMB = 0;
+	FParse::Value(CommandLine, TEXT("-tracetail="), TailSizeMB);
+
 	// Initialize Trace
 	Trace::FInitializeDesc Desc;
 	Desc.bUseWorkerThread = FPlatformProcess::SupportsMultithreading();
+	Desc.TailSizeBytes = uint32(FMath::Clamp(TailSizeMB, 0, 1024)) << 20;
 	Trace::Initialize(Desc);
 
 	FCoreDelegates::OnEndFrame.AddStatic(Trace::Update);
+#if CPUSAMPLINGTRACE_ENABLED
+	FCoreDelegates::OnEndFrame.AddStatic(FCpuSamplingTrace::Update);
+	FCoreDelegates::OnPreExit.AddStatic(FCpuSamplingTrace::Shutdown);
+#endif
+#if MEMORYSAMPLINGTRACE_ENABLED
+	FCoreDelegates::OnEndFrame.AddStatic(FMemorySamplingTrace::Update);
+#endif
 	FModuleManager::Get().OnModulesChanged().AddLambda([](FName Name, EModuleChangeReason Reason){
 		if (Reason == EModuleChangeReason::ModuleLoaded)
 		{
@@ -410,6 +548,12 @@ void FTraceAuxiliary::Initialize(const TCHAR* CommandLine)
 		GTraceAuxiliary.EnableChannels();
 	}
 
+	if (Desc.TailSizeBytes)
+	{
+		GTraceAuxiliary.StartTail();
+		FCoreDelegates::OnEndFrame.AddStatic(TraceAuxiliaryUpdateHitchSnapshot);
+	}
+
 	// Attempt to send trace data somewhere from the command line
 	if (FParse::Value(CommandLine, TEXT("-tracehost="), Parameter))
 	{
@@ -437,6 +581,16 @@ void FTraceAuxiliary::EnableChannels()
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+bool FTraceAuxiliary::WriteSnapshot(const TCHAR* Path)
+{
+#if UE_TRACE_ENABLED
+	return GTraceAuxiliary.WriteSnapshot(Path);
+#else
+	return false;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void FTraceAuxiliary::TryAutoConnect()
 {
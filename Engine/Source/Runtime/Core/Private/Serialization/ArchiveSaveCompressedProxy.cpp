@@ -5,9 +5,21 @@
 #include "HAL/UnrealMemory.h"
 #include "Logging/LogMacros.h"
 #include "CoreGlobals.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MemoryWriter.h"
 
 PRAGMA_DISABLE_UNSAFE_TYPECAST_WARNINGS
 
+static int32 GSaveCompressedProxyParallelBlocks = 8;
+static FAutoConsoleVariableRef CVarSaveCompressedProxyParallelBlocks(
+	TEXT("s.SaveCompressedProxyParallelBlocks"),
+	GSaveCompressedProxyParallelBlocks,
+	TEXT("Number of compression blocks FArchiveSaveCompressedProxy buffers and compresses in parallel. 1 compresses each block on the calling thread as it fills up."),
+	ECVF_Default
+);
+
 /*----------------------------------------------------------------------------
 	FArchiveSaveCompressedProxy
 ----------------------------------------------------------------------------*/
@@ -28,9 +40,12 @@ FArchiveSaveCompressedProxy::FArchiveSaveCompressedProxy(TArray<uint8>& InCompre
 	RawBytesSerialized					= 0;
 	CurrentIndex						= 0;
 
+	// Blocks are compressed independently, so several can be buffered and compressed in parallel.
+	NumParallelBlocks = FApp::ShouldUseThreadingForPerformance() ? FMath::Max(GSaveCompressedProxyParallelBlocks, 1) : 1;
+
 	// Allocate temporary memory.
-	TmpDataStart	= (uint8*) FMemory::Malloc(LOADING_COMPRESSION_CHUNK_SIZE);
-	TmpDataEnd		= TmpDataStart + LOADING_COMPRESSION_CHUNK_SIZE;
+	TmpDataStart	= (uint8*) FMemory::Malloc(LOADING_COMPRESSION_CHUNK_SIZE * NumParallelBlocks);
+	TmpDataEnd		= TmpDataStart + LOADING_COMPRESSION_CHUNK_SIZE * NumParallelBlocks;
 	TmpData			= TmpDataStart;
 }
 
@@ -51,11 +66,38 @@ FArchiveSaveCompressedProxy::~FArchiveSaveCompressedProxy()
  */
 void FArchiveSaveCompressedProxy::Flush()
 {
-	if( TmpData - TmpDataStart > 0 )
+	const int64 BufferedBytes = TmpData - TmpDataStart;
+	if( BufferedBytes > LOADING_COMPRESSION_CHUNK_SIZE )
+	{
+		// Compress each block into its own array on a worker, then append them in order. The output is the same as
+		// flushing every LOADING_COMPRESSION_CHUNK_SIZE bytes, which is what FArchiveLoadCompressedProxy expects.
+		const int32 NumBlocks = (int32)((BufferedBytes + LOADING_COMPRESSION_CHUNK_SIZE - 1) / LOADING_COMPRESSION_CHUNK_SIZE);
+		TArray<TArray<uint8>> CompressedBlocks;
+		CompressedBlocks.SetNum(NumBlocks);
+
+		ParallelFor(NumBlocks, [this, BufferedBytes, &CompressedBlocks](int32 BlockIndex)
+		{
+			const int64 BlockOffset = (int64)BlockIndex * LOADING_COMPRESSION_CHUNK_SIZE;
+			const int64 BlockSize = FMath::Min<int64>(BufferedBytes - BlockOffset, LOADING_COMPRESSION_CHUNK_SIZE);
+
+			FMemoryWriter BlockWriter(CompressedBlocks[BlockIndex]);
+			BlockWriter.SerializeCompressed(TmpDataStart + BlockOffset, BlockSize, CompressionFormat, CompressionFlags);
+		});
+
+		bShouldSerializeToArray = true;
+		for( TArray<uint8>& CompressedBlock : CompressedBlocks )
+		{
+			Serialize( CompressedBlock.GetData(), CompressedBlock.Num() );
+		}
+		bShouldSerializeToArray = false;
+		// Buffer is drained, reset.
+		TmpData	= TmpDataStart;
+	}
+	else if( BufferedBytes > 0 )
 	{
 		// This will call Serialize so we need to indicate that we want to serialize to array.
 		bShouldSerializeToArray = true;
-		SerializeCompressed( TmpDataStart, TmpData - TmpDataStart, CompressionFormat, CompressionFlags);
+		SerializeCompressed( TmpDataStart, BufferedBytes, CompressionFormat, CompressionFlags);
 		bShouldSerializeToArray = false;
 		// Buffer is drained, reset.
 		TmpData	= TmpDataStart;
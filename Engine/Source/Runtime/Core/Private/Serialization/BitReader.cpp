@@ -146,7 +146,8 @@ void FBitReader::SetData( uint8* Src, int64 CountBits )
 	Pos			= 0;
 	ClearError();
 
-	Buffer.Empty();
+	// Reset rather than Empty, so readers that are reused for every packet keep their allocation
+	Buffer.Reset();
 	Buffer.AddUninitialized( (Num+7)>>3 );
 	
 	if (Src != nullptr)
@@ -184,9 +185,14 @@ void FBitReader::SetData( FBitReader& Src, int64 CountBits )
 	this->SetEngineNetVer(Src.EngineNetVer());
 	this->SetGameNetVer(Src.GameNetVer());
 
-	Buffer.Empty();
+	Buffer.Reset();
 	Buffer.AddUninitialized( (CountBits+7)>>3 );
 	Src.SerializeBits(Buffer.GetData(), CountBits);
+
+	if (Num & 7)
+	{
+		Buffer[Num >> 3] &= GMask[Num & 7];
+	}
 }
 
 /** This appends data from another BitReader. It checks that this bit reader is byte-aligned so it can just do a TArray::Append instead of a bitcopy.
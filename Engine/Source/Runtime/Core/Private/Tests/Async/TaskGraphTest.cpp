@@ -9,6 +9,7 @@
 #include "Async/TaskGraphInterfaces.h"
 #include "Async/ParallelFor.h"
 #include "HAL/ThreadHeartBeat.h"
+#include "HAL/IConsoleManager.h"
 #include "ProfilingDebugging/ScopedTimers.h"
 #include "Math/RandomStream.h"
 #include "Containers/CircularQueue.h"
@@ -824,6 +825,90 @@ namespace TaskGraphTests
 		return true;
 	}
 
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWorkStealingTest, "System.Core.Async.TaskGraph.WorkStealing", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+	bool FWorkStealingTest::RunTest(const FString& Parameters)
+	{
+		IConsoleVariable* UseWorkStealingCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("TaskGraph.UseWorkStealing"));
+		if (!UseWorkStealingCVar)
+		{
+			return false;
+		}
+
+		const int32 OldUseWorkStealing = UseWorkStealingCVar->GetInt();
+		UseWorkStealingCVar->Set(1);
+
+		const int32 NumParents = 64;
+		const int32 NumChildren = 64;
+		std::atomic<int32> NumExecuted{ 0 };
+
+		// fan-out from worker threads, so the children go through the worker deques
+		FGraphEventArray Parents;
+		for (int32 ParentIndex = 0; ParentIndex < NumParents; ParentIndex++)
+		{
+			Parents.Add(FFunctionGraphTask::CreateAndDispatchWhenReady(
+				[&NumExecuted, NumChildren](ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+				{
+					for (int32 ChildIndex = 0; ChildIndex < NumChildren; ChildIndex++)
+					{
+						MyCompletionGraphEvent->DontCompleteUntil(FFunctionGraphTask::CreateAndDispatchWhenReady(
+							[&NumExecuted]
+							{
+								++NumExecuted;
+							}
+						));
+					}
+				}
+			));
+		}
+
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(Parents, ENamedThreads::GameThread);
+
+		UseWorkStealingCVar->Set(OldUseWorkStealing);
+
+		TestEqual(TEXT("All child tasks must have been executed"), NumExecuted.load(), NumParents * NumChildren);
+
+		return true;
+	}
+
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelForAdaptiveTest, "System.Core.Async.TaskGraph.ParallelForAdaptive", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+	bool FParallelForAdaptiveTest::RunTest(const FString& Parameters)
+	{
+		const int32 NumOuter = 37;
+		const int32 NumInner = 1001;
+		TArray<int32> NumCalls;
+		NumCalls.SetNumZeroed(NumOuter * NumInner);
+
+		// uneven per item cost, with nested adaptive ParallelFor calls from the worker threads
+		ParallelFor(NumOuter,
+			[&NumCalls, NumInner](int32 OuterIndex)
+			{
+				ParallelFor(NumInner,
+					[&NumCalls, NumInner, OuterIndex](int32 InnerIndex)
+					{
+						if ((InnerIndex % 97) == 0)
+						{
+							FPlatformProcess::Sleep(0.0001f);
+						}
+						FPlatformAtomics::InterlockedIncrement(&NumCalls[OuterIndex * NumInner + InnerIndex]);
+					},
+					EParallelForFlags::Adaptive
+				);
+			},
+			EParallelForFlags::Adaptive
+		);
+
+		int32 NumWrongCalls = 0;
+		for (int32 Calls : NumCalls)
+		{
+			NumWrongCalls += (Calls != 1);
+		}
+		TestEqual(TEXT("Every index must be processed exactly once"), NumWrongCalls, 0);
+
+		return true;
+	}
+
 	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTaskGraphRecursionTest, "System.Core.Async.TaskGraph.RecursionTest", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter | EAutomationTestFlags::Disabled);
 
 	bool FTaskGraphRecursionTest::RunTest(const FString& Parameters)
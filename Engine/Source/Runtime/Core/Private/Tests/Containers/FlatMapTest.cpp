@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/FlatMap.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlatMapTest, "System.Core.Containers.FlatMap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+
+bool FFlatMapTest::RunTest( const FString& Parameters )
+{
+	// random operations checked against TMap, with key ranges small enough to produce many deleted slots
+	for (int32 KeyRange : { 100000, 5000, 40 })
+	{
+		TFlatMap<int32, FString> FlatMap;
+		TMap<int32, FString> Reference;
+		FRandomStream Random(KeyRange);
+
+		bool bMatches = true;
+		for (int32 Iteration = 0; Iteration < 100000 && bMatches; ++Iteration)
+		{
+			const int32 Key = Random.RandHelper(KeyRange);
+
+			switch (Random.RandHelper(3))
+			{
+			case 0:
+				FlatMap.Add(Key, FString::FromInt(Iteration));
+				Reference.Add(Key, FString::FromInt(Iteration));
+				break;
+
+			case 1:
+				bMatches = (FlatMap.Remove(Key) == Reference.Remove(Key));
+				break;
+
+			default:
+				{
+					const FString* FlatValue = FlatMap.Find(Key);
+					const FString* ReferenceValue = Reference.Find(Key);
+					bMatches = (FlatValue == nullptr) == (ReferenceValue == nullptr) && (FlatValue == nullptr || *FlatValue == *ReferenceValue);
+				}
+				break;
+			}
+
+			bMatches = bMatches && FlatMap.Num() == Reference.Num();
+		}
+
+		TestTrue(TEXT("Adds, removes and finds must match TMap"), bMatches);
+
+		int32 NumIterated = 0;
+		for (const TPair<int32, FString>& Pair : FlatMap)
+		{
+			const FString* ReferenceValue = Reference.Find(Pair.Key);
+			bMatches = bMatches && ReferenceValue != nullptr && *ReferenceValue == Pair.Value;
+			++NumIterated;
+		}
+
+		TestTrue(TEXT("Iteration must visit every pair exactly once"), bMatches && NumIterated == Reference.Num());
+	}
+
+	// copies, moves and resets
+	{
+		TFlatMap<FString, int32> FlatMap;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			FlatMap.Add(FString::FromInt(Index), Index);
+		}
+
+		TFlatMap<FString, int32> Copy(FlatMap);
+		TFlatMap<FString, int32> Moved(MoveTemp(Copy));
+
+		bool bMatches = Copy.Num() == 0 && Moved.Num() == FlatMap.Num();
+		for (int32 Index = 0; Index < 1000 && bMatches; ++Index)
+		{
+			bMatches = Moved.FindChecked(FString::FromInt(Index)) == Index;
+		}
+
+		TestTrue(TEXT("Copied and moved maps must hold the same pairs"), bMatches);
+
+		FlatMap.FindOrAdd(TEXT("New")) += 5;
+		TestEqual(TEXT("FindOrAdd must add a default constructed value"), FlatMap.FindRef(TEXT("New")), 5);
+
+		FlatMap.Reset();
+		TestTrue(TEXT("A reset map must be empty"), FlatMap.IsEmpty() && !FlatMap.Contains(TEXT("0")));
+
+		FlatMap.Empty();
+		TestEqual(TEXT("An emptied map must not keep an allocation"), FlatMap.GetAllocatedSize(), (SIZE_T)0);
+	}
+
+	// sets with identity hashed keys
+	{
+		TFlatSet<int32> FlatSet;
+		for (int32 Index = 0; Index < 10000; ++Index)
+		{
+			FlatSet.Add(Index * 1024);
+		}
+		for (int32 Index = 0; Index < 10000; Index += 2)
+		{
+			FlatSet.Remove(Index * 1024);
+		}
+
+		bool bMatches = FlatSet.Num() == 5000;
+		for (int32 Index = 0; Index < 10000 && bMatches; ++Index)
+		{
+			bMatches = FlatSet.Contains(Index * 1024) == ((Index & 1) != 0);
+		}
+
+		TestTrue(TEXT("Set membership must survive removals of aligned keys"), bMatches);
+	}
+
+	return true;
+}
+
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/SoAArray.h"
+#include "Containers/UnrealString.h"
+#include "Math/Vector4.h"
+#include "Templates/AlignmentTemplates.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSoAArrayTest, "System.Core.Containers.SoAArray", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+
+bool FSoAArrayTest::RunTest( const FString& Parameters )
+{
+	// adds keep the fields of a record at the same index
+	{
+		TSoAArray<float, FString, uint8> Records;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Records.Add((float)Index, FString::FromInt(Index), (uint8)Index);
+		}
+		Records.Emplace(-1.0f, TEXT("Last"), 255);
+
+		bool bMatches = Records.Num() == 1001;
+		for (int32 Index = 0; Index < 1000 && bMatches; ++Index)
+		{
+			bMatches = Records.Get<0>(Index) == (float)Index && Records.Get<1>(Index) == FString::FromInt(Index) && Records.Get<2>(Index) == (uint8)Index;
+		}
+
+		TestTrue(TEXT("Every field of a record must be stored at the record's index"), bMatches && Records.Get<1>(1000) == TEXT("Last"));
+		TestEqual(TEXT("Field views must hold every record"), Records.GetField<1>().Num(), Records.Num());
+	}
+
+	// field views are contiguous and aligned
+	{
+		TSoAArray<uint8, FVector4, double> Records;
+		Records.AddDefaulted(37);
+
+		TestTrue(TEXT("Byte fields must be aligned for vector loads"), IsAligned(Records.GetField<0>().GetData(), 16));
+		TestTrue(TEXT("Vector fields must be aligned for vector loads"), IsAligned(Records.GetField<1>().GetData(), 16));
+		TestTrue(TEXT("Double fields must be aligned for vector loads"), IsAligned(Records.GetField<2>().GetData(), 16));
+
+		for (double& Value : Records.GetField<2>())
+		{
+			Value = 2.0;
+		}
+
+		double Sum = 0.0;
+		for (const double Value : static_cast<const TSoAArray<uint8, FVector4, double>&>(Records).GetField<2>())
+		{
+			Sum += Value;
+		}
+		TestEqual(TEXT("Writes through a field view must be visible in the array"), Sum, 74.0);
+	}
+
+	// removals move all the fields together
+	{
+		TSoAArray<int32, FString> Records;
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			Records.Add(Index, FString::FromInt(Index));
+		}
+
+		Records.RemoveAt(2, 2);
+		TestTrue(TEXT("RemoveAt must keep the order of the remaining records"), Records.Num() == 8 && Records.Get<0>(2) == 4 && Records.Get<1>(2) == TEXT("4"));
+
+		Records.RemoveAtSwap(0);
+		TestTrue(TEXT("RemoveAtSwap must move the last record into the gap"), Records.Num() == 7 && Records.Get<0>(0) == 9 && Records.Get<1>(0) == TEXT("9"));
+
+		Records.SetNum(3);
+		TestTrue(TEXT("SetNum must shrink every field"), Records.Num() == 3 && Records.GetField<1>().Num() == 3);
+
+		Records.Reset();
+		TestTrue(TEXT("A reset array must be empty"), Records.IsEmpty() && !Records.IsValidIndex(0));
+
+		Records.Empty();
+		TestEqual(TEXT("An emptied array must not keep an allocation"), Records.GetAllocatedSize(), (SIZE_T)0);
+	}
+
+	return true;
+}
+
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/Array.h"
+#include "Containers/BoundedMpmcQueue.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeCounter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBoundedMpmcQueueTest, "System.Core.Misc.BoundedMpmcQueue", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FBoundedMpmcQueueTest::RunTest(const FString& Parameters)
+{
+	const uint32 QueueSize = 8;
+
+	// empty queue
+	{
+		TBoundedMpmcQueue<int32> Queue(QueueSize);
+
+		TestEqual(TEXT("Newly created queues must have zero elements"), Queue.Count(), 0u);
+		TestTrue(TEXT("Newly created queues must be empty"), Queue.IsEmpty());
+
+		int32 Value;
+		TestFalse(TEXT("Dequeue must fail on an empty queue"), Queue.Dequeue(Value));
+		TestEqual(TEXT("Batch dequeue must return nothing from an empty queue"), Queue.DequeueBatch(&Value, 1), 0u);
+	}
+
+	// full queue, all slots are usable
+	{
+		TBoundedMpmcQueue<int32> Queue(QueueSize);
+
+		for (int32 Index = 0; Index < (int32)QueueSize; ++Index)
+		{
+			TestTrue(TEXT("Adding to a non-full queue must succeed"), Queue.Enqueue(Index));
+		}
+
+		TestEqual(TEXT("Full queues must hold their capacity"), Queue.Count(), QueueSize);
+		TestFalse(TEXT("Adding to a full queue must fail"), Queue.Enqueue(666));
+
+		int32 Value = 0;
+		TestTrue(TEXT("Dequeue from a full queue must succeed"), Queue.Dequeue(Value));
+		TestEqual(TEXT("Dequeue must return the oldest element"), Value, 0);
+		TestTrue(TEXT("Adding after a dequeue must succeed"), Queue.Enqueue(666));
+	}
+
+	// batches keep their order and are clipped to the free space
+	{
+		TBoundedMpmcQueue<int32> Queue(QueueSize);
+		const int32 Values[] = { 0, 1, 2, 3, 4, 5 };
+
+		TestEqual(TEXT("A batch which fits must be added completely"), Queue.EnqueueBatch(Values, 6), 6u);
+		TestEqual(TEXT("A batch which doesn't fit must be clipped"), Queue.EnqueueBatch(Values, 6), 2u);
+
+		int32 Out[QueueSize] = {};
+		TestEqual(TEXT("Batch dequeue must return at most the requested number"), Queue.DequeueBatch(Out, 5), 5u);
+		TestTrue(TEXT("Batch dequeue must keep the order"), Out[0] == 0 && Out[1] == 1 && Out[4] == 4);
+		TestEqual(TEXT("Batch dequeue must return the remaining elements"), Queue.DequeueBatch(Out, QueueSize), 3u);
+		TestTrue(TEXT("Batch dequeue must keep the order across batches"), Out[0] == 5 && Out[1] == 0 && Out[2] == 1);
+		TestTrue(TEXT("Drained queues must be empty"), Queue.IsEmpty());
+	}
+
+	// multiple producers and consumers
+	{
+		const int32 NumProducers = 4;
+		const int32 NumConsumers = 4;
+		const int32 NumPerProducer = 5000;
+
+		TBoundedMpmcQueue<int32> Queue(64);
+		TArray<FThreadSafeCounter> Seen;
+		Seen.SetNum(NumProducers * NumPerProducer);
+		FThreadSafeCounter NumConsumed;
+
+		TArray<TFuture<void>> Futures;
+		for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+		{
+			Futures.Add(Async(EAsyncExecution::Thread, [&Queue, Producer, NumPerProducer]()
+			{
+				for (int32 Index = 0; Index < NumPerProducer; )
+				{
+					const int32 Value = Producer * NumPerProducer + Index;
+					const int32 Batch[] = { Value, Value + 1 };
+					const uint32 NumEnqueued = (Producer & 1) ? Queue.EnqueueBatch(Batch, Index + 1 < NumPerProducer ? 2 : 1) : (Queue.Enqueue(Value) ? 1 : 0);
+
+					if (NumEnqueued == 0)
+					{
+						FPlatformProcess::YieldThread();
+					}
+					Index += (int32)NumEnqueued;
+				}
+			}));
+		}
+
+		for (int32 Consumer = 0; Consumer < NumConsumers; ++Consumer)
+		{
+			Futures.Add(Async(EAsyncExecution::Thread, [&Queue, &Seen, &NumConsumed, Consumer, Total = Seen.Num()]()
+			{
+				while (NumConsumed.GetValue() < Total)
+				{
+					int32 Values[4];
+					const uint32 NumDequeued = (Consumer & 1) ? Queue.DequeueBatch(Values, 4) : (Queue.Dequeue(Values[0]) ? 1 : 0);
+					if (NumDequeued == 0)
+					{
+						FPlatformProcess::YieldThread();
+					}
+
+					for (uint32 Index = 0; Index < NumDequeued; ++Index)
+					{
+						Seen[Values[Index]].Increment();
+					}
+					NumConsumed.Add(NumDequeued);
+				}
+			}));
+		}
+
+		for (TFuture<void>& Future : Futures)
+		{
+			Future.Wait();
+		}
+
+		bool bAllSeenOnce = true;
+		for (const FThreadSafeCounter& Counter : Seen)
+		{
+			bAllSeenOnce = bAllSeenOnce && Counter.GetValue() == 1;
+		}
+
+		TestTrue(TEXT("Every element must be dequeued exactly once"), bAllSeenOnce);
+		TestTrue(TEXT("A drained queue must be empty"), Queue.IsEmpty());
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
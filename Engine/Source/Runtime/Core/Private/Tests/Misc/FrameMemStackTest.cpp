@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Misc/MemStack.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFrameMemStackTest, "System.Core.Misc.FrameMemStack", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+
+bool FFrameMemStackTest::RunTest( const FString& Parameters )
+{
+	FFrameMemStack& FrameStack = FFrameMemStack::Get();
+
+	// raw allocations
+	{
+		const int32 StartByteCount = FrameStack.GetByteCount();
+
+		void* Small = FrameStack.Alloc(24, 8);
+		void* Aligned = FrameStack.Alloc(100, 64);
+		void* Large = FrameStack.Alloc(FPageAllocator::PageSize * 2, 16);
+
+		TestTrue(TEXT("Frame stack allocations must be owned by the frame stack"), FrameStack.ContainsPointer(Small) && FrameStack.ContainsPointer(Aligned) && FrameStack.ContainsPointer(Large));
+		TestTrue(TEXT("Frame stack allocations must respect the requested alignment"), IsAligned(Aligned, 64));
+		TestTrue(TEXT("The byte count must grow with allocations"), FrameStack.GetByteCount() >= StartByteCount + FPageAllocator::PageSize * 2);
+	}
+
+	// array growth
+	{
+		TArray<int32, TFrameMemStackAllocator<>> Array;
+
+		for (int32 Index = 0; Index < 10000; ++Index)
+		{
+			Array.Add(Index);
+		}
+
+		bool bValuesMatch = (Array.Num() == 10000);
+		for (int32 Index = 0; Index < Array.Num() && bValuesMatch; ++Index)
+		{
+			bValuesMatch = (Array[Index] == Index);
+		}
+
+		TestTrue(TEXT("Array elements must survive reallocation within the frame stack"), bValuesMatch);
+		TestTrue(TEXT("Array memory must come from the frame stack"), FrameStack.ContainsPointer(Array.GetData()));
+
+		Array.Empty();
+		TestFalse(TEXT("An emptied array must not keep an allocation"), Array.GetAllocatorInstance().HasAllocation());
+	}
+
+	// maps
+	{
+		TMap<int32, int32, FFrameMemStackSetAllocator> Map;
+
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Map.Add(Index, Index * 2);
+		}
+
+		bool bValuesMatch = (Map.Num() == 1000);
+		for (int32 Index = 0; Index < 1000 && bValuesMatch; ++Index)
+		{
+			const int32* Value = Map.Find(Index);
+			bValuesMatch = (Value != nullptr && *Value == Index * 2);
+		}
+
+		TestTrue(TEXT("Map lookups must succeed after rehashing within the frame stack"), bValuesMatch);
+	}
+
+	return true;
+}
+
+
+#endif //WITH_DEV_AUTOMATION_TESTS
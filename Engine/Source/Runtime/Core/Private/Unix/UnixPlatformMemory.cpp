@@ -57,6 +57,9 @@ bool CORE_API GFullCrashCallstack = false;
 bool CORE_API GUseKSM = false;
 bool CORE_API GKSMMergeAllPages = false;
 
+// Used to request transparent huge pages for large mappings (binned allocator pools and large allocations)
+bool CORE_API GUseHugePages = false;
+
 // Used to enable or disable timing of ensures. Enabled by default
 bool CORE_API GTimeEnsures = true;
 
@@ -189,6 +192,11 @@ class FMalloc* FUnixPlatformMemory::BaseAllocator()
 					GKSMMergeAllPages = true;
 				}
 
+				if (FCStringAnsi::Stricmp(Arg, "-hugepages") == 0)
+				{
+					GUseHugePages = true;
+				}
+
 				if (FCStringAnsi::Stricmp(Arg, "-noensuretiming") == 0)
 				{
 					GTimeEnsures = false;
@@ -339,6 +347,21 @@ static void MarkMappedMemoryMergable(void* Pointer, SIZE_T Size)
 	}
 }
 
+/** Size of a transparent huge page on x86-64 and (with 4KB base pages) arm64 */
+static const SIZE_T HugePageSize = 2 * 1024 * 1024;
+
+static void MarkMappedMemoryHugePage(void* Pointer, SIZE_T Size)
+{
+#ifdef MADV_HUGEPAGE
+	// Only the 2MB aligned, 2MB sized parts of the range can be backed by huge pages, the kernel keeps using regular pages for the rest.
+	// Failure isn't fatal: the memory is simply backed by regular pages.
+	if (GUseHugePages && Size >= HugePageSize)
+	{
+		madvise(Pointer, Size, MADV_HUGEPAGE);
+	}
+#endif
+}
+
 #ifndef MALLOC_LEAKDETECTION
 	#define MALLOC_LEAKDETECTION 0
 #endif
@@ -374,7 +397,10 @@ void* FUnixPlatformMemory::BinnedAllocFromOS(SIZE_T Size)
 	void* Pointer = nullptr;
 
 	// Binned expects OS allocations to be BinnedPageSize-aligned, and that page is at least 64KB. mmap() alone cannot do this, so carve out the needed chunks.
-	const SIZE_T ExpectedAlignment = FPlatformMemory::GetConstants().BinnedPageSize;
+	// When using huge pages, align large allocations to the huge page size so that all of their whole huge pages can be backed by one.
+	const SIZE_T ExpectedAlignment = (GUseHugePages && SizeInWholePages >= HugePageSize)
+		? FMath::Max(HugePageSize, (SIZE_T)FPlatformMemory::GetConstants().BinnedPageSize)
+		: FPlatformMemory::GetConstants().BinnedPageSize;
 	// Descriptor is only used if we're sanity checking. However, #ifdef'ing its use would make the code more fragile. Size needs to be at least one page.
 	const SIZE_T DescriptorSize = (UE4_PLATFORM_REDUCE_NUMBER_OF_MAPS != 0 || UE4_PLATFORM_SANITY_CHECK_OS_ALLOCATIONS != 0) ? OSPageSize : 0;
 
@@ -461,6 +487,8 @@ void* FUnixPlatformMemory::BinnedAllocFromOS(SIZE_T Size)
 		AllocDescriptor->OriginalSizeAsPassed = Size;
 	}
 
+	MarkMappedMemoryHugePage(Pointer, SizeInWholePages);
+
 	LLM(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Platform, Pointer, Size));
 	UE::FForkPageProtector::Get().AddMemoryRegion(Pointer, Size);
 
@@ -558,6 +586,7 @@ FUnixPlatformMemory::FPlatformVirtualMemoryBlock FUnixPlatformMemory::FPlatformV
 	if (LIKELY(Result.Ptr != MAP_FAILED))
 	{
 		MarkMappedMemoryMergable(Result.Ptr, Result.GetActualSize());
+		MarkMappedMemoryHugePage(Result.Ptr, Result.GetActualSize());
 
 		UE::FForkPageProtector::Get().AddMemoryRegion(Result.Ptr, Result.GetActualSize());
 	}
@@ -770,6 +799,32 @@ FPlatformMemoryStats FUnixPlatformMemory::GetStats()
 		fclose(ProcMemStats);
 	}
 
+	// smaps_rollup needs kernel 4.14+, and is slower to read than status, so only read it when huge pages were requested
+	if (GUseHugePages)
+	{
+		if (FILE* ProcSMapsRollup = fopen("/proc/self/smaps_rollup", "r"))
+		{
+			do
+			{
+				char LineBuffer[256] = {0};
+				char *Line = fgets(LineBuffer, UE_ARRAY_COUNT(LineBuffer), ProcSMapsRollup);
+				if (Line == nullptr)
+				{
+					break;	// eof or an error
+				}
+
+				if (strstr(Line, "AnonHugePages:") == Line)
+				{
+					MemoryStats.HugePagesUsedPhysical = UnixPlatformMemory::GetBytesFromStatusLine(Line);
+					break;
+				}
+			}
+			while (!feof(ProcSMapsRollup));
+
+			fclose(ProcSMapsRollup);
+		}
+	}
+
 #endif // PLATFORM_FREEBSD
 
 	// sanitize stats as sometimes peak < used for some reason
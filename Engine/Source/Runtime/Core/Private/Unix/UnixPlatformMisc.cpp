@@ -161,6 +161,38 @@ static void UnixPlatForm_CheckIfKSMUsable()
 	GKSMMergeAllPages = GUseKSM && GKSMMergeAllPages;
 }
 
+// Defined in UnixPlatformMemory
+extern bool GUseHugePages;
+
+static void UnixPlatForm_CheckIfHugePagesUsable()
+{
+	// https://www.kernel.org/doc/Documentation/vm/transhuge.txt
+	if (GUseHugePages)
+	{
+		char Enabled[128] = { 0 };
+		if (FILE* THPEnabledFile = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r"))
+		{
+			if (fgets(Enabled, UE_ARRAY_COUNT(Enabled), THPEnabledFile) == nullptr)
+			{
+				Enabled[0] = 0;
+			}
+
+			fclose(THPEnabledFile);
+		}
+
+		// the active mode is in brackets, e.g. "always [madvise] never"
+		if (Enabled[0] == 0 || strstr(Enabled, "[never]") != nullptr)
+		{
+			GUseHugePages = false;
+			UE_LOG(LogInit, Error, TEXT("Cannot use transparent huge pages when they're disabled or unsupported by the kernel. Please check /sys/kernel/mm/transparent_hugepage/enabled"));
+		}
+		else
+		{
+			UE_LOG(LogInit, Log, TEXT("Transparent huge pages enabled for large mappings (kernel mode: %s)"), *FString(ANSI_TO_TCHAR(Enabled)).TrimEnd());
+		}
+	}
+}
+
 // Init'ed in UnixPlatformMemory for now. Once the old crash symbolicator is gone remove this
 extern bool CORE_API GUseNewCrashSymbolicator;
 
@@ -180,6 +212,7 @@ void FUnixPlatformMisc::PlatformInit()
 	bool bPreloadedModuleSymbolFile = FParse::Param(FCommandLine::Get(), TEXT("preloadmodulesymbols"));
 
 	UnixPlatForm_CheckIfKSMUsable();
+	UnixPlatForm_CheckIfHugePagesUsable();
 
 	UE_LOG(LogInit, Log, TEXT("Unix hardware info:"));
 	UE_LOG(LogInit, Log, TEXT(" - we are %sthe first instance of this executable"), bFirstInstance ? TEXT("") : TEXT("not "));
@@ -211,6 +244,7 @@ void FUnixPlatformMisc::PlatformInit()
 	UE_LOG(LogInit, Log, TEXT(" -filemapcachesize=NUMBER - set the size for case-sensitive file mapping cache"));
 	UE_LOG(LogInit, Log, TEXT(" -useksm - uses kernel same-page mapping (KSM) for mapped memory (%s)"), GUseKSM ? TEXT("ON") : TEXT("OFF"));
 	UE_LOG(LogInit, Log, TEXT(" -ksmmergeall - marks all mmap'd memory pages suitable for KSM (%s)"), GKSMMergeAllPages ? TEXT("ON") : TEXT("OFF"));
+	UE_LOG(LogInit, Log, TEXT(" -hugepages - requests transparent huge pages for large mapped memory, e.g. allocator pools (%s)"), GUseHugePages ? TEXT("ON") : TEXT("OFF"));
 	UE_LOG(LogInit, Log, TEXT(" -preloadmodulesymbols - Loads the main module symbols file into memory (%s)"), bPreloadedModuleSymbolFile ? TEXT("ON") : TEXT("OFF"));
 	UE_LOG(LogInit, Log, TEXT(" -sigdfl=SIGNAL - Allows a specific signal to be set to its default handler rather then ignoring the signal"));
 
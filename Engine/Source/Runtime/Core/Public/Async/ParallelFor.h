@@ -35,6 +35,11 @@ enum class EParallelForFlags
 
 	// tasks should run on background priority threads
 	BackgroundPriority = 8,
+
+	//Threads claim chunks of decreasing size, a fraction of the items left, instead of fixed size blocks.
+	//Early chunks are large to keep the synchronization low, and the tail is split finely so threads finish together.
+	//This should be used for tasks with uneven computational time and a large number of items.
+	Adaptive = 16,
 };
 
 ENUM_CLASS_FLAGS(EParallelForFlags)
@@ -48,6 +53,7 @@ namespace ParallelForImpl
 		int32 Num;
 		int32 BlockSize;
 		int32 LastBlockExtraNum;
+		int32 NumThreads;
 		FunctionType Body;
 		FEvent* Event;
 		FThreadSafeCounter IndexToDo;
@@ -55,16 +61,26 @@ namespace ParallelForImpl
 		bool bExited;
 		bool bTriggered;
 		bool bSaveLastBlockForMaster;
+		bool bAdaptive;
 		TParallelForData(int32 InTotalNum, int32 InNumThreads, bool bInSaveLastBlockForMaster, FunctionType InBody, EParallelForFlags Flags)
-			: Body(InBody)
+			: NumThreads(InNumThreads)
+			, Body(InBody)
 			, Event(FPlatformProcess::GetSynchEventFromPool(false))
 			, bExited(false)
 			, bTriggered(false)
 			, bSaveLastBlockForMaster(bInSaveLastBlockForMaster)
+			, bAdaptive((Flags & EParallelForFlags::Adaptive) != EParallelForFlags::None)
 		{
 			check(InTotalNum >= InNumThreads);
 
-			if ((Flags & EParallelForFlags::Unbalanced) != EParallelForFlags::None)
+			if (bAdaptive)
+			{
+				// blocks are single items, the chunk size is decided on every claim
+				BlockSize = 1;
+				Num = InTotalNum;
+				bSaveLastBlockForMaster = false;
+			}
+			else if ((Flags & EParallelForFlags::Unbalanced) != EParallelForFlags::None)
 			{
 				BlockSize = 1;
 				Num = InTotalNum;
@@ -99,6 +115,7 @@ namespace ParallelForImpl
 			FPlatformProcess::ReturnSynchEventToPool(Event);
 		}
 		bool Process(int32 TasksToSpawn, TSharedRef<TParallelForData, ESPMode::ThreadSafe>& Data, ENamedThreads::Type InDesiredThread, bool bMaster);
+		bool ProcessAdaptive();
 	};
 
 	template<typename FunctionType>
@@ -149,6 +166,10 @@ namespace ParallelForImpl
 			TasksToSpawn = FMath::Min<int32>(TasksToSpawn, MaybeTasksLeft);
 			TGraphTask<TParallelForTask<FunctionType>>::CreateTask().ConstructAndDispatchWhenReady(Data, InDesiredThread, TasksToSpawn - 1);
 		}
+		if (bAdaptive)
+		{
+			return ProcessAdaptive();
+		}
 		int32 LocalBlockSize = BlockSize;
 		int32 LocalNum = Num;
 		bool bLocalSaveLastBlockForMaster = bSaveLastBlockForMaster;
@@ -194,6 +215,43 @@ namespace ParallelForImpl
 		return false;
 	}
 
+	template<typename FunctionType>
+	inline bool TParallelForData<FunctionType>::ProcessAdaptive()
+	{
+		const int32 LocalNum = Num;
+		// Every claim takes a share of what is left, so chunks shrink towards the end and nobody is left with a large block at the tail
+		const int32 ChunkDivisor = NumThreads * 2;
+		TFunctionRef<void(int32)> LocalBody(Body);
+		while (true)
+		{
+			const int32 ItemsLeft = LocalNum - IndexToDo.GetValue();
+			if (ItemsLeft <= 0)
+			{
+				break;
+			}
+			const int32 ChunkSize = FMath::Max(ItemsLeft / ChunkDivisor, 1);
+			const int32 ChunkStart = IndexToDo.Add(ChunkSize);
+			if (ChunkStart >= LocalNum)
+			{
+				break;
+			}
+			const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, LocalNum);
+			for (int32 Index = ChunkStart; Index < ChunkEnd; Index++)
+			{
+				LocalBody(Index);
+			}
+			checkSlow(!bExited);
+			const int32 ChunkNum = ChunkEnd - ChunkStart;
+			const int32 LocalNumCompleted = NumCompleted.Add(ChunkNum) + ChunkNum;
+			if (LocalNumCompleted == LocalNum)
+			{
+				return true;
+			}
+			checkSlow(LocalNumCompleted < LocalNum);
+		}
+		return false;
+	}
+
 	template<typename FunctionType>
 	inline void ParallelForInternal(int32 Num, FunctionType Body, EParallelForFlags Flags)
 	{
@@ -23,6 +23,7 @@
 #include "Containers/LockFreeFixedSizeAllocator.h"
 #include "Misc/MemStack.h"
 #include "Templates/Atomic.h"
+#include "ProfilingDebugging/TaskGraphTrace.h"
 
 #if !defined(STATS)
 #error "STATS must be defined as either zero or one."
@@ -495,6 +496,14 @@ protected:
 		}
 	}
 
+#if TASKGRAPHTRACE_ENABLED
+	/** Assigns this task a trace id and traces its creation and prerequisites. Called before the task can be queued. */
+	CORE_API void TraceCreated(FGraphEvent* CompletionEvent, const FGraphEventArray* Prerequisites);
+
+	/** Zero if the task was created while the TaskGraph trace channel was off */
+	uint64						TraceId = 0;
+#endif
+
 private:
 	friend class FNamedTaskThread;
 	friend class FTaskThreadBase;
@@ -642,6 +651,14 @@ public:
 		return SubsequentList.IsClosed();
 	}
 
+#if TASKGRAPHTRACE_ENABLED
+	/** @return The trace id of the task this event belongs to, zero if it wasn't traced */
+	uint64 GetTraceId() const
+	{
+		return TraceId;
+	}
+#endif
+
 	/**
 	 * A convenient short version of `FTaskGraphInterface::WaitUntilTaskCompletes`
 	 */
@@ -726,6 +743,11 @@ private:
 #if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
 	const TCHAR* DebugName = nullptr;
 #endif
+
+#if TASKGRAPHTRACE_ENABLED
+	friend class FBaseGraphTask;
+	uint64 TraceId = 0;
+#endif
 };
 
 
@@ -880,6 +902,13 @@ private:
 			Subsequents->CheckDontCompleteUntilIsEmpty(); // we can only add wait for tasks while executing the task
 		}
 		
+#if TASKGRAPHTRACE_ENABLED
+		if (TraceId)
+		{
+			FTaskGraphTrace::Started(TraceId);
+		}
+#endif
+
 		TTask& Task = *(TTask*)&TaskStorage;
 		{
 			FScopeCycleCounter Scope(Task.GetStatId(), true); 
@@ -887,6 +916,13 @@ private:
 			Task.~TTask();
 			checkThreadGraph(ENamedThreads::GetThreadIndex(CurrentThread) <= ENamedThreads::GetRenderThread() || FMemStack::Get().IsEmpty()); // you must mark and pop memstacks if you use them in tasks! Named threads are excepted.
 		}
+
+#if TASKGRAPHTRACE_ENABLED
+		if (TraceId)
+		{
+			FTaskGraphTrace::Finished(TraceId);
+		}
+#endif
 		
 		TaskConstructed = false;
 
@@ -946,6 +982,12 @@ private:
 		TaskConstructed = true;
 		TTask& Task = *(TTask*)&TaskStorage;
 		SetThreadToExecuteOn(Task.GetDesiredThread());
+#if TASKGRAPHTRACE_ENABLED
+		if (TRACE_TASKGRAPH_ENABLED())
+		{
+			TraceCreated(Subsequents.GetReference(), Prerequisites);
+		}
+#endif
 		int32 AlreadyCompletedPrerequisites = 0;
 		if (Prerequisites)
 		{
@@ -0,0 +1,307 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "HAL/PlatformProcess.h"
+#include "Math/UnrealMathUtility.h"
+#include "Templates/Atomic.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/UnrealTemplate.h"
+
+/**
+ * Implements a bounded lock-free first-in first-out queue using a circular array.
+ *
+ * Unlike TQueue and TCircularQueue, this class is thread safe with any number of producers and consumers.
+ * Each slot carries a sequence number telling whether it is ready to be written or read at the current lap
+ * around the ring, so producers and consumers only contend on the head and tail counters, which are kept on
+ * separate cache lines. Enqueuing never allocates; it fails instead when the queue is full.
+ *
+ * Single operations never wait. Batch operations claim a run of slots at once and may briefly spin on slots
+ * which another thread has claimed but not finished writing or reading yet.
+ *
+ * @param ElementType The type of elements held in the queue.
+ */
+template<typename ElementType>
+class TBoundedMpmcQueue
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InCapacity The number of elements that the queue can hold (will be rounded up to the next power of 2).
+	 */
+	explicit TBoundedMpmcQueue(uint32 InCapacity)
+		: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u)))
+		, IndexMask(Capacity - 1)
+		, Head(0)
+		, Tail(0)
+	{
+		checkf(Capacity <= (1u << 30), TEXT("TBoundedMpmcQueue capacity %u is too large"), Capacity);
+
+		Slots = (FSlot*)FMemory::Malloc(sizeof(FSlot) * Capacity, alignof(FSlot));
+		for (uint32 Index = 0; Index < Capacity; ++Index)
+		{
+			new(&Slots[Index]) FSlot();
+			Slots[Index].Sequence.Store(Index, EMemoryOrder::Relaxed);
+		}
+	}
+
+	/** Destructor. Must not be called while other threads still use the queue. */
+	~TBoundedMpmcQueue()
+	{
+		for (uint32 Position = Head.Load(); Position != Tail.Load(); ++Position)
+		{
+			DestructItem(Slots[Position & IndexMask].Storage.GetTypedPtr());
+		}
+
+		for (uint32 Index = 0; Index < Capacity; ++Index)
+		{
+			Slots[Index].~FSlot();
+		}
+		FMemory::Free(Slots);
+	}
+
+	TBoundedMpmcQueue(const TBoundedMpmcQueue&) = delete;
+	TBoundedMpmcQueue& operator=(const TBoundedMpmcQueue&) = delete;
+
+public:
+
+	/**
+	 * Adds an item to the end of the queue.
+	 *
+	 * @param Element The element to add.
+	 * @return true if the item was added, false if the queue was full.
+	 */
+	FORCEINLINE bool Enqueue(const ElementType& Element)
+	{
+		return EnqueueImpl(Element);
+	}
+
+	FORCEINLINE bool Enqueue(ElementType&& Element)
+	{
+		return EnqueueImpl(MoveTemp(Element));
+	}
+
+	/**
+	 * Removes an item from the front of the queue.
+	 *
+	 * @param OutElement Will contain the element if the queue is not empty.
+	 * @return true if an element has been returned, false if the queue was empty.
+	 */
+	bool Dequeue(ElementType& OutElement)
+	{
+		uint32 Position = Head.Load(EMemoryOrder::Relaxed);
+
+		for (;;)
+		{
+			FSlot& Slot = Slots[Position & IndexMask];
+			const int32 Lag = (int32)(Slot.Sequence.Load() - (Position + 1));
+
+			if (Lag == 0)
+			{
+				if (Head.CompareExchange(Position, Position + 1))
+				{
+					ElementType* Stored = Slot.Storage.GetTypedPtr();
+					OutElement = MoveTemp(*Stored);
+					DestructItem(Stored);
+
+					// Hand the slot back to producers for the next lap
+					Slot.Sequence.Store(Position + Capacity);
+					return true;
+				}
+			}
+			else if (Lag < 0)
+			{
+				// The slot hasn't been written for this lap yet
+				return false;
+			}
+			else
+			{
+				Position = Head.Load(EMemoryOrder::Relaxed);
+			}
+		}
+	}
+
+	/**
+	 * Adds up to Num items to the end of the queue, keeping their order.
+	 *
+	 * @param Elements The elements to copy into the queue.
+	 * @param Num The number of elements.
+	 * @return The number of elements added, which is less than Num if the queue became full.
+	 */
+	uint32 EnqueueBatch(const ElementType* Elements, uint32 Num)
+	{
+		uint32 Position = Tail.Load(EMemoryOrder::Relaxed);
+		uint32 NumClaimed;
+
+		for (;;)
+		{
+			// Slots behind the observed head have at least been claimed by consumers, so they are released without depending on us
+			const int32 Used = (int32)(Position - Head.Load());
+			if (Used < 0)
+			{
+				// Consumers moved past our stale view of the tail
+				Position = Tail.Load(EMemoryOrder::Relaxed);
+				continue;
+			}
+
+			NumClaimed = FMath::Min(Num, Capacity - FMath::Min((uint32)Used, Capacity));
+			if (NumClaimed == 0 || Tail.CompareExchange(Position, Position + NumClaimed))
+			{
+				break;
+			}
+		}
+
+		for (uint32 Index = 0; Index < NumClaimed; ++Index)
+		{
+			FSlot& Slot = Slots[(Position + Index) & IndexMask];
+			WaitForSequence(Slot, Position + Index);
+
+			new(Slot.Storage.GetTypedPtr()) ElementType(Elements[Index]);
+			Slot.Sequence.Store(Position + Index + 1);
+		}
+
+		return NumClaimed;
+	}
+
+	/**
+	 * Removes up to MaxNum items from the front of the queue, keeping their order.
+	 *
+	 * @param OutElements Receives the elements, must have room for MaxNum elements.
+	 * @param MaxNum The maximum number of elements to remove.
+	 * @return The number of elements removed.
+	 */
+	uint32 DequeueBatch(ElementType* OutElements, uint32 MaxNum)
+	{
+		uint32 Position = Head.Load(EMemoryOrder::Relaxed);
+		uint32 NumClaimed;
+
+		for (;;)
+		{
+			// Slots behind the observed tail have been claimed by producers, who finish writing them without depending on us
+			const int32 Available = (int32)(Tail.Load() - Position);
+			NumClaimed = FMath::Min(MaxNum, Available > 0 ? (uint32)Available : 0u);
+
+			if (NumClaimed == 0 || Head.CompareExchange(Position, Position + NumClaimed))
+			{
+				break;
+			}
+		}
+
+		for (uint32 Index = 0; Index < NumClaimed; ++Index)
+		{
+			FSlot& Slot = Slots[(Position + Index) & IndexMask];
+			WaitForSequence(Slot, Position + Index + 1);
+
+			ElementType* Stored = Slot.Storage.GetTypedPtr();
+			OutElements[Index] = MoveTemp(*Stored);
+			DestructItem(Stored);
+			Slot.Sequence.Store(Position + Index + Capacity);
+		}
+
+		return NumClaimed;
+	}
+
+	/**
+	 * Gets the number of elements in the queue.
+	 *
+	 * Can be called from any thread. The result reflects the calling thread's current
+	 * view. Since no locking is used, different threads may return different results.
+	 *
+	 * @return Number of queued elements.
+	 */
+	uint32 Count() const
+	{
+		const int32 Num = (int32)(Tail.Load() - Head.Load());
+		return (uint32)FMath::Clamp(Num, 0, (int32)Capacity);
+	}
+
+	/**
+	 * Checks whether the queue is empty.
+	 *
+	 * Can be called from any thread. The result reflects the calling thread's current
+	 * view. Since no locking is used, different threads may return different results.
+	 *
+	 * @return true if the queue is empty, false otherwise.
+	 */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return Count() == 0;
+	}
+
+	/** @return The number of elements the queue can hold. */
+	FORCEINLINE uint32 Max() const
+	{
+		return Capacity;
+	}
+
+private:
+
+	struct FSlot
+	{
+		TAtomic<uint32> Sequence;
+		TTypeCompatibleBytes<ElementType> Storage;
+	};
+
+	template<typename ArgType>
+	bool EnqueueImpl(ArgType&& Element)
+	{
+		uint32 Position = Tail.Load(EMemoryOrder::Relaxed);
+
+		for (;;)
+		{
+			FSlot& Slot = Slots[Position & IndexMask];
+			const int32 Lag = (int32)(Slot.Sequence.Load() - Position);
+
+			if (Lag == 0)
+			{
+				if (Tail.CompareExchange(Position, Position + 1))
+				{
+					new(Slot.Storage.GetTypedPtr()) ElementType(Forward<ArgType>(Element));
+
+					// Publish the element to consumers
+					Slot.Sequence.Store(Position + 1);
+					return true;
+				}
+			}
+			else if (Lag < 0)
+			{
+				// The slot still holds the element from the previous lap
+				return false;
+			}
+			else
+			{
+				Position = Tail.Load(EMemoryOrder::Relaxed);
+			}
+		}
+	}
+
+	/** Spins until a slot claimed by a batch reaches the given sequence, i.e. until the thread which owns it from the previous step is done. */
+	FORCEINLINE void WaitForSequence(const FSlot& Slot, uint32 ExpectedSequence)
+	{
+		while (Slot.Sequence.Load() != ExpectedSequence)
+		{
+			FPlatformProcess::YieldThread();
+		}
+	}
+
+	const uint32 Capacity;
+	const uint32 IndexMask;
+	FSlot* Slots;
+
+	uint8 PadToAvoidContention0[PLATFORM_CACHE_LINE_SIZE];
+
+	/** Position of the next slot to read. */
+	TAtomic<uint32> Head;
+
+	uint8 PadToAvoidContention1[PLATFORM_CACHE_LINE_SIZE];
+
+	/** Position of the next slot to write. */
+	TAtomic<uint32> Tail;
+
+	uint8 PadToAvoidContention2[PLATFORM_CACHE_LINE_SIZE];
+};
@@ -0,0 +1,201 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "Templates/UnrealTemplate.h"
+#include "Containers/Map.h"
+#include "Containers/FlatSet.h"
+
+/**
+ * An open-addressing map from keys to values, as an alternative to TMap for hot lookup tables.
+ * Implemented as a TFlatSet of key-value pairs using the same KeyFuncs as TMap, see TFlatSet for the
+ * storage layout and probing.
+ *
+ * Value references and pointers returned by this map are only valid until the map is next modified,
+ * as any insertion may rehash and move the existing pairs.
+ */
+template<typename InKeyType, typename InValueType, typename Allocator = FDefaultAllocator, typename KeyFuncs = TDefaultMapHashableKeyFuncs<InKeyType, InValueType, false>>
+class TFlatMap
+{
+public:
+	typedef InKeyType KeyType;
+	typedef InValueType ValueType;
+	typedef TPair<KeyType, ValueType> ElementType;
+	typedef typename TTypeTraits<KeyType>::ConstPointerType KeyConstPointerType;
+
+private:
+	typedef TFlatSet<ElementType, KeyFuncs, Allocator> ElementSetType;
+
+public:
+	typedef typename ElementSetType::TIterator TIterator;
+	typedef typename ElementSetType::TConstIterator TConstIterator;
+
+	/** @return The number of key-value pairs in the map. */
+	FORCEINLINE int32 Num() const
+	{
+		return Pairs.Num();
+	}
+
+	/** @return True if the map holds no pairs. */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return Pairs.IsEmpty();
+	}
+
+	/** @return The amount of memory allocated by this container. */
+	FORCEINLINE SIZE_T GetAllocatedSize() const
+	{
+		return Pairs.GetAllocatedSize();
+	}
+
+	/**
+	 * Removes all pairs from the map.
+	 *
+	 * @param ExpectedNumElements	The number of pairs the map should be able to hold without rehashing afterwards.
+	 */
+	FORCEINLINE void Empty(int32 ExpectedNumElements = 0)
+	{
+		Pairs.Empty(ExpectedNumElements);
+	}
+
+	/** Removes all pairs from the map, keeping its slots allocated. */
+	FORCEINLINE void Reset()
+	{
+		Pairs.Reset();
+	}
+
+	/** Grows the map so it can hold the given number of pairs without rehashing. */
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		Pairs.Reserve(Number);
+	}
+
+	/**
+	 * Sets the value associated with a key, adding the key if it isn't in the map yet.
+	 *
+	 * @return A reference to the value in the map, valid until the map is next modified.
+	 */
+	FORCEINLINE ValueType& Add(const KeyType&  InKey, const ValueType&  InValue) { return Emplace(                   InKey ,                    InValue ); }
+	FORCEINLINE ValueType& Add(const KeyType&  InKey,       ValueType&& InValue) { return Emplace(                   InKey , MoveTempIfPossible(InValue)); }
+	FORCEINLINE ValueType& Add(      KeyType&& InKey, const ValueType&  InValue) { return Emplace(MoveTempIfPossible(InKey),                    InValue ); }
+	FORCEINLINE ValueType& Add(      KeyType&& InKey,       ValueType&& InValue) { return Emplace(MoveTempIfPossible(InKey), MoveTempIfPossible(InValue)); }
+
+	/**
+	 * Sets the value associated with a key, constructing the key and value from the arguments. Unlike adding to a
+	 * TFlatSet of pairs, no pair is constructed when the key is already in the map, only the value is assigned.
+	 *
+	 * @return A reference to the value in the map, valid until the map is next modified.
+	 */
+	template<typename InitKeyType, typename InitValueType>
+	ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
+	{
+		bool bIsNew;
+		const int32 Index = Pairs.FindOrClaimSlot(InKey, KeyFuncs::GetKeyHash(InKey), bIsNew);
+
+		ElementType* Pair = Pairs.GetElement(Index);
+		if (bIsNew)
+		{
+			new(Pair) ElementType(Forward<InitKeyType>(InKey), Forward<InitValueType>(InValue));
+		}
+		else
+		{
+			Pair->Value = Forward<InitValueType>(InValue);
+		}
+		return Pair->Value;
+	}
+
+	/**
+	 * Finds the value associated with a key, adding a default constructed value if the key isn't in the map yet.
+	 *
+	 * @return A reference to the value in the map, valid until the map is next modified.
+	 */
+	FORCEINLINE ValueType& FindOrAdd(const KeyType&  InKey) { return FindOrAddImpl(                   InKey ); }
+	FORCEINLINE ValueType& FindOrAdd(      KeyType&& InKey) { return FindOrAddImpl(MoveTempIfPossible(InKey)); }
+
+	/** @return A pointer to the value associated with the key, or nullptr if the key isn't in the map. */
+	FORCEINLINE ValueType* Find(KeyConstPointerType Key)
+	{
+		ElementType* Pair = Pairs.Find(Key);
+		return Pair ? &Pair->Value : nullptr;
+	}
+
+	FORCEINLINE const ValueType* Find(KeyConstPointerType Key) const
+	{
+		return const_cast<TFlatMap*>(this)->Find(Key);
+	}
+
+	/** Finds the value associated with a key using a precomputed hash, see TFlatSet::FindByHash. */
+	template<typename ComparableKey>
+	FORCEINLINE ValueType* FindByHash(uint32 KeyHash, const ComparableKey& Key)
+	{
+		ElementType* Pair = Pairs.FindByHash(KeyHash, Key);
+		return Pair ? &Pair->Value : nullptr;
+	}
+
+	template<typename ComparableKey>
+	FORCEINLINE const ValueType* FindByHash(uint32 KeyHash, const ComparableKey& Key) const
+	{
+		return const_cast<TFlatMap*>(this)->FindByHash(KeyHash, Key);
+	}
+
+	/** @return A reference to the value associated with the key, asserting if the key isn't in the map. */
+	FORCEINLINE ValueType& FindChecked(KeyConstPointerType Key)
+	{
+		ElementType* Pair = Pairs.Find(Key);
+		check(Pair != nullptr);
+		return Pair->Value;
+	}
+
+	FORCEINLINE const ValueType& FindChecked(KeyConstPointerType Key) const
+	{
+		return const_cast<TFlatMap*>(this)->FindChecked(Key);
+	}
+
+	/** @return A copy of the value associated with the key, or a default constructed value if the key isn't in the map. */
+	FORCEINLINE ValueType FindRef(KeyConstPointerType Key) const
+	{
+		const ElementType* Pair = Pairs.Find(Key);
+		return Pair ? Pair->Value : ValueType();
+	}
+
+	/** @return True if the map has a value associated with the key. */
+	FORCEINLINE bool Contains(KeyConstPointerType Key) const
+	{
+		return Pairs.Contains(Key);
+	}
+
+	/**
+	 * Removes the pair with the given key.
+	 *
+	 * @return The number of pairs removed (0 or 1).
+	 */
+	FORCEINLINE int32 Remove(KeyConstPointerType Key)
+	{
+		return Pairs.Remove(Key);
+	}
+
+	/** Ranged-for support, iterating the pairs in an unspecified order. */
+	FORCEINLINE TIterator begin()             { return Pairs.begin(); }
+	FORCEINLINE TConstIterator begin() const  { return Pairs.begin(); }
+	FORCEINLINE TIterator end()               { return Pairs.end(); }
+	FORCEINLINE TConstIterator end() const    { return Pairs.end(); }
+
+private:
+	template<typename InitKeyType>
+	ValueType& FindOrAddImpl(InitKeyType&& InKey)
+	{
+		bool bIsNew;
+		const int32 Index = Pairs.FindOrClaimSlot(InKey, KeyFuncs::GetKeyHash(InKey), bIsNew);
+
+		ElementType* Pair = Pairs.GetElement(Index);
+		if (bIsNew)
+		{
+			new(Pair) ElementType(Forward<InitKeyType>(InKey), ValueType());
+		}
+		return Pair->Value;
+	}
+
+	ElementSetType Pairs;
+};
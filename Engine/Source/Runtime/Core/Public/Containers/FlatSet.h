@@ -0,0 +1,671 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "Templates/UnrealTemplate.h"
+#include "Templates/ChooseClass.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/MemoryOps.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Containers/Array.h"
+#include "Containers/Set.h"
+#include "Math/UnrealMathUtility.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY && !defined(__cplusplus_cli)
+	#define UE_FLATSET_USE_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define UE_FLATSET_USE_SSE2 0
+#endif
+
+template<typename KeyType, typename ValueType, typename Allocator, typename KeyFuncs>
+class TFlatMap;
+
+namespace UE4FlatSet_Private
+{
+	/** Number of slots whose control bytes are tested together while probing. */
+	enum { GroupWidth = 16 };
+
+	/**
+	 * Control byte values. A full slot stores the 7 bit secondary hash of its element (0..127), so empty and
+	 * deleted slots are the only negative values and can be told apart from full slots by their sign bit.
+	 */
+	enum : int8
+	{
+		CtrlEmpty   = -128,
+		CtrlDeleted = -2,
+	};
+
+	/** One bit per slot of a group, walked from the lowest slot to the highest. */
+	struct FGroupMask
+	{
+		uint32 Bits;
+
+		explicit FORCEINLINE FGroupMask(uint32 InBits)
+			: Bits(InBits)
+		{
+		}
+
+		FORCEINLINE explicit operator bool() const
+		{
+			return Bits != 0;
+		}
+
+		FORCEINLINE int32 LowestSlot() const
+		{
+			return (int32)FMath::CountTrailingZeros(Bits);
+		}
+
+		FORCEINLINE void ClearLowestSlot()
+		{
+			Bits &= Bits - 1;
+		}
+	};
+
+	/** The control bytes of one group, loaded at once so all of its slots can be matched against a value together. */
+	struct FGroup
+	{
+#if UE_FLATSET_USE_SSE2
+		__m128i Ctrl;
+
+		explicit FORCEINLINE FGroup(const int8* InCtrl)
+			: Ctrl(_mm_loadu_si128((const __m128i*)InCtrl))
+		{
+		}
+
+		FORCEINLINE FGroupMask Match(int8 Value) const
+		{
+			return FGroupMask((uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Value), Ctrl)));
+		}
+
+		FORCEINLINE FGroupMask MatchEmptyOrDeleted() const
+		{
+			return FGroupMask((uint32)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), Ctrl)));
+		}
+#else
+		const int8* Ctrl;
+
+		explicit FORCEINLINE FGroup(const int8* InCtrl)
+			: Ctrl(InCtrl)
+		{
+		}
+
+		FORCEINLINE FGroupMask Match(int8 Value) const
+		{
+			uint32 Bits = 0;
+			for (int32 Slot = 0; Slot < GroupWidth; ++Slot)
+			{
+				Bits |= uint32(Ctrl[Slot] == Value) << Slot;
+			}
+			return FGroupMask(Bits);
+		}
+
+		FORCEINLINE FGroupMask MatchEmptyOrDeleted() const
+		{
+			uint32 Bits = 0;
+			for (int32 Slot = 0; Slot < GroupWidth; ++Slot)
+			{
+				Bits |= uint32(Ctrl[Slot] < -1) << Slot;
+			}
+			return FGroupMask(Bits);
+		}
+#endif
+
+		FORCEINLINE FGroupMask MatchEmpty() const
+		{
+			return Match(CtrlEmpty);
+		}
+	};
+
+	/** Spreads a 32 bit key hash over 64 bits, so that identity hashes of small integers and aligned pointers still fill the table evenly. */
+	FORCEINLINE uint64 MixHash(uint32 KeyHash)
+	{
+		return (uint64)KeyHash * 0x9E3779B97F4A7C15ull;
+	}
+
+	/** The hash bits used to pick the first group to probe. */
+	FORCEINLINE uint32 GetGroupHash(uint64 MixedHash)
+	{
+		return (uint32)(MixedHash >> 32);
+	}
+
+	/** The hash bits stored in the control byte of a full slot. */
+	FORCEINLINE int8 GetSlotHash(uint64 MixedHash)
+	{
+		return (int8)((MixedHash >> 25) & 0x7F);
+	}
+
+	/** Largest number of full and deleted slots a table with the given capacity may hold before it is rehashed. */
+	FORCEINLINE int32 GetMaxLoad(int32 Capacity)
+	{
+		return Capacity - Capacity / 8;
+	}
+}
+
+/**
+ * An open-addressing hash set, as an alternative to TSet for hot lookup tables.
+ *
+ * Elements are stored inline in a flat slot array next to an array of one control byte per slot. Lookups
+ * probe groups of 16 slots at a time, comparing the 7 bit secondary hash of every slot in a group against the
+ * searched one with a single SSE2 compare where available, and only touch the elements whose control byte matched.
+ * Compared to TSet this avoids the separate hash bucket array and the linked element chains, so a lookup is
+ * usually a single cache miss for the control bytes plus one for the element.
+ *
+ * Hashing and key comparison go through the same KeyFuncs as TSet, so any type with a GetTypeHash overload can be
+ * used. The Allocator is a TArray-style allocator policy used for both the slot and the control arrays.
+ *
+ * Element addresses are not stable: any insertion may rehash and move the existing elements. Duplicate keys are
+ * not supported, and the iteration order is unspecified.
+ */
+template<typename InElementType, typename KeyFuncs = DefaultKeyFuncs<InElementType>, typename Allocator = FDefaultAllocator>
+class TFlatSet
+{
+	static_assert(!KeyFuncs::bAllowDuplicateKeys, "TFlatSet does not support KeyFuncs which allow duplicate keys");
+
+	template<typename, typename, typename, typename>
+	friend class TFlatMap;
+
+public:
+	typedef InElementType ElementType;
+	typedef typename KeyFuncs::KeyInitType KeyInitType;
+
+	TFlatSet() = default;
+
+	TFlatSet(const TFlatSet& Other)
+	{
+		CopyFrom(Other);
+	}
+
+	TFlatSet(TFlatSet&& Other)
+	{
+		MoveFrom(Other);
+	}
+
+	~TFlatSet()
+	{
+		DestructElements();
+	}
+
+	TFlatSet& operator=(const TFlatSet& Other)
+	{
+		if (this != &Other)
+		{
+			Empty();
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	TFlatSet& operator=(TFlatSet&& Other)
+	{
+		if (this != &Other)
+		{
+			Empty();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	/** @return The number of elements in the set. */
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	/** @return True if the set holds no elements. */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return NumElements == 0;
+	}
+
+	/** @return The number of slots currently allocated. */
+	FORCEINLINE int32 Max() const
+	{
+		return Controls.Num();
+	}
+
+	/** @return The amount of memory allocated by this container. */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Controls.GetAllocatedSize() + Slots.GetAllocatedSize();
+	}
+
+	/**
+	 * Removes all elements from the set.
+	 *
+	 * @param ExpectedNumElements	The number of elements the set should be able to hold without rehashing afterwards.
+	 */
+	void Empty(int32 ExpectedNumElements = 0)
+	{
+		DestructElements();
+		NumElements = 0;
+		NumDeleted = 0;
+
+		const int32 NewCapacity = ExpectedNumElements > 0 ? GetCapacityFor(ExpectedNumElements) : 0;
+		if (NewCapacity != Max())
+		{
+			Controls.Empty(NewCapacity);
+			Slots.Empty(NewCapacity);
+			Controls.SetNumUninitialized(NewCapacity);
+			Slots.SetNumUninitialized(NewCapacity);
+		}
+		ClearControls();
+	}
+
+	/** Removes all elements from the set, keeping its slots allocated. */
+	void Reset()
+	{
+		DestructElements();
+		NumElements = 0;
+		NumDeleted = 0;
+		ClearControls();
+	}
+
+	/** Grows the set so it can hold the given number of elements without rehashing. */
+	void Reserve(int32 Number)
+	{
+		const int32 NewCapacity = Number > 0 ? GetCapacityFor(Number) : 0;
+		if (NewCapacity > Max())
+		{
+			Rehash(NewCapacity);
+		}
+	}
+
+	/**
+	 * Adds an element to the set, replacing any element which has the same key.
+	 *
+	 * @return A reference to the element in the set, valid until the set is next modified.
+	 */
+	FORCEINLINE ElementType& Add(const ElementType& InElement)
+	{
+		return AddImpl(InElement);
+	}
+
+	FORCEINLINE ElementType& Add(ElementType&& InElement)
+	{
+		return AddImpl(MoveTempIfPossible(InElement));
+	}
+
+	/**
+	 * Constructs an element from the given arguments and adds it to the set, replacing any element which has the same key.
+	 *
+	 * @return A reference to the element in the set, valid until the set is next modified.
+	 */
+	template<typename... ArgsType>
+	FORCEINLINE ElementType& Emplace(ArgsType&&... Args)
+	{
+		return AddImpl(ElementType(Forward<ArgsType>(Args)...));
+	}
+
+	/** @return A pointer to the element with the given key, or nullptr if the set doesn't contain it. */
+	FORCEINLINE ElementType* Find(KeyInitType Key)
+	{
+		const int32 Index = FindIndex(Key, KeyFuncs::GetKeyHash(Key));
+		return Index != INDEX_NONE ? GetElement(Index) : nullptr;
+	}
+
+	FORCEINLINE const ElementType* Find(KeyInitType Key) const
+	{
+		return const_cast<TFlatSet*>(this)->Find(Key);
+	}
+
+	/**
+	 * Finds an element using a precomputed hash and a key which is comparable to the element key, as TSet::FindByHash.
+	 * The hash must be calculated the same way as KeyFuncs hashes the element key.
+	 */
+	template<typename ComparableKey>
+	FORCEINLINE ElementType* FindByHash(uint32 KeyHash, const ComparableKey& Key)
+	{
+		const int32 Index = FindIndex(Key, KeyHash);
+		return Index != INDEX_NONE ? GetElement(Index) : nullptr;
+	}
+
+	template<typename ComparableKey>
+	FORCEINLINE const ElementType* FindByHash(uint32 KeyHash, const ComparableKey& Key) const
+	{
+		return const_cast<TFlatSet*>(this)->FindByHash(KeyHash, Key);
+	}
+
+	/** @return True if the set contains an element with the given key. */
+	FORCEINLINE bool Contains(KeyInitType Key) const
+	{
+		return FindIndex(Key, KeyFuncs::GetKeyHash(Key)) != INDEX_NONE;
+	}
+
+	/**
+	 * Removes the element with the given key.
+	 *
+	 * @return The number of elements removed (0 or 1).
+	 */
+	int32 Remove(KeyInitType Key)
+	{
+		const int32 Index = FindIndex(Key, KeyFuncs::GetKeyHash(Key));
+		if (Index == INDEX_NONE)
+		{
+			return 0;
+		}
+
+		RemoveAt(Index);
+		return 1;
+	}
+
+	/** Iterator over the full slots of the set. */
+	template<bool bConst>
+	class TBaseIterator
+	{
+		typedef typename TChooseClass<bConst, const TFlatSet, TFlatSet>::Result SetType;
+		typedef typename TChooseClass<bConst, const ElementType, ElementType>::Result ItElementType;
+
+	public:
+		FORCEINLINE TBaseIterator(SetType& InSet, int32 StartIndex)
+			: Set(InSet)
+			, Index(StartIndex)
+		{
+			SkipFreeSlots();
+		}
+
+		FORCEINLINE TBaseIterator& operator++()
+		{
+			++Index;
+			SkipFreeSlots();
+			return *this;
+		}
+
+		FORCEINLINE ItElementType& operator*() const
+		{
+			return *Set.GetElement(Index);
+		}
+
+		FORCEINLINE ItElementType* operator->() const
+		{
+			return Set.GetElement(Index);
+		}
+
+		FORCEINLINE friend bool operator!=(const TBaseIterator& Lhs, const TBaseIterator& Rhs)
+		{
+			return Lhs.Index != Rhs.Index;
+		}
+
+	private:
+		FORCEINLINE void SkipFreeSlots()
+		{
+			const int32 Capacity = Set.Max();
+			while (Index < Capacity && Set.Controls.GetData()[Index] < 0)
+			{
+				++Index;
+			}
+		}
+
+		SetType& Set;
+		int32 Index;
+	};
+
+	typedef TBaseIterator<false> TIterator;
+	typedef TBaseIterator<true> TConstIterator;
+
+	/** Ranged-for support. */
+	FORCEINLINE TIterator begin()             { return TIterator(*this, 0); }
+	FORCEINLINE TConstIterator begin() const  { return TConstIterator(*this, 0); }
+	FORCEINLINE TIterator end()               { return TIterator(*this, Max()); }
+	FORCEINLINE TConstIterator end() const    { return TConstIterator(*this, Max()); }
+
+private:
+	typedef TTypeCompatibleBytes<ElementType> FSlot;
+
+	FORCEINLINE ElementType* GetElement(int32 Index) const
+	{
+		return const_cast<FSlot*>(Slots.GetData())[Index].GetTypedPtr();
+	}
+
+	FORCEINLINE int32 GetGroupMask() const
+	{
+		return Max() / UE4FlatSet_Private::GroupWidth - 1;
+	}
+
+	/** @return The smallest power of two capacity which holds Number elements within the maximum load. */
+	static int32 GetCapacityFor(int32 Number)
+	{
+		int32 Capacity = UE4FlatSet_Private::GroupWidth;
+		while (UE4FlatSet_Private::GetMaxLoad(Capacity) < Number)
+		{
+			Capacity *= 2;
+		}
+		return Capacity;
+	}
+
+	/** @return The index of the slot holding the element with the given key, or INDEX_NONE. */
+	template<typename ComparableKey>
+	int32 FindIndex(const ComparableKey& Key, uint32 KeyHash) const
+	{
+		using namespace UE4FlatSet_Private;
+
+		if (NumElements == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint64 MixedHash = MixHash(KeyHash);
+		const int8 SlotHash = GetSlotHash(MixedHash);
+		const int32 GroupMask = GetGroupMask();
+
+		// Triangular probing over a power of two number of groups visits every group, and the maximum load
+		// guarantees there is always an empty slot somewhere to end the search.
+		int32 Group = (int32)(GetGroupHash(MixedHash) & (uint32)GroupMask);
+		for (int32 Step = 1; ; ++Step)
+		{
+			const int32 GroupStart = Group * GroupWidth;
+			const FGroup Ctrl(Controls.GetData() + GroupStart);
+
+			for (FGroupMask Candidates = Ctrl.Match(SlotHash); Candidates; Candidates.ClearLowestSlot())
+			{
+				const int32 Index = GroupStart + Candidates.LowestSlot();
+				if (KeyFuncs::Matches(KeyFuncs::GetSetKey(*GetElement(Index)), Key))
+				{
+					return Index;
+				}
+			}
+
+			if (Ctrl.MatchEmpty())
+			{
+				return INDEX_NONE;
+			}
+
+			Group = (Group + Step) & GroupMask;
+		}
+	}
+
+	/** @return The index of the first empty or deleted slot along the probe sequence of the given hash. */
+	static int32 FindFreeSlot(const int8* InControls, int32 GroupMask, uint64 MixedHash)
+	{
+		using namespace UE4FlatSet_Private;
+
+		int32 Group = (int32)(GetGroupHash(MixedHash) & (uint32)GroupMask);
+		for (int32 Step = 1; ; ++Step)
+		{
+			const int32 GroupStart = Group * GroupWidth;
+			const FGroupMask Free = FGroup(InControls + GroupStart).MatchEmptyOrDeleted();
+			if (Free)
+			{
+				return GroupStart + Free.LowestSlot();
+			}
+
+			Group = (Group + Step) & GroupMask;
+		}
+	}
+
+	/**
+	 * Finds the slot holding the given key, or claims a free slot for it, rehashing first if the set is full.
+	 * A claimed slot is counted and marked as full but its element is left unconstructed for the caller.
+	 *
+	 * @param bOutIsNew		Set to true when a free slot was claimed.
+	 * @return The index of the slot.
+	 */
+	template<typename ComparableKey>
+	int32 FindOrClaimSlot(const ComparableKey& Key, uint32 KeyHash, bool& bOutIsNew)
+	{
+		using namespace UE4FlatSet_Private;
+
+		int32 Index = FindIndex(Key, KeyHash);
+		if (Index != INDEX_NONE)
+		{
+			bOutIsNew = false;
+			return Index;
+		}
+
+		if (NumElements + NumDeleted + 1 > GetMaxLoad(Max()))
+		{
+			// Grow when most of the load is live elements, otherwise rehashing in place is enough to drop the deleted slots
+			const bool bGrow = (NumElements + 1) * 2 > GetMaxLoad(Max());
+			Rehash(bGrow ? FMath::Max(Max() * 2, (int32)GroupWidth) : Max());
+		}
+
+		const uint64 MixedHash = MixHash(KeyHash);
+		Index = FindFreeSlot(Controls.GetData(), GetGroupMask(), MixedHash);
+		if (Controls[Index] == CtrlDeleted)
+		{
+			--NumDeleted;
+		}
+		Controls[Index] = GetSlotHash(MixedHash);
+		++NumElements;
+
+		bOutIsNew = true;
+		return Index;
+	}
+
+	template<typename ArgType>
+	ElementType& AddImpl(ArgType&& InElement)
+	{
+		bool bIsNew;
+		const int32 Index = FindOrClaimSlot(KeyFuncs::GetSetKey(InElement), KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(InElement)), bIsNew);
+
+		ElementType* Element = GetElement(Index);
+		if (!bIsNew)
+		{
+			DestructItem(Element);
+		}
+		new(Element) ElementType(Forward<ArgType>(InElement));
+		return *Element;
+	}
+
+	void RemoveAt(int32 Index)
+	{
+		using namespace UE4FlatSet_Private;
+
+		DestructItem(GetElement(Index));
+		--NumElements;
+
+		// A group which still has an empty slot has never been probed past, so the slot can become empty again
+		// and terminate lookups early. Otherwise it has to stay a tombstone to keep longer probe sequences intact.
+		const int32 GroupStart = Index & ~(GroupWidth - 1);
+		if (FGroup(Controls.GetData() + GroupStart).MatchEmpty())
+		{
+			Controls[Index] = CtrlEmpty;
+		}
+		else
+		{
+			Controls[Index] = CtrlDeleted;
+			++NumDeleted;
+		}
+	}
+
+	/** Moves every element into a new table of the given capacity, dropping all deleted slots. */
+	void Rehash(int32 NewCapacity)
+	{
+		using namespace UE4FlatSet_Private;
+
+		checkSlow(FMath::IsPowerOfTwo(NewCapacity) && NewCapacity >= GroupWidth);
+		checkSlow(GetMaxLoad(NewCapacity) >= NumElements);
+
+		TArray<int8, Allocator> NewControls;
+		TArray<FSlot, Allocator> NewSlots;
+		NewControls.SetNumUninitialized(NewCapacity);
+		NewSlots.SetNumUninitialized(NewCapacity);
+		FMemory::Memset(NewControls.GetData(), (uint8)CtrlEmpty, NewCapacity);
+
+		const int32 NewGroupMask = NewCapacity / GroupWidth - 1;
+		const int32 OldCapacity = Max();
+		for (int32 Index = 0; Index < OldCapacity; ++Index)
+		{
+			if (Controls[Index] >= 0)
+			{
+				ElementType* Element = GetElement(Index);
+				const uint64 MixedHash = MixHash(KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(*Element)));
+				const int32 NewIndex = FindFreeSlot(NewControls.GetData(), NewGroupMask, MixedHash);
+
+				NewControls[NewIndex] = GetSlotHash(MixedHash);
+				RelocateConstructItems<ElementType>(NewSlots.GetData() + NewIndex, Element, 1);
+			}
+		}
+
+		Controls = MoveTemp(NewControls);
+		Slots = MoveTemp(NewSlots);
+		NumDeleted = 0;
+	}
+
+	void ClearControls()
+	{
+		if (Max() > 0)
+		{
+			FMemory::Memset(Controls.GetData(), (uint8)UE4FlatSet_Private::CtrlEmpty, Max());
+		}
+	}
+
+	void DestructElements()
+	{
+		if (!TIsTriviallyDestructible<ElementType>::Value && NumElements > 0)
+		{
+			const int32 Capacity = Max();
+			for (int32 Index = 0; Index < Capacity; ++Index)
+			{
+				if (Controls[Index] >= 0)
+				{
+					DestructItem(GetElement(Index));
+				}
+			}
+		}
+	}
+
+	/** Copies Other slot for slot, which keeps every element at a valid position without rehashing. Expects this set to be empty. */
+	void CopyFrom(const TFlatSet& Other)
+	{
+		Controls = Other.Controls;
+		Slots.Empty(Other.Max());
+		Slots.SetNumUninitialized(Other.Max());
+
+		const int32 Capacity = Max();
+		for (int32 Index = 0; Index < Capacity; ++Index)
+		{
+			if (Controls[Index] >= 0)
+			{
+				new(GetElement(Index)) ElementType(*Other.GetElement(Index));
+			}
+		}
+
+		NumElements = Other.NumElements;
+		NumDeleted = Other.NumDeleted;
+	}
+
+	/** Takes over the storage of Other, leaving it empty. Expects this set to be empty. */
+	void MoveFrom(TFlatSet& Other)
+	{
+		Controls = MoveTemp(Other.Controls);
+		Slots = MoveTemp(Other.Slots);
+		NumElements = Other.NumElements;
+		NumDeleted = Other.NumDeleted;
+
+		Other.NumElements = 0;
+		Other.NumDeleted = 0;
+	}
+
+	/** One control byte per slot: CtrlEmpty, CtrlDeleted, or the secondary hash of the element in the slot. */
+	TArray<int8, Allocator> Controls;
+
+	/** Element storage, only constructed where the matching control byte is full. */
+	TArray<FSlot, Allocator> Slots;
+
+	int32 NumElements = 0;
+	int32 NumDeleted = 0;
+};
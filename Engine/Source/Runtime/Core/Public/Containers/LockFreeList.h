@@ -770,6 +770,41 @@ public:
 		return nullptr;
 	}
 
+	/** @return true if any thread servicing this queue is stalled, i.e. waiting for a Push to wake it up. */
+	bool HasStalledThreads() const
+	{
+		TDoublePtr LocalMasterState;
+		LocalMasterState.AtomicRead(MasterState);
+		return UPTRINT(LocalMasterState.GetPtr()) != 0;
+	}
+
+	/**
+	 * Clears the stall state of a thread that found work elsewhere after a stalling Pop.
+	 * The thread may still get a redundant wake up, if a Push picked it before this.
+	 */
+	void Unstall(int32 MyThread)
+	{
+		check(MyThread >= 0 && MyThread < FLockFreeLinkPolicy::MAX_BITS_IN_TLinkPtr);
+
+		while (true)
+		{
+			TDoublePtr LocalMasterState;
+			LocalMasterState.AtomicRead(MasterState);
+			if (!TestBit(LocalMasterState.GetPtr(), MyThread))
+			{
+				break;
+			}
+
+			TDoublePtr NewMasterState;
+			NewMasterState.AdvanceCounterAndState(LocalMasterState, 1);
+			NewMasterState.SetPtr(TurnOffBit(LocalMasterState.GetPtr(), MyThread));
+			if (MasterState.InterlockedCompareExchange(NewMasterState, LocalMasterState))
+			{
+				break;
+			}
+		}
+	}
+
 private:
 
 	static int32 FindThreadToWake(TLinkPtr Ptr)
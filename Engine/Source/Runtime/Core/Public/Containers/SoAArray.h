@@ -0,0 +1,247 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Delegates/IntegerSequence.h"
+#include "Templates/Tuple.h"
+#include "Templates/UnrealTemplate.h"
+
+namespace UE4SoAArray_Private
+{
+	/** Fields are aligned to at least 16 bytes so that loops over them can use aligned vector loads from the start. */
+	template<typename FieldType>
+	struct TFieldAlignment
+	{
+		enum { Value = alignof(FieldType) > 16 ? alignof(FieldType) : 16 };
+	};
+
+	template<typename FieldType>
+	using TFieldArray = TArray<FieldType, TAlignedHeapAllocator<TFieldAlignment<FieldType>::Value>>;
+}
+
+/**
+ * A dynamically sized array of records stored as a structure of arrays: each field of the record lives in its own
+ * contiguous, aligned allocation, and all fields share the same element count and indices.
+ *
+ * This suits hot data which is usually processed one or two fields at a time, e.g. culling bounds versus the
+ * rest of a primitive's state, since those loops only touch the cache lines of the fields they read and can be
+ * vectorized over the field views.
+ *
+ * Example:
+ *
+ * TSoAArray<FVector4, float, uint32> Primitives;
+ * Primitives.Add(FVector4(0.0f, 0.0f, 0.0f, 1.0f), 10.0f, Flags);
+ * for (float& Radius : Primitives.GetField<1>()) { ... }
+ *
+ * @param FieldTypes The types of the fields of a record, in order.
+ */
+template<typename... FieldTypes>
+class TSoAArray
+{
+	static_assert(sizeof...(FieldTypes) > 0, "TSoAArray must have at least one field");
+
+	typedef TTuple<UE4SoAArray_Private::TFieldArray<FieldTypes>...> FieldArraysType;
+	typedef TMakeIntegerSequence<uint32, sizeof...(FieldTypes)> FieldIndicesType;
+
+public:
+	/** The number of fields in a record. */
+	static constexpr uint32 NumFields = sizeof...(FieldTypes);
+
+	/** The type of the field with the given index. */
+	template<uint32 FieldIndex>
+	using TFieldType = typename TTupleElement<FieldIndex, TTuple<FieldTypes...>>::Type;
+
+	/** @return The number of records in the array. */
+	FORCEINLINE int32 Num() const
+	{
+		return Fields.template Get<0>().Num();
+	}
+
+	/** @return The number of records the array can hold without reallocating the first field. */
+	FORCEINLINE int32 Max() const
+	{
+		return Fields.template Get<0>().Max();
+	}
+
+	/** @return True if the array holds no records. */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return Num() == 0;
+	}
+
+	/** @return True if the index refers to a record in the array. */
+	FORCEINLINE bool IsValidIndex(int32 Index) const
+	{
+		return Index >= 0 && Index < Num();
+	}
+
+	/** @return The amount of memory allocated by all the fields of this container. */
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = 0;
+		VisitTupleElements([&Size](const auto& Field) { Size += Field.GetAllocatedSize(); }, Fields);
+		return Size;
+	}
+
+	/** Reserves memory in every field so the array can hold Number records without reallocating. */
+	void Reserve(int32 Number)
+	{
+		VisitTupleElements([Number](auto& Field) { Field.Reserve(Number); }, Fields);
+	}
+
+	/**
+	 * Removes all records from the array.
+	 *
+	 * @param Slack The number of records the array should be able to hold afterwards.
+	 */
+	void Empty(int32 Slack = 0)
+	{
+		VisitTupleElements([Slack](auto& Field) { Field.Empty(Slack); }, Fields);
+	}
+
+	/**
+	 * Removes all records from the array, keeping the allocations if they are large enough.
+	 *
+	 * @param NewSize The number of records the array should be able to hold afterwards.
+	 */
+	void Reset(int32 NewSize = 0)
+	{
+		VisitTupleElements([NewSize](auto& Field) { Field.Reset(NewSize); }, Fields);
+	}
+
+	/**
+	 * Resizes the array, default constructing the fields of new records.
+	 *
+	 * @param NewNum The new number of records.
+	 * @param bAllowShrinking Whether the allocations may shrink when records are removed.
+	 */
+	void SetNum(int32 NewNum, bool bAllowShrinking = true)
+	{
+		VisitTupleElements([NewNum, bAllowShrinking](auto& Field) { Field.SetNum(NewNum, bAllowShrinking); }, Fields);
+	}
+
+	/**
+	 * Adds records with default constructed fields to the end of the array.
+	 *
+	 * @param Count The number of records to add.
+	 * @return The index of the first added record.
+	 */
+	int32 AddDefaulted(int32 Count = 1)
+	{
+		const int32 Index = Num();
+		VisitTupleElements([Count](auto& Field) { Field.AddDefaulted(Count); }, Fields);
+		return Index;
+	}
+
+	/**
+	 * Adds records with uninitialized fields to the end of the array. The caller must construct every field of the
+	 * added records, which is mainly useful for trivial field types filled in by a following loop.
+	 *
+	 * @param Count The number of records to add.
+	 * @return The index of the first added record.
+	 */
+	int32 AddUninitialized(int32 Count = 1)
+	{
+		const int32 Index = Num();
+		VisitTupleElements([Count](auto& Field) { Field.AddUninitialized(Count); }, Fields);
+		return Index;
+	}
+
+	/**
+	 * Adds a record to the end of the array.
+	 *
+	 * @param Values The value of each field of the record.
+	 * @return The index of the added record.
+	 */
+	FORCEINLINE int32 Add(const FieldTypes&... Values)
+	{
+		return EmplaceImpl(FieldIndicesType(), Values...);
+	}
+
+	/**
+	 * Adds a record to the end of the array, constructing each field from one argument.
+	 *
+	 * @param Args One argument for each field of the record.
+	 * @return The index of the added record.
+	 */
+	template<typename... ArgTypes>
+	FORCEINLINE int32 Emplace(ArgTypes&&... Args)
+	{
+		static_assert(sizeof...(ArgTypes) == NumFields, "TSoAArray::Emplace needs exactly one argument per field");
+		return EmplaceImpl(FieldIndicesType(), Forward<ArgTypes>(Args)...);
+	}
+
+	/**
+	 * Removes records from the array, keeping the order of the remaining records.
+	 *
+	 * @param Index The index of the first record to remove.
+	 * @param Count The number of records to remove.
+	 * @param bAllowShrinking Whether the allocations may shrink.
+	 */
+	void RemoveAt(int32 Index, int32 Count = 1, bool bAllowShrinking = true)
+	{
+		VisitTupleElements([Index, Count, bAllowShrinking](auto& Field) { Field.RemoveAt(Index, Count, bAllowShrinking); }, Fields);
+	}
+
+	/**
+	 * Removes records from the array by moving the last records into their place, so the order of the remaining
+	 * records isn't kept. This is the cheaper removal.
+	 *
+	 * @param Index The index of the first record to remove.
+	 * @param Count The number of records to remove.
+	 * @param bAllowShrinking Whether the allocations may shrink.
+	 */
+	void RemoveAtSwap(int32 Index, int32 Count = 1, bool bAllowShrinking = true)
+	{
+		VisitTupleElements([Index, Count, bAllowShrinking](auto& Field) { Field.RemoveAtSwap(Index, Count, bAllowShrinking); }, Fields);
+	}
+
+	/**
+	 * Gets a view of one field of every record. The view is contiguous and its data is aligned to at least 16 bytes.
+	 * It is invalidated by any operation which adds or removes records.
+	 */
+	template<uint32 FieldIndex>
+	FORCEINLINE TArrayView<TFieldType<FieldIndex>> GetField()
+	{
+		return TArrayView<TFieldType<FieldIndex>>(Fields.template Get<FieldIndex>());
+	}
+
+	template<uint32 FieldIndex>
+	FORCEINLINE TArrayView<const TFieldType<FieldIndex>> GetField() const
+	{
+		return TArrayView<const TFieldType<FieldIndex>>(Fields.template Get<FieldIndex>());
+	}
+
+	/** Gets one field of the record at the given index. */
+	template<uint32 FieldIndex>
+	FORCEINLINE TFieldType<FieldIndex>& Get(int32 Index)
+	{
+		return Fields.template Get<FieldIndex>()[Index];
+	}
+
+	template<uint32 FieldIndex>
+	FORCEINLINE const TFieldType<FieldIndex>& Get(int32 Index) const
+	{
+		return Fields.template Get<FieldIndex>()[Index];
+	}
+
+private:
+	template<uint32... Indices, typename... ArgTypes>
+	int32 EmplaceImpl(TIntegerSequence<uint32, Indices...>, ArgTypes&&... Args)
+	{
+		const int32 Index = Num();
+
+		// This should be implemented with a fold expression when our compilers support it
+		int Temp[] = { 0, (Fields.template Get<Indices>().Emplace(Forward<ArgTypes>(Args)), 0)... };
+		(void)Temp;
+
+		return Index;
+	}
+
+	FieldArraysType Fields;
+};
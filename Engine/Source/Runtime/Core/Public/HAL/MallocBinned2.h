@@ -74,6 +74,12 @@
 
 #define BINNED2_ALLOCATOR_STATS_VALIDATION (BINNED2_ALLOCATOR_STATS && 0)
 
+// Per pool counters of TLS cache hits/misses, pool allocs/frees and OS page traffic, published to CSV/trace in UpdateStats and
+// printed by DumpAllocatorStats. This adds a counter increment to the small allocation fast paths, so it's opt-in.
+#ifndef BINNED2_ALLOCATOR_PER_BIN_STATS
+	#define BINNED2_ALLOCATOR_PER_BIN_STATS 0
+#endif
+
 #if BINNED2_ALLOCATOR_STATS
 //////////////////////////////////////////////////////////////////////////
 // the following don't need a critical section because they are covered by the critical section called Mutex
@@ -187,6 +193,14 @@ class CORE_API FMallocBinned2 : public FMalloc
 		FPoolList ExhaustedPools;
 		uint32    BlockSize;
 
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+		// the following are covered by the critical section called Mutex
+		uint64    NumPoolAllocs;	// blocks handed out by the pools (TLS cache misses and refills)
+		uint64    NumPoolFrees;		// blocks returned to the pools
+		uint64    NumOSPageAllocs;	// pages requested from CachedOSPageAllocator
+		uint64    NumOSPageFrees;	// pages returned to CachedOSPageAllocator
+#endif
+
 		FPoolTable();
 	};
 
@@ -315,6 +329,35 @@ class CORE_API FMallocBinned2 : public FMalloc
 	};
 	static_assert(sizeof(FBundleNode) <= BINNED2_MINIMUM_ALIGNMENT, "Bundle nodes must fit into the smallest block size");
 
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	/** Per pool counters of a thread's free block cache, only written by the owning thread. */
+	struct FCacheStats
+	{
+		uint64 Hits;	// allocations served by the TLS cache (directly, or from a recycled bundle)
+		uint64 Misses;	// allocations that had to take the mutex
+		uint64 Frees;	// frees taken by the TLS cache
+	};
+
+public:
+	/** Per pool counters, totalled over all threads and the pool tables. */
+	struct FBinStats
+	{
+		uint32 BlockSize;
+		uint64 CacheHits;
+		uint64 CacheMisses;
+		uint64 CacheFrees;
+		uint64 PoolAllocs;
+		uint64 PoolFrees;
+		uint64 OSPageAllocs;
+		uint64 OSPageFrees;
+	};
+
+	/** Gathers the per pool counters (cumulative since startup). */
+	void GetBinStats(FBinStats (&OutBinStats)[BINNED2_SMALL_POOL_COUNT]);
+
+private:
+#endif
+
 	struct FFreeBlockList
 	{
 		// return true if we actually pushed it
@@ -377,7 +420,11 @@ class CORE_API FMallocBinned2 : public FMalloc
 #if BINNED2_ALLOCATOR_STATS
 			: AllocatedMemory(0) 
 #endif
-		{ }
+		{
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+			FMemory::Memzero(CacheStats);
+#endif
+		}
 
 		FORCEINLINE void* Malloc(uint32 InPoolIndex)
 		{
@@ -411,6 +458,11 @@ class CORE_API FMallocBinned2 : public FMalloc
 	public:
 		int64 AllocatedMemory;
 		static int64 ConsolidatedMemory;
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+	public:
+		FCacheStats CacheStats[BINNED2_SMALL_POOL_COUNT];
+		static FCacheStats ConsolidatedCacheStats[BINNED2_SMALL_POOL_COUNT];
 #endif
 	private:
 		FFreeBlockList FreeLists[BINNED2_SMALL_POOL_COUNT];
@@ -475,6 +527,12 @@ public:
 				{
 					Lists->AllocatedMemory += BlockSize;
 				}
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+				if (Result)
+				{
+					Lists->CacheStats[PoolIndex].Hits++;
+				}
 #endif
 			}
 		}
@@ -639,6 +697,9 @@ public:
 				{
 #if BINNED2_ALLOCATOR_STATS
 					Lists->AllocatedMemory -= BasePtr->BlockSize;
+#endif
+#if BINNED2_ALLOCATOR_PER_BIN_STATS
+					Lists->CacheStats[BasePtr->PoolIndex].Frees++;
 #endif
 					return;
 				}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include "ProfilingDebugging/LockTrace.h"
 #include <pthread.h>
 #include <errno.h>
 
@@ -18,6 +19,10 @@ class FPThreadsCriticalSection
 	 */
 	pthread_mutex_t Mutex;
 
+#if LOCKTRACE_ENABLED
+	FLockTraceState TraceState;
+#endif
+
 public:
 
 	/**
@@ -46,7 +51,17 @@ public:
 	 */
 	FORCEINLINE void Lock(void)
 	{
+#if LOCKTRACE_ENABLED
+		if (pthread_mutex_trylock(&Mutex) != 0)
+		{
+			const uint64 WaitStartCycles = FLockTrace::BeginWait(TraceState);
+			pthread_mutex_lock(&Mutex);
+			FLockTrace::EndWait(this, TraceState, WaitStartCycles, ELockTraceType::CriticalSection, LOCKTRACE_CALLSITE());
+		}
+		FLockTrace::Acquired(TraceState);
+#else
 		pthread_mutex_lock(&Mutex);
+#endif
 	}
 	
 	/**
@@ -56,7 +71,16 @@ public:
 	 */
 	FORCEINLINE bool TryLock()
 	{
+#if LOCKTRACE_ENABLED
+		if (0 != pthread_mutex_trylock(&Mutex))
+		{
+			return false;
+		}
+		FLockTrace::Acquired(TraceState);
+		return true;
+#else
 		return 0 == pthread_mutex_trylock(&Mutex);
+#endif
 	}
 
 	/**
@@ -64,6 +88,9 @@ public:
 	 */
 	FORCEINLINE void Unlock(void)
 	{
+#if LOCKTRACE_ENABLED
+		FLockTrace::Released(this, TraceState);
+#endif
 		pthread_mutex_unlock(&Mutex);
 	}
 
@@ -4,6 +4,7 @@
 
 #include "CoreTypes.h"
 #include "Misc/AssertionMacros.h"
+#include "ProfilingDebugging/LockTrace.h"
 #include <pthread.h>
 #include <errno.h>
 
@@ -28,14 +29,35 @@ public:
 	
 	void ReadLock()
 	{
+#if LOCKTRACE_ENABLED
+		if (pthread_rwlock_tryrdlock(&Mutex) == 0)
+		{
+			return;
+		}
+		const uint64 WaitStartCycles = FLockTrace::BeginWait(TraceState);
 		int Err = pthread_rwlock_rdlock(&Mutex);
+		FLockTrace::EndWait(this, TraceState, WaitStartCycles, ELockTraceType::ReadLock, LOCKTRACE_CALLSITE());
+#else
+		int Err = pthread_rwlock_rdlock(&Mutex);
+#endif
 		checkf(Err == 0, TEXT("pthread_rwlock_rdlock failed with error: %d"), Err);
 	}
 	
 	void WriteLock()
 	{
+#if LOCKTRACE_ENABLED
+		if (pthread_rwlock_trywrlock(&Mutex) != 0)
+		{
+			const uint64 WaitStartCycles = FLockTrace::BeginWait(TraceState);
+			int Err = pthread_rwlock_wrlock(&Mutex);
+			checkf(Err == 0, TEXT("pthread_rwlock_wrlock failed with error: %d"), Err);
+			FLockTrace::EndWait(this, TraceState, WaitStartCycles, ELockTraceType::WriteLock, LOCKTRACE_CALLSITE());
+		}
+		FLockTrace::Acquired(TraceState);
+#else
 		int Err = pthread_rwlock_wrlock(&Mutex);
 		checkf(Err == 0, TEXT("pthread_rwlock_wrlock failed with error: %d"), Err);
+#endif
 	}
 	
 	void ReadUnlock()
@@ -46,10 +68,18 @@ public:
 	
 	void WriteUnlock()
 	{
+#if LOCKTRACE_ENABLED
+		FLockTrace::Released(this, TraceState);
+#endif
 		int Err = pthread_rwlock_unlock(&Mutex);
 		checkf(Err == 0, TEXT("pthread_rwlock_unlock failed with error: %d"), Err);
 	}
 
 private:
 	pthread_rwlock_t Mutex;
+
+#if LOCKTRACE_ENABLED
+	/** Hold times are only tracked for writers, as readers share the lock. */
+	FLockTraceState TraceState;
+#endif
 };
@@ -674,6 +674,16 @@ public:
 		return *this != InvalidChunkId;
 	}
 
+	inline const uint8* GetData() const
+	{
+		return Id;
+	}
+
+	static constexpr uint32 GetSize()
+	{
+		return sizeof Id;
+	}
+
 private:
 	static inline FIoChunkId CreateEmptyId()
 	{
@@ -742,11 +752,25 @@ public:
 		RequestedSize	= Size;
 	}
 
+	/**
+	 * Makes the request write into caller owned memory instead of allocating its own buffer, e.g. locked RHI staging
+	 * memory for a streamed mip. Compressed blocks which are read in full are decompressed straight into it.
+	 */
 	void SetTargetVa(void* InTargetVa)
 	{
 		TargetVa = InTargetVa;
 	}
 
+	/**
+	 * Allows an uncompressed, unencrypted chunk to be returned as a view of the memory mapped container instead of
+	 * a copy, for data which stays resident like shader code or audio. The view is read only and stays valid for as
+	 * long as the container is mounted. Chunks which can't be mapped are read as usual.
+	 */
+	void SetAllowMapped(bool bAllowMapped)
+	{
+		Flags = bAllowMapped ? (Flags | Flag_AllowMapped) : (Flags & ~Flag_AllowMapped);
+	}
+
 	uint64 GetOffset() const
 	{
 		return RequestedOffset;
@@ -762,7 +786,17 @@ public:
 		return TargetVa;
 	}
 
+	bool IsMappedAllowed() const
+	{
+		return (Flags & Flag_AllowMapped) != 0;
+	}
+
 private:
+	enum : uint32
+	{
+		Flag_AllowMapped = 1 << 0,
+	};
+
 	uint64	RequestedOffset = 0;
 	uint64	RequestedSize = ~uint64(0);
 	void* TargetVa = nullptr;
@@ -1150,6 +1184,12 @@ public:
 	UE_NODISCARD CORE_API FIoStatus	Initialize(const FIoStoreWriterContext& Context, const FIoContainerSettings& ContainerSettings, const TArray<TUniquePtr<FIoStoreReader>>& PatchSourceReaders = TArray<TUniquePtr<FIoStoreReader>>());
 	CORE_API void Append(const FIoChunkId& ChunkId, FIoBuffer Chunk, const FIoWriteOptions& WriteOptions);
 	CORE_API void Append(const FIoChunkId& ChunkId, IIoStoreWriteRequest* Request, const FIoWriteOptions& WriteOptions);
+	/**
+	 * Finalizes the layout and queues all appended chunks for compression without waiting for them, so that containers
+	 * sharing a writer context compress concurrently. Optional, Flush still has to be called and writers sharing a context
+	 * must be flushed in the order BeginFlush was called on them.
+	 */
+	CORE_API void BeginFlush();
 	UE_NODISCARD CORE_API TIoStatusOr<FIoStoreWriterResult> Flush();
 
 private:
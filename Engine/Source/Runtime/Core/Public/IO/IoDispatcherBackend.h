@@ -56,5 +56,6 @@ private:
 	bool bSubmitted = false;
 	bool bCancelled = false;
 	bool bFailed = false;
+	bool bIsReadahead = false;
 };
 
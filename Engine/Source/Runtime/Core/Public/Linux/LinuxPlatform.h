@@ -11,3 +11,6 @@
 #define PLATFORM_GLOBAL_LOG_CATEGORY			LogLinux
 
 #define PLATFORM_SUPPORTS_BORDERLESS_WINDOW		1
+
+// IoStore reads go through io_uring when the kernel supports it, see FLinuxFileIoStoreImpl
+#define PLATFORM_IMPLEMENTS_IO					1
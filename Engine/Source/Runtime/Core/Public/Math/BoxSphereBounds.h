@@ -239,6 +239,16 @@ public:
 	 */
 	CORE_API FBoxSphereBounds TransformBy( const FTransform& M ) const;
 
+	/**
+	 * Gets the bounding volume transformed by each of the matrices, e.g. for the instances of a mesh.
+	 * The results are the same as calling TransformBy for each matrix, but the bounds are only loaded once.
+	 *
+	 * @param Matrices The matrices, 16 byte aligned like any FMatrix.
+	 * @param OutBounds Receives the transformed volumes, one per matrix.
+	 * @param Num Number of matrices.
+	 */
+	CORE_API void TransformByBatch( const FMatrix* Matrices, FBoxSphereBounds* OutBounds, int32 Num ) const;
+
 	/**
 	 * Get a textual representation of this bounding box.
 	 *
@@ -1036,6 +1036,14 @@ private:
 	/** Serialize a bootstrapping state into or from an archive */
 	void SerializeStateForBootstrap_Impl(FArchive& Ar);
 
+	/**
+	 * With -ConfigCache, the text-based GConfig is saved after it's loaded, along with the hash of every ini file that went into it,
+	 * and the next start loads it in one read instead of parsing the ini files again if the files, executable and command line didn't change.
+	 */
+	static bool CreateGConfigFromStartupCache(const FString& Filename);
+	void SaveStartupCache(const FString& Filename);
+	void GatherStartupCacheDependencies(FArchive& Ar) const;
+
 	/** true if file operations should not be performed */
 	bool bAreFileOperationsDisabled;
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include "CoreGlobals.h"
 #include "Misc/AssertionMacros.h"
 #include "HAL/UnrealMemory.h"
 #include "Containers/ContainerAllocationPolicies.h"
@@ -151,6 +152,7 @@ public:
 
 	// Friends.
 	friend class FMemMark;
+	friend class FFrameMemStack;
 	friend void* operator new(size_t Size, FMemStackBase& Mem, int32 Count, int32 Align);
 	friend void* operator new(size_t Size, FMemStackBase& Mem, EMemZeroed Tag, int32 Count, int32 Align);
 	friend void* operator new(size_t Size, FMemStackBase& Mem, EMemOned Tag, int32 Count, int32 Align);
@@ -202,6 +204,72 @@ class CORE_API FMemStack : public TThreadSingleton<FMemStack>, public FMemStackB
 };
 
 
+/**
+ * Per-thread linear allocator for temporaries that only need to live for about a frame.
+ * Unlike FMemStack, no FMemMark is needed: memory is released in bulk, when the thread first allocates from it in a later frame.
+ * It's double buffered by GFrameCounter, so an allocation stays valid until the end of the frame after the one it was made in,
+ * which covers work that straddles a frame boundary (e.g. the rendering thread running a frame behind).
+ * Chunks come from FPageAllocator, so steady state allocations don't touch GMalloc.
+ **/
+class CORE_API FFrameMemStack : public TThreadSingleton<FFrameMemStack>
+{
+public:
+	FFrameMemStack();
+
+	FORCEINLINE uint8* PushBytes(int32 AllocSize, int32 Alignment)
+	{
+		return (uint8*)Alloc(AllocSize, FMath::Max(AllocSize >= 16 ? (int32)16 : (int32)8, Alignment));
+	}
+
+	FORCEINLINE void* Alloc(int32 AllocSize, int32 Alignment)
+	{
+		checkSlow(AllocSize>=0);
+		checkSlow((Alignment&(Alignment-1))==0);
+
+		const uint64 FrameCounter = GFrameCounter;
+		if (FrameCounter != CurrentFrame)
+		{
+			BeginFrame(FrameCounter);
+		}
+
+		// Same fast path as FMemStackBase::Alloc; new chunks go through AllocSlow so they're LLM tagged.
+		FMemStackBase& Stack = Stacks[CurrentFrame & 1];
+		uint8* Result = Align(Stack.Top, Alignment);
+		uint8* NewTop = Result + AllocSize;
+
+		if (Stack.Top != nullptr && NewTop <= Stack.End)
+		{
+			Stack.Top = NewTop;
+			return Result;
+		}
+
+		return AllocSlow(Stack, AllocSize, Alignment);
+	}
+
+	/** @return the number of bytes in use by this thread's frame stacks (both the current and the previous frame). */
+	int32 GetByteCount() const;
+
+	/** Returns true if the pointer was allocated using this thread's frame stacks */
+	bool ContainsPointer(const void* Pointer) const;
+
+private:
+	/** Releases the stack of the frame before last, which becomes the current frame's stack */
+	void BeginFrame(uint64 FrameCounter);
+
+	/** Allocates a new chunk for Stack, and then allocates from it */
+	void* AllocSlow(FMemStackBase& Stack, int32 AllocSize, int32 Alignment);
+
+	/** Stack per frame parity, indexed by (frame counter & 1) */
+	FMemStackBase Stacks[2];
+
+	/** The frame counter each stack was last used in */
+	uint64 StackFrames[2];
+
+	/** The frame counter at the last allocation */
+	uint64 CurrentFrame;
+};
+
+
 /*-----------------------------------------------------------------------------
 	FMemStack templates.
 -----------------------------------------------------------------------------*/
@@ -386,6 +454,121 @@ struct TAllocatorTraits<TMemStackAllocator<Alignment>> : TAllocatorTraitsBase<TM
 };
 
 
+/**
+ * A container allocator that allocates from the calling thread's FFrameMemStack.
+ * The container's memory is only valid until the end of the next frame, and the container must not be grown from another thread
+ * (elements are copied into the new allocation, the old one is left to the frame stack).
+ */
+template<uint32 Alignment = DEFAULT_ALIGNMENT>
+class TFrameMemStackAllocator
+{
+public:
+	using SizeType = int32;
+
+	enum { NeedsElementType = true };
+	enum { RequireRangeCheck = true };
+
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		/** Default constructor. */
+		ForElementType():
+			Data(nullptr)
+		{}
+
+		/**
+		 * Moves the state of another allocator into this one.
+		 * Assumes that the allocator is currently empty, i.e. memory may be allocated but any existing elements have already been destructed (if necessary).
+		 * @param Other - The allocator to move the state from.  This allocator should be left in a valid empty state.
+		 */
+		FORCEINLINE void MoveToEmpty(ForElementType& Other)
+		{
+			checkSlow(this != &Other);
+
+			Data       = Other.Data;
+			Other.Data = nullptr;
+		}
+
+		// FContainerAllocatorInterface
+		FORCEINLINE ElementType* GetAllocation() const
+		{
+			return Data;
+		}
+
+		void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements,SIZE_T NumBytesPerElement)
+		{
+			void* OldData = Data;
+			if( NumElements )
+			{
+				// Allocate memory from the frame stack.
+				Data = (ElementType*)FFrameMemStack::Get().PushBytes(
+					(int32)(NumElements * NumBytesPerElement),
+					FMath::Max(Alignment,(uint32)alignof(ElementType))
+					);
+
+				// If the container previously held elements, copy them into the new allocation.
+				if(OldData && PreviousNumElements)
+				{
+					const SizeType NumCopiedElements = FMath::Min(NumElements,PreviousNumElements);
+					FMemory::Memcpy(Data,OldData,NumCopiedElements * NumBytesPerElement);
+				}
+			}
+			else
+			{
+				Data = nullptr;
+			}
+		}
+		FORCEINLINE SizeType CalculateSlackReserve(SizeType NumElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, false, Alignment);
+		}
+		FORCEINLINE SizeType CalculateSlackShrink(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackShrink(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+		FORCEINLINE SizeType CalculateSlackGrow(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+
+		FORCEINLINE SIZE_T GetAllocatedSize(SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return NumAllocatedElements * NumBytesPerElement;
+		}
+
+		bool HasAllocation() const
+		{
+			return !!Data;
+		}
+
+		SizeType GetInitialCapacity() const
+		{
+			return 0;
+		}
+
+	private:
+
+		/** A pointer to the container's elements. */
+		ElementType* Data;
+	};
+
+	typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+template <uint32 Alignment>
+struct TAllocatorTraits<TFrameMemStackAllocator<Alignment>> : TAllocatorTraitsBase<TFrameMemStackAllocator<Alignment>>
+{
+	enum { SupportsMove    = true };
+	enum { IsZeroConstruct = true };
+};
+
+/** Sparse array/set allocators for TSparseArray, TSet and TMap containers with frame lifetime, e.g. TMap<int32, int32, FDefaultSetAllocator> -> TMap<int32, int32, FFrameMemStackSetAllocator> */
+typedef TSparseArrayAllocator<TFrameMemStackAllocator<>, TFrameMemStackAllocator<>> FFrameMemStackSparseArrayAllocator;
+typedef TSetAllocator<FFrameMemStackSparseArrayAllocator, TFrameMemStackAllocator<>> FFrameMemStackSetAllocator;
+
+
 /**
  * FMemMark marks a top-of-stack position in the memory stack.
  * When the marker is constructed or initialized with a particular memory 
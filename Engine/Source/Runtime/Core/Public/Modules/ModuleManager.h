@@ -170,6 +170,27 @@ public:
 	 */
 	bool IsModuleLoaded( const FName InModuleName ) const;
 
+	/**
+	 * Defers the startup of a module to its first use, instead of the loading phase it was listed for.
+	 *
+	 * The module is loaded by the first GetModule, GetModulePtr or GetModuleChecked call for it on the game thread, or by
+	 * an explicit LoadModule. IsModuleLoaded keeps returning false until then, so optional integrations don't trigger it.
+	 * Only suitable for modules whose types aren't needed before that, e.g. classes referenced by loaded content.
+	 *
+	 * @param InModuleName The module to defer.
+	 * @see IsModuleDeferred
+	 */
+	void AddDeferredModule( const FName InModuleName );
+
+	/**
+	 * Checks whether the specified module was deferred and hasn't been used yet.
+	 *
+	 * @param InModuleName The module to check.
+	 * @return true if the module will be loaded on first use.
+	 * @see AddDeferredModule
+	 */
+	bool IsModuleDeferred( const FName InModuleName ) const;
+
 	/**
 	 * Loads the specified module.
 	 *
@@ -273,6 +294,7 @@ public:
 	static TModuleInterface& GetModuleChecked( const FName ModuleName )
 	{
 		FModuleManager& ModuleManager = FModuleManager::Get();
+		ModuleManager.LoadIfDeferred(ModuleName);
 
 		checkf(ModuleManager.IsModuleLoaded(ModuleName), TEXT("Tried to get module interface for unloaded module: '%s'"), *(ModuleName.ToString()));
 		return static_cast<TModuleInterface&>(*ModuleManager.GetModule(ModuleName));
@@ -281,6 +303,9 @@ public:
 private:
 	static IModuleInterface* GetModulePtr_Internal(FName ModuleName);
 
+	/** Loads the module if it was deferred to its first use. Only the game thread loads, other threads see it once it has been. */
+	void LoadIfDeferred(const FName InModuleName);
+
 public:
 
 	/**
@@ -633,6 +658,9 @@ private:
 	/** ID used to validate module manifests. Read from the module manifest in the engine directory on first query to load a new module; unset until then. */
 	mutable TOptional<FString> BuildId;
 
+	/** Modules whose startup was deferred to their first use, only accessed on the game thread */
+	TSet<FName> DeferredModules;
+
 	/** Critical section object controlling R/W access to Modules. */
 	mutable FCriticalSection ModulesCriticalSection;
 };
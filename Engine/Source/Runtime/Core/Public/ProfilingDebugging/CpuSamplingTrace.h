@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Trace/Config.h"
+
+// Periodic callstack sampling of all known threads into the "CpuSampling" trace channel. This shows where time
+// goes in code that isn't instrumented with TRACE_CPUPROFILER_EVENT_SCOPE. Only platforms which can capture another
+// thread's callstack are supported.
+#if !defined(CPUSAMPLINGTRACE_ENABLED)
+#if UE_TRACE_ENABLED && (PLATFORM_WINDOWS || PLATFORM_LINUX)
+#define CPUSAMPLINGTRACE_ENABLED 1
+#else
+#define CPUSAMPLINGTRACE_ENABLED 0
+#endif
+#endif
+
+#if CPUSAMPLINGTRACE_ENABLED
+
+struct FCpuSamplingTrace
+{
+	/** Starts or stops the sampling thread to follow the state of the CpuSampling channel. Called once per frame. */
+	CORE_API static void Update();
+
+	/** Stops the sampling thread, if it is running. */
+	CORE_API static void Shutdown();
+};
+
+#endif // CPUSAMPLINGTRACE_ENABLED
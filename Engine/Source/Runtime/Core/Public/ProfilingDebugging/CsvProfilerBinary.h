@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+
+/**
+ * Binary CSV profiler capture format (.csvbin), written instead of text when csv.WriteBinary is set.
+ *
+ * The file starts with a header (Magic, Version, EFileFlags) followed by blocks, each prefixed by its uncompressed
+ * and stored size as uint32s. Blocks are zlib compressed when the CompressedBlocks flag is set. Once unpacked, the
+ * blocks form a single stream of records, each starting with an ERecordType byte:
+ *
+ *  - SeriesDefs: stat columns added since the previous SeriesDefs record, as a uint32 count of (ESeriesType, FString name)
+ *  - Rows:       a uint32 row count and column count, each row's events as a single FString, then each column's values
+ *                for all the rows as raw 32 bit ints or floats. Storing values by column keeps similar values next to
+ *                each other, which makes the file cheap to compress. Columns added partway through are zero filled.
+ *  - Metadata:   a uint32 count of FString key/value pairs, written once at the end of the capture
+ *
+ * Use FCsvBinaryFormat::ConvertToText (or the CsvConvert program) to get a regular .csv file back.
+ */
+struct FCsvBinaryFormat
+{
+	/** "UECSVBIN" */
+	static const uint64 Magic = 0x4E49425653434555ull;
+	static const uint32 Version = 1;
+
+	enum EFileFlags : uint32
+	{
+		CompressedBlocks = 1 << 0,
+	};
+
+	enum class ERecordType : uint8
+	{
+		SeriesDefs,
+		Rows,
+		Metadata,
+	};
+
+	enum class ESeriesType : uint8
+	{
+		Float,
+		Int,
+	};
+
+	/** Converts a binary capture to the text .csv format written by the CSV profiler. Returns false if the file could not be read. */
+	static CORE_API bool ConvertToText(const TCHAR* BinaryFilename, const TCHAR* TextFilename);
+};
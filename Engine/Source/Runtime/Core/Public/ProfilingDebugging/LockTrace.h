@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Trace/Config.h"
+
+// Instrumentation of the PThreads critical sections, read/write locks and events. Off by default since it adds
+// bookkeeping to every lock; define LOCKTRACE_ENABLED=1 for the build to find lock convoys with "-trace=lock".
+#if !defined(LOCKTRACE_ENABLED)
+#define LOCKTRACE_ENABLED 0
+#endif
+
+#if LOCKTRACE_ENABLED && !UE_TRACE_ENABLED
+#undef LOCKTRACE_ENABLED
+#define LOCKTRACE_ENABLED 0
+#endif
+
+#if LOCKTRACE_ENABLED
+
+#if defined(_MSC_VER)
+#define LOCKTRACE_CALLSITE() _ReturnAddress()
+#else
+#define LOCKTRACE_CALLSITE() __builtin_return_address(0)
+#endif
+
+enum class ELockTraceType : uint8
+{
+	CriticalSection,
+	ReadLock,
+	WriteLock,
+};
+
+/** Bookkeeping embedded in each instrumented lock. Only the thread holding the lock touches the acquire fields. */
+struct FLockTraceState
+{
+	uint64 AcquireCycles = 0;
+	uint32 RecursionCount = 0;
+	volatile int32 NumWaiters = 0;
+};
+
+/**
+ * Records lock contention into the "Lock" trace channel.
+ *
+ * Acquisitions which had to block are traced with their wait time and call site, so the number of these events per
+ * lock is its contention count. Exclusive holds are traced with their hold time only when another thread was
+ * waiting for the lock at release, which shows the holder that caused a convoy without tracing every lock.
+ */
+struct FLockTrace
+{
+	/** Marks the calling thread as waiting for a lock which couldn't be taken immediately. @return The cycle count the wait started at. */
+	CORE_API static uint64 BeginWait(FLockTraceState& State);
+
+	/** Marks the end of a wait started with BeginWait, once the lock has been taken. */
+	CORE_API static void EndWait(const void* Lock, FLockTraceState& State, uint64 StartCycles, ELockTraceType Type, const void* CallSite);
+
+	/** Called by the thread which took an exclusive lock. */
+	CORE_API static void Acquired(FLockTraceState& State);
+
+	/** Called by the thread releasing an exclusive lock, before the lock is released. */
+	CORE_API static void Released(const void* Lock, FLockTraceState& State);
+
+	/** Records a wait on an event which wasn't signaled yet when the wait started. */
+	CORE_API static void EventWait(const void* Event, uint64 StartCycles, bool bSignaled);
+
+	/** @return The current cycle count if the lock channel is enabled, otherwise zero. */
+	CORE_API static uint64 GetWaitStartCycles();
+};
+
+#endif // LOCKTRACE_ENABLED
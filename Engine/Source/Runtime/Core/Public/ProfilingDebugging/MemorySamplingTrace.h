@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Trace/Config.h"
+
+// Sampled allocation tracing into the "MemSampling" trace channel. Roughly one in Trace.MemSampling.Interval
+// allocations is traced along with its callstack, and its free is traced as well so lifetimes are known. Each sample
+// carries the interval it was taken at so that analysis can scale the samples back up to estimated totals. This is
+// cheap enough to leave running on production servers, unlike tracking every allocation.
+#if !defined(MEMORYSAMPLINGTRACE_ENABLED)
+#if UE_TRACE_ENABLED && !UE_BUILD_SHIPPING
+#define MEMORYSAMPLINGTRACE_ENABLED 1
+#else
+#define MEMORYSAMPLINGTRACE_ENABLED 0
+#endif
+#endif
+
+#if MEMORYSAMPLINGTRACE_ENABLED
+
+class FMalloc;
+
+struct FMemorySamplingTrace
+{
+	/**
+	 * Wraps the allocator with the sampling proxy if the MemSampling channel is enabled (e.g. -trace=memsampling).
+	 * Only allocations made after this are sampled.
+	 */
+	CORE_API static FMalloc* OverrideIfEnabled(FMalloc* InUsedAlloc);
+
+	/** Traces the names of the callstack addresses seen since the last update. Called once per frame. */
+	CORE_API static void Update();
+};
+
+#endif // MEMORYSAMPLINGTRACE_ENABLED
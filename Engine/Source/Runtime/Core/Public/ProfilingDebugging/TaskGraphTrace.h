@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Trace/Trace.h"
+#include "Trace/Detail/Channel.h"
+#include "Trace/Detail/Channel.inl"
+
+// Task graph dependency tracing into the "TaskGraph" trace channel (-trace=taskgraph). Traces each task's creation
+// with its prerequisites, when it ran and on which thread, when its completion event fired, and when threads blocked
+// waiting for tasks. Together with the CPU timing events this is enough for analysis to rebuild the dependency graph
+// of a frame and find the chain of tasks the game thread actually waited on.
+#if !defined(TASKGRAPHTRACE_ENABLED)
+#if UE_TRACE_ENABLED && !UE_BUILD_SHIPPING
+#define TASKGRAPHTRACE_ENABLED 1
+#else
+#define TASKGRAPHTRACE_ENABLED 0
+#endif
+#endif
+
+#if TASKGRAPHTRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(TaskGraphChannel, CORE_API);
+
+/**
+ * Task ids are handed out while the channel is enabled and are never reused, so analysis doesn't have to deal with
+ * recycled task and event memory. Tasks created while the channel was off have id 0 and aren't traced.
+ */
+struct FTaskGraphTrace
+{
+	/** @return A new task id */
+	CORE_API static uint64 NewTaskId();
+
+	/**
+	 * @param CompletesTaskId Non zero for tasks which gather the DontCompleteUntil events of another task, the id of
+	 *                        that task; its completion event fires once this task has run.
+	 * @param ThreadToExecuteOn The ENamedThreads value the task was queued for.
+	 */
+	CORE_API static void Created(uint64 TaskId, uint64 CompletesTaskId, uint32 ThreadToExecuteOn);
+	CORE_API static void Prerequisite(uint64 TaskId, uint64 PrerequisiteTaskId);
+	CORE_API static void Started(uint64 TaskId);
+	CORE_API static void Finished(uint64 TaskId);
+
+	/** The task's completion event fired, which may be after it finished if it used DontCompleteUntil */
+	CORE_API static void Completed(uint64 TaskId);
+
+	/** The calling thread blocks until all of the given tasks complete */
+	CORE_API static void WaitBegin(const uint64* TaskIds, uint32 NumTaskIds);
+	CORE_API static void WaitEnd();
+};
+
+#define TRACE_TASKGRAPH_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(TaskGraphChannel)
+
+#else
+
+#define TRACE_TASKGRAPH_ENABLED() false
+
+#endif // TASKGRAPHTRACE_ENABLED
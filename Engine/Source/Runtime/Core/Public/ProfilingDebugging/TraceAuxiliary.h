@@ -11,4 +11,8 @@ public:
 	static void Initialize(const TCHAR* CommandLine);
 	static void TryAutoConnect();
 	static void EnableChannels();
+
+	/** Writes the trace data held in memory (see -tracetail=<MB>) to a file. A
+	 * timestamped name in the profiling directory is used if Path is null. */
+	static bool WriteSnapshot(const TCHAR* Path=nullptr);
 };
@@ -80,6 +80,8 @@ private:
 	uint8*			TmpDataEnd;
 	/** Pointer to current position in temporary buffer.	*/
 	uint8*			TmpData;
+	/** Number of compression blocks the temporary buffer holds, they are compressed in parallel. */
+	int32			NumParallelBlocks;
 	/** Whether to serialize to temporary buffer of array.	*/
 	bool			bShouldSerializeToArray;
 	/** Number of raw (uncompressed) bytes serialized.		*/
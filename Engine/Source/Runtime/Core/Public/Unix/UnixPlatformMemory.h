@@ -19,7 +19,16 @@
  *	Unix implementation of the FGenericPlatformMemoryStats.
  */
 struct FPlatformMemoryStats : public FGenericPlatformMemoryStats
-{};
+{
+	/** Default constructor, clears all variables. */
+	FPlatformMemoryStats()
+		: FGenericPlatformMemoryStats()
+		, HugePagesUsedPhysical(0)
+	{ }
+
+	/** Physical memory of this process backed by transparent huge pages (AnonHugePages). Only gathered when running with -hugepages. */
+	SIZE_T HugePagesUsedPhysical;
+};
 
 /**
  *	Struct for more detailed stats that are slower to gather. Useful when using ForkAndWait().
@@ -59,6 +59,7 @@
 #include "ProfilingDebugging/CountersTrace.h"
 #include "Async/Async.h"
 #include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
 #include "HAL/LowLevelMemStats.h"
 #include "HAL/IPlatformFileOpenLogWrapper.h"
 
@@ -247,6 +248,21 @@ static FAutoConsoleVariableRef CVar_VerbosePackageNames(
 	ECVF_Default);
 #endif
 
+static int32 GAsyncLoading2_ParallelPostLoad = 0;
+static FAutoConsoleVariableRef CVar_ParallelPostLoad(
+	TEXT("s.ParallelPostLoad"),
+	GAsyncLoading2_ParallelPostLoad,
+	TEXT("Run PostLoad of exports which are thread safe to postload in parallel worker tasks, one task per class and export bundle. ")
+	TEXT("Only safe when PostLoad of those classes doesn't touch other objects still waiting for PostLoad."),
+	ECVF_Default);
+
+static int32 GAsyncLoading2_BatchPostLoadByClass = 0;
+static FAutoConsoleVariableRef CVar_BatchPostLoadByClass(
+	TEXT("s.BatchPostLoadByClass"),
+	GAsyncLoading2_BatchPostLoadByClass,
+	TEXT("Group the game thread PostLoad calls of each export bundle by class instead of running them in export order."),
+	ECVF_Default);
+
 #define UE_ASYNC_PACKAGE_DEBUG(PackageDesc) \
 if (GAsyncLoading2_DebugPackageIds.Contains((PackageDesc).DiskPackageId)) \
 { \
@@ -2029,6 +2045,8 @@ private:
 	TAtomic<int32> RefCount{ 0 };
 	/** Current bundle entry index in the current export bundle */
 	int32						ExportBundleEntryIndex = 0;
+	/** Exports of the current export bundle in the order deferred PostLoad is routed to them, indexed by ExportBundleEntryIndex */
+	TArray<int32>				DeferredPostLoadExportIndices;
 	/** Current index into ExternalReadDependencies array used to spread wating for external reads over several frames			*/
 	int32						ExternalReadIndex = 0;
 	/** Current index into DeferredClusterObjects array used to spread routing CreateClusters over several frames			*/
@@ -4106,6 +4124,60 @@ EAsyncPackageState::Type FAsyncPackage2::Event_ExportsDone(FAsyncLoadingThreadSt
 	return EAsyncPackageState::Complete;
 }
 
+/** Checks if an object that can be postloaded on the async loading thread can also be postloaded concurrently with the rest of its export bundle */
+static bool CanPostLoadInParallel(UObject* Object)
+{
+	if (Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return false;
+	}
+	// Outers and archetypes still waiting for PostLoad would be postloaded from inside the task, racing with their own task
+	for (UObject* Outer = Object->GetOuter(); Outer; Outer = Outer->GetOuter())
+	{
+		if (Outer->HasAnyFlags(RF_NeedPostLoad))
+		{
+			return false;
+		}
+	}
+	UObject* Archetype = Object->GetArchetype();
+	return !Archetype || !Archetype->HasAnyFlags(RF_NeedPostLoad);
+}
+
+/** Routes PostLoad to the objects from worker tasks, one task per class so each task keeps running the same code */
+static void PostLoadInParallel(TArray<UObject*>& Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ParallelPostLoad);
+
+	Algo::StableSortBy(Objects, [](const UObject* Object)
+	{
+		return UPTRINT(Object->GetClass());
+	});
+
+	TArray<int32, TInlineAllocator<16>> ClassRangeStarts;
+	for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+	{
+		if (ObjectIndex == 0 || Objects[ObjectIndex]->GetClass() != Objects[ObjectIndex - 1]->GetClass())
+		{
+			ClassRangeStarts.Add(ObjectIndex);
+		}
+	}
+	ClassRangeStarts.Add(Objects.Num());
+
+	ParallelFor(ClassRangeStarts.Num() - 1, [&Objects, &ClassRangeStarts](int32 RangeIndex)
+	{
+		FUObjectThreadContext& ThreadContext = FUObjectThreadContext::Get();
+		TGuardValue<bool> GuardIsRoutingPostLoad(ThreadContext.IsRoutingPostLoad, true);
+		for (int32 ObjectIndex = ClassRangeStarts[RangeIndex]; ObjectIndex < ClassRangeStarts[RangeIndex + 1]; ++ObjectIndex)
+		{
+			UObject* Object = Objects[ObjectIndex];
+			TRACE_LOADTIME_POSTLOAD_EXPORT_SCOPE(Object);
+			Object->ConditionalPostLoad();
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	Objects.Reset();
+}
+
 EAsyncPackageState::Type FAsyncPackage2::Event_PostLoadExportBundle(FAsyncLoadingThreadState2& ThreadState, FAsyncPackage2* Package, int32 ExportBundleIndex)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(Event_PostLoad);
@@ -4152,6 +4224,8 @@ EAsyncPackageState::Type FAsyncPackage2::Event_PostLoadExportBundle(FAsyncLoadin
 
 		const bool bAsyncPostLoadEnabled = FAsyncLoadingThreadSettings::Get().bAsyncPostLoadEnabled;
 		const bool bIsMultithreaded = Package->AsyncLoadingThread.IsMultithreaded();
+		const bool bParallelPostLoad = bIsMultithreaded && bAsyncPostLoadEnabled && GAsyncLoading2_ParallelPostLoad;
+		TArray<UObject*> ParallelPostLoadObjects;
 
 		const FExportBundleHeader* ExportBundle = Package->Data.ExportBundleHeaders + ExportBundleIndex;
 		const FExportBundleEntry* BundleEntries = Package->Data.ExportBundleEntries + ExportBundle->FirstEntryIndex;
@@ -4187,6 +4261,11 @@ EAsyncPackageState::Type FAsyncPackage2::Event_PostLoadExportBundle(FAsyncLoadin
 					check(Object->IsReadyForAsyncPostLoad());
 					if (!bIsMultithreaded || (bAsyncPostLoadEnabled && CanPostLoadOnAsyncLoadingThread(Object)))
 					{
+						if (bParallelPostLoad && CanPostLoadInParallel(Object))
+						{
+							ParallelPostLoadObjects.Add(Object);
+							break;
+						}
 						ThreadContext.CurrentlyPostLoadedObjectByALT = Object;
 						{
 							TRACE_LOADTIME_POSTLOAD_EXPORT_SCOPE(Object);
@@ -4200,6 +4279,12 @@ EAsyncPackageState::Type FAsyncPackage2::Event_PostLoadExportBundle(FAsyncLoadin
 			++Package->ExportBundleEntryIndex;
 		}
 
+		// Objects gathered before a timeout are postloaded now as well, nothing is kept for the next time slice
+		if (ParallelPostLoadObjects.Num())
+		{
+			PostLoadInParallel(ParallelPostLoadObjects);
+		}
+
 		// End async loading, simulates EndLoad
 		Package->EndAsyncLoad();
 	}
@@ -4256,12 +4341,34 @@ EAsyncPackageState::Type FAsyncPackage2::Event_DeferredPostLoadExportBundle(FAsy
 		TGuardValue<bool> GuardIsRoutingPostLoad(PackageScope.ThreadContext.IsRoutingPostLoad, true);
 		FAsyncLoadingTickScope2 InAsyncLoadingTick(Package->AsyncLoadingThread);
 
-		const FExportBundleHeader* ExportBundle = Package->Data.ExportBundleHeaders + ExportBundleIndex;
-		const FExportBundleEntry* BundleEntries = Package->Data.ExportBundleEntries + ExportBundle->FirstEntryIndex;
-		const FExportBundleEntry* BundleEntry = BundleEntries + Package->ExportBundleEntryIndex;
-		const FExportBundleEntry* BundleEntryEnd = BundleEntries + ExportBundle->EntryCount;
-		check(BundleEntry <= BundleEntryEnd);
-		while (BundleEntry < BundleEntryEnd)
+		if (Package->ExportBundleEntryIndex == 0)
+		{
+			const FExportBundleHeader* ExportBundle = Package->Data.ExportBundleHeaders + ExportBundleIndex;
+			const FExportBundleEntry* BundleEntries = Package->Data.ExportBundleEntries + ExportBundle->FirstEntryIndex;
+			Package->DeferredPostLoadExportIndices.Reset(ExportBundle->EntryCount);
+			for (const FExportBundleEntry* BundleEntry = BundleEntries, *BundleEntryEnd = BundleEntries + ExportBundle->EntryCount; BundleEntry < BundleEntryEnd; ++BundleEntry)
+			{
+				const FExportObject& Export = Package->Data.Exports[BundleEntry->LocalExportIndex];
+				if (BundleEntry->CommandType == FExportBundleEntry::ExportCommandType_Serialize && !(Export.bFiltered | Export.bExportLoadFailed))
+				{
+					check(Export.Object);
+					if (Export.Object->HasAnyFlags(RF_NeedPostLoad))
+					{
+						Package->DeferredPostLoadExportIndices.Add(BundleEntry->LocalExportIndex);
+					}
+				}
+			}
+			if (GAsyncLoading2_BatchPostLoadByClass)
+			{
+				// Runs the PostLoad of each class back to back, the order within a class is kept
+				Algo::StableSortBy(Package->DeferredPostLoadExportIndices, [Package](int32 LocalExportIndex)
+				{
+					return UPTRINT(Package->Data.Exports[LocalExportIndex].Object->GetClass());
+				});
+			}
+		}
+
+		while (Package->ExportBundleEntryIndex < Package->DeferredPostLoadExportIndices.Num())
 		{
 			if (ThreadState.IsTimeLimitExceeded(TEXT("Event_DeferredPostLoadExportBundle")))
 			{
@@ -4269,32 +4376,18 @@ EAsyncPackageState::Type FAsyncPackage2::Event_DeferredPostLoadExportBundle(FAsy
 				break;
 			}
 
-			if (BundleEntry->CommandType == FExportBundleEntry::ExportCommandType_Serialize)
+			UObject* Object = Package->Data.Exports[Package->DeferredPostLoadExportIndices[Package->ExportBundleEntryIndex]].Object;
+			check(!Object->HasAnyFlags(RF_NeedLoad));
+			if (Object->HasAnyFlags(RF_NeedPostLoad))
 			{
-				do
+				PackageScope.ThreadContext.CurrentlyPostLoadedObjectByALT = Object;
 				{
-					FExportObject& Export = Package->Data.Exports[BundleEntry->LocalExportIndex];
-					if (Export.bFiltered | Export.bExportLoadFailed)
-					{
-						break;
-					}
-
-					UObject* Object = Export.Object;
-					check(Object);
-					check(!Object->HasAnyFlags(RF_NeedLoad));
-					if (Object->HasAnyFlags(RF_NeedPostLoad))
-					{
-						PackageScope.ThreadContext.CurrentlyPostLoadedObjectByALT = Object;
-						{
-							TRACE_LOADTIME_POSTLOAD_EXPORT_SCOPE(Object);
-							FScopeCycleCounterUObject ConstructorScope(Object, GET_STATID(STAT_FAsyncPackage_PostLoadObjectsGameThread));
-							Object->ConditionalPostLoad();
-						}
-						PackageScope.ThreadContext.CurrentlyPostLoadedObjectByALT = nullptr;
-					}
-				} while (false);
+					TRACE_LOADTIME_POSTLOAD_EXPORT_SCOPE(Object);
+					FScopeCycleCounterUObject ConstructorScope(Object, GET_STATID(STAT_FAsyncPackage_PostLoadObjectsGameThread));
+					Object->ConditionalPostLoad();
+				}
+				PackageScope.ThreadContext.CurrentlyPostLoadedObjectByALT = nullptr;
 			}
-			++BundleEntry;
 			++Package->ExportBundleEntryIndex;
 		}
 	}
@@ -4305,6 +4398,7 @@ EAsyncPackageState::Type FAsyncPackage2::Event_DeferredPostLoadExportBundle(FAsy
 	}
 
 	Package->ExportBundleEntryIndex = 0;
+	Package->DeferredPostLoadExportIndices.Reset();
 
 	if (ExportBundleIndex + 1 < Package->Data.ExportBundleCount)
 	{
@@ -13,6 +13,7 @@
 #include "Misc/OutputDeviceHelper.h"
 #include "Misc/FeedbackContext.h"
 #include "Misc/OutputDeviceConsole.h"
+#include "Misc/App.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/EnumClassFlags.h"
 #include "Misc/StringBuilder.h"
@@ -53,6 +54,7 @@
 #include "UObject/PropertyProxyArchive.h"
 #include "UObject/FieldPath.h"
 #include "HAL/ThreadSafeCounter.h"
+#include "Async/ParallelFor.h"
 
 
 // WARNING: This should always be the last include in any file that needs it (except .generated.h)
@@ -4106,6 +4108,33 @@ void UClass::Link(FArchive& Ar, bool bRelinkExistingProperties)
 {
 	check(!bRelinkExistingProperties || !(ClassFlags & CLASS_Intrinsic));
 	Super::Link(Ar, bRelinkExistingProperties);
+
+	// Non-native properties are laid out after the last native super class. If none of them needs construction, destruction
+	// or instancing, new objects can take the whole block from the CDO with a single memcpy in FObjectInitializer::InitProperties.
+	TrivialNonNativePropertiesOffset = INDEX_NONE;
+	if (!HasAnyClassFlags(CLASS_Native | CLASS_Intrinsic))
+	{
+		UClass* NativeSuperClass = GetSuperClass();
+		while (NativeSuperClass && !NativeSuperClass->HasAnyClassFlags(CLASS_Native | CLASS_Intrinsic))
+		{
+			NativeSuperClass = NativeSuperClass->GetSuperClass();
+		}
+
+		bool bAllTrivial = NativeSuperClass != nullptr;
+		for (FProperty* Property = PropertyLink; Property && bAllTrivial; Property = Property->PropertyLinkNext)
+		{
+			UClass* OwnerClass = Property->GetOwnerClass();
+			if (OwnerClass && !OwnerClass->HasAnyClassFlags(CLASS_Native | CLASS_Intrinsic))
+			{
+				bAllTrivial = Property->HasAnyPropertyFlags(CPF_IsPlainOldData) && !Property->ContainsInstancedObjectProperty() && Property->GetOffset_ForInternal() >= NativeSuperClass->GetPropertiesSize();
+			}
+		}
+
+		if (bAllTrivial)
+		{
+			TrivialNonNativePropertiesOffset = NativeSuperClass->GetPropertiesSize();
+		}
+	}
 }
 
 #if (UE_BUILD_SHIPPING)
@@ -5272,10 +5301,15 @@ void UClass::CreateLinkAndAddChildFunctionsToMap(const FClassFunctionLinkInfo* F
 	}
 }
 
+extern FThreadSafeCounter GScriptVirtualCallCacheEpoch;
+
 void UClass::ClearFunctionMapsCaches()
 {
 	FRWScopeLock ScopeLock(SuperFuncMapLock, FRWScopeLockType::SLT_Write);
 	SuperFuncMap.Empty();
+
+	// Script call sites may have cached functions found through this class
+	GScriptVirtualCallCacheEpoch.Increment();
 }
 
 UFunction* UClass::FindFunctionByName(FName InName, EIncludeSuperFlag::Type IncludeSuper) const
@@ -5322,9 +5356,62 @@ UFunction* UClass::FindFunctionByName(FName InName, EIncludeSuperFlag::Type Incl
 	return Result;
 }
 
+static int32 GParallelAssembleReferenceTokenStreams = 1;
+static FAutoConsoleVariableRef CVarParallelAssembleReferenceTokenStreams(
+	TEXT("gc.ParallelAssembleReferenceTokenStreams"),
+	GParallelAssembleReferenceTokenStreams,
+	TEXT("If enabled, the reference token streams of newly registered classes are assembled on worker threads, one level of the class hierarchy at a time."),
+	ECVF_Default
+);
+
+/** Assembles the token streams of the given classes, parents before their children, each level of the hierarchy in parallel */
+static void AssembleReferenceTokenStreamsInParallel(TArray<UClass*>& Classes)
+{
+	// Native classes don't lock their token stream, so two children must never assemble the same super at once.
+	// Gather unassembled supers as well so that every super is assembled in an earlier pass than its children.
+	TSet<UClass*> GatheredClasses(Classes);
+	for (int32 ClassIndex = 0; ClassIndex < Classes.Num(); ++ClassIndex)
+	{
+		UClass* SuperClass = Classes[ClassIndex]->GetSuperClass();
+		if (SuperClass && !SuperClass->HasAnyClassFlags(CLASS_TokenStreamAssembled) && !GatheredClasses.Contains(SuperClass))
+		{
+			GatheredClasses.Add(SuperClass);
+			Classes.Add(SuperClass);
+		}
+	}
+
+	TArray<TArray<UClass*>> ClassesByDepth;
+	for (UClass* Class : Classes)
+	{
+		int32 Depth = 0;
+		for (UClass* SuperClass = Class->GetSuperClass(); SuperClass; SuperClass = SuperClass->GetSuperClass())
+		{
+			++Depth;
+		}
+		if (ClassesByDepth.Num() <= Depth)
+		{
+			ClassesByDepth.SetNum(Depth + 1);
+		}
+		ClassesByDepth[Depth].Add(Class);
+	}
+
+	// Token streams may only be assembled off the game thread while GC is locked
+	FGCScopeGuard GCGuard;
+	for (const TArray<UClass*>& ClassesAtDepth : ClassesByDepth)
+	{
+		ParallelFor(ClassesAtDepth.Num(), [&ClassesAtDepth](int32 ClassIndex)
+		{
+			ClassesAtDepth[ClassIndex]->AssembleReferenceTokenStream();
+		}, ClassesAtDepth.Num() < 16);
+	}
+}
+
 void UClass::AssembleReferenceTokenStreams()
 {
 	SCOPED_BOOT_TIMING("AssembleReferenceTokenStreams (can be optimized)");
+	const bool bAssembleInParallel = GParallelAssembleReferenceTokenStreams && IsInGameThread() && !IsGarbageCollecting() && FApp::ShouldUseThreadingForPerformance();
+	TArray<UClass*> ClassesToAssemble;
+
 	// Iterate over all class objects and force the default objects to be created. Additionally also
 	// assembles the token reference stream at this point. This is required for class objects that are
 	// not taken into account for garbage collection but have instances that are.
@@ -5344,10 +5431,22 @@ void UClass::AssembleReferenceTokenStreams()
 			// Assemble reference token stream for garbage collection/ RTGC.
 			if (!Class->HasAnyFlags(RF_ClassDefaultObject) && !Class->HasAnyClassFlags(CLASS_TokenStreamAssembled))
 			{
-				Class->AssembleReferenceTokenStream();
+				if (bAssembleInParallel)
+				{
+					ClassesToAssemble.Add(Class);
+				}
+				else
+				{
+					Class->AssembleReferenceTokenStream();
+				}
 			}
 		}
 	}
+
+	if (ClassesToAssemble.Num())
+	{
+		AssembleReferenceTokenStreamsInParallel(ClassesToAssemble);
+	}
 }
 
 const FString UClass::GetConfigName() const
@@ -187,6 +187,25 @@ static FAutoConsoleVariableRef CMultithreadedDestructionEnabled(
 	ECVF_Default
 );
 
+int32 GParallelDestroyEnabled = 0;
+static FAutoConsoleVariableRef CParallelDestroyEnabled(
+	TEXT("gc.ParallelDestroyEnabled"),
+	GParallelDestroyEnabled,
+	TEXT("If true, BeginDestroy and FinishDestroy are routed to unreachable objects that report them as thread safe from worker threads"),
+	ECVF_Default
+);
+
+int32 GParallelDestroyBatchSize = 1024;
+static FAutoConsoleVariableRef CParallelDestroyBatchSize(
+	TEXT("gc.ParallelDestroyBatchSize"),
+	GParallelDestroyBatchSize,
+	TEXT("Number of unreachable objects routed per batch with gc.ParallelDestroyEnabled. The incremental purge time limit is checked between batches."),
+	ECVF_Default
+);
+
+/** True while BeginDestroy or FinishDestroy is being routed from worker threads, so the game thread takes the UObject hash lock too */
+bool GObjParallelDestroyIsInProgress = false;
+
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 /** Map from a UClass' FName to the number of objects that were purged during the last purge phase of this class.	*/
 static TMap<const FName,uint32> GClassToPurgeCountMap;
@@ -1343,12 +1362,14 @@ public:
 		}
 
 		{
+			CSV_SCOPED_TIMING_STAT_EXCLUSIVE(GarbageCollectionMarkObjects);
 			const double StartTime = FPlatformTime::Seconds();
 			(this->*MarkObjectsFunctions[GetGCFunctionIndex(!bForceSingleThreaded, bWithClusters)])(ObjectsToSerialize, KeepFlags);
 			UE_LOG(LogGarbage, Verbose, TEXT("%f ms for MarkObjectsAsUnreachable Phase (%d Objects To Serialize)"), (FPlatformTime::Seconds() - StartTime) * 1000, ObjectsToSerialize.Num());
 		}
 
 		{
+			CSV_SCOPED_TIMING_STAT_EXCLUSIVE(GarbageCollectionReachability);
 			const double StartTime = FPlatformTime::Seconds();
 			PerformReachabilityAnalysisOnObjects(ArrayStruct, bForceSingleThreaded, bWithClusters);
 			UE_LOG(LogGarbage, Verbose, TEXT("%f ms for Reachability Analysis"), (FPlatformTime::Seconds() - StartTime) * 1000);
@@ -1394,6 +1415,29 @@ static bool ShouldForceSingleThreadedGC()
 	return bForceSingleThreadedGC;
 }
 
+/** Returns true if BeginDestroy and FinishDestroy of thread safe objects should be routed from worker threads */
+static bool ShouldRouteDestroyInParallel()
+{
+#if THREADSAFE_UOBJECTS && !PROFILE_GCConditionalBeginDestroy
+	return GParallelDestroyEnabled && !ShouldForceSingleThreadedGC();
+#else
+	return false;
+#endif
+}
+
+/** Calls Route for all Objects from worker threads. The game thread doesn't touch any UObjects while this is in progress. */
+static void RouteDestroyInParallel(const TArray<UObject*>& Objects, TFunctionRef<void(UObject*)> Route)
+{
+	if (Objects.Num() > 0)
+	{
+		TGuardValue<bool> GuardObjParallelDestroyIsInProgress(GObjParallelDestroyIsInProgress, true);
+		ParallelFor(Objects.Num(), [&Objects, &Route](int32 ObjectIndex)
+		{
+			Route(Objects[ObjectIndex]);
+		});
+	}
+}
+
 void AcquireGCLock()
 {
 	const double StartTime = FPlatformTime::Seconds();
@@ -1515,6 +1559,55 @@ void IncrementalPurgeGarbage(bool bUseTimeLimit, float TimeLimit)
 }
 
 #if UE_WITH_GC
+/**
+ * Routes FinishDestroy to unreachable objects in batches of gc.ParallelDestroyBatchSize objects. Objects that aren't thread
+ * safe are destroyed on the game thread first, then the rest of the batch is destroyed from worker threads.
+ *
+ * @return true if the time limit has been reached
+ */
+static bool FinishDestroyUnreachableObjectsInParallel(bool bUseTimeLimit, float TimeLimit)
+{
+	TArray<UObject*> ThreadSafeObjects;
+	while (GObjCurrentPurgeObjectIndex < GUnreachableObjects.Num())
+	{
+		const int32 BatchEnd = FMath::Min(GObjCurrentPurgeObjectIndex + FMath::Max(GParallelDestroyBatchSize, 1), GUnreachableObjects.Num());
+		ThreadSafeObjects.Reset();
+		for (; GObjCurrentPurgeObjectIndex < BatchEnd; ++GObjCurrentPurgeObjectIndex)
+		{
+			FUObjectItem* ObjectItem = GUnreachableObjects[GObjCurrentPurgeObjectIndex];
+			check(ObjectItem->IsUnreachable());
+
+			UObject* Object = static_cast<UObject*>(ObjectItem->Object);
+			check(Object->HasAnyFlags(RF_BeginDestroyed) && !Object->HasAnyFlags(RF_FinishDestroyed));
+
+			if (!Object->IsReadyForFinishDestroy())
+			{
+				GGCObjectsPendingDestruction.Add(Object);
+				GGCObjectsPendingDestructionCount++;
+			}
+			else if (Object->IsFinishDestroyThreadSafe())
+			{
+				ThreadSafeObjects.Add(Object);
+			}
+			else
+			{
+				Object->ConditionalFinishDestroy();
+			}
+		}
+
+		RouteDestroyInParallel(ThreadSafeObjects, [](UObject* Object)
+		{
+			Object->ConditionalFinishDestroy();
+		});
+
+		if (bUseTimeLimit && (FPlatformTime::Seconds() - GCStartTime) > TimeLimit)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 bool IncrementalDestroyGarbage(bool bUseTimeLimit, float TimeLimit)
 {
 	const bool bMultithreadedPurge = !ShouldForceSingleThreadedGC() && GMultithreadedDestructionEnabled;
@@ -1560,7 +1653,12 @@ bool IncrementalDestroyGarbage(bool bUseTimeLimit, float TimeLimit)
 			GObjCurrentPurgeObjectIndexNeedsReset = false;
 		}
 
-		while (GObjCurrentPurgeObjectIndex < GUnreachableObjects.Num())
+		if (ShouldRouteDestroyInParallel())
+		{
+			bTimeLimitReached = FinishDestroyUnreachableObjectsInParallel(bUseTimeLimit, TimeLimit);
+		}
+
+		while (!bTimeLimitReached && GObjCurrentPurgeObjectIndex < GUnreachableObjects.Num())
 		{
 			FUObjectItem* ObjectItem = GUnreachableObjects[GObjCurrentPurgeObjectIndex];
 			checkSlow(ObjectItem);
@@ -1853,6 +1951,7 @@ static FAutoConsoleVariableRef CVarFlushStreamingOnGC(
 void GatherUnreachableObjects(bool bForceSingleThreaded)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CollectGarbageInternal.GatherUnreachableObjects"), STAT_CollectGarbageInternal_GatherUnreachableObjects, STATGROUP_GC);
+	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(GarbageCollectionGatherUnreachable);
 
 	const double StartTime = FPlatformTime::Seconds();
 
@@ -1992,7 +2091,10 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 		// This has to be unlocked before we call post GC callbacks
 		FGCScopeLock GCLock;
 
-		UE_LOG(LogGarbage, Log, TEXT("Collecting garbage%s"), IsAsyncLoading() ? TEXT(" while async loading") : TEXT(""));
+		// Objects allocated between collections are where a generational collector would look first, so keep track of how many there are
+		const int32 ObjectsAllocatedSinceLastGC = GUObjectArray.ResetObjectsAllocatedSinceLastGC();
+		CSV_CUSTOM_STAT_GLOBAL(GCObjectsAllocatedSinceLastGC, ObjectsAllocatedSinceLastGC, ECsvCustomStatOp::Set);
+		UE_LOG(LogGarbage, Log, TEXT("Collecting garbage%s (%d objects allocated since the last collection)"), IsAsyncLoading() ? TEXT(" while async loading") : TEXT(""), ObjectsAllocatedSinceLastGC);
 
 		// Make sure previous incremental purge has finished or we do a full purge pass in case we haven't kicked one
 		// off yet since the last call to garbage collection.
@@ -2095,6 +2197,47 @@ bool IsIncrementalUnhashPending()
 	return GUnrechableObjectIndex < GUnreachableObjects.Num();
 }
 
+/**
+ * Routes BeginDestroy to unreachable objects in batches of gc.ParallelDestroyBatchSize objects. Objects that aren't thread
+ * safe begin destroying on the game thread first, then the rest of the batch is routed from worker threads.
+ *
+ * @return number of objects routed
+ */
+static int32 UnhashUnreachableObjectsInParallel(bool bUseTimeLimit, float TimeLimit, double StartTime)
+{
+	int32 Items = 0;
+	TArray<UObject*> ThreadSafeObjects;
+	while (GUnrechableObjectIndex < GUnreachableObjects.Num())
+	{
+		const int32 BatchEnd = FMath::Min(GUnrechableObjectIndex + FMath::Max(GParallelDestroyBatchSize, 1), GUnreachableObjects.Num());
+		Items += BatchEnd - GUnrechableObjectIndex;
+		ThreadSafeObjects.Reset();
+		for (; GUnrechableObjectIndex < BatchEnd; ++GUnrechableObjectIndex)
+		{
+			UObject* Object = static_cast<UObject*>(GUnreachableObjects[GUnrechableObjectIndex]->Object);
+			if (Object->IsBeginDestroyThreadSafe())
+			{
+				ThreadSafeObjects.Add(Object);
+			}
+			else
+			{
+				Object->ConditionalBeginDestroy();
+			}
+		}
+
+		RouteDestroyInParallel(ThreadSafeObjects, [](UObject* Object)
+		{
+			Object->ConditionalBeginDestroy();
+		});
+
+		if (bUseTimeLimit && (FPlatformTime::Seconds() - StartTime) > TimeLimit)
+		{
+			break;
+		}
+	}
+	return Items;
+}
+
 bool UnhashUnreachableObjects(bool bUseTimeLimit, float TimeLimit)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UnhashUnreachableObjects"), STAT_UnhashUnreachableObjects, STATGROUP_GC);
@@ -2110,24 +2253,31 @@ bool UnhashUnreachableObjects(bool bUseTimeLimit, float TimeLimit)
 	int32 TimePollCounter = 0;
 	const bool bFirstIteration = (GUnrechableObjectIndex == 0);
 
-	while (GUnrechableObjectIndex < GUnreachableObjects.Num())
+	if (ShouldRouteDestroyInParallel())
 	{
-		//@todo UE4 - A prefetch was removed here. Re-add it. It wasn't right anyway, since it was ten items ahead and the consoles on have 8 prefetch slots
-
-		FUObjectItem* ObjectItem = GUnreachableObjects[GUnrechableObjectIndex++];
+		Items = UnhashUnreachableObjectsInParallel(bUseTimeLimit, TimeLimit, StartTime);
+	}
+	else
+	{
+		while (GUnrechableObjectIndex < GUnreachableObjects.Num())
 		{
-			UObject* Object = static_cast<UObject*>(ObjectItem->Object);
-			FScopedCBDProfile Profile(Object);
-			// Begin the object's asynchronous destruction.
-			Object->ConditionalBeginDestroy();
-		}
+			//@todo UE4 - A prefetch was removed here. Re-add it. It wasn't right anyway, since it was ten items ahead and the consoles on have 8 prefetch slots
 
-		Items++;
+			FUObjectItem* ObjectItem = GUnreachableObjects[GUnrechableObjectIndex++];
+			{
+				UObject* Object = static_cast<UObject*>(ObjectItem->Object);
+				FScopedCBDProfile Profile(Object);
+				// Begin the object's asynchronous destruction.
+				Object->ConditionalBeginDestroy();
+			}
 
-		const bool bPollTimeLimit = ((TimePollCounter++) % TimeLimitEnforcementGranularityForBeginDestroy == 0);
-		if (bUseTimeLimit && bPollTimeLimit && ((FPlatformTime::Seconds() - StartTime) > TimeLimit))
-		{
-			break;
+			Items++;
+
+			const bool bPollTimeLimit = ((TimePollCounter++) % TimeLimitEnforcementGranularityForBeginDestroy == 0);
+			if (bUseTimeLimit && bPollTimeLimit && ((FPlatformTime::Seconds() - StartTime) > TimeLimit))
+			{
+				break;
+			}
 		}
 	}
 
@@ -2235,6 +2385,16 @@ bool UObject::IsDestructionThreadSafe() const
 	return false;
 }
 
+bool UObject::IsBeginDestroyThreadSafe() const
+{
+	return false;
+}
+
+bool UObject::IsFinishDestroyThreadSafe() const
+{
+	return false;
+}
+
 /*-----------------------------------------------------------------------------
 	Implementation of realtime garbage collection helper functions in 
 	FProperty, UClass, ...
@@ -70,10 +70,10 @@ DEFINE_LOG_CATEGORY(LogObj);
 static UPackage*			GObjTransientPkg								= NULL;		
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	/** Used to verify that the Super::BeginDestroyed chain is intact.			*/
-	static TArray<UObject*,TInlineAllocator<16> >		DebugBeginDestroyed;
-	/** Used to verify that the Super::FinishDestroyed chain is intact.			*/
-	static TArray<UObject*,TInlineAllocator<16> >		DebugFinishDestroyed;
+	/** Used to verify that the Super::BeginDestroyed chain is intact. Per thread as gc.ParallelDestroyEnabled routes BeginDestroy from workers. */
+	static thread_local TArray<UObject*,TInlineAllocator<16> >		DebugBeginDestroyed;
+	/** Used to verify that the Super::FinishDestroyed chain is intact. Per thread as gc.ParallelDestroyEnabled routes FinishDestroy from workers. */
+	static thread_local TArray<UObject*,TInlineAllocator<16> >		DebugFinishDestroyed;
 #endif
 
 #if !UE_BUILD_SHIPPING
@@ -85,6 +85,7 @@ static UPackage*			GObjTransientPkg								= NULL;
 	/** Used for the "obj spikemark" and "obj spikemarkcheck" commands only			*/
 	static FUObjectAnnotationSparseBool DebugSpikeMarkAnnotation;
 	static TArray<FString>			DebugSpikeMarkNames;
+	static FCriticalSection			DebugSpikeMarkNamesCritical;
 #endif
 
 #if WITH_EDITOR
@@ -949,6 +950,7 @@ bool UObject::ConditionalBeginDestroy()
 	{
 		if(!DebugSpikeMarkAnnotation.Get(this))
 		{
+			FScopeLock DebugSpikeMarkNamesLock(&DebugSpikeMarkNamesCritical);
 			DebugSpikeMarkNames.Add(GetFullName());
 		}
 	}
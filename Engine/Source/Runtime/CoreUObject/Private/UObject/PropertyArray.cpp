@@ -110,6 +110,77 @@ static bool CanBulkSerialize(FProperty* Property)
 	return false;
 }
 
+namespace UE4PropertyArray_Private
+{
+	/** Contiguous run of bulk serializable memory inside an array element. */
+	struct FBulkSerializeRange
+	{
+		int32 Offset;
+		int32 Size;
+	};
+	typedef TArray<FBulkSerializeRange, TInlineAllocator<8>> FBulkSerializeLayout;
+
+	/**
+	 * Gathers the memory ranges of a struct made only of numeric properties, in property link order.
+	 * Adjacent properties are merged into one range. Returns false if the struct can't be bulk serialized.
+	 */
+	static bool GatherBulkSerializeLayout(FArchive& Ar, const UScriptStruct* Struct, int32 BaseOffset, FBulkSerializeLayout& OutLayout)
+	{
+		if (Struct->StructFlags & (STRUCT_SerializeNative | STRUCT_PostSerializeNative))
+		{
+			return false;
+		}
+
+		for (FProperty* Property = Struct->PropertyLink; Property; Property = Property->PropertyLinkNext)
+		{
+			if (!Property->ShouldSerializeValue(Ar))
+			{
+				return false;
+			}
+
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				const int32 Offset = BaseOffset + Property->GetOffset_ForInternal() + ArrayIndex * Property->ElementSize;
+				if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+				{
+					if (!GatherBulkSerializeLayout(Ar, StructProperty->Struct, Offset, OutLayout))
+					{
+						return false;
+					}
+				}
+				else if (CanBulkSerialize(Property))
+				{
+					if (OutLayout.Num() && OutLayout.Last().Offset + OutLayout.Last().Size == Offset)
+					{
+						OutLayout.Last().Size += Property->ElementSize;
+					}
+					else
+					{
+						OutLayout.Add({ Offset, Property->ElementSize });
+					}
+				}
+				else
+				{
+					return false;
+				}
+			}
+		}
+
+		return OutLayout.Num() > 0;
+	}
+
+	static bool CanBulkSerializeStruct(FArchive& Ar, FProperty* Property, FBulkSerializeLayout& OutLayout)
+	{
+#if PLATFORM_LITTLE_ENDIAN
+		if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return GatherBulkSerializeLayout(Ar, StructProperty->Struct, 0, OutLayout);
+		}
+#endif
+		return false;
+	}
+}
+
 void FArrayProperty::SerializeItem(FStructuredArchive::FSlot Slot, void* Value, void const* Defaults) const
 {
 	check(Inner);
@@ -130,6 +201,7 @@ void FArrayProperty::SerializeItem(FStructuredArchive::FSlot Slot, void* Value,
 		checkf(!UnderlyingArchive.ArUseCustomPropertyList, TEXT("Custom property lists are not supported with UPS"));
 		checkf(!bIsTextFormat, TEXT("Text-based archives are not supported with UPS"));
 
+		UE4PropertyArray_Private::FBulkSerializeLayout StructLayout;
 		if (CanBulkSerialize(Inner))
 		{
 			// We need to enter the slot as *something* to keep the structured archive system happy,
@@ -145,6 +217,45 @@ void FArrayProperty::SerializeItem(FStructuredArchive::FSlot Slot, void* Value,
 
 			Stream.EnterElement().Serialize(ArrayHelper.GetRawPtr(), n * Inner->ElementSize);
 		}
+		else if (UE4PropertyArray_Private::CanBulkSerializeStruct(UnderlyingArchive, Inner, StructLayout))
+		{
+			// Structs made only of numeric properties are stored packed, one range after the other in property order.
+			// UPS already requires the runtime schema to match the cooked one, so this is layout independent and
+			// elements whose memory is a single range covering the whole struct are copied in one go.
+			FStructuredArchiveStream Stream = Slot.EnterStream();
+
+			Stream.EnterElement() << n;
+
+			const bool bIsContiguous = StructLayout.Num() == 1 && StructLayout[0].Offset == 0 && StructLayout[0].Size == Inner->ElementSize;
+			if (UnderlyingArchive.IsLoading())
+			{
+				if (bIsContiguous)
+				{
+					ArrayHelper.EmptyAndAddUninitializedValues(n);
+				}
+				else
+				{
+					ArrayHelper.EmptyAndAddValues(n);
+				}
+			}
+
+			FArchive& ElementsArchive = Stream.EnterElement().GetUnderlyingArchive();
+			if (bIsContiguous)
+			{
+				ElementsArchive.Serialize(ArrayHelper.GetRawPtr(), n * Inner->ElementSize);
+			}
+			else
+			{
+				for (int32 i = 0; i < n; ++i)
+				{
+					uint8* Element = ArrayHelper.GetRawPtr(i);
+					for (const UE4PropertyArray_Private::FBulkSerializeRange& Range : StructLayout)
+					{
+						ElementsArchive.Serialize(Element + Range.Offset, Range.Size);
+					}
+				}
+			}
+		}
 		else
 		{
 			FStructuredArchiveArray Array = Slot.EnterArray(n);
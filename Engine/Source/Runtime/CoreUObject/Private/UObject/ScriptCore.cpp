@@ -30,6 +30,7 @@
 #include "Misc/HotReloadInterface.h"
 #include "UObject/UObjectThreadContext.h"
 #include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter.h"
 
 DEFINE_LOG_CATEGORY(LogScriptFrame);
 DEFINE_LOG_CATEGORY_STATIC(LogScriptCore, Log, All);
@@ -67,6 +68,18 @@ static FAutoConsoleVariableRef CVarScriptRecurseLimit(
 	ECVF_Default
 );
 
+static int32 GScriptVirtualCallCache = 1;
+static FAutoConsoleVariableRef CVarScriptVirtualCallCache(
+	TEXT("bp.VirtualCallCache"),
+	GScriptVirtualCallCache,
+	TEXT("Whether virtual script calls on the game thread remember the function each call site resolved to for each class, instead of looking it up by name on every call.\n")
+	TEXT("Not used in the editor, where Blueprints are recompiled in place.\n"),
+	ECVF_Default
+);
+
+/** Bumped when cached functions may be stale: after GC, and when a class clears its function caches */
+FThreadSafeCounter GScriptVirtualCallCacheEpoch;
+
 #if PER_FUNCTION_SCRIPT_STATS
 static int32 GMaxFunctionStatDepth = -1;
 static FAutoConsoleVariableRef CVarMaxFunctionStatDepth(
@@ -2995,10 +3008,69 @@ DEFINE_FUNCTION(UObject::execStructMemberContext)
 }
 IMPLEMENT_VM_FUNCTION( EX_StructMemberContext, execStructMemberContext );
 
+namespace ScriptVirtualCallCache
+{
+	struct FEntry
+	{
+		const uint8* CallSite = nullptr;
+		const UClass* Class = nullptr;
+		UFunction* Function = nullptr;
+	};
+
+	/** Direct mapped on call site and class, so call sites seeing several classes get an entry for each */
+	static constexpr uint32 NumEntries = 1024;
+	static FEntry Entries[NumEntries];
+	static int32 Epoch = 0;
+
+	static void Invalidate()
+	{
+		GScriptVirtualCallCacheEpoch.Increment();
+	}
+
+	/** Reads the function name at the code pointer, and finds the function it resolves to for Object */
+	static UFunction* FindFunction(UObject* Object, FFrame& Stack)
+	{
+		if (!GScriptVirtualCallCache || GIsEditor || !IsInGameThread())
+		{
+			return Object->FindFunctionChecked(Stack.ReadName());
+		}
+
+		static bool bRegisteredGCCallback = false;
+		if (!bRegisteredGCCallback)
+		{
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&Invalidate);
+			bRegisteredGCCallback = true;
+		}
+
+		const int32 CurrentEpoch = GScriptVirtualCallCacheEpoch.GetValue();
+		if (Epoch != CurrentEpoch)
+		{
+			FMemory::Memzero(Entries);
+			Epoch = CurrentEpoch;
+		}
+
+		const uint8* CallSite = Stack.Code;
+		const UClass* Class = Object->GetClass();
+
+		FEntry& Entry = Entries[PointerHash(CallSite, PointerHash(Class)) & (NumEntries - 1)];
+		if (Entry.CallSite == CallSite && Entry.Class == Class)
+		{
+			Stack.Code += sizeof(FScriptName);
+			return Entry.Function;
+		}
+
+		UFunction* Function = Object->FindFunctionChecked(Stack.ReadName());
+		Entry.CallSite = CallSite;
+		Entry.Class = Class;
+		Entry.Function = Function;
+		return Function;
+	}
+}
+
 DEFINE_FUNCTION(UObject::execVirtualFunction)
 {
 	// Call the virtual function.
-	P_THIS->CallFunction( Stack, RESULT_PARAM, P_THIS->FindFunctionChecked(Stack.ReadName()) );
+	P_THIS->CallFunction( Stack, RESULT_PARAM, ScriptVirtualCallCache::FindFunction(P_THIS, Stack) );
 }
 IMPLEMENT_VM_FUNCTION( EX_VirtualFunction, execVirtualFunction );
 
@@ -3012,7 +3084,7 @@ IMPLEMENT_VM_FUNCTION( EX_FinalFunction, execFinalFunction );
 DEFINE_FUNCTION(UObject::execLocalVirtualFunction)
 {
 	// Call the virtual function.
-	ProcessLocalFunction(Context, P_THIS->FindFunctionChecked(Stack.ReadName()), Stack, RESULT_PARAM);
+	ProcessLocalFunction(Context, ScriptVirtualCallCache::FindFunction(P_THIS, Stack), Stack, RESULT_PARAM);
 }
 IMPLEMENT_VM_FUNCTION( EX_LocalVirtualFunction, execLocalVirtualFunction );
 
@@ -6,12 +6,146 @@
 
 #include "UObject/UObjectAllocator.h"
 #include "UObject/UObjectGlobals.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUObjectAllocator, Log, All);
 
 /** Global UObjectBase allocator							*/
 COREUOBJECT_API FUObjectAllocator GUObjectAllocator;
 
+/** Number of allocations of a class before its objects are placed in a class pool */
+static int32 GUObjectClassPoolThreshold = 64;
+static FAutoConsoleVariableRef CVarUObjectClassPoolThreshold(
+	TEXT("gc.ClassObjectPoolThreshold"),
+	GUObjectClassPoolThreshold,
+	TEXT("Number of objects of a class that have to be allocated before new objects of that class are placed in a class pool (requires gc.SizeOfClassObjectPoolsMB)."),
+	ECVF_Default
+);
+
+/**
+ * Per class slab pools. Address space is reserved up front and committed one slab at a time. Every slab belongs to a single
+ * class for the lifetime of the pools so freed objects are only ever reused by objects of the same class.
+ */
+class FUObjectClassPools
+{
+public:
+
+	explicit FUObjectClassPools(SIZE_T InSize)
+		: SlabSize(FMath::Max<SIZE_T>(64 * 1024, FPlatformMemory::FPlatformVirtualMemoryBlock::GetCommitAlignment()))
+		, NumCommittedSlabs(0)
+	{
+		const SIZE_T ReserveSize = Align(Align(InSize, SlabSize), FPlatformMemory::FPlatformVirtualMemoryBlock::GetVirtualSizeAlignment());
+		VirtualBlock = FPlatformMemory::FPlatformVirtualMemoryBlock::AllocateVirtual(ReserveSize);
+		SlabOwners.AddZeroed(int32(VirtualBlock.GetActualSize() / SlabSize));
+	}
+
+	uint8* GetBegin() const
+	{
+		return (uint8*)VirtualBlock.GetVirtualPointer();
+	}
+
+	uint8* GetEnd() const
+	{
+		return GetBegin() + SlabOwners.Num() * SlabSize;
+	}
+
+	/**
+	 * Allocates an object from the pool of its class.
+	 *
+	 * @param Class class of the object
+	 * @param AlignedSize size of the object, already aligned to 16 bytes
+	 * @return memory for the object or null if the class is not pooled (yet) or the pools are exhausted
+	 */
+	void* Allocate(const UClass* Class, int32 AlignedSize)
+	{
+		if (SIZE_T(AlignedSize) > SlabSize / 8)
+		{
+			return nullptr;
+		}
+
+		FScopeLock Lock(&CriticalSection);
+
+		FClassPool*& Pool = Pools.FindOrAdd(Class);
+		if (!Pool)
+		{
+			Pool = new FClassPool();
+			Pool->ObjectSize = AlignedSize;
+		}
+		// Blueprint classes may be relinked with a different layout under the same pointer
+		if (Pool->ObjectSize != AlignedSize || ++Pool->NumAllocations <= GUObjectClassPoolThreshold)
+		{
+			return nullptr;
+		}
+
+		if (Pool->FreeList)
+		{
+			void* Result = Pool->FreeList;
+			Pool->FreeList = *(void**)Result;
+			return Result;
+		}
+
+		if (Pool->Cursor + AlignedSize > Pool->CursorEnd)
+		{
+			if (NumCommittedSlabs == SlabOwners.Num())
+			{
+				return nullptr;
+			}
+			const SIZE_T SlabOffset = NumCommittedSlabs * SlabSize;
+			VirtualBlock.Commit(SlabOffset, SlabSize);
+			SlabOwners[NumCommittedSlabs++] = Pool;
+			Pool->Cursor = GetBegin() + SlabOffset;
+			Pool->CursorEnd = Pool->Cursor + SlabSize;
+		}
+
+		void* Result = Pool->Cursor;
+		Pool->Cursor += AlignedSize;
+		return Result;
+	}
+
+	/** Returns an object to the pool of the slab it was allocated from */
+	void Free(void* Object)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		FClassPool* Pool = SlabOwners[int32(((uint8*)Object - GetBegin()) / SlabSize)];
+		check(Pool);
+		*(void**)Object = Pool->FreeList;
+		Pool->FreeList = Object;
+	}
+
+	/** Returns the number of bytes committed for class pools */
+	SIZE_T GetCommittedSize() const
+	{
+		return NumCommittedSlabs * SlabSize;
+	}
+
+private:
+
+	struct FClassPool
+	{
+		/** Aligned size of the objects in this pool */
+		int32 ObjectSize = 0;
+		/** Number of objects of this class allocated so far, the class is pooled once this exceeds the threshold */
+		int32 NumAllocations = 0;
+		/** Singly linked list of freed objects */
+		void* FreeList = nullptr;
+		/** Next free byte in the current slab */
+		uint8* Cursor = nullptr;
+		/** End of the current slab */
+		uint8* CursorEnd = nullptr;
+	};
+
+	const SIZE_T SlabSize;
+	FCriticalSection CriticalSection;
+	FPlatformMemory::FPlatformVirtualMemoryBlock VirtualBlock;
+	TMap<const UClass*, FClassPool*> Pools;
+	/** Owning class pool of every slab in the reserved address space */
+	TArray<FClassPool*> SlabOwners;
+	int32 NumCommittedSlabs;
+};
+
 /**
  * Allocates and initializes the permanent object pool
  *
@@ -25,6 +159,22 @@ void FUObjectAllocator::AllocatePermanentObjectPool(int32 InPermanentObjectPoolS
 	PermanentObjectPoolExceededTail = PermanentObjectPoolTail;
 }
 
+/**
+ * Reserves address space for per class object pools
+ *
+ * @param InClassPoolsSize size of the address space to reserve, 0 disables class pools
+ */
+void FUObjectAllocator::AllocateClassPools(SIZE_T InClassPoolsSize)
+{
+	check(!ClassPools);
+	if (InClassPoolsSize > 0)
+	{
+		ClassPools		= new FUObjectClassPools(InClassPoolsSize);
+		ClassPoolsBegin	= ClassPools->GetBegin();
+		ClassPoolsEnd	= ClassPools->GetEnd();
+	}
+}
+
 
 /**
  * Prints a debugf message to allow tuning
@@ -39,6 +189,10 @@ void FUObjectAllocator::BootMessage()
 	{
 		UE_LOG(LogUObjectAllocator, Log, TEXT("%i out of %i bytes used by permanent object pool."), PermanentObjectPoolExceededTail - PermanentObjectPool, PermanentObjectPoolSize );
 	}
+	if (ClassPools)
+	{
+		UE_LOG(LogUObjectAllocator, Log, TEXT("%llu out of %llu bytes committed by class object pools."), (uint64)ClassPools->GetCommittedSize(), (uint64)(ClassPoolsEnd - ClassPoolsBegin));
+	}
 }
 
 /**
@@ -47,9 +201,10 @@ void FUObjectAllocator::BootMessage()
  * @param Size size of uobject to allocate
  * @param Alignment alignment of uobject to allocate
  * @param bAllowPermanent if true, allow allocation in the permanent object pool, if it fits
+ * @param Class class of the object, used to place it in the pool of its class if class pools are enabled
  * @return newly allocated UObjectBase (not really a UObjectBase yet, no constructor like thing has been called).
  */
-UObjectBase* FUObjectAllocator::AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent)
+UObjectBase* FUObjectAllocator::AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent, const UClass* Class)
 {
 	// Force alignment to 16 bytes
 	Alignment = 16;
@@ -79,8 +234,16 @@ UObjectBase* FUObjectAllocator::AllocateUObject(int32 Size, int32 Alignment, boo
 	}
 	else
 	{
-		// Allocate new memory of the appropriate size and alignment.
-		Result = (UObjectBase*)FMemory::Malloc( AlignedSize );
+		// Keep objects of frequently allocated classes next to each other.
+		if (ClassPools && Class)
+		{
+			Result = (UObjectBase*)ClassPools->Allocate(Class, AlignedSize);
+		}
+		if (!Result)
+		{
+			// Allocate new memory of the appropriate size and alignment.
+			Result = (UObjectBase*)FMemory::Malloc( AlignedSize );
+		}
 	}
 	return Result;
 }
@@ -94,7 +257,11 @@ void FUObjectAllocator::FreeUObject(UObjectBase *Object) const
 {
 	check(Object);
 	// Only free memory if it was allocated directly from allocator and not from permanent object pool.
-	if( ResidesInPermanentPool(Object) == false )
+	if (ResidesInClassPools(Object))
+	{
+		ClassPools->Free(Object);
+	}
+	else if( ResidesInPermanentPool(Object) == false )
 	{
 		FMemory::Free(Object);
 	}
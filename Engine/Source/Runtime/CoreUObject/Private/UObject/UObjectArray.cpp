@@ -225,6 +225,7 @@ void FUObjectArray::AllocateUObjectIndex(UObjectBase* Object, bool bMergingThrea
 			Index = ObjObjects.AddSingle();			
 		}
 		check(Index >= ObjFirstGCIndex && Index > ObjLastNonGCIndex);
+		ObjAllocatedSinceLastGCCount.Increment();
 	}
 	// Add to global table.
 	FUObjectItem* ObjectItem = IndexToObject(Index);
@@ -1027,6 +1027,14 @@ static FAutoConsoleVariableRef CSizeOfPermanentObjectPool(
 	ECVF_Default
 	);
 
+static int32 GSizeOfClassObjectPoolsMB;
+static FAutoConsoleVariableRef CSizeOfClassObjectPoolsMB(
+	TEXT("gc.SizeOfClassObjectPoolsMB"),
+	GSizeOfClassObjectPoolsMB,
+	TEXT("Placeholder console variable, currently not used in runtime."),
+	ECVF_Default
+	);
+
 static int32 GMaxObjectsInEditor;
 static FAutoConsoleVariableRef CMaxObjectsInEditor(
 	TEXT("gc.MaxObjectsInEditor"),
@@ -1056,6 +1064,7 @@ void UObjectBaseInit()
 	int32 SizeOfPermanentObjectPool = 0;
 	int32 MaxUObjects = 2 * 1024 * 1024; // Default to ~2M UObjects
 	bool bPreAllocateUObjectArray = false;	
+	int32 SizeOfClassObjectPoolsMB = 0;
 
 	// To properly set MaxObjectsNotConsideredByGC look for "Log: XXX objects as part of root set at end of initial load."
 	// in your log file. This is being logged from LaunchEnglineLoop after objects have been added to the root set. 
@@ -1096,6 +1105,9 @@ void UObjectBaseInit()
 #endif
 	}
 
+	// Address space reserved for per class object pools, objects of frequently allocated classes are kept next to each other
+	GConfig->GetInt(TEXT("/Script/Engine.GarbageCollectionSettings"), TEXT("gc.SizeOfClassObjectPoolsMB"), SizeOfClassObjectPoolsMB, GEngineIni);
+
 	if (MaxObjectsNotConsideredByGC <= 0 && SizeOfPermanentObjectPool > 0)
 	{
 		// If permanent object pool is enabled but disregard for GC is disabled, GC will mark permanent object pool objects
@@ -1113,6 +1125,7 @@ void UObjectBaseInit()
 		MaxUObjects, MaxObjectsNotConsideredByGC, SizeOfPermanentObjectPool);
 
 	GUObjectAllocator.AllocatePermanentObjectPool(SizeOfPermanentObjectPool);
+	GUObjectAllocator.AllocateClassPools(SIZE_T(FMath::Max(SizeOfClassObjectPoolsMB, 0)) * 1024 * 1024);
 	GUObjectArray.AllocateObjectPool(MaxUObjects, MaxObjectsNotConsideredByGC, bPreAllocateUObjectArray);
 
 	void InitAsyncThread();
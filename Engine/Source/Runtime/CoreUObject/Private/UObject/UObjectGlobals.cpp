@@ -2428,7 +2428,7 @@ UObject* StaticAllocateObject
 	if( Obj == NULL )
 	{	
 		int32 Alignment	= FMath::Max( 4, InClass->GetMinAlignment() );
-		Obj = (UObject *)GUObjectAllocator.AllocateUObject(TotalSize,Alignment,GIsInitialLoad);
+		Obj = (UObject *)GUObjectAllocator.AllocateUObject(TotalSize,Alignment,GIsInitialLoad,InClass);
 	}
 	else
 	{
@@ -3068,7 +3068,22 @@ void FObjectInitializer::InitProperties(UObject* Obj, UClass* DefaultsClass, UOb
 		UObject* ClassDefaults = bCopyTransientsFromClassDefaults ? DefaultsClass->GetDefaultObject() : NULL;	
 		check(!GEventDrivenLoaderEnabled || !bCopyTransientsFromClassDefaults || !DefaultsClass->GetDefaultObject()->HasAnyFlags(RF_NeedLoad));
 
-		for (FProperty* P = bCanUsePostConstructLink ? Class->PostConstructLink : Class->PropertyLink; P; P = bCanUsePostConstructLink ? P->PostConstructLinkNext : P->PropertyLinkNext)
+		FProperty* FirstProperty = bCanUsePostConstructLink ? Class->PostConstructLink : Class->PropertyLink;
+		if (bCanUsePostConstructLink && DefaultData && Class->TrivialNonNativePropertiesOffset != INDEX_NONE)
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_InitProperties_TrivialBlueprint);
+			// All non-native properties are plain old data, copy them from the CDO in one go. PostConstructLink lists the
+			// properties of the most derived classes first so only native config properties are left to copy below.
+			const int32 Offset = Class->TrivialNonNativePropertiesOffset;
+			FMemory::Memcpy((uint8*)Obj + Offset, (uint8*)DefaultData + Offset, Class->GetPropertiesSize() - Offset);
+			while (FirstProperty && !FirstProperty->GetOwnerClass()->HasAnyClassFlags(CLASS_Native | CLASS_Intrinsic))
+			{
+				FirstProperty = FirstProperty->PostConstructLinkNext;
+			}
+			bNeedInitialize = false;
+		}
+
+		for (FProperty* P = FirstProperty; P; P = bCanUsePostConstructLink ? P->PostConstructLinkNext : P->PropertyLinkNext)
 		{
 			if (bNeedInitialize)
 			{		
@@ -10,9 +10,12 @@
 #include "Misc/AsciiSet.h"
 #include "Misc/PackageName.h"
 #include "HAL/IConsoleManager.h"
+#include "Templates/Atomic.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUObjectHash, Log, All);
 
+extern bool GObjParallelDestroyIsInProgress;
+
 DECLARE_CYCLE_STAT( TEXT( "GetObjectsOfClass" ), STAT_Hash_GetObjectsOfClass, STATGROUP_UObjectHash );
 DECLARE_CYCLE_STAT( TEXT( "HashObject" ), STAT_Hash_HashObject, STATGROUP_UObjectHash );
 DECLARE_CYCLE_STAT( TEXT( "UnhashObject" ), STAT_Hash_UnhashObject, STATGROUP_UObjectHash );
@@ -50,18 +53,18 @@ struct FHashBucket
 	void *ElementsOrSetPtr[2];
 
 #if !UE_BUILD_SHIPPING
-	/** If true this bucket is being iterated over and no Add or Remove operations are allowed */
+	/** If true this bucket is being iterated over and no Add or Remove operations are allowed. Readers sharing the hash tables lock may iterate concurrently. */
 	int32 ReadOnlyLock;
 
 	FORCEINLINE void Lock()
 	{
-		ReadOnlyLock++;
+		FPlatformAtomics::InterlockedIncrement(&ReadOnlyLock);
 	}
 
 	FORCEINLINE void Unlock()
 	{
-		ReadOnlyLock--;
-		check(ReadOnlyLock >= 0);
+		const int32 NewReadOnlyLock = FPlatformAtomics::InterlockedDecrement(&ReadOnlyLock);
+		check(NewReadOnlyLock >= 0);
 	}
 #endif // !UE_BUILD_SHIPPING
 
@@ -275,8 +278,17 @@ struct FHashBucketIterator
 
 class FUObjectHashTables
 {
-	/** Critical section that guards against concurrent adds from multiple threads */
-	FCriticalSection CriticalSection;
+	/**
+	 * Guards the tables. Lookups that don't call out of this file share it, adds, removes and iterations that run callers'
+	 * code hold it exclusively. The exclusive lock is recursive and covers shared locking on the same thread.
+	 */
+	FRWLock TablesLock;
+	/** Thread that holds TablesLock exclusively, 0 if none */
+	TAtomic<uint32> WriterThreadId;
+	/** Recursion count of the exclusive lock, only accessed by the thread that holds it */
+	int32 WriteLockCount;
+	/** Shared lock recursion depth of the current thread */
+	static thread_local int32 ReadLockDepth;
 
 public:
 
@@ -296,7 +308,9 @@ public:
 	TMap<UObjectBase*, UPackage*> ObjectToPackageMap;
 
 	FUObjectHashTables()
-		: ClassToChildListMapVersion(0)
+		: WriterThreadId(0)
+		, WriteLockCount(0)
+		, ClassToChildListMapVersion(0)
 	{
 	}
 
@@ -368,12 +382,48 @@ public:
 
 	FORCEINLINE void Lock()
 	{
-		CriticalSection.Lock();
+		const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+		if (WriterThreadId.Load(EMemoryOrder::Relaxed) == ThreadId)
+		{
+			++WriteLockCount;
+			return;
+		}
+		checkf(ReadLockDepth == 0, TEXT("UObject hash tables can't be locked exclusively by a thread that is reading them"));
+		TablesLock.WriteLock();
+		WriterThreadId = ThreadId;
+		WriteLockCount = 1;
 	}
 
 	FORCEINLINE void Unlock()
 	{
-		CriticalSection.Unlock();
+		check(WriterThreadId.Load(EMemoryOrder::Relaxed) == FPlatformTLS::GetCurrentThreadId());
+		if (--WriteLockCount == 0)
+		{
+			WriterThreadId = 0;
+			TablesLock.WriteUnlock();
+		}
+	}
+
+	/** Takes the shared lock, returns false if this thread already holds the exclusive lock and ReadUnlock must not be called */
+	FORCEINLINE bool ReadLock()
+	{
+		if (WriterThreadId.Load(EMemoryOrder::Relaxed) == FPlatformTLS::GetCurrentThreadId())
+		{
+			return false;
+		}
+		if (ReadLockDepth++ == 0)
+		{
+			TablesLock.ReadLock();
+		}
+		return true;
+	}
+
+	FORCEINLINE void ReadUnlock()
+	{
+		if (--ReadLockDepth == 0)
+		{
+			TablesLock.ReadUnlock();
+		}
 	}
 
 	static FUObjectHashTables& Get()
@@ -392,7 +442,8 @@ public:
 	FORCEINLINE FHashTableLock(FUObjectHashTables& InTables)
 	{
 #if THREADSAFE_UOBJECTS
-		if (!(IsGarbageCollecting() && IsInGameThread()))
+		// The game thread owns the hash tables during GC, unless BeginDestroy is being routed from worker threads
+		if (!(IsGarbageCollecting() && IsInGameThread()) || GObjParallelDestroyIsInProgress)
 		{
 			Tables = &InTables;
 			InTables.Lock();
@@ -416,6 +467,39 @@ public:
 	}
 };
 
+thread_local int32 FUObjectHashTables::ReadLockDepth = 0;
+
+/** Shared lock for lookups, they must not call code outside of this file while holding it */
+class FHashTableReadLock
+{
+#if THREADSAFE_UOBJECTS
+	FUObjectHashTables* Tables;
+#endif
+public:
+	FORCEINLINE FHashTableReadLock(FUObjectHashTables& InTables)
+	{
+#if THREADSAFE_UOBJECTS
+		Tables = nullptr;
+		// The game thread owns the hash tables during GC, unless BeginDestroy is being routed from worker threads
+		if ((!(IsGarbageCollecting() && IsInGameThread()) || GObjParallelDestroyIsInProgress) && InTables.ReadLock())
+		{
+			Tables = &InTables;
+		}
+#else
+		check(IsInGameThread());
+#endif
+	}
+	FORCEINLINE ~FHashTableReadLock()
+	{
+#if THREADSAFE_UOBJECTS
+		if (Tables)
+		{
+			Tables->ReadUnlock();
+		}
+#endif
+	}
+};
+
 /**
  * Calculates the object's hash just using the object's name index
  *
@@ -446,7 +530,7 @@ UObject* StaticFindObjectFastExplicitThreadSafe(FUObjectHashTables& ThreadHash,
 
 	// Find an object with the specified name and (optional) class, in any package; if bAnyPackage is false, only matches top-level packages
 	int32 Hash = GetObjectHash(ObjectName);
-	FHashTableLock HashLock(ThreadHash);
+	FHashTableReadLock HashLock(ThreadHash);
 	FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
 	if (Bucket)
 	{
@@ -619,7 +703,7 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 	if (ObjectPackage != nullptr)
 	{
 		int32 Hash = GetObjectOuterHash(ObjectName, (PTRINT)ObjectPackage);
-		FHashTableLock HashLock(ThreadHash);
+		FHashTableReadLock HashLock(ThreadHash);
 		for (TMultiMap<int32, class UObjectBase*>::TConstKeyIterator HashIt(ThreadHash.HashOuter, Hash); HashIt; ++HashIt)
 		{
 			UObject *Object = (UObject *)HashIt.Value();
@@ -667,7 +751,7 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 		FObjectSearchPath SearchPath(ObjectName);
 
 		const int32 Hash = GetObjectHash(SearchPath.Inner);
-		FHashTableLock HashLock(ThreadHash);
+		FHashTableReadLock HashLock(ThreadHash);
 
 		FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
 		if (Bucket)
@@ -901,7 +985,7 @@ void GetObjectsWithOuter(const class UObjectBase* Outer, TArray<UObject *>& Resu
 	}
 	int32 StartNum = Results.Num();
 	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock HashLock(ThreadHash);
+	FHashTableReadLock HashLock(ThreadHash);
 	FHashBucket* Inners = ThreadHash.ObjectOuterMap.Find(Outer);
 	if (Inners)
 	{
@@ -1011,7 +1095,7 @@ UObjectBase* FindObjectWithOuter(const class UObjectBase* Outer, const class UCl
 	else
 	{
 		FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-		FHashTableLock HashLock(ThreadHash);
+		FHashTableReadLock HashLock(ThreadHash);
 		FHashBucket* Inners = ThreadHash.ObjectOuterMap.Find(Outer);
 		if (Inners)
 		{
@@ -1137,20 +1221,6 @@ static void RecursivelyPopulateDerivedClasses(FUObjectHashTables& ThreadHash, co
 	}
 }
 
-void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject *>& Results, bool bIncludeDerivedClasses, EObjectFlags ExclusionFlags, EInternalObjectFlags ExclusionInternalFlags)
-{
-	SCOPE_CYCLE_COUNTER(STAT_Hash_GetObjectsOfClass);
-
-	ForEachObjectOfClass(ClassToLookFor,
-		[&Results](UObject* Object)
-		{
-			Results.Add(Object);
-		}
-	, bIncludeDerivedClasses, ExclusionFlags, ExclusionInternalFlags);
-
-	check(Results.Num() <= GUObjectArray.GetObjectArrayNum()); // otherwise we have a cycle in the outer chain, which should not be possible
-}
-
 FORCEINLINE void ForEachObjectOfClasses_Implementation(FUObjectHashTables& ThreadHash, TArrayView<const UClass*> ClassesToLookFor, TFunctionRef<void(UObject*)> Operation, EObjectFlags ExcludeFlags /*= RF_ClassDefaultObject*/, EInternalObjectFlags ExclusionInternalFlags /*= EInternalObjectFlags::None*/)
 {
 	// We don't want to return any objects that are currently being background loaded unless we're using the object iterator during async loading.
@@ -1177,6 +1247,32 @@ FORCEINLINE void ForEachObjectOfClasses_Implementation(FUObjectHashTables& Threa
 	}
 }
 
+void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject *>& Results, bool bIncludeDerivedClasses, EObjectFlags ExclusionFlags, EInternalObjectFlags ExclusionInternalFlags)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Hash_GetObjectsOfClass);
+
+	TArray<const UClass*, TInlineAllocator<16>> ClassesToSearch;
+	ClassesToSearch.Add(ClassToLookFor);
+
+	// Only gathers results, so unlike ForEachObjectOfClass this can share the tables with other readers
+	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
+	FHashTableReadLock HashLock(ThreadHash);
+
+	if (bIncludeDerivedClasses)
+	{
+		RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, ClassesToSearch);
+	}
+
+	ForEachObjectOfClasses_Implementation(ThreadHash, ClassesToSearch,
+		[&Results](UObject* Object)
+		{
+			Results.Add(Object);
+		}
+	, ExclusionFlags, ExclusionInternalFlags);
+
+	check(Results.Num() <= GUObjectArray.GetObjectArrayNum()); // otherwise we have a cycle in the outer chain, which should not be possible
+}
+
 void ForEachObjectOfClass(const UClass* ClassToLookFor, TFunctionRef<void(UObject*)> Operation, bool bIncludeDerivedClasses, EObjectFlags ExclusionFlags, EInternalObjectFlags ExclusionInternalFlags)
 {
 	// Most classes searched for have around 10 subclasses, some have hundreds
@@ -1205,7 +1301,7 @@ void ForEachObjectOfClasses(TArrayView<const UClass*> ClassesToLookFor, TFunctio
 void GetDerivedClasses(const UClass* ClassToLookFor, TArray<UClass*>& Results, bool bRecursive)
 {
 	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock HashLock(ThreadHash);
+	FHashTableReadLock HashLock(ThreadHash);
 
 	if (bRecursive)
 	{
@@ -1227,7 +1323,7 @@ bool ClassHasInstancesAsyncLoading(const UClass* ClassToLookFor)
 	ClassesToSearch.Add(ClassToLookFor);
 
 	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock HashLock(ThreadHash);
+	FHashTableReadLock HashLock(ThreadHash);
 
 	RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, ClassesToSearch);
 
@@ -1361,7 +1457,7 @@ void UnhashObjectExternalPackage(class UObjectBase* Object)
 UPackage* GetObjectExternalPackageThreadSafe(const UObjectBase* Object)
 {
 	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock LockHash(ThreadHash);
+	FHashTableReadLock LockHash(ThreadHash);
 	return ThreadHash.ObjectToPackageMap.FindRef(Object);
 }
 
@@ -1536,7 +1632,7 @@ void LogHashStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisionInf
 	Ar.Logf(TEXT("Hash efficiency statistics for the Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
-	FHashTableLock HashLock(FUObjectHashTables::Get());
+	FHashTableReadLock HashLock(FUObjectHashTables::Get());
 	LogHashStatisticsInternal(FUObjectHashTables::Get().Hash, Ar, bShowHashBucketCollisionInfo);
 	Ar.Logf(TEXT(""));
 }
@@ -1546,7 +1642,7 @@ void LogHashOuterStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisi
 	Ar.Logf(TEXT("Hash efficiency statistics for the Outer Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
-	FHashTableLock HashLock(FUObjectHashTables::Get());
+	FHashTableReadLock HashLock(FUObjectHashTables::Get());
 	LogHashStatisticsInternal(FUObjectHashTables::Get().HashOuter, Ar, bShowHashBucketCollisionInfo);
 	Ar.Logf(TEXT(""));
 
@@ -1565,7 +1661,7 @@ void LogHashMemoryOverheadStatistics(FOutputDevice& Ar, const bool bShowIndividu
 	Ar.Logf(TEXT("-------------------------------------------------"));
 
 	FUObjectHashTables& HashTables = FUObjectHashTables::Get();
-	FHashTableLock HashLock(HashTables);
+	FHashTableReadLock HashLock(HashTables);
 
 	int64 TotalSize = 0;
 	
@@ -44,6 +44,7 @@ struct COREUOBJECT_API FAssetRegistryVersion
 								// * Switched from FName table to seek-free and more optimized FName batch loading
 								// * Removed global tag storage, a tag map reference-counts one store per asset registry
 								// * All configs can mix fixed and loose tag maps 
+		AddedPackageCookKey,	// Added cook key of the package inputs to package data
 
 		// -----<new versions can be added above this line>-------------------------------------------------
 		VersionPlusOne,
@@ -559,6 +560,12 @@ public:
 	/** MD5 of the cooked package on disk, for tracking nondeterministic changes */
 	FMD5Hash CookedHash;
 
+	/**
+	 * MD5 of everything the cooked package was built from: the source package, the cook keys of its hard dependencies and the cook settings.
+	 * Only set by the cooker, an iterative cook recooks a package when its key no longer matches the key from the previous cook.
+	 */
+	FMD5Hash CookKey;
+
 	FAssetPackageData()
 		: DiskSize(0)
 	{
@@ -583,6 +590,7 @@ public:
 		Ar << PackageGuid;
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
 		Ar << CookedHash;
+		Ar << CookKey;
 	}
 };
 
@@ -2688,6 +2688,12 @@ public:
 	/** Index of the first ClassRep that belongs to this class. Anything before that was defined by / belongs to parent classes. */
 	int32 FirstOwnedClassRep = 0;
 
+	/**
+	 * Offset of the first property owned by a non-native class if all non-native properties are plain old data, INDEX_NONE otherwise.
+	 * When set, new instances initialize everything past this offset by copying the class default object's memory.
+	 */
+	int32 TrivialNonNativePropertiesOffset = INDEX_NONE;
+
 #if WITH_EDITOR || HACK_HEADER_GENERATOR 
 	// Editor only properties
 	void GetHideFunctions(TArray<FString>& OutHideFunctions) const;
@@ -473,6 +473,9 @@ private:
 		}
 	};
 
+	/** How many objects ahead of the one being processed ProcessObjectArray starts prefetching */
+	static constexpr int32 PrefetchDistance = 8;
+
 	/** Object that handles all UObject references */
 	ReferenceProcessorType& ReferenceProcessor;
 	/** Custom TArray allocator */
@@ -640,14 +643,24 @@ private:
 				CurrentObject = ObjectsToSerialize[CurrentIndex++];
 				checkSlow(CurrentObject);
 
+				// Marking is bound by memory latency, so objects are prefetched in stages ahead of being processed:
+				// the header of the object PrefetchDistance ahead (for its class pointer), the token stream header in the class
+				// of the object half as far ahead and finally all of the next object's properties
+				// and the start of its token stream. Each stage only dereferences memory prefetched by the one before.
 				// GetData() used to avoiding bounds checking (min and max)
-				// FMath::Min used to avoid out of bounds (without branching) on last iteration. Though anything can be passed into PrefetchBlock, 
+				// FMath::Min used to avoid out of bounds (without branching) on the last iterations. Though anything can be passed into PrefetchBlock, 
 				// reading ObjectsToSerialize out of bounds is not safe since ObjectsToSerialize[Num()] may be an unallocated/unsafe address.
-				const UObject * const NextObject = ObjectsToSerialize.GetData()[FMath::Min<int32>(CurrentIndex, ObjectsToSerialize.Num() - 1)];
-
-				// Prefetch the next object assuming that the property size of the next object is the same as the current one.
-				// This allows us to avoid a branch here.
-				FPlatformMisc::PrefetchBlock(NextObject, CurrentObject->GetClass()->GetPropertiesSize());
+				const int32 LastIndex = ObjectsToSerialize.Num() - 1;
+				const UObject* const* RESTRICT ObjectsData = ObjectsToSerialize.GetData();
+				FPlatformMisc::Prefetch(ObjectsData[FMath::Min<int32>(CurrentIndex + PrefetchDistance - 1, LastIndex)]);
+				{
+					const UClass* ClassToPrefetch = ObjectsData[FMath::Min<int32>(CurrentIndex + PrefetchDistance / 2 - 1, LastIndex)]->GetClass();
+					FPlatformMisc::Prefetch(&ClassToPrefetch->ReferenceTokenStream);
+				}
+				const UObject * const NextObject = ObjectsData[FMath::Min<int32>(CurrentIndex, LastIndex)];
+				const UClass* NextObjectClass = NextObject->GetClass();
+				FPlatformMisc::PrefetchBlock(NextObject, NextObjectClass->GetPropertiesSize());
+				NextObjectClass->ReferenceTokenStream.PrefetchTokens();
 
 				//@todo rtgc: we need to handle object references in struct defaults
 
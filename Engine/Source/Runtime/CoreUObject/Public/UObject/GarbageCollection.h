@@ -242,6 +242,12 @@ struct COREUOBJECT_API FGCReferenceTokenStream
 		return Tokens.Num() == 0;
 	}
 
+	/** Prefetches the start of the token stream ahead of processing an object using it. */
+	FORCEINLINE void PrefetchTokens() const
+	{
+		FPlatformMisc::Prefetch(Tokens.GetData());
+	}
+
 	/**
 	 * Prepends passed in stream to existing one.
 	 *
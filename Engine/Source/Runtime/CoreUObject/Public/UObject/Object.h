@@ -497,6 +497,23 @@ public:
 	*/
 	virtual bool IsDestructionThreadSafe() const;
 
+	/**
+	* Called during garbage collection to determine if BeginDestroy can be routed to this object on a worker thread
+	* when gc.ParallelDestroyEnabled is set. BeginDestroy overrides of classes returning true must not touch state
+	* shared with other objects beyond what UObject::BeginDestroy does itself.
+	*
+	* @return	true if this object's BeginDestroy is thread safe
+	*/
+	virtual bool IsBeginDestroyThreadSafe() const;
+
+	/**
+	* Called during garbage collection to determine if FinishDestroy can be routed to this object on a worker thread
+	* when gc.ParallelDestroyEnabled is set. IsReadyForFinishDestroy is always called on the game thread.
+	*
+	* @return	true if this object's FinishDestroy is thread safe
+	*/
+	virtual bool IsFinishDestroyThreadSafe() const;
+
 	/**
 	* Called during cooking. Must return all objects that will be Preload()ed when this is serialized at load time. Only used by the EDL.
 	*
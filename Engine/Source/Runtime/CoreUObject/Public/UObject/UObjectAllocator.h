@@ -8,6 +8,9 @@
 
 #include "CoreMinimal.h"
 
+class UClass;
+class FUObjectClassPools;
+
 class COREUOBJECT_API FUObjectAllocator
 {
 public:
@@ -19,7 +22,10 @@ public:
 	  PermanentObjectPoolSize(0),
 	  PermanentObjectPool(NULL),
 	  PermanentObjectPoolTail(NULL),
-		PermanentObjectPoolExceededTail(NULL)
+		PermanentObjectPoolExceededTail(NULL),
+		ClassPools(NULL),
+		ClassPoolsBegin(NULL),
+		ClassPoolsEnd(NULL)
 	{
 	}
 
@@ -30,6 +36,14 @@ public:
 	 */
 	void AllocatePermanentObjectPool(int32 InPermanentObjectPoolSize);
 
+	/**
+	 * Reserves address space for per class object pools. Objects of classes that have been allocated often enough are
+	 * then placed in slabs owned by their class, which keeps objects of the same class next to each other in memory.
+	 *
+	 * @param InClassPoolsSize size of the address space to reserve, 0 disables class pools
+	 */
+	void AllocateClassPools(SIZE_T InClassPoolsSize);
+
 	/**
 	 * Prints a debugf message to allow tuning
 	 */
@@ -46,15 +60,27 @@ public:
 		return ((const uint8*)Object >= PermanentObjectPool) && ((const uint8*)Object < PermanentObjectPoolTail);
 	}
 
+	/**
+	 * Checks whether object was allocated from one of the per class object pools.
+	 *
+	 * @param Object object to test as a member of the class pools
+	 * @return true if object is part of a class pool, false otherwise
+	 */
+	FORCEINLINE bool ResidesInClassPools(const UObjectBase *Object) const
+	{
+		return ((const uint8*)Object >= ClassPoolsBegin) && ((const uint8*)Object < ClassPoolsEnd);
+	}
+
 	/**
 	 * Allocates a UObjectBase from the free store or the permanent object pool
 	 *
 	 * @param Size size of uobject to allocate
 	 * @param Alignment alignment of uobject to allocate
 	 * @param bAllowPermanent if true, allow allocation in the permanent object pool, if it fits
+	 * @param Class class of the object, used to place it in the pool of its class if class pools are enabled
 	 * @return newly allocated UObjectBase (not really a UObjectBase yet, no constructor like thing has been called).
 	 */
-	UObjectBase* AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent);
+	UObjectBase* AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent, const UClass* Class = nullptr);
 
 	/**
 	 * Returns a UObjectBase to the free store, unless it is in the permanent object pool
@@ -73,6 +99,12 @@ private:
 	uint8*						PermanentObjectPoolTail;
 	/** Tail that exceeded the size of the permanent object pool, >= PermanentObjectPoolTail.		*/
 	uint8*						PermanentObjectPoolExceededTail;
+	/** Per class object pools, null if disabled.											*/
+	FUObjectClassPools*			ClassPools;
+	/** Begin of the address space reserved for class pools.								*/
+	uint8*						ClassPoolsBegin;
+	/** End of the address space reserved for class pools.									*/
+	uint8*						ClassPoolsEnd;
 };
 
 /** Global UObjectBase allocator							*/
@@ -875,6 +875,15 @@ public:
 		return ObjLastNonGCIndex + 1;
 	}
 
+	/**
+	 * Returns the number of garbage collectable objects allocated since the last call, and restarts the count.
+	 * Called by the garbage collector once per collection.
+	 */
+	int32 ResetObjectsAllocatedSinceLastGC()
+	{
+		return ObjAllocatedSinceLastGCCount.Reset();
+	}
+
 #if UE_GC_TRACK_OBJ_AVAILABLE
 	/**
 	 * Returns the number of actual object indices that are claimed (the total size of the global object array minus
@@ -1094,6 +1103,9 @@ private:
 	/** Current master serial number **/
 	FThreadSafeCounter	MasterSerialNumber;
 
+	/** Number of garbage collectable objects allocated since the last garbage collection **/
+	FThreadSafeCounter	ObjAllocatedSinceLastGCCount;
+
 public:
 
 	/** INTERNAL USE ONLY: gets the internal FUObjectItem array */
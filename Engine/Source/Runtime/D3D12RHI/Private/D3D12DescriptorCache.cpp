@@ -13,6 +13,14 @@ static FAutoConsoleVariableRef CVarGlobalViewHeapBlockSize(
 	ECVF_ReadOnly
 );
 
+int32 GD3D12ReuseSRVTables = 1;
+static FAutoConsoleVariableRef CVarD3D12ReuseSRVTables(
+	TEXT("D3D12.ReuseSRVTables"),
+	GD3D12ReuseSRVTables,
+	TEXT("Whether to rebind the last SRV descriptor table of a shader stage when its views didn't change, instead of copying the descriptors into the online heap again."),
+	ECVF_RenderThreadSafe
+);
+
 // Define template functions that are only declared in the header.
 #if USE_STATIC_ROOT_SIGNATURE
 template void FD3D12DescriptorCache::SetConstantBuffers<SF_Vertex>(const FD3D12RootSignature* RootSignature, FD3D12ConstantBufferCache& Cache, const CBVSlotMask& SlotsNeededMask, uint32 Count, uint32& HeapSlot);
@@ -588,6 +596,13 @@ void FD3D12DescriptorCache::SetSRVs(const FD3D12RootSignature* RootSignature, FD
 	D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor = CurrentViewHeap->GetCPUSlotHandle(FirstSlotIndex);
 	D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptors[MAX_SRVS];
 
+	// The last table can be reused if it's still in the current heap and all its views match, including renamed views which get a new version
+	FD3D12SRVTableDesc& LastTable = LastSRVTables[ShaderStage];
+	bool bReuseLastTable = GD3D12ReuseSRVTables
+		&& LastTable.Heap == CurrentViewHeap
+		&& LastTable.HeapGeneration == CurrentViewHeap->GetGeneration()
+		&& LastTable.Count == SlotsNeeded;
+
 	const D3D12_RESOURCE_STATES ValidResourceStates = CmdContext->ValidResourceStates;
 
 	for (uint32 SlotIndex = 0; SlotIndex < SlotsNeeded; SlotIndex++)
@@ -617,16 +632,28 @@ void FD3D12DescriptorCache::SetSRVs(const FD3D12RootSignature* RootSignature, FD
 			SrcDescriptors[SlotIndex] = pNullSRV->GetHandle();
 		}
 		check(SrcDescriptors[SlotIndex].ptr != 0);
+
+		const uint64 ViewVersion = SRVs[SlotIndex] != nullptr ? SRVs[SlotIndex]->GetVersion() : 0;
+		bReuseLastTable = bReuseLastTable && LastTable.ViewVersions[SlotIndex] == ViewVersion;
+		LastTable.ViewVersions[SlotIndex] = ViewVersion;
 	}
 	FD3D12ShaderResourceViewCache::CleanSlots(CurrentDirtySlotMask, SlotsNeeded);
 
-	ID3D12Device* Device = GetParentDevice()->GetDevice();
-	Device->CopyDescriptors(1, &DestDescriptor, &SlotsNeeded, SlotsNeeded, SrcDescriptors, nullptr, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	if (!bReuseLastTable)
+	{
+		ID3D12Device* Device = GetParentDevice()->GetDevice();
+		Device->CopyDescriptors(1, &DestDescriptor, &SlotsNeeded, SlotsNeeded, SrcDescriptors, nullptr, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
+		LastTable.Heap = CurrentViewHeap;
+		LastTable.HeapGeneration = CurrentViewHeap->GetGeneration();
+		LastTable.Count = SlotsNeeded;
+		LastTable.GPUHandle = CurrentViewHeap->GetGPUSlotHandle(FirstSlotIndex);
+	}
 
 	check((CurrentDirtySlotMask & SlotsNeededMask) == 0);	// Check all slots that needed to be set, were set.
 
-	const D3D12_GPU_DESCRIPTOR_HANDLE BindDescriptor = CurrentViewHeap->GetGPUSlotHandle(FirstSlotIndex);
+	// The slots reserved for a reused table are left unused
+	const D3D12_GPU_DESCRIPTOR_HANDLE BindDescriptor = LastTable.GPUHandle;
 
 	if (ShaderStage == SF_Compute)
 	{
@@ -839,6 +866,7 @@ FD3D12OnlineHeap::FD3D12OnlineHeap(FD3D12Device* Device, FRHIGPUMask Node, bool
 	, bCanLoopAround(CanLoopAround)
 	, NextSlotIndex(0)
 	, FirstUsedSlot(0)
+	, Generation(0)
 	, Desc({})
 {};
 
@@ -928,6 +956,7 @@ uint32 FD3D12OnlineHeap::ReserveSlots(uint32 NumSlotsRequested)
 		SlotAfterReservation = NumSlotsRequested;
 
 		FirstUsedSlot = SlotAfterReservation;
+		++Generation;
 
 		// Notify the derived class that the heap has been looped around
 		HeapLoopedAround();
@@ -1206,6 +1235,7 @@ bool FD3D12SubAllocatedOnlineHeap::AllocateBlock()
 	// Reset counters
 	NextSlotIndex = 0;
 	FirstUsedSlot = 0;
+	++Generation;
 	Heap.SafeRelease();
 
 	// Extract global heap data
@@ -1309,6 +1339,7 @@ bool FD3D12LocalOnlineHeap::RollOver()
 
 	NextSlotIndex = 0;
 	FirstUsedSlot = 0;
+	++Generation;
 
 	// Notify other layers of heap change
 	CPUBase = Heap->GetCPUDescriptorHandleForHeapStart();
@@ -104,6 +104,17 @@ struct FD3D12SamplerArrayDesc
 uint32 GetTypeHash(const FD3D12SamplerArrayDesc& Key);
 typedef FD3D12ConservativeMap<FD3D12SamplerArrayDesc, D3D12_GPU_DESCRIPTOR_HANDLE> FD3D12SamplerMap;
 
+/** Last SRV table copied to the online view heap for a shader stage, rebinding the same views reuses it instead of copying the descriptors again */
+struct FD3D12SRVTableDesc
+{
+	FD3D12OnlineHeap* Heap = nullptr;
+	uint32 HeapGeneration = 0;
+	uint32 Count = 0;
+	D3D12_GPU_DESCRIPTOR_HANDLE GPUHandle = {};
+	// View versions of the table, 0 for null views
+	uint64 ViewVersions[MAX_SRVS];
+};
+
 
 template< uint32 CPUTableSize>
 struct FD3D12UniqueDescriptorTable
@@ -338,6 +349,9 @@ public:
 	void SetNextSlot(uint32 NextSlot);
 	uint32 GetNextSlotIndex() const { return NextSlotIndex;  }
 
+	// Changes every time previously reserved slots can be reused or the heap memory changes
+	uint32 GetGeneration() const { return Generation; }
+
 	// Function which can/should be implemented by the derived classes
 	virtual bool RollOver() = 0;
 	virtual void HeapLoopedAround() { }
@@ -362,6 +376,9 @@ protected:
 	// Indicates the last free slot marked by the command list being finished
 	uint32 FirstUsedSlot;
 
+	// Incremented on roll over and loop around
+	uint32 Generation;
+
 	// Keeping this ptr around is basically just for lifetime management
 	TRefCountPtr<ID3D12DescriptorHeap> Heap;
 
@@ -674,6 +691,8 @@ private:
 
 	TArray<FD3D12UniqueSamplerTable> UniqueTables;
 
+	FD3D12SRVTableDesc LastSRVTables[SF_NumStandardFrequencies];
+
 	FD3D12SamplerSet LocalSamplerSet;
 	bool bUsingGlobalSamplerHeap;
 
@@ -5,6 +5,14 @@
 =============================================================================*/
 
 #include "D3D12RHIPrivate.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+static FThreadSafeCounter64 GD3D12ViewVersion;
+
+uint64 GetNextD3D12ViewVersion()
+{
+	return (uint64)GD3D12ViewVersion.Increment();
+}
 
 static FORCEINLINE D3D12_SHADER_RESOURCE_VIEW_DESC GetVertexBufferSRVDesc(FD3D12VertexBuffer* VertexBuffer, uint32& CreationStride, uint8 Format, uint32 StartOffsetBytes, uint32 NumElements)
 {
@@ -697,12 +697,18 @@ typedef TD3D12ViewDescriptorHandle<D3D12_RENDER_TARGET_VIEW_DESC>		FD3D12Descrip
 typedef TD3D12ViewDescriptorHandle<D3D12_DEPTH_STENCIL_VIEW_DESC>		FD3D12DescriptorHandleDSV;
 typedef TD3D12ViewDescriptorHandle<D3D12_UNORDERED_ACCESS_VIEW_DESC>	FD3D12DescriptorHandleUAV;
 
+/** Returns a new unique version for a view descriptor, used by the descriptor cache to tell rewritten descriptors apart */
+extern uint64 GetNextD3D12ViewVersion();
+
 template <typename TDesc>
 class FD3D12View
 {
 private:
 	TD3D12ViewDescriptorHandle<TDesc> Descriptor;
 
+	// Changes every time the descriptor is (re)written, as renames reuse the same descriptor slot
+	uint64 Version;
+
 protected:
 	ViewSubresourceSubsetFlags Flags;
 	FD3D12ResourceLocation* ResourceLocation;
@@ -717,6 +723,7 @@ protected:
 
 	explicit FD3D12View(FD3D12Device* InParent, ViewSubresourceSubsetFlags InFlags)
 		: Descriptor(InParent)
+		, Version(0)
 		, Flags(InFlags)
 #if DO_CHECK
 		, bInitialized(false)
@@ -740,6 +747,7 @@ private:
 		ResidencyHandle = Resource->GetResidencyHandle();
 
 		Desc = InDesc;
+		Version = GetNextD3D12ViewVersion();
 
 		ViewSubresourceSubset = CViewSubresourceSubset(Desc,
 			Resource->GetMipLevels(),
@@ -776,6 +784,7 @@ public:
 	inline const TDesc&						GetDesc()					const { checkf(bInitialized, TEXT("Uninitialized D3D12View size %d"), (uint32)sizeof(TDesc)); return Desc; }
 	inline CD3DX12_CPU_DESCRIPTOR_HANDLE	GetView()					const { checkf(bInitialized, TEXT("Uninitialized D3D12View size %d"), (uint32)sizeof(TDesc)); return Descriptor.GetHandle(); }
 	inline uint32							GetDescriptorHeapIndex()	const { checkf(bInitialized, TEXT("Uninitialized D3D12View size %d"), (uint32)sizeof(TDesc)); return Descriptor.GetIndex(); }
+	inline uint64							GetVersion()				const { checkf(bInitialized, TEXT("Uninitialized D3D12View size %d"), (uint32)sizeof(TDesc)); return Version; }
 	inline FD3D12Resource*					GetResource()				const { checkf(bInitialized, TEXT("Uninitialized D3D12View size %d"), (uint32)sizeof(TDesc)); return Resource; }
 	inline FD3D12ResourceLocation*			GetResourceLocation()		const { checkf(bInitialized, TEXT("Uninitialized D3D12View size %d"), (uint32)sizeof(TDesc)); return ResourceLocation; }
 	inline FD3D12ResidencyHandle*			GetResidencyHandle()		const { checkf(bInitialized, TEXT("Uninitialized D3D12View size %d"), (uint32)sizeof(TDesc)); return ResidencyHandle; }
@@ -145,6 +145,14 @@ private:
 	/** Used for fast removal of end of frame update */
 	int32 MarkedForEndOfFrameUpdateArrayIndex;
 
+	/** Tick batch that ticks this component in place of PrimaryComponentTick, if any */
+	struct FActorComponentTickBatchFunction* TickBatch;
+
+	/** Used for fast removal from TickBatch */
+	int32 TickBatchIndex;
+
+	friend struct FActorComponentTickBatchFunction;
+
 	/** Populated when the component is created and tracks the often used order of creation on a per archetype/per actor basis */
 	UPROPERTY()
 	int32 UCSSerializationIndex;
@@ -470,6 +478,16 @@ public:
 	/** Returns true if this type of component can ever replicate, override to disable the default behavior */
 	virtual bool GetComponentClassCanReplicate() const;
 
+	/** Returns true if this type of component only affects what players see or hear, e.g. lights, decals, particles and audio */
+	virtual bool IsCosmetic() const { return false; }
+
+	/**
+	 * Returns true if server.StripCosmeticComponents removes the component from dedicated servers: it's cosmetic, doesn't
+	 * replicate, and no component that is kept is attached to it. Stripped components are left out of server cooks and
+	 * aren't created by construction scripts on dedicated servers.
+	 */
+	bool CanStripForServer() const;
+
 #if WITH_EDITORONLY_DATA
 	/** Returns whether this component is an editor-only object or not */
 	virtual bool IsEditorOnly() const override { return bIsEditorOnly; }
@@ -615,6 +633,21 @@ protected:
 	 */
 	virtual void RegisterComponentTickFunctions(bool bRegister);
 
+	/**
+	 * Return true to tick this component as part of a batch shared by all components of the same class in the level,
+	 * instead of registering PrimaryComponentTick on its own. The batch ticks in parallel if PrimaryComponentTick.bRunOnAnyThread is set.
+	 * Only components without tick prerequisites or a tick interval at registration time are batched, and the
+	 * component's tick function is not registered with the tick task manager, so prerequisites added to or on it later are ignored.
+	 */
+	virtual bool ShouldTickInBatch() const { return false; }
+
+private:
+	/** Adds this component to the tick batch for its class and level, creating the batch if needed */
+	void AddToTickBatch();
+
+	/** Removes this component from its tick batch, destroying the batch once it is empty */
+	void RemoveFromTickBatch();
+
 public:
 	/**
 	 * Initializes the component.  Occurs at level startup or actor spawn. This is before BeginPlay (Actor or Component).  
@@ -167,6 +167,7 @@ public:
 	virtual void DestroyRenderState_Concurrent() override;
 	virtual void SendRenderTransform_Concurrent() override;
 	virtual const UObject* AdditionalStatObject() const override;
+	virtual bool IsCosmetic() const override { return true; }
 	//~ End UActorComponent Interface
 	
 	//~ Begin UObject Interface. 
@@ -231,6 +231,9 @@ class ENGINE_API ULightComponentBase : public USceneComponent
 	virtual bool CanEditChange(const FProperty* InProperty) const override;
 #endif
 
+	/** UActorComponent Interface */
+	virtual bool IsCosmetic() const override { return true; }
+
 	/** We return a small bounds to allow us to non-interpenetrates when placing lights in the level. */
 	virtual bool ShouldCollideWhenPlacing() const override;
 
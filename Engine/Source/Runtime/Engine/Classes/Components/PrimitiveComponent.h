@@ -291,6 +291,15 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Collision)
 	uint8 bMultiBodyOverlap:1;
 
+	/**
+	 * If true, moving this component without sweeping into anything doesn't query its overlaps right away. They are updated once at the
+	 * end of the tick group, or of the frame, however many times the component moved in between, and the begin and end overlap events
+	 * are dispatched then. Overlaps found by sweeps are still dispatched during the move. Only use this when nothing relies on the
+	 * overlap events or GetOverlappingComponents() right after moving, e.g. for trigger volumes that many actors move through.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Collision)
+	uint8 bDeferOverlapUpdates:1;
+
 	/**
 	 * If true, component sweeps with this component should trace against complex collision during movement (for example, each triangle of a mesh).
 	 * If false, collision will be resolved against simple collision bounds instead.
@@ -981,6 +990,9 @@ public:
 	 */
 	virtual bool UpdateOverlapsImpl(const TOverlapArrayView* NewPendingOverlaps=nullptr, bool bDoNotifies=true, const TOverlapArrayView* OverlapsAtEndLocation=nullptr) override;
 
+	/** Updates the overlaps of all components that deferred it since the last flush, see bDeferOverlapUpdates. */
+	static void FlushDeferredOverlapUpdates();
+
 #if WITH_EDITOR
 	/**
 	 * Whether or not the bounds of this component should be considered when focusing the editor camera to an actor with this component in it.
@@ -131,6 +131,7 @@ public:
 	//~ Begin UActorComponent Interface
 	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
 	virtual void OnRegister() override;
+	virtual bool IsCosmetic() const override { return true; }
 	//~ End UActorComponent Interface
 
 	/** Adds the component to our list of hidden components. */
@@ -230,6 +230,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category=Rendering)
 	uint8 bUseAttachParentBound:1;
 
+	/**
+	 * If true, moving this component doesn't update the components attached to it right away. They are updated once at the end of
+	 * the tick group, or of the frame, however many times this component moved in between, which saves the repeated render, physics
+	 * and overlap updates of deep hierarchies. Until then the children keep their previous world transform, so only use this when
+	 * nothing reads their transforms back in the meantime, e.g. for purely visual attachments.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category=Transform)
+	uint8 bDeferChildTransformUpdates:1;
+
 	/** Clears the skip update overlaps flag. This should be called any time a change to state would prevent the result of UpdateOverlaps. For example attachment, changing collision settings, etc... */
 	void ClearSkipUpdateOverlaps();
 
@@ -1006,6 +1015,9 @@ public:
 	/** Update transforms of any components attached to this one. */
 	void UpdateChildTransforms(EUpdateTransformFlags UpdateTransformFlags = EUpdateTransformFlags::None, ETeleportType Teleport = ETeleportType::None);
 
+	/** Updates the children of all components that deferred it since the last flush, see bDeferChildTransformUpdates. */
+	static void FlushDeferredChildTransformUpdates();
+
 	/** Calculate the bounds of the component. Default behavior is a bounding box/sphere of zero size. */
 	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const;
 
@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SnapshotInterpolationComponent.generated.h"
+
+/**
+ * Smooths the replicated movement of simulated proxies, by playing it back slightly in the past from a buffer of received snapshots.
+ *
+ * Without it, simulated proxies snap to each ReplicatedMovement update as it arrives. With it, the owner is moved between the two
+ * snapshots around the render time, which trails the latest snapshot by the buffer time. The buffer time grows with the measured
+ * interval between snapshots, so it absorbs network jitter, and servers can lower NetUpdateFrequency without visible stutter.
+ * When snapshots stop arriving, the last one is extrapolated with its velocity for a short while, then held.
+ *
+ * All interpolating components of a world are updated in one batch by USnapshotInterpolationSubsystem, after the tick groups.
+ * This only applies to actors using the AActor replicated movement path, not to replicated physics. Characters already smooth
+ * their movement in UCharacterMovementComponent, and shouldn't use it.
+ */
+UCLASS(ClassGroup=Movement, meta=(BlueprintSpawnableComponent), HideCategories=(Collision, Cooking))
+class ENGINE_API USnapshotInterpolationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USnapshotInterpolationComponent();
+
+	/** Minimum time, in seconds, that the render time trails the latest snapshot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SnapshotInterpolation, meta=(ClampMin="0.0", UIMin="0.0"))
+	float MinBufferTime;
+
+	/** Time the render time trails the latest snapshot, in multiples of the measured snapshot interval. Above 1 covers late snapshots. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SnapshotInterpolation, meta=(ClampMin="1.0", UIMin="1.0"))
+	float BufferIntervals;
+
+	/** How long the last snapshot is extrapolated with its velocity, once the buffer ran dry */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SnapshotInterpolation, meta=(ClampMin="0.0", UIMin="0.0"))
+	float MaxExtrapolationTime;
+
+	/** Snapshots further than this from the previous one are teleported to instead of interpolated */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SnapshotInterpolation, meta=(ClampMin="0.0", UIMin="0.0"))
+	float TeleportDistance;
+
+	/** Returns whether the replicated movement of the owner should go through AddSnapshot, rather than being applied right away */
+	bool IsInterpolating() const;
+
+	/** Buffers the replicated movement of the owner, received at the given world real time */
+	void AddSnapshot(const FVector& Location, const FRotator& Rotation, const FVector& Velocity, float ReceiveTime);
+
+	/** Drops the buffered snapshots, the next snapshot is applied right away */
+	UFUNCTION(BlueprintCallable, Category=SnapshotInterpolation)
+	void ResetSnapshots();
+
+	/**
+	 * Computes the transform of the owner at RealTime, and drops the snapshots that are no longer needed.
+	 * Only touches this component, so components can be evaluated in parallel.
+	 *
+	 * @return	Whether or not there was a snapshot to compute the transform from
+	 */
+	bool Evaluate(float RealTime, FVector& OutLocation, FQuat& OutRotation);
+
+	/** Returns the time the render time currently trails the latest snapshot */
+	float GetBufferTime() const;
+
+protected:
+	//~ Begin UActorComponent Interface
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void ApplyWorldOffset(const FVector& InOffset, bool bWorldShift) override;
+	//~ End UActorComponent Interface
+
+private:
+	struct FSnapshot
+	{
+		FVector Location;
+		FQuat Rotation;
+		FVector Velocity;
+		float ReceiveTime;
+	};
+
+	/** Received snapshots, oldest first */
+	TArray<FSnapshot, TInlineAllocator<8>> Snapshots;
+
+	/** Moving average of the time between snapshots */
+	float SmoothedSnapshotInterval;
+};
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+#include "Engine/World.h"
+
+#include "ActorPoolSubsystem.generated.h"
+
+class AActor;
+
+/**
+ * Keeps actors that would otherwise be destroyed and spawned again in a pool per class.
+ *
+ * Released actors go through EndPlay, leave replication and have their components unregistered. Remote copies are destroyed
+ * as if the actor had been, and the actor gets new NetGUIDs once it is acquired again, so clients see a freshly spawned actor.
+ * Acquired actors are initialized and begin play like a newly spawned actor, gameplay state should be reset in BeginPlay/EndPlay.
+ *
+ * Only dynamically spawned actors can be pooled, and replicated ones only where they have authority.
+ *
+ *	if (UActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+ *	{
+ *		AProjectile* Projectile = ActorPool->AcquireActor<AProjectile>(ProjectileClass, SpawnTransform);
+ *		...
+ *		ActorPool->ReleaseActor(Projectile);
+ *	}
+ */
+UCLASS()
+class ENGINE_API UActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Returns a pooled actor of the given class placed at Transform, or spawns a new one if the pool is empty.
+	 *
+	 * @param Class				Class of the actor, pooled actors are only reused for their exact class
+	 * @param Transform			World transform of the actor
+	 * @param SpawnParameters	Owner and Instigator are applied to reused actors, all parameters are used when spawning
+	 * @return the actor, or null if spawning failed
+	 */
+	AActor* AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters());
+
+	template<class T>
+	T* AcquireActor(TSubclassOf<T> Class, const FTransform& Transform, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters())
+	{
+		return CastChecked<T>(AcquireActor(TSubclassOf<AActor>(*Class), Transform, SpawnParameters), ECastCheckedType::NullAllowed);
+	}
+
+	/**
+	 * Parks an actor in the pool of its class instead of destroying it.
+	 *
+	 * @return true if the actor was pooled, false if it can't be pooled and should be destroyed instead
+	 */
+	bool ReleaseActor(AActor* Actor);
+
+	/** Returns whether the actor can be released to the pool */
+	bool CanPoolActor(const AActor* Actor) const;
+
+	/** Spawns actors of the given class until the pool holds at least Count of them */
+	void PrewarmPool(TSubclassOf<AActor> Class, int32 Count);
+
+	/** Destroys all pooled actors of the given class, or of all classes if Class is null */
+	void EmptyPool(TSubclassOf<AActor> Class = nullptr);
+
+	/** Returns the number of actors currently parked in the pool of the given class */
+	int32 GetNumPooledActors(TSubclassOf<AActor> Class) const;
+
+protected:
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+	//~End of UWorldSubsystem interface
+
+	/** Pooled actors by class. Parked actors stay in their level, which keeps them alive until it goes away. */
+	TMap<UClass*, TArray<TWeakObjectPtr<AActor>>> Pools;
+};
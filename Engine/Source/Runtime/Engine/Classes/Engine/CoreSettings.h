@@ -132,6 +132,8 @@ extern ENGINE_API float GLevelStreamingActorsUpdateTimeLimit;
 extern ENGINE_API float GPriorityLevelStreamingActorsUpdateExtraTime;
 /** Batching granularity used to register actor components during level streaming. */
 extern ENGINE_API int32 GLevelStreamingComponentsRegistrationGranularity;
+/** Batching granularity used to route actor initialization during level streaming. */
+extern ENGINE_API int32 GLevelStreamingRouteActorInitializationGranularity;
 /** Batching granularity used to unregister actor components during level streaming.  */
 extern ENGINE_API int32 GLevelStreamingComponentsUnregistrationGranularity;
 /** Maximum allowed time to spend for actor unregistration steps during level streaming (ms per frame). If this is 0.0 then we don't timeslice.*/
@@ -230,6 +232,11 @@ protected:
 		ToolTip = "Size Of Permanent Object Pool (bytes). Works only in cooked builds."))
 	int32 SizeOfPermanentObjectPool;
 
+	UPROPERTY(EditAnywhere, config, Category = Optimization, meta = (
+		ConsoleVariable = "gc.SizeOfClassObjectPoolsMB", DisplayName = "Size Of Class Object Pools (MB)",
+		ToolTip = "Address space (MB) reserved for per class object pools. Objects of frequently allocated classes are placed next to each other. 0 = disabled."))
+	int32 SizeOfClassObjectPoolsMB;
+
 	UPROPERTY(EditAnywhere, config, Category = Optimization, meta = (
 		ConsoleVariable = "gc.MaxObjectsInGame", DisplayName = "Maximum number of UObjects that can exist in cooked game",
 		ToolTip = "Maximum number of UObjects that can exist in cooked game. Keep this as small as possible."))
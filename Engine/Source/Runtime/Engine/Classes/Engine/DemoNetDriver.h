@@ -421,6 +421,7 @@ public:
 	virtual bool ShouldClientDestroyTearOffActors() const override;
 	virtual bool ShouldSkipRepNotifies() const override;
 	virtual bool ShouldQueueBunchesForActorGUID(FNetworkGUID InGUID) const override;
+	virtual bool ShouldDropQueuedBunchesForClosedActorGUID(FNetworkGUID InGUID, EChannelCloseReason CloseReason) const override;
 	virtual bool ShouldIgnoreRPCs() const override;
 	virtual FNetworkGUID GetGUIDForActor(const AActor* InActor) const override;
 	virtual AActor* GetActorForGUID(FNetworkGUID InGUID) const override;
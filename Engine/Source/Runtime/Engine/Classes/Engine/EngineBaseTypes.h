@@ -512,6 +512,50 @@ struct TStructOpsTypeTraits<FActorComponentTickFunction> : public TStructOpsType
 	};
 };
 
+/** 
+* Tick function that calls UActorComponent::TickComponent on a contiguous list of components of the same class.
+* Created and owned by UActorComponent for components that opt in with ShouldTickInBatch().
+**/
+USTRUCT()
+struct FActorComponentTickBatchFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Components ticked by this batch. Not serialized, components remove themselves when their tick functions are unregistered */
+	TArray<class UActorComponent*> Targets;
+
+	/** The class shared by all the components in this batch */
+	class UClass* TargetClass;
+
+	/** If true, the components in this batch are ticked with a ParallelFor */
+	bool bParallelTick;
+
+	ENGINE_API void AddTarget(class UActorComponent* Target);
+	ENGINE_API void RemoveTarget(class UActorComponent* Target);
+
+	/** 
+		* Abstract function actually execute the tick. 
+		* @param DeltaTime - frame time to advance, in seconds
+		* @param TickType - kind of tick for this frame
+		* @param CurrentThread - thread we are executing on, useful to pass along as new tasks are created
+		* @param MyCompletionGraphEvent - completion event for this task. Useful for holding the completetion of this task until certain child tasks are complete.
+	**/
+	ENGINE_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
+	ENGINE_API virtual FString DiagnosticMessage() override;
+	ENGINE_API virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+
+template<>
+struct TStructOpsTypeTraits<FActorComponentTickBatchFunction> : public TStructOpsTypeTraitsBase2<FActorComponentTickBatchFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
 /** Types of network failures broadcast from the engine */
 UENUM(BlueprintType)
 namespace ENetworkFailure
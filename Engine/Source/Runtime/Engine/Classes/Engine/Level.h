@@ -28,6 +28,7 @@ class UAssetUserData;
 class UMapBuildDataRegistry;
 class UNavigationDataChunk;
 class UTexture2D;
+class USceneComponent;
 struct FLevelCollection;
 class ULevelActorContainer;
 class FLevelPartitionOperationScope;
@@ -376,6 +377,23 @@ struct ENGINE_API FLevelSimplificationDetails
 	bool operator == (const FLevelSimplificationDetails& Other) const;
 };
 
+/** World bounds of a static component, computed when cooking the level so registering the component doesn't have to */
+USTRUCT()
+struct FPrecomputedComponentBounds
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	USceneComponent* Component = nullptr;
+
+	/** Component to world transform the bounds were computed for, they are only used if the component ends up there */
+	UPROPERTY()
+	FTransform Transform;
+
+	UPROPERTY()
+	FBoxSphereBounds Bounds = FBoxSphereBounds(ForceInit);
+};
+
 /**
  * Stored information about replicated static/placed actors that have been destroyed in a level.
  * This information is cached in ULevel so that any net drivers that are created after these actors
@@ -497,6 +515,10 @@ public:
 	UPROPERTY()
 	TArray<FGuid> StreamingTextureGuids;
 
+	/** World bounds of the static components, stored by cooks with s.PrecomputeComponentBounds and moved to PrecomputedBoundsMap on load */
+	UPROPERTY()
+	TArray<FPrecomputedComponentBounds> PrecomputedComponentBounds;
+
 	/** Data structures for holding the tick functions **/
 	class FTickTaskLevel*						TickTaskLevel;
 
@@ -613,11 +635,25 @@ public:
 	uint8										bActorClusterCreated : 1;
 	/** Whether the actor referenced by CurrentActorIndexForUpdateComponents has called PreRegisterAllComponents */
 	uint8										bHasCurrentActorCalledPreRegister;
+	/** Whether IncrementalUpdateComponents has registered all components and is rerunning construction scripts. */
+	uint8										bIsRerunningConstructionScripts:1;
+	/** Current index into actors array for rerunning construction scripts.					*/
+	int32										CurrentActorIndexForRerunConstructionScripts;
 	/** Current index into actors array for updating components.							*/
 	int32										CurrentActorIndexForUpdateComponents;
 	/** Current index into actors array for updating components.							*/
 	int32										CurrentActorIndexForUnregisterComponents;
 
+	/** Pass RouteActorInitialize resumes from when it is called incrementally.				*/
+	enum class ERouteActorInitializationState : uint8
+	{
+		Preinitialize,
+		Initialize,
+		BeginPlay
+	};
+	ERouteActorInitializationState				RouteActorInitializationState;
+	/** Current index into actors array for the RouteActorInitialize pass.					*/
+	int32										RouteActorInitializationIndex;
 
 	/** Whether the level is currently pending being made visible.							*/
 	UE_DEPRECATED(4.15, "Use HasVisibilityChangeRequestPending")
@@ -700,6 +736,14 @@ private:
 	/** Cached level collection that this level is contained in, for faster access than looping through the collections in the world. */
 	FLevelCollection* CachedLevelCollection;
 
+	/** PrecomputedComponentBounds of the components that haven't registered yet */
+	TMap<const USceneComponent*, FPrecomputedComponentBounds> PrecomputedBoundsMap;
+
+#if WITH_EDITOR
+	/** Fills PrecomputedComponentBounds with the static components whose world transform is known without registering them */
+	void BuildPrecomputedComponentBounds();
+#endif
+
 protected:
 
 	/** Array of user data stored with the asset */
@@ -772,6 +816,12 @@ public:
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 	//~ End UObject Interface.
 
+	/**
+	 * Called when GC dissolved the actor cluster of this level. With gc.ActorClusteringAutomatic the cluster is
+	 * created again from the remaining actors at the start of the next world tick.
+	 */
+	void RequestActorClusterRecreation();
+
 	/**
 	 * Flag this level instance for destruction.
 	 * This is called by UWorld::CleanupWorld to flag the level and its owned packages for destruction.
@@ -799,6 +849,12 @@ public:
 	 */
 	void IncrementalUpdateComponents( int32 NumComponentsToUpdate, bool bRerunConstructionScripts, FRegisterComponentContext* Context = nullptr);
 
+	/**
+	 * Gets the bounds computed for a static component when the level was cooked, if it's still at the transform they were computed for.
+	 * Each component's bounds are only handed out once, and the ones left are dropped once all components are registered.
+	 */
+	bool ConsumePrecomputedBounds(const USceneComponent& Component, FBoxSphereBounds& OutBounds);
+
 	/**
 	* Incrementally unregisters all components of actors associated with this level.
 	* This is done at the granularity of actors (individual actors have all of their components unregistered)
@@ -860,9 +916,12 @@ public:
 	/**
 	 * Routes pre and post initialize to actors and also sets volumes.
 	 *
+	 * @param NumActorsToProcess	Number of actors to route initialization for in this run, 0 for all
+	 * @return true once all actors have been initialized and begun play
+	 *
 	 * @todo seamless worlds: this doesn't correctly handle volumes in the multi- level case
 	 */
-	void RouteActorInitialize();
+	bool RouteActorInitialize(int32 NumActorsToProcess = 0);
 
 	/**
 	 * Rebuilds static streaming data for all levels in the specified UWorld.
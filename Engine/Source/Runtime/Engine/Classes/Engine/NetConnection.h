@@ -34,10 +34,13 @@
 #define NETCONNECTION_HAS_SETENCRYPTIONKEY 1
 
 class FInternetAddr;
+class FNetConditionsRecording;
+class FPerfMetricHistogram;
 class FObjectReplicator;
 class StatelessConnectHandlerComponent;
 class UActorChannel;
 class UChildConnection;
+struct FNetConditionsSample;
 
 typedef TMap<TWeakObjectPtr<AActor>, UActorChannel*, FDefaultSetAllocator, TWeakObjectPtrMapKeyFuncs<TWeakObjectPtr<AActor>, UActorChannel*>> FActorChannelMap;
 
@@ -412,6 +415,7 @@ public:
 	double			LastSendTime;			// Last time a packet was sent, for keepalives.
 	double			LastTickTime;			// Last time of polling.
 	int32			QueuedBits;			// Bits assumed to be queued up.
+	int32			QueuedMulticastBitsThisFrame;	// Bits of unreliable multicast RPCs queued this frame, limited by net.MaxQueuedMulticastBitsPerFrame.
 	int32			TickCount;				// Count of ticks.
 	uint32			LastProcessedFrame;   // The last frame where we gathered and processed actors for this connection
 
@@ -741,8 +745,26 @@ public:
 	/** Copies the settings from the net driver to our local copy */
 	void UpdatePacketSimulationSettings();
 
+	/** Replaces the settings of this connection only, until the driver settings change again */
+	void SetConnectionPacketSimulationSettings(const FPacketSimulationSettings& NewSettings);
+
 private:
 
+	/** Loads the recording named by the settings, and picks where in it this connection starts */
+	void UpdateConditionsRecording();
+
+	/** @return the recorded conditions this connection is replaying right now, null if not replaying a recording */
+	const FNetConditionsSample* GetRecordedConditions() const;
+
+	/** Network conditions recording this connection replays, see FPacketSimulationSettings::PktConditionsFile */
+	TSharedPtr<const FNetConditionsRecording> ConditionsRecording;
+
+	/** Offset into the recording, so connections replaying the same recording don't see the same conditions at once */
+	double ConditionsRecordingOffset = 0.0;
+
+	/** Which of the driver's PktConnectionProfiles this connection uses, assigned on first use */
+	int32 ConnectionProfileIndex = INDEX_NONE;
+
 	/** delayed outgoing packet array */
 	TArray<FDelayedPacket> Delayed;
 
@@ -1167,6 +1189,9 @@ public:
 
 	FORCEINLINE FHistogram GetNetHistogram() const { return NetConnectionHistogram; }
 
+	/** Time spent replicating actors to this connection, exposed on the perf counters /metrics route; only set on servers using perf counters */
+	TSharedPtr<FPerfMetricHistogram, ESPMode::ThreadSafe> ReplicationTimeMetric;
+
 	/** Whether or not a client packet has been received - used serverside, to delay any packet sends */
 	FORCEINLINE bool HasReceivedClientPacket()
 	{
@@ -1635,7 +1660,10 @@ struct FScopedNetConnectionSettings
 	bool ShouldApply;
 };
 
-/** A fake connection that will absorb traffic and auto ack every packet. Useful for testing scaling. Use net.SimulateConnections command to add at runtime. */
+/**
+ * A fake connection that will absorb traffic and auto ack every packet. Useful for testing scaling. Use net.SimulateConnections command to add at runtime.
+ * Connections either follow a real PlayerController, or get a viewer of their own that wanders the level so relevancy differs per connection.
+ */
 UCLASS(transient, config=Engine)
 class ENGINE_API USimulatedClientNetConnection
 	: public UNetConnection
@@ -1647,8 +1675,16 @@ public:
 	void HandleClientPlayer( APlayerController* PC, UNetConnection* NetConnection ) override;
 	virtual FString LowLevelGetRemoteAddress(bool bAppendPort=false) override { return FString(); }
 	virtual bool ClientHasInitializedLevelFor(const AActor* TestActor) const { return true; }
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** Only destroys viewers spawned by SpawnViewer, not the real PlayerController we may follow */
+	virtual void DestroyOwningActor() override;
 
-	virtual void DestroyOwningActor() override { /* Don't destroy the OwningActor since we follow a real PlayerController*/ }
+	/**
+	 * Spawns a PlayerController owned by this connection, which wanders within WanderRadius of Origin.
+	 * The controller replicates to this connection like a real player's would.
+	 */
+	bool SpawnViewer(const FVector& Origin, float WanderRadius);
 
 	virtual TSharedPtr<const FInternetAddr> GetRemoteAddr() override { return nullptr; }
 
@@ -1657,6 +1693,14 @@ public:
 
 	virtual FString LowLevelDescribe() override { return TEXT("Simulated Client"); }
 
+private:
+
+	/** Viewer spawned for this connection, see SpawnViewer */
+	TWeakObjectPtr<APlayerController> SpawnedViewer;
+
+	FVector WanderOrigin = FVector::ZeroVector;
+	FVector WanderTarget = FVector::ZeroVector;
+	float WanderRadius = 0.0f;
 };
 
 #if UE_NET_TRACE_ENABLED
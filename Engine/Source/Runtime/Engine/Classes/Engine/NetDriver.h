@@ -330,6 +330,8 @@ struct FNetworkObjectInfo;
 class UChannel;
 class IAnalyticsProvider;
 class FNetAnalyticsAggregator;
+class FPerfMetricCounter;
+class FPerfMetricHistogram;
 class UNetDriver;
 
 enum class ECreateReplicationChangelistMgrFlags;
@@ -344,6 +346,7 @@ extern ENGINE_API int32 GNumReplicateActorCalls;
 extern ENGINE_API bool GReplicateActorTimingEnabled;
 extern ENGINE_API bool GReceiveRPCTimingEnabled;
 extern ENGINE_API double GReplicateActorTimeSeconds;
+extern ENGINE_API double GReplicationCompareTimeSeconds;
 extern ENGINE_API uint32 GNetOutBytes;
 extern ENGINE_API double GReplicationGatherPrioritizeTimeSeconds;
 extern ENGINE_API double GServerReplicateActorTimeSeconds;
@@ -491,6 +494,23 @@ struct ENGINE_API FPacketSimulationSettings
 	UPROPERTY(EditAnywhere, Category = "Simulation Settings")
 	int32	PktJitter = 0;
 
+	/**
+	 * Replays network conditions recorded on a real connection, see FNetConditionsRecording for the format.
+	 * Each connection starts at a random point of the recording, so connections sharing it don't spike together.
+	 *
+	 * Takes the place of the PktLag, PktLagMin/Max, PktJitter and PktIncomingLag settings, and adds to the PktLoss and PktIncomingLoss settings.
+	 * PktOrder still takes precedence.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Simulation Settings")
+	FString	PktConditionsFile;
+
+	/**
+	 * Comma separated emulation profiles handed out to connections in turn, so a server sees a mix of network conditions.
+	 * Each connection then uses its profile instead of the driver settings.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Simulation Settings")
+	FString	PktConnectionProfiles;
+
 	/** reads in settings from the .ini file 
 	 * @note: overwrites all previous settings
 	 */
@@ -532,9 +552,11 @@ struct ENGINE_API FPacketSimulationSettings
 	bool ParseSettings(const TCHAR* Stream, const TCHAR* OptionalQualifier=nullptr);
 
 	bool ParseHelper(const TCHAR* Cmd, const TCHAR* Name, int32& Value, const TCHAR* OptionalQualifier);
+	bool ParseHelper(const TCHAR* Cmd, const TCHAR* Name, FString& Value, const TCHAR* OptionalQualifier);
 
 	bool ConfigHelperInt(const TCHAR* Name, int32& Value, const TCHAR* OptionalQualifier);
 	bool ConfigHelperBool(const TCHAR* Name, bool& Value, const TCHAR* OptionalQualifier);
+	bool ConfigHelperString(const TCHAR* Name, FString& Value, const TCHAR* OptionalQualifier);
 };
 
 struct ENGINE_API FActorDestructionInfo
@@ -942,6 +964,13 @@ public:
 	uint32						OutPackets;
 	/** Total packets sent since the net driver's creation  */
 	uint32						OutTotalPackets;
+	/** Packet and byte counters exposed on the perf counters /metrics route, only set when perf counters are in use */
+	TSharedPtr<FPerfMetricCounter, ESPMode::ThreadSafe> InPacketsMetric;
+	TSharedPtr<FPerfMetricCounter, ESPMode::ThreadSafe> OutPacketsMetric;
+	TSharedPtr<FPerfMetricCounter, ESPMode::ThreadSafe> InBytesMetric;
+	TSharedPtr<FPerfMetricCounter, ESPMode::ThreadSafe> OutBytesMetric;
+	/** Time spent in TickFlush, exposed on the perf counters /metrics route */
+	TSharedPtr<FPerfMetricHistogram, ESPMode::ThreadSafe> TickFlushTimeMetric;
 	/** todo document */
 	uint32						InBunches;
 	/** todo document */
@@ -1437,6 +1466,12 @@ public:
 	/** Called when a spawned actor is destroyed. */
 	ENGINE_API virtual void NotifyActorDestroyed( AActor* Actor, bool IsSeamlessTravel=false );
 
+	/**
+	 * Called when a spawned actor is parked in an actor pool instead of being destroyed. Remote copies are destroyed as if the
+	 * actor had been, and the server forgets the NetGUIDs of the actor and its subobjects so it is assigned new ones when reused.
+	 */
+	ENGINE_API virtual void NotifyActorReleasedToPool(AActor* Actor);
+
 	/** Called when an actor is renamed. */
 	ENGINE_API virtual void NotifyActorRenamed(AActor* Actor, FName PreviousName);
 
@@ -1523,6 +1558,12 @@ public:
 	/** Returns true if actor channels with InGUID should queue up bunches, even if they wouldn't otherwise be queued. */
 	virtual bool ShouldQueueBunchesForActorGUID(FNetworkGUID InGUID) const { return false; }
 
+	/**
+	 * Returns true if a closing actor channel whose actor was never spawned can throw away its queued bunches,
+	 * instead of processing them later (which would spawn the actor just to destroy it again).
+	 */
+	virtual bool ShouldDropQueuedBunchesForClosedActorGUID(FNetworkGUID InGUID, EChannelCloseReason CloseReason) const { return false; }
+
 	/** Returns whether or not RPCs processed by this driver should be ignored. */
 	virtual bool ShouldIgnoreRPCs() const { return false; }
 
@@ -1663,6 +1704,14 @@ protected:
 	void ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime );
 	int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors );
 	int32 ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated );
+	void ServerReplicateActors_MarkRelevantActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, int32 StartActorIndex, int32 EndActorIndex, FActorPriority** PriorityActors );
+
+	/**
+	 * Prioritizes the consider list for the first NumClientsToTick connections in parallel (see net.ParallelPrioritizeActors).
+	 * Only reads actor and channel state; anything that would modify a channel is recorded in the result and applied later on the game thread.
+	 */
+	void ServerReplicateActors_ParallelPrioritizeActors( const int32 NumClientsToTick, const float DeltaSeconds, const TArray<FNetworkObjectInfo*>& ConsiderList, TArray<struct FConnectionPrioritizationResult>& OutResults );
+	void ServerReplicateActors_PrioritizeActorsThreadSafe( UNetConnection* Connection, const TArray<FNetworkObjectInfo*>& ConsiderList, struct FConnectionPrioritizationResult& OutResult ) const;
 #endif
 
 	/** Used to handle any NetDriver specific cleanup once a level has been removed from the world. */
@@ -309,8 +309,13 @@ struct TStructOpsTypeTraits< FExampleArray > : public TStructOpsTypeTraitsBase2<
  *		During client serialization (reading), the client reads in the number of changed and number of deleted elements. It also builds a mapping of ReplicationID -> local index of the current array.
  *		As it deserializes IDs, it looks up the element and then does what it needs to (create if necessary, serialize in the current state, or delete).
  *
- *		There is currently no delta serialization done on the inner structures. If a ReplicationKey changes, the entire item is serialized. If we had
- *		use cases where we needed it, we could delta serialization on the inner dynamic properties. This could be done with more struct customization.
+ *		With standard Fast Array serialization there is no delta serialization done on the inner structures. If a ReplicationKey changes, the entire item is serialized.
+ *
+ *		Delta Struct serialization (FastArrayDeltaSerialize_DeltaSerializeStructs) removes that cost. It is requested by default in the FFastArraySerializer
+ *		constructor (see SetDeltaSerializationEnabled) and is used whenever net.SupportFastArrayDelta is enabled and the serializer meets the requirements listed
+ *		on FastArrayDeltaSerialize_DeltaSerializeStructs. In that mode FRepLayout keeps a per item shadow state and changelist history, so a changed item only
+ *		sends the properties that changed since the connection last acknowledged it. New items, and connections that fell further behind than the changelist
+ *		history, still receive the full item.
  *
  *		ReplicationID and ReplicationKeys are set by the MarkItemDirty function on FFastArraySerializer. These are just int32s that are assigned in order as things change.
  *		There is nothing special about them other than being unique.
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/NetConnection.h"
+#include "Net/Core/PushModel/PushModelMacros.h"
 
 class AActor;
 class FArchive;
@@ -60,6 +61,11 @@ struct FNetworkObjectInfo
 	/** Force this object to be considered relevant for at least one update */
 	uint32 ForceRelevantFrame = 0;
 
+#if WITH_PUSH_MODEL
+	/** Push Model IDs of the actor and its replicated components, tracked while the actor is dormant on all connections. See net.PushModelDormancy. */
+	TArray<int32> PushModelDormancyIds;
+#endif
+
 	FNetworkObjectInfo()
 		: Actor(nullptr)
 		, NextUpdateTime(0.0)
@@ -124,6 +130,8 @@ class ENGINE_API FNetworkObjectList
 public:
 	typedef TSet<TSharedPtr<FNetworkObjectInfo>, FNetworkObjectKeyFuncs> FNetworkObjectSet;
 
+	~FNetworkObjectList();
+
 	/**
 	 * Adds replicated actors in World to the internal set of replicated actors.
 	 * Used when a net driver is initialized after some actors may have already
@@ -238,10 +246,30 @@ public:
 
 	void CountBytes(FArchive& Ar) const;
 
+#if WITH_PUSH_MODEL
+	/**
+	 * Flushes dormancy on actors that are dormant on all connections and had a Push Model property
+	 * (on the actor or one of its replicated components) marked dirty since the last call.
+	 * Only does work when net.PushModelDormancy is enabled, and only visits the dirty objects.
+	 */
+	void FlushDormancyForPushModelDirtyObjects(UNetDriver* NetDriver);
+#endif
+
 private:
 	FNetworkObjectSet AllNetworkObjects;
 	FNetworkObjectSet ActiveNetworkObjects;
 	FNetworkObjectSet ObjectsDormantOnAllConnections;
 
 	TMap<TWeakObjectPtr<UNetConnection>, int32 > NumDormantObjectsPerConnection;
+
+#if WITH_PUSH_MODEL
+	void AddPushModelDormantObject(FNetworkObjectInfo& NetworkObjectInfo);
+	void RemovePushModelDormantObject(FNetworkObjectInfo& NetworkObjectInfo);
+
+	/** Maps Push Model IDs back to the actors that are dormant on all connections. */
+	TMap<int32, TWeakObjectPtr<AActor>> PushModelDormantObjects;
+
+	/** Push Model Dirty Object Tracker used to find dirty dormant actors, lazily registered. */
+	int32 PushModelDirtyObjectTracker = INDEX_NONE;
+#endif
 };
@@ -230,6 +230,7 @@ public:
 	FNetworkGUID	GetNetGUID( const UObject* Object ) const;
 	FNetworkGUID	GetOuterNetGUID( const FNetworkGUID& NetGUID ) const;
 	FNetworkGUID	AssignNewNetGUID_Server( UObject* Object );
+	void			ReleaseNetGUIDs( UObject* Object );
 	FNetworkGUID	AssignNewNetGUIDFromPath_Server( const FString& PathName, UObject* ObjOuter, UClass* ObjClass );
 	void			RegisterNetGUID_Internal( const FNetworkGUID& NetGUID, const FNetGuidCacheObject& CacheObject );
 	void			RegisterNetGUID_Server( const FNetworkGUID& NetGUID, UObject* Object );
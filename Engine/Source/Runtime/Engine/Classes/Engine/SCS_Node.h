@@ -116,6 +116,9 @@ class USCS_Node : public UObject
 	/** Return component template instancing data if cooked for the BPGC, as overridden template data can be cooked out for a child. */
 	ENGINE_API const FBlueprintCookedComponentInstancingData* GetActualComponentTemplateData(class UBlueprintGeneratedClass* ActualBPGC) const;
 
+	/** Whether the component this node creates is stripped from dedicated servers, see UActorComponent::CanStripForServer */
+	bool IsStrippedForServer(class UBlueprintGeneratedClass* ActualBPGC) const;
+
 	/** Returns an array containing this node and all children below it */
 	TArray<USCS_Node*> GetAllNodes();
 	
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "ServerRegionSubsystem.generated.h"
+
+class AActor;
+
+/** Part of the world simulated by one server process */
+USTRUCT()
+struct FServerRegion
+{
+	GENERATED_BODY()
+
+	/** Server simulating the region, matched against -ServerRegionId= */
+	UPROPERTY(config)
+	int32 ServerId = 0;
+
+	/** World space bounds of the region, only X and Y are used */
+	UPROPERTY(config)
+	FBox Bounds = FBox(ForceInit);
+};
+
+/**
+ * Splits the simulation of a world across server processes by region, and tracks replicated actors as they move between them.
+ *
+ * Each server process runs the whole world with -ServerRegionId=N, and owns the actors standing in its regions. This subsystem
+ * reports when an owned actor crosses into another server's region, which is where the game hands it off, and which other
+ * servers an actor is near, which is who should mirror it. It provides the handoff payload, but not the transport: servers
+ * exchange payloads over whatever link the game already has between them, e.g. beacons or a backend service.
+ *
+ * Regions are configured in DefaultEngine.ini:
+ *
+ *	[/Script/Engine.ServerRegionSubsystem]
+ *	+Regions=(ServerId=0,Bounds=(Min=(X=-100000,Y=-100000,Z=-100000),Max=(X=0,Y=100000,Z=100000),IsValid=1))
+ *	+Regions=(ServerId=1,Bounds=(Min=(X=0,Y=-100000,Z=-100000),Max=(X=100000,Y=100000,Z=100000),IsValid=1))
+ */
+UCLASS(config=Engine)
+class ENGINE_API UServerRegionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Called when an actor owned by this server moves into the region of another server, FromServerId is always the local one */
+	DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnActorCrossedRegion, AActor* /*Actor*/, int32 /*FromServerId*/, int32 /*ToServerId*/);
+	FOnActorCrossedRegion OnActorCrossedRegion;
+
+	/** Called when the other servers within BoundaryDistance of an owned actor change. Empty once the actor leaves the boundary. */
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnActorBoundaryChanged, AActor* /*Actor*/, const TArray<int32>& /*NearbyServerIds*/);
+	FOnActorBoundaryChanged OnActorBoundaryChanged;
+
+	/** Returns the id this server process was started with */
+	int32 GetLocalServerId() const { return LocalServerId; }
+
+	/** Returns the server owning the region at Location, INDEX_NONE outside all regions */
+	int32 GetServerIdAt(const FVector& Location) const;
+
+	/** Returns whether this server simulates Location. Locations outside all regions stay with whoever has the actor. */
+	bool HasAuthorityAt(const FVector& Location) const;
+
+	/** Gathers the other servers whose regions are within BoundaryDistance of Location */
+	void GetServersNear(const FVector& Location, TArray<int32>& OutServerIds) const;
+
+	/**
+	 * Writes what another server needs to take over the actor: its class, transform, SaveGame properties and a full
+	 * snapshot of its replicated state, see FActorSnapshotWriter.
+	 * The caller destroys the local actor once the other server accepted it.
+	 */
+	static void WriteHandoff(AActor* Actor, TArray<uint8>& OutData);
+
+	/** Spawns an actor handed off by another server. Its SaveGame and replicated properties are restored before BeginPlay. */
+	AActor* SpawnFromHandoff(const TArray<uint8>& Data);
+
+	/** Logs the regions and the tracked actors */
+	void Dump(FOutputDevice& Ar) const;
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
+
+protected:
+
+	//~USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+	//~End of UWorldSubsystem interface
+
+	UPROPERTY(config)
+	TArray<FServerRegion> Regions;
+
+	/** Distance from another server's region at which actors get mirrored to it */
+	UPROPERTY(config)
+	float BoundaryDistance = 2000.0f;
+
+private:
+
+	struct FTrackedActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		int32 ServerId = INDEX_NONE;
+		TArray<int32> NearbyServerIds;
+		uint32 LastSeenFrame = 0;
+	};
+
+	TMap<FObjectKey, FTrackedActor> TrackedActors;
+
+	int32 LocalServerId = INDEX_NONE;
+	uint32 FrameNumber = 0;
+};
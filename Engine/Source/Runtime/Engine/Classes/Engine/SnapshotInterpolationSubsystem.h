@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Stats/Stats.h"
+
+#include "SnapshotInterpolationSubsystem.generated.h"
+
+class USnapshotInterpolationComponent;
+
+/**
+ * Updates all USnapshotInterpolationComponents of a world in one batch: their transforms are evaluated in parallel, then applied
+ * to their owners on the game thread.
+ */
+UCLASS()
+class ENGINE_API USnapshotInterpolationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Adds the component to the batch, done when it registers */
+	void RegisterComponent(USnapshotInterpolationComponent* Component);
+
+	/** Removes the component from the batch, done when it unregisters */
+	void UnregisterComponent(USnapshotInterpolationComponent* Component);
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(USnapshotInterpolationSubsystem, STATGROUP_Tickables); }
+	//~End of FTickableGameObject interface
+
+protected:
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+	//~End of UWorldSubsystem interface
+
+private:
+
+	UPROPERTY()
+	TArray<USnapshotInterpolationComponent*> Components;
+};
@@ -149,6 +149,9 @@ private:
 	/** Callback when async load finishes, it's here so we can use a shared pointer for callback safety */
 	void AsyncLoadCallbackWrapper(const FName& PackageName, UPackage* LevelPackage, EAsyncLoadingResult::Type Result, FSoftObjectPath TargetName);
 
+	/** Callback when a package requested for several targets of this handle finishes, forwards to AsyncLoadCallbackWrapper for each of them */
+	void AsyncLoadPackageCallbackWrapper(const FName& PackageName, UPackage* LevelPackage, EAsyncLoadingResult::Type Result, TArray<FSoftObjectPath> TargetNames);
+
 	/** Notify all parents that a child completed loading */
 	void NotifyParentsOfCompletion();
 
@@ -350,7 +353,7 @@ private:
 	void FindInMemory(FSoftObjectPath& InOutTarget, struct FStreamable* Existing);
 	FSoftObjectPath HandleLoadedRedirector(UObjectRedirector* LoadedRedirector, FSoftObjectPath RequestedPath, struct FStreamable* RequestedStreamable);
 	struct FStreamable* FindStreamable(const FSoftObjectPath& Target) const;
-	struct FStreamable* StreamInternal(const FSoftObjectPath& Target, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle);
+	struct FStreamable* StreamInternal(const FSoftObjectPath& Target, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle, TMap<FString, TArray<FSoftObjectPath>>& OutPackagesToLoad);
 	UObject* GetStreamed(const FSoftObjectPath& Target) const;
 	void CheckCompletedRequests(const FSoftObjectPath& Target, struct FStreamable* Existing);
 
@@ -143,6 +143,7 @@ private:
 DECLARE_LOG_CATEGORY_EXTERN(LogSpawn, Warning, All);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnActorSpawned, AActor*);
+DECLARE_DELEGATE_OneParam(FOnQueuedActorSpawned, AActor*);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnFeatureLevelChanged, ERHIFeatureLevel::Type);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnMovieSceneSequenceTick, float);
 
@@ -1401,6 +1402,25 @@ private:
 	/** a delegate that broadcasts a notification before a newly spawned actor is initialized */
 	FOnActorSpawned OnActorPreSpawnInitialization;
 
+	/** A spawn requested with SpawnActorQueued. Objects are tracked weakly, the spawn fails if any of them went away. */
+	struct FQueuedActorSpawn
+	{
+		TWeakObjectPtr<UClass> Class;
+		FTransform Transform;
+		FActorSpawnParameters SpawnParameters;
+		TWeakObjectPtr<AActor> Template;
+		TWeakObjectPtr<AActor> Owner;
+		TWeakObjectPtr<APawn> Instigator;
+		TWeakObjectPtr<ULevel> OverrideLevel;
+		FOnQueuedActorSpawned OnSpawned;
+	};
+
+	/** Spawns waiting for ProcessQueuedActorSpawns, in request order */
+	TArray<FQueuedActorSpawn> QueuedActorSpawns;
+
+	/** Index of the next spawn to process in QueuedActorSpawns */
+	int32 NextQueuedActorSpawnIndex = 0;
+
 	/** Reset Async Trace Buffer **/
 	void ResetAsyncTrace();
 
@@ -2228,6 +2248,14 @@ public:
 	 */
 	bool IsTraceHandleValid(const FTraceHandle& Handle, bool bOverlapTrace);
 
+	/**
+	 * Runs a batch of traces (line traces or sweeps, single, multi or test as set in each datum) right away, spread over task threads.
+	 * Traces are ordered by location first, so each task traverses nearby parts of the acceleration structure.
+	 * Results are written to OutHits of each datum, delegates of the data are not called.
+	 * Data can be created like for async traces, e.g. FTraceDatum(World, FCollisionShape::LineShape, Params, ResponseParam, ObjectQueryParams, TraceChannel, UserData, EAsyncTraceType::Single, Start, End)
+	 */
+	void BatchTrace(TArrayView<FTraceDatum> TraceData) const;
+
 private:
 	static void GetCollisionProfileChannelAndResponseParams(FName ProfileName, ECollisionChannel& CollisionChannel, FCollisionResponseParams& ResponseParams)
 	{
@@ -3178,6 +3206,23 @@ public:
 	 */
 	AActor* SpawnActorAbsolute( UClass* Class, FTransform const& AbsoluteTransform, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters());
 
+	/**
+	 * Queues an actor to be spawned at the start of a later world tick. Queued spawns are processed in request order for
+	 * at most world.QueuedActorSpawnTimeLimit ms per frame, which spreads spawn waves over several frames.
+	 *
+	 * @param	Class					Class to Spawn
+	 * @param	Transform				World Transform to spawn on
+	 * @param	SpawnParameters			Spawn Parameters, bDeferConstruction is not supported
+	 * @param	OnSpawned				Called with the spawned actor, or null if spawning failed or an object referenced by the parameters was destroyed
+	 */
+	void SpawnActorQueued( UClass* Class, FTransform const& Transform, const FActorSpawnParameters& SpawnParameters, FOnQueuedActorSpawned OnSpawned );
+
+	/** Spawns actors queued with SpawnActorQueued until the queue is empty or world.QueuedActorSpawnTimeLimit is reached. Called from Tick. */
+	void ProcessQueuedActorSpawns();
+
+	/** Returns the number of spawns queued with SpawnActorQueued that haven't been processed yet. */
+	int32 GetNumQueuedActorSpawns() const { return QueuedActorSpawns.Num() - NextQueuedActorSpawnIndex; }
+
 	/** Templated version of SpawnActor that allows you to specify a class type via the template type */
 	template< class T >
 	T* SpawnActor( const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters() )
@@ -1205,6 +1205,7 @@ public:
 	virtual void BeginDestroy() override;
 	virtual void PostLoad() override;
 	virtual void Deactivate() override;
+	virtual void OnUnregister() override;
 	virtual void RegisterComponentTickFunctions(bool bRegister) override;
 	virtual void ApplyWorldOffset(const FVector& InOffset, bool bWorldShift) override;
 	//End UActorComponent Interface
@@ -2325,6 +2326,20 @@ public:
 	 */
 	void ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits);
 
+	/**
+	 * Determines whether packed moves received on the server are queued and processed together once per frame, rather than immediately as each RPC arrives.
+	 * The default implementation checks the console variable "p.NetServerBatchPackedMoves" and returns true if it is non-zero and this is not a standalone or client world.
+	 * @see ServerProcessBatchedMoves()
+	 */
+	virtual bool ShouldBatchServerMoves() const;
+
+	/**
+	 * On the server, unpacks and handles all packed moves queued by ServerMovePacked_ServerReceive() since the last call, in the order they were received.
+	 * Called once per frame after the net drivers have dispatched incoming packets. The moves are wrapped in a single deferred movement scope when
+	 * bEnableScopedMovementUpdates is true, so overlap and transform updates are only done once for the whole batch.
+	 */
+	virtual void ServerProcessBatchedMoves();
+
 	/**
 	 * Determines whether to use packed movement RPCs with variable length payloads, or legacy code which has multiple functions required for different situations.
 	 * The default implementation checks the console variable "p.NetUsePackedMovementRPCs" and returns true if it is non-zero.
@@ -2505,6 +2520,15 @@ private:
 	/** Used for reading server move RPC bits. */
 	FNetBitReader ServerMoveBitReader;
 
+	/** Packed moves received on the server that are waiting for ServerProcessBatchedMoves(). */
+	TArray<FCharacterServerMovePackedBits> BatchedServerMovePackedBits;
+
+	/** Handle to the world PostTickDispatch delegate used to process BatchedServerMovePackedBits. */
+	FDelegateHandle BatchedServerMovesDelegateHandle;
+
+	/** Unpacks PackedBits into the network move data container and passes it to ServerMove_HandleMoveData(). */
+	void ServerUnpackAndHandleMove(const FCharacterServerMovePackedBits& PackedBits);
+
 	/** Current network move data being processed or handled within the NetworkMoveDataContainer. */
 	FCharacterNetworkMoveData* CurrentNetworkMoveData;
 
@@ -102,6 +102,8 @@ public:
 		, MovementBase(nullptr)
 		, MovementBaseBoneName(NAME_None)
 		, MovementMode(0)
+		, bUseCompactSerialization(false)
+		, CompactSerializationBaseMove(nullptr)
 	{
 	}
 	
@@ -123,6 +125,12 @@ public:
 	 */
 	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType);
 
+	/**
+	 * Serializes Acceleration, Location and ControlRotation using the compact encoding, when bUseCompactSerialization is set.
+	 * Called from Serialize(), and can be reused by derived structs overriding it.
+	 */
+	void SerializeCompactMotion(FArchive& Ar, UPackageMap* PackageMap, bool& bOutSuccess);
+
 	// Indicates whether this was the latest new move, a pending/dual move, or old important move.
 	ENetworkMoveType NetworkMoveType;
 
@@ -138,6 +146,15 @@ public:
 	class UPrimitiveComponent* MovementBase;
 	FName MovementBaseBoneName;
 	uint8 MovementMode;
+
+	//------------------------------------------------------------------------
+	// Serialization state, set by FCharacterNetworkMoveDataContainer::Serialize() before serializing this move.
+
+	// If true, Serialize() uses the compact encoding: zero acceleration and values matching CompactSerializationBaseMove are sent as single bits, and Location is only sent for the new move.
+	bool bUseCompactSerialization;
+
+	// Move already serialized in the same packet that this move can be encoded against. Null for the new move.
+	const FCharacterNetworkMoveData* CompactSerializationBaseMove;
 };
 
 
@@ -163,6 +180,7 @@ public:
 		, bIsDualHybridRootMotionMove(false)
 		, bHasOldMove(false)
 		, bDisableCombinedScopedMove(false)
+		, bUseCompactMoveSerialization(false)
 	{
 		NewMoveData		= &BaseDefaultMoveData[0];
 		PendingMoveData	= &BaseDefaultMoveData[1];
@@ -200,6 +218,9 @@ public:
 
 	// True if we want to disable a scoped move around both dual moves (optional from bEnableServerDualMoveScopedMovementUpdates), typically set if bForceNoCombine was true which can indicate an important change in moves.
 	bool bDisableCombinedScopedMove;
+
+	// True if moves are serialized with the compact encoding, set on the client from "p.NetPackedMovementCompactSerialization" and sent at the start of the stream.
+	bool bUseCompactMoveSerialization;
 	
 protected:
 
@@ -997,7 +997,8 @@ public:
 
 	/** 
 	 * Schedule an async save to a specific slot. UAsyncActionHandleSaveGame::AsyncSaveGameToSlot is the blueprint version of this.
-	 * This will do the serialize on the game thread, the platform-specific write on a worker thread, then call the complete delegate on the game thread.
+	 * This will copy the object on the game thread, serialize the copy and do the platform-specific write on a worker thread, then call the complete delegate on the game thread.
+	 * With SaveGame.AsyncSerializeOnWorker=0 the object itself is serialized on the game thread instead.
 	 * The passed in delegate will be copied to a worker thread so make sure any payload is thread safe to copy by value.
 	 *
 	 * @param SaveGameObject	Object that contains data about the save game that we want to write out.
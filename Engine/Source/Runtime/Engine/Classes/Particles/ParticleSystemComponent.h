@@ -334,6 +334,10 @@ class ENGINE_API UFXSystemComponent : public UPrimitiveComponent
 	GENERATED_UCLASS_BODY()
 public:
 
+	//~ Begin UActorComponent Interface
+	virtual bool IsCosmetic() const override { return true; }
+	//~ End UActorComponent Interface
+
 	/**Change a named boolean parameter, ParticleSystemComponent converts to float.*/
 	UFUNCTION(BlueprintCallable, Category = "Effects|Components|ParticleSystem")
 	virtual void SetBoolParameter(FName ParameterName, bool Param) {}
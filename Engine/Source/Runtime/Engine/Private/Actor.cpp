@@ -45,6 +45,7 @@
 #include "Engine/AutoDestroySubsystem.h"
 #include "LevelUtils.h"
 #include "GameFramework/InputSettings.h"
+#include "ProfilingDebugging/ClassCostProfiler.h"
 
 DEFINE_LOG_CATEGORY(LogActor);
 
@@ -169,6 +170,7 @@ void FActorTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType,
 		if (TickType != LEVELTICK_ViewportsOnly || Target->ShouldTickIfViewportsOnly())
 		{
 			FScopeCycleCounterUObject ActorScope(Target);
+			SCOPE_CLASS_COST(Tick, Target->GetClass());
 			Target->TickActor(DeltaTime*Target->CustomTimeDilation, TickType, *this);
 		}
 	}
@@ -327,7 +329,19 @@ void AActor::PostInitProperties()
 
 bool AActor::CanBeInCluster() const
 {
-	return bCanBeInCluster;
+	extern int32 GActorClusteringAutomatic;
+	if (bCanBeInCluster || !GActorClusteringAutomatic)
+	{
+		return bCanBeInCluster;
+	}
+
+	// Clustered actors aren't traced by GC, so only actors whose references can't change after load qualify automatically
+	return !bReplicates
+		&& !PrimaryActorTick.bCanEverTick
+		&& !GetClass()->HasAnyClassFlags(CLASS_CompiledFromBlueprint)
+		&& !IsChildActor()
+		&& RootComponent
+		&& RootComponent->Mobility == EComponentMobility::Static;
 }
 
 void AActor::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
@@ -4384,6 +4398,8 @@ bool AActor::CallRemoteFunction( UFunction* Function, void* Parameters, FOutParm
 
 void AActor::DispatchPhysicsCollisionHit(const FRigidBodyCollisionInfo& MyInfo, const FRigidBodyCollisionInfo& OtherInfo, const FCollisionImpactData& RigidCollisionData)
 {
+	SCOPE_CLASS_COST(Physics, GetClass());
+
 #if 0
 	if(true)
 	{
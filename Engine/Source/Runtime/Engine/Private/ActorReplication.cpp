@@ -7,6 +7,7 @@
 #include "Components/ActorComponent.h"
 #include "GameFramework/Actor.h"
 #include "Components/PrimitiveComponent.h"
+#include "Components/SnapshotInterpolationComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/Engine.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -227,7 +228,19 @@ void AActor::OnRep_ReplicatedMovement()
 #endif
 
 					PostNetReceiveVelocity(LocalRepMovement.LinearVelocity);
-					PostNetReceiveLocationAndRotation();
+
+					// Buffered and played back smoothly by the subsystem, instead of snapping to it now
+					USnapshotInterpolationComponent* Interpolation = FindComponentByClass<USnapshotInterpolationComponent>();
+					UWorld* World = GetWorld();
+					if (Interpolation && Interpolation->IsInterpolating() && World)
+					{
+						const FVector NewLocation = FRepMovement::RebaseOntoLocalOrigin(LocalRepMovement.Location, this);
+						Interpolation->AddSnapshot(NewLocation, LocalRepMovement.Rotation, LocalRepMovement.LinearVelocity, World->GetRealTimeSeconds());
+					}
+					else
+					{
+						PostNetReceiveLocationAndRotation();
+					}
 				}
 			}
 		}
@@ -4,9 +4,73 @@
 #include "Animation/AnimInstanceProxy.h"
 #include "AnimEncoding.h"
 #include "Animation/AnimTrace.h"
+#include "Animation/AnimSequence.h"
 
 #define LOCTEXT_NAMESPACE "AnimNode_SequencePlayer"
 
+TAutoConsoleVariable<float> CVarAnimSequencePlayerSharedPoseCacheRate(TEXT("a.AnimNode.SequencePlayer.SharedPoseCacheRate"), 0.f, TEXT("If > 0, sequence players sample their sequence at this many frames per second and share the extracted bone pose with every other player evaluating the same sequence, frame and required bones this frame. 0 disables the cache."));
+
+/** Per-frame cache of extracted sequence poses, shared between all sequence players */
+namespace SequencePlayerPoseCache
+{
+	struct FKey
+	{
+		const UAnimSequence* Sequence;
+		const UObject* Asset;
+		int32 Frame;
+		uint32 BoneIndicesHash;
+		bool bExtractRootMotion;
+		bool bUseRawData;
+		bool bDisableRetargeting;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Sequence == Other.Sequence && Asset == Other.Asset && Frame == Other.Frame && BoneIndicesHash == Other.BoneIndicesHash
+				&& bExtractRootMotion == Other.bExtractRootMotion && bUseRawData == Other.bUseRawData && bDisableRetargeting == Other.bDisableRetargeting;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Sequence), GetTypeHash(Key.Asset));
+			Hash = HashCombine(Hash, GetTypeHash(Key.Frame));
+			Hash = HashCombine(Hash, Key.BoneIndicesHash);
+			return HashCombine(Hash, (uint32)Key.bExtractRootMotion | ((uint32)Key.bUseRawData << 1) | ((uint32)Key.bDisableRetargeting << 2));
+		}
+	};
+
+	static FRWLock Lock;
+	static uint64 CacheFrameCounter = 0;
+	static TMap<FKey, TArray<FTransform>> Poses;
+
+	static bool Find(const FKey& Key, FCompactPose& OutPose)
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (CacheFrameCounter == GFrameCounter)
+		{
+			if (const TArray<FTransform>* Bones = Poses.Find(Key))
+			{
+				if (Bones->Num() == OutPose.GetNumBones())
+				{
+					OutPose.CopyBonesFrom(*Bones);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	static void Add(const FKey& Key, const FCompactPose& Pose)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (CacheFrameCounter != GFrameCounter)
+		{
+			Poses.Reset();
+			CacheFrameCounter = GFrameCounter;
+		}
+		Poses.Add(Key, TArray<FTransform>(Pose.GetBones()));
+	}
+}
+
 /////////////////////////////////////////////////////
 // FAnimSequencePlayerNode
 
@@ -101,7 +165,43 @@ void FAnimNode_SequencePlayer::Evaluate_AnyThread(FPoseContext& Output)
 		}
 
 		FAnimationPoseData AnimationPoseData(Output);
-		Sequence->GetAnimationPose(AnimationPoseData, FAnimExtractContext(InternalTimeAccumulator, Output.AnimInstanceProxy->ShouldExtractRootMotion()));
+
+		const float SharedPoseCacheRate = CVarAnimSequencePlayerSharedPoseCacheRate.GetValueOnAnyThread();
+		const UAnimSequence* AnimSequence = Cast<UAnimSequence>(Sequence);
+		if (SharedPoseCacheRate > 0.f && AnimSequence)
+		{
+			// Sample at the quantized time on both cache hits and misses so all sharing players get identical results
+			const FBoneContainer& RequiredBones = Output.Pose.GetBoneContainer();
+			const TArray<FBoneIndexType>& BoneIndices = RequiredBones.GetBoneIndicesArray();
+			const int32 Frame = FMath::RoundToInt(InternalTimeAccumulator * SharedPoseCacheRate);
+			const float SampleTime = FMath::Clamp((float)Frame / SharedPoseCacheRate, 0.f, AnimSequence->SequenceLength);
+			const FAnimExtractContext ExtractionContext(SampleTime, Output.AnimInstanceProxy->ShouldExtractRootMotion());
+
+			SequencePlayerPoseCache::FKey Key;
+			Key.Sequence = AnimSequence;
+			Key.Asset = RequiredBones.GetAsset();
+			Key.Frame = Frame;
+			Key.BoneIndicesHash = FCrc::MemCrc32(BoneIndices.GetData(), BoneIndices.Num() * BoneIndices.GetTypeSize());
+			Key.bExtractRootMotion = ExtractionContext.bExtractRootMotion;
+			Key.bUseRawData = AnimSequence->UseRawDataForPoseExtraction(RequiredBones);
+			Key.bDisableRetargeting = RequiredBones.GetDisableRetargeting();
+
+			if (SequencePlayerPoseCache::Find(Key, Output.Pose))
+			{
+				// Curves and attributes are cheap compared to bone extraction and index into per instance data, so always evaluate them
+				AnimSequence->EvaluateCurveData(Output.Curve, SampleTime, Key.bUseRawData);
+				AnimSequence->GetCustomAttributes(AnimationPoseData, ExtractionContext, Key.bUseRawData);
+			}
+			else
+			{
+				AnimSequence->GetAnimationPose(AnimationPoseData, ExtractionContext);
+				SequencePlayerPoseCache::Add(Key, Output.Pose);
+			}
+		}
+		else
+		{
+			Sequence->GetAnimationPose(AnimationPoseData, FAnimExtractContext(InternalTimeAccumulator, Output.AnimInstanceProxy->ShouldExtractRootMotion()));
+		}
 	}
 	else
 	{
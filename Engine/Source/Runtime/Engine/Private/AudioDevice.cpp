@@ -173,6 +173,14 @@ FAutoConsoleVariableRef CVarFlushAudioRenderThreadOnGC(
 	TEXT("When set to 1, every time the GC runs, we flush all pending audio render thread commands.\n"),
 	ECVF_Default);
 
+static float MinAudibleVolumeForNewSourcesCVar = 0.0f;
+FAutoConsoleVariableRef CVarMinAudibleVolumeForNewSources(
+	TEXT("au.MinAudibleVolumeForNewSources"),
+	MinAudibleVolumeForNewSourcesCVar,
+	TEXT("Wave instances whose attenuated volume is below this value do not create new sound sources until they become louder.\n")
+	TEXT("Sources already playing are unaffected. 0: Disabled"),
+	ECVF_Default);
+
 namespace AudioDeviceUtils
 {
 	using FVirtualLoopPair = TPair<FActiveSound*, FAudioVirtualLoop>;
@@ -4033,6 +4041,17 @@ void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 Fir
 		if (!WaveInstance->ShouldStopDueToMaxConcurrency() && (bGameTicking || WaveInstance->bIsUISound))
 		{
 			FSoundSource* Source = WaveInstanceSourceMap.FindRef(WaveInstance);
+
+			// Don't spend a source on a sound that would be inaudible anyway; it stays virtual until it gets louder
+			if (!Source && MinAudibleVolumeForNewSourcesCVar > 0.0f && WaveInstance->ActiveSound && !WaveInstance->ActiveSound->IsPlayWhenSilent())
+			{
+				const float AudibleVolume = WaveInstance->GetVolumeWithDistanceAttenuation() * WaveInstance->GetDynamicVolume();
+				if (AudibleVolume < MinAudibleVolumeForNewSourcesCVar)
+				{
+					continue;
+				}
+			}
+
 			if (!Source &&
 				(!WaveInstance->IsStreaming() ||
 				IStreamingManager::Get().GetAudioStreamingManager().CanCreateSoundSource(WaveInstance)))
@@ -4,7 +4,10 @@
 #include "ActiveSound.h"
 #include "Audio/AudioDebug.h"
 #include "AudioDevice.h"
+#include "ContentStreaming.h"
 #include "Sound/SoundBase.h"
+#include "Sound/SoundCue.h"
+#include "Sound/SoundWave.h"
 
 
 static int32 bVirtualLoopsEnabledCVar = 1;
@@ -42,12 +45,21 @@ FAutoConsoleVariableRef CVarVirtualLoopsUpdateRateMax(
 	TEXT("Sets maximum rate to check if sound becomes audible again (at beyond sound's max audible distance + perf scaling distance).\n"),
 	ECVF_Default);
 
+static float VirtualLoopsPrefetchDistanceCVar = 2500.0f;
+FAutoConsoleVariableRef CVarVirtualLoopsPrefetchDistance(
+	TEXT("au.VirtualLoops.PrefetchDistance"),
+	VirtualLoopsPrefetchDistanceCVar,
+	TEXT("Distance beyond a virtual loop's max audible distance at which the first streamed chunk of its sound is requested, so it is cached by the time the loop realizes.\n")
+	TEXT("0: Disabled, >0: Distance in unreal units"),
+	ECVF_Default);
+
 
 FAudioVirtualLoop::FAudioVirtualLoop()
 	: TimeSinceLastUpdate(0.0f)
 	, TimeVirtualized(0.0f)
 	, UpdateInterval(0.0f)
 	, ActiveSound(nullptr)
+	, bFirstChunkPrefetched(false)
 {
 }
 
@@ -221,6 +233,7 @@ bool FAudioVirtualLoop::Update(float DeltaTime, bool bForceUpdate)
 	// If not audible, update when will be checked again and return false
 	if (!IsInAudibleRange(*ActiveSound))
 	{
+		PrefetchFirstChunkIfNearby();
 		CalculateUpdateInterval();
 		return false;
 	}
@@ -228,6 +241,41 @@ bool FAudioVirtualLoop::Update(float DeltaTime, bool bForceUpdate)
 	return true;
 }
 
+void FAudioVirtualLoop::PrefetchFirstChunkIfNearby()
+{
+	check(ActiveSound);
+
+	if (bFirstChunkPrefetched || VirtualLoopsPrefetchDistanceCVar <= 0.0f)
+	{
+		return;
+	}
+
+	FAudioDevice* AudioDevice = ActiveSound->AudioDevice;
+	check(AudioDevice);
+
+	const float DistanceToListener = AudioDevice->GetDistanceToNearestListener(ActiveSound->Transform.GetLocation());
+	if (DistanceToListener > ActiveSound->MaxDistance + VirtualLoopsPrefetchDistanceCVar)
+	{
+		return;
+	}
+
+	// Only issue the request once per virtualization; the stream cache keeps the chunk around until it is evicted
+	bFirstChunkPrefetched = true;
+
+	USoundBase* Sound = ActiveSound->GetSound();
+	if (USoundCue* SoundCue = Cast<USoundCue>(Sound))
+	{
+		SoundCue->PrimeSoundCue();
+	}
+	else if (USoundWave* SoundWave = Cast<USoundWave>(Sound))
+	{
+		if (SoundWave->HasStreamingChunks() && SoundWave->GetNumChunks() > 1)
+		{
+			IStreamingManager::Get().GetAudioStreamingManager().RequestChunk(SoundWave, 1, [](EAudioChunkLoadResult) {});
+		}
+	}
+}
+
 bool FAudioVirtualLoop::ShouldListenerMoveForceUpdate(const FTransform& LastTransform, const FTransform& CurrentTransform)
 {
 	const float DistanceSq = FVector::DistSquared(LastTransform.GetTranslation(), CurrentTransform.GetTranslation());
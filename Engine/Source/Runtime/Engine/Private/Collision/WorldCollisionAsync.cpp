@@ -16,6 +16,7 @@
 #include "PhysicsEngine/BodyInstance.h"
 #include "Physics/PhysicsInterfaceCore.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "Async/ParallelFor.h"
 
 CSV_DEFINE_CATEGORY(WorldCollision, true);
 
@@ -49,6 +50,14 @@ namespace AsyncTraceCVars
 	{
 		return RunAsyncTraceOnWorkerThread != 0 && (FApp::ShouldUseThreadingForPerformance() || FForkProcessHelper::IsForkedMultithreadInstance());
 	}
+
+	static int32 BatchTraceChunkSize = 32;
+	static FAutoConsoleVariableRef CVarBatchTraceChunkSize(
+		TEXT("p.BatchTraceChunkSize"),
+		BatchTraceChunkSize,
+		TEXT("Number of spatially sorted traces run by a single task in UWorld::BatchTrace.\n")
+		TEXT("Traces run on the calling thread when worker threads are not used for async traces (see RunAsyncTraceOnWorkerThread)."),
+		ECVF_Default);
 }
 
 namespace
@@ -359,6 +368,75 @@ namespace
 	}
 }
 
+namespace BatchTraceHelpers
+{
+	/** Spreads lower 10 bits of Value so there are two zero bits between each of them */
+	FORCEINLINE uint32 SpreadBits3(uint32 Value)
+	{
+		Value &= 0x3ff;
+		Value = (Value | (Value << 16)) & 0x030000ff;
+		Value = (Value | (Value << 8)) & 0x0300f00f;
+		Value = (Value | (Value << 4)) & 0x030c30c3;
+		Value = (Value | (Value << 2)) & 0x09249249;
+		return Value;
+	}
+
+	/** Morton code of trace midpoint within Bounds, used to order traces so that nearby ones run one after another */
+	FORCEINLINE uint32 GetSortKey(const FTraceDatum& TraceData, const FBox& Bounds, const FVector& InvExtent)
+	{
+		const FVector Normalized = (((TraceData.Start + TraceData.End) * 0.5f) - Bounds.Min) * InvExtent;
+		const uint32 X = (uint32)FMath::Clamp(Normalized.X * 1023.f, 0.f, 1023.f);
+		const uint32 Y = (uint32)FMath::Clamp(Normalized.Y * 1023.f, 0.f, 1023.f);
+		const uint32 Z = (uint32)FMath::Clamp(Normalized.Z * 1023.f, 0.f, 1023.f);
+		return SpreadBits3(X) | (SpreadBits3(Y) << 1) | (SpreadBits3(Z) << 2);
+	}
+}
+
+void UWorld::BatchTrace(TArrayView<FTraceDatum> TraceData) const
+{
+	CSV_SCOPED_TIMING_STAT(WorldCollision, BatchTrace);
+
+	const int32 NumTraces = TraceData.Num();
+	if (NumTraces == 0)
+	{
+		return;
+	}
+
+	const int32 ChunkSize = FMath::Max(1, AsyncTraceCVars::BatchTraceChunkSize);
+	if (NumTraces <= ChunkSize || !AsyncTraceCVars::IsAsyncTraceOnWorkerThreads())
+	{
+		RunTraceTask(TraceData.GetData(), NumTraces);
+		return;
+	}
+
+	FBox Bounds(ForceInit);
+	for (const FTraceDatum& Datum : TraceData)
+	{
+		Bounds += (Datum.Start + Datum.End) * 0.5f;
+	}
+
+	const FVector Extent = Bounds.GetSize();
+	const FVector InvExtent(Extent.X > KINDA_SMALL_NUMBER ? 1.f / Extent.X : 0.f, Extent.Y > KINDA_SMALL_NUMBER ? 1.f / Extent.Y : 0.f, Extent.Z > KINDA_SMALL_NUMBER ? 1.f / Extent.Z : 0.f);
+
+	TArray<TPair<uint32, int32>> SortedTraces;
+	SortedTraces.Reserve(NumTraces);
+	for (int32 Index = 0; Index < NumTraces; ++Index)
+	{
+		SortedTraces.Add(TPair<uint32, int32>(BatchTraceHelpers::GetSortKey(TraceData[Index], Bounds, InvExtent), Index));
+	}
+	SortedTraces.Sort([](const TPair<uint32, int32>& A, const TPair<uint32, int32>& B) { return A.Key < B.Key; });
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumTraces, ChunkSize);
+	ParallelFor(NumChunks, [&TraceData, &SortedTraces, ChunkSize, NumTraces](int32 ChunkIndex)
+	{
+		const int32 EndIndex = FMath::Min((ChunkIndex + 1) * ChunkSize, NumTraces);
+		for (int32 Index = ChunkIndex * ChunkSize; Index < EndIndex; ++Index)
+		{
+			RunTraceTask(&TraceData[SortedTraces[Index].Value], 1);
+		}
+	});
+}
+
 FWorldAsyncTraceState::FWorldAsyncTraceState()
 	: CurrentFrame             (0)
 {
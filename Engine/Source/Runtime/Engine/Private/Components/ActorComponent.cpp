@@ -33,6 +33,7 @@
 #include "Net/Core/PushModel/PushModel.h"
 #include "UObject/FrameworkObjectVersion.h"
 #include "Async/ParallelFor.h"
+#include "ProfilingDebugging/ClassCostProfiler.h"
 
 #if WITH_EDITOR
 #include "Kismet2/ComponentEditorUtils.h"
@@ -69,6 +70,20 @@ FAutoConsoleVariableRef GTickComponentLatentActionsWithTheComponentCVar(
 	TEXT(" 0: Tick component latent actions later on in the frame (behavior prior to 4.16, provided for games relying on the old behavior but will be removed in the future)\n")
 	TEXT(" 1: Tick component latent actions at the same time as the component (default)"));
 
+int32 GTickComponentBatching = 1;
+FAutoConsoleVariableRef GTickComponentBatchingCVar(
+	TEXT("t.TickComponentBatching"),
+	GTickComponentBatching,
+	TEXT("If non-zero, components that return true from ShouldTickInBatch are ticked through a shared per-class tick function instead of their own. Takes effect when tick functions are next registered."));
+
+int32 GStripCosmeticComponents = 0;
+FAutoConsoleVariableRef GStripCosmeticComponentsCVar(
+	TEXT("server.StripCosmeticComponents"),
+	GStripCosmeticComponents,
+	TEXT("If non-zero, cosmetic components that don't replicate, such as lights, decals, particles and audio, are left out of server cooks and aren't created on dedicated servers. ")
+	TEXT("Set it in the [ConsoleVariables] section of DefaultEngine.ini so cooks and servers agree."),
+	ECVF_ReadOnly);
+
 /** Enable to log out all render state create, destroy and updatetransform events */
 #define LOG_RENDER_STATE 0
 
@@ -262,6 +277,8 @@ UActorComponent::UActorComponent(const FObjectInitializer& ObjectInitializer /*=
 
 	MarkedForEndOfFrameUpdateArrayIndex = INDEX_NONE;
 	UCSSerializationIndex = INDEX_NONE;
+	TickBatch = nullptr;
+	TickBatchIndex = INDEX_NONE;
 
 	CreationMethod = EComponentCreationMethod::Native;
 
@@ -677,7 +694,37 @@ bool UActorComponent::NeedsLoadForServer() const
 	check(GetOuter());
 	// For Component Blueprints, avoid calling into the class to avoid recursion
 	bool bNeedsLoadOuter = HasAnyFlags(RF_ClassDefaultObject) || GetOuter()->NeedsLoadForServer();
-	return (!IsEditorOnly() && bNeedsLoadOuter && Super::NeedsLoadForServer());
+	// The class default object is kept so the class itself stays usable
+	bool bStripped = !HasAnyFlags(RF_ClassDefaultObject) && CanStripForServer();
+	return (!IsEditorOnly() && !bStripped && bNeedsLoadOuter && Super::NeedsLoadForServer());
+}
+
+bool UActorComponent::CanStripForServer() const
+{
+	if (!GStripCosmeticComponents || !IsCosmetic() || GetIsReplicated())
+	{
+		return false;
+	}
+
+	// Class default objects don't have attachments, and their outer is the whole script package
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return true;
+	}
+
+	// Components attached to this one would lose their parent, so it's only stripped when they can be stripped as well.
+	// Construction script templates aren't attached to each other, USCS_Node moves their children up instead.
+	bool bHasKeptChildren = false;
+	ForEachObjectWithOuter(GetOuter(), [this, &bHasKeptChildren](UObject* Object)
+	{
+		const USceneComponent* Sibling = Cast<USceneComponent>(Object);
+		if (!bHasKeptChildren && Sibling && Sibling->GetAttachParent() == this && !Sibling->CanStripForServer())
+		{
+			bHasKeptChildren = true;
+		}
+	}, false);
+
+	return !bHasKeptChildren;
 }
 
 bool UActorComponent::NeedsLoadForEditorGame() const
@@ -1009,6 +1056,8 @@ void FActorComponentTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick T
 {
 	ExecuteTickHelper(Target, Target->bTickInEditor, DeltaTime, TickType, [this, TickType](float DilatedTime)
 	{
+		AActor* Owner = Target->GetOwner();
+		SCOPE_CLASS_COST(Tick, Owner ? Owner->GetClass() : Target->GetClass());
 		Target->TickComponent(DilatedTime, TickType, this);
 	});
 }
@@ -1034,6 +1083,101 @@ FName FActorComponentTickFunction::DiagnosticContext(bool bDetailed)
 	}
 }
 
+/** Identifies the tick batch a component belongs to. Components only share a batch if their primary tick functions would have been scheduled identically */
+struct FActorComponentTickBatchKey
+{
+	ULevel* Level;
+	UClass* Class;
+	ETickingGroup TickGroup;
+	ETickingGroup EndTickGroup;
+	bool bTickEvenWhenPaused;
+	bool bRunOnAnyThread;
+
+	FActorComponentTickBatchKey(ULevel* InLevel, const UActorComponent* Component)
+		: Level(InLevel)
+		, Class(Component->GetClass())
+		, TickGroup(Component->PrimaryComponentTick.TickGroup)
+		, EndTickGroup(Component->PrimaryComponentTick.EndTickGroup)
+		, bTickEvenWhenPaused(Component->PrimaryComponentTick.bTickEvenWhenPaused)
+		, bRunOnAnyThread(Component->PrimaryComponentTick.bRunOnAnyThread)
+	{
+	}
+
+	bool operator==(const FActorComponentTickBatchKey& Other) const
+	{
+		return Level == Other.Level && Class == Other.Class && TickGroup == Other.TickGroup && EndTickGroup == Other.EndTickGroup
+			&& bTickEvenWhenPaused == Other.bTickEvenWhenPaused && bRunOnAnyThread == Other.bRunOnAnyThread;
+	}
+
+	friend uint32 GetTypeHash(const FActorComponentTickBatchKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.Level), GetTypeHash(Key.Class));
+		return HashCombine(Hash, (uint32)Key.TickGroup | ((uint32)Key.EndTickGroup << 8) | ((uint32)Key.bTickEvenWhenPaused << 16) | ((uint32)Key.bRunOnAnyThread << 17));
+	}
+};
+
+/** All live tick batches. Only accessed on the game thread, when tick functions are registered and unregistered */
+static TMap<FActorComponentTickBatchKey, TUniquePtr<FActorComponentTickBatchFunction>> GActorComponentTickBatches;
+
+void FActorComponentTickBatchFunction::AddTarget(UActorComponent* Target)
+{
+	check(Target->TickBatch == nullptr);
+	Target->TickBatch = this;
+	Target->TickBatchIndex = Targets.Add(Target);
+}
+
+void FActorComponentTickBatchFunction::RemoveTarget(UActorComponent* Target)
+{
+	check(Target->TickBatch == this && Targets.IsValidIndex(Target->TickBatchIndex) && Targets[Target->TickBatchIndex] == Target);
+	const int32 Index = Target->TickBatchIndex;
+	Targets.RemoveAtSwap(Index, 1, false);
+	if (Targets.IsValidIndex(Index))
+	{
+		Targets[Index]->TickBatchIndex = Index;
+	}
+	Target->TickBatch = nullptr;
+	Target->TickBatchIndex = INDEX_NONE;
+}
+
+void FActorComponentTickBatchFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	auto TickTarget = [DeltaTime, TickType](UActorComponent* Target)
+	{
+		if (Target->PrimaryComponentTick.IsTickFunctionEnabled())
+		{
+			FActorComponentTickFunction::ExecuteTickHelper(Target, Target->bTickInEditor, DeltaTime, TickType, [Target, TickType](float DilatedTime)
+			{
+				Target->TickComponent(DilatedTime, TickType, &Target->PrimaryComponentTick);
+			});
+		}
+	};
+
+	if (bParallelTick)
+	{
+		ParallelFor(Targets.Num(), [this, &TickTarget](int32 Index)
+		{
+			TickTarget(Targets[Index]);
+		});
+	}
+	else
+	{
+		for (UActorComponent* Target : Targets)
+		{
+			TickTarget(Target);
+		}
+	}
+}
+
+FString FActorComponentTickBatchFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("%s[TickComponentBatch %d]"), *GetNameSafe(TargetClass), Targets.Num());
+}
+
+FName FActorComponentTickBatchFunction::DiagnosticContext(bool bDetailed)
+{
+	return TargetClass ? TargetClass->GetFName() : NAME_None;
+}
+
 
 bool UActorComponent::SetupActorComponentTickFunction(struct FTickFunction* TickFunction)
 {
@@ -1100,7 +1244,12 @@ void UActorComponent::RegisterComponentTickFunctions(bool bRegister)
 {
 	if(bRegister)
 	{
-		if (SetupActorComponentTickFunction(&PrimaryComponentTick))
+		if (GTickComponentBatching && ShouldTickInBatch() && PrimaryComponentTick.bCanEverTick && !IsTemplate()
+			&& PrimaryComponentTick.TickInterval <= 0.f && PrimaryComponentTick.GetPrerequisites().Num() == 0)
+		{
+			AddToTickBatch();
+		}
+		else if (SetupActorComponentTickFunction(&PrimaryComponentTick))
 		{
 			PrimaryComponentTick.Target = this;
 		}
@@ -1111,11 +1260,67 @@ void UActorComponent::RegisterComponentTickFunctions(bool bRegister)
 		{
 			PrimaryComponentTick.UnRegisterTickFunction();
 		}
+		if (TickBatch)
+		{
+			RemoveFromTickBatch();
+		}
 	}
 
 	GTestRegisterComponentTickFunctions = this; // we will verify the super call chain is intact. Don't not copy paste this to a derived class!
 }
 
+void UActorComponent::AddToTickBatch()
+{
+	check(IsInGameThread() && TickBatch == nullptr);
+
+	AActor* MyOwner = GetOwner();
+	if (MyOwner && MyOwner->IsTemplate())
+	{
+		return;
+	}
+
+	ULevel* ComponentLevel = (MyOwner ? MyOwner->GetLevel() : GetWorld()->PersistentLevel);
+	const FActorComponentTickBatchKey Key(ComponentLevel, this);
+
+	TUniquePtr<FActorComponentTickBatchFunction>& Batch = GActorComponentTickBatches.FindOrAdd(Key);
+	if (!Batch.IsValid())
+	{
+		Batch = MakeUnique<FActorComponentTickBatchFunction>();
+		Batch->TargetClass = Key.Class;
+		Batch->TickGroup = Key.TickGroup;
+		Batch->EndTickGroup = Key.EndTickGroup;
+		Batch->bTickEvenWhenPaused = Key.bTickEvenWhenPaused;
+		Batch->bParallelTick = Key.bRunOnAnyThread;
+		Batch->bCanEverTick = true;
+		Batch->RegisterTickFunction(ComponentLevel);
+	}
+
+	PrimaryComponentTick.SetTickFunctionEnable(PrimaryComponentTick.bStartWithTickEnabled || PrimaryComponentTick.IsTickFunctionEnabled());
+	PrimaryComponentTick.Target = this;
+	Batch->AddTarget(this);
+}
+
+void UActorComponent::RemoveFromTickBatch()
+{
+	check(IsInGameThread() && TickBatch != nullptr);
+
+	FActorComponentTickBatchFunction* Batch = TickBatch;
+	Batch->RemoveTarget(this);
+
+	if (Batch->Targets.Num() == 0)
+	{
+		for (auto It = GActorComponentTickBatches.CreateIterator(); It; ++It)
+		{
+			if (It.Value().Get() == Batch)
+			{
+				// The tick function unregisters itself on destruction
+				It.RemoveCurrent();
+				break;
+			}
+		}
+	}
+}
+
 void UActorComponent::RegisterAllComponentTickFunctions(bool bRegister)
 {
 	check(GTestRegisterComponentTickFunctions == NULL);
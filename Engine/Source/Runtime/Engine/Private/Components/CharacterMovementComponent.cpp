@@ -31,6 +31,7 @@
 
 #include "Net/PerfCountersHelpers.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/ClassCostProfiler.h"
 
 CSV_DEFINE_CATEGORY(CharacterMovement, true);
 
@@ -114,6 +115,24 @@ namespace CharacterMovementCVars
 		TEXT("Max number of bits allowed in each packed movement RPC. Used to protect against bad data causing the server to allocate too much memory.\n"),
 		ECVF_Default);
 
+	static int32 NetPackedMovementCompactSerialization = 0;
+	FAutoConsoleVariableRef CVarNetPackedMovementCompactSerialization(
+		TEXT("p.NetPackedMovementCompactSerialization"),
+		NetPackedMovementCompactSerialization,
+		TEXT("Whether clients use the compact encoding for packed movement RPCs. Zero acceleration and pending/old move acceleration and rotation matching the new move are sent as single bits,\n")
+		TEXT("and location is only sent for the new move since it is only used for error checking. The server reads the encoding from the stream, so this only needs to be set on clients.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static int32 NetServerBatchPackedMoves = 0;
+	FAutoConsoleVariableRef CVarNetServerBatchPackedMoves(
+		TEXT("p.NetServerBatchPackedMoves"),
+		NetServerBatchPackedMoves,
+		TEXT("If enabled, packed movement RPCs received on the server are queued per character and processed together once per frame, after all incoming packets are dispatched.\n")
+		TEXT("Moves in a batch share one deferred movement scope (if bEnableScopedMovementUpdates is true), so overlaps and attached component updates are only processed once per batch.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
 	// Listen server smoothing
 	static int32 NetEnableListenServerSmoothing = 1;
 	FAutoConsoleVariableRef CVarNetEnableListenServerSmoothing(
@@ -711,6 +730,7 @@ void UCharacterMovementComponent::Deactivate()
 	Super::Deactivate();
 	if (!IsActive())
 	{
+		BatchedServerMovePackedBits.Reset();
 		ClearAccumulatedForces();
 		if (CharacterOwner)
 		{
@@ -720,6 +740,21 @@ void UCharacterMovementComponent::Deactivate()
 	bStopMovementAbortPaths = true;
 }
 
+void UCharacterMovementComponent::OnUnregister()
+{
+	BatchedServerMovePackedBits.Empty();
+	if (BatchedServerMovesDelegateHandle.IsValid())
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->PostTickDispatchEvent.Remove(BatchedServerMovesDelegateHandle);
+		}
+		BatchedServerMovesDelegateHandle.Reset();
+	}
+
+	Super::OnUnregister();
+}
+
 
 void UCharacterMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
 {
@@ -1294,6 +1329,7 @@ void UCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick
 	SCOPE_CYCLE_COUNTER(STAT_CharacterMovement);
 	SCOPE_CYCLE_COUNTER(STAT_CharacterMovementTick);
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(CharacterMovement);
+	SCOPE_CLASS_COST(Movement, GetOwner() ? GetOwner()->GetClass() : nullptr);
 	const FVector InputVector = ConsumeInputVector();
 	if (!HasValidData() || ShouldSkipUpdate(DeltaTime))
 	{
@@ -8826,6 +8862,7 @@ bool FCharacterNetworkSerializationPackedBits::NetSerialize(FArchive& Ar, class
 void FCharacterNetworkMoveDataContainer::ClientFillNetworkMoveData(const FSavedMove_Character* ClientNewMove, const FSavedMove_Character* ClientPendingMove, const FSavedMove_Character* ClientOldMove)
 {
 	bDisableCombinedScopedMove = false;
+	bUseCompactMoveSerialization = (CharacterMovementCVars::NetPackedMovementCompactSerialization != 0);
 
 	if (ensure(ClientNewMove))
 	{
@@ -8858,6 +8895,15 @@ bool FCharacterNetworkMoveDataContainer::Serialize(UCharacterMovementComponent&
 	// We must have data storage initialized. If not, then the storage container wasn't properly initialized.
 	check(NewMoveData && PendingMoveData && OldMoveData);
 
+	// Encoding used for all moves. The new move is serialized first, so the other moves can be encoded against it.
+	Ar.SerializeBits(&bUseCompactMoveSerialization, 1);
+	NewMoveData->bUseCompactSerialization = bUseCompactMoveSerialization;
+	NewMoveData->CompactSerializationBaseMove = nullptr;
+	PendingMoveData->bUseCompactSerialization = bUseCompactMoveSerialization;
+	PendingMoveData->CompactSerializationBaseMove = NewMoveData;
+	OldMoveData->bUseCompactSerialization = bUseCompactMoveSerialization;
+	OldMoveData->CompactSerializationBaseMove = NewMoveData;
+
 	// Base move always serialized.
 	if (!NewMoveData->Serialize(CharacterMovement, Ar, PackageMap, FCharacterNetworkMoveData::ENetworkMoveType::NewMove))
 	{
@@ -8931,13 +8977,20 @@ bool FCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Character
 
 	Ar << TimeStamp;
 
-	// TODO: better packing with single bit per component indicating zero/non-zero
-	Acceleration.NetSerialize(Ar, PackageMap, bLocalSuccess);
+	if (bUseCompactSerialization)
+	{
+		SerializeCompactMotion(Ar, PackageMap, bLocalSuccess);
+	}
+	else
+	{
+		// TODO: better packing with single bit per component indicating zero/non-zero
+		Acceleration.NetSerialize(Ar, PackageMap, bLocalSuccess);
 
-	Location.NetSerialize(Ar, PackageMap, bLocalSuccess);
+		Location.NetSerialize(Ar, PackageMap, bLocalSuccess);
 
-	// ControlRotation : FRotator handles each component zero/non-zero test; it uses a single signal bit for zero/non-zero, and uses 16 bits per component if non-zero.
-	ControlRotation.NetSerialize(Ar, PackageMap, bLocalSuccess);
+		// ControlRotation : FRotator handles each component zero/non-zero test; it uses a single signal bit for zero/non-zero, and uses 16 bits per component if non-zero.
+		ControlRotation.NetSerialize(Ar, PackageMap, bLocalSuccess);
+	}
 
 	SerializeOptionalValue<uint8>(bIsSaving, Ar, CompressedMoveFlags, 0);
 
@@ -8953,6 +9006,70 @@ bool FCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Character
 }
 
 
+void FCharacterNetworkMoveData::SerializeCompactMotion(FArchive& Ar, UPackageMap* PackageMap, bool& bOutSuccess)
+{
+	const bool bIsSaving = Ar.IsSaving();
+	const FCharacterNetworkMoveData* BaseMove = CompactSerializationBaseMove;
+
+	// Acceleration: same as the base move, zero, or the full quantized vector.
+	bool bSameAccelAsBase = bIsSaving && BaseMove && (Acceleration == BaseMove->Acceleration);
+	if (BaseMove)
+	{
+		Ar.SerializeBits(&bSameAccelAsBase, 1);
+	}
+
+	if (bSameAccelAsBase)
+	{
+		if (!bIsSaving)
+		{
+			Acceleration = BaseMove->Acceleration;
+		}
+	}
+	else
+	{
+		bool bZeroAccel = bIsSaving && Acceleration.IsZero();
+		Ar.SerializeBits(&bZeroAccel, 1);
+		if (bZeroAccel)
+		{
+			Acceleration = FVector::ZeroVector;
+		}
+		else
+		{
+			Acceleration.NetSerialize(Ar, PackageMap, bOutSuccess);
+		}
+	}
+
+	// Location is only used for error checking on the new move.
+	if (NetworkMoveType == ENetworkMoveType::NewMove)
+	{
+		Location.NetSerialize(Ar, PackageMap, bOutSuccess);
+	}
+	else if (!bIsSaving)
+	{
+		Location = BaseMove ? BaseMove->Location : FVector::ZeroVector;
+	}
+
+	// ControlRotation: same as the base move, or the usual FRotator packing.
+	bool bSameRotationAsBase = bIsSaving && BaseMove && (ControlRotation == BaseMove->ControlRotation);
+	if (BaseMove)
+	{
+		Ar.SerializeBits(&bSameRotationAsBase, 1);
+	}
+
+	if (bSameRotationAsBase)
+	{
+		if (!bIsSaving)
+		{
+			ControlRotation = BaseMove->ControlRotation;
+		}
+	}
+	else
+	{
+		ControlRotation.NetSerialize(Ar, PackageMap, bOutSuccess);
+	}
+}
+
+
 void UCharacterMovementComponent::ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits)
 {
 	// Pass through RPC call to character on server, there is less RPC bandwidth overhead when used on an Actor rather than a Component.
@@ -8974,6 +9091,77 @@ void UCharacterMovementComponent::ServerMovePacked_ServerReceive(const FCharacte
 		return;
 	}
 
+	if (ShouldBatchServerMoves())
+	{
+		if (!BatchedServerMovesDelegateHandle.IsValid())
+		{
+			if (UWorld* World = GetWorld())
+			{
+				BatchedServerMovesDelegateHandle = World->PostTickDispatchEvent.AddUObject(this, &UCharacterMovementComponent::ServerProcessBatchedMoves);
+			}
+		}
+
+		if (BatchedServerMovesDelegateHandle.IsValid())
+		{
+			// Processed with any other moves received this frame in ServerProcessBatchedMoves().
+			BatchedServerMovePackedBits.Add(PackedBits);
+			return;
+		}
+	}
+
+	ServerUnpackAndHandleMove(PackedBits);
+}
+
+bool UCharacterMovementComponent::ShouldBatchServerMoves() const
+{
+	if (CharacterMovementCVars::NetServerBatchPackedMoves == 0)
+	{
+		return false;
+	}
+
+	const ENetMode NetMode = GetNetMode();
+	return NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+}
+
+void UCharacterMovementComponent::ServerProcessBatchedMoves()
+{
+	if (BatchedServerMovePackedBits.Num() == 0)
+	{
+		return;
+	}
+
+	if (!HasValidData() || !IsActive())
+	{
+		BatchedServerMovePackedBits.Reset();
+		return;
+	}
+
+	// The package map was saved when the RPC was received. Only use it if it still belongs to the owning connection.
+	UNetConnection* NetConnection = CharacterOwner->GetNetConnection();
+	UPackageMap* ConnectionPackageMap = NetConnection ? NetConnection->PackageMap : nullptr;
+
+	// Defer component updates and overlaps until all moves received this frame are done.
+	FScopedMovementUpdate ScopedMovementUpdate(UpdatedComponent, bEnableScopedMovementUpdates ? EScopedUpdate::DeferredUpdates : EScopedUpdate::ImmediateUpdates);
+
+	// Moves are processed in order, and handling a move can't queue more, but take ownership in case a move triggers unregistration.
+	TArray<FCharacterServerMovePackedBits> PackedMoves = MoveTemp(BatchedServerMovePackedBits);
+	BatchedServerMovePackedBits.Reset();
+
+	for (const FCharacterServerMovePackedBits& PackedBits : PackedMoves)
+	{
+		if (PackedBits.GetPackageMap() != ConnectionPackageMap || !HasValidData())
+		{
+			continue;
+		}
+
+		ServerUnpackAndHandleMove(PackedBits);
+	}
+}
+
+void UCharacterMovementComponent::ServerUnpackAndHandleMove(const FCharacterServerMovePackedBits& PackedBits)
+{
+	const int32 NumBits = PackedBits.DataBits.Num();
+
 	// Reuse bit reader to avoid allocating memory each time.
 	ServerMoveBitReader.SetData((uint8*)PackedBits.DataBits.GetData(), NumBits);
 	ServerMoveBitReader.PackageMap = PackedBits.GetPackageMap();
@@ -9499,6 +9687,9 @@ void UCharacterMovementComponent::MoveAutonomous
 		return;
 	}
 
+	// Client moves replayed by the server, which run from the ServerMove RPCs rather than the tick
+	SCOPE_CLASS_COST(Movement, CharacterOwner->GetClass());
+
 	UpdateFromCompressedFlags(CompressedFlags);
 	CharacterOwner->CheckJumpInput(DeltaTime);
 
@@ -34,6 +34,7 @@
 #include "UObject/RenderingObjectVersion.h"
 #include "UObject/FortniteMainBranchObjectVersion.h"
 #include "EngineModule.h"
+#include "UObject/ObjectKey.h"
 
 #if WITH_EDITOR
 #include "Engine/LODActor.h"
@@ -68,6 +69,22 @@ static FAutoConsoleVariableRef CVarAllowCachedOverlaps(
 	TEXT("0: disable cached overlaps, 1: enable (default)"),
 	ECVF_Default);
 
+static int32 GDeferOverlapUpdates = 1;
+static FAutoConsoleVariableRef CVarDeferOverlapUpdates(
+	TEXT("p.DeferOverlapUpdates"),
+	GDeferOverlapUpdates,
+	TEXT("Whether components with bDeferOverlapUpdates update their overlaps at the end of the tick group rather than on every move."),
+	ECVF_Default);
+
+namespace DeferredOverlaps
+{
+	/** Components that moved since their overlaps were last updated, game thread only */
+	static TMap<FObjectKey, TWeakObjectPtr<UPrimitiveComponent>> PendingUpdates;
+
+	/** Overlaps are updated right away while flushing */
+	static bool bIsFlushing = false;
+}
+
 static float InitialOverlapToleranceCVar = 0.0f;
 static FAutoConsoleVariableRef CVarInitialOverlapTolerance(
 	TEXT("p.InitialOverlapTolerance"),
@@ -107,6 +124,7 @@ static FAutoConsoleVariableRef CVarEnableFastOverlapCheck(TEXT("p.EnableFastOver
 DECLARE_CYCLE_STAT(TEXT("MoveComponent FastOverlap"), STAT_MoveComponent_FastOverlap, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("BeginComponentOverlap"), STAT_BeginComponentOverlap, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("EndComponentOverlap"), STAT_EndComponentOverlap, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("FlushDeferredOverlapUpdates"), STAT_FlushDeferredOverlapUpdates, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("PrimComp DispatchBlockingHit"), STAT_DispatchBlockingHit, STATGROUP_Game);
 
 
@@ -362,6 +380,7 @@ UPrimitiveComponent::UPrimitiveComponent(const FObjectInitializer& ObjectInitial
 
 	SetGenerateOverlapEvents(true);
 	bMultiBodyOverlap = false;
+	bDeferOverlapUpdates = false;
 	bReturnMaterialOnMove = false;
 	bCanEverAffectNavigation = false;
 	bNavigationRelevant = false;
@@ -2360,6 +2379,11 @@ bool UPrimitiveComponent::MoveComponentImpl( const FVector& Delta, const FQuat&
 				ScopedUpdate->AppendOverlapsAfterMove(PendingOverlaps, bSweep, bIncludesOverlapsAtEnd);
 			}
 		}
+		else if (bDeferOverlapUpdates && GDeferOverlapUpdates && PendingOverlaps.Num() == 0 && !DeferredOverlaps::bIsFlushing && IsInGameThread())
+		{
+			// Moving again before the flush costs nothing more, the overlaps are only queried at the final location
+			DeferredOverlaps::PendingUpdates.Add(FObjectKey(this), this);
+		}
 		else
 		{
 			if (bIncludesOverlapsAtEnd)
@@ -3365,6 +3389,37 @@ bool UPrimitiveComponent::UpdateOverlapsImpl(const TOverlapArrayView* NewPending
 	return bCanSkipUpdateOverlaps;
 }
 
+void UPrimitiveComponent::FlushDeferredOverlapUpdates()
+{
+	using namespace DeferredOverlaps;
+
+	if (PendingUpdates.Num() == 0 || bIsFlushing)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlushDeferredOverlapUpdates);
+	check(IsInGameThread());
+
+	TGuardValue<bool> FlushingGuard(bIsFlushing, true);
+
+	// Overlap events moving other deferred components only add to the next round
+	while (PendingUpdates.Num() > 0)
+	{
+		TMap<FObjectKey, TWeakObjectPtr<UPrimitiveComponent>> Updates = MoveTemp(PendingUpdates);
+		PendingUpdates.Reset();
+
+		for (const TPair<FObjectKey, TWeakObjectPtr<UPrimitiveComponent>>& Update : Updates)
+		{
+			UPrimitiveComponent* Component = Update.Value.Get();
+			if (Component && !Component->IsPendingKill())
+			{
+				Component->UpdateOverlaps(nullptr, true, nullptr);
+			}
+		}
+	}
+}
+
 bool RequiresUpdateOverlaps(bool bGenerateOverlapEvents)
 {
 	return bGenerateOverlapEvents;
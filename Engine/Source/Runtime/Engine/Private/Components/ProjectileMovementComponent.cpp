@@ -7,6 +7,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "GameFramework/WorldSettings.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/ClassCostProfiler.h"
 
 CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, Basic);
 DEFINE_LOG_CATEGORY_STATIC(LogProjectileMovement, Log, All);
@@ -132,6 +133,7 @@ void UProjectileMovementComponent::TickComponent(float DeltaTime, enum ELevelTic
 {
 	QUICK_SCOPE_CYCLE_COUNTER( STAT_ProjectileMovementComponent_TickComponent );
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(ProjectileMovement);
+	SCOPE_CLASS_COST(Movement, GetOwner() ? GetOwner()->GetClass() : nullptr);
 
 	// Still need to finish interpolating after we've stopped simulating, so do that first.
 	if (bInterpMovement && !bInterpolationComplete)
@@ -28,6 +28,7 @@
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Components/ChildActorComponent.h"
 #include "UObject/UObjectThreadContext.h"
+#include "UObject/ObjectKey.h"
 #include "Engine/SCS_Node.h"
 #include "EngineGlobals.h"
 #include "DeviceProfiles/DeviceProfileManager.h"
@@ -53,11 +54,34 @@ DEFINE_LOG_CATEGORY_STATIC(LogSceneComponent, Log, All);
 
 DECLARE_CYCLE_STAT(TEXT("UpdateComponentToWorld"), STAT_UpdateComponentToWorld, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("UpdateChildTransforms"), STAT_UpdateChildTransforms, STATGROUP_Component);
+DECLARE_CYCLE_STAT(TEXT("FlushDeferredChildTransformUpdates"), STAT_FlushDeferredChildTransformUpdates, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component CalcBounds"), STAT_ComponentCalcBounds, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component UpdateNavData"), STAT_ComponentUpdateNavData, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component PostUpdateNavData"), STAT_ComponentPostUpdateNavData, STATGROUP_Component);
 
 
+static int32 GDeferChildTransformUpdates = 1;
+static FAutoConsoleVariableRef CVarDeferChildTransformUpdates(
+	TEXT("s.DeferChildTransformUpdates"),
+	GDeferChildTransformUpdates,
+	TEXT("Whether components with bDeferChildTransformUpdates update their children at the end of the tick group rather than on every move."));
+
+namespace DeferredChildTransforms
+{
+	struct FPendingUpdate
+	{
+		TWeakObjectPtr<USceneComponent> Component;
+		EUpdateTransformFlags UpdateTransformFlags = EUpdateTransformFlags::None;
+		ETeleportType Teleport = ETeleportType::None;
+	};
+
+	/** Components whose children are waiting for an update, game thread only */
+	static TMap<FObjectKey, FPendingUpdate> PendingUpdates;
+
+	/** Children are updated right away while flushing */
+	static bool bIsFlushing = false;
+}
+
 FOverlapInfo::FOverlapInfo(UPrimitiveComponent* InComponent, int32 InBodyIndex)
 	: bFromSweep(false)
 {
@@ -771,7 +795,18 @@ void USceneComponent::PropagateTransformUpdate(bool bTransformChanged, EUpdateTr
 			if (AttachedChildren.Num() > 0)
 			{
 				EUpdateTransformFlags ChildrenFlagNoPhysics = ~EUpdateTransformFlags::SkipPhysicsUpdate & UpdateTransformFlags;
-				UpdateChildTransforms(ChildrenFlagNoPhysics, Teleport);
+				if (bDeferChildTransformUpdates && GDeferChildTransformUpdates && !DeferredChildTransforms::bIsFlushing && IsInGameThread())
+				{
+					// Moving again before the flush only keeps the strongest teleport, the children go straight to the final transform
+					DeferredChildTransforms::FPendingUpdate& Pending = DeferredChildTransforms::PendingUpdates.FindOrAdd(FObjectKey(this));
+					Pending.Component = this;
+					Pending.UpdateTransformFlags = ChildrenFlagNoPhysics;
+					Pending.Teleport = FMath::Max(Pending.Teleport, Teleport);
+				}
+				else
+				{
+					UpdateChildTransforms(ChildrenFlagNoPhysics, Teleport);
+				}
 			}
 		}
 
@@ -1211,8 +1246,13 @@ void USceneComponent::UpdateBounds()
 	else
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ComponentCalcBounds);
-		// Calculate new bounds
-		Bounds = CalcBounds(GetComponentTransform());
+		// Static components of cooked levels come with their bounds for the first registration
+		ULevel* ComponentLevel = Mobility == EComponentMobility::Static ? GetComponentLevel() : nullptr;
+		if (ComponentLevel == nullptr || !ComponentLevel->ConsumePrecomputedBounds(*this, Bounds))
+		{
+			// Calculate new bounds
+			Bounds = CalcBounds(GetComponentTransform());
+		}
 	}
 
 
@@ -2351,6 +2391,36 @@ TStructOnScope<FActorComponentInstanceData> USceneComponent::GetComponentInstanc
 	return MakeStructOnScope<FActorComponentInstanceData, FSceneComponentInstanceData>(this);;
 }
 
+void USceneComponent::FlushDeferredChildTransformUpdates()
+{
+	using namespace DeferredChildTransforms;
+
+	if (PendingUpdates.Num() == 0 || bIsFlushing)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlushDeferredChildTransformUpdates);
+	check(IsInGameThread());
+
+	TGuardValue<bool> FlushingGuard(bIsFlushing, true);
+
+	// Children moving other deferred components while updating only add to the next round
+	while (PendingUpdates.Num() > 0)
+	{
+		TMap<FObjectKey, FPendingUpdate> Updates = MoveTemp(PendingUpdates);
+		PendingUpdates.Reset();
+
+		for (const TPair<FObjectKey, FPendingUpdate>& Update : Updates)
+		{
+			if (USceneComponent* Component = Update.Value.Component.Get())
+			{
+				Component->UpdateChildTransforms(Update.Value.UpdateTransformFlags, Update.Value.Teleport);
+			}
+		}
+	}
+}
+
 void USceneComponent::UpdateChildTransforms(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateChildTransforms);
@@ -51,6 +51,11 @@ TAutoConsoleVariable<int32> CVarUseParallelAnimUpdate(TEXT("a.ParallelAnimUpdate
 TAutoConsoleVariable<int32> CVarForceUseParallelAnimUpdate(TEXT("a.ForceParallelAnimUpdate"), 0, TEXT("If != 0, then we update animations on worker threads regardless of the setting on the project or anim blueprint."));
 TAutoConsoleVariable<int32> CVarUseParallelAnimationInterpolation(TEXT("a.ParallelAnimInterpolation"), 1, TEXT("If 1, animation interpolation will be run across the task graph system. If 0, interpolation will run purely on the game thread"));
 
+static TAutoConsoleVariable<int32> CVarDedicatedServerRequiredBonesOnly(
+	TEXT("a.DedicatedServerRequiredBonesOnly"),
+	0,
+	TEXT("If 1, skeletal meshes on a dedicated server only evaluate the bones needed by their physics asset bodies, sockets and attached components (plus parents), instead of every bone in the LOD."));
+
 static TAutoConsoleVariable<float> CVarStallParallelAnimation(
 	TEXT("CriticalPathStall.ParallelAnimation"),
 	0.0f,
@@ -72,6 +77,41 @@ static FAutoConsoleVariableRef CVarParallelAnimCompletionTaskHighPriority(
 	ECVF_Default
 );
 
+static bool GParallelAnimCompletionBatching = true;
+static FAutoConsoleVariableRef CVarParallelAnimCompletionBatching(
+	TEXT("a.ParallelAnimCompletionBatching"),
+	GParallelAnimCompletionBatching,
+	TEXT("If true, each parallel anim completion task on the GT also completes every other component whose evaluation has already finished, rather than leaving each to its own queued task."),
+	ECVF_Default
+);
+
+/** Components whose parallel evaluation has finished and that are waiting for completion on the game thread */
+struct FParallelAnimationReadyList
+{
+	struct FEntry
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
+		FGraphEventRef EvaluationTask;
+	};
+
+	FCriticalSection CriticalSection;
+	TArray<FEntry> Entries;
+
+	void Add(TWeakObjectPtr<USkeletalMeshComponent> InSkeletalMeshComponent, const FGraphEventRef& InEvaluationTask)
+	{
+		FScopeLock Lock(&CriticalSection);
+		Entries.Add({ InSkeletalMeshComponent, InEvaluationTask });
+	}
+
+	void Drain(TArray<FEntry>& OutEntries)
+	{
+		FScopeLock Lock(&CriticalSection);
+		OutEntries = MoveTemp(Entries);
+		Entries.Reset();
+	}
+};
+static FParallelAnimationReadyList GParallelAnimationReadyList;
+
 FAutoConsoleTaskPriority CPrio_ParallelAnimationEvaluationTask(
 	TEXT("TaskGraph.TaskPriorities.ParallelAnimationEvaluationTask"),
 	TEXT("Task and thread priority for FParallelAnimationEvaluationTask"),
@@ -121,6 +161,11 @@ public:
 			}
 
 			Comp->ParallelAnimationEvaluation();
+
+			if (GParallelAnimCompletionBatching)
+			{
+				GParallelAnimationReadyList.Add(SkeletalMeshComponent, MyCompletionGraphEvent);
+			}
 		}
 	}
 };
@@ -129,9 +174,26 @@ class FParallelAnimationCompletionTask
 {
 	TWeakObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
 
+	/** The evaluation task this completion was dispatched for */
+	FGraphEventRef EvaluationTask;
+
+	/** Complete Comp if its in-flight evaluation is still EvaluationTask, it may already have been completed by a batched completion */
+	static void CompleteComponent(USkeletalMeshComponent* Comp, const FGraphEventRef& InEvaluationTask)
+	{
+		FScopeCycleCounterUObject ComponentScope(Comp);
+		FScopeCycleCounterUObject MeshScope(Comp->SkeletalMesh);
+
+		if (IsValidRef(Comp->ParallelAnimationEvaluationTask) && Comp->ParallelAnimationEvaluationTask == InEvaluationTask)
+		{
+			const bool bPerformPostAnimEvaluation = true;
+			Comp->CompleteParallelAnimationEvaluation(bPerformPostAnimEvaluation);
+		}
+	}
+
 public:
-	FParallelAnimationCompletionTask(TWeakObjectPtr<USkeletalMeshComponent> InSkeletalMeshComponent)
+	FParallelAnimationCompletionTask(TWeakObjectPtr<USkeletalMeshComponent> InSkeletalMeshComponent, const FGraphEventRef& InEvaluationTask)
 		: SkeletalMeshComponent(InSkeletalMeshComponent)
+		, EvaluationTask(InEvaluationTask)
 	{
 	}
 
@@ -159,13 +221,20 @@ public:
 
 		if (USkeletalMeshComponent* Comp = SkeletalMeshComponent.Get())
 		{
-			FScopeCycleCounterUObject ComponentScope(Comp);
-			FScopeCycleCounterUObject MeshScope(Comp->SkeletalMesh);
+			CompleteComponent(Comp, EvaluationTask);
+		}
 
-			if(IsValidRef(Comp->ParallelAnimationEvaluationTask))
+		// Complete any other components that have finished evaluating now, their own completion tasks will then have nothing left to do
+		if (GParallelAnimCompletionBatching)
+		{
+			TArray<FParallelAnimationReadyList::FEntry> ReadyEntries;
+			GParallelAnimationReadyList.Drain(ReadyEntries);
+			for (const FParallelAnimationReadyList::FEntry& Entry : ReadyEntries)
 			{
-				const bool bPerformPostAnimEvaluation = true;
-				Comp->CompleteParallelAnimationEvaluation(bPerformPostAnimEvaluation);
+				if (USkeletalMeshComponent* ReadyComp = Entry.SkeletalMeshComponent.Get())
+				{
+					CompleteComponent(ReadyComp, Entry.EvaluationTask);
+				}
 			}
 		}
 	}
@@ -1672,9 +1741,19 @@ void USkeletalMeshComponent::ComputeRequiredBones(TArray<FBoneIndexType>& OutReq
 
 	LODIndex = FMath::Clamp(LODIndex, 0, SkelMeshRenderData->LODRenderData.Num() - 1);
 
+	// Dedicated servers never render the mesh, so they can start from the root and only add the bones that gameplay queries
+	const bool bServerRequiredBonesOnly = CVarDedicatedServerRequiredBonesOnly.GetValueOnAnyThread() != 0 && IsNetMode(NM_DedicatedServer);
+
 	// The list of bones we want is taken from the predicted LOD level.
 	FSkeletalMeshLODRenderData& LODData = SkelMeshRenderData->LODRenderData[LODIndex];
-	OutRequiredBones = LODData.RequiredBones;
+	if (bServerRequiredBonesOnly)
+	{
+		OutRequiredBones.Add(0);
+	}
+	else
+	{
+		OutRequiredBones = LODData.RequiredBones;
+	}
 
 	// Add virtual bones
 	MergeInBoneIndexArrays(OutRequiredBones, SkeletalMesh->GetRefSkeleton().GetRequiredVirtualBones());
@@ -1774,7 +1853,7 @@ void USkeletalMeshComponent::ComputeRequiredBones(TArray<FBoneIndexType>& OutReq
 			int32 BoneIndex = SkeletalMesh->GetRefSkeleton().FindBoneIndex(Socket->BoneName);
 			if (BoneIndex != INDEX_NONE)
 			{
-				if (Socket->bForceAlwaysAnimated)
+				if (Socket->bForceAlwaysAnimated || bServerRequiredBonesOnly)
 				{
 					ForceAnimatedSocketBones.AddUnique(BoneIndex);
 				}
@@ -1785,6 +1864,23 @@ void USkeletalMeshComponent::ComputeRequiredBones(TArray<FBoneIndexType>& OutReq
 			}
 		}
 
+		// Components attached to a bone or socket need it animated when the LOD bones are not all evaluated
+		if (bServerRequiredBonesOnly)
+		{
+			for (const USceneComponent* AttachChild : GetAttachChildren())
+			{
+				const FName AttachSocketName = AttachChild ? AttachChild->GetAttachSocketName() : NAME_None;
+				if (AttachSocketName != NAME_None)
+				{
+					const int32 BoneIndex = GetBoneIndex(GetSocketBoneName(AttachSocketName));
+					if (BoneIndex != INDEX_NONE)
+					{
+						ForceAnimatedSocketBones.AddUnique(BoneIndex);
+					}
+				}
+			}
+		}
+
 		// Then sort array of required bones in hierarchy order
 		ForceAnimatedSocketBones.Sort();
 
@@ -1815,6 +1911,27 @@ void USkeletalMeshComponent::ComputeRequiredBones(TArray<FBoneIndexType>& OutReq
 	FAnimationRuntime::EnsureParentsPresent(OutFillComponentSpaceTransformsRequiredBones, SkeletalMesh->GetRefSkeleton());
 }
 
+void USkeletalMeshComponent::OnChildAttached(USceneComponent* ChildComponent)
+{
+	Super::OnChildAttached(ChildComponent);
+
+	// Attachments contribute to the required bones when only gameplay bones are evaluated
+	if (CVarDedicatedServerRequiredBonesOnly.GetValueOnGameThread() != 0 && IsNetMode(NM_DedicatedServer))
+	{
+		bRequiredBonesUpToDate = false;
+	}
+}
+
+void USkeletalMeshComponent::OnChildDetached(USceneComponent* ChildComponent)
+{
+	Super::OnChildDetached(ChildComponent);
+
+	if (CVarDedicatedServerRequiredBonesOnly.GetValueOnGameThread() != 0 && IsNetMode(NM_DedicatedServer))
+	{
+		bRequiredBonesUpToDate = false;
+	}
+}
+
 void USkeletalMeshComponent::RecalcRequiredBones(int32 LODIndex)
 {
 	if (!SkeletalMesh)
@@ -2403,7 +2520,7 @@ void USkeletalMeshComponent::DispatchParallelEvaluationTasks(FActorComponentTick
 	// set up a task to run on the game thread to accept the results
 	FGraphEventArray Prerequistes;
 	Prerequistes.Add(ParallelAnimationEvaluationTask);
-	FGraphEventRef TickCompletionEvent = TGraphTask<FParallelAnimationCompletionTask>::CreateTask(&Prerequistes).ConstructAndDispatchWhenReady(this);
+	FGraphEventRef TickCompletionEvent = TGraphTask<FParallelAnimationCompletionTask>::CreateTask(&Prerequistes).ConstructAndDispatchWhenReady(this, ParallelAnimationEvaluationTask);
 
 	if ( TickFunction )
 	{
@@ -0,0 +1,164 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/SnapshotInterpolationComponent.h"
+#include "Engine/SnapshotInterpolationSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GSnapshotInterpolationEnable = 1;
+static FAutoConsoleVariableRef CVarSnapshotInterpolationEnable(
+	TEXT("net.SnapshotInterpolation.Enable"),
+	GSnapshotInterpolationEnable,
+	TEXT("Whether USnapshotInterpolationComponents smooth the replicated movement of their owner. When 0, it is applied as it arrives."));
+
+namespace SnapshotInterpolation
+{
+	/** Snapshots beyond this are dropped oldest first, only reached when the buffer time is far above the snapshot interval */
+	static const int32 MaxSnapshots = 16;
+
+	/** Weight of each new interval in the moving average */
+	static const float IntervalSmoothing = 0.1f;
+
+	/** Intervals above this are pauses in replication, e.g. dormancy or relevancy, rather than the replication rate */
+	static const float MaxSnapshotInterval = 1.0f;
+}
+
+USnapshotInterpolationComponent::USnapshotInterpolationComponent()
+	: MinBufferTime(0.05f)
+	, BufferIntervals(1.5f)
+	, MaxExtrapolationTime(0.25f)
+	, TeleportDistance(1000.0f)
+	, SmoothedSnapshotInterval(0.0f)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	bAutoActivate = true;
+}
+
+void USnapshotInterpolationComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	UWorld* World = GetWorld();
+	if (USnapshotInterpolationSubsystem* Subsystem = World ? World->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr)
+	{
+		Subsystem->RegisterComponent(this);
+	}
+}
+
+void USnapshotInterpolationComponent::OnUnregister()
+{
+	UWorld* World = GetWorld();
+	if (USnapshotInterpolationSubsystem* Subsystem = World ? World->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr)
+	{
+		Subsystem->UnregisterComponent(this);
+	}
+
+	ResetSnapshots();
+
+	Super::OnUnregister();
+}
+
+void USnapshotInterpolationComponent::ApplyWorldOffset(const FVector& InOffset, bool bWorldShift)
+{
+	Super::ApplyWorldOffset(InOffset, bWorldShift);
+
+	for (FSnapshot& Snapshot : Snapshots)
+	{
+		Snapshot.Location += InOffset;
+	}
+}
+
+bool USnapshotInterpolationComponent::IsInterpolating() const
+{
+	return GSnapshotInterpolationEnable && IsRegistered() && IsActive();
+}
+
+void USnapshotInterpolationComponent::AddSnapshot(const FVector& Location, const FRotator& Rotation, const FVector& Velocity, float ReceiveTime)
+{
+	using namespace SnapshotInterpolation;
+
+	if (Snapshots.Num() > 0)
+	{
+		const FSnapshot& Last = Snapshots.Last();
+
+		if (FVector::DistSquared(Last.Location, Location) > FMath::Square(TeleportDistance))
+		{
+			Snapshots.Reset();
+		}
+		else if (ReceiveTime <= Last.ReceiveTime)
+		{
+			// Several updates processed in the same frame, only the latest matters
+			Snapshots.Pop(false);
+		}
+		else
+		{
+			const float Interval = FMath::Min(ReceiveTime - Last.ReceiveTime, MaxSnapshotInterval);
+			SmoothedSnapshotInterval = (SmoothedSnapshotInterval > 0.0f ? FMath::Lerp(SmoothedSnapshotInterval, Interval, IntervalSmoothing) : Interval);
+		}
+	}
+
+	if (Snapshots.Num() >= MaxSnapshots)
+	{
+		Snapshots.RemoveAt(0, 1, false);
+	}
+
+	FSnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+	Snapshot.Location = Location;
+	Snapshot.Rotation = Rotation.Quaternion();
+	Snapshot.Velocity = Velocity;
+	Snapshot.ReceiveTime = ReceiveTime;
+}
+
+void USnapshotInterpolationComponent::ResetSnapshots()
+{
+	Snapshots.Reset();
+	SmoothedSnapshotInterval = 0.0f;
+}
+
+float USnapshotInterpolationComponent::GetBufferTime() const
+{
+	return FMath::Max(MinBufferTime, SmoothedSnapshotInterval * BufferIntervals);
+}
+
+bool USnapshotInterpolationComponent::Evaluate(float RealTime, FVector& OutLocation, FQuat& OutRotation)
+{
+	if (Snapshots.Num() == 0)
+	{
+		return false;
+	}
+
+	const float RenderTime = RealTime - GetBufferTime();
+
+	// Keep the last snapshot before the render time, it is the start of the current segment
+	while (Snapshots.Num() > 1 && Snapshots[1].ReceiveTime <= RenderTime)
+	{
+		Snapshots.RemoveAt(0, 1, false);
+	}
+
+	const FSnapshot& From = Snapshots[0];
+
+	if (RenderTime <= From.ReceiveTime)
+	{
+		// Still filling the buffer after the first snapshot
+		OutLocation = From.Location;
+		OutRotation = From.Rotation;
+	}
+	else if (Snapshots.Num() > 1)
+	{
+		const FSnapshot& To = Snapshots[1];
+		const float Alpha = (RenderTime - From.ReceiveTime) / (To.ReceiveTime - From.ReceiveTime);
+
+		OutLocation = FMath::Lerp(From.Location, To.Location, Alpha);
+		OutRotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha);
+	}
+	else
+	{
+		// The buffer ran dry, keep going for a little while in case the next snapshot is only late
+		const float ExtrapolationTime = FMath::Min(RenderTime - From.ReceiveTime, MaxExtrapolationTime);
+
+		OutLocation = From.Location + From.Velocity * ExtrapolationTime;
+		OutRotation = From.Rotation;
+	}
+
+	return true;
+}
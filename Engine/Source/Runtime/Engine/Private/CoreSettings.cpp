@@ -18,6 +18,7 @@ float GLevelStreamingActorsUpdateTimeLimit = 5.0f;
 float GPriorityLevelStreamingActorsUpdateExtraTime = 5.0f;
 float GLevelStreamingUnregisterComponentsTimeLimit = 1.0f;
 int32 GLevelStreamingComponentsRegistrationGranularity = 10;
+int32 GLevelStreamingRouteActorInitializationGranularity = 10;
 int32 GLevelStreamingComponentsUnregistrationGranularity = 5;
 int32 GLevelStreamingForceGCAfterLevelStreamedOut = 1;
 int32 GLevelStreamingContinuouslyIncrementalGCWhileLevelsPendingPurge = 1;
@@ -80,6 +81,13 @@ static FAutoConsoleVariableRef CVarLevelStreamingComponentsRegistrationGranulari
 	ECVF_Default
 	);
 
+static FAutoConsoleVariableRef CVarLevelStreamingRouteActorInitializationGranularity(
+	TEXT("s.LevelStreamingRouteActorInitializationGranularity"),
+	GLevelStreamingRouteActorInitializationGranularity,
+	TEXT("Batching granularity used to initialize actors during level streaming. If this is zero, we process all actors and stages in a single frame."),
+	ECVF_Default
+	);
+
 static FAutoConsoleVariableRef CVarLevelStreamingComponentsUnregistrationGranularity(
 	TEXT("s.LevelStreamingComponentsUnregistrationGranularity"),
 	GLevelStreamingComponentsUnregistrationGranularity,
@@ -191,6 +199,7 @@ UGarbageCollectionSettings::UGarbageCollectionSettings()
 	NumRetriesBeforeForcingGC = 0;
 	MaxObjectsNotConsideredByGC = 0;
 	SizeOfPermanentObjectPool = 0;
+	SizeOfClassObjectPoolsMB = 0;
 	MaxObjectsInEditor = 12 * 1024 * 1024;
 	MaxObjectsInGame = 2 * 1024 * 1024;	
 	CreateGCClusters = true;	
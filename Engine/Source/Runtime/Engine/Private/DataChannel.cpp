@@ -24,6 +24,7 @@
 #include "Net/NetworkGranularMemoryLogging.h"
 #include "Net/Core/Trace/NetTrace.h"
 #include "Misc/NetworkVersion.h"
+#include "ProfilingDebugging/ClassCostProfiler.h"
 
 DEFINE_LOG_CATEGORY(LogNet);
 DEFINE_LOG_CATEGORY(LogRep);
@@ -2095,7 +2096,16 @@ bool UActorChannel::CleanUp(const bool bForDestroy, EChannelCloseReason CloseRea
 
 	UE_LOG( LogNetTraffic, Log, TEXT( "UActorChannel::CleanUp: %s" ), *Describe() );
 
-	if (!bIsServer && QueuedBunches.Num() > 0 && ChIndex >= 0 && !bForDestroy)
+	// If the actor was never spawned because all of its bunches were queued (e.g. while fast forwarding a replay),
+	// the driver may let us drop those bunches rather than spawning the actor only to destroy it again.
+	const bool bDropQueuedBunches = !bIsServer && QueuedBunches.Num() > 0 && Actor == nullptr && ActorNetGUID.IsValid() &&
+		Connection->Driver->ShouldDropQueuedBunchesForClosedActorGUID(ActorNetGUID, CloseReason);
+
+	if (bDropQueuedBunches)
+	{
+		UE_LOG(LogNet, VeryVerbose, TEXT("UActorChannel::CleanUp: Dropping %d queued bunches for actor that was never spawned. Channel: %i, ActorNetGUID: %s"), QueuedBunches.Num(), ChIndex, *ActorNetGUID.ToString());
+	}
+	else if (!bIsServer && QueuedBunches.Num() > 0 && ChIndex >= 0 && !bForDestroy)
 	{
 		checkf(ActorNetGUID.IsValid(), TEXT("UActorChannel::Cleanup: ActorNetGUID is invalid! Channel: %i"), ChIndex);
 		
@@ -2949,6 +2959,8 @@ int64 UActorChannel::ReplicateActor()
 	check(Connection);
 	check(nullptr != Cast<UPackageMapClient>(Connection->PackageMap));
 
+	SCOPE_CLASS_COST(Replication, Actor->GetClass());
+
 	const UWorld* const ActorWorld = Actor->GetWorld();
 	check(ActorWorld);
 
@@ -2960,6 +2972,9 @@ int64 UActorChannel::ReplicateActor()
 	const bool bReplay = Connection->IsReplay();
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE_CONDITIONAL(ReplicateActor, !bReplay);
 
+	// Per actor class cpu time, so that net traces show the replication cost next to the bandwidth
+	UE_NET_TRACE_CPU_SCOPE(*FString::Printf(TEXT("ReplicateActor %s"), *Actor->GetClass()->GetName()), ENetTraceVerbosity::Trace);
+
 	const bool bEnableScopedCycleCounter = !bReplay && GReplicateActorTimingEnabled;
 	FSimpleScopeSecondsCounter ScopedSecondsCounter(GReplicateActorTimeSeconds, bEnableScopedCycleCounter);
 
@@ -30,6 +30,13 @@ static TAutoConsoleVariable<int32> CVarMaxRPCPerNetUpdate(
 	TEXT("Maximum number of unreliable multicast RPC calls allowed per net update, additional ones will be dropped"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarMaxQueuedMulticastBitsPerFrame(
+	TEXT("net.MaxQueuedMulticastBitsPerFrame"),
+	0,
+	TEXT("Budget of unreliable multicast RPC bits that can be queued per connection each frame, scaled by the actor's NetPriority. ")
+	TEXT("Once a connection is over the scaled budget, further unreliable multicasts are dropped for it, so low priority actors lose their cosmetic RPCs first. 0 = no budget."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarDelayUnmappedRPCs(
 	TEXT("net.DelayUnmappedRPCs"),
 	0,
@@ -1617,6 +1624,8 @@ bool FObjectReplicator::ReplicateProperties( FOutBunch & Bunch, FReplicationFlag
 		return false;
 	}
 
+	UE_NET_TRACE_CPU_SCOPE(*FString::Printf(TEXT("ReplicateProperties %s"), *Object->GetClass()->GetName()), ENetTraceVerbosity::Verbose);
+
 	// some games ship checks() in Shipping so we cannot rely on DO_CHECK here, and these checks are in an extremely hot path
 	if (!UE_BUILD_SHIPPING && !UE_BUILD_TEST)
 	{
@@ -1925,6 +1934,24 @@ void FObjectReplicator::QueueRemoteFunctionBunch( UFunction* Func, FOutBunch &Bu
 		return;
 	}
 	
+	const int32 MaxQueuedMulticastBits = CVarMaxQueuedMulticastBitsPerFrame.GetValueOnAnyThread();
+	if (MaxQueuedMulticastBits > 0 && !Bunch.bReliable)
+	{
+		const float NetPriority = OwningChannel->Actor ? OwningChannel->Actor->NetPriority : 1.0f;
+		const int32 PriorityBudget = FMath::TruncToInt(MaxQueuedMulticastBits * FMath::Max(NetPriority, 0.0f));
+		if (Connection->QueuedMulticastBitsThisFrame + Bunch.GetNumBits() > PriorityBudget)
+		{
+			UE_LOG(LogRep, Verbose, TEXT("Multicast budget exceeded (%d + %d bits > %d for NetPriority %.2f). Skipping RPC %s. %s."),
+				Connection->QueuedMulticastBitsThisFrame, Bunch.GetNumBits(), PriorityBudget, NetPriority, *Func->GetName(), *GetPathNameSafe(GetObject()));
+
+			--RemoteFuncInfo[InfoIdx].Calls;
+			CastChecked<UPackageMapClient>(Connection->PackageMap)->GetMustBeMappedGuidsInLastBunch().Reset();
+			return;
+		}
+
+		Connection->QueuedMulticastBitsThisFrame += Bunch.GetNumBits();
+	}
+
 	RemoteFuncInfo[InfoIdx].LastCallTimestamp = OwningChannel->Connection->Driver->GetElapsedTime();
 
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
@@ -60,6 +60,7 @@ static TAutoConsoleVariable<float> CVarGotoTimeInSeconds( TEXT( "demo.GotoTimeIn
 static TAutoConsoleVariable<int32> CVarDemoFastForwardDestroyTearOffActors( TEXT( "demo.FastForwardDestroyTearOffActors" ), 1, TEXT( "If true, the driver will destroy any torn-off actors immediately while fast-forwarding a replay." ) );
 static TAutoConsoleVariable<int32> CVarDemoFastForwardSkipRepNotifies( TEXT( "demo.FastForwardSkipRepNotifies" ), 1, TEXT( "If true, the driver will optimize fast-forwarding by deferring calls to RepNotify functions until the fast-forward is complete. " ) );
 static TAutoConsoleVariable<int32> CVarDemoQueueCheckpointChannels( TEXT( "demo.QueueCheckpointChannels" ), 1, TEXT( "If true, the driver will put all channels created during checkpoint loading into queuing mode, to amortize the cost of spawning new actors across multiple frames." ) );
+static TAutoConsoleVariable<int32> CVarDemoFastForwardDropDestroyedQueuedActors( TEXT( "demo.FastForwardDropDestroyedQueuedActors" ), 1, TEXT( "If true, dynamic actors whose channels are opened and destroyed while their bunches are queued during a checkpoint fast-forward are never spawned, and their queued bunches are discarded. Requires demo.QueueCheckpointChannels." ) );
 static TAutoConsoleVariable<int32> CVarUseAdaptiveReplayUpdateFrequency( TEXT( "demo.UseAdaptiveReplayUpdateFrequency" ), 1, TEXT( "If 1, NetUpdateFrequency will be calculated based on how often actors actually write something when recording to a replay" ) );
 static TAutoConsoleVariable<int32> CVarDemoAsyncLoadWorld( TEXT( "demo.AsyncLoadWorld" ), 0, TEXT( "If 1, we will use seamless server travel to load the replay world asynchronously" ) );
 TAutoConsoleVariable<float> CVarCheckpointUploadDelayInSeconds( TEXT( "demo.CheckpointUploadDelayInSeconds" ), 30.0f, TEXT( "" ) );
@@ -4355,6 +4356,23 @@ bool UDemoNetDriver::ShouldQueueBunchesForActorGUID(FNetworkGUID InGUID) const
 	return false;
 }
 
+bool UDemoNetDriver::ShouldDropQueuedBunchesForClosedActorGUID(FNetworkGUID InGUID, EChannelCloseReason CloseReason) const
+{
+	if (CVarDemoFastForwardDropDestroyedQueuedActors.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+
+	// Only actors that are actually going away can be skipped. Channels closed for dormancy or tear off
+	// still need their bunches processed, so the actor exists (in the right state) once we reach the target time.
+	if (CloseReason != EChannelCloseReason::Destroyed || !InGUID.IsDynamic())
+	{
+		return false;
+	}
+
+	return bIsFastForwardingForCheckpoint && ShouldQueueBunchesForActorGUID(InGUID);
+}
+
 bool UDemoNetDriver::ShouldIgnoreRPCs() const
 {
 	return (CVarDemoFastForwardIgnoreRPCs.GetValueOnAnyThread() && (ReplayHelper.bIsLoadingCheckpoint || bIsFastForwarding));
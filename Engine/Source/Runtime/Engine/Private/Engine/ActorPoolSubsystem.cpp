@@ -0,0 +1,206 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/ActorPoolSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+#include "Engine/LatentActionManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogActorPool, Log, All);
+
+AActor* UActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, const FActorSpawnParameters& SpawnParameters)
+{
+	UWorld* World = GetWorld();
+	if (!Class || !World)
+	{
+		return nullptr;
+	}
+
+	AActor* Actor = nullptr;
+	if (TArray<TWeakObjectPtr<AActor>>* Pool = Pools.Find(*Class))
+	{
+		// Skip pooled actors that were destroyed by someone else, e.g. because their level was unloaded
+		while (!Actor && Pool->Num())
+		{
+			Actor = Pool->Pop(false).Get();
+			if (Actor && Actor->IsPendingKillPending())
+			{
+				Actor = nullptr;
+			}
+		}
+	}
+
+	if (!Actor)
+	{
+		return World->SpawnActor(Class, &Transform, SpawnParameters);
+	}
+
+	const AActor* DefaultActor = Actor->GetClass()->GetDefaultObject<AActor>();
+
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetOwner(SpawnParameters.Owner);
+	Actor->SetInstigator(SpawnParameters.Instigator);
+	Actor->SetActorHiddenInGame(DefaultActor->IsHidden());
+	Actor->SetActorEnableCollision(DefaultActor->GetActorEnableCollision());
+
+	// Same sequence as a newly spawned actor, or an actor whose level is made visible again
+	Actor->RegisterAllComponents();
+	Actor->PreInitializeComponents();
+	Actor->InitializeComponents();
+	Actor->PostInitializeComponents();
+
+	if (Actor->GetIsReplicated())
+	{
+		World->AddNetworkActor(Actor);
+	}
+
+	Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+	if (World->HasBegunPlay())
+	{
+		Actor->DispatchBeginPlay();
+	}
+
+	return Actor;
+}
+
+bool UActorPoolSubsystem::CanPoolActor(const AActor* Actor) const
+{
+	if (!Actor || Actor->IsPendingKillPending() || Actor->GetWorld() != GetWorld() || !Actor->IsActorInitialized())
+	{
+		return false;
+	}
+
+	// Remote copies of replicated actors are owned by the server, and startup actors are referenced by their path
+	if (Actor->GetIsReplicated() && (!Actor->HasAuthority() || Actor->IsNetStartupActor()))
+	{
+		return false;
+	}
+
+	return !Actor->IsChildActor();
+}
+
+bool UActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!CanPoolActor(Actor))
+	{
+		return false;
+	}
+
+	TArray<TWeakObjectPtr<AActor>>& Pool = Pools.FindOrAdd(Actor->GetClass());
+	if (!ensureMsgf(!Pool.Contains(Actor), TEXT("Actor %s was released to the pool twice"), *Actor->GetName()))
+	{
+		return true;
+	}
+
+	UWorld* World = GetWorld();
+
+	// Clients destroy their copy and the actor leaves replication before EndPlay, like a destroyed actor
+	if (Actor->GetIsReplicated())
+	{
+		if (FWorldContext* Context = GEngine->GetWorldContextFromWorld(World))
+		{
+			for (FNamedNetDriver& Driver : Context->ActiveNetDrivers)
+			{
+				if (Driver.NetDriver != nullptr && Driver.NetDriver->ShouldReplicateActor(Actor))
+				{
+					Driver.NetDriver->NotifyActorReleasedToPool(Actor);
+				}
+			}
+		}
+	}
+
+	TArray<AActor*> AttachedActors;
+	Actor->GetAttachedActors(AttachedActors);
+	for (AActor* AttachedActor : AttachedActors)
+	{
+		AttachedActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	}
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	// RemovedFromWorld also clears overlaps and bActorInitialized, so AcquireActor can initialize the actor again
+	Actor->RouteEndPlay(EEndPlayReason::RemovedFromWorld);
+
+	World->GetTimerManager().ClearAllTimersForObject(Actor);
+	World->GetLatentActionManager().RemoveActionsForObject(Actor);
+
+	Actor->SetActorTickEnabled(false);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetOwner(nullptr);
+	Actor->UnregisterAllComponents();
+
+	Pool.Add(Actor);
+
+	UE_LOG(LogActorPool, Verbose, TEXT("Released %s to the pool, %d pooled actors of class %s"), *Actor->GetName(), Pool.Num(), *Actor->GetClass()->GetName());
+	return true;
+}
+
+void UActorPoolSubsystem::PrewarmPool(TSubclassOf<AActor> Class, int32 Count)
+{
+	UWorld* World = GetWorld();
+	if (!Class || !World)
+	{
+		return;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	for (int32 Index = GetNumPooledActors(Class); Index < Count; ++Index)
+	{
+		AActor* Actor = World->SpawnActor(Class, &FTransform::Identity, SpawnParameters);
+		if (!Actor || !ReleaseActor(Actor))
+		{
+			if (Actor)
+			{
+				Actor->Destroy();
+			}
+			UE_LOG(LogActorPool, Warning, TEXT("Can't prewarm the pool of %s, actors of this class can't be pooled"), *Class->GetName());
+			break;
+		}
+	}
+}
+
+void UActorPoolSubsystem::EmptyPool(TSubclassOf<AActor> Class)
+{
+	for (auto It = Pools.CreateIterator(); It; ++It)
+	{
+		if (Class && It.Key() != *Class)
+		{
+			continue;
+		}
+
+		for (const TWeakObjectPtr<AActor>& ActorPtr : It.Value())
+		{
+			AActor* Actor = ActorPtr.Get();
+			if (Actor && !Actor->IsPendingKillPending())
+			{
+				Actor->Destroy();
+			}
+		}
+		It.RemoveCurrent();
+	}
+}
+
+int32 UActorPoolSubsystem::GetNumPooledActors(TSubclassOf<AActor> Class) const
+{
+	const TArray<TWeakObjectPtr<AActor>>* Pool = Pools.Find(*Class);
+	return Pool ? Pool->Num() : 0;
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	// Pooled actors belong to their level and go away with it
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UActorPoolSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
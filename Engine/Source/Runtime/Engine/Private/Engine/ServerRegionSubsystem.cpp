@@ -0,0 +1,235 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/ServerRegionSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "Net/ActorStateSnapshot.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CommandLine.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "EngineUtils.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogServerRegion, Log, All);
+
+int32 UServerRegionSubsystem::GetServerIdAt(const FVector& Location) const
+{
+	for (const FServerRegion& Region : Regions)
+	{
+		if (Region.Bounds.IsInsideXY(Location))
+		{
+			return Region.ServerId;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+bool UServerRegionSubsystem::HasAuthorityAt(const FVector& Location) const
+{
+	const int32 ServerId = GetServerIdAt(Location);
+	return ServerId == LocalServerId || ServerId == INDEX_NONE;
+}
+
+void UServerRegionSubsystem::GetServersNear(const FVector& Location, TArray<int32>& OutServerIds) const
+{
+	OutServerIds.Reset();
+
+	const FVector Location2D(Location.X, Location.Y, 0.0f);
+	const float BoundaryDistanceSquared = FMath::Square(BoundaryDistance);
+
+	for (const FServerRegion& Region : Regions)
+	{
+		if (Region.ServerId == LocalServerId)
+		{
+			continue;
+		}
+
+		const FBox Bounds2D(FVector(Region.Bounds.Min.X, Region.Bounds.Min.Y, 0.0f), FVector(Region.Bounds.Max.X, Region.Bounds.Max.Y, 0.0f));
+		if (Bounds2D.ComputeSquaredDistanceToPoint(Location2D) <= BoundaryDistanceSquared)
+		{
+			OutServerIds.AddUnique(Region.ServerId);
+		}
+	}
+
+	// Sorted so changes can be detected by comparing the arrays
+	OutServerIds.Sort();
+}
+
+void UServerRegionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (!NetDriver || !NetDriver->IsServer() || LocalServerId == INDEX_NONE)
+	{
+		return;
+	}
+
+	++FrameNumber;
+
+	TArray<int32> NearbyServerIds;
+
+	// Only replicated actors can be mirrored or handed off, which the network object list already tracks
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : NetDriver->GetNetworkObjectList().GetAllObjects())
+	{
+		AActor* Actor = ObjectInfo.IsValid() ? ObjectInfo->Actor : nullptr;
+		if (!Actor || Actor->IsPendingKillPending() || !Actor->HasAuthority() || Actor->IsRootComponentStatic())
+		{
+			continue;
+		}
+
+		const FVector Location = Actor->GetActorLocation();
+
+		FTrackedActor& Tracked = TrackedActors.FindOrAdd(FObjectKey(Actor));
+		Tracked.LastSeenFrame = FrameNumber;
+
+		const int32 ServerId = GetServerIdAt(Location);
+		if (Tracked.Actor.IsValid() && ServerId != INDEX_NONE && ServerId != LocalServerId && Tracked.ServerId != ServerId)
+		{
+			UE_LOG(LogServerRegion, Verbose, TEXT("%s crossed from server %d into server %d"), *Actor->GetName(), LocalServerId, ServerId);
+			OnActorCrossedRegion.Broadcast(Actor, LocalServerId, ServerId);
+		}
+
+		Tracked.Actor = Actor;
+		Tracked.ServerId = ServerId;
+
+		GetServersNear(Location, NearbyServerIds);
+		if (NearbyServerIds != Tracked.NearbyServerIds)
+		{
+			Tracked.NearbyServerIds = NearbyServerIds;
+			OnActorBoundaryChanged.Broadcast(Actor, Tracked.NearbyServerIds);
+		}
+	}
+
+	// Forget actors that were destroyed or stopped replicating
+	for (auto It = TrackedActors.CreateIterator(); It; ++It)
+	{
+		if (It.Value().LastSeenFrame != FrameNumber)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+TStatId UServerRegionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UServerRegionSubsystem, STATGROUP_Tickables);
+}
+
+void UServerRegionSubsystem::WriteHandoff(AActor* Actor, TArray<uint8>& OutData)
+{
+	check(Actor);
+
+	FMemoryWriter Writer(OutData, true);
+
+	FString ClassPath = Actor->GetClass()->GetPathName();
+	FTransform Transform = Actor->GetActorTransform();
+	Writer << ClassPath;
+	Writer << Transform;
+
+	FObjectAndNameAsStringProxyArchive Ar(Writer, true);
+	Ar.ArIsSaveGame = true;
+	Actor->Serialize(Ar);
+
+	FActorSnapshotWriter SnapshotWriter;
+	SnapshotWriter.Write(Actor, Writer, true);
+}
+
+AActor* UServerRegionSubsystem::SpawnFromHandoff(const TArray<uint8>& Data)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FMemoryReader Reader(Data, true);
+
+	FString ClassPath;
+	FTransform Transform;
+	Reader << ClassPath;
+	Reader << Transform;
+
+	UClass* Class = FindObject<UClass>(nullptr, *ClassPath);
+	if (!Class || !Class->IsChildOf(AActor::StaticClass()) || Reader.IsError())
+	{
+		UE_LOG(LogServerRegion, Warning, TEXT("SpawnFromHandoff: Unknown actor class %s"), *ClassPath);
+		return nullptr;
+	}
+
+	AActor* Actor = World->SpawnActorDeferred<AActor>(Class, Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (Actor)
+	{
+		FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+		Ar.ArIsSaveGame = true;
+		Actor->Serialize(Ar);
+
+		FActorSnapshotReader SnapshotReader;
+		SnapshotReader.Read(Actor, Reader);
+
+		Actor->FinishSpawning(Transform);
+	}
+
+	return Actor;
+}
+
+void UServerRegionSubsystem::Dump(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Local server %d, boundary distance %.0f"), LocalServerId, BoundaryDistance);
+
+	for (const FServerRegion& Region : Regions)
+	{
+		Ar.Logf(TEXT("  Server %d: %s"), Region.ServerId, *Region.Bounds.ToString());
+	}
+
+	int32 NumOnBoundary = 0;
+	for (const TPair<FObjectKey, FTrackedActor>& Pair : TrackedActors)
+	{
+		NumOnBoundary += Pair.Value.NearbyServerIds.Num() > 0;
+	}
+
+	Ar.Logf(TEXT("%d tracked actors, %d near other servers"), TrackedActors.Num(), NumOnBoundary);
+}
+
+bool UServerRegionSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && Regions.Num() > 0;
+}
+
+void UServerRegionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FParse::Value(FCommandLine::Get(), TEXT("ServerRegionId="), LocalServerId);
+}
+
+void UServerRegionSubsystem::Deinitialize()
+{
+	TrackedActors.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UServerRegionSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ServerRegionDumpCmd(
+	TEXT("ServerRegion.Dump"),
+	TEXT("Logs the server regions and how many actors are near other servers"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (UServerRegionSubsystem* ServerRegions = World ? World->GetSubsystem<UServerRegionSubsystem>() : nullptr)
+		{
+			ServerRegions->Dump(Ar);
+		}
+		else
+		{
+			Ar.Log(TEXT("No server regions are configured"));
+		}
+	}));
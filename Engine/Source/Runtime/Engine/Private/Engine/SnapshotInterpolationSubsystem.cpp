@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/SnapshotInterpolationSubsystem.h"
+#include "Components/SnapshotInterpolationComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("SnapshotInterpolation Evaluate"), STAT_SnapshotInterpolationEvaluate, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("SnapshotInterpolation Apply"), STAT_SnapshotInterpolationApply, STATGROUP_Game);
+
+static int32 GSnapshotInterpolationParallelThreshold = 64;
+static FAutoConsoleVariableRef CVarSnapshotInterpolationParallelThreshold(
+	TEXT("net.SnapshotInterpolation.ParallelThreshold"),
+	GSnapshotInterpolationParallelThreshold,
+	TEXT("Number of interpolating actors from which their transforms are evaluated on worker threads."));
+
+void USnapshotInterpolationSubsystem::RegisterComponent(USnapshotInterpolationComponent* Component)
+{
+	Components.AddUnique(Component);
+}
+
+void USnapshotInterpolationSubsystem::UnregisterComponent(USnapshotInterpolationComponent* Component)
+{
+	Components.RemoveSwap(Component);
+}
+
+void USnapshotInterpolationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	if (!World || Components.Num() == 0)
+	{
+		return;
+	}
+
+	struct FResult
+	{
+		FVector Location;
+		FQuat Rotation;
+		bool bValid;
+	};
+
+	const float RealTime = World->GetRealTimeSeconds();
+
+	// Moving the owners can unregister components, e.g. from overlap events destroying actors
+	TArray<USnapshotInterpolationComponent*> Batch = Components;
+
+	TArray<FResult> Results;
+	Results.SetNumUninitialized(Batch.Num());
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SnapshotInterpolationEvaluate);
+
+		// Each component only reads and trims its own snapshots, the owners are moved afterwards on the game thread
+		ParallelFor(Batch.Num(), [&Batch, &Results, RealTime](int32 Index)
+		{
+			USnapshotInterpolationComponent* Component = Batch[Index];
+			FResult& Result = Results[Index];
+
+			Result.bValid = Component && Component->IsInterpolating() && Component->Evaluate(RealTime, Result.Location, Result.Rotation);
+		}, Batch.Num() < GSnapshotInterpolationParallelThreshold);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SnapshotInterpolationApply);
+
+	for (int32 Index = 0; Index < Batch.Num(); ++Index)
+	{
+		const FResult& Result = Results[Index];
+		if (!Result.bValid || !Batch[Index]->IsRegistered())
+		{
+			continue;
+		}
+
+		AActor* Owner = Batch[Index]->GetOwner();
+		USceneComponent* RootComponent = Owner ? Owner->GetRootComponent() : nullptr;
+
+		// Same conditions as AActor::OnRep_ReplicatedMovement, which only hands simulated proxies over to the component
+		if (RootComponent && !RootComponent->GetAttachParent() && Owner->GetLocalRole() == ROLE_SimulatedProxy && !RootComponent->IsSimulatingPhysics())
+		{
+			const FRotator Rotation = Result.Rotation.Rotator();
+			if (!Result.Location.Equals(Owner->GetActorLocation()) || !Rotation.Equals(Owner->GetActorRotation()))
+			{
+				Owner->SetActorLocationAndRotation(Result.Location, Rotation, /*bSweep=*/ false);
+			}
+		}
+	}
+}
+
+void USnapshotInterpolationSubsystem::Deinitialize()
+{
+	Components.Empty();
+
+	Super::Deinitialize();
+}
+
+bool USnapshotInterpolationSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -26,6 +26,7 @@ DEFINE_STAT(STAT_GPUSkinCache_NumTrianglesForRecomputeTangents);
 DEFINE_STAT(STAT_GPUSkinCache_NumSectionsProcessed);
 DEFINE_STAT(STAT_GPUSkinCache_NumSetVertexStreams);
 DEFINE_STAT(STAT_GPUSkinCache_NumPreGDME);
+DEFINE_STAT(STAT_GPUSkinCache_NumEvictedEntries);
 DEFINE_LOG_CATEGORY_STATIC(LogSkinCache, Log, All);
 
 static int32 GEnableGPUSkinCacheShaders = 0;
@@ -107,6 +108,17 @@ static TAutoConsoleVariable<float> CVarGPUSkinCacheSceneMemoryLimitInMB(
 	ECVF_RenderThreadSafe
 );
 
+static int32 GSkinCacheEvictUnusedFrames = 0;
+static FAutoConsoleVariableRef CVarGPUSkinCacheEvictUnusedFrames(
+	TEXT("r.SkinCache.EvictUnusedFrames"),
+	GSkinCacheEvictUnusedFrames,
+	TEXT("When an allocation doesn't fit in r.SkinCache.SceneMemoryLimitInMB, evict the least recently used entries that have not been skinned or rendered for this many frames to make room.\n")
+	TEXT("Evicted meshes fall back to vertex shader skinning until they are processed again.\n")
+	TEXT("0: off, allocations that don't fit always fall back (default)\n")
+	TEXT(">0: minimum number of frames an entry must have been unused before it can be evicted\n"),
+	ECVF_RenderThreadSafe
+);
+
 ////temporary disable until resource lifetimes are safe for all cases
 static int32 GAllowDupedVertsForRecomputeTangents = 0;
 FAutoConsoleVariableRef CVarGPUSkinCacheAllowDupedVertesForRecomputeTangents(
@@ -193,6 +205,7 @@ public:
 		, GPUSkin(InGPUSkin)
 		, MorphBuffer(0)
 		, LOD(InGPUSkin->GetLOD())
+		, LastUsedFrame(GFrameNumberRenderThread)
 	{
 		
 		const TArray<FSkelMeshRenderSection>& Sections = InGPUSkin->GetRenderSections(LOD);
@@ -493,6 +506,9 @@ protected:
 	FShaderResourceViewRHIRef ClothBuffer;
 	int32 LOD;
 
+	// Last render thread frame the entry was skinned or its passthrough vertex factory was requested, see r.SkinCache.EvictUnusedFrames
+	uint32 LastUsedFrame;
+
 	bool bMultipleClothSkinInfluences;
 
 	friend class FGPUSkinCache;
@@ -1190,6 +1206,11 @@ FGPUSkinCache::FRWBuffersAllocation* FGPUSkinCache::TryAllocBuffer(uint32 NumVer
 {
 	uint64 MaxSizeInBytes = (uint64)(GSkinCacheSceneMemoryLimitInMB * 1024.0f * 1024.0f);
 	uint64 RequiredMemInBytes = FRWBuffersAllocation::CalculateRequiredMemory(NumVertices, WithTangnents);
+	if (bRequiresMemoryLimit && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes && GSkinCacheEvictUnusedFrames > 0)
+	{
+		EvictUnusedEntries(UsedMemoryInBytes + RequiredMemInBytes - MaxSizeInBytes + 1);
+	}
+
 	if (bRequiresMemoryLimit && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes)
 	{
 		ExtraRequiredMemory += RequiredMemInBytes;
@@ -1332,6 +1353,7 @@ void FGPUSkinCache::ProcessEntry(
 		Entries.Add(InOutEntry);
 	}
 
+	InOutEntry->LastUsedFrame = GFrameNumberRenderThread;
 	InOutEntry->VertexOffsetUsage = VertexOffsetBuffers->GetUsage();
 	InOutEntry->PreSkinningVertexOffsetSRV = VertexOffsetBuffers->PreSkinningOffsetsVertexBuffer.GetSRV();
 	InOutEntry->PostSkinningVertexOffsetSRV = VertexOffsetBuffers->PostSkinningOffsetsVertexBuffer.GetSRV();
@@ -1912,23 +1934,72 @@ void FGPUSkinCache::ReleaseSkinCacheEntry(FGPUSkinCacheEntry* SkinCacheEntry)
 #if RHI_RAYTRACING
 	SkinCache->RemoveRayTracingGeometryUpdate(&SkinCacheEntry->GPUSkin->RayTracingGeometry);
 #endif // RHI_RAYTRACING
+	SkinCache->ReleasePositionAllocation(SkinCacheEntry);
+
+	SkinCache->Entries.RemoveSingleSwap(SkinCacheEntry, false);
+	delete SkinCacheEntry;
+}
+
+void FGPUSkinCache::ReleasePositionAllocation(FGPUSkinCacheEntry* SkinCacheEntry)
+{
 	FRWBuffersAllocation* PositionAllocation = SkinCacheEntry->PositionAllocation;
 	if (PositionAllocation)
 	{
 		uint64 RequiredMemInBytes = PositionAllocation->GetNumBytes();
-		SkinCache->UsedMemoryInBytes -= RequiredMemInBytes;
+		UsedMemoryInBytes -= RequiredMemInBytes;
 		DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
 
-		SkinCache->Allocations.Remove(PositionAllocation);
-		PositionAllocation->RemoveAllFromTransitionArray(SkinCache->BuffersToTransition);
+		Allocations.Remove(PositionAllocation);
+		PositionAllocation->RemoveAllFromTransitionArray(BuffersToTransition);
 
 		delete PositionAllocation;
 
 		SkinCacheEntry->PositionAllocation = nullptr;
 	}
+}
 
-	SkinCache->Entries.RemoveSingleSwap(SkinCacheEntry, false);
-	delete SkinCacheEntry;
+void FGPUSkinCache::EvictUnusedEntries(uint64 BytesToFree)
+{
+	// Only entries that weren't skinned nor rendered in the last frames can be evicted, mesh batches gathered this frame may still reference the others
+	const uint32 MinUnusedFrames = (uint32)FMath::Max(GSkinCacheEvictUnusedFrames, 1);
+
+	TArray<FGPUSkinCacheEntry*, TInlineAllocator<64>> Candidates;
+	for (FGPUSkinCacheEntry* Entry : Entries)
+	{
+		if (Entry->PositionAllocation && Entry->LastUsedFrame + MinUnusedFrames <= GFrameNumberRenderThread)
+		{
+			Candidates.Add(Entry);
+		}
+	}
+
+	Candidates.Sort([](const FGPUSkinCacheEntry& A, const FGPUSkinCacheEntry& B) { return A.LastUsedFrame < B.LastUsedFrame; });
+
+	uint64 FreedBytes = 0;
+	for (int32 Index = 0; Index < Candidates.Num() && FreedBytes < BytesToFree; ++Index)
+	{
+		FGPUSkinCacheEntry* Entry = Candidates[Index];
+		FreedBytes += Entry->PositionAllocation->GetNumBytes();
+
+#if RHI_RAYTRACING
+		RemoveRayTracingGeometryUpdate(&Entry->GPUSkin->RayTracingGeometry);
+#endif // RHI_RAYTRACING
+		ReleasePositionAllocation(Entry);
+
+		// The owning mesh object keeps its pointer to the entry. Invalidating the LOD and the sections makes it fall back to
+		// its regular vertex factories and release the entry the next time it is processed, like InvalidateAllEntries.
+		Entry->LOD = -1;
+		for (FGPUSkinCacheEntry::FSectionDispatchData& SectionData : Entry->DispatchData)
+		{
+			SectionData = FGPUSkinCacheEntry::FSectionDispatchData();
+		}
+
+		INC_DWORD_STAT(STAT_GPUSkinCache_NumEvictedEntries);
+	}
+}
+
+void FGPUSkinCache::MarkEntryUsed(FGPUSkinCacheEntry* SkinCacheEntry)
+{
+	SkinCacheEntry->LastUsedFrame = GFrameNumberRenderThread;
 }
 
 #if RHI_RAYTRACING
@@ -1974,7 +2045,7 @@ FCachedGeometry FGPUSkinCache::GetCachedGeometry(uint32 ComponentId) const
 	FCachedGeometry Out;
 	for (FGPUSkinCacheEntry* Entry : Entries)
 	{
-		if (Entry && Entry->GPUSkin && Entry->GPUSkin->GetComponentId() == ComponentId)
+		if (Entry && Entry->GPUSkin && Entry->PositionAllocation && Entry->GPUSkin->GetComponentId() == ComponentId)
 		{
 			const uint32 LODIndex = Entry->GPUSkin->GetLOD();
 			const FSkeletalMeshRenderData& RenderData = Entry->GPUSkin->GetSkeletalMeshRenderData();
@@ -1999,7 +2070,7 @@ FCachedGeometry FGPUSkinCache::GetCachedGeometry(uint32 ComponentId) const
 
 FCachedGeometry::Section FGPUSkinCache::GetCachedGeometry(FGPUSkinCacheEntry* InOutEntry, uint32 sectionIndex)
 {
-	return InOutEntry ? InOutEntry->GetCachedGeometry(sectionIndex) : FCachedGeometry::Section();
+	return InOutEntry && InOutEntry->PositionAllocation ? InOutEntry->GetCachedGeometry(sectionIndex) : FCachedGeometry::Section();
 }
 
 void FGPUSkinCache::UpdateSkinWeightBuffer(FGPUSkinCacheEntry* Entry)
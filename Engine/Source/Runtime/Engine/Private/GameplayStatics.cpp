@@ -42,6 +42,7 @@
 #include "Misc/EngineVersion.h"
 #include "ContentStreaming.h"
 #include "Async/Async.h"
+#include "UObject/GarbageCollection.h"
 #include "Engine/SceneCapture2D.h"
 #include "Components/SceneCaptureComponent2D.h"
 #include "Sound/SoundCue.h"
@@ -2111,8 +2112,43 @@ bool UGameplayStatics::SaveDataToSlot(const TArray<uint8>& InSaveData, const FSt
 	return false;
 }
 
+static int32 GAsyncSaveGameSerializeOnWorker = 1;
+static FAutoConsoleVariableRef CVarAsyncSaveGameSerializeOnWorker(
+	TEXT("SaveGame.AsyncSerializeOnWorker"),
+	GAsyncSaveGameSerializeOnWorker,
+	TEXT("When set, AsyncSaveGameToSlot only copies the save game object on the game thread and serializes the copy on a worker thread."),
+	ECVF_Default
+);
+
 void UGameplayStatics::AsyncSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, FAsyncSaveGameToSlotDelegate SavedDelegate)
 {
+	if (SaveGameObject && GAsyncSaveGameSerializeOnWorker && FApp::ShouldUseThreadingForPerformance())
+	{
+		// Copying the properties into a new object is much cheaper than the tagged serialization, and leaves the game free
+		// to keep changing the original. The copy is rooted until the worker is done with it, and GC is held off while it
+		// is being serialized since GC could clear its references.
+		USaveGame* Snapshot = NewObject<USaveGame>(GetTransientPackage(), SaveGameObject->GetClass(), NAME_None, RF_Transient, SaveGameObject);
+		Snapshot->AddToRoot();
+
+		AsyncTask(ENamedThreads::AnyHiPriThreadNormalTask, [Snapshot, SlotName, UserIndex, SavedDelegate]()
+		{
+			TArray<uint8> ObjectBytes;
+			{
+				FGCScopeGuard GCGuard;
+				SaveGameToMemory(Snapshot, ObjectBytes);
+			}
+
+			bool bSuccess = SaveDataToSlot(ObjectBytes, SlotName, UserIndex);
+
+			AsyncTask(ENamedThreads::GameThread, [Snapshot, SlotName, UserIndex, SavedDelegate, bSuccess]()
+			{
+				Snapshot->RemoveFromRoot();
+				SavedDelegate.ExecuteIfBound(SlotName, UserIndex, bSuccess);
+			});
+		});
+		return;
+	}
+
 	TArray<uint8> ObjectBytes;
 	if (SaveGameToMemory(SaveGameObject, ObjectBytes))
 	{
@@ -13,6 +13,8 @@
 #include "Async/TaskGraphInterfaces.h"
 #include "EngineStats.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
+#include "Misc/MemStack.h"
 #include "PrimitiveViewRelevance.h"
 #include "ConvexVolume.h"
 #include "AI/NavigationSystemBase.h"
@@ -132,6 +134,14 @@ static TAutoConsoleVariable<int32> CVarFoliageUseInstanceRuns(
 	0,
 	TEXT("Whether to use the InstanceRuns feature of FMeshBatch to compress foliage draw call data sent to the renderer.  Not supported by the Mesh Draw Command pipeline."));
 
+static int32 GFoliageParallelTraversalMinNodes = 0;
+static FAutoConsoleVariableRef CVarFoliageParallelTraversalMinNodes(
+	TEXT("foliage.ParallelTraversalMinNodes"),
+	GFoliageParallelTraversalMinNodes,
+	TEXT("If greater than zero, cluster trees with at least this many nodes have the subtrees below their root culled and LODed in parallel on task threads.\n")
+	TEXT("The resulting runs are identical to the serial traversal. 0 always traverses on the rendering thread (default)."),
+	ECVF_RenderThreadSafe);
+
 DECLARE_CYCLE_STAT(TEXT("Traversal Time"),STAT_FoliageTraversalTime,STATGROUP_Foliage);
 DECLARE_CYCLE_STAT(TEXT("Build Time"), STAT_FoliageBuildTime, STATGROUP_Foliage);
 DECLARE_CYCLE_STAT(TEXT("Batch Time"),STAT_FoliageBatchTime,STATGROUP_Foliage);
@@ -1007,6 +1017,9 @@ public:
 
 	template<bool TUseVector>
 	void Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false) const;
+
+	template<bool TUseVector>
+	void TraverseParallel(const FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false) const;
 };
 
 struct FFoliageRenderInstanceParams
@@ -1274,6 +1287,99 @@ void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParam
 	}
 }
 
+template<bool TUseVector>
+void FHierarchicalStaticMeshSceneProxy::TraverseParallel(const FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const
+{
+	const FClusterNode& Node = Params.Tree[0];
+
+	// The root is processed here so that each of its children can be traversed independently. Occlusion is only
+	// tested on the rendering thread path since the root itself may be an occlusion node.
+	if (Node.FirstChild < 0 || Params.FirstOcclusionNode == 0)
+	{
+		Traverse<TUseVector>(Params, 0, MinLOD, MaxLOD, bFullyContained);
+		return;
+	}
+
+	if (!bFullyContained)
+	{
+		if (CullNode<TUseVector>(Params, Node, bFullyContained))
+		{
+			return;
+		}
+	}
+
+	if (MinLOD != MaxLOD)
+	{
+		CalcLOD(MinLOD, MaxLOD, Node.BoundMin, Node.BoundMax, Params.ViewOriginInLocalZero, Params.ViewOriginInLocalOne, Params.LODPlanesMin, Params.LODPlanesMax);
+
+		if (MinLOD >= Params.LODs)
+		{
+			return;
+		}
+	}
+
+	bool bShouldGroup = (Node.LastInstance - Node.FirstInstance + 1) < Params.MinInstancesToSplit[MinLOD]
+		&& CanGroup(Node.BoundMin, Node.BoundMax, Params.ViewOriginInLocalZero, Params.ViewOriginInLocalOne, Params.LODPlanesMax[Params.LODs - 1]);
+	bool bSplit = (!bFullyContained || MinLOD < MaxLOD || 0 < Params.FirstOcclusionNode)
+		&& !bShouldGroup;
+
+	if (!bSplit)
+	{
+		MaxLOD = FMath::Min(MaxLOD, Params.LODs - 1);
+		Params.AddRun(MinLOD, MaxLOD, Node);
+		return;
+	}
+
+	struct FSubtreeRuns
+	{
+		TArray<uint32> MultipleLODRuns[MAX_STATIC_MESH_LODS];
+		TArray<uint32> SingleLODRuns[MAX_STATIC_MESH_LODS];
+		int32 TotalSingleLODInstances[MAX_STATIC_MESH_LODS];
+		int32 TotalMultipleLODInstances[MAX_STATIC_MESH_LODS];
+	};
+
+	// The run arrays use the scene rendering allocator, which must not be grown on task threads. Each subtree is traversed
+	// into a copy of the params inside a mark of the task thread's mem stack and its runs are moved to the heap before the mark is popped.
+	check(Params.SingleLODRuns[0].Num() == 0 && Params.MultipleLODRuns[0].Num() == 0);
+	const int32 NumChildren = Node.LastChild - Node.FirstChild + 1;
+	TArray<FSubtreeRuns> SubtreeRuns;
+	SubtreeRuns.SetNum(NumChildren);
+
+	ParallelFor(NumChildren, [this, &Params, &Node, &SubtreeRuns, MinLOD, MaxLOD, bFullyContained](int32 ChildOffset)
+	{
+		FMemMark Mark(FMemStack::Get());
+		FFoliageCullInstanceParams SubtreeParams(Params);
+		Traverse<TUseVector>(SubtreeParams, Node.FirstChild + ChildOffset, MinLOD, MaxLOD, bFullyContained);
+
+		FSubtreeRuns& Runs = SubtreeRuns[ChildOffset];
+		for (int32 LODIndex = 0; LODIndex < MAX_STATIC_MESH_LODS; LODIndex++)
+		{
+			Runs.SingleLODRuns[LODIndex] = SubtreeParams.SingleLODRuns[LODIndex];
+			Runs.MultipleLODRuns[LODIndex] = SubtreeParams.MultipleLODRuns[LODIndex];
+			Runs.TotalSingleLODInstances[LODIndex] = SubtreeParams.TotalSingleLODInstances[LODIndex];
+			Runs.TotalMultipleLODInstances[LODIndex] = SubtreeParams.TotalMultipleLODInstances[LODIndex];
+		}
+	});
+
+	// Children cover consecutive instance ranges, appending them in order merges runs exactly like the serial traversal
+	for (const FSubtreeRuns& Runs : SubtreeRuns)
+	{
+		for (int32 LODIndex = 0; LODIndex < MAX_STATIC_MESH_LODS; LODIndex++)
+		{
+			for (int32 RunIndex = 0; RunIndex + 1 < Runs.SingleLODRuns[LODIndex].Num(); RunIndex += 2)
+			{
+				FFoliageRenderInstanceParams::AddRun(Params.SingleLODRuns[LODIndex], Runs.SingleLODRuns[LODIndex][RunIndex], Runs.SingleLODRuns[LODIndex][RunIndex + 1]);
+			}
+			for (int32 RunIndex = 0; RunIndex + 1 < Runs.MultipleLODRuns[LODIndex].Num(); RunIndex += 2)
+			{
+				FFoliageRenderInstanceParams::AddRun(Params.MultipleLODRuns[LODIndex], Runs.MultipleLODRuns[LODIndex][RunIndex], Runs.MultipleLODRuns[LODIndex][RunIndex + 1]);
+			}
+			Params.TotalSingleLODInstances[LODIndex] += Runs.TotalSingleLODInstances[LODIndex];
+			Params.TotalMultipleLODInstances[LODIndex] += Runs.TotalMultipleLODInstances[LODIndex];
+		}
+	}
+}
+
 struct FFoliageElementParams
 {
 	const FInstancingUserData* PassUserData[2];
@@ -1703,9 +1809,22 @@ void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<cons
 						UseMaxLOD = FMath::Clamp(Force, 0, InstanceParams.LODs - 1);
 					}
 
+					const bool bParallelTraversal = GFoliageParallelTraversalMinNodes > 0 && ClusterTree.Num() >= GFoliageParallelTraversalMinNodes && FApp::ShouldUseThreadingForPerformance();
+
 					if (CVarCullAll.GetValueOnRenderThread() < 1)
 					{
-						if (bUseVectorCull)
+						if (bParallelTraversal)
+						{
+							if (bUseVectorCull)
+							{
+								TraverseParallel<true>(InstanceParams, UseMinLOD, UseMaxLOD, bDisableCull);
+							}
+							else
+							{
+								TraverseParallel<false>(InstanceParams, UseMinLOD, UseMaxLOD, bDisableCull);
+							}
+						}
+						else if (bUseVectorCull)
 						{
 							Traverse<true>(InstanceParams, 0, UseMinLOD, UseMaxLOD, bDisableCull);
 						}
@@ -2379,8 +2498,8 @@ int32 UHierarchicalInstancedStaticMeshComponent::AddInstance(const FTransform& I
 	{	
 		check(InstanceIndex == InstanceReorderTable.Num());
 
+		// Instances added during an async build don't invalidate it, they are appended as unbuilt instances when it's applied
 		bIsOutOfDate = true;
-		bConcurrentChanges |= IsAsyncBuilding();
 	
 		int32 InitialBufferOffset = InstanceCountToRender - InstanceReorderTable.Num(); // Until the build is done, we need to always add at the end of the buffer/reorder table
 		InstanceReorderTable.Add(InitialBufferOffset + InstanceIndex); // add to the end until the build is completed
@@ -2417,7 +2536,6 @@ TArray<int32> UHierarchicalInstancedStaticMeshComponent::AddInstances(const TArr
 	if (InstanceIndices.Num() > 0 && GetStaticMesh() && GetStaticMesh()->HasValidRenderData())
 	{
 		bIsOutOfDate = true;
-		bConcurrentChanges |= IsAsyncBuilding();
 
 		const int32 Count = InstanceIndices.Num();
 		
@@ -2702,6 +2820,12 @@ void UHierarchicalInstancedStaticMeshComponent::ApplyBuildTreeAsync(ENamedThread
 
 	// Completed the build
 	ApplyBuildTree(Builder.Get());
+
+	// Instances were added while building, they were kept as unbuilt instances so fold them into the tree with another build
+	if (bIsOutOfDate)
+	{
+		BuildTreeAsync();
+	}
 }
 
 void UHierarchicalInstancedStaticMeshComponent::ApplyEmpty()
@@ -2731,7 +2855,8 @@ void UHierarchicalInstancedStaticMeshComponent::ApplyBuildTree(FClusterBuilder&
 	bIsOutOfDate = false;
 	InstanceUpdateCmdBuffer.Reset();
 
-	check(Builder.Result->InstanceReorderTable.Num() == PerInstanceSMData.Num());
+	// Instances can only have been appended since the build started, anything else discards the build
+	check(Builder.Result->InstanceReorderTable.Num() <= PerInstanceSMData.Num());
 
 	NumBuiltInstances = Builder.Result->InstanceReorderTable.Num();
 	NumBuiltRenderInstances = Builder.Result->SortedInstances.Num();
@@ -2756,8 +2881,6 @@ void UHierarchicalInstancedStaticMeshComponent::ApplyBuildTree(FClusterBuilder&
 	InstanceCountToRender = NumBuiltInstances;
 	InstanceUpdateCmdBuffer.Reset();
 
-	check(InstanceReorderTable.Num() == PerInstanceSMData.Num());
-
 	// create per-instance hit-proxies if needed
 	TArray<TRefCountPtr<HHitProxy>> HitProxies;
 	CreateHitProxyData(HitProxies);
@@ -2773,6 +2896,34 @@ void UHierarchicalInstancedStaticMeshComponent::ApplyBuildTree(FClusterBuilder&
 	}
 	PerInstanceRenderData->HitProxies = MoveTemp(HitProxies);
 
+	// Append the instances added during an async build at the end of the buffer, the same way AddInstance does until the next build
+	if (NumBuiltInstances < PerInstanceSMData.Num())
+	{
+		bIsOutOfDate = true;
+
+		const FBox MeshBox = GetStaticMesh()->GetBounds().GetBox();
+		const bool bCanUpdateInPlace = PerInstanceRenderData->InstanceBuffer.RequireCPUAccess;
+		for (int32 InstanceIndex = NumBuiltInstances; InstanceIndex < PerInstanceSMData.Num(); ++InstanceIndex)
+		{
+			const FMatrix& InstanceTransform = PerInstanceSMData[InstanceIndex].Transform;
+
+			const int32 InitialBufferOffset = InstanceCountToRender - InstanceReorderTable.Num();
+			InstanceReorderTable.Add(InitialBufferOffset + InstanceIndex);
+			if (bCanUpdateInPlace)
+			{
+				++InstanceCountToRender;
+			}
+
+			InstanceUpdateCmdBuffer.AddInstance(InstanceTransform);
+
+			const FBox NewInstanceBounds = MeshBox.TransformBy(InstanceTransform);
+			UnbuiltInstanceBounds += NewInstanceBounds;
+			UnbuiltInstanceBoundsList.Add(NewInstanceBounds);
+		}
+	}
+
+	check(InstanceReorderTable.Num() == PerInstanceSMData.Num());
+
 	FlushAccumulatedNavigationUpdates();
 	PostBuildStats();
 	MarkRenderStateDirty();
@@ -2097,11 +2097,29 @@ FBoxSphereBounds UInstancedStaticMeshComponent::CalcBounds(const FTransform& Bou
 		FMatrix BoundTransformMatrix = BoundTransform.ToMatrixWithScale();
 
 		FBoxSphereBounds RenderBounds = GetStaticMesh()->GetBounds();
-		FBoxSphereBounds NewBounds = RenderBounds.TransformBy(PerInstanceSMData[0].Transform * BoundTransformMatrix);
+		FBoxSphereBounds NewBounds;
 
-		for (int32 InstanceIndex = 1; InstanceIndex < PerInstanceSMData.Num(); InstanceIndex++)
+		// Instances are transformed in batches, then accumulated in the same order as one at a time
+		const int32 BatchSize = 64;
+		TArray<FMatrix, TInlineAllocator<BatchSize>> InstanceMatrices;
+		TArray<FBoxSphereBounds, TInlineAllocator<BatchSize>> InstanceBounds;
+		for (int32 BatchStart = 0; BatchStart < PerInstanceSMData.Num(); BatchStart += BatchSize)
 		{
-			NewBounds = NewBounds + RenderBounds.TransformBy(PerInstanceSMData[InstanceIndex].Transform * BoundTransformMatrix);
+			const int32 NumInBatch = FMath::Min(BatchSize, PerInstanceSMData.Num() - BatchStart);
+			InstanceMatrices.SetNumUninitialized(NumInBatch, false);
+			InstanceBounds.SetNumUninitialized(NumInBatch, false);
+
+			for (int32 Index = 0; Index < NumInBatch; Index++)
+			{
+				InstanceMatrices[Index] = PerInstanceSMData[BatchStart + Index].Transform * BoundTransformMatrix;
+			}
+
+			RenderBounds.TransformByBatch(InstanceMatrices.GetData(), InstanceBounds.GetData(), NumInBatch);
+
+			for (int32 Index = 0; Index < NumInBatch; Index++)
+			{
+				NewBounds = (BatchStart + Index == 0) ? InstanceBounds[Index] : NewBounds + InstanceBounds[Index];
+			}
 		}
 
 		return NewBounds;
@@ -73,6 +73,49 @@ static FAutoConsoleVariableRef CVarActorClusteringEnabled(
 	ECVF_Default
 );
 
+int32 GActorClusteringAutomatic = 0;
+static FAutoConsoleVariableRef CVarActorClusteringAutomatic(
+	TEXT("gc.ActorClusteringAutomatic"),
+	GActorClusteringAutomatic,
+	TEXT("Whether level actor clusters also include actors that don't set bCanBeInCluster but share the lifetime of their level\n")
+	TEXT("(native, not replicated, never ticking, static root component), and whether clusters dissolved by GC are created again on the next world tick."),
+	ECVF_Default
+);
+
+static int32 GPrecomputeComponentBounds = 1;
+static FAutoConsoleVariableRef CVarPrecomputeComponentBounds(
+	TEXT("s.PrecomputeComponentBounds"),
+	GPrecomputeComponentBounds,
+	TEXT("Whether cooked levels store the world bounds of their static components, so they don't need to be computed when the level streams in."),
+	ECVF_Default
+);
+
+namespace UE4Level_Private
+{
+	static TArray<TWeakObjectPtr<ULevel>> LevelsPendingActorClusterRecreation;
+
+	static void RecreateDissolvedActorClusters(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (LevelsPendingActorClusterRecreation.Num() == 0 || IsGarbageCollecting())
+		{
+			return;
+		}
+
+		TArray<TWeakObjectPtr<ULevel>> Levels = MoveTemp(LevelsPendingActorClusterRecreation);
+		for (const TWeakObjectPtr<ULevel>& LevelPtr : Levels)
+		{
+			// Levels that are being streamed out stay unclustered, they'll create a new cluster when they're loaded again
+			ULevel* Level = LevelPtr.Get();
+			if (Level && Level->bIsVisible && !Level->bIsBeingRemoved)
+			{
+				Level->ActorCluster = nullptr;
+				Level->bActorClusterCreated = false;
+				Level->CreateCluster();
+			}
+		}
+	}
+}
+
 #if WITH_EDITOR
 FLevelPartitionOperationScope::FLevelPartitionOperationScope(ULevel* InLevel)
 {
@@ -666,13 +709,98 @@ void ULevel::PreSave(const class ITargetPlatform* TargetPlatform)
 			}
 		}
 	}
+
+	// Only cooked levels carry the bounds, the editor always computes them
+	PrecomputedComponentBounds.Reset();
+	if (TargetPlatform != nullptr && GPrecomputeComponentBounds && !IsTemplate())
+	{
+		BuildPrecomputedComponentBounds();
+	}
 #endif // WITH_EDITOR
 }
 
+#if WITH_EDITOR
+void ULevel::BuildPrecomputedComponentBounds()
+{
+	for (AActor* Actor : Actors)
+	{
+		if (!Actor || Actor->IsPendingKill() || Actor->IsRootComponentMovable())
+		{
+			continue;
+		}
+
+		for (UActorComponent* ActorComponent : Actor->GetComponents())
+		{
+			USceneComponent* Component = Cast<USceneComponent>(ActorComponent);
+			if (!Component || Component->Mobility != EComponentMobility::Static || Component->bUseAttachParentBound || Component->IsEditorOnly())
+			{
+				continue;
+			}
+
+			// Components aren't registered while cooking, the transform is built from the attachment chain. Sockets are
+			// only known once the parent is registered, and absolute transforms of components are taken as they are.
+			FTransform ComponentToWorld = Component->GetRelativeTransform();
+			bool bKnownTransform = true;
+			for (const USceneComponent* Child = Component; Child->GetAttachParent() != nullptr; Child = Child->GetAttachParent())
+			{
+				if (Child->GetAttachSocketName() != NAME_None || Child->IsUsingAbsoluteLocation() || Child->IsUsingAbsoluteRotation() || Child->IsUsingAbsoluteScale())
+				{
+					bKnownTransform = false;
+					break;
+				}
+
+				ComponentToWorld = ComponentToWorld * Child->GetAttachParent()->GetRelativeTransform();
+			}
+
+			if (bKnownTransform)
+			{
+				FPrecomputedComponentBounds& Precomputed = PrecomputedComponentBounds.AddDefaulted_GetRef();
+				Precomputed.Component = Component;
+				Precomputed.Transform = ComponentToWorld;
+				Precomputed.Bounds = Component->CalcBounds(ComponentToWorld);
+			}
+		}
+	}
+}
+#endif // WITH_EDITOR
+
+bool ULevel::ConsumePrecomputedBounds(const USceneComponent& Component, FBoxSphereBounds& OutBounds)
+{
+	if (PrecomputedBoundsMap.Num() == 0)
+	{
+		return false;
+	}
+
+	FPrecomputedComponentBounds Precomputed;
+	if (!PrecomputedBoundsMap.RemoveAndCopyValue(&Component, Precomputed))
+	{
+		return false;
+	}
+
+	// Level transforms, or anything moving the component before it registers, invalidate the bounds
+	if (!Component.GetComponentTransform().Equals(Precomputed.Transform))
+	{
+		return false;
+	}
+
+	OutBounds = Precomputed.Bounds;
+	return true;
+}
+
 void ULevel::PostLoad()
 {
 	Super::PostLoad();
 
+	for (const FPrecomputedComponentBounds& Precomputed : PrecomputedComponentBounds)
+	{
+		// Components stripped by the cook are null
+		if (Precomputed.Component != nullptr)
+		{
+			PrecomputedBoundsMap.Add(Precomputed.Component, Precomputed);
+		}
+	}
+	PrecomputedComponentBounds.Empty();
+
 #if WITH_EDITOR
 	// if we use external actors, load dynamic actors here
 	if (IsUsingExternalActors() && !bWasDuplicated)
@@ -813,7 +941,7 @@ void ULevel::CreateCluster()
 		for (int32 ActorIndex = Actors.Num() - 1; ActorIndex >= 0; --ActorIndex)
 		{
 			AActor* Actor = Actors[ActorIndex];
-			if (Actor && Actor->CanBeInCluster())
+			if (Actor && !Actor->IsPendingKill() && Actor->CanBeInCluster())
 			{
 				ClusterActors.Add(Actor);
 			}
@@ -824,7 +952,9 @@ void ULevel::CreateCluster()
 		}
 		if (ClusterActors.Num())
 		{
-			ActorCluster = NewObject<ULevelActorContainer>(this, TEXT("ActorCluster"), RF_Transient);
+			// A dissolved cluster's container may not have been purged yet when the cluster is created again
+			const FName ActorClusterName = MakeUniqueObjectName(this, ULevelActorContainer::StaticClass(), TEXT("ActorCluster"));
+			ActorCluster = NewObject<ULevelActorContainer>(this, ActorClusterName, RF_Transient);
 			ActorCluster->Actors = MoveTemp(ClusterActors);
 			ActorCluster->CreateCluster();
 		}
@@ -832,6 +962,22 @@ void ULevel::CreateCluster()
 	}
 }
 
+void ULevel::RequestActorClusterRecreation()
+{
+	if (!GActorClusteringAutomatic || IsPendingKill() || IsUnreachable())
+	{
+		return;
+	}
+
+	static bool bRecreateActorClustersRegistered = false;
+	if (!bRecreateActorClustersRegistered)
+	{
+		FWorldDelegates::OnWorldTickStart.AddStatic(&UE4Level_Private::RecreateDissolvedActorClusters);
+		bRecreateActorClustersRegistered = true;
+	}
+	UE4Level_Private::LevelsPendingActorClusterRecreation.AddUnique(this);
+}
+
 void ULevel::PreDuplicate(FObjectDuplicationParameters& DupParams)
 {
 	Super::PreDuplicate(DupParams);
@@ -1100,7 +1246,7 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 	}
 
 	// Do BSP on the first pass.
-	if (CurrentActorIndexForUpdateComponents == 0)
+	if (CurrentActorIndexForUpdateComponents == 0 && !bIsRerunningConstructionScripts)
 	{
 		UpdateModelComponents();
 		// Sort actors to ensure that parent actors will be registered before child actors
@@ -1115,7 +1261,7 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 		OwningWorld->SetAllowDeferredPhysicsStateCreation(true);
 	}
 
-	while (CurrentActorIndexForUpdateComponents < Actors.Num())
+	while (!bIsRerunningConstructionScripts && CurrentActorIndexForUpdateComponents < Actors.Num())
 	{
 		AActor* Actor = Actors[CurrentActorIndexForUpdateComponents];
 		bool bAllComponentsRegistered = true;
@@ -1148,46 +1294,72 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 	}
 
 	// See whether we are done.
-	if (CurrentActorIndexForUpdateComponents >= Actors.Num())
+	if (bIsRerunningConstructionScripts || CurrentActorIndexForUpdateComponents >= Actors.Num())
 	{
-		CurrentActorIndexForUpdateComponents	= 0;
-		bHasCurrentActorCalledPreRegister		= false;
-		bAreComponentsCurrentlyRegistered		= true;
-
-#if PERF_TRACK_DETAILED_ASYNC_STATS
-		QUICK_SCOPE_CYCLE_COUNTER(STAT_ULevel_IncrementalUpdateComponents_RerunConstructionScripts);
-#endif
-		if (bRerunConstructionScripts && !IsTemplate() && !GIsUCCMakeStandaloneHeaderGenerator)
+		if (!bIsRerunningConstructionScripts)
 		{
-			// We need to process pending adds prior to rerunning the construction scripts, which may internally
-			// perform removals / adds themselves.
-			if (Context)
+			CurrentActorIndexForUpdateComponents	= 0;
+			bHasCurrentActorCalledPreRegister		= false;
+
+			if (bRerunConstructionScripts && !IsTemplate() && !GIsUCCMakeStandaloneHeaderGenerator)
 			{
-				Context->Process();
+				// We need to process pending adds prior to rerunning the construction scripts, which may internally
+				// perform removals / adds themselves.
+				if (Context)
+				{
+					Context->Process();
+				}
+				bIsRerunningConstructionScripts = true;
 			}
+		}
 
+		if (bIsRerunningConstructionScripts)
+		{
+#if PERF_TRACK_DETAILED_ASYNC_STATS
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_ULevel_IncrementalUpdateComponents_RerunConstructionScripts);
+#endif
 			// Don't rerun construction scripts until after all actors' components have been registered.  This
 			// is necessary because child attachment lists are populated during registration, and running construction
 			// scripts requires that the attachments are correctly initialized.
 			// Don't use ranged for as construction scripts can manipulate the actor array
-			for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ++ActorIndex)
+			while (CurrentActorIndexForRerunConstructionScripts < Actors.Num())
 			{
-				if (AActor* Actor = Actors[ActorIndex])
+				AActor* Actor = Actors[CurrentActorIndexForRerunConstructionScripts++];
+				// Child actors have already been built and initialized up by their parent and they should not be reconstructed again
+				if (Actor && !Actor->IsChildActor())
 				{
-					// Child actors have already been built and initialized up by their parent and they should not be reconstructed again
-					if (!Actor->IsChildActor())
-					{
 #if PERF_TRACK_DETAILED_ASYNC_STATS
-						FScopeCycleCounterUObject ContextScope(Actor);
+					FScopeCycleCounterUObject ContextScope(Actor);
 #endif
-						Actor->RerunConstructionScripts();
+					Actor->RerunConstructionScripts();
+
+					// Construction scripts are the most expensive part of the update, so an incremental update
+					// returns to the outer loop after each of them as well
+					if (NumComponentsToUpdate != 0)
+					{
+						break;
 					}
 				}
 			}
-			bHasRerunConstructionScripts = true;
+
+			if (CurrentActorIndexForRerunConstructionScripts >= Actors.Num())
+			{
+				CurrentActorIndexForRerunConstructionScripts = 0;
+				bIsRerunningConstructionScripts = false;
+				bHasRerunConstructionScripts = true;
+			}
 		}
 
-		CreateCluster();
+		// Components only count as registered once the construction scripts have run as well, so a time sliced
+		// AddToWorld keeps calling in until the whole update is done
+		if (!bIsRerunningConstructionScripts)
+		{
+			bAreComponentsCurrentlyRegistered = true;
+			CreateCluster();
+
+			// Whatever wasn't used by now belongs to components that won't register
+			PrecomputedBoundsMap.Empty();
+		}
 	}
 	// Only the game can use incremental update functionality.
 	else
@@ -2023,30 +2195,45 @@ void ULevel::ReleaseRenderingResources()
 	}
 }
 
-void ULevel::RouteActorInitialize()
+bool ULevel::RouteActorInitialize(int32 NumActorsToProcess)
 {
 	TRACE_OBJECT_EVENT(this, RouteActorInitialize);
 
-	// Send PreInitializeComponents and collect volumes.
-	for( int32 Index = 0; Index < Actors.Num(); ++Index )
+	// A value of 0 means that we want to process all actors, otherwise we return after NumActorsToProcess actors
+	// did work and resume from RouteActorInitializationState and RouteActorInitializationIndex on the next call.
+	int32 NumActorsProcessed = 0;
+	auto ShouldYield = [&NumActorsProcessed, NumActorsToProcess]()
 	{
-		AActor* const Actor = Actors[Index];
-		if( Actor && !Actor->IsActorInitialized() )
+		return NumActorsToProcess > 0 && ++NumActorsProcessed >= NumActorsToProcess;
+	};
+
+	if (RouteActorInitializationState == ERouteActorInitializationState::Preinitialize)
+	{
+		// Send PreInitializeComponents and collect volumes.
+		while (RouteActorInitializationIndex < Actors.Num())
 		{
-			Actor->PreInitializeComponents();
+			AActor* const Actor = Actors[RouteActorInitializationIndex++];
+			if( Actor && !Actor->IsActorInitialized() )
+			{
+				Actor->PreInitializeComponents();
+				if (ShouldYield())
+				{
+					return false;
+				}
+			}
 		}
-	}
 
-	const bool bCallBeginPlay = OwningWorld->HasBegunPlay();
-	TArray<AActor *> ActorsToBeginPlay;
+		RouteActorInitializationState = ERouteActorInitializationState::Initialize;
+		RouteActorInitializationIndex = 0;
+	}
 
-	// Send InitializeComponents on components and PostInitializeComponents.
-	for( int32 Index = 0; Index < Actors.Num(); ++Index )
+	if (RouteActorInitializationState == ERouteActorInitializationState::Initialize)
 	{
-		AActor* const Actor = Actors[Index];
-		if( Actor )
+		// Send InitializeComponents on components and PostInitializeComponents.
+		while (RouteActorInitializationIndex < Actors.Num())
 		{
-			if( !Actor->IsActorInitialized() )
+			AActor* const Actor = Actors[RouteActorInitializationIndex++];
+			if( Actor && !Actor->IsActorInitialized() )
 			{
 				// Call Initialize on Components.
 				Actor->InitializeComponents();
@@ -2057,21 +2244,42 @@ void ULevel::RouteActorInitialize()
 					UE_LOG(LogActor, Fatal, TEXT("%s failed to route PostInitializeComponents.  Please call Super::PostInitializeComponents() in your <className>::PostInitializeComponents() function. "), *Actor->GetFullName() );
 				}
 
-				if (bCallBeginPlay && !Actor->IsChildActor())
+				if (ShouldYield())
 				{
-					ActorsToBeginPlay.Add(Actor);
+					return false;
 				}
 			}
 		}
+
+		RouteActorInitializationState = ERouteActorInitializationState::BeginPlay;
+		RouteActorInitializationIndex = 0;
 	}
 
-	// Do this in a second pass to make sure they're all initialized before begin play starts
-	for (int32 ActorIndex = 0; ActorIndex < ActorsToBeginPlay.Num(); ActorIndex++)
+	if (RouteActorInitializationState == ERouteActorInitializationState::BeginPlay)
 	{
-		AActor* Actor = ActorsToBeginPlay[ActorIndex];
-		SCOPE_CYCLE_COUNTER(STAT_ActorBeginPlay);
-		Actor->DispatchBeginPlay(/*bFromLevelStreaming*/ true);
+		// Do this in a separate pass to make sure they're all initialized before begin play starts
+		if (OwningWorld->HasBegunPlay())
+		{
+			while (RouteActorInitializationIndex < Actors.Num())
+			{
+				AActor* const Actor = Actors[RouteActorInitializationIndex++];
+				if (Actor && Actor->IsActorInitialized() && !Actor->IsChildActor() && !Actor->HasActorBegunPlay() && !Actor->IsActorBeginningPlay())
+				{
+					SCOPE_CYCLE_COUNTER(STAT_ActorBeginPlay);
+					Actor->DispatchBeginPlay(/*bFromLevelStreaming*/ true);
+					if (ShouldYield())
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		RouteActorInitializationState = ERouteActorInitializationState::Preinitialize;
+		RouteActorInitializationIndex = 0;
 	}
+
+	return true;
 }
 
 UPackage* ULevel::CreateMapBuildDataPackage() const
@@ -62,6 +62,12 @@ static TAutoConsoleVariable<int32> CVarAllowDestroyNonNetworkActors(
 	TEXT("When enabled, allows Clients in Networked Games to destroy non-networked actors (AActor::Role == ROLE_None). Does not change behavior on Servers or Standalone games.")
 );
 
+static TAutoConsoleVariable<float> CVarQueuedActorSpawnTimeLimit(
+	TEXT("world.QueuedActorSpawnTimeLimit"),
+	2.0f,
+	TEXT("Maximum time (ms per frame) spent spawning actors queued with UWorld::SpawnActorQueued. At least one queued actor is spawned every frame."),
+	ECVF_Default);
+
 #define LINE_CHECK_TRACING 0
 
 #if LINE_CHECK_TRACING
@@ -593,6 +599,65 @@ AActor* UWorld::SpawnActor( UClass* Class, FTransform const* UserTransformPtr, c
 	return Actor;
 }
 
+void UWorld::SpawnActorQueued( UClass* Class, FTransform const& Transform, const FActorSpawnParameters& SpawnParameters, FOnQueuedActorSpawned OnSpawned )
+{
+	check(IsInGameThread());
+	checkf(!SpawnParameters.bDeferConstruction, TEXT("SpawnActorQueued does not support deferred construction"));
+
+	FQueuedActorSpawn& QueuedSpawn = QueuedActorSpawns.AddDefaulted_GetRef();
+	QueuedSpawn.Class = Class;
+	QueuedSpawn.Transform = Transform;
+	QueuedSpawn.SpawnParameters = SpawnParameters;
+	QueuedSpawn.Template = SpawnParameters.Template;
+	QueuedSpawn.Owner = SpawnParameters.Owner;
+	QueuedSpawn.Instigator = SpawnParameters.Instigator;
+	QueuedSpawn.OverrideLevel = SpawnParameters.OverrideLevel;
+	QueuedSpawn.OnSpawned = MoveTemp(OnSpawned);
+}
+
+void UWorld::ProcessQueuedActorSpawns()
+{
+	if (GetNumQueuedActorSpawns() == 0)
+	{
+		return;
+	}
+
+	const double TimeLimitSeconds = CVarQueuedActorSpawnTimeLimit.GetValueOnGameThread() / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	while (NextQueuedActorSpawnIndex < QueuedActorSpawns.Num())
+	{
+		// Spawning may queue further actors and reallocate the array, so take the request out first
+		FQueuedActorSpawn QueuedSpawn = MoveTemp(QueuedActorSpawns[NextQueuedActorSpawnIndex++]);
+
+		// Anything the parameters referenced that was destroyed in the meantime fails the spawn rather than changing its meaning
+		FActorSpawnParameters& SpawnParameters = QueuedSpawn.SpawnParameters;
+		const bool bReferencesValid = QueuedSpawn.Class.IsValid()
+			&& (!SpawnParameters.Template || QueuedSpawn.Template.IsValid())
+			&& (!SpawnParameters.Owner || QueuedSpawn.Owner.IsValid())
+			&& (!SpawnParameters.Instigator || QueuedSpawn.Instigator.IsValid())
+			&& (!SpawnParameters.OverrideLevel || QueuedSpawn.OverrideLevel.IsValid());
+
+		AActor* Actor = nullptr;
+		if (bReferencesValid)
+		{
+			Actor = SpawnActor(QueuedSpawn.Class.Get(), &QueuedSpawn.Transform, SpawnParameters);
+		}
+		else
+		{
+			UE_LOG(LogSpawn, Log, TEXT("Queued spawn of %s dropped because an object referenced by its spawn parameters was destroyed"), *GetNameSafe(QueuedSpawn.Class.Get()));
+		}
+		QueuedSpawn.OnSpawned.ExecuteIfBound(Actor);
+
+		if (FPlatformTime::Seconds() - StartTime >= TimeLimitSeconds)
+		{
+			break;
+		}
+	}
+
+	QueuedActorSpawns.RemoveAt(0, NextQueuedActorSpawnIndex, false);
+	NextQueuedActorSpawnIndex = 0;
+}
+
 ABrush* UWorld::SpawnBrush()
 {
 	FActorSpawnParameters SpawnInfo;
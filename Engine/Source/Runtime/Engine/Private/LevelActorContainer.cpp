@@ -230,6 +230,7 @@ void ULevelActorContainer::OnClusterMarkedAsPendingKill()
 	ULevel* Level = CastChecked<ULevel>(GetOuter());
 	Level->ActorsForGC.Append(Actors);
 	Actors.Reset();
+	Level->RequestActorClusterRecreation();
 
 	Super::OnClusterMarkedAsPendingKill();
 }
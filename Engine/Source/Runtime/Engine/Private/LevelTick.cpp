@@ -24,6 +24,8 @@
 #include "RenderingThread.h"
 #include "Materials/MaterialParameterCollectionInstance.h"
 #include "Engine/World.h"
+#include "Components/SceneComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "GameFramework/Controller.h"
 #include "AI/NavigationSystemBase.h"
 #include "GameFramework/PlayerController.h"
@@ -783,6 +785,12 @@ void UWorld::RunTickGroup(ETickingGroup Group, bool bBlockTillComplete = true)
 	check(TickGroup == Group); // this should already be at the correct value, but we want to make sure things are happening in the right order
 	FTickTaskManagerInterface::Get().RunTickGroup(Group, bBlockTillComplete);
 	TickGroup = ETickingGroup(TickGroup + 1); // new actors go into the next tick group because this one is already gone
+
+	// Children of components moved during the group catch up once, before the next group or physics reads them
+	USceneComponent::FlushDeferredChildTransformUpdates();
+
+	// Components moved during the group query their overlaps once, at their final location
+	UPrimitiveComponent::FlushDeferredOverlapUpdates();
 }
 
 static TAutoConsoleVariable<int32> CVarAllowAsyncRenderThreadUpdates(
@@ -1019,6 +1027,10 @@ void UWorld::SendAllEndOfFrameUpdates()
 	// Allow systems to complete async work that could introduce additional components to end of frame updates
 	FWorldDelegates::OnWorldPreSendAllEndOfFrameUpdates.Broadcast(this);
 
+	// Components moved outside of the tick groups update their deferred children and overlaps before the render state is sent
+	USceneComponent::FlushDeferredChildTransformUpdates();
+	UPrimitiveComponent::FlushDeferredOverlapUpdates();
+
 	if (!HasEndOfFrameUpdates())
 	{
 		return;
@@ -1425,6 +1437,11 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 			SCOPE_CYCLE_COUNTER(STAT_TickTime);
 			FWorldDelegates::OnWorldPreActorTick.Broadcast(this, TickType, DeltaSeconds);
 		}
+		{
+			// Spawn queued actors before the tick functions of this frame are gathered so they tick right away
+			CSV_SCOPED_TIMING_STAT_EXCLUSIVE(ActorSpawning);
+			ProcessQueuedActorSpawns();
+		}
 	}
 
 	// Tick level sequence actors first
@@ -0,0 +1,235 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Net/ActorStateSnapshot.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/StructuredArchive.h"
+#include "EngineLogs.h"
+
+namespace ActorStateSnapshot
+{
+	/** The actor and its replicated components, with the names used to match them up on the reading side */
+	static void GatherObjects(AActor* Actor, TArray<TPair<FName, UObject*>>& OutObjects)
+	{
+		OutObjects.Reset();
+		OutObjects.Emplace(NAME_None, Actor);
+
+		for (UActorComponent* Component : Actor->GetReplicatedComponents())
+		{
+			if (Component && !Component->IsPendingKill())
+			{
+				OutObjects.Emplace(Component->GetFName(), Component);
+			}
+		}
+	}
+
+	static const TArray<FRepRecord>& GetReplicatedProperties(UObject* Object)
+	{
+		UClass* Class = Object->GetClass();
+		Class->SetUpRuntimeReplicationData();
+		return Class->ClassReps;
+	}
+
+	static void SerializeValue(const FRepRecord& Rep, UObject* Object, FArchive& Ar)
+	{
+		void* Value = Rep.Property->ContainerPtrToValuePtr<void>(Object, Rep.Index);
+
+		FObjectAndNameAsStringProxyArchive Proxy(Ar, true);
+		Rep.Property->SerializeItem(FStructuredArchiveFromArchive(Proxy).GetSlot(), Value);
+	}
+
+	static UObject* FindObject(const TArray<TPair<FName, UObject*>>& Objects, FName Name)
+	{
+		const TPair<FName, UObject*>* Found = Objects.FindByPredicate([Name](const TPair<FName, UObject*>& Pair) { return Pair.Key == Name; });
+		return Found ? Found->Value : nullptr;
+	}
+}
+
+void FActorSnapshotWriter::Write(AActor* Actor, FArchive& Ar, bool bForceFull)
+{
+	using namespace ActorStateSnapshot;
+
+	check(Actor && Ar.IsSaving());
+
+	FBaseline& Baseline = Baselines.FindOrAdd(FObjectKey(Actor));
+
+	uint8 bFull = bForceFull || Baseline.Sequence == 0;
+	uint32 BaselineSequence = Baseline.Sequence;
+	uint32 Sequence = ++Baseline.Sequence;
+
+	Ar << bFull;
+	Ar << Sequence;
+	if (!bFull)
+	{
+		Ar << BaselineSequence;
+	}
+
+	TArray<TPair<FName, UObject*>> Objects;
+	GatherObjects(Actor, Objects);
+
+	int32 NumObjects = Objects.Num();
+	Ar << NumObjects;
+
+	TArray<uint8> ValueBytes;
+	TArray<uint8> ChangedBytes;
+
+	for (const TPair<FName, UObject*>& Pair : Objects)
+	{
+		UObject* Object = Pair.Value;
+		const TArray<FRepRecord>& Reps = GetReplicatedProperties(Object);
+
+		// Components added since the baseline are written in full, values are absolute so a delta can mix both
+		TArray<uint32>& Hashes = Baseline.PropertyHashes.FindOrAdd(Pair.Key);
+		const bool bWriteAll = bFull || Hashes.Num() != Reps.Num();
+		if (Hashes.Num() != Reps.Num())
+		{
+			Hashes.Init(0, Reps.Num());
+		}
+
+		ChangedBytes.Reset();
+		FMemoryWriter ChangedWriter(ChangedBytes);
+		int32 NumChanged = 0;
+
+		for (int32 RepIndex = 0; RepIndex < Reps.Num(); ++RepIndex)
+		{
+			ValueBytes.Reset();
+			FMemoryWriter ValueWriter(ValueBytes);
+			SerializeValue(Reps[RepIndex], Object, ValueWriter);
+
+			const uint32 Hash = FCrc::MemCrc32(ValueBytes.GetData(), ValueBytes.Num());
+			if (!bWriteAll && Hash == Hashes[RepIndex])
+			{
+				continue;
+			}
+
+			Hashes[RepIndex] = Hash;
+
+			uint16 WriteIndex = (uint16)RepIndex;
+			ChangedWriter << WriteIndex;
+			ChangedWriter << ValueBytes;
+			++NumChanged;
+		}
+
+		FString Name = Pair.Key == NAME_None ? FString() : Pair.Key.ToString();
+		int32 NumReps = Reps.Num();
+		Ar << Name;
+		Ar << NumReps;
+		Ar << NumChanged;
+		Ar.Serialize(ChangedBytes.GetData(), ChangedBytes.Num());
+	}
+}
+
+void FActorSnapshotWriter::ResetBaseline(const AActor* Actor)
+{
+	Baselines.Remove(FObjectKey(Actor));
+}
+
+void FActorSnapshotWriter::Reset()
+{
+	Baselines.Empty();
+}
+
+bool FActorSnapshotReader::Read(AActor* Actor, FArchive& Ar)
+{
+	using namespace ActorStateSnapshot;
+
+	check(Actor && Ar.IsLoading());
+
+	uint8 bFull = 0;
+	uint32 Sequence = 0;
+	uint32 BaselineSequence = 0;
+
+	Ar << bFull;
+	Ar << Sequence;
+	if (!bFull)
+	{
+		Ar << BaselineSequence;
+
+		const uint32* AppliedSequence = Sequences.Find(FObjectKey(Actor));
+		if (!AppliedSequence || *AppliedSequence != BaselineSequence)
+		{
+			UE_LOG(LogNet, Verbose, TEXT("FActorSnapshotReader: Delta %u of %s is against %u, which wasn't applied"), Sequence, *Actor->GetName(), BaselineSequence);
+			return false;
+		}
+	}
+
+	TArray<TPair<FName, UObject*>> Objects;
+	GatherObjects(Actor, Objects);
+
+	int32 NumObjects = 0;
+	Ar << NumObjects;
+
+	TArray<uint8> ValueBytes;
+	TArray<TPair<UObject*, FProperty*>> RepNotifies;
+
+	for (int32 ObjectIndex = 0; ObjectIndex < NumObjects && !Ar.IsError(); ++ObjectIndex)
+	{
+		FString Name;
+		int32 NumReps = 0;
+		int32 NumChanged = 0;
+		Ar << Name;
+		Ar << NumReps;
+		Ar << NumChanged;
+
+		// Values of components missing on this side are skipped, they are length prefixed
+		UObject* Object = FindObject(Objects, Name.IsEmpty() ? NAME_None : FName(*Name));
+		const TArray<FRepRecord>* Reps = Object ? &GetReplicatedProperties(Object) : nullptr;
+
+		if (Reps && Reps->Num() != NumReps)
+		{
+			UE_LOG(LogNet, Warning, TEXT("FActorSnapshotReader: %s has %d replicated properties, the snapshot has %d. Are both servers running the same build?"), *Object->GetPathName(), Reps->Num(), NumReps);
+			return false;
+		}
+
+		for (int32 ChangedIndex = 0; ChangedIndex < NumChanged && !Ar.IsError(); ++ChangedIndex)
+		{
+			uint16 RepIndex = 0;
+			Ar << RepIndex;
+			Ar << ValueBytes;
+
+			if (!Reps || !Reps->IsValidIndex(RepIndex))
+			{
+				continue;
+			}
+
+			const FRepRecord& Rep = (*Reps)[RepIndex];
+
+			FMemoryReader ValueReader(ValueBytes);
+			SerializeValue(Rep, Object, ValueReader);
+
+			if (Rep.Property->HasAnyPropertyFlags(CPF_RepNotify))
+			{
+				RepNotifies.AddUnique(TPair<UObject*, FProperty*>(Object, Rep.Property));
+			}
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogNet, Warning, TEXT("FActorSnapshotReader: Snapshot %u of %s is corrupt"), Sequence, *Actor->GetName());
+		Sequences.Remove(FObjectKey(Actor));
+		return false;
+	}
+
+	Sequences.Add(FObjectKey(Actor), Sequence);
+
+	// Only RepNotifies without parameters, the previous value isn't kept around
+	for (const TPair<UObject*, FProperty*>& RepNotify : RepNotifies)
+	{
+		UFunction* Function = RepNotify.Key->FindFunction(RepNotify.Value->RepNotifyFunc);
+		if (Function && Function->NumParms == 0)
+		{
+			RepNotify.Key->ProcessEvent(Function, nullptr);
+		}
+	}
+
+	return true;
+}
+
+void FActorSnapshotReader::ResetBaseline(const AActor* Actor)
+{
+	Sequences.Remove(FObjectKey(Actor));
+}
@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Net/NetConditionsRecording.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Algo/UpperBound.h"
+#include "EngineLogs.h"
+
+TSharedPtr<const FNetConditionsRecording> FNetConditionsRecording::Load(const FString& Filename)
+{
+	check(IsInGameThread());
+
+	// Thousands of connections can replay the same recording, only keep one copy of it
+	static TMap<FString, TWeakPtr<const FNetConditionsRecording>> LoadedRecordings;
+
+	const FString FullPath = FPaths::IsRelative(Filename) ? FPaths::Combine(FPaths::ProjectDir(), Filename) : Filename;
+
+	if (TSharedPtr<const FNetConditionsRecording> Loaded = LoadedRecordings.FindRef(FullPath).Pin())
+	{
+		return Loaded;
+	}
+
+	TSharedPtr<FNetConditionsRecording> Recording = MakeShared<FNetConditionsRecording>();
+	if (!Recording->LoadFromFile(FullPath))
+	{
+		return nullptr;
+	}
+
+	LoadedRecordings.Add(FullPath, Recording);
+	return Recording;
+}
+
+bool FNetConditionsRecording::LoadFromFile(const FString& Filename)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		UE_LOG(LogNet, Warning, TEXT("FNetConditionsRecording: Could not read %s"), *Filename);
+		return false;
+	}
+
+	for (const FString& Line : Lines)
+	{
+		const FString Trimmed = Line.TrimStartAndEnd();
+		if (Trimmed.IsEmpty() || Trimmed.StartsWith(TEXT("#")))
+		{
+			continue;
+		}
+
+		TArray<FString> Values;
+		Trimmed.ParseIntoArray(Values, TEXT(","));
+
+		// Also skips the header line
+		if (Values.Num() < 3 || !Values[0].TrimStart().IsNumeric())
+		{
+			continue;
+		}
+
+		FNetConditionsSample Sample;
+		Sample.Time = FCString::Atod(*Values[0]);
+		Sample.OutLagMs = FMath::Max(FCString::Atof(*Values[1]), 0.0f);
+		Sample.OutLossPercent = FMath::Clamp(FCString::Atof(*Values[2]), 0.0f, 100.0f);
+
+		if (Values.Num() >= 5)
+		{
+			Sample.InLagMs = FMath::Max(FCString::Atof(*Values[3]), 0.0f);
+			Sample.InLossPercent = FMath::Clamp(FCString::Atof(*Values[4]), 0.0f, 100.0f);
+		}
+
+		if (Samples.Num() > 0 && Sample.Time < Samples.Last().Time)
+		{
+			UE_LOG(LogNet, Warning, TEXT("FNetConditionsRecording: Samples in %s are not sorted by time, ignoring sample at %.3f"), *Filename, Sample.Time);
+			continue;
+		}
+
+		Samples.Add(Sample);
+	}
+
+	if (Samples.Num() == 0)
+	{
+		UE_LOG(LogNet, Warning, TEXT("FNetConditionsRecording: %s has no samples"), *Filename);
+		return false;
+	}
+
+	Duration = Samples.Last().Time;
+
+	UE_LOG(LogNet, Log, TEXT("FNetConditionsRecording: Loaded %d samples covering %.1f seconds from %s"), Samples.Num(), Duration, *Filename);
+	return true;
+}
+
+const FNetConditionsSample& FNetConditionsRecording::GetSample(double Time) const
+{
+	const double LoopedTime = Duration > 0.0 ? Time - FMath::FloorToDouble(Time / Duration) * Duration : 0.0;
+
+	// The last sample at or before the time
+	const int32 Index = Algo::UpperBoundBy(Samples, LoopedTime, &FNetConditionsSample::Time) - 1;
+	return Samples[FMath::Max(Index, 0)];
+}
@@ -2,12 +2,41 @@
 
 // Includes
 #include "Net/TrafficControl.h"
+#include "HAL/IConsoleManager.h"
 
-FNetworkCongestionControl::FNetworkCongestionControl(double ConfiguredNetSpeed, uint32 MaxPackets) :
+namespace CongestionControlCVars
+{
+	static float TargetQueuingDelay = 0.025f;
+	static FAutoConsoleVariableRef CVarTargetQueuingDelay(TEXT("net.CongestionControl.TargetQueuingDelay"), TargetQueuingDelay,
+		TEXT("Queuing delay in seconds the congestion control tries to stay under. The send rate grows below it and shrinks above it."));
+
+	static float Gain = 1.0f;
+	static FAutoConsoleVariableRef CVarGain(TEXT("net.CongestionControl.Gain"), Gain,
+		TEXT("How fast the send rate reacts to the queuing delay. The rate changes by up to Gain times the acked bytes per ack."));
+
+	static float LossBackoff = 0.8f;
+	static FAutoConsoleVariableRef CVarLossBackoff(TEXT("net.CongestionControl.LossBackoff"), LossBackoff,
+		TEXT("Multiplier applied to the send rate when a packet is lost, at most once per round-trip."));
+
+	static float MinNetSpeed = 1800.0f;
+	static FAutoConsoleVariableRef CVarMinNetSpeed(TEXT("net.CongestionControl.MinNetSpeed"), MinNetSpeed,
+		TEXT("Lowest send rate in bytes/sec the congestion control will back off to."));
+
+	static float BaseDelayWindow = 10.0f;
+	static FAutoConsoleVariableRef CVarBaseDelayWindow(TEXT("net.CongestionControl.BaseDelayWindow"), BaseDelayWindow,
+		TEXT("Length in seconds of the windows used to track the base (propagation) round-trip time, so route changes are picked up."));
+}
+
+FNetworkCongestionControl::FNetworkCongestionControl(double InConfiguredNetSpeed, uint32 MaxPackets) :
 	Analyzer(this),
 	MinRTT(10),
-	NetSpeed(ConfiguredNetSpeed),
-	MaxPacketsAllowedInFlight(MaxPackets)
+	NetSpeed(InConfiguredNetSpeed),
+	ConfiguredNetSpeed(InConfiguredNetSpeed),
+	MaxPacketsAllowedInFlight(MaxPackets),
+	BaseRTT(0),
+	CurrentWindowMinRTT(0),
+	BaseRTTWindowStartTime(0),
+	LastLossBackoffTime(0)
 {}
 
 void FNetworkCongestionControl::UpdateMinRTT(double Timestamp)
@@ -28,10 +57,76 @@ double FNetworkCongestionControl::GetMinRTT() const
 	return MinRTT;
 }
 
+void FNetworkCongestionControl::UpdateBaseRTT(double Timestamp)
+{
+	const double LatestRTT = Analyzer.GetLatestRTT();
+	if (LatestRTT <= 0)
+	{
+		return;
+	}
+
+	if (BaseRTTWindowStartTime == 0 || Timestamp - BaseRTTWindowStartTime > CongestionControlCVars::BaseDelayWindow)
+	{
+		// Start a new window, keeping the previous window's minimum until this one has enough samples.
+		BaseRTT = (CurrentWindowMinRTT > 0) ? FMath::Min(CurrentWindowMinRTT, LatestRTT) : LatestRTT;
+		CurrentWindowMinRTT = LatestRTT;
+		BaseRTTWindowStartTime = Timestamp;
+	}
+	else
+	{
+		CurrentWindowMinRTT = FMath::Min(CurrentWindowMinRTT, LatestRTT);
+		BaseRTT = FMath::Min(BaseRTT, LatestRTT);
+	}
+}
+
+void FNetworkCongestionControl::UpdateNetSpeed(uint32 AckedBytes)
+{
+	const double TargetDelay = FMath::Max(CongestionControlCVars::TargetQueuingDelay, KINDA_SMALL_NUMBER);
+	const double QueuingDelay = FMath::Max(Analyzer.GetLatestRTT() - BaseRTT, 0.0);
+
+	// Positive when under the target delay (room to grow), negative when packets are queuing up on the link.
+	const double OffTarget = FMath::Clamp((TargetDelay - QueuingDelay) / TargetDelay, -1.0, 1.0);
+	NetSpeed += CongestionControlCVars::Gain * OffTarget * AckedBytes;
+	NetSpeed = FMath::Clamp(NetSpeed, FMath::Min<double>(CongestionControlCVars::MinNetSpeed, ConfiguredNetSpeed), ConfiguredNetSpeed);
+}
+
 void FNetworkCongestionControl::OnAck(const FAckSample& AckSample)
 {
+	const uint32 BytesInFlightBeforeAck = Analyzer.GetBytesInFlight();
 	Analyzer.OnAck(AckSample);
+	const uint32 AckedBytes = BytesInFlightBeforeAck - FMath::Min(Analyzer.GetBytesInFlight(), BytesInFlightBeforeAck);
+
 	UpdateMinRTT(AckSample.Timestamp);
+	UpdateBaseRTT(AckSample.Timestamp);
+
+	if (AckedBytes > 0)
+	{
+		UpdateNetSpeed(AckedBytes);
+	}
+}
+
+void FNetworkCongestionControl::OnNak(double Timestamp)
+{
+	// Losses within the same round-trip are usually the same congestion event, so only back off once.
+	if (Timestamp - LastLossBackoffTime < FMath::Max(Analyzer.GetLatestRTT(), 0.0))
+	{
+		return;
+	}
+
+	LastLossBackoffTime = Timestamp;
+	NetSpeed = FMath::Max(NetSpeed * CongestionControlCVars::LossBackoff, FMath::Min<double>(CongestionControlCVars::MinNetSpeed, ConfiguredNetSpeed));
+
+	UE_LOG(LogNetTraffic, Verbose, TEXT("FNetworkCongestionControl::OnNak, NetSpeed: %f, ConfiguredNetSpeed: %f"), NetSpeed, ConfiguredNetSpeed);
+}
+
+void FNetworkCongestionControl::SetConfiguredNetSpeed(double InConfiguredNetSpeed)
+{
+	if (InConfiguredNetSpeed != ConfiguredNetSpeed)
+	{
+		// Keep the same fraction of the configured rate, so a new limit applies right away.
+		NetSpeed = (ConfiguredNetSpeed > 0) ? NetSpeed * (InConfiguredNetSpeed / ConfiguredNetSpeed) : InConfiguredNetSpeed;
+		ConfiguredNetSpeed = InConfiguredNetSpeed;
+	}
 }
 
 bool FNetworkCongestionControl::IsReadyToSend(double Timestamp)
@@ -42,8 +137,8 @@ bool FNetworkCongestionControl::IsReadyToSend(double Timestamp)
 	if (BytesInFlight >= CongestionWindow || PacketsInFlight >= MaxPacketsAllowedInFlight)
 	{
 		UE_LOG(LogNetTraffic, Verbose,
-			TEXT("%d: Not ready to send, BytesInFlight: %d, PacketsInFlight: %d, CongestionWindow: %f, MinRTT: %f"),
-			GFrameCounter, BytesInFlight, PacketsInFlight, CongestionWindow, GetMinRTT());
+			TEXT("%d: Not ready to send, BytesInFlight: %d, PacketsInFlight: %d, CongestionWindow: %f, MinRTT: %f, NetSpeed: %f"),
+			GFrameCounter, BytesInFlight, PacketsInFlight, CongestionWindow, GetMinRTT(), NetSpeed);
 		return false;
 	}
 
@@ -10,6 +10,7 @@
 #include "EngineGlobals.h"
 #include "UObject/Package.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
 #include "Engine/LevelStreaming.h"
 #include "PacketHandlers/StatelessConnectHandlerComponent.h"
 #include "Engine/LocalPlayer.h"
@@ -35,6 +36,7 @@
 #include "UObject/UObjectIterator.h"
 #include "Net/Core/Trace/NetTrace.h"
 #include "Net/NetworkGranularMemoryLogging.h"
+#include "Net/NetConditionsRecording.h"
 #include "SocketSubsystem.h"
 #include "Math/NumericLimits.h"
 #include "UObject/UnrealNames.h"
@@ -203,6 +205,7 @@ UNetConnection::UNetConnection(const FObjectInitializer& ObjectInitializer)
 ,	ResponseId			( 0 )
 
 ,	QueuedBits			( 0 )
+,	QueuedMulticastBitsThisFrame( 0 )
 ,	TickCount			( 0 )
 ,	LastProcessedFrame	( 0 )
 ,	ConnectTime			( 0.0 )
@@ -380,6 +383,11 @@ void UNetConnection::InitBase(UNetDriver* InDriver,class FSocket* InSocket, cons
 		CurrentNetSpeed = FMath::Max<int32>(CurrentNetSpeed, 1800);
 	}
 
+	if (CVarNetEnableCongestionControl.GetValueOnAnyThread() > 0 && !IsInternalAck())
+	{
+		NetworkCongestionControl.Emplace(CurrentNetSpeed, FNetPacketNotify::SequenceHistoryT::Size);
+	}
+
 	// Create package map.
 	UPackageMapClient* PackageMapClient = NewObject<UPackageMapClient>(this, PackageMapClass);
 
@@ -828,6 +836,8 @@ void UNetConnection::CleanUp()
 			{
 				PerfCountersIncrement(TEXT("RemovedConnections"));
 			}
+
+			ReplicationTimeMetric.Reset();
 #endif
 		}
 	}
@@ -1283,6 +1293,14 @@ void UNetConnection::ReceivedRawPacket( void* InData, int32 Count )
 		Driver->InTotalBytes += PacketBytes;
 		Driver->InPackets++;
 		Driver->InTotalPackets++;
+
+#if USE_SERVER_PERF_COUNTERS
+		if (Driver->InPacketsMetric.IsValid())
+		{
+			Driver->InPacketsMetric->Add();
+			Driver->InBytesMetric->Add(PacketBytes);
+		}
+#endif
 	}
 
 	if (Count > 0)
@@ -1579,6 +1597,14 @@ void UNetConnection::FlushNet(bool bIgnoreSimulation)
 		Driver->OutTotalBytes += PacketBytes;
 		GNetOutBytes += PacketBytes;
 
+#if USE_SERVER_PERF_COUNTERS
+		if (Driver->OutPacketsMetric.IsValid())
+		{
+			Driver->OutPacketsMetric->Add();
+			Driver->OutBytesMetric->Add(PacketBytes);
+		}
+#endif
+
 		AnalyticsVars.OutAckOnlyCount += (NumAckBits > 0 && NumBunchBits == 0);
 
 		bFlushedNetThisFrame = true;
@@ -1615,6 +1641,19 @@ bool UNetConnection::CheckOutgoingPacketEmulation(FOutPacketTraits& Traits)
 
 		return true;
 	}
+	else if (const FNetConditionsSample* RecordedConditions = GetRecordedConditions())
+	{
+		// Queue behind packets still in flight so the recorded latency doesn't reorder them
+		if (RecordedConditions->OutLagMs <= 0.0f && Delayed.Num() == 0)
+		{
+			return false;
+		}
+
+		FDelayedPacket& B = *(new(Delayed)FDelayedPacket(SendBuffer.GetData(), SendBuffer.GetNumBits(), Traits));
+		B.SendTime = FPlatformTime::Seconds() + double(RecordedConditions->OutLagMs) / 1000.0;
+
+		return true;
+	}
 	else if (PacketSimulationSettings.PktJitter != 0)
 	{
 		bSendDelayedPacketsOutofOrder = true;
@@ -1670,10 +1709,13 @@ bool UNetConnection::CheckOutgoingPacketEmulation(FOutPacketTraits& Traits)
 #if DO_ENABLE_NET_TEST
 bool UNetConnection::ShouldDropOutgoingPacketForLossSimulation(int64 NumBits) const
 {
+	const FNetConditionsSample* RecordedConditions = GetRecordedConditions();
+
 	return Driver->IsSimulatingPacketLossBurst() || 
 		(PacketSimulationSettings.PktLoss > 0 && 
          PacketSimulationSettings.ShouldDropPacketOfSize(NumBits) && 
-         FMath::FRand() * 100.f < PacketSimulationSettings.PktLoss);
+         FMath::FRand() * 100.f < PacketSimulationSettings.PktLoss) ||
+		(RecordedConditions && FMath::FRand() * 100.f < RecordedConditions->OutLossPercent);
 }
 #endif
 
@@ -1793,6 +1835,11 @@ void UNetConnection::ReceivedNak( int32 NakPacketId )
 	// Invoke NakChannelFunc on all channels written for this PacketId
 	FChannelRecordImpl::ConsumeChannelRecordsForPacket(ChannelRecord, NakPacketId, NakChannelFunc);
 
+	if (NetworkCongestionControl.IsSet())
+	{
+		NetworkCongestionControl.GetValue().OnNak(Driver->GetElapsedTime());
+	}
+
 	// Stats
 	++OutPacketsLost;
 	++OutTotalPacketsLost;
@@ -2077,6 +2124,8 @@ void UNetConnection::ReceivedPacket( FBitReader& Reader, bool bIsReinjectedPacke
 #if DO_ENABLE_NET_TEST
 	if (!IsInternalAck() && !bIsReinjectingDelayedPackets)
 	{
+		const FNetConditionsSample* RecordedConditions = GetRecordedConditions();
+
 		if (PacketSimulationSettings.PktIncomingLoss)
 		{
 			if (FMath::FRand() * 100.f < PacketSimulationSettings.PktIncomingLoss)
@@ -2086,7 +2135,26 @@ void UNetConnection::ReceivedPacket( FBitReader& Reader, bool bIsReinjectedPacke
 			}
 
 		}
-		if (PacketSimulationSettings.PktIncomingLagMin > 0 || PacketSimulationSettings.PktIncomingLagMax > 0)
+		if (RecordedConditions && FMath::FRand() * 100.f < RecordedConditions->InLossPercent)
+		{
+			UE_LOG(LogNet, VeryVerbose, TEXT("Dropped incoming packet at %f from recorded conditions"), FPlatformTime::Seconds());
+			return;
+		}
+
+		if (RecordedConditions)
+		{
+			// Queue behind delayed packets even without latency, so they are processed in order
+			if (RecordedConditions->InLagMs > 0.0f || DelayedIncomingPackets.Num() > 0)
+			{
+				FDelayedIncomingPacket DelayedPacket;
+				DelayedPacket.PacketData = MakeUnique<FBitReader>(Reader);
+				DelayedPacket.ReinjectionTime = FPlatformTime::Seconds() + double(RecordedConditions->InLagMs) / 1000.0;
+
+				DelayedIncomingPackets.Emplace(MoveTemp(DelayedPacket));
+				return;
+			}
+		}
+		else if (PacketSimulationSettings.PktIncomingLagMin > 0 || PacketSimulationSettings.PktIncomingLagMax > 0)
 		{
 			// ExtraLagInSec goes from [PktIncomingLagMin, PktIncomingLagMax]
 			const double LagVarianceInMS = FMath::FRand() * double(PacketSimulationSettings.PktIncomingLagMax - PacketSimulationSettings.PktIncomingLagMin);
@@ -3696,7 +3764,15 @@ void UNetConnection::Tick(float DeltaSeconds)
 		BandwidthDeltaTime = FMath::Clamp(BandwidthDeltaTime, 0.0f, 1.0f / DesiredTickRate);
 	}
 
-	float DeltaBits = CurrentNetSpeed * BandwidthDeltaTime * 8.f;
+	// The congestion control adapts the send rate below CurrentNetSpeed from the RTT and loss of acked packets.
+	float NetSpeed = CurrentNetSpeed;
+	if (NetworkCongestionControl.IsSet())
+	{
+		NetworkCongestionControl.GetValue().SetConfiguredNetSpeed(CurrentNetSpeed);
+		NetSpeed = NetworkCongestionControl.GetValue().GetNetSpeed();
+	}
+
+	float DeltaBits = NetSpeed * BandwidthDeltaTime * 8.f;
 	QueuedBits -= FMath::TruncToInt(DeltaBits);
 	float AllowedLag = 2.f * DeltaBits;
 	if (QueuedBits < -AllowedLag)
@@ -3704,6 +3780,7 @@ void UNetConnection::Tick(float DeltaSeconds)
 		QueuedBits = FMath::TruncToInt(-AllowedLag);
 	}
 
+	QueuedMulticastBitsThisFrame = 0;
 	bFlushedNetThisFrame = false;
 }
 
@@ -3875,6 +3952,54 @@ void UNetConnection::UpdatePacketSimulationSettings(void)
 {
 	check(Driver);
 	PacketSimulationSettings = Driver->PacketSimulationSettings;
+
+	if (!PacketSimulationSettings.PktConnectionProfiles.IsEmpty())
+	{
+		TArray<FString> Profiles;
+		PacketSimulationSettings.PktConnectionProfiles.ParseIntoArray(Profiles, TEXT(","));
+
+		if (Profiles.Num() > 0)
+		{
+			// Keep the same profile when the driver settings change, unless the list itself changes
+			if (ConnectionProfileIndex == INDEX_NONE)
+			{
+				static int32 NextConnectionProfileIndex = 0;
+				ConnectionProfileIndex = NextConnectionProfileIndex++;
+			}
+
+			const FString Profile = Profiles[ConnectionProfileIndex % Profiles.Num()].TrimStartAndEnd();
+			PacketSimulationSettings.LoadEmulationProfile(*Profile);
+		}
+	}
+
+	UpdateConditionsRecording();
+}
+
+void UNetConnection::SetConnectionPacketSimulationSettings(const FPacketSimulationSettings& NewSettings)
+{
+	PacketSimulationSettings = NewSettings;
+	UpdateConditionsRecording();
+}
+
+void UNetConnection::UpdateConditionsRecording()
+{
+	if (PacketSimulationSettings.PktConditionsFile.IsEmpty())
+	{
+		ConditionsRecording.Reset();
+		return;
+	}
+
+	TSharedPtr<const FNetConditionsRecording> NewRecording = FNetConditionsRecording::Load(PacketSimulationSettings.PktConditionsFile);
+	if (NewRecording != ConditionsRecording)
+	{
+		ConditionsRecording = NewRecording;
+		ConditionsRecordingOffset = ConditionsRecording.IsValid() ? FMath::FRand() * ConditionsRecording->GetDuration() - FPlatformTime::Seconds() : 0.0;
+	}
+}
+
+const FNetConditionsSample* UNetConnection::GetRecordedConditions() const
+{
+	return ConditionsRecording.IsValid() ? &ConditionsRecording->GetSample(FPlatformTime::Seconds() + ConditionsRecordingOffset) : nullptr;
 }
 #endif
 
@@ -4406,6 +4531,85 @@ void USimulatedClientNetConnection::HandleClientPlayer( class APlayerController*
 	OwningActor = PC;
 }
 
+namespace SimulatedConnectionCVars
+{
+	static float ViewerSpeed = 600.0f;
+	static FAutoConsoleVariableRef CVarViewerSpeed(TEXT("net.SimulatedConnections.ViewerSpeed"), ViewerSpeed,
+		TEXT("Speed in units/sec at which the viewers of simulated connections wander. 0 keeps them in place."));
+}
+
+bool USimulatedClientNetConnection::SpawnViewer(const FVector& Origin, float InWanderRadius)
+{
+	UWorld* World = Driver ? Driver->GetWorld() : nullptr;
+	if (!World)
+	{
+		return false;
+	}
+
+	FActorSpawnParameters SpawnInfo;
+	SpawnInfo.ObjectFlags |= RF_Transient;
+	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	WanderOrigin = Origin;
+	WanderRadius = InWanderRadius;
+	WanderTarget = Origin + FMath::VRand() * FMath::FRand() * WanderRadius;
+
+	APlayerController* Viewer = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), WanderTarget, FRotator::ZeroRotator, SpawnInfo);
+	if (!Viewer)
+	{
+		return false;
+	}
+
+	Viewer->SetReplicates(true);
+	Viewer->SetAutonomousProxy(true);
+	Viewer->SetPlayer(this);
+
+	SpawnedViewer = Viewer;
+	HandleClientPlayer(Viewer, this);
+
+	return true;
+}
+
+void USimulatedClientNetConnection::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	APlayerController* Viewer = SpawnedViewer.Get();
+	if (Viewer && SimulatedConnectionCVars::ViewerSpeed > 0.0f && WanderRadius > 0.0f)
+	{
+		const FVector Location = Viewer->GetActorLocation();
+		const FVector ToTarget = WanderTarget - Location;
+		const float Step = SimulatedConnectionCVars::ViewerSpeed * DeltaSeconds;
+
+		if (ToTarget.SizeSquared() <= FMath::Square(Step))
+		{
+			Viewer->SetActorLocation(WanderTarget);
+			WanderTarget = WanderOrigin + FMath::VRand() * FMath::FRand() * WanderRadius;
+		}
+		else
+		{
+			const FVector Direction = ToTarget.GetSafeNormal();
+			Viewer->SetActorLocationAndRotation(Location + Direction * Step, Direction.Rotation());
+		}
+	}
+}
+
+void USimulatedClientNetConnection::DestroyOwningActor()
+{
+	// Don't destroy the OwningActor when we follow a real PlayerController
+	if (APlayerController* Viewer = SpawnedViewer.Get())
+	{
+		if (OwningActor == Viewer && !Viewer->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed))
+		{
+			Viewer->Destroy();
+		}
+
+		SpawnedViewer.Reset();
+		OwningActor = nullptr;
+		PlayerController = nullptr;
+	}
+}
+
 // ----------------------------------------------------------------
 
 static void	AddSimulatedNetConnections(const TArray<FString>& Args, UWorld* World)
@@ -4416,6 +4620,13 @@ static void	AddSimulatedNetConnections(const TArray<FString>& Args, UWorld* Worl
 		LexFromString(ConnectionCount, *Args[0]);
 	}
 
+	// When set, each connection gets a viewer of its own wandering this far from a player start
+	float WanderRadius = 0.0f;
+	if (Args.Num() > 1)
+	{
+		LexFromString(WanderRadius, *Args[1]);
+	}
+
 	// Search for server game net driver. Do it this way so we can cheat in PIE
 	UNetDriver* BestNetDriver = nullptr;
 	for (TObjectIterator<UNetDriver> NetDriverIt; NetDriverIt; ++NetDriverIt)
@@ -4445,6 +4656,23 @@ static void	AddSimulatedNetConnections(const TArray<FString>& Args, UWorld* Worl
 	}
 	
 
+	// Without a real player to follow, the connections need viewers of their own to replicate anything
+	const bool bSpawnViewers = WanderRadius > 0.0f || PC == nullptr;
+
+	TArray<FVector> ViewerOrigins;
+	if (bSpawnViewers)
+	{
+		for (TActorIterator<APlayerStart> It(BestNetDriver->GetWorld()); It; ++It)
+		{
+			ViewerOrigins.Add(It->GetActorLocation());
+		}
+
+		if (ViewerOrigins.Num() == 0)
+		{
+			ViewerOrigins.Add(DefaultViewTarget ? DefaultViewTarget->GetActorLocation() : FVector::ZeroVector);
+		}
+	}
+
 	UE_LOG(LogNet, Display, TEXT("Adding %d Simulated Connections..."), ConnectionCount);
 	while(ConnectionCount-- > 0)
 	{
@@ -4452,8 +4680,12 @@ static void	AddSimulatedNetConnections(const TArray<FString>& Args, UWorld* Worl
 		Connection->InitConnection( BestNetDriver, USOCK_Open, BestNetDriver->GetWorld()->URL, 1000000 );
 		Connection->InitSendBuffer();
 		BestNetDriver->AddClientConnection( Connection );
-		Connection->HandleClientPlayer(PC, Connection);
 		Connection->SetClientWorldPackageName(BestNetDriver->GetWorldPackage()->GetFName());
+
+		if (!bSpawnViewers || !Connection->SpawnViewer(ViewerOrigins[FMath::RandHelper(ViewerOrigins.Num())], WanderRadius))
+		{
+			Connection->HandleClientPlayer(PC, Connection);
+		}
 	}	
 }
 
@@ -4501,7 +4733,7 @@ static void	RemoveSimulatedNetConnections(const TArray<FString>& Args, UWorld* W
 	UE_LOG(LogNet, Display, TEXT("Removed %d Simulated Connections..."), RemovedConnections);
 }
 
-FAutoConsoleCommandWithWorldAndArgs AddimulatedConnectionsCmd(TEXT("net.SimulateConnections"), TEXT("Starts a Simulated Net Driver"),	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(AddSimulatedNetConnections) );
+FAutoConsoleCommandWithWorldAndArgs AddimulatedConnectionsCmd(TEXT("net.SimulateConnections"), TEXT("Adds simulated connections to the server. Usage: net.SimulateConnections [Count] [WanderRadius]. With a WanderRadius, or without a player to follow, each connection gets a viewer of its own wandering around a player start."),	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(AddSimulatedNetConnections) );
 
 FAutoConsoleCommandWithWorldAndArgs RemoveSimulatedConnectionsCmd(TEXT("net.DisconnectSimulatedConnections"), TEXT("Disconnects some simulated connections (0 = all)"), FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(RemoveSimulatedNetConnections));
 
@@ -59,6 +59,7 @@
 #include "Engine/ChildConnection.h"
 #include "Net/Core/Trace/NetTrace.h"
 #include "Misc/ScopeExit.h"
+#include "Async/ParallelFor.h"
 #include "Net/DataChannel.h"
 #include "GameFramework/PlayerState.h"
 #include "Net/PerfCountersHelpers.h"
@@ -284,6 +285,22 @@ static FAutoConsoleVariableRef CVarNetDormancyValidate(
 	TEXT("0: Dont validate. 1: Validate on wake up. 2: Validate on each net update"),
 	ECVF_Default);
 
+int32 GNetParallelPrioritizeActors = 0;
+static FAutoConsoleVariableRef CVarNetParallelPrioritizeActors(
+	TEXT("net.ParallelPrioritizeActors"),
+	GNetParallelPrioritizeActors,
+	TEXT("When enabled, ServerReplicateActors gathers and prioritizes relevant actors for each connection in parallel before replicating to them on the game thread.\n")
+	TEXT("Requires IsNetRelevantFor, GetNetPriority and GetNetDormancy overrides to be safe to call from worker threads.\n")
+	TEXT("0: Prioritize connections one at a time on the game thread. 1: Prioritize connections in parallel."),
+	ECVF_Default);
+
+int32 GNetParallelPrioritizeActorsMinConnections = 4;
+static FAutoConsoleVariableRef CVarNetParallelPrioritizeActorsMinConnections(
+	TEXT("net.ParallelPrioritizeActors.MinConnections"),
+	GNetParallelPrioritizeActorsMinConnections,
+	TEXT("Minimum number of connections that need to be ticked in a frame before net.ParallelPrioritizeActors is used."),
+	ECVF_Default);
+
 bool GbNetReuseReplicatorsForDormantObjects = false;
 static FAutoConsoleVariableRef CVarNetReuseReplicatorsForDormantObjects(
 	TEXT("Net.ReuseReplicatorsForDormantObjects"),
@@ -677,6 +694,10 @@ void UNetDriver::TickFlush(float DeltaSeconds)
 	}
 	FSimpleScopeSecondsCounter ScopedTimer(GTickFlushGameDriverTimeSeconds, bEnableTimer);
 
+#if USE_SERVER_PERF_COUNTERS
+	const double TickFlushStartTime = FPlatformTime::Seconds();
+#endif
+
 	if (IsServer() && ClientConnections.Num() > 0 && !bSkipServerReplicateActors)
 	{
 		// Update all clients.
@@ -1302,6 +1323,13 @@ void UNetDriver::TickFlush(float DeltaSeconds)
 
 	// Update the lag state
 	UpdateNetworkLagState();
+
+#if USE_SERVER_PERF_COUNTERS
+	if (TickFlushTimeMetric.IsValid())
+	{
+		TickFlushTimeMetric->Observe((FPlatformTime::Seconds() - TickFlushStartTime) * 1000.0);
+	}
+#endif
 }
 
 void UNetDriver::UpdateNetworkLagState()
@@ -1577,6 +1605,29 @@ bool UNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, const FU
 	}
 #endif //#if DO_ENABLE_NET_TEST
 
+#if USE_SERVER_PERF_COUNTERS
+	IPerfCounters* PerfCounters = IPerfCountersModule::IsAvailable() ? IPerfCountersModule::Get().GetPerformanceCounters() : nullptr;
+	if (PerfCounters)
+	{
+		FPerfMetricLabels DriverLabels;
+		DriverLabels.Emplace(TEXT("driver"), NetDriverName.ToString());
+
+		FPerfMetricLabels InLabels = DriverLabels;
+		InLabels.Emplace(TEXT("direction"), TEXT("in"));
+		FPerfMetricLabels OutLabels = DriverLabels;
+		OutLabels.Emplace(TEXT("direction"), TEXT("out"));
+
+		InPacketsMetric = PerfCounters->CreateMetricCounter(TEXT("ue_net_packets_total"), TEXT("Packets sent and received by the net driver."), InLabels);
+		OutPacketsMetric = PerfCounters->CreateMetricCounter(TEXT("ue_net_packets_total"), TEXT("Packets sent and received by the net driver."), OutLabels);
+		InBytesMetric = PerfCounters->CreateMetricCounter(TEXT("ue_net_bytes_total"), TEXT("Bytes sent and received by the net driver, including packet overhead."), InLabels);
+		OutBytesMetric = PerfCounters->CreateMetricCounter(TEXT("ue_net_bytes_total"), TEXT("Bytes sent and received by the net driver, including packet overhead."), OutLabels);
+
+		const TArray<double> TickFlushBucketsMs = { 0.5, 1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0 };
+		TickFlushTimeMetric = PerfCounters->CreateMetricHistogram(TEXT("ue_net_tick_flush_time_ms"), TEXT("Time spent in the net driver's TickFlush, including actor replication, in milliseconds."),
+			TickFlushBucketsMs, DriverLabels);
+	}
+#endif
+
 	Notify = InNotify;
 
 	// If we are not using Iris, we use the UniqueId to identify the NetDriver.
@@ -3234,6 +3285,17 @@ void UNetDriver::NotifyActorDestroyed( AActor* ThisActor, bool IsSeamlessTravel
 }
 
 
+void UNetDriver::NotifyActorReleasedToPool(AActor* Actor)
+{
+	NotifyActorDestroyed(Actor);
+
+	if (IsServer() && GuidCache.IsValid())
+	{
+		// In flight references to the old guids resolve to null, clients can't mistake the reused actor for its previous life
+		GuidCache->ReleaseNetGUIDs(Actor);
+	}
+}
+
 void UNetDriver::RemoveNetworkActor(AActor* Actor)
 {
 	GetNetworkObjectList().Remove(Actor);
@@ -3646,6 +3708,9 @@ void FPacketSimulationSettings::LoadConfig(const TCHAR* OptionalQualifier)
 
 	ConfigHelperInt(TEXT("PktJitter"), PktJitter, OptionalQualifier);
 
+	ConfigHelperString(TEXT("PktConditionsFile"), PktConditionsFile, OptionalQualifier);
+	ConfigHelperString(TEXT("PktConnectionProfiles"), PktConnectionProfiles, OptionalQualifier);
+
 	ValidateSettings();
 }
 
@@ -3749,6 +3814,24 @@ bool FPacketSimulationSettings::ConfigHelperBool(const TCHAR* Name, bool& Value,
 	return false;
 }
 
+bool FPacketSimulationSettings::ConfigHelperString(const TCHAR* Name, FString& Value, const TCHAR* OptionalQualifier)
+{
+	if (OptionalQualifier)
+	{
+		if (GConfig->GetString(TEXT("PacketSimulationSettings"), *FString::Printf(TEXT("%s%s"), OptionalQualifier, Name), Value, GEngineIni))
+		{
+			return true;
+		}
+	}
+
+	if (GConfig->GetString(TEXT("PacketSimulationSettings"), Name, Value, GEngineIni))
+	{
+		return true;
+	}
+
+	return false;
+}
+
 /**
  * Reads the settings from a string: command line or an exec
  *
@@ -3831,6 +3914,16 @@ bool FPacketSimulationSettings::ParseSettings(const TCHAR* Cmd, const TCHAR* Opt
 		bParsed = true;
 		UE_LOG(LogNet, Log, TEXT("PktJitter set to %d"), PktJitter);
 	}
+	if (ParseHelper(Cmd, TEXT("PktConditionsFile="), PktConditionsFile, OptionalQualifier))
+	{
+		bParsed = true;
+		UE_LOG(LogNet, Log, TEXT("PktConditionsFile set to %s"), *PktConditionsFile);
+	}
+	if (ParseHelper(Cmd, TEXT("PktConnectionProfiles="), PktConnectionProfiles, OptionalQualifier))
+	{
+		bParsed = true;
+		UE_LOG(LogNet, Log, TEXT("PktConnectionProfiles set to %s"), *PktConnectionProfiles);
+	}
 
 	ValidateSettings();
 	return bParsed;
@@ -3853,6 +3946,24 @@ bool FPacketSimulationSettings::ParseHelper(const TCHAR* Cmd, const TCHAR* Name,
 	return false;
 }
 
+bool FPacketSimulationSettings::ParseHelper(const TCHAR* Cmd, const TCHAR* Name, FString& Value, const TCHAR* OptionalQualifier)
+{
+	// Don't stop on commas, PktConnectionProfiles is a comma separated list
+	if (OptionalQualifier)
+	{
+		if (FParse::Value(Cmd, *FString::Printf(TEXT("%s%s"), OptionalQualifier, Name), Value, false))
+		{
+			return true;
+		}
+	}
+
+	if (FParse::Value(Cmd, Name, Value, false))
+	{
+		return true;
+	}
+	return false;
+}
+
 #endif //#if DO_ENABLE_NET_TEST
 
 FNetViewer::FNetViewer(UNetConnection* InConnection, float DeltaSeconds) :
@@ -4048,6 +4159,7 @@ int32 UNetDriver::ServerReplicateActors_PrepConnections( const float DeltaSecond
 void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime )
 {
 	SCOPE_CYCLE_COUNTER( STAT_NetConsiderActorsTime );
+	UE_NET_TRACE_CPU_SCOPE(TEXT("ServerReplicateActors_BuildConsiderList"), ENetTraceVerbosity::Trace);
 
 	UE_LOG( LogNetTraffic, Log, TEXT( "ServerReplicateActors_BuildConsiderList, Building ConsiderList %4.2f" ), World->GetTimeSeconds() );
 
@@ -4266,6 +4378,7 @@ static FORCEINLINE_DEBUGGABLE bool ShouldActorGoDormant( AActor* Actor, const TA
 int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors )
 {
 	SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
+	UE_NET_TRACE_CPU_SCOPE(TEXT("ServerReplicateActors_PrioritizeActors"), ENetTraceVerbosity::Trace);
 
 	// Get list of visible/relevant actors.
 
@@ -4407,6 +4520,7 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated )
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetProcessPrioritizedActorsTime);
+	UE_NET_TRACE_CPU_SCOPE(TEXT("ServerReplicateActors_ProcessPrioritizedActors"), ENetTraceVerbosity::Trace);
 
 	int32 ActorUpdatesThisConnection		= 0;
 	int32 ActorUpdatesThisConnectionSent	= 0;
@@ -4603,6 +4717,227 @@ int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection
 
 	return FinalSortedCount;
 }
+
+void UNetDriver::ServerReplicateActors_MarkRelevantActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, int32 StartActorIndex, int32 EndActorIndex, FActorPriority** PriorityActors )
+{
+	for ( int32 k=StartActorIndex; k<EndActorIndex; k++ )
+	{
+		if (!PriorityActors[k]->ActorInfo)
+		{
+			// A deletion entry, skip it because we dont have anywhere to store a 'better give higher priority next time'
+			continue;
+		}
+
+		AActor* Actor = PriorityActors[k]->ActorInfo->Actor;
+
+		UActorChannel* Channel = PriorityActors[k]->Channel;
+
+		UE_LOG(LogNetTraffic, Verbose, TEXT("Saturated. %s"), *Actor->GetName());
+		if (Channel != NULL && ElapsedTime - Channel->RelevantTime <= 1.0)
+		{
+			UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
+			PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
+		}
+		else if ( IsActorRelevantToConnection( Actor, ConnectionViewers ) )
+		{
+			// If this actor was relevant but didn't get processed, force another update for next frame
+			UE_LOG( LogNetTraffic, Log, TEXT( " Saturated. Mark %s NetUpdateTime to be checked for next tick" ), *Actor->GetName() );
+			PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
+			if ( Channel != NULL )
+			{
+				Channel->RelevantTime = ElapsedTime + 0.5 * UpdateDelayRandomStream.FRand();
+			}
+		}
+
+		// If the actor was forced to relevant and didn't get processed, try again on the next update;
+		if (PriorityActors[k]->ActorInfo->ForceRelevantFrame >= Connection->LastProcessedFrame)
+		{
+			PriorityActors[k]->ActorInfo->ForceRelevantFrame = ReplicationFrame+1;
+		}
+	}
+}
+
+/** Output of ServerReplicateActors_PrioritizeActorsThreadSafe for a single connection. */
+struct FConnectionPrioritizationResult
+{
+	/** Viewers for this connection and its children, built on the game thread before prioritization starts. */
+	TArray<FNetViewer> Viewers;
+
+	/** Backing storage for the prioritized actors and destruction infos. */
+	TArray<FActorPriority> PriorityList;
+
+	/** Sorted by priority, points into PriorityList. */
+	TArray<FActorPriority*> PriorityActors;
+
+	/** Channels that should be closed because their actor is no longer relevant to the owning connection. */
+	TArray<UActorChannel*> ChannelsToClose;
+
+	/** Channels whose actor wants to go dormant on this connection. */
+	TArray<UActorChannel*> ChannelsToStartDormancy;
+
+	int32 DeletedCount = 0;
+
+	/** True if this connection was prioritized this frame. */
+	bool bPrioritized = false;
+};
+
+void UNetDriver::ServerReplicateActors_ParallelPrioritizeActors( const int32 NumClientsToTick, const float DeltaSeconds, const TArray<FNetworkObjectInfo*>& ConsiderList, TArray<FConnectionPrioritizationResult>& OutResults )
+{
+	SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
+
+	OutResults.SetNum( ClientConnections.Num() );
+
+	// Building viewers can call into game code (GetPlayerViewPoint), so keep that on the game thread.
+	for ( int32 i = 0; i < NumClientsToTick; i++ )
+	{
+		UNetConnection* Connection = ClientConnections[i];
+		if ( Connection->ViewTarget )
+		{
+			check( World == Connection->OwningActor->GetWorld() );
+			check( World == Connection->ViewTarget->GetWorld() );
+
+			FConnectionPrioritizationResult& Result = OutResults[i];
+			Result.bPrioritized = true;
+			Result.Viewers.Emplace( Connection, DeltaSeconds );
+			for ( UNetConnection* Child : Connection->Children )
+			{
+				if ( Child->ViewTarget != nullptr )
+				{
+					Result.Viewers.Emplace( Child, DeltaSeconds );
+				}
+			}
+		}
+	}
+
+	ParallelFor( NumClientsToTick, [this, &ConsiderList, &OutResults]( int32 ConnectionIndex )
+	{
+		FConnectionPrioritizationResult& Result = OutResults[ConnectionIndex];
+		if ( Result.bPrioritized )
+		{
+			ServerReplicateActors_PrioritizeActorsThreadSafe( ClientConnections[ConnectionIndex], ConsiderList, Result );
+		}
+	});
+
+	int32 TotalSortedCount = 0;
+	int32 TotalDeletedCount = 0;
+	for ( const FConnectionPrioritizationResult& Result : OutResults )
+	{
+		TotalSortedCount += Result.PriorityActors.Num();
+		TotalDeletedCount += Result.DeletedCount;
+
+		if ( DebugRelevantActors )
+		{
+			for ( const FActorPriority* Priority : Result.PriorityActors )
+			{
+				if ( Priority->ActorInfo )
+				{
+					LastPrioritizedActors.Add( Priority->ActorInfo->Actor );
+				}
+			}
+		}
+	}
+
+	SET_DWORD_STAT( STAT_PrioritizedActors, TotalSortedCount );
+	SET_DWORD_STAT( STAT_NumRelevantDeletedActors, TotalDeletedCount );
+}
+
+void UNetDriver::ServerReplicateActors_PrioritizeActorsThreadSafe( UNetConnection* Connection, const TArray<FNetworkObjectInfo*>& ConsiderList, FConnectionPrioritizationResult& OutResult ) const
+{
+	// Mirrors ServerReplicateActors_PrioritizeActors, but may run on any thread. Instead of tagging actors with NetTag
+	// (shared between connections) this uses a local set to skip sent temporaries, and channel state changes are deferred.
+	const TArray<FNetViewer>& ConnectionViewers = OutResult.Viewers;
+
+	TSet<const AActor*, DefaultKeyFuncs<const AActor*>, TInlineSetAllocator<16>> SentTemporaries;
+	for ( const AActor* SentTemporary : Connection->SentTemporaries )
+	{
+		SentTemporaries.Add( SentTemporary );
+	}
+
+	TWeakObjectPtr<UNetConnection> WeakConnection(Connection);
+
+	const TSet<FNetworkGUID>& DestroyedGUIDs = Connection->GetDestroyedStartupOrDormantActorGUIDs();
+
+	OutResult.PriorityList.Reserve( ConsiderList.Num() + DestroyedGUIDs.Num() );
+
+	AGameNetworkManager* const NetworkManager = World->NetworkManager;
+	const bool bLowNetBandwidth = NetworkManager ? NetworkManager->IsInLowBandwidthMode() : false;
+
+	for ( FNetworkObjectInfo* ActorInfo : ConsiderList )
+	{
+		AActor* Actor = ActorInfo->Actor;
+
+		if ( SentTemporaries.Contains( Actor ) )
+		{
+			continue;
+		}
+
+		UActorChannel* Channel = Connection->FindActorChannelRef( ActorInfo->WeakActor );
+
+		if (!Channel)
+		{
+			if (!IsLevelInitializedForActor(Actor, Connection))
+			{
+				continue;
+			}
+
+			if (!IsActorRelevantToConnection(Actor, ConnectionViewers))
+			{
+				continue;
+			}
+		}
+
+		UNetConnection* PriorityConnection = Connection;
+
+		if ( Actor->bOnlyRelevantToOwner )
+		{
+			bool bHasNullViewTarget = false;
+
+			PriorityConnection = IsActorOwnedByAndRelevantToConnection( Actor, ConnectionViewers, bHasNullViewTarget );
+
+			if ( PriorityConnection == nullptr )
+			{
+				if ( !bHasNullViewTarget && Channel != NULL && ElapsedTime - Channel->RelevantTime >= RelevantTimeout )
+				{
+					OutResult.ChannelsToClose.Add( Channel );
+				}
+
+				continue;
+			}
+		}
+		else if ( GSetNetDormancyEnabled != 0 )
+		{
+			if ( IsActorDormant( ActorInfo, WeakConnection ) )
+			{
+				continue;
+			}
+
+			if ( ShouldActorGoDormant( Actor, ConnectionViewers, Channel, ElapsedTime, bLowNetBandwidth ) )
+			{
+				OutResult.ChannelsToStartDormancy.Add( Channel );
+			}
+		}
+
+		OutResult.PriorityList.Emplace( PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth );
+	}
+
+	for ( const FNetworkGUID& DestroyedGUID : DestroyedGUIDs )
+	{
+		FActorDestructionInfo& DInfo = *DestroyedStartupOrDormantActors.FindChecked( DestroyedGUID );
+		OutResult.PriorityList.Emplace( Connection, &DInfo, ConnectionViewers );
+		OutResult.DeletedCount++;
+	}
+
+	// PriorityList is not resized past this point, so pointers into it stay valid.
+	OutResult.PriorityActors.Reserve( OutResult.PriorityList.Num() );
+	for ( FActorPriority& Priority : OutResult.PriorityList )
+	{
+		OutResult.PriorityActors.Add( &Priority );
+	}
+
+	Sort( OutResult.PriorityActors.GetData(), OutResult.PriorityActors.Num(), FCompareFActorPriority() );
+
+	UE_LOG( LogNetTraffic, Log, TEXT( "ServerReplicateActors_PrioritizeActorsThreadSafe: ConsiderList %03i FinalSortedCount %03i" ), ConsiderList.Num(), OutResult.PriorityActors.Num() );
+}
 #endif
 
 int64 UNetDriver::SendDestructionInfo(UNetConnection* Connection, FActorDestructionInfo* DestructionInfo)
@@ -4759,6 +5094,7 @@ struct FScopedNetDriverStats
 		if (GReplicateActorTimingEnabled)
 		{
 			GReplicateActorTimeSeconds = 0;
+			GReplicationCompareTimeSeconds = 0;
 			GNumReplicateActorCalls = 0;
 			GNumSaturatedConnections = 0;
 
@@ -4796,10 +5132,12 @@ struct FScopedNetDriverStats
 			CSV_CUSTOM_STAT(Replication, ServerReplicateActorTimeMS, (float)(GServerReplicateActorTimeSeconds * 1000.0), ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, GatherPrioritizeTimeMS, (float)(GReplicationGatherPrioritizeTimeSeconds * 1000.0), ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, ReplicateActorTimeMS, (float)(GReplicateActorTimeSeconds * 1000.0), ECsvCustomStatOp::Set );
+			CSV_CUSTOM_STAT(Replication, CompareTimeMS, (float)(GReplicationCompareTimeSeconds * 1000.0), ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, NumReplicateActorCallsPerConAvg, ((float)GNumReplicateActorCalls)/(float)GNumClientConnections, ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, Connections, (float)GNumClientConnections, ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, SatConnections, (float)GNumSaturatedConnections, ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, OutKBytes, ((float)FrameOutBytes) / 1024.f, ECsvCustomStatOp::Set );
+			CSV_CUSTOM_STAT(Replication, OutKBytesPerConAvg, GNumClientConnections > 0 ? ((float)FrameOutBytes) / 1024.f / (float)GNumClientConnections : 0.f, ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, OutNetGUIDKBytesSec, ((float)NetDriver->NetGUIDOutBytes / 1024.f), ECsvCustomStatOp::Set );
 			CSV_CUSTOM_STAT(Replication, NumClientUpdateLevelVisibility, ((float)GNumClientUpdateLevelVisibility), ECsvCustomStatOp::Set );
 				
@@ -4843,6 +5181,11 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 	FScopedNetDriverStats NetDriverStats(OutBytes, this);
 	GNumClientConnections = ClientConnections.Num();
 #endif
+
+#if WITH_PUSH_MODEL
+	// Wake any dormant actors that had Push Model properties dirtied since last frame, before we decide what to replicate.
+	GetNetworkObjectList().FlushDormancyForPushModelDirtyObjects(this);
+#endif
 	
 	if (ReplicationDriver)
 	{
@@ -4888,6 +5231,14 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 	FMemMark Mark( FMemStack::Get() );
 
+	// Optionally gather and prioritize all connections up front, replication itself still happens one connection at a time below
+	TArray<FConnectionPrioritizationResult> ParallelPrioritization;
+	const bool bParallelPrioritize = GNetParallelPrioritizeActors != 0 && NumClientsToTick >= FMath::Max(GNetParallelPrioritizeActorsMinConnections, 2) && FApp::ShouldUseThreadingForPerformance();
+	if ( bParallelPrioritize )
+	{
+		ServerReplicateActors_ParallelPrioritizeActors( NumClientsToTick, DeltaSeconds, ConsiderList, ParallelPrioritization );
+	}
+
 	for ( int32 i=0; i < ClientConnections.Num(); i++ )
 	{
 		UNetConnection* Connection = ClientConnections[i];
@@ -4937,6 +5288,11 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 		}
 		else if (Connection->ViewTarget)
 		{		
+			UE_NET_TRACE_CPU_SCOPE(*FString::Printf(TEXT("ServerReplicateActors Connection %u"), Connection->GetConnectionId()), ENetTraceVerbosity::Trace);
+
+#if USE_SERVER_PERF_COUNTERS
+			const double ConnectionReplicationStartTime = FPlatformTime::Seconds();
+#endif
 
 			const int32 LocalNumSaturated = GNumSaturatedConnections;
 
@@ -4944,12 +5300,19 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 			TArray<FNetViewer>& ConnectionViewers = WorldSettings->ReplicationViewers;
 
 			ConnectionViewers.Reset();
-			new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
-			for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+			if ( bParallelPrioritize )
+			{
+				ConnectionViewers.Append( ParallelPrioritization[i].Viewers );
+			}
+			else
 			{
-				if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+				new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
+				for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
 				{
-					new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+					{
+						new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					}
 				}
 			}
 
@@ -4973,48 +5336,37 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 			FActorPriority* PriorityList	= NULL;
 			FActorPriority** PriorityActors = NULL;
 
-			// Get a sorted list of actors for this connection
-			const int32 FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
-
-			// Process the sorted list of actors for this connection
-			const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, ConnectionViewers, PriorityActors, FinalSortedCount, Updated );
+			int32 FinalSortedCount = 0;
 
-			// relevant actors that could not be processed this frame are marked to be considered for next frame
-			for ( int32 k=LastProcessedActor; k<FinalSortedCount; k++ )
+			if ( bParallelPrioritize )
 			{
-				if (!PriorityActors[k]->ActorInfo)
+				// Apply the channel changes that were deferred while prioritizing off the game thread
+				FConnectionPrioritizationResult& Prioritization = ParallelPrioritization[i];
+				for ( UActorChannel* ChannelToClose : Prioritization.ChannelsToClose )
 				{
-					// A deletion entry, skip it because we dont have anywhere to store a 'better give higher priority next time'
-					continue;
+					ChannelToClose->Close(EChannelCloseReason::Relevancy);
 				}
 
-				AActor* Actor = PriorityActors[k]->ActorInfo->Actor;
-
-				UActorChannel* Channel = PriorityActors[k]->Channel;
-				
-				UE_LOG(LogNetTraffic, Verbose, TEXT("Saturated. %s"), *Actor->GetName());
-				if (Channel != NULL && ElapsedTime - Channel->RelevantTime <= 1.0)
+				for ( UActorChannel* DormantChannel : Prioritization.ChannelsToStartDormancy )
 				{
-					UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
-					PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
+					DormantChannel->StartBecomingDormant();
 				}
-				else if ( IsActorRelevantToConnection( Actor, ConnectionViewers ) )
-				{
-					// If this actor was relevant but didn't get processed, force another update for next frame
-					UE_LOG( LogNetTraffic, Log, TEXT( " Saturated. Mark %s NetUpdateTime to be checked for next tick" ), *Actor->GetName() );
-					PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
-					if ( Channel != NULL )
-					{
-						Channel->RelevantTime = ElapsedTime + 0.5 * UpdateDelayRandomStream.FRand();
-					}
-					}
 
-				// If the actor was forced to relevant and didn't get processed, try again on the next update;
-				if (PriorityActors[k]->ActorInfo->ForceRelevantFrame >= Connection->LastProcessedFrame)
-				{
-					PriorityActors[k]->ActorInfo->ForceRelevantFrame = ReplicationFrame+1;
-				}
+				PriorityActors = Prioritization.PriorityActors.GetData();
+				FinalSortedCount = Prioritization.PriorityActors.Num();
 			}
+			else
+			{
+				// Get a sorted list of actors for this connection
+				FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
+			}
+
+			// Process the sorted list of actors for this connection
+			const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, ConnectionViewers, PriorityActors, FinalSortedCount, Updated );
+
+			// relevant actors that could not be processed this frame are marked to be considered for next frame
+			ServerReplicateActors_MarkRelevantActors( Connection, ConnectionViewers, LastProcessedActor, FinalSortedCount, PriorityActors );
+
 			RelevantActorMark.Pop();
 
 			ConnectionViewers.Reset();
@@ -5023,6 +5375,13 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 			const bool bWasSaturated = GNumSaturatedConnections > LocalNumSaturated;
 			Connection->TrackReplicationForAnalytics(bWasSaturated);
+
+#if USE_SERVER_PERF_COUNTERS
+			if (Connection->ReplicationTimeMetric.IsValid())
+			{
+				Connection->ReplicationTimeMetric->Observe((FPlatformTime::Seconds() - ConnectionReplicationStartTime) * 1000.0);
+			}
+#endif
 		}
 
 		if (Connection->GetPendingCloseDueToReplicationFailure())
@@ -5347,6 +5706,18 @@ void UNetDriver::AddClientConnection(UNetConnection * NewConnection)
 
 #if USE_SERVER_PERF_COUNTERS
 	PerfCountersIncrement(TEXT("AddedConnections"));
+
+	IPerfCounters* PerfCounters = IPerfCountersModule::IsAvailable() ? IPerfCountersModule::Get().GetPerformanceCounters() : nullptr;
+	if (PerfCounters)
+	{
+		// dropped from /metrics when the connection is destroyed
+		const TArray<double> ReplicationBucketsMs = { 0.1, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0 };
+		FPerfMetricLabels ConnectionLabels;
+		ConnectionLabels.Emplace(TEXT("driver"), NetDriverName.ToString());
+		ConnectionLabels.Emplace(TEXT("connection"), NewConnection->LowLevelGetRemoteAddress(true));
+		NewConnection->ReplicationTimeMetric = PerfCounters->CreateMetricHistogram(TEXT("ue_net_connection_replication_time_ms"), TEXT("Time spent replicating actors to a connection, in milliseconds."),
+			ReplicationBucketsMs, ConnectionLabels);
+	}
 #endif
 
 	CreateInitialServerChannels(NewConnection);
@@ -6242,6 +6613,53 @@ BUILD_NETEMULATION_CONSOLE_COMMAND(PktIncomingLagMin, "Sets minimum incoming pac
 BUILD_NETEMULATION_CONSOLE_COMMAND(PktIncomingLagMax, "Sets maximum incoming packet latency");
 BUILD_NETEMULATION_CONSOLE_COMMAND(PktIncomingLoss, "Simulates incoming packet loss");
 BUILD_NETEMULATION_CONSOLE_COMMAND(PktJitter, "Simulates outgoing packet jitter");
+BUILD_NETEMULATION_CONSOLE_COMMAND(PktConditionsFile, "Replays network conditions recorded in a CSV file");
+BUILD_NETEMULATION_CONSOLE_COMMAND(PktConnectionProfiles, "Hands out a comma separated list of emulation profiles to the connections in turn");
+
+FAutoConsoleCommandWithWorldArgsAndOutputDevice NetEmulationConnection(TEXT("NetEmulation.Connection"),
+	TEXT("Changes the packet simulation of a single connection until the driver settings change. Usage: NetEmulation.Connection <ConnectionIndex> <Settings>, e.g. NetEmulation.Connection 3 PktLag=200 PktLoss=5. Lists the connections without arguments."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Output)
+{
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (!NetDriver)
+	{
+		Output.Log(TEXT("No game net driver"));
+		return;
+	}
+
+	TArray<UNetConnection*> Connections;
+	if (NetDriver->ServerConnection)
+	{
+		Connections.Add(NetDriver->ServerConnection);
+	}
+	else
+	{
+		Connections.Append(NetDriver->ClientConnections);
+	}
+
+	int32 ConnectionIndex = INDEX_NONE;
+	if (Args.Num() < 2 || !LexTryParseString(ConnectionIndex, *Args[0]) || !Connections.IsValidIndex(ConnectionIndex))
+	{
+		for (int32 Index = 0; Index < Connections.Num(); ++Index)
+		{
+			const FPacketSimulationSettings& Settings = Connections[Index]->PacketSimulationSettings;
+			Output.Logf(TEXT("%d: %s PktLag=%d PktLoss=%d PktConditionsFile=%s"), Index, *Connections[Index]->LowLevelGetRemoteAddress(true), Settings.PktLag, Settings.PktLoss, *Settings.PktConditionsFile);
+		}
+		return;
+	}
+
+	UNetConnection* Connection = Connections[ConnectionIndex];
+
+	FString CmdParams;
+	for (int32 ArgIndex = 1; ArgIndex < Args.Num(); ++ArgIndex)
+	{
+		CmdParams += Args[ArgIndex] + TEXT(" ");
+	}
+
+	FPacketSimulationSettings Settings = Connection->PacketSimulationSettings;
+	Settings.ParseSettings(*CmdParams);
+	Connection->SetConnectionPacketSimulationSettings(Settings);
+}));
 
 #endif //#if DO_ENABLE_NET_TEST
 
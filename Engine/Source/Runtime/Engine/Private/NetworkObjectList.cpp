@@ -3,8 +3,30 @@
 #include "Engine/NetworkObjectList.h"
 #include "Engine/Engine.h"
 #include "Engine/Level.h"
+#include "Components/ActorComponent.h"
 #include "EngineUtils.h"
 #include "Serialization/Archive.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+#if WITH_PUSH_MODEL
+static int32 GPushModelDormancy = 0;
+static FAutoConsoleVariableRef CVarPushModelDormancy(
+	TEXT("net.PushModelDormancy"),
+	GPushModelDormancy,
+	TEXT("When enabled (and Push Model is enabled), actors that are dormant on all connections will automatically flush dormancy when a Push Model property on them or their replicated components is marked dirty. ")
+	TEXT("Changes to properties that are not Push Model based still require calling FlushNetDormancy."),
+	ECVF_Default);
+#endif
+
+FNetworkObjectList::~FNetworkObjectList()
+{
+#if WITH_PUSH_MODEL
+	if (PushModelDirtyObjectTracker != INDEX_NONE)
+	{
+		UE4PushModelPrivate::RemoveDirtyObjectTracker(PushModelDirtyObjectTracker);
+	}
+#endif
+}
 
 void FNetworkObjectList::AddInitialObjects(UWorld* const World, const FName NetDriverName)
 {
@@ -134,6 +156,10 @@ void FNetworkObjectList::Remove(AActor* const Actor)
 		NumDormantObjectsPerConnectionRef--;
 	}
 
+#if WITH_PUSH_MODEL
+	RemovePushModelDormantObject(*NetworkObjectInfo);
+#endif
+
 	// Remove this object from all lists
 	AllNetworkObjects.Remove(Actor);
 	ActiveNetworkObjects.Remove(Actor);
@@ -193,6 +219,10 @@ void FNetworkObjectList::MarkDormant(AActor* const Actor, UNetConnection* const
 		ObjectsDormantOnAllConnections.Add(*NetworkObjectInfoPtr);
 		ActiveNetworkObjects.Remove(Actor);
 
+#if WITH_PUSH_MODEL
+		AddPushModelDormantObject(*NetworkObjectInfo);
+#endif
+
 		UE_LOG(LogNetDormancy, Log, TEXT("FNetworkObjectList::MarkDormant: Actor is now dormant on all connections. Actor: %s. Total: %i, Active: %i, Connection: %s"), *Actor->GetName(), AllNetworkObjects.Num(), ActiveNetworkObjects.Num(), *Connection->GetName());
 	}
 
@@ -228,6 +258,10 @@ bool FNetworkObjectList::MarkActive(AActor* const Actor, UNetConnection* const C
 		// Put this object back on the active list
 		ActiveNetworkObjects.Add(*NetworkObjectInfoPtr);
 
+#if WITH_PUSH_MODEL
+		RemovePushModelDormantObject(*NetworkObjectInfo);
+#endif
+
 		UE_LOG(LogNetDormancy, Log, TEXT("FNetworkObjectList::MarkDormant: Actor is no longer dormant on all connections. Actor: %s. Total: %i, Active: %i, Connection: %s"), *Actor->GetName(), AllNetworkObjects.Num(), ActiveNetworkObjects.Num(), *Connection->GetName());
 	}
 
@@ -293,6 +327,10 @@ void FNetworkObjectList::HandleConnectionAdded()
 	for (auto It = ObjectsDormantOnAllConnections.CreateIterator(); It; ++It)
 	{
 		ActiveNetworkObjects.Add(*It);
+
+#if WITH_PUSH_MODEL
+		RemovePushModelDormantObject(*It->Get());
+#endif
 	}
 
 	ObjectsDormantOnAllConnections.Empty();
@@ -311,9 +349,17 @@ void FNetworkObjectList::ResetDormancyState()
 
 		NetworkObjectInfo->DormantConnections.Empty();
 		NetworkObjectInfo->RecentlyDormantConnections.Empty();
+
+#if WITH_PUSH_MODEL
+		NetworkObjectInfo->PushModelDormancyIds.Empty();
+#endif
 	}
 
 	NumDormantObjectsPerConnection.Empty();
+
+#if WITH_PUSH_MODEL
+	PushModelDormantObjects.Empty();
+#endif
 }
 
 int32 FNetworkObjectList::GetNumDormantActorsForConnection(UNetConnection* const Connection) const
@@ -352,12 +398,100 @@ void FNetworkObjectList::Reset()
 	ActiveNetworkObjects.Empty();
 	ObjectsDormantOnAllConnections.Empty();
 	NumDormantObjectsPerConnection.Empty();
+
+#if WITH_PUSH_MODEL
+	PushModelDormantObjects.Empty();
+#endif
+}
+
+#if WITH_PUSH_MODEL
+void FNetworkObjectList::AddPushModelDormantObject(FNetworkObjectInfo& NetworkObjectInfo)
+{
+	if (!GPushModelDormancy || !IS_PUSH_MODEL_ENABLED())
+	{
+		return;
+	}
+
+	AActor* Actor = NetworkObjectInfo.Actor;
+
+	const int32 ActorPushId = Actor->GetNetPushIdDynamic();
+	if (ActorPushId == INDEX_NONE)
+	{
+		// The actor hasn't been registered with Push Model, so we have no way of hearing about its changes.
+		return;
+	}
+
+	if (PushModelDirtyObjectTracker == INDEX_NONE)
+	{
+		PushModelDirtyObjectTracker = UE4PushModelPrivate::AddDirtyObjectTracker();
+	}
+
+	NetworkObjectInfo.PushModelDormancyIds.Reset();
+	NetworkObjectInfo.PushModelDormancyIds.Add(ActorPushId);
+
+	for (UActorComponent* Component : Actor->GetReplicatedComponents())
+	{
+		const int32 ComponentPushId = Component ? Component->GetNetPushIdDynamic() : INDEX_NONE;
+		if (ComponentPushId != INDEX_NONE)
+		{
+			NetworkObjectInfo.PushModelDormancyIds.Add(ComponentPushId);
+		}
+	}
+
+	for (const int32 PushId : NetworkObjectInfo.PushModelDormancyIds)
+	{
+		PushModelDormantObjects.Add(PushId, NetworkObjectInfo.WeakActor);
+	}
 }
 
+void FNetworkObjectList::RemovePushModelDormantObject(FNetworkObjectInfo& NetworkObjectInfo)
+{
+	for (const int32 PushId : NetworkObjectInfo.PushModelDormancyIds)
+	{
+		PushModelDormantObjects.Remove(PushId);
+	}
+
+	NetworkObjectInfo.PushModelDormancyIds.Reset();
+}
+
+void FNetworkObjectList::FlushDormancyForPushModelDirtyObjects(UNetDriver* NetDriver)
+{
+	if (PushModelDirtyObjectTracker == INDEX_NONE)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_NetworkObjectList_FlushDormancyForPushModelDirtyObjects);
+
+	// Gather first, flushing dormancy will call back into MarkActive and modify PushModelDormantObjects.
+	TArray<AActor*, TInlineAllocator<32>> ActorsToFlush;
+	UE4PushModelPrivate::ConsumeDirtyObjects(PushModelDirtyObjectTracker, [this, &ActorsToFlush](const UE4PushModelPrivate::FNetPushObjectId PushId)
+	{
+		if (const TWeakObjectPtr<AActor>* WeakActor = PushModelDormantObjects.Find(PushId))
+		{
+			if (AActor* Actor = WeakActor->Get())
+			{
+				ActorsToFlush.AddUnique(Actor);
+			}
+		}
+	});
+
+	for (AActor* Actor : ActorsToFlush)
+	{
+		UE_LOG(LogNetDormancy, Verbose, TEXT("FNetworkObjectList::FlushDormancyForPushModelDirtyObjects: Flushing dormancy. Actor: %s"), *Actor->GetName());
+		NetDriver->FlushActorDormancy(Actor);
+	}
+}
+#endif // WITH_PUSH_MODEL
+
 void FNetworkObjectInfo::CountBytes(FArchive& Ar) const
 {
 	DormantConnections.CountBytes(Ar);
 	RecentlyDormantConnections.CountBytes(Ar);
+
+#if WITH_PUSH_MODEL
+	PushModelDormancyIds.CountBytes(Ar);
+#endif
 }
 
 static void CountBytesForNetworkObjectSet(const FNetworkObjectList::FNetworkObjectSet& Set, FArchive& Ar)
@@ -371,6 +505,10 @@ void FNetworkObjectList::CountBytes(FArchive& Ar) const
 	ActiveNetworkObjects.CountBytes(Ar);
 	ObjectsDormantOnAllConnections.CountBytes(Ar);
 	NumDormantObjectsPerConnection.CountBytes(Ar);
+
+#if WITH_PUSH_MODEL
+	PushModelDormantObjects.CountBytes(Ar);
+#endif
  
 	// ObjectsDormantOnAllConnections and ActiveNetworkObjects are both sub sets of AllNetworkObjects
 	// and only have pointers back to the data there.
@@ -29,6 +29,8 @@
 #include "Components/ChildActorComponent.h"
 #include "Net/NetworkGranularMemoryLogging.h"
 #include "GameFramework/Controller.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 #if WITH_EDITOR
 #include "UObject/ObjectRedirector.h"
@@ -122,6 +124,16 @@ static FAutoConsoleVariableRef CVarAllowClientRemapCacheObject(
 	TEXT("When enabled, we will allow clients to remap read only cache objects and keep the same NetGUID.")
 );
 
+static TAutoConsoleVariable<FString> CVarNetPathHashDictionaryFile(
+	TEXT("net.PathHashDictionaryFile"),
+	TEXT(""),
+	TEXT("Path (relative to the project directory) of a dictionary of exported object names, one per line."
+		" When set, NetGUID exports whose name is in the dictionary send a 32 bit hash instead of the full string."
+		" The server and all clients must load the exact same file, so it should be generated ahead of time and shipped with the cooked build."
+		" @see net.DumpPathHashDictionary"),
+	ECVF_ReadOnly
+);
+
 static bool GbQuantizeActorScaleOnSpawn = false;
 static FAutoConsoleVariableRef CVarQuantizeActorScaleOnSpawn(
 	TEXT("net.QuantizeActorScaleOnSpawn"),
@@ -708,6 +720,7 @@ struct FExportFlags
 			uint8 bHasPath				: 1;
 			uint8 bNoLoad				: 1;
 			uint8 bHasNetworkChecksum	: 1;
+			uint8 bHasPathHash			: 1;
 		};
 
 		uint8	Value;
@@ -719,6 +732,139 @@ struct FExportFlags
 	}
 };
 
+/**
+ * Shared table of exported object names (the outer relative names written by InternalWriteObject), keyed by hash.
+ * Loaded once from net.PathHashDictionaryFile. Names whose hashes collide are dropped, and will always be sent in full.
+ */
+class FNetPathHashDictionary
+{
+public:
+
+	static const FNetPathHashDictionary& Get()
+	{
+		static const FNetPathHashDictionary Dictionary;
+		return Dictionary;
+	}
+
+	static uint32 HashName(const FString& Name)
+	{
+		return FCrc::StrCrc32(*Name);
+	}
+
+	bool IsEmpty() const
+	{
+		return HashToName.Num() == 0;
+	}
+
+	bool FindHash(const FString& Name, uint32& OutHash) const
+	{
+		const uint32 Hash = HashName(Name);
+		const FString* FoundName = HashToName.Find(Hash);
+		if (FoundName && FoundName->Equals(Name, ESearchCase::CaseSensitive))
+		{
+			OutHash = Hash;
+			return true;
+		}
+
+		return false;
+	}
+
+	const FString* FindName(const uint32 Hash) const
+	{
+		return HashToName.Find(Hash);
+	}
+
+private:
+
+	FNetPathHashDictionary()
+	{
+		const FString FileName = CVarNetPathHashDictionaryFile.GetValueOnAnyThread();
+		if (FileName.IsEmpty())
+		{
+			return;
+		}
+
+		const FString FilePath = FPaths::Combine(FPaths::ProjectDir(), FileName);
+
+		TArray<FString> Names;
+		if (!FFileHelper::LoadFileToStringArray(Names, *FilePath))
+		{
+			UE_LOG(LogNetPackageMap, Warning, TEXT("FNetPathHashDictionary: Failed to load dictionary %s. Paths will be exported in full."), *FilePath);
+			return;
+		}
+
+		TSet<uint32> CollidingHashes;
+		for (FString& Name : Names)
+		{
+			Name.TrimStartAndEndInline();
+			if (Name.IsEmpty())
+			{
+				continue;
+			}
+
+			const uint32 Hash = HashName(Name);
+			if (const FString* ExistingName = HashToName.Find(Hash))
+			{
+				if (!ExistingName->Equals(Name, ESearchCase::CaseSensitive))
+				{
+					CollidingHashes.Add(Hash);
+				}
+				continue;
+			}
+
+			HashToName.Add(Hash, MoveTemp(Name));
+		}
+
+		for (const uint32 Hash : CollidingHashes)
+		{
+			HashToName.Remove(Hash);
+		}
+
+		UE_LOG(LogNetPackageMap, Log, TEXT("FNetPathHashDictionary: Loaded %s. Names: %d, Collisions: %d"), *FilePath, HashToName.Num(), CollidingHashes.Num());
+	}
+
+	TMap<uint32, FString> HashToName;
+};
+
+static void DumpPathHashDictionary(const TArray<FString>& Args, UWorld* World)
+{
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (NetDriver == nullptr || !NetDriver->GuidCache.IsValid())
+	{
+		UE_LOG(LogNetPackageMap, Warning, TEXT("net.DumpPathHashDictionary: No active net driver."));
+		return;
+	}
+
+	TSet<FString> UniqueNames;
+	for (const TPair<FNetworkGUID, FNetGuidCacheObject>& Entry : NetDriver->GuidCache->ObjectLookup)
+	{
+		if (!Entry.Value.PathName.IsNone())
+		{
+			UniqueNames.Add(Entry.Value.PathName.ToString());
+		}
+	}
+
+	TArray<FString> Names = UniqueNames.Array();
+	Names.Sort();
+
+	const FString FilePath = Args.Num() > 0 ? Args[0] : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("NetPathHashDictionary.txt"));
+	if (FFileHelper::SaveStringArrayToFile(Names, *FilePath))
+	{
+		UE_LOG(LogNetPackageMap, Display, TEXT("net.DumpPathHashDictionary: Wrote %d names to %s"), Names.Num(), *FilePath);
+	}
+	else
+	{
+		UE_LOG(LogNetPackageMap, Warning, TEXT("net.DumpPathHashDictionary: Failed to write %s"), *FilePath);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdDumpPathHashDictionary(
+	TEXT("net.DumpPathHashDictionary"),
+	TEXT("Writes every object name currently known to the NetGUID cache to a file (defaults to Saved/NetPathHashDictionary.txt)."
+		" Merging these from representative sessions produces the dictionary used by net.PathHashDictionaryFile."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DumpPathHashDictionary)
+);
+
 bool FNetGUIDCache::CanClientLoadObject( const UObject* Object, const FNetworkGUID& NetGUID ) const
 {
 	if ( !NetGUID.IsValid() || NetGUID.IsDynamic() )
@@ -782,8 +928,6 @@ void UPackageMapClient::InternalWriteObject( FArchive & Ar, FNetworkGUID NetGUID
 		// Only the client sends default guids
 		check( !IsNetGUIDAuthority() );
 		ExportFlags.bHasPath = 1;
-
-		Ar << ExportFlags.Value;
 	}
 	else if ( GuidCache->IsExportingNetGUIDBunch )
 	{
@@ -800,8 +944,6 @@ void UPackageMapClient::InternalWriteObject( FArchive & Ar, FNetworkGUID NetGUID
 		}
 
 		ExportFlags.bNoLoad	= bNoLoad ? 1 : 0;
-
-		Ar << ExportFlags.Value;
 	}
 
 	if ( ExportFlags.bHasPath )
@@ -825,11 +967,6 @@ void UPackageMapClient::InternalWriteObject( FArchive & Ar, FNetworkGUID NetGUID
 
 		check( bIsPackage == ( Cast< UPackage >( Object ) != NULL ) );		// Make sure it really is a package
 
-		// Serialize reference to outer. This is basically a form of compression.
-		FNetworkGUID OuterNetGUID = GuidCache->GetOrAssignNetGUID( ObjectOuter );
-
-		InternalWriteObject( Ar, OuterNetGUID, ObjectOuter, TEXT( "" ), NULL );
-
 		// Look for renamed startup actors
 		if (Connection->Driver)
 		{
@@ -842,9 +979,38 @@ void UPackageMapClient::InternalWriteObject( FArchive & Ar, FNetworkGUID NetGUID
 		}
 
 		GEngine->NetworkRemapPath(Connection, ObjectPathName, false);
+	}
+
+	// Exported names that are in the shared dictionary are sent as a hash.
+	// Replays are skipped, since the dictionary may not be available (or may have changed) at playback.
+	uint32 PathHash = 0;
+	if ( ExportFlags.bHasPath && GuidCache->IsExportingNetGUIDBunch && !Connection->IsInternalAck() )
+	{
+		const FNetPathHashDictionary& PathHashDictionary = FNetPathHashDictionary::Get();
+		ExportFlags.bHasPathHash = ( !PathHashDictionary.IsEmpty() && PathHashDictionary.FindHash( ObjectPathName, PathHash ) ) ? 1 : 0;
+	}
+
+	if ( NetGUID.IsDefault() || GuidCache->IsExportingNetGUIDBunch )
+	{
+		Ar << ExportFlags.Value;
+	}
+
+	if ( ExportFlags.bHasPath )
+	{
+		// Serialize reference to outer. This is basically a form of compression.
+		FNetworkGUID OuterNetGUID = GuidCache->GetOrAssignNetGUID( ObjectOuter );
+
+		InternalWriteObject( Ar, OuterNetGUID, ObjectOuter, TEXT( "" ), NULL );
 
 		// Serialize Name of object
-		Ar << ObjectPathName;
+		if ( ExportFlags.bHasPathHash )
+		{
+			Ar << PathHash;
+		}
+		else
+		{
+			Ar << ObjectPathName;
+		}
 
 		uint32 NetworkChecksum = 0;
 
@@ -1002,7 +1168,26 @@ FNetworkGUID UPackageMapClient::InternalLoadObject( FArchive & Ar, UObject *& Ob
 		FString PathName;
 		uint32	NetworkChecksum = 0;
 
-		Ar << PathName;
+		if ( ExportFlags.bHasPathHash )
+		{
+			uint32 PathHash = 0;
+			Ar << PathHash;
+
+			const FString* DictionaryName = FNetPathHashDictionary::Get().FindName( PathHash );
+			if ( DictionaryName == nullptr )
+			{
+				UE_LOG( LogNetPackageMap, Error, TEXT( "InternalLoadObject: Unknown path hash %u. NetGUID: %s. Make sure net.PathHashDictionaryFile matches the server." ), PathHash, *NetGUID.ToString() );
+				Ar.SetError();
+				Object = NULL;
+				return NetGUID;
+			}
+
+			PathName = *DictionaryName;
+		}
+		else
+		{
+			Ar << PathName;
+		}
 
 		if ( ExportFlags.bHasNetworkChecksum )
 		{
@@ -2732,6 +2917,31 @@ FNetworkGUID FNetGUIDCache::AssignNewNetGUID_Server( UObject* Object )
 	return NewNetGuid;
 }
 
+void FNetGUIDCache::ReleaseNetGUIDs( UObject* Object )
+{
+	check( IsNetGUIDAuthority() );
+
+	const double Time = FPlatformTime::Seconds();
+
+	// Stably named subobjects are referenced relative to their outer's guid, so they have to be released along with it
+	auto ReleaseNetGUID = [this, Time]( UObject* ObjectToRelease )
+	{
+		FNetworkGUID NetGUID;
+		if ( NetGUIDLookup.RemoveAndCopyValue( ObjectToRelease, NetGUID ) )
+		{
+			if ( FNetGuidCacheObject* CacheObject = ObjectLookup.Find( NetGUID ) )
+			{
+				// CleanReferences removes the entry once in flight references had time to resolve
+				CacheObject->Object = nullptr;
+				CacheObject->ReadOnlyTimestamp = Time;
+			}
+		}
+	};
+
+	ReleaseNetGUID( Object );
+	ForEachObjectWithOuter( Object, ReleaseNetGUID, true );
+}
+
 FNetworkGUID FNetGUIDCache::AssignNewNetGUIDFromPath_Server( const FString& PathName, UObject* ObjOuter, UClass* ObjClass )
 {
 	if ( !IsNetGUIDAuthority() )
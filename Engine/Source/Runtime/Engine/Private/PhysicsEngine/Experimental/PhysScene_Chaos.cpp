@@ -65,6 +65,9 @@ TAutoConsoleVariable<int32> CVar_ChaosUpdateKinematicsOnDeferredSkelMeshes(TEXT(
 int32 GEnableKinematicDeferralStartPhysicsCondition = 1;
 FAutoConsoleVariableRef CVar_EnableKinematicDeferralStartPhysicsCondition(TEXT("p.EnableKinematicDeferralStartPhysicsCondition"), GEnableKinematicDeferralStartPhysicsCondition, TEXT("If is 1, allow kinematics to be deferred in start physics (probably only called from replication tick). If 0, no deferral in startphysics."));
 
+int32 GBatchDeferredPhysicsStateCreation = 1;
+FAutoConsoleVariableRef CVar_BatchDeferredPhysicsStateCreation(TEXT("p.BatchDeferredPhysicsStateCreation"), GBatchDeferredPhysicsStateCreation, TEXT("If 1, deferred physics state creation takes the scene write lock once for the whole batch rather than once per body."));
+
 DECLARE_CYCLE_STAT(TEXT("Update Kinematics On Deferred SkelMeshes"), STAT_UpdateKinematicsOnDeferredSkelMeshesChaos, STATGROUP_Physics);
 
 #if WITH_EDITOR
@@ -1327,16 +1330,30 @@ void FPhysScene_Chaos::ProcessDeferredCreatePhysicsState()
 	});
 
 	// TODO explore parallelization of other physics initialization, not trivial and likely to break stuff.
-	for (UPrimitiveComponent* PrimitiveComponent : DeferredCreatePhysicsStateComponents)
+	auto CreateDeferredPhysicsStates = [this]()
 	{
-		const bool bPendingKill = PrimitiveComponent->GetOwner() && !IsValid(PrimitiveComponent->GetOwner());
-		if (!bPendingKill && PrimitiveComponent->ShouldCreatePhysicsState() && PrimitiveComponent->IsPhysicsStateCreated() == false)
+		for (UPrimitiveComponent* PrimitiveComponent : DeferredCreatePhysicsStateComponents)
 		{
-			PrimitiveComponent->OnCreatePhysicsState();
-			PrimitiveComponent->GlobalCreatePhysicsDelegate.Broadcast(PrimitiveComponent);
+			const bool bPendingKill = PrimitiveComponent->GetOwner() && !IsValid(PrimitiveComponent->GetOwner());
+			if (!bPendingKill && PrimitiveComponent->ShouldCreatePhysicsState() && PrimitiveComponent->IsPhysicsStateCreated() == false)
+			{
+				PrimitiveComponent->OnCreatePhysicsState();
+				PrimitiveComponent->GlobalCreatePhysicsDelegate.Broadcast(PrimitiveComponent);
+			}
+
+			PrimitiveComponent->DeferredCreatePhysicsStateScene = nullptr;
 		}
+	};
 
-		PrimitiveComponent->DeferredCreatePhysicsStateScene = nullptr;
+	// The scene lock is recursive for the owning thread, so holding it here turns each body's own write lock
+	// into a depth increment instead of a contended lock against scene queries running on other threads.
+	if (GBatchDeferredPhysicsStateCreation && DeferredCreatePhysicsStateComponents.Num() > 1)
+	{
+		FPhysicsCommand::ExecuteWrite(this, CreateDeferredPhysicsStates);
+	}
+	else
+	{
+		CreateDeferredPhysicsStates();
 	}
 
 	DeferredCreatePhysicsStateComponents.Reset();
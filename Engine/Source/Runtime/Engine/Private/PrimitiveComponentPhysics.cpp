@@ -14,6 +14,7 @@
 #include "PhysicsReplication.h"
 #include "Physics/PhysicsInterfaceCore.h"
 #include "UObject/UObjectThreadContext.h"
+#include "ProfilingDebugging/ClassCostProfiler.h"
 
 //////////////// PRIMITIVECOMPONENT ///////////////
 
@@ -535,6 +536,8 @@ FTransform UPrimitiveComponent::GetComponentTransformFromBodyInstance(FBodyInsta
 
 void UPrimitiveComponent::SyncComponentToRBPhysics()
 {
+	SCOPE_CLASS_COST(Physics, GetOwner() ? GetOwner()->GetClass() : GetClass());
+
 	if(!IsRegistered())
 	{
 		UE_LOG(LogPhysics, Log, TEXT("SyncComponentToRBPhysics : Component not registered (%s)"), *GetPathName());
@@ -0,0 +1,350 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/ClassCostProfiler.h"
+
+#if WITH_CLASS_COST_PROFILER
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "Misc/ScopeLock.h"
+#include "Trace/Trace.inl"
+#include "UObject/Class.h"
+
+UE_TRACE_CHANNEL(ClassCostChannel)
+
+// Sent the first time a class has a cost. The attachment is the UTF-8 class name.
+UE_TRACE_EVENT_BEGIN(ClassCost, Class)
+	UE_TRACE_EVENT_FIELD(uint32, ClassId)
+UE_TRACE_EVENT_END()
+
+// The cost of a class in one category over the frame which ended at Cycle.
+UE_TRACE_EVENT_BEGIN(ClassCost, FrameCost)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, ClassId)
+	UE_TRACE_EVENT_FIELD(uint32, Count)
+	UE_TRACE_EVENT_FIELD(float, Milliseconds)
+	UE_TRACE_EVENT_FIELD(uint8, Category)
+UE_TRACE_EVENT_END()
+
+bool FClassCostProfiler::bRunning = false;
+
+namespace ClassCostProfiler
+{
+	struct FKey
+	{
+		const UClass* Class;
+		EClassCostCategory Category;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Class == Other.Class && Category == Other.Category;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(PointerHash(Key.Class), uint32(Key.Category));
+		}
+	};
+
+	struct FCost
+	{
+		uint64 Cycles = 0;
+		uint32 Count = 0;
+	};
+
+	struct FTotals
+	{
+		FString ClassName;
+		uint64 Cycles = 0;
+		uint64 Count = 0;
+		uint64 MaxFrameCycles = 0;
+	};
+
+	/** Costs recorded by one thread since the last end of frame. The lock is only contended at the end of the frame. */
+	struct FThreadAccumulator
+	{
+		FCriticalSection Lock;
+		TMap<FKey, FCost> Costs;
+	};
+
+	struct FState
+	{
+		FCriticalSection AccumulatorsLock;
+		TArray<FThreadAccumulator*> Accumulators;
+
+		// Only touched on the game thread
+		TMap<FKey, FTotals> Totals;
+		uint64 NumFrames = 0;
+		TMap<const UClass*, uint32> TraceClassIds;
+		bool bStartedByTrace = false;
+	};
+
+	static FState& GetState()
+	{
+		static FState State;
+		return State;
+	}
+
+	static thread_local FThreadAccumulator* GThreadAccumulator = nullptr;
+	static thread_local FScopedClassCost* GCurrentScope = nullptr;
+
+	static FThreadAccumulator& GetThreadAccumulator()
+	{
+		if (GThreadAccumulator == nullptr)
+		{
+			// Accumulators are never freed, threads which exit leave an empty one behind
+			FState& State = GetState();
+			FScopeLock Lock(&State.AccumulatorsLock);
+			GThreadAccumulator = new FThreadAccumulator();
+			State.Accumulators.Add(GThreadAccumulator);
+		}
+		return *GThreadAccumulator;
+	}
+
+	static uint32 GetTraceClassId(FState& State, const UClass* InClass)
+	{
+		uint32* ClassId = State.TraceClassIds.Find(InClass);
+		if (ClassId)
+		{
+			return *ClassId;
+		}
+
+		const uint32 NewClassId = State.TraceClassIds.Num() + 1;
+		State.TraceClassIds.Add(InClass, NewClassId);
+
+		const FTCHARToUTF8 Name(*InClass->GetName());
+		UE_TRACE_LOG(ClassCost, Class, ClassCostChannel, Name.Length() + 1)
+			<< Class.ClassId(NewClassId)
+			<< Class.Attachment(Name.Get(), Name.Length() + 1);
+
+		return NewClassId;
+	}
+
+	static void OnEndFrame()
+	{
+		FState& State = GetState();
+
+		// The trace channel runs the profiler for as long as it is enabled
+		const bool bTrace = UE_TRACE_CHANNELEXPR_IS_ENABLED(ClassCostChannel);
+		if (bTrace && !FClassCostProfiler::IsRunning())
+		{
+			FClassCostProfiler::Start();
+			State.bStartedByTrace = true;
+		}
+		else if (!bTrace && State.bStartedByTrace)
+		{
+			FClassCostProfiler::Stop();
+		}
+
+		if (!FClassCostProfiler::IsRunning())
+		{
+			return;
+		}
+
+		TMap<FKey, FCost> FrameCosts;
+		{
+			FScopeLock AccumulatorsLock(&State.AccumulatorsLock);
+			for (FThreadAccumulator* Accumulator : State.Accumulators)
+			{
+				FScopeLock Lock(&Accumulator->Lock);
+				for (const TPair<FKey, FCost>& Pair : Accumulator->Costs)
+				{
+					FCost& Cost = FrameCosts.FindOrAdd(Pair.Key);
+					Cost.Cycles += Pair.Value.Cycles;
+					Cost.Count += Pair.Value.Count;
+				}
+				Accumulator->Costs.Reset();
+			}
+		}
+
+		++State.NumFrames;
+		const uint64 FrameEndCycle = FPlatformTime::Cycles64();
+
+		for (const TPair<FKey, FCost>& Pair : FrameCosts)
+		{
+			FTotals& Totals = State.Totals.FindOrAdd(Pair.Key);
+			if (Totals.ClassName.IsEmpty())
+			{
+				Totals.ClassName = Pair.Key.Class->GetName();
+			}
+			Totals.Cycles += Pair.Value.Cycles;
+			Totals.Count += Pair.Value.Count;
+			Totals.MaxFrameCycles = FMath::Max(Totals.MaxFrameCycles, Pair.Value.Cycles);
+
+			if (bTrace)
+			{
+				const uint32 ClassId = GetTraceClassId(State, Pair.Key.Class);
+				UE_TRACE_LOG(ClassCost, FrameCost, ClassCostChannel)
+					<< FrameCost.Cycle(FrameEndCycle)
+					<< FrameCost.ClassId(ClassId)
+					<< FrameCost.Count(Pair.Value.Count)
+					<< FrameCost.Milliseconds(float(FPlatformTime::ToMilliseconds64(Pair.Value.Cycles)))
+					<< FrameCost.Category(uint8(Pair.Key.Category));
+			}
+		}
+	}
+
+	static FDelayedAutoRegisterHelper GRegisterEndFrame(EDelayedRegisterRunPhase::EndOfEngineInit, []()
+	{
+		FCoreDelegates::OnEndFrame.AddStatic(&OnEndFrame);
+	});
+}
+
+void FScopedClassCost::Begin(EClassCostCategory InCategory, const UClass* InClass)
+{
+	Class = InClass;
+	Category = InCategory;
+	Parent = ClassCostProfiler::GCurrentScope;
+	ClassCostProfiler::GCurrentScope = this;
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+void FScopedClassCost::End()
+{
+	const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+	ClassCostProfiler::GCurrentScope = Parent;
+	if (Parent)
+	{
+		Parent->ChildCycles += Cycles;
+	}
+
+	ClassCostProfiler::FThreadAccumulator& Accumulator = ClassCostProfiler::GetThreadAccumulator();
+	FScopeLock Lock(&Accumulator.Lock);
+	ClassCostProfiler::FCost& Cost = Accumulator.Costs.FindOrAdd(ClassCostProfiler::FKey{ Class, Category });
+	Cost.Cycles += Cycles - FMath::Min(ChildCycles, Cycles);
+	++Cost.Count;
+}
+
+void FClassCostProfiler::Start()
+{
+	bRunning = true;
+}
+
+void FClassCostProfiler::Stop()
+{
+	bRunning = false;
+	ClassCostProfiler::GetState().bStartedByTrace = false;
+}
+
+void FClassCostProfiler::Reset()
+{
+	check(IsInGameThread());
+
+	ClassCostProfiler::FState& State = ClassCostProfiler::GetState();
+	State.Totals.Reset();
+	State.NumFrames = 0;
+}
+
+const TCHAR* FClassCostProfiler::GetCategoryName(EClassCostCategory Category)
+{
+	switch (Category)
+	{
+	case EClassCostCategory::Tick:			return TEXT("Tick");
+	case EClassCostCategory::Replication:	return TEXT("Replication");
+	case EClassCostCategory::Physics:		return TEXT("Physics");
+	case EClassCostCategory::Movement:		return TEXT("Movement");
+	default:								return TEXT("All");
+	}
+}
+
+void FClassCostProfiler::Dump(FOutputDevice& Ar, int32 MaxClasses, EClassCostCategory Category)
+{
+	check(IsInGameThread());
+
+	const ClassCostProfiler::FState& State = ClassCostProfiler::GetState();
+	if (State.NumFrames == 0)
+	{
+		Ar.Logf(TEXT("No class costs recorded%s"), IsRunning() ? TEXT(" yet") : TEXT(", start with ClassCost.Start"));
+		return;
+	}
+
+	TArray<TPair<ClassCostProfiler::FKey, const ClassCostProfiler::FTotals*>> Entries;
+	uint64 TotalCycles = 0;
+	for (const TPair<ClassCostProfiler::FKey, ClassCostProfiler::FTotals>& Pair : State.Totals)
+	{
+		if (Category == EClassCostCategory::Count || Pair.Key.Category == Category)
+		{
+			Entries.Emplace(Pair.Key, &Pair.Value);
+			TotalCycles += Pair.Value.Cycles;
+		}
+	}
+
+	Entries.Sort([](const TPair<ClassCostProfiler::FKey, const ClassCostProfiler::FTotals*>& A, const TPair<ClassCostProfiler::FKey, const ClassCostProfiler::FTotals*>& B)
+	{
+		return A.Value->Cycles > B.Value->Cycles;
+	});
+
+	const double NumFrames = double(State.NumFrames);
+	Ar.Logf(TEXT("Class costs over %llu frames, %s, %.3f ms/frame in total"), State.NumFrames, GetCategoryName(Category), FPlatformTime::ToMilliseconds64(TotalCycles) / NumFrames);
+	Ar.Logf(TEXT("%-48s %-12s %12s %12s %12s %7s"), TEXT("Class"), TEXT("Category"), TEXT("Avg ms/frame"), TEXT("Peak ms"), TEXT("Calls/frame"), TEXT("%"));
+
+	for (int32 Index = 0; Index < FMath::Min(Entries.Num(), MaxClasses); ++Index)
+	{
+		const ClassCostProfiler::FTotals& Totals = *Entries[Index].Value;
+		Ar.Logf(TEXT("%-48s %-12s %12.3f %12.3f %12.1f %6.1f%%"),
+			*Totals.ClassName,
+			GetCategoryName(Entries[Index].Key.Category),
+			FPlatformTime::ToMilliseconds64(Totals.Cycles) / NumFrames,
+			FPlatformTime::ToMilliseconds64(Totals.MaxFrameCycles),
+			double(Totals.Count) / NumFrames,
+			TotalCycles ? 100.0 * double(Totals.Cycles) / double(TotalCycles) : 0.0);
+	}
+}
+
+static FAutoConsoleCommand ClassCostStartCommand(
+	TEXT("ClassCost.Start"),
+	TEXT("Starts attributing tick, replication, physics and movement time to actor classes"),
+	FConsoleCommandDelegate::CreateLambda([]() {
+		FClassCostProfiler::Start();
+		UE_LOG(LogConsoleResponse, Display, TEXT("Started attributing class costs."));
+	})
+);
+
+static FAutoConsoleCommand ClassCostStopCommand(
+	TEXT("ClassCost.Stop"),
+	TEXT("Stops attributing time to actor classes, the totals are kept"),
+	FConsoleCommandDelegate::CreateLambda([]() {
+		FClassCostProfiler::Stop();
+		UE_LOG(LogConsoleResponse, Display, TEXT("Stopped attributing class costs."));
+	})
+);
+
+static FAutoConsoleCommand ClassCostResetCommand(
+	TEXT("ClassCost.Reset"),
+	TEXT("Clears the class cost totals"),
+	FConsoleCommandDelegate::CreateLambda([]() {
+		FClassCostProfiler::Reset();
+		UE_LOG(LogConsoleResponse, Display, TEXT("Cleared class costs."));
+	})
+);
+
+static FAutoConsoleCommand ClassCostDumpCommand(
+	TEXT("ClassCost.Dump"),
+	TEXT("Logs the most expensive actor classes. Args [NumClasses=20] [Tick|Replication|Physics|Movement]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar) {
+		int32 MaxClasses = 20;
+		EClassCostCategory Category = EClassCostCategory::Count;
+		for (const FString& Arg : Args)
+		{
+			if (Arg.IsNumeric())
+			{
+				MaxClasses = FCString::Atoi(*Arg);
+				continue;
+			}
+
+			for (uint8 Index = 0; Index < uint8(EClassCostCategory::Count); ++Index)
+			{
+				if (Arg == FClassCostProfiler::GetCategoryName(EClassCostCategory(Index)))
+				{
+					Category = EClassCostCategory(Index);
+				}
+			}
+		}
+
+		FClassCostProfiler::Dump(Ar, MaxClasses, Category);
+	})
+);
+
+#endif // WITH_CLASS_COST_PROFILER
@@ -55,6 +55,15 @@ int32 GNetSharedSerializedData = 1;
 static FAutoConsoleVariableRef CVarNetShareSerializedData(TEXT("net.ShareSerializedData"), GNetSharedSerializedData,
 	TEXT("If true, enable shared serialization system used by replication to reduce CPU usage when multiple clients need the same data"));
 
+int32 GNetShareSerializedChangelists = 0;
+static FAutoConsoleVariableRef CVarNetShareSerializedChangelists(TEXT("net.ShareSerializedChangelists"), GNetShareSerializedChangelists,
+	TEXT("If true and net.ShareSerializedData is enabled, connections that send an identical changelist reuse the first connection's serialized payload instead of serializing it again. ")
+	TEXT("Only applies to changelists whose properties are all eligible for shared serialization."));
+
+int32 GNetMaxSerializedChangelists = 4;
+static FAutoConsoleVariableRef CVarNetMaxSerializedChangelists(TEXT("net.ShareSerializedChangelists.MaxPerObject"), GNetMaxSerializedChangelists,
+	TEXT("Maximum number of distinct serialized changelists cached per object when net.ShareSerializedChangelists is enabled."));
+
 int32 GNetVerifyShareSerializedData = 0;
 static FAutoConsoleVariableRef CVarNetVerifyShareSerializedData(TEXT("net.VerifyShareSerializedData"), GNetVerifyShareSerializedData,
 	TEXT("Debug option to verify shared serialization data during replication"));
@@ -75,6 +84,8 @@ int32 GShareInitialCompareState = 0;
 static FAutoConsoleVariableRef CVarShareInitialCompareState(TEXT("net.ShareInitialCompareState"), GShareInitialCompareState,
 	TEXT("If true and net.ShareShadowState is enabled, attempt to also share initial replication compares across connections."));
 
+double GReplicationCompareTimeSeconds = 0.0;
+
 bool GbTrackNetSerializeObjectReferences = false;
 static FAutoConsoleVariableRef CVarTrackNetSerializeObjectReferences(TEXT("net.TrackNetSerializeObjectReferences"), GbTrackNetSerializeObjectReferences, TEXT("If true, we will create small layouts for Net Serialize Structs if they have Object Properties. This can prevent some Shadow State GC crashes."));
 
@@ -1209,6 +1220,9 @@ ERepLayoutResult FRepLayout::UpdateChangelistMgr(
 	const FReplicationFlags& RepFlags,
 	const bool bForceCompare) const
 {
+	// Track time spent comparing properties, reported through the Replication CSV category.
+	FSimpleScopeSecondsCounter ScopedSecondsCounter(GReplicationCompareTimeSeconds, GReplicateActorTimingEnabled);
+
 	ERepLayoutResult Result = ERepLayoutResult::Success;
 
 	if (GShareInitialCompareState)
@@ -2514,6 +2528,15 @@ void FRepSerializationSharedInfo::CountBytes(FArchive& Ar) const
 
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SharedPropertyInfo", SharedPropertyInfo.CountBytes(Ar));
 
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SerializedChangelists",
+		SerializedChangelists.CountBytes(Ar);
+		for (const FRepSerializedChangelist& SerializedChangelist : SerializedChangelists)
+		{
+			SerializedChangelist.Changed.CountBytes(Ar);
+			SerializedChangelist.Buffer.CountBytes(Ar);
+		}
+	);
+
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SerializedProperties",
 		if (FNetBitWriter const* const LocalSerializedProperties = SerializedProperties.Get())
 		{
@@ -2594,7 +2617,8 @@ void FRepLayout::SendProperties_r(
 	FRepHandleIterator& HandleIterator,
 	const FConstRepObjectDataBuffer SourceData,
 	const int32 ArrayDepth,
-	const FRepSerializationSharedInfo* const RESTRICT SharedInfo) const
+	const FRepSerializationSharedInfo* const RESTRICT SharedInfo,
+	bool* const RESTRICT bOutWroteConnectionDependentData) const
 {
 	const bool bDoSharedSerialization = SharedInfo && !!GNetSharedSerializedData;
 
@@ -2636,7 +2660,7 @@ void FRepLayout::SendProperties_r(
 			check(ArrayHandleIterator.ArrayElementSize> 0);
 			check(ArrayHandleIterator.NumHandlesPerElement> 0);
 
-			SendProperties_r(RepState, Writer, bDoChecksum, ArrayHandleIterator, ArrayData, ArrayDepth + 1, SharedInfo);
+			SendProperties_r(RepState, Writer, bDoChecksum, ArrayHandleIterator, ArrayData, ArrayDepth + 1, SharedInfo, bOutWroteConnectionDependentData);
 
 			check(HandleIterator.ChangelistIterator.ChangedIndex - OldChangedIndex == ArrayChangedCount);				// Make sure we read correct amount
 			check(HandleIterator.ChangelistIterator.Changed[HandleIterator.ChangelistIterator.ChangedIndex] == 0);	// Make sure we are at the end
@@ -2656,6 +2680,11 @@ void FRepLayout::SendProperties_r(
 
 		const FRepSerializedPropertyInfo* SharedPropInfo = nullptr;
 
+		if (bOutWroteConnectionDependentData && !EnumHasAnyFlags(Cmd.Flags, ERepLayoutCmdFlags::IsSharedSerialization))
+		{
+			*bOutWroteConnectionDependentData = true;
+		}
+
 		if (bDoSharedSerialization && EnumHasAnyFlags(Cmd.Flags, ERepLayoutCmdFlags::IsSharedSerialization))
 		{
 			FRepSharedPropertyKey PropertyKey(HandleIterator.CmdIndex, HandleIterator.ArrayIndex, ArrayDepth, (void*)Data.Data);
@@ -2753,7 +2782,7 @@ void FRepLayout::SendProperties(
 	UClass* ObjectClass,
 	FNetBitWriter& Writer,
 	TArray<uint16>& Changed,
-	const FRepSerializationSharedInfo& SharedInfo) const
+	FRepSerializationSharedInfo& SharedInfo) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetReplicateDynamicPropSendTime);
 
@@ -2770,6 +2799,27 @@ void FRepLayout::SendProperties(
 
 	
 	UE_NET_TRACE_SCOPE(Properties, Writer, GetTraceCollector(Writer), ENetTraceVerbosity::Trace);
+
+	// Checksums are debug only, don't bother sharing them.
+	const bool bShareSerializedChangelist = !!GNetShareSerializedChangelists && !!GNetSharedSerializedData && !bDoChecksum;
+
+	if (bShareSerializedChangelist)
+	{
+		if (const FRepSerializedChangelist* SerializedChangelist = SharedInfo.FindSerializedChangelist(Changed))
+		{
+			UE_NET_TRACE_SCOPE(Shared, Writer, GetTraceCollector(Writer), ENetTraceVerbosity::Trace);
+			UE_LOG(LogRepProperties, VeryVerbose, TEXT("SendProperties: Owner=%s, Reusing serialized changelist (%lld bits)"), *Owner->GetPathName(), SerializedChangelist->NumBits);
+
+			GNumSharedSerializationHit++;
+
+			if (SerializedChangelist->NumBits > 0)
+			{
+				Writer.SerializeBits(const_cast<uint8*>(SerializedChangelist->Buffer.GetData()), SerializedChangelist->NumBits);
+			}
+			return;
+		}
+	}
+
 	FBitWriterMark Mark(Writer);
 
 #ifdef ENABLE_PROPERTY_CHECKSUMS
@@ -2783,7 +2833,8 @@ void FRepLayout::SendProperties(
 	FChangelistIterator ChangelistIterator(Changed, 0);
 	FRepHandleIterator HandleIterator(Owner, ChangelistIterator, Cmds, BaseHandleToCmdIndex, 0, 1, 0, Cmds.Num() - 1);
 
-	SendProperties_r(RepState, Writer, bDoChecksum, HandleIterator, Data, 0, &SharedInfo);
+	bool bWroteConnectionDependentData = false;
+	SendProperties_r(RepState, Writer, bDoChecksum, HandleIterator, Data, 0, &SharedInfo, &bWroteConnectionDependentData);
 
 	if (NumBits != Writer.GetNumBits())
 	{
@@ -2794,6 +2845,18 @@ void FRepLayout::SendProperties(
 	{
 		Mark.Pop(Writer);
 	}
+
+	// If nothing we wrote depended on the connection, let other connections with the same changelist copy it.
+	if (bShareSerializedChangelist && !bWroteConnectionDependentData && !Writer.IsError() && SharedInfo.SerializedChangelists.Num() < GNetMaxSerializedChangelists)
+	{
+		FRepSerializedChangelist& SerializedChangelist = SharedInfo.SerializedChangelists.AddDefaulted_GetRef();
+		SerializedChangelist.Changed = Changed;
+		SerializedChangelist.NumBits = Writer.GetNumBits() - Mark.GetNumBits();
+		if (SerializedChangelist.NumBits > 0)
+		{
+			Mark.Copy(Writer, SerializedChangelist.Buffer);
+		}
+	}
 }
 
 static FORCEINLINE void WritePropertyHandle_BackwardsCompatible(
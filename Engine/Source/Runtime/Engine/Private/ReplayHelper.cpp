@@ -641,6 +641,8 @@ void FReplayHelper::SaveCheckpoint(UNetConnection* Connection)
 	CheckpointSaveContext.TotalCheckpointReplicationTimeSeconds = 0;
 	CheckpointSaveContext.TotalCheckpointSaveFrames = 0;
 	CheckpointSaveContext.TotalCheckpointActors = CheckpointSaveContext.PendingCheckpointActors.Num();
+	CheckpointSaveContext.bWroteCheckpointFrameHeader = false;
+	CheckpointSaveContext.NextQueuedCheckpointPacket = 0;
 
 	LastCheckpointTime = DemoCurrentTime;
 
@@ -883,36 +885,56 @@ void FReplayHelper::TickCheckpoint(UNetConnection* Connection)
 
 			case ECheckpointSaveState::SerializeDemoFrameFromQueuedDemoPackets:
 			{
-				// Postpone execution of this state if we have used to much of our alloted time, this value can be tweaked based on profiling
-				const double RequiredRatioFor_SerializeDemoFrameFromQueuedDemoPackets = 0.8;
-				if ((bExecuteNextState = ShouldExecuteState(Params, CurrentTime, RequiredRatioFor_SerializeDemoFrameFromQueuedDemoPackets)) == true)
+				if (!CheckpointSaveContext.bWroteCheckpointFrameHeader)
 				{
-					SCOPED_NAMED_EVENT(FReplayHelper_SerializeDemoFrameFromQueuedDemoPackets, FColor::Green);
-
-					// Write offset
-					if (CheckpointSaveContext.bWriteCheckpointOffset)
+					// Postpone execution of this state if we have used to much of our alloted time, this value can be tweaked based on profiling
+					const double RequiredRatioFor_SerializeDemoFrameFromQueuedDemoPackets = 0.8;
+					if ((bExecuteNextState = ShouldExecuteState(Params, CurrentTime, RequiredRatioFor_SerializeDemoFrameFromQueuedDemoPackets)) == true)
 					{
-						const FArchivePos CurrentPosition = CheckpointArchive->Tell();
-						FArchivePos Offset = CurrentPosition - (CheckpointSaveContext.CheckpointOffset + sizeof(FArchivePos));
-						CheckpointArchive->Seek(CheckpointSaveContext.CheckpointOffset);
-						*CheckpointArchive << Offset;
-						CheckpointArchive->Seek(CurrentPosition);
-					}
+						SCOPED_NAMED_EVENT(FReplayHelper_SerializeDemoFrameFromQueuedDemoPackets, FColor::Green);
+
+						// Write offset
+						if (CheckpointSaveContext.bWriteCheckpointOffset)
+						{
+							const FArchivePos CurrentPosition = CheckpointArchive->Tell();
+							FArchivePos Offset = CurrentPosition - (CheckpointSaveContext.CheckpointOffset + sizeof(FArchivePos));
+							CheckpointArchive->Seek(CheckpointSaveContext.CheckpointOffset);
+							*CheckpointArchive << Offset;
+							CheckpointArchive->Seek(CurrentPosition);
+						}
+
+						// Get the size of the guid data saved
+						CheckpointSaveContext.GuidCacheSize = CheckpointArchive->TotalSize();
 
-					// Get the size of the guid data saved
-					CheckpointSaveContext.GuidCacheSize = CheckpointArchive->TotalSize();
+						// This will cause the entire name list to be written out again.
+						// Note, WriteDemoFrameHeader will set this to 0 so we guard the value.
+						// This is because when checkpoint amortization is enabled, it's possible for new levels to stream
+						// in while recording a checkpoint, and we want to make sure those get written out to the normal
+						// streaming archive next frame.
+						TGuardValue<uint32> NumLevelsAddedThisFrameGuard(NumLevelsAddedThisFrame, AllLevelStatuses.Num());
 
-					// This will cause the entire name list to be written out again.
-					// Note, WriteDemoFrame will set this to 0 so we guard the value.
-					// This is because when checkpoint amortization is enabled, it's possible for new levels to stream
-					// in while recording a checkpoint, and we want to make sure those get written out to the normal
-					// streaming archive next frame.
-					TGuardValue<uint32> NumLevelsAddedThisFrameGuard(NumLevelsAddedThisFrame, AllLevelStatuses.Num());
+						WriteDemoFrameHeader(Connection, *CheckpointArchive, static_cast<float>(LastCheckpointTime), EWriteDemoFrameFlags::SkipGameSpecific);
 
-					// Write out all of the queued up packets generated while saving the checkpoint
-					WriteDemoFrame(Connection, *CheckpointArchive, QueuedCheckpointPackets, static_cast<float>(LastCheckpointTime), EWriteDemoFrameFlags::SkipGameSpecific);
+						CheckpointSaveContext.bWroteCheckpointFrameHeader = true;
+						CheckpointSaveContext.NextQueuedCheckpointPacket = 0;
+					}
+				}
+
+				if (CheckpointSaveContext.bWroteCheckpointFrameHeader)
+				{
+					SCOPED_NAMED_EVENT(FReplayHelper_SerializeQueuedCheckpointPackets, FColor::Green);
 
-					CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState::Finalize;
+					// Write out all of the queued up packets generated while saving the checkpoint.
+					// This can be spread over multiple frames, and each packet is released as soon as it's written
+					// so we never hold both the queued packets and the fully serialized checkpoint in memory.
+					bExecuteNextState = SerializeQueuedCheckpointPackets(Params, CheckpointArchive);
+					if (bExecuteNextState)
+					{
+						QueuedCheckpointPackets.Empty();
+						WriteDemoFrameEnd(*CheckpointArchive);
+
+						CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState::Finalize;
+					}
 				}
 			}
 			break;
@@ -1033,6 +1055,31 @@ bool FReplayHelper::SerializeGuidCache(UNetConnection* Connection, const FRepAct
 	return bCompleted;
 }
 
+bool FReplayHelper::SerializeQueuedCheckpointPackets(const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const double Deadline = Params.StartCheckpointTime + Params.CheckpointMaxUploadTimePerFrame;
+
+	for (; CheckpointSaveContext.NextQueuedCheckpointPacket < QueuedCheckpointPackets.Num(); )
+	{
+		FQueuedDemoPacket& DemoPacket = QueuedCheckpointPackets[CheckpointSaveContext.NextQueuedCheckpointPacket++];
+
+		WriteDemoFramePacket(*CheckpointArchive, DemoPacket);
+		DemoPacket.Data.Empty();
+
+		if (Params.CheckpointMaxUploadTimePerFrame > 0 && (FPlatformTime::Seconds() >= Deadline))
+		{
+			break;
+		}
+	}
+
+	const bool bCompleted = CheckpointSaveContext.NextQueuedCheckpointPacket == QueuedCheckpointPackets.Num();
+
+	UE_LOG(LogDemo, Verbose, TEXT("Checkpoint. SerializeQueuedCheckpointPackets: %i/%i, took %.3f (%.3f)"), CheckpointSaveContext.NextQueuedCheckpointPacket, QueuedCheckpointPackets.Num(), FPlatformTime::Seconds() - Params.StartCheckpointTime, FPlatformTime::Seconds() - StartTime);
+
+	return bCompleted;
+}
+
 void FReplayHelper::ResetLevelStatuses()
 {
 	ClearLevelStreamingState();
@@ -1060,6 +1107,20 @@ void FReplayHelper::WriteDemoFrame(UNetConnection* Connection, FArchive& Ar, TAr
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Replay write frame time"), STAT_ReplayWriteDemoFrame, STATGROUP_Net);
 
+	WriteDemoFrameHeader(Connection, Ar, FrameTime, Flags);
+
+	for (FQueuedDemoPacket& DemoPacket : QueuedPackets)
+	{
+		WriteDemoFramePacket(Ar, DemoPacket);
+	}
+
+	QueuedPackets.Empty();
+
+	WriteDemoFrameEnd(Ar);
+}
+
+void FReplayHelper::WriteDemoFrameHeader(UNetConnection* Connection, FArchive& Ar, float FrameTime, EWriteDemoFrameFlags Flags)
+{
 	check(Connection);
 
 	Ar << CurrentLevelIndex;
@@ -1124,20 +1185,21 @@ void FReplayHelper::WriteDemoFrame(UNetConnection* Connection, FArchive& Ar, TAr
 			Ar << Data;
 		}
 	}
+}
 
-	for (FQueuedDemoPacket& DemoPacket : QueuedPackets)
+void FReplayHelper::WriteDemoFramePacket(FArchive& Ar, FQueuedDemoPacket& DemoPacket)
+{
+	if (HasLevelStreamingFixes())
 	{
-		if (HasLevelStreamingFixes())
-		{
-			ensureAlways(DemoPacket.SeenLevelIndex);
-			Ar.SerializeIntPacked(DemoPacket.SeenLevelIndex);
-		}
-
-		WritePacket(Ar, DemoPacket.Data.GetData(), DemoPacket.Data.Num());
+		ensureAlways(DemoPacket.SeenLevelIndex);
+		Ar.SerializeIntPacked(DemoPacket.SeenLevelIndex);
 	}
 
-	QueuedPackets.Empty();
+	WritePacket(Ar, DemoPacket.Data.GetData(), DemoPacket.Data.Num());
+}
 
+void FReplayHelper::WriteDemoFrameEnd(FArchive& Ar)
+{
 	if (HasLevelStreamingFixes())
 	{
 		uint32 EndCountUnsigned = 0;
@@ -87,6 +87,20 @@ UActorComponent* USCS_Node::ExecuteNodeOnActor(AActor* Actor, USceneComponent* P
 	// Create a new component instance based on the template
 	UActorComponent* NewActorComp = nullptr;
 	UBlueprintGeneratedClass* ActualBPGC = CastChecked<UBlueprintGeneratedClass>(Actor->GetClass());
+
+	// Cosmetic components are skipped on dedicated servers, and their children are attached to our parent instead.
+	// Roots are kept when they have children, which would otherwise all compete for the root.
+	if (IsRunningDedicatedServer() && (ParentComponent != nullptr || ChildNodes.Num() == 0) && IsStrippedForServer(ActualBPGC))
+	{
+		for (USCS_Node* Node : ChildNodes)
+		{
+			check(Node != nullptr);
+			Node->ExecuteNodeOnActor(Actor, ParentComponent, nullptr, nullptr, false);
+		}
+
+		return nullptr;
+	}
+
 	const FBlueprintCookedComponentInstancingData* ActualComponentTemplateData = ActualBPGC->UseFastPathComponentInstancing() ? GetActualComponentTemplateData(ActualBPGC) : nullptr;
 	if (ActualComponentTemplateData && ActualComponentTemplateData->bHasValidCookedData
 		&& ensureMsgf(ActualComponentTemplateData->ComponentTemplateClass != nullptr, TEXT("SCS fast path (%s.%s): Cooked data is valid, but runtime support data is not initialized. Using the slow path instead."), *ActualBPGC->GetName(), *InternalVariableName.ToString()))
@@ -202,6 +216,18 @@ UActorComponent* USCS_Node::ExecuteNodeOnActor(AActor* Actor, USceneComponent* P
 	return NewActorComp;
 }
 
+bool USCS_Node::IsStrippedForServer(UBlueprintGeneratedClass* ActualBPGC) const
+{
+	if (const UActorComponent* ActualComponentTemplate = GetActualComponentTemplate(ActualBPGC))
+	{
+		return ActualComponentTemplate->CanStripForServer();
+	}
+
+	// Server cooks leave stripped templates out, only the class is left to go by
+	const UActorComponent* ComponentCDO = ComponentClass ? Cast<UActorComponent>(ComponentClass->GetDefaultObject()) : nullptr;
+	return ComponentCDO && ComponentCDO->CanStripForServer();
+}
+
 TArray<USCS_Node*> USCS_Node::GetAllNodes()
 {
 	TArray<USCS_Node*> AllNodes;
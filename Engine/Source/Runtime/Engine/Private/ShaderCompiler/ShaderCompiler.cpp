@@ -1941,7 +1941,18 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 			}
 			check(TransferFile);
 
-			if (!FShaderCompileUtilities::DoWriteTasks(CurrentWorkerInfo.QueuedJobs, *TransferFile))
+			// Serialize the batch to memory first and write it with a single call, the file writer's small
+			// internal buffer otherwise turns every job's environment and includes into many write calls.
+			TArray<uint8> TransferBuffer;
+			FMemoryWriter TransferWriter(TransferBuffer);
+			bool bWroteTasks = FShaderCompileUtilities::DoWriteTasks(CurrentWorkerInfo.QueuedJobs, TransferWriter);
+			if (bWroteTasks)
+			{
+				TransferFile->Serialize(TransferBuffer.GetData(), TransferBuffer.Num());
+				bWroteTasks = TransferFile->Close();
+			}
+
+			if (!bWroteTasks)
 			{
 				uint64 TotalDiskSpace = 0;
 				uint64 FreeDiskSpace = 0;
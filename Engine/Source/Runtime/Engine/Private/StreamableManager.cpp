@@ -817,6 +817,14 @@ void FStreamableHandle::AsyncLoadCallbackWrapper(const FName& PackageName, UPack
 	}
 }
 
+void FStreamableHandle::AsyncLoadPackageCallbackWrapper(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result, TArray<FSoftObjectPath> TargetNames)
+{
+	for (const FSoftObjectPath& TargetName : TargetNames)
+	{
+		AsyncLoadCallbackWrapper(PackageName, Package, Result, TargetName);
+	}
+}
+
 void FStreamableHandle::ExecuteDelegate(const FStreamableDelegate& Delegate, TSharedPtr<FStreamableHandle> AssociatedHandle, const FStreamableDelegate& CancelDelegate)
 {
 	if (Delegate.IsBound())
@@ -1047,7 +1055,7 @@ FStreamable* FStreamableManager::FindStreamable(const FSoftObjectPath& Target) c
 	return Existing;
 }
 
-FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetName, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle)
+FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetName, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle, TMap<FString, TArray<FSoftObjectPath>>& OutPackagesToLoad)
 {
 	check(IsInGameThread());
 	UE_LOG(LogStreamableManager, Verbose, TEXT("Asynchronous load %s"), *InTargetName.ToString());
@@ -1122,9 +1130,10 @@ FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetN
 				Package.LeftInline(FirstDot,false);
 			}
 
+			// The load itself is issued by StartHandleRequests, once per package for all targets of the handle
 			Existing->bAsyncLoadRequestOutstanding = true;
 			Existing->bLoadFailed = false;
-			int32 RequestId = LoadPackageAsync(Package, FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, TargetName), Priority);
+			OutPackagesToLoad.FindOrAdd(MoveTemp(Package)).Add(TargetName);
 		}
 	}
 	return Existing;
@@ -1283,16 +1292,31 @@ void FStreamableManager::StartHandleRequests(TSharedRef<FStreamableHandle> Handl
 
 	TArray<FStreamable *> ExistingStreamables;
 	ExistingStreamables.Reserve(Handle->RequestedAssets.Num());
+	TMap<FString, TArray<FSoftObjectPath>> PackagesToLoad;
 
 	for (int32 i = 0; i < Handle->RequestedAssets.Num(); i++)
 	{
-		FStreamable* Existing = StreamInternal(Handle->RequestedAssets[i], Handle->Priority, Handle);
+		FStreamable* Existing = StreamInternal(Handle->RequestedAssets[i], Handle->Priority, Handle, PackagesToLoad);
 		check(Existing);
 
 		ExistingStreamables.Add(Existing);
 		Existing->AddLoadingRequest(Handle);
 	}
 
+	// Request every package once, even when many of the targets live in it, and queue all of them before any completes
+	// so the loader sees the whole batch up front and can issue its reads together
+	for (TPair<FString, TArray<FSoftObjectPath>>& PackageToLoad : PackagesToLoad)
+	{
+		if (PackageToLoad.Value.Num() == 1)
+		{
+			LoadPackageAsync(PackageToLoad.Key, FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, PackageToLoad.Value[0]), Handle->Priority);
+		}
+		else
+		{
+			LoadPackageAsync(PackageToLoad.Key, FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadPackageCallbackWrapper, MoveTemp(PackageToLoad.Value)), Handle->Priority);
+		}
+	}
+
 	// Go through and complete loading anything that's already in memory, this may call the callback right away
 	for (int32 i = 0; i < Handle->RequestedAssets.Num(); i++)
 	{
@@ -37,6 +37,13 @@ static TAutoConsoleVariable<int32> CVarStreamingOverlapAssetAndLevelTicks(
 	TEXT("Ticks render asset streaming info on a high priority task thread while ticking levels on GT"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<float> CVarStreamingCameraCutDistance(
+	TEXT("r.Streaming.CameraCutDistance"),
+	20000.f,
+	TEXT("When a view moves further than this distance (in world units) between two updates, the streaming data is fully ")
+	TEXT("recomputed in the same frame instead of over r.Streaming.FramesForFullUpdate frames. 0 to disable."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarStreamingAllowFastForceResident(
 	TEXT("r.Streaming.AllowFastForceResident"),
 	0,
@@ -1520,6 +1527,46 @@ void FRenderAssetStreamingManager::LogViewLocationChange()
 #endif
 }
 
+bool FRenderAssetStreamingManager::DetectCameraCut()
+{
+	const float CutDistance = CVarStreamingCameraCutDistance.GetValueOnGameThread();
+
+	bool bCameraCut = false;
+	if (CutDistance > 0 && LastUpdateViewOrigins.Num() > 0)
+	{
+		const float CutDistanceSquared = FMath::Square(CutDistance);
+
+		// A view is considered cut if it isn't close to any of the previous views, so that adding or removing split screen views doesn't trigger it.
+		for (const FStreamingViewInfo& ViewInfo : CurrentViewInfos)
+		{
+			bool bNearLastView = false;
+			for (const FVector& LastViewOrigin : LastUpdateViewOrigins)
+			{
+				if (FVector::DistSquared(ViewInfo.ViewOrigin, LastViewOrigin) <= CutDistanceSquared)
+				{
+					bNearLastView = true;
+					break;
+				}
+			}
+
+			if (!bNearLastView)
+			{
+				bCameraCut = true;
+				break;
+			}
+		}
+	}
+
+	LastUpdateViewOrigins.Reset(CurrentViewInfos.Num());
+	for (const FStreamingViewInfo& ViewInfo : CurrentViewInfos)
+	{
+		LastUpdateViewOrigins.Add(ViewInfo.ViewOrigin);
+	}
+
+	UE_CLOG(bCameraCut, LogContentStreaming, Verbose, TEXT("Camera cut detected, doing a full streaming update this frame."));
+	return bCameraCut;
+}
+
 /**
  * Main function for the texture streaming system, based on texture priorities and asynchronous processing.
  * Updates streaming, taking into account all view infos.
@@ -1594,7 +1641,11 @@ void FRenderAssetStreamingManager::UpdateResourceStreaming( float DeltaTime, boo
 
 	RenderAssetInstanceAsyncWork->EnsureCompletion();
 
-	if (NumRenderAssetProcessingStages <= 0 || bProcessEverything)
+	// On a camera cut, the wanted mips computed over the last frames are mostly wrong. Restart with a full update rather than
+	// waiting for the current cycle and the next one to complete.
+	const bool bCameraCut = DetectCameraCut();
+
+	if (NumRenderAssetProcessingStages <= 0 || bProcessEverything || bCameraCut)
 	{
 		if (!AsyncWork->IsDone())
 		{	// Is the AsyncWork is running for some reason? (E.g. we reset the system by simply setting ProcessingStage to 0.)
@@ -279,6 +279,9 @@ private:
 	void	UpdateCSVOnlyStats();
 	void	LogViewLocationChange();
 
+	/** Returns whether a view moved further than r.Streaming.CameraCutDistance since the last update, and remembers the current view origins. */
+	bool	DetectCameraCut();
+
 	void	IncrementalUpdate( float Percentage, bool bUpdateDynamicComponents);
 
 	/**
@@ -404,6 +407,9 @@ private:
 
 	TArray<int32> InflightRenderAssets;
 
+	/** View origins of the last update, used to detect camera cuts. */
+	TArray<FVector> LastUpdateViewOrigins;
+
 	/** A critical section to handle concurrent access on MountedStateDirtyFiles. */
 	FCriticalSection MountedStateDirtyFilesCS;
 	/** Whether all file mounted states needs to be re-evaluated. */
@@ -137,7 +137,25 @@ void FVirtualTextureUploadCache::Finalize(FRHICommandListImmediate& RHICmdList)
 		}
 
 		RHICmdList.UnlockTexture2D(StagingTexture.RHITexture, 0u, false, false);
-		RHICmdList.Transition(FRHITransitionInfo(StagingTexture.RHITexture, ERHIAccess::SRVMask, ERHIAccess::CopySrc));
+
+		// Tiles of a batch usually land in a handful of physical textures, transition each of them once for the whole batch
+		// rather than around every tile copy
+		TArray<FRHITexture2D*, TInlineAllocator<4>> DestTextures;
+		Index = Tiles[SubmitListHead].NextIndex;
+		while (Index != SubmitListHead)
+		{
+			const FTileEntry& Entry = Tiles[Index];
+			DestTextures.AddUnique(Entry.RHISubmitTexture);
+			Index = Entry.NextIndex;
+		}
+
+		TArray<FRHITransitionInfo, TInlineAllocator<5>> Transitions;
+		Transitions.Add(FRHITransitionInfo(StagingTexture.RHITexture, ERHIAccess::SRVMask, ERHIAccess::CopySrc));
+		for (FRHITexture2D* DestTexture : DestTextures)
+		{
+			Transitions.Add(FRHITransitionInfo(DestTexture, ERHIAccess::Unknown, ERHIAccess::CopyDest));
+		}
+		RHICmdList.Transition(Transitions);
 
 		// upload each tile from staging texture to physical texture
 		Index = Tiles[SubmitListHead].NextIndex;
@@ -153,16 +171,12 @@ void FVirtualTextureUploadCache::Finalize(FRHICommandListImmediate& RHICmdList)
 			const FIntVector SourceBoxStart(SrcTileX * TileSize + SkipBorderSize, SrcTileY * TileSize + SkipBorderSize, 0);
 			const FIntVector DestinationBoxStart(Entry.SubmitDestX * SubmitTileSize, Entry.SubmitDestY * SubmitTileSize, 0);
 
-			RHICmdList.Transition(FRHITransitionInfo(Entry.RHISubmitTexture, ERHIAccess::Unknown, ERHIAccess::CopyDest));
-
 			FRHICopyTextureInfo CopyInfo;
 			CopyInfo.Size = FIntVector(SubmitTileSize, SubmitTileSize, 1);
 			CopyInfo.SourcePosition = SourceBoxStart;
 			CopyInfo.DestPosition = DestinationBoxStart;
 			RHICmdList.CopyTexture(StagingTexture.RHITexture, Entry.RHISubmitTexture, CopyInfo);
 
-			RHICmdList.Transition(FRHITransitionInfo(Entry.RHISubmitTexture, ERHIAccess::CopyDest, ERHIAccess::SRVMask));
-
 			Entry.RHISubmitTexture = nullptr;
 			Entry.SubmitBatchIndex = 0u;
 			Entry.SubmitDestX = 0;
@@ -174,7 +188,13 @@ void FVirtualTextureUploadCache::Finalize(FRHICommandListImmediate& RHICmdList)
 			Index = NextIndex;
 		}
 
-		RHICmdList.Transition(FRHITransitionInfo(StagingTexture.RHITexture, ERHIAccess::CopySrc, ERHIAccess::SRVMask));
+		Transitions.Reset();
+		Transitions.Add(FRHITransitionInfo(StagingTexture.RHITexture, ERHIAccess::CopySrc, ERHIAccess::SRVMask));
+		for (FRHITexture2D* DestTexture : DestTextures)
+		{
+			Transitions.Add(FRHITransitionInfo(DestTexture, ERHIAccess::CopyDest, ERHIAccess::SRVMask));
+		}
+		RHICmdList.Transition(Transitions);
 
 		PoolEntry.BatchCount = 0u;
 	}
@@ -9,6 +9,12 @@
 #include "GameFramework/PlayerController.h"
 #include "Engine/NetConnection.h"
 #include "Net/OnlineEngineInterface.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarNetVoiceAggregatePackets(
+	TEXT("net.VoiceAggregatePackets"),
+	1,
+	TEXT("When non-zero, voice channels pack consecutive voice packets of the same reliability into a single bunch (up to the max single bunch size) instead of sending one bunch per packet."));
 
 /** Cleans up any voice data remaining in the queue */
 bool UVoiceChannel::CleanUp( const bool bForDestroy, EChannelCloseReason CloseReason )
@@ -65,9 +71,12 @@ void UVoiceChannel::Tick()
 	// If the handshaking hasn't completed throw away all unreliable voice data
 	if (bHandshakeCompleted)
 	{
+		const bool bAggregatePackets = CVarNetVoiceAggregatePackets.GetValueOnGameThread() != 0;
+		const int64 MaxBunchBits = Connection->GetMaxSingleBunchSizeBits();
+
 		// Try to append each packet in turn
-		int32 Index;
-		for (Index = 0; Index < VoicePackets.Num(); Index++)
+		int32 Index = 0;
+		while (Index < VoicePackets.Num())
 		{
 			if (!Connection->IsNetReady(0))
 			{
@@ -78,24 +87,49 @@ void UVoiceChannel::Tick()
 
 			FOutBunch Bunch(this, 0);
 
-			TSharedPtr<FVoicePacket> Packet = VoicePackets[Index];
-
 			// First send must be reliable as must any packet marked reliable
-			Bunch.bReliable = OpenAcked == false || Packet->IsReliable();
+			Bunch.bReliable = OpenAcked == false || VoicePackets[Index]->IsReliable();
 
-			// Append the packet data (copies into the bunch)
-			Packet->Serialize(Bunch);
+			// Pack as many packets of the same reliability as fit in a single bunch, ReceivedBunch reads packets until the end of the bunch.
+			// The per packet serialization overhead (sender id etc.) is estimated from the previous packet.
+			int32 NumPacketsInBunch = 0;
+			int64 PacketOverheadBits = 0;
+			while (Index + NumPacketsInBunch < VoicePackets.Num())
+			{
+				TSharedPtr<FVoicePacket> Packet = VoicePackets[Index + NumPacketsInBunch];
+				const int64 PacketDataBits = (int64)Packet->GetBufferSize() * 8;
+				if (NumPacketsInBunch > 0)
+				{
+					const bool bSameReliability = (OpenAcked == false || Packet->IsReliable()) == Bunch.bReliable;
+					if (!bAggregatePackets || !bSameReliability || Bunch.GetNumBits() + PacketDataBits + PacketOverheadBits > MaxBunchBits)
+					{
+						break;
+					}
+				}
+
+				// Append the packet data (copies into the bunch)
+				const int64 BunchBitsBefore = Bunch.GetNumBits();
+				Packet->Serialize(Bunch);
+				if (Bunch.IsError())
+				{
+					break;
+				}
+				PacketOverheadBits = FMath::Max<int64>(Bunch.GetNumBits() - BunchBitsBefore - PacketDataBits, 0);
+				++NumPacketsInBunch;
 
 #if STATS
-			// Increment the number of voice packets we've sent
-			Connection->Driver->VoicePacketsSent++;
-			Connection->Driver->VoiceBytesSent += Packet->GetBufferSize();
+				// Increment the number of voice packets we've sent
+				Connection->Driver->VoicePacketsSent++;
+				Connection->Driver->VoiceBytesSent += Packet->GetBufferSize();
 #endif
+			}
+
 			// Don't submit the bunch if something went wrong
 			if (Bunch.IsError() == false)
 			{
 				// Submit the bunching with merging on
 				SendBunch(&Bunch, 1);
+				Index += NumPacketsInBunch;
 			}
 			else
 			{
@@ -2608,12 +2608,17 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 		{
 			QUICK_SCOPE_CYCLE_COUNTER(STAT_AddToWorldTime_RouteActorInitialize);
 			SCOPE_TIME_TO_VAR(&RouteActorInitializeTime);
+			// Incrementally route initialization, each call resumes where the previous one ran out of time.
+			const int32 NumActorsToProcess = (!bConsiderTimeLimit || IsRunningCommandlet() ? 0 : GLevelStreamingRouteActorInitializationGranularity);
 			bStartup = 1;
-			Level->RouteActorInitialize();
-			Level->bAlreadyRoutedActorInitialize = true;
+			do
+			{
+				Level->bAlreadyRoutedActorInitialize = Level->RouteActorInitialize(NumActorsToProcess);
+			}
+			while (!Level->bAlreadyRoutedActorInitialize && !IsTimeLimitExceeded(TEXT("routing Initialize on actors"), StartTime, Level, TimeLimit));
 			bStartup = 0;
 
-			bExecuteNextStep = (!bConsiderTimeLimit || !IsTimeLimitExceeded( TEXT("routing Initialize on actors"), StartTime, Level, TimeLimit ));
+			bExecuteNextStep = Level->bAlreadyRoutedActorInitialize && (!bConsiderTimeLimit || !IsTimeLimitExceeded( TEXT("routing Initialize on actors"), StartTime, Level, TimeLimit ));
 		}
 
 		// Sort the actor list; can't do this on save as the relevant properties for sorting might have been changed by code
@@ -4466,6 +4471,10 @@ void UWorld::CleanupWorldInternal(bool bSessionEnded, bool bCleanupResources, UW
 
 	FWorldDelegates::OnWorldCleanup.Broadcast(this, bSessionEnded, bCleanupResources);
 
+	// Spawns that haven't been processed yet are dropped with the world
+	QueuedActorSpawns.Empty();
+	NextQueuedActorSpawnIndex = 0;
+
 	GetRendererModule().OnWorldCleanup(this, bSessionEnded, bCleanupResources, bWorldChanged);
 
 	if (AISystem != nullptr)
@@ -18,11 +18,19 @@ private:
 
 	FActiveSound* ActiveSound;
 
+	/** Whether the first streamed chunk of the sound has already been requested while virtualized. */
+	uint8 bFirstChunkPrefetched : 1;
+
 	/**
 	  * Check if provided active sound is in audible range.
 	  */
 	static bool IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice = nullptr);
 
+	/**
+	  * Requests the first streamed chunk of the sound if the listener is within the prefetch distance of its audible range.
+	  */
+	void PrefetchFirstChunkIfNearby();
+
 public:
 	FAudioVirtualLoop();
 
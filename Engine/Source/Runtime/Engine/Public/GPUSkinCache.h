@@ -202,6 +202,9 @@ public:
 
 	static bool IsEntryValid(FGPUSkinCacheEntry* SkinCacheEntry, int32 Section);
 
+	/** Keeps the entry from being evicted this frame, called when its passthrough vertex factory is used for rendering */
+	static void MarkEntryUsed(FGPUSkinCacheEntry* SkinCacheEntry);
+
 	static bool UseIntermediateTangents();
 
 	inline uint64 GetExtraRequiredMemoryAndReset()
@@ -430,6 +433,9 @@ protected:
 
 	void Cleanup();
 	static void ReleaseSkinCacheEntry(FGPUSkinCacheEntry* SkinCacheEntry);
+	void ReleasePositionAllocation(FGPUSkinCacheEntry* SkinCacheEntry);
+	/** Frees the allocations of the least recently used entries until at least BytesToFree were released or no candidate is left */
+	void EvictUnusedEntries(uint64 BytesToFree);
 	static FGPUSkinBatchElementUserData* InternalGetFactoryUserData(FGPUSkinCacheEntry* Entry, int32 Section);
 	void InvalidateAllEntries();
 	uint64 UsedMemoryInBytes;
@@ -455,3 +461,4 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Triangles for Recompute Tangents"),
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Sections Processed"), STAT_GPUSkinCache_NumSectionsProcessed, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num SetVertexStreams"), STAT_GPUSkinCache_NumSetVertexStreams, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num PreGDME"), STAT_GPUSkinCache_NumPreGDME, STATGROUP_GPUSkinCache, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Evicted Entries"), STAT_GPUSkinCache_NumEvictedEntries, STATGROUP_GPUSkinCache, );
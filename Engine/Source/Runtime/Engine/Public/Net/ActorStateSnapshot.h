@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+
+/**
+ * Full and delta snapshots of an actor's replicated state, for exchanging actors between trusted server processes.
+ *
+ * Snapshots hold the same properties FRepLayout replicates, the class's ClassReps, for the actor and its replicated
+ * components. Unlike client replication there's no relevancy, priority or conditions: peers mirror the whole state.
+ * Values are bulk serialized with their property type, and object references and names as strings, so they don't
+ * depend on NetGUIDs shared with the peer. Both processes must run the same build.
+ *
+ * Deltas only hold the properties that changed since the previous snapshot written for the actor. The transport must
+ * deliver snapshots in order, and if the reader rejects a delta the writer has to send a full snapshot:
+ *
+ *	// Sending server, one writer per peer
+ *	TArray<uint8> Data;
+ *	FMemoryWriter Writer(Data);
+ *	SnapshotWriter.Write(Actor, Writer);
+ *
+ *	// Receiving server
+ *	FMemoryReader Reader(Data);
+ *	if (!SnapshotReader.Read(MirroredActor, Reader))
+ *	{
+ *		// Ask the sender for a full snapshot, it calls SnapshotWriter.ResetBaseline(Actor)
+ *	}
+ */
+class ENGINE_API FActorSnapshotWriter
+{
+public:
+	/**
+	 * Writes the replicated properties of the actor and its replicated components that changed since the last snapshot
+	 * written for it, or all of them for the first snapshot or when bForceFull is set.
+	 */
+	void Write(AActor* Actor, FArchive& Ar, bool bForceFull = false);
+
+	/** Makes the next snapshot of the actor a full one */
+	void ResetBaseline(const AActor* Actor);
+
+	/** Forgets all baselines, e.g. when the peer reconnects */
+	void Reset();
+
+private:
+	struct FBaseline
+	{
+		uint32 Sequence = 0;
+
+		/** Hash of each replicated property value, per object name */
+		TMap<FName, TArray<uint32>> PropertyHashes;
+	};
+
+	TMap<FObjectKey, FBaseline> Baselines;
+};
+
+class ENGINE_API FActorSnapshotReader
+{
+public:
+	/**
+	 * Applies a snapshot to the actor and its replicated components, and calls the RepNotifies of the changed properties.
+	 *
+	 * @return false if the snapshot is a delta against a snapshot this reader didn't apply, or is corrupt
+	 */
+	bool Read(AActor* Actor, FArchive& Ar);
+
+	/** Forgets the snapshots applied to the actor, so only a full snapshot is accepted next */
+	void ResetBaseline(const AActor* Actor);
+
+private:
+	/** Sequence of the last snapshot applied to each actor */
+	TMap<FObjectKey, uint32> Sequences;
+};
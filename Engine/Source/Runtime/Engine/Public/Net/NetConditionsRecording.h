@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Network conditions at one point of a recording */
+struct FNetConditionsSample
+{
+	/** Seconds since the start of the recording */
+	double Time = 0.0;
+
+	/** Latency added to outgoing packets, in milliseconds */
+	float OutLagMs = 0.0f;
+
+	/** Percentage of outgoing packets dropped */
+	float OutLossPercent = 0.0f;
+
+	/** Latency added to incoming packets, in milliseconds */
+	float InLagMs = 0.0f;
+
+	/** Percentage of incoming packets dropped */
+	float InLossPercent = 0.0f;
+};
+
+/**
+ * Network conditions recorded on a real connection, replayed by the packet simulation to reproduce
+ * latency spikes and loss bursts that the fixed PktLag/PktLoss distributions can't.
+ *
+ * Recordings are CSV files, one sample per line: Time,OutLagMs,OutLossPercent[,InLagMs,InLossPercent]
+ * Lines starting with '#' and a header line are ignored. Each sample holds until the next one, and
+ * the recording loops once past the last sample.
+ */
+class ENGINE_API FNetConditionsRecording
+{
+public:
+	/**
+	 * Loads a recording, relative to the project directory unless absolute.
+	 * Recordings are shared between the connections replaying them.
+	 *
+	 * @return the recording, or null if the file is missing or has no valid samples
+	 */
+	static TSharedPtr<const FNetConditionsRecording> Load(const FString& Filename);
+
+	/** @return the conditions Time seconds into the recording, looping past the end */
+	const FNetConditionsSample& GetSample(double Time) const;
+
+	/** @return the time of the last sample, which is when the recording loops */
+	double GetDuration() const { return Duration; }
+
+private:
+	bool LoadFromFile(const FString& Filename);
+
+	TArray<FNetConditionsSample> Samples;
+	double Duration = 0.0;
+};
@@ -274,6 +274,23 @@ struct FRepSerializedPropertyInfo
 	int32 PropBitLength;
 };
 
+/**
+ * A complete SendProperties payload (including handles and terminator) for a single changelist.
+ * Only built for changelists whose properties are all eligible for shared serialization,
+ * which means the bits do not depend on the connection they are written to.
+ */
+struct FRepSerializedChangelist
+{
+	/** The final, filtered changelist that was used to build this payload. */
+	TArray<uint16> Changed;
+
+	/** Serialized bits, exactly as they were written into the first connection's writer. */
+	TArray<uint8> Buffer;
+
+	/** Number of valid bits in Buffer. */
+	int64 NumBits = 0;
+};
+
 /** Holds a set of shared net serialized properties */
 struct FRepSerializationSharedInfo
 {
@@ -301,6 +318,17 @@ struct FRepSerializationSharedInfo
 
 			bIsValid = false;
 		}
+
+		SerializedChangelists.Reset();
+	}
+
+	/** Returns a previously serialized payload for exactly this changelist, if there is one. */
+	const FRepSerializedChangelist* FindSerializedChangelist(const TArray<uint16>& Changed) const
+	{
+		return SerializedChangelists.FindByPredicate([&Changed](const FRepSerializedChangelist& SerializedChangelist)
+		{
+			return SerializedChangelist.Changed == Changed;
+		});
 	}
 
 	/**
@@ -350,6 +378,12 @@ struct FRepSerializationSharedInfo
 	/** Binary blob of net serialized data to be shared */
 	TUniquePtr<FNetBitWriter> SerializedProperties;
 
+	/**
+	 * Whole changelist payloads that can be copied into any connection's writer.
+	 * Connections that need the same changelist this frame skip serialization entirely.
+	 */
+	TArray<FRepSerializedChangelist> SerializedChangelists;
+
 	void CountBytes(FArchive& Ar) const;
 
 private:
@@ -1569,7 +1603,7 @@ private:
 		UClass* ObjectClass,
 		FNetBitWriter& Writer,
 		TArray<uint16>& Changed,
-		const FRepSerializationSharedInfo& SharedInfo) const;
+		FRepSerializationSharedInfo& SharedInfo) const;
 
 	/**
 	 * Clamps a changelist so that it conforms to the current size of either an array, or arrays within structs/arrays.
@@ -1627,7 +1661,8 @@ private:
 		FRepHandleIterator& HandleIterator,
 		const FConstRepObjectDataBuffer SourceData,
 		const int32	 ArrayDepth,
-		const FRepSerializationSharedInfo* const RESTRICT SharedInfo) const;
+		const FRepSerializationSharedInfo* const RESTRICT SharedInfo,
+		bool* const RESTRICT bOutWroteConnectionDependentData = nullptr) const;
 
 	void BuildSharedSerialization(
 		const FConstRepObjectDataBuffer Data,
@@ -74,6 +74,11 @@ private:
  *  One implementation of network traffic control based on the unacked bytes in flight
  *  and the estimated uplink bandwidth and propagation round-trip time. The idea is to
  *  keep the bytes in flight under the BDP(bandwidth round trip time product).
+ *
+ *  The send rate used for the BDP adapts to the link in a LEDBAT-like way: it grows while the
+ *  queuing delay (latest RTT above the lowest RTT seen recently) is under a target, shrinks
+ *  when the delay goes over, and backs off multiplicatively on packet loss. It never goes
+ *  above the configured net speed.
  */
 class ENGINE_API FNetworkCongestionControl
 {
@@ -81,18 +86,33 @@ public:
 	FNetworkCongestionControl(double ConfiguredNetSpeed, uint32 MaxPackets);
 
 	void OnAck(const FAckSample& AckSample);
+	void OnNak(double Timestamp);
 	bool IsReadyToSend(double Timestamp);
 	void OnSend(const FSeqSample& SeqSample);
 
+	/** Updates the upper bound of the send rate, e.g. when the connection's CurrentNetSpeed changes. */
+	void SetConfiguredNetSpeed(double InConfiguredNetSpeed);
+
+	/** Current estimated send rate in bytes/sec. */
+	double GetNetSpeed() const { return NetSpeed; }
+
 private:
 	FNetworkTrafficAnalyzer Analyzer;
 
 	double MinRTT;									// Estimated propagation round-trip time in s.
-	double NetSpeed;								// Configured uplink bandwidth in bytes/sec.
+	double NetSpeed;								// Adapted uplink bandwidth in bytes/sec.
+	double ConfiguredNetSpeed;						// Configured uplink bandwidth in bytes/sec, upper bound of NetSpeed.
 	uint32 MaxPacketsAllowedInFlight;				// Max allowed packets in flight, typically the HistorySize of TSequenceHistory.
 
+	double BaseRTT;									// Lowest RTT seen over the current and previous base delay windows, in s.
+	double CurrentWindowMinRTT;						// Lowest RTT seen in the current base delay window, in s.
+	double BaseRTTWindowStartTime;					// Time the current base delay window started.
+	double LastLossBackoffTime;						// Time of the last loss backoff, used to back off at most once per RTT.
+
 private:
 	void UpdateMinRTT(double Timestamp);
+	void UpdateBaseRTT(double Timestamp);
+	void UpdateNetSpeed(uint32 AckedBytes);
 	double GetMinRTT() const;
 	double GetCongestionWindow() const;
 };
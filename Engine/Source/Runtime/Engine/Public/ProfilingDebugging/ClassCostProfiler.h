@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UClass;
+
+/**
+	FClassCostProfiler attributes the CPU time of actor ticks, replication, physics and movement to the class of the
+	actor doing the work. Components are attributed to their owning actor, so a Blueprint's cost includes the
+	components it adds. Time is exclusive: character movement run from a component tick counts as movement only.
+
+	It only reads the cycle counter, so it is cheap enough for Test builds and servers. Projects can enable it in
+	Shipping with WITH_CLASS_COST_PROFILER=1.
+
+	Example Console Usage:
+
+	"ClassCost.Start"				- start attributing costs
+	"ClassCost.Dump 30 Tick"		- log the 30 most expensive classes, optionally of one category only
+	"ClassCost.Reset"				- clear the totals
+	"ClassCost.Stop"				- stop attributing costs
+
+	While the "ClassCost" trace channel is enabled the profiler runs as well, and traces each class's per frame cost.
+ */
+
+#ifndef WITH_CLASS_COST_PROFILER
+#define WITH_CLASS_COST_PROFILER (!UE_BUILD_SHIPPING)
+#endif
+
+enum class EClassCostCategory : uint8
+{
+	Tick,
+	Replication,
+	Physics,
+	Movement,
+
+	Count
+};
+
+#if WITH_CLASS_COST_PROFILER
+
+class ENGINE_API FClassCostProfiler
+{
+public:
+	static void Start();
+	static void Stop();
+	static void Reset();
+	static bool IsRunning() { return bRunning; }
+
+	/** Logs the classes with the highest average cost per frame, of all categories if Category is Count */
+	static void Dump(FOutputDevice& Ar, int32 MaxClasses, EClassCostCategory Category = EClassCostCategory::Count);
+
+	static const TCHAR* GetCategoryName(EClassCostCategory Category);
+
+private:
+	friend class FScopedClassCost;
+
+	static bool bRunning;
+};
+
+/** Attributes the time spent in the scope, minus any nested scopes, to the class */
+class FScopedClassCost
+{
+public:
+	FORCEINLINE FScopedClassCost(EClassCostCategory InCategory, const UClass* InClass)
+	{
+		if (FClassCostProfiler::bRunning && InClass)
+		{
+			Begin(InCategory, InClass);
+		}
+	}
+
+	FORCEINLINE ~FScopedClassCost()
+	{
+		if (Class)
+		{
+			End();
+		}
+	}
+
+private:
+	ENGINE_API void Begin(EClassCostCategory InCategory, const UClass* InClass);
+	ENGINE_API void End();
+
+	const UClass* Class = nullptr;
+	FScopedClassCost* Parent = nullptr;
+	uint64 StartCycles = 0;
+	uint64 ChildCycles = 0;
+	EClassCostCategory Category = EClassCostCategory::Count;
+};
+
+#define SCOPE_CLASS_COST(Category, Class) FScopedClassCost PREPROCESSOR_JOIN(ClassCostScope, __LINE__)(EClassCostCategory::Category, Class)
+
+#else
+
+#define SCOPE_CLASS_COST(Category, Class)
+
+#endif // WITH_CLASS_COST_PROFILER
@@ -111,6 +111,11 @@ private:
 	void RecordFrame(float DeltaSeconds, UNetConnection* Connection);
 
 	void WriteDemoFrame(UNetConnection* Connection, FArchive& Ar, TArray<FQueuedDemoPacket>& QueuedPackets, float FrameTime, EWriteDemoFrameFlags Flags);
+
+	/** The pieces of WriteDemoFrame, split out so checkpoint frames can be written across multiple ticks. */
+	void WriteDemoFrameHeader(UNetConnection* Connection, FArchive& Ar, float FrameTime, EWriteDemoFrameFlags Flags);
+	void WriteDemoFramePacket(FArchive& Ar, FQueuedDemoPacket& DemoPacket);
+	void WriteDemoFrameEnd(FArchive& Ar);
 	bool ReadDemoFrame(UNetConnection* Connection, FArchive& Ar, TArray<FPlaybackPacket>& InPlaybackPackets, const bool bForLevelFastForward, const FArchivePos MaxArchiveReadPos, float* OutTime);
 
 	// Possible values returned by ReadPacket.
@@ -144,6 +149,13 @@ private:
 
 	bool SerializeGuidCache(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
 
+	/**
+	 * Checkpoint saving step.
+	 * Writes as many of the QueuedCheckpointPackets as fit in the frame's time budget, releasing each packet's data once written.
+	 * @return True once every queued packet has been written.
+	 */
+	bool SerializeQueuedCheckpointPackets(const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
+
 	/**
 	* Replicates the given prioritized actors, so their packets can be captured for recording.
 	* This should be used for normal frame recording.
@@ -264,6 +276,8 @@ private:
 			, NextNetGuidForRecording(0)
 			, NumNetGuidsForRecording(0)
 			, NetGuidsCountPos(0)
+			, bWroteCheckpointFrameHeader(false)
+			, NextQueuedCheckpointPacket(0)
 		{}
 
 		ECheckpointSaveState CheckpointSaveState;						// Current state of checkpoint SaveState
@@ -284,6 +298,9 @@ private:
 		int32 NumNetGuidsForRecording;
 		FArchivePos NetGuidsCountPos;
 
+		bool bWroteCheckpointFrameHeader;								// Whether the demo frame header for the queued checkpoint packets has been written
+		int32 NextQueuedCheckpointPacket;								// Index of the next QueuedCheckpointPackets entry to write
+
 		TMap<FName, uint32> NameTableMap;
 
 		void CountBytes(FArchive& Ar) const
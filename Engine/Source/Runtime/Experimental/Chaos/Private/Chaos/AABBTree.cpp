@@ -34,3 +34,6 @@ FAutoConsoleVariableRef FAABBTreeCVars::CVarDynamicTreeBoundingBoxPadding(TEXT("
 
 int32 FAABBTreeCVars::DynamicTreeLeafCapacity = 8;
 FAutoConsoleVariableRef FAABBTreeCVars::CVarDynamicTreeLeafCapacity(TEXT("p.aabbtree.DynamicTreeLeafCapacity"), FAABBTreeCVars::DynamicTreeLeafCapacity, TEXT("Dynamic Tree Leaf Capacity"));
+
+int32 FAABBTreeCVars::DynamicTreeRefitOnSmallMotion = 1;
+FAutoConsoleVariableRef FAABBTreeCVars::CVarDynamicTreeRefitOnSmallMotion(TEXT("p.aabbtree.DynamicTreeRefitOnSmallMotion"), FAABBTreeCVars::DynamicTreeRefitOnSmallMotion, TEXT("When an element of a dynamic tree moves out of its padded leaf bounds but still overlaps them, refit the leaf and its ancestors instead of removing and reinserting the element"));
@@ -155,6 +155,9 @@ namespace Chaos
 		// Desired final normal velocity, taking Restitution into account
 		FSolverReal WorldContactVelocityTargetNormal;
 
+		// Normal pushout applied by this point in the previous tick if the manifold was restored (used to warm-start the position solve)
+		FSolverReal WarmStartPushOutNormal;
+
 		// Solver outputs
 		FSolverReal NetPushOutNormal;
 		FSolverReal NetPushOutTangentU;
@@ -263,6 +266,16 @@ namespace Chaos
 			const FSolverReal InWorldContactDeltaTangentU,
 			const FSolverReal InWorldContactDeltaTangentV);
 
+		/**
+		 * @brief Set the normal pushout from the previous tick for a restored manifold point
+		 * @see WarmStartPosition
+		*/
+		void SetManifoldPointWarmStart(const int32 ManifoldPointIndex, const FSolverReal InWarmStartPushOutNormal)
+		{
+			check(ManifoldPointIndex < NumManifoldPoints());
+			State.ManifoldPoints[ManifoldPointIndex].WarmStartPushOutNormal = InWarmStartPushOutNormal;
+		}
+
 		/**
 		 * @brief Get the first (decaorated) solver body
 		 * The decorator add a possible mass scale
@@ -299,6 +312,12 @@ namespace Chaos
 		bool SolvePositionWithFriction(const FSolverReal Dt, const FSolverReal MaxPushOut);
 		bool SolvePositionNoFriction(const FSolverReal Dt, const FSolverReal MaxPushOut);
 
+		/**
+		 * @brief Apply a fraction of the previous tick's normal pushout to the bodies before the first position iteration
+		 * The pushout is accumulated into NetPushOutNormal so that later iterations can undo it if it was too much.
+		*/
+		void WarmStartPosition(const FSolverReal WarmStartScale);
+
 		/**
 		 * @brief Calculate and apply the velocity correction for this iteration
 		 * @return true if we need to run more iterations, false if we did not apply any correction
@@ -684,6 +703,7 @@ namespace Chaos
 
 		StaticFrictionRatio = FSolverReal(0);
 		WorldContactVelocityTargetNormal = FSolverReal(0);
+		WarmStartPushOutNormal = FSolverReal(0);
 
 		UpdateMass(Body0, Body1);
 	}
@@ -720,6 +740,7 @@ namespace Chaos
 
 		StaticFrictionRatio = FSolverReal(0);
 		WorldContactVelocityTargetNormal = FSolverReal(0);
+		WarmStartPushOutNormal = FSolverReal(0);
 
 		UpdateMass(
 			Body0, 
@@ -1039,6 +1060,39 @@ namespace Chaos
 			InRestitutionVelocityThreshold);
 	}
 
+	FORCEINLINE_DEBUGGABLE void FPBDCollisionSolver::WarmStartPosition(const FSolverReal WarmStartScale)
+	{
+		// SolverBody decorator used to add mass scaling
+		FConstraintSolverBody& Body0 = SolverBody0();
+		FConstraintSolverBody& Body1 = SolverBody1();
+
+		for (int32 PointIndex = 0; PointIndex < State.NumManifoldPoints; ++PointIndex)
+		{
+			FPBDCollisionSolverManifoldPoint& SolverManifoldPoint = State.ManifoldPoints[PointIndex];
+
+			const FSolverReal PushOutNormal = State.Stiffness * WarmStartScale * SolverManifoldPoint.WarmStartPushOutNormal;
+			if (PushOutNormal > FSolverReal(0))
+			{
+				SolverManifoldPoint.NetPushOutNormal += PushOutNormal;
+
+				if (Body0.IsDynamic())
+				{
+					const FSolverVec3 DX0 = (Body0.InvM() * PushOutNormal) * SolverManifoldPoint.WorldContactNormal;
+					const FSolverVec3 DR0 = SolverManifoldPoint.WorldContactNormalAngular0 * PushOutNormal;
+					Body0.ApplyPositionDelta(DX0);
+					Body0.ApplyRotationDelta(DR0);
+				}
+				if (Body1.IsDynamic())
+				{
+					const FSolverVec3 DX1 = (Body1.InvM() * -PushOutNormal) * SolverManifoldPoint.WorldContactNormal;
+					const FSolverVec3 DR1 = SolverManifoldPoint.WorldContactNormalAngular1 * -PushOutNormal;
+					Body1.ApplyPositionDelta(DX1);
+					Body1.ApplyRotationDelta(DR1);
+				}
+			}
+		}
+	}
+
 	FORCEINLINE_DEBUGGABLE bool FPBDCollisionSolver::SolvePositionWithFriction(const FSolverReal Dt, const FSolverReal MaxPushOut)
 	{
 		// SolverBody decorator used to add mass scaling
@@ -20,6 +20,7 @@ namespace Chaos
 	{
 		extern bool bChaos_PBDCollisionSolver_Position_SolveEnabled;
 		extern bool bChaos_PBDCollisionSolver_Velocity_SolveEnabled;
+		extern float Chaos_PBDCollisionSolver_Position_WarmStartScale;
 	}
 	using namespace CVars;
 
@@ -217,6 +218,12 @@ namespace Chaos
 					WorldContactDeltaNormal,
 					WorldContactDeltaTangentU,
 					WorldContactDeltaTangentV);
+
+				// Restored manifold points still hold the pushout from the previous tick, which we can use to warm-start the position solve
+				if (ManifoldPoint.Flags.bWasRestored)
+				{
+					Solver.SetManifoldPointWarmStart(ManifoldPointIndex, FSolverReal(FVec3::DotProduct(ManifoldPoint.NetPushOut, FVec3(WorldContactNormal))));
+				}
 			}
 		}
 
@@ -383,6 +390,16 @@ namespace Chaos
 
 		UpdatePositionShockPropagation(Dt, It, NumIts, BeginIndex, EndIndex, SolverSettings);
 
+		// Apply the pushout from the previous tick to persistent contacts before the first iteration
+		if ((It == 0) && (Chaos_PBDCollisionSolver_Position_WarmStartScale > 0))
+		{
+			const FSolverReal WarmStartScale = FSolverReal(Chaos_PBDCollisionSolver_Position_WarmStartScale);
+			for (int32 SolverIndex = BeginIndex; SolverIndex < EndIndex; ++SolverIndex)
+			{
+				CollisionSolvers[SolverIndex].GetSolver().WarmStartPosition(WarmStartScale);
+			}
+		}
+
 		// Only apply friction for the last few (tunable) iterations
 		const bool bApplyStaticFriction = (It >= (NumIts - SolverSettings.NumPositionFrictionIterations));
 
@@ -130,6 +130,10 @@ namespace Chaos
 	CHAOS_API FRealSingle AsyncInterpolationMultiplier = 2.f;
 	FAutoConsoleVariableRef CVarAsyncInterpolationMultiplier(TEXT("p.AsyncInterpolationMultiplier"), AsyncInterpolationMultiplier, TEXT("How many multiples of the fixed dt should we look behind for interpolation"));
 
+	// 0 means no limit: every fixed step owed to the accumulated game thread time is queued
+	int32 AsyncMaxFixedStepsPerFrame = 0;
+	FAutoConsoleVariableRef CVarAsyncMaxFixedStepsPerFrame(TEXT("p.AsyncMaxFixedStepsPerFrame"), AsyncMaxFixedStepsPerFrame, TEXT("When using async physics with a fixed dt, the maximum number of fixed steps dispatched from a single game thread frame. Time beyond this is dropped so a hitch cannot queue an ever growing number of steps. 0 disables the limit."));
+
 	// 0 blocks on any physics steps generated from past GT Frames, and blocks on none of the tasks from current frame.
 	// 1 blocks on everything except the single most recent task (including tasks from current frame)
 	// 1 should gurantee we will always have a future output for interpolation from 2 frames in the past
@@ -333,6 +337,13 @@ namespace Chaos
 
 				InternalDt = AsyncDt;
 				NumSteps = FMath::FloorToInt(AccumulatedTime / InternalDt);
+				if(AsyncMaxFixedStepsPerFrame > 0 && NumSteps > AsyncMaxFixedStepsPerFrame)
+				{
+					// Hitting this case means we're losing time, the simulation will appear to the viewer to run slower than realtime.
+					// Keep the fractional step so interpolation stays smooth once we catch up.
+					AccumulatedTime = FMath::Fmod(AccumulatedTime, InternalDt) + InternalDt * static_cast<FReal>(AsyncMaxFixedStepsPerFrame);
+					NumSteps = AsyncMaxFixedStepsPerFrame;
+				}
 				AccumulatedTime -= InternalDt * static_cast<FReal>(NumSteps);
 			}
 		}
@@ -79,6 +79,36 @@ static bool VerifyGraph(TArray<TArray<int32>> ColorGraph, const TArray<Chaos::TV
 	return true;
 }
 
+template<typename T>
+static bool VerifyGraph(TArray<TArray<int32>> ColorGraph, const TArray<Chaos::TVec4<int32>>& Graph, const Chaos::TDynamicParticles<T, 3>& InParticles)
+{
+	for (int32 i = 0; i < ColorGraph.Num(); ++i)
+	{
+		TMap<int32, int32> NodeToColorMap;
+		for (const auto& Edge : ColorGraph[i])
+		{
+			for (int32 NodeOffset = 0; NodeOffset < 4; ++NodeOffset)
+			{
+				const int32 Node = Graph[Edge][NodeOffset];
+				if (NodeToColorMap.Contains(Node))
+				{
+					UE_LOG(LogChaos, Error, TEXT("Color %d has duplicate Node %d"), i, Node);
+					return false;
+				}
+			}
+			for (int32 NodeOffset = 0; NodeOffset < 4; ++NodeOffset)
+			{
+				const int32 Node = Graph[Edge][NodeOffset];
+				if (InParticles.InvM(Node) != 0)
+				{
+					NodeToColorMap.Add(Node, i);
+				}
+			}
+		}
+	}
+	return true;
+}
+
 template<typename T>
 TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring(const TArray<Chaos::TVec2<int32>>& Graph, const Chaos::TDynamicParticles<T, 3>& InParticles)
 {
@@ -388,7 +418,61 @@ TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring(const TArray<T
 	return ColorGraph;
 }
 
+template<typename T>
+TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring(const TArray<TVec4<int32>>& Graph, const Chaos::TDynamicParticles<T, 3>& InParticles)
+{
+	using namespace Chaos;
+
+	// Greedy coloring: each constraint takes the lowest color not yet used by any of its dynamic particles.
+	// Kinematic particles are never written to by the constraints so they do not restrict the color choice.
+	TArray<TArray<int32>> ColorGraph;
+	TArray<FGraphNode> Nodes;
+	Nodes.SetNum(InParticles.Size());
+
+	for (int32 EdgeIndex = 0; EdgeIndex < Graph.Num(); ++EdgeIndex)
+	{
+		const TVec4<int32>& Constraint = Graph[EdgeIndex];
+
+		int32 ColorToUse = 0;
+		bool bColorInUse = true;
+		while (bColorInUse)
+		{
+			bColorInUse = false;
+			for (int32 NodeOffset = 0; NodeOffset < 4; ++NodeOffset)
+			{
+				const int32 NodeIndex = Constraint[NodeOffset];
+				if (InParticles.InvM(NodeIndex) != (T)0. && Nodes[NodeIndex].UsedColors.Contains(ColorToUse))
+				{
+					bColorInUse = true;
+					++ColorToUse;
+					break;
+				}
+			}
+		}
+
+		for (int32 NodeOffset = 0; NodeOffset < 4; ++NodeOffset)
+		{
+			const int32 NodeIndex = Constraint[NodeOffset];
+			if (InParticles.InvM(NodeIndex) != (T)0.)
+			{
+				Nodes[NodeIndex].UsedColors.Add(ColorToUse);
+			}
+		}
+
+		if (ColorGraph.Num() <= ColorToUse)
+		{
+			ColorGraph.SetNum(ColorToUse + 1);
+		}
+		ColorGraph[ColorToUse].Add(EdgeIndex);
+	}
+
+	checkSlow(VerifyGraph(ColorGraph, Graph, InParticles));
+	return ColorGraph;
+}
+
 template CHAOS_API TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring<Chaos::FRealSingle>(const TArray<Chaos::TVector<int32, 2>>&, const Chaos::TDynamicParticles<Chaos::FRealSingle, 3>&);
 template CHAOS_API TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring<Chaos::FRealDouble>(const TArray<Chaos::TVector<int32, 2>>&, const Chaos::TDynamicParticles<Chaos::FRealDouble, 3>&);
 template CHAOS_API TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring<Chaos::FRealSingle>(const TArray<Chaos::TVector<int32, 3>>&, const Chaos::TDynamicParticles<Chaos::FRealSingle, 3>&);
 template CHAOS_API TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring<Chaos::FRealDouble>(const TArray<Chaos::TVector<int32, 3>>&, const Chaos::TDynamicParticles<Chaos::FRealDouble, 3>&);
+template CHAOS_API TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring<Chaos::FRealSingle>(const TArray<Chaos::TVector<int32, 4>>&, const Chaos::TDynamicParticles<Chaos::FRealSingle, 3>&);
+template CHAOS_API TArray<TArray<int32>> Chaos::FGraphColoring::ComputeGraphColoring<Chaos::FRealDouble>(const TArray<Chaos::TVector<int32, 4>>&, const Chaos::TDynamicParticles<Chaos::FRealDouble, 3>&);
@@ -697,7 +697,6 @@ void FPBDIslandManager::BuildGroups(const int32 NumContainers)
 		{ return LocalIslands[IslandIndexA]->NumConstraints() > LocalIslands[IslandIndexB]->NumConstraints();});
 	
 	const int32 NumGroups = IslandGroups.Num();
-	const int32 GroupSize = IslandGraph->NumEdges() / NumGroups + 1;
 
 	for(TUniquePtr<FPBDIslandGroup>& IslandGroup : IslandGroups)
 	{
@@ -705,13 +704,25 @@ void FPBDIslandManager::BuildGroups(const int32 NumContainers)
 		IslandGroup->ResizeConstraintsCounts(NumContainers);
 	}
 
-	int32 GroupIndex = 0;
-	int32 GroupOffset = 0;
+	// Islands come sorted by decreasing number of constraints and each one goes to the least loaded group so far.
+	// Filling the groups one after another could leave a large island sharing its group with many others
+	// while the last groups stay empty.
+	TArray<int32, TInlineAllocator<64>> GroupLoads;
+	GroupLoads.SetNumZeroed(NumGroups);
+
 	for(int32& SortedIndex : SortedIslands)
 	{
 		if( FPBDIslandSolver* IslandSolver = IslandSolvers[SortedIndex].Get())
 		{
-			check(GroupIndex < NumGroups);
+			int32 GroupIndex = 0;
+			for(int32 OtherGroupIndex = 1; OtherGroupIndex < NumGroups; ++OtherGroupIndex)
+			{
+				if(GroupLoads[OtherGroupIndex] < GroupLoads[GroupIndex])
+				{
+					GroupIndex = OtherGroupIndex;
+				}
+			}
+
 			IslandGroups[GroupIndex]->AddIsland(IslandSolver);
 			IslandGroups[GroupIndex]->NumParticles() += IslandSolver->NumParticles();
 			IslandGroups[GroupIndex]->NumConstraints() += IslandSolver->NumConstraints();
@@ -724,13 +735,9 @@ void FPBDIslandManager::BuildGroups(const int32 NumContainers)
 			}
 			
 			IslandSolver->SetGroupIndex(GroupIndex);
-			GroupOffset += IslandSolver->NumConstraints();
 
-			if(GroupOffset > GroupSize)
-			{
-				GroupIndex++;
-				GroupOffset = 0;
-			}
+			// islands without constraints still cost their particles integration
+			GroupLoads[GroupIndex] += FMath::Max(1, IslandSolver->NumConstraints());
 		}
 	}
 }
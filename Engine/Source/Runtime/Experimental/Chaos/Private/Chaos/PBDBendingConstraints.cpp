@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "Chaos/PBDBendingConstraints.h"
+#include "Chaos/Framework/Parallel.h"
+#include "ChaosStats.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Chaos PBD Bending Constraint"), STAT_PBD_Bending, STATGROUP_Chaos);
+
+using namespace Chaos;
+
+// @todo(chaos): the parallel threshold (or decision to run parallel) should probably be owned by the solver and passed to the constraint container
+static int32 Chaos_Bending_ParallelConstraintCount = 100;
+#if !UE_BUILD_SHIPPING
+FAutoConsoleVariableRef CVarChaosBendingParallelConstraintCount(TEXT("p.Chaos.Bending.ParallelConstraintCount"), Chaos_Bending_ParallelConstraintCount, TEXT("If we have more constraints than this, use parallel-for in Apply."));
+#endif
+
+void FPBDBendingConstraints::InitColor(const FDynamicParticles& InParticles)
+{
+	// In dev builds we always color so we can tune the system without restarting. See Apply()
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+	if (MConstraints.Num() > Chaos_Bending_ParallelConstraintCount)
+#endif
+	{
+		MConstraintsPerColor = FGraphColoring::ComputeGraphColoring(MConstraints, InParticles);
+	}
+}
+
+void FPBDBendingConstraints::ApplyHelper(FPBDParticles& InParticles, const FReal Dt, const int32 InConstraintIndex) const
+{
+	const int32 i = InConstraintIndex;
+	const TVec4<int32>& Constraint = MConstraints[i];
+	const int32 i1 = Constraint[0];
+	const int32 i2 = Constraint[1];
+	const int32 i3 = Constraint[2];
+	const int32 i4 = Constraint[3];
+	const TVec4<FVec3> Grads = Base::GetGradients(InParticles, i);
+	const FReal S = Base::GetScalingFactor(InParticles, i, Grads);
+	InParticles.P(i1) -= S * InParticles.InvM(i1) * Grads[0];
+	InParticles.P(i2) -= S * InParticles.InvM(i2) * Grads[1];
+	InParticles.P(i3) -= S * InParticles.InvM(i3) * Grads[2];
+	InParticles.P(i4) -= S * InParticles.InvM(i4) * Grads[3];
+}
+
+void FPBDBendingConstraints::Apply(FPBDParticles& InParticles, const FReal Dt) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_PBD_Bending);
+	if ((MConstraintsPerColor.Num() > 0) && (MConstraints.Num() > Chaos_Bending_ParallelConstraintCount))
+	{
+		for (const TArray<int32>& Constraints : MConstraintsPerColor)
+		{
+			PhysicsParallelFor(Constraints.Num(), [&](const int32 Index)
+			{
+				ApplyHelper(InParticles, Dt, Constraints[Index]);
+			});
+		}
+	}
+	else
+	{
+		for (int32 i = 0; i < MConstraints.Num(); ++i)
+		{
+			ApplyHelper(InParticles, Dt, i);
+		}
+	}
+}
@@ -74,6 +74,12 @@ FAutoConsoleVariableRef CVarGeometryCollectionAlwaysGenerateGTCollisionForCluste
 	bGeometryCollectionAlwaysGenerateGTCollisionForClusters,
 	TEXT("When enabled, always generate a game thread side collision for clusters.[def: true]"));
 
+bool bGeometryCollectionSkipDirtyWhenAsleep = true;
+FAutoConsoleVariableRef CVarGeometryCollectionSkipDirtyWhenAsleep(
+	TEXT("p.GeometryCollection.SkipDirtyWhenAsleep"),
+	bGeometryCollectionSkipDirtyWhenAsleep,
+	TEXT("When enabled, a collection whose active pieces are all asleep and unchanged since the last sync is not marked dirty, so no render transforms are rebuilt or uploaded for it.[def: true]"));
+
 DEFINE_LOG_CATEGORY_STATIC(UGCC_LOG, Error, All);
 
 //==============================================================================
@@ -1868,9 +1874,22 @@ bool FGeometryCollectionPhysicsProxy::PullFromPhysicsState(const Chaos::FDirtyGe
 	const int32 NumTransforms = DynamicCollection.Transform.Num();
 	if (ensure(NumTransforms == TargetResults.Transforms.Num()))
 	{
+		// Whether any transform, parent, state or active flag may have changed since the last sync
+		bool bChanged = !bGeometryCollectionSkipDirtyWhenAsleep;
+
 		for (int32 TransformGroupIndex = 0; TransformGroupIndex < NumTransforms; ++TransformGroupIndex)
 		{
-			if (!TargetResults.DisabledStates[TransformGroupIndex])
+			const int32 DynamicState = TargetResults.DynamicState[TransformGroupIndex];
+			const bool bActive = !TargetResults.DisabledStates[TransformGroupIndex];
+			if (!bChanged)
+			{
+				bChanged = DynamicCollection.DynamicState[TransformGroupIndex] != DynamicState
+					|| DynamicCollection.Active[TransformGroupIndex] != bActive
+					|| (bActive && DynamicCollection.Parent[TransformGroupIndex] != TargetResults.Parent[TransformGroupIndex])
+					|| (bActive && DynamicState != (int32)EObjectStateTypeEnum::Chaos_Object_Sleeping && DynamicState != (int32)EObjectStateTypeEnum::Chaos_Object_Static);
+			}
+
+			if (bActive)
 			{
 				DynamicCollection.Parent[TransformGroupIndex] = TargetResults.Parent[TransformGroupIndex];
 				const FTransform& LocalTransform = TargetResults.Transforms[TransformGroupIndex];
@@ -1896,12 +1915,15 @@ bool FGeometryCollectionPhysicsProxy::PullFromPhysicsState(const Chaos::FDirtyGe
 				GTParticles[TransformGroupIndex]->UpdateShapeBounds();
 			}
 
-			DynamicCollection.DynamicState[TransformGroupIndex] = TargetResults.DynamicState[TransformGroupIndex];
-			DynamicCollection.Active[TransformGroupIndex] = !TargetResults.DisabledStates[TransformGroupIndex];
+			DynamicCollection.DynamicState[TransformGroupIndex] = DynamicState;
+			DynamicCollection.Active[TransformGroupIndex] = bActive;
 		}
 
-		//question: why do we need this? Sleeping objects will always have to update GPU
-		DynamicCollection.MakeDirty();
+		// Sleeping and static pieces do not move, so if nothing else changed there is nothing new to render
+		if (bChanged)
+		{
+			DynamicCollection.MakeDirty();
+		}
 
 	}
 
@@ -37,6 +37,9 @@ struct CHAOS_API FAABBTreeCVars
 
 	static int32 DynamicTreeLeafCapacity;
 	static FAutoConsoleVariableRef CVarDynamicTreeLeafCapacity;
+
+	static int32 DynamicTreeRefitOnSmallMotion;
+	static FAutoConsoleVariableRef CVarDynamicTreeRefitOnSmallMotion;
 };
 
 struct CHAOS_API FAABBTreeDirtyGridCVars
@@ -1532,6 +1535,22 @@ public:
 								Leaves[PayloadInfo->LeafIdx].RecomputeBounds();
 								return;
 							}
+
+							// Small motion out of the padded bounds: refit the leaf and its ancestors in place rather than
+							// removing the element and searching for a new sibling from the root. Rotations on the way up keep the tree balanced.
+							if (FAABBTreeCVars::DynamicTreeRefitOnSmallMotion && LeafNodeBounds.Intersects(NewBounds) && NewBounds.Extents().Max() <= MaxPayloadBounds)
+							{
+								const int32 LeafNodeIdx = PayloadInfo->NodeIdx;
+								TLeafType& Leaf = Leaves[PayloadInfo->LeafIdx];
+								Leaf.UpdateElement(Payload, NewBounds, bHasBounds);
+								Leaf.RecomputeBounds();
+								TAABB<T, 3> ExpandedBounds = Leaf.GetBounds();
+								ExpandedBounds.Thicken(FAABBTreeCVars::DynamicTreeBoundingBoxPadding);
+								Nodes[LeafNodeIdx].ChildrenBounds[0] = ExpandedBounds;
+								UpdateAncestorBounds(LeafNodeIdx, true);
+								bShouldRebuild = true;
+								return;
+							}
 						}
 						else
 						{
@@ -2565,14 +2584,41 @@ private:
 			else
 			{
 				PHYSICS_CSV_SCOPED_VERY_EXPENSIVE(PhysicsVerbose, NodeTraverse_Branch);
-				int32 Idx = 0;
-				for (const TAABB<T, 3>& AABB : Node.ChildrenBounds)
+				if (Query == EAABBQueryType::Overlap)
+				{
+					int32 Idx = 0;
+					for (const TAABB<T, 3>& AABB : Node.ChildrenBounds)
+					{
+						if (TAABBTreeIntersectionHelper<TQueryFastData, Query>::Intersects(Start, CurData, TOI, TmpPosition, FAABB3(AABB.Min(), AABB.Max()), QueryBounds, QueryHalfExtents, Dir, InvDir, bParallel))
+						{
+							NodeStack.Add(FNodeQueueEntry{ Node.ChildrenNodes[Idx], TOI });
+						}
+						++Idx;
+					}
+				}
+				else
 				{
-					if(TAABBTreeIntersectionHelper<TQueryFastData, Query>::Intersects(Start, CurData, TOI, TmpPosition, FAABB3(AABB.Min(), AABB.Max()), QueryBounds, QueryHalfExtents, Dir, InvDir, bParallel))
+					FReal ChildTOI[2] = { 0, 0 };
+					bool bChildHit[2];
+					for (int32 Idx = 0; Idx < 2; ++Idx)
+					{
+						const TAABB<T, 3>& AABB = Node.ChildrenBounds[Idx];
+						bChildHit[Idx] = TAABBTreeIntersectionHelper<TQueryFastData, Query>::Intersects(Start, CurData, TOI, TmpPosition, FAABB3(AABB.Min(), AABB.Max()), QueryBounds, QueryHalfExtents, Dir, InvDir, bParallel);
+						ChildTOI[Idx] = TOI;
+					}
+
+					// Push the farther child first so the nearer one is popped first, blocking hits found there
+					// shorten CurrentLength and let the farther one be skipped by the TOI check above
+					const int32 NearIdx = (bChildHit[0] && bChildHit[1] && ChildTOI[1] < ChildTOI[0]) ? 1 : 0;
+					const int32 FarIdx = 1 - NearIdx;
+					if (bChildHit[FarIdx])
+					{
+						NodeStack.Add(FNodeQueueEntry{ Node.ChildrenNodes[FarIdx], ChildTOI[FarIdx] });
+					}
+					if (bChildHit[NearIdx])
 					{
-						NodeStack.Add(FNodeQueueEntry{ Node.ChildrenNodes[Idx], TOI });
+						NodeStack.Add(FNodeQueueEntry{ Node.ChildrenNodes[NearIdx], ChildTOI[NearIdx] });
 					}
-					++Idx;
 				}
 			}
 		}
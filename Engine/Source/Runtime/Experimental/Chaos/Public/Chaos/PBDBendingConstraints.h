@@ -5,36 +5,30 @@
 #include "Chaos/PBDBendingConstraintsBase.h"
 #include "Chaos/PBDParticles.h"
 #include "Chaos/ParticleRule.h"
+#include "Chaos/GraphColoring.h"
 
 namespace Chaos
 {
-class FPBDBendingConstraints : public FParticleRule, public FPBDBendingConstraintsBase
+class CHAOS_API FPBDBendingConstraints : public FParticleRule, public FPBDBendingConstraintsBase
 {
 	typedef FPBDBendingConstraintsBase Base;
 	using Base::MConstraints;
 
   public:
 	FPBDBendingConstraints(const FDynamicParticles& InParticles, TArray<TVec4<int32>>&& Constraints, const FReal stiffness = (FReal)1.)
-	    : Base(InParticles, MoveTemp(Constraints), stiffness) {}
-	virtual ~FPBDBendingConstraints() {}
-
-	void Apply(FPBDParticles& InParticles, const FReal Dt) const override //-V762
+	    : Base(InParticles, MoveTemp(Constraints), stiffness)
 	{
-		for (int i = 0; i < MConstraints.Num(); ++i)
-		{
-			const auto& Constraint = MConstraints[i];
-			const int32 i1 = Constraint[0];
-			const int32 i2 = Constraint[1];
-			const int32 i3 = Constraint[2];
-			const int32 i4 = Constraint[3];
-			auto Grads = Base::GetGradients(InParticles, i);
-			auto S = Base::GetScalingFactor(InParticles, i, Grads);
-			InParticles.P(i1) -= S * InParticles.InvM(i1) * Grads[0];
-			InParticles.P(i2) -= S * InParticles.InvM(i2) * Grads[1];
-			InParticles.P(i3) -= S * InParticles.InvM(i3) * Grads[2];
-			InParticles.P(i4) -= S * InParticles.InvM(i4) * Grads[3];
-		}
+		InitColor(InParticles);
 	}
+	virtual ~FPBDBendingConstraints() {}
+
+	void Apply(FPBDParticles& InParticles, const FReal Dt) const override; //-V762
+
+  private:
+	void InitColor(const FDynamicParticles& InParticles);
+	void ApplyHelper(FPBDParticles& InParticles, const FReal Dt, const int32 InConstraintIndex) const;
+
+	TArray<TArray<int32>> MConstraintsPerColor;
 };
 
 template<class T>
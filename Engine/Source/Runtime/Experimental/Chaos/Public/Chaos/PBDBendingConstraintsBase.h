@@ -25,10 +25,9 @@ class FPBDBendingConstraintsBase
 	}
 	virtual ~FPBDBendingConstraintsBase() {}
 
-	TArray<FVec3> GetGradients(const FPBDParticles& InParticles, const int32 i) const
+	TVec4<FVec3> GetGradients(const FPBDParticles& InParticles, const int32 i) const
 	{
-		TArray<FVec3> Grads;
-		Grads.SetNum(4);
+		TVec4<FVec3> Grads;
 		const auto& Constraint = MConstraints[i];
 		const FVec3& P1 = InParticles.P(Constraint[0]);
 		const FVec3& P2 = InParticles.P(Constraint[1]);
@@ -47,7 +46,7 @@ class FPBDBendingConstraintsBase
 		return Grads;
 	}
 
-	FReal GetScalingFactor(const FPBDParticles& InParticles, const int32 i, const TArray<FVec3>& Grads) const
+	FReal GetScalingFactor(const FPBDParticles& InParticles, const int32 i, const TVec4<FVec3>& Grads) const
 	{
 		const auto& Constraint = MConstraints[i];
 		const int32 i1 = Constraint[0];
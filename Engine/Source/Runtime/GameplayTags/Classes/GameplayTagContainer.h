@@ -849,6 +849,7 @@ protected:
 	friend struct FGameplayTagQueryExpression;
 	friend struct FGameplayTagNode;
 	friend struct FGameplayTag;
+	friend struct FGameplayTagBitSet;
 	
 private:
 
@@ -885,6 +886,77 @@ struct TStructOpsTypeTraits<FGameplayTagContainer> : public TStructOpsTypeTraits
 	};
 };
 
+/**
+ * A container as one bit per tag, indexed by net index, for code matching the same containers many times per frame.
+ * Matching two bitsets is a few word compares instead of searching the tag arrays for each tag.
+ *
+ * Bitsets built with their parents match like the container functions: Owned.HasAll(Required) is Container.HasAll(RequiredContainer)
+ * when Owned includes parents and Required doesn't. Net indices are rebuilt when tags are added at runtime, bitsets built before
+ * then are out of date and need to be built again, see IsUpToDate.
+ */
+struct GAMEPLAYTAGS_API FGameplayTagBitSet
+{
+	FGameplayTagBitSet() {}
+
+	explicit FGameplayTagBitSet(const FGameplayTagContainer& Container, bool bIncludeParentTags = true)
+	{
+		Set(Container, bIncludeParentTags);
+	}
+
+	/** Replaces the bits with the tags of the container, and their parents if bIncludeParentTags */
+	void Set(const FGameplayTagContainer& Container, bool bIncludeParentTags = true);
+
+	void Reset();
+
+	/** Whether the bitset was built with the current net indices */
+	bool IsUpToDate() const;
+
+	/** Returns true if the bit of the tag is set, which includes parents of the tags if the bitset was built with them */
+	bool HasTag(const FGameplayTag& Tag) const;
+
+	/** Returns true if all bits of Other are set in this one, true if Other is empty */
+	bool HasAll(const FGameplayTagBitSet& Other) const
+	{
+		checkSlow(Serial == Other.Serial);
+		for (int32 WordIndex = 0; WordIndex < Other.Words.Num(); ++WordIndex)
+		{
+			const uint64 Word = Words.IsValidIndex(WordIndex) ? Words[WordIndex] : 0;
+			if ((Word & Other.Words[WordIndex]) != Other.Words[WordIndex])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Returns true if any bit of Other is set in this one, false if Other is empty */
+	bool HasAny(const FGameplayTagBitSet& Other) const
+	{
+		checkSlow(Serial == Other.Serial);
+		const int32 NumWords = FMath::Min(Words.Num(), Other.Words.Num());
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			if (Words[WordIndex] & Other.Words[WordIndex])
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool IsEmpty() const
+	{
+		return Words.Num() == 0;
+	}
+
+private:
+	/** Trailing zero words are trimmed, so bitsets of the same tags are equal in size */
+	TArray<uint64, TInlineAllocator<4>> Words;
+
+	/** UGameplayTagsManager::GetNetIndexSerial at the time the bitset was built */
+	uint32 Serial = 0;
+};
+
 /** Class that can be subclassed by a game/plugin to allow easily adding native gameplay tags at startup */
 struct GAMEPLAYTAGS_API FGameplayTagNativeAdder
 {
@@ -584,6 +584,9 @@ public:
 	/** This is the actual value for an invalid tag "None". This is computed at runtime as (Total number of tags) + 1 */
 	FGameplayTagNetIndex GetInvalidTagNetIndex() const { VerifyNetworkIndex(); return InvalidTagNetIndex; }
 
+	/** Incremented each time the net indices are rebuilt, which invalidates FGameplayTagBitSets built before */
+	uint32 GetNetIndexSerial() const { VerifyNetworkIndex(); return NetIndexSerial; }
+
 	const TArray<TSharedPtr<FGameplayTagNode>>& GetNetworkGameplayTagNodeIndex() const { VerifyNetworkIndex(); return NetworkGameplayTagNodeIndex; }
 
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnGameplayTagLoaded, const FGameplayTag& /*Tag*/)
@@ -860,6 +863,8 @@ private:
 
 	bool bNetworkIndexInvalidated = true;
 
+	uint32 NetIndexSerial = 0;
+
 	/** Holds all of the valid gameplay-related tags that can be applied to assets */
 	UPROPERTY()
 	TArray<UDataTable*> GameplayTagTables;
@@ -642,6 +642,66 @@ FGameplayTagContainer FGameplayTagContainer::GetGameplayTagParents() const
 	return ResultContainer;
 }
 
+void FGameplayTagBitSet::Set(const FGameplayTagContainer& Container, bool bIncludeParentTags)
+{
+	UGameplayTagsManager& TagManager = UGameplayTagsManager::Get();
+
+	Words.Reset();
+	Serial = TagManager.GetNetIndexSerial();
+
+	const FGameplayTagNetIndex InvalidIndex = TagManager.GetInvalidTagNetIndex();
+	auto SetBit = [this, &TagManager, InvalidIndex](const FGameplayTag& Tag)
+	{
+		const FGameplayTagNetIndex NetIndex = TagManager.GetNetIndexFromTag(Tag);
+		if (NetIndex != InvalidIndex)
+		{
+			const int32 WordIndex = NetIndex / 64;
+			if (WordIndex >= Words.Num())
+			{
+				Words.AddZeroed(WordIndex + 1 - Words.Num());
+			}
+			Words[WordIndex] |= 1ull << (NetIndex % 64);
+		}
+	};
+
+	for (const FGameplayTag& Tag : Container.GameplayTags)
+	{
+		SetBit(Tag);
+	}
+
+	if (bIncludeParentTags)
+	{
+		for (const FGameplayTag& Tag : Container.ParentTags)
+		{
+			SetBit(Tag);
+		}
+	}
+}
+
+void FGameplayTagBitSet::Reset()
+{
+	Words.Reset();
+	Serial = 0;
+}
+
+bool FGameplayTagBitSet::IsUpToDate() const
+{
+	return Serial == UGameplayTagsManager::Get().GetNetIndexSerial();
+}
+
+bool FGameplayTagBitSet::HasTag(const FGameplayTag& Tag) const
+{
+	UGameplayTagsManager& TagManager = UGameplayTagsManager::Get();
+	const FGameplayTagNetIndex NetIndex = TagManager.GetNetIndexFromTag(Tag);
+	if (NetIndex == TagManager.GetInvalidTagNetIndex())
+	{
+		return false;
+	}
+
+	const int32 WordIndex = NetIndex / 64;
+	return Words.IsValidIndex(WordIndex) && (Words[WordIndex] & (1ull << (NetIndex % 64))) != 0;
+}
+
 DECLARE_CYCLE_STAT(TEXT("FGameplayTagContainer::Filter"), STAT_FGameplayTagContainer_Filter, STATGROUP_GameplayTags);
 
 FGameplayTagContainer FGameplayTagContainer::Filter(const FGameplayTagContainer& OtherContainer, TEnumAsByte<EGameplayTagMatchType::Type> TagMatchType, TEnumAsByte<EGameplayTagMatchType::Type> OtherTagMatchType) const
@@ -548,6 +548,7 @@ static FAutoConsoleVariableRef CVarPrintNetIndiceAssignment(TEXT("GameplayTags.P
 void UGameplayTagsManager::ConstructNetIndex()
 {
 	bNetworkIndexInvalidated = false;
+	++NetIndexSerial;
 
 	NetworkGameplayTagNodeIndex.Empty();
 
@@ -859,6 +859,196 @@ namespace
 
 		return true;
 	}
+
+	/** Builds a json value from the reader's current notation, consuming the rest of the object or array if it starts one. Returns null on a read error. */
+	TSharedPtr<FJsonValue> ReadJsonValueFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation)
+	{
+		switch (Notation)
+		{
+		case EJsonNotation::String:
+			return MakeShared<FJsonValueString>(Reader.GetValueAsString());
+
+		case EJsonNotation::Number:
+			return MakeShared<FJsonValueNumber>(Reader.GetValueAsNumber());
+
+		case EJsonNotation::Boolean:
+			return MakeShared<FJsonValueBoolean>(Reader.GetValueAsBoolean());
+
+		case EJsonNotation::Null:
+			return MakeShared<FJsonValueNull>();
+
+		case EJsonNotation::ObjectStart:
+		{
+			TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+			EJsonNotation FieldNotation;
+			while (Reader.ReadNext(FieldNotation) && FieldNotation != EJsonNotation::Error)
+			{
+				if (FieldNotation == EJsonNotation::ObjectEnd)
+				{
+					return MakeShared<FJsonValueObject>(Object);
+				}
+
+				// copy the identifier, reading a nested value overwrites it
+				const FString FieldName = Reader.GetIdentifier();
+				TSharedPtr<FJsonValue> FieldValue = ReadJsonValueFromReader(Reader, FieldNotation);
+				if (!FieldValue.IsValid())
+				{
+					return nullptr;
+				}
+				Object->SetField(FieldName, FieldValue);
+			}
+			return nullptr;
+		}
+
+		case EJsonNotation::ArrayStart:
+		{
+			TArray<TSharedPtr<FJsonValue>> Array;
+			EJsonNotation ElementNotation;
+			while (Reader.ReadNext(ElementNotation) && ElementNotation != EJsonNotation::Error)
+			{
+				if (ElementNotation == EJsonNotation::ArrayEnd)
+				{
+					return MakeShared<FJsonValueArray>(Array);
+				}
+
+				TSharedPtr<FJsonValue> ElementValue = ReadJsonValueFromReader(Reader, ElementNotation);
+				if (!ElementValue.IsValid())
+				{
+					return nullptr;
+				}
+				Array.Add(ElementValue);
+			}
+			return nullptr;
+		}
+
+		default:
+			return nullptr;
+		}
+	}
+
+	bool JsonReaderToUStructWithContainer(TJsonReader<TCHAR>& Reader, const UStruct* StructDefinition, void* OutStruct, const UStruct* ContainerStruct, void* Container, int64 CheckFlags, int64 SkipFlags);
+
+	/** Streaming counterpart of JsonValueToFPropertyWithContainer for a value the reader has just produced. */
+	bool JsonReaderValueToFPropertyWithContainer(TJsonReader<TCHAR>& Reader, EJsonNotation Notation, FProperty* Property, void* OutValue, const UStruct* ContainerStruct, void* Container, int64 CheckFlags, int64 SkipFlags)
+	{
+		if (Notation == EJsonNotation::ArrayStart && Property->ArrayDim == 1)
+		{
+			if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				// Existing elements are reused and the array trimmed at the end, matching the Resize in the DOM path
+				FScriptArrayHelper Helper(ArrayProperty, OutValue);
+				int32 ArrLen = 0;
+				EJsonNotation ElementNotation;
+				while (Reader.ReadNext(ElementNotation) && ElementNotation != EJsonNotation::Error)
+				{
+					if (ElementNotation == EJsonNotation::ArrayEnd)
+					{
+						Helper.Resize(ArrLen);
+						return true;
+					}
+
+					if (ArrLen >= Helper.Num())
+					{
+						Helper.AddValue();
+					}
+
+					const int32 Index = ArrLen++;
+					if (ElementNotation != EJsonNotation::Null)
+					{
+						if (!JsonReaderValueToFPropertyWithContainer(Reader, ElementNotation, ArrayProperty->Inner, Helper.GetRawPtr(Index), ContainerStruct, Container, CheckFlags & (~CPF_ParmFlags), SkipFlags))
+						{
+							UE_LOG(LogJson, Error, TEXT("JsonValueToUProperty - Unable to deserialize array element [%d] for property %s"), Index, *Property->GetNameCPP());
+							return false;
+						}
+					}
+				}
+
+				UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Unable to read array for property %s: %s"), *Property->GetNameCPP(), *Reader.GetErrorMessage());
+				return false;
+			}
+		}
+		else if (Notation == EJsonNotation::ObjectStart)
+		{
+			if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (Property->ArrayDim != 1)
+				{
+					UE_LOG(LogJson, Warning, TEXT("Ignoring excess properties when deserializing %s"), *Property->GetName());
+				}
+
+				if (!JsonReaderToUStructWithContainer(Reader, StructProperty->Struct, OutValue, ContainerStruct, Container, CheckFlags & (~CPF_ParmFlags), SkipFlags))
+				{
+					UE_LOG(LogJson, Error, TEXT("JsonValueToUProperty - FJsonObjectConverter::JsonObjectToUStruct failed for property %s"), *Property->GetNameCPP());
+					return false;
+				}
+				return true;
+			}
+		}
+
+		// Leaves, and containers without a streaming path, go through a temporary json value
+		TSharedPtr<FJsonValue> JsonValue = ReadJsonValueFromReader(Reader, Notation);
+		if (!JsonValue.IsValid())
+		{
+			UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Unable to read value for property %s: %s"), *Property->GetNameCPP(), *Reader.GetErrorMessage());
+			return false;
+		}
+		return JsonValueToFPropertyWithContainer(JsonValue, Property, OutValue, ContainerStruct, Container, CheckFlags, SkipFlags);
+	}
+
+	/** Streaming counterpart of JsonAttributesToUStructWithContainer. Expects the object's ObjectStart to have been read already and consumes up to its ObjectEnd. */
+	bool JsonReaderToUStructWithContainer(TJsonReader<TCHAR>& Reader, const UStruct* StructDefinition, void* OutStruct, const UStruct* ContainerStruct, void* Container, int64 CheckFlags, int64 SkipFlags)
+	{
+		if (StructDefinition == FJsonObjectWrapper::StaticStruct())
+		{
+			// The wrapper keeps the whole object, so there is nothing to stream
+			TSharedPtr<FJsonValue> JsonValue = ReadJsonValueFromReader(Reader, EJsonNotation::ObjectStart);
+			if (!JsonValue.IsValid())
+			{
+				UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Unable to read %s from JSON: %s"), *StructDefinition->GetName(), *Reader.GetErrorMessage());
+				return false;
+			}
+			return JsonAttributesToUStructWithContainer(JsonValue->AsObject()->Values, StructDefinition, OutStruct, ContainerStruct, Container, CheckFlags, SkipFlags);
+		}
+
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation) && Notation != EJsonNotation::Error)
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+
+			// find a property matching this json field, fields that don't name a property are skipped without being parsed into values
+			const FName FieldName(*Reader.GetIdentifier(), FNAME_Find);
+			FProperty* Property = FieldName.IsNone() ? nullptr : StructDefinition->FindPropertyByName(FieldName);
+			if (Property && ((CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags)) || Property->HasAnyPropertyFlags(SkipFlags)))
+			{
+				Property = nullptr;
+			}
+
+			if (!Property)
+			{
+				if ((Notation == EJsonNotation::ObjectStart && !Reader.SkipObject()) || (Notation == EJsonNotation::ArrayStart && !Reader.SkipArray()))
+				{
+					break;
+				}
+				continue;
+			}
+
+			if (Notation != EJsonNotation::Null)
+			{
+				void* Value = Property->ContainerPtrToValuePtr<uint8>(OutStruct);
+				if (!JsonReaderValueToFPropertyWithContainer(Reader, Notation, Property, Value, ContainerStruct, Container, CheckFlags, SkipFlags))
+				{
+					UE_LOG(LogJson, Error, TEXT("JsonObjectToUStruct - Unable to parse %s.%s from JSON"), *StructDefinition->GetName(), *Property->GetName());
+					return false;
+				}
+			}
+		}
+
+		UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Unable to read %s from JSON: %s"), *StructDefinition->GetName(), *Reader.GetErrorMessage());
+		return false;
+	}
 }
 
 bool FJsonObjectConverter::JsonValueToUProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* OutValue, int64 CheckFlags, int64 SkipFlags)
@@ -876,6 +1066,18 @@ bool FJsonObjectConverter::JsonAttributesToUStruct(const TMap< FString, TSharedP
 	return JsonAttributesToUStructWithContainer(JsonAttributes, StructDefinition, OutStruct, StructDefinition, OutStruct, CheckFlags, SkipFlags);
 }
 
+bool FJsonObjectConverter::JsonReaderToUStruct(TJsonReader<TCHAR>& JsonReader, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags, int64 SkipFlags)
+{
+	EJsonNotation Notation;
+	if (!JsonReader.ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+	{
+		UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Expected a JSON object for %s: %s"), *StructDefinition->GetName(), *JsonReader.GetErrorMessage());
+		return false;
+	}
+
+	return JsonReaderToUStructWithContainer(JsonReader, StructDefinition, OutStruct, StructDefinition, OutStruct, CheckFlags, SkipFlags);
+}
+
 //static 
 bool FJsonObjectConverter::GetTextFromField(const FString& FieldName, const TSharedPtr<FJsonValue>& FieldValue, FText& TextOut)
 {
@@ -218,6 +218,37 @@ public: // JSON -> UStruct
 	 */
 	static bool JsonValueToUProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* OutValue, int64 CheckFlags = 0, int64 SkipFlags = 0);
 
+	/**
+	 * Reads a json object straight from a reader into a UStruct, without building an intermediate FJsonObject.
+	 * Fields that don't match a property are skipped in the stream. Property types without a streaming path
+	 * (maps, sets, object references, FText objects...) are read into a temporary json value and converted as JsonValueToUProperty does.
+	 *
+	 * @param JsonReader Reader positioned before the object's opening brace
+	 * @param StructDefinition UStruct definition that is looked over for properties
+	 * @param OutStruct The UStruct instance to copy in to
+	 * @param CheckFlags Only convert properties that match at least one of these flags. If 0 check all properties.
+	 * @param SkipFlags Skip properties that match any of these flags
+	 *
+	 * @return False if the json could not be read or any properties matched but failed to deserialize
+	 */
+	static bool JsonReaderToUStruct(TJsonReader<TCHAR>& JsonReader, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0);
+
+	/**
+	 * Templated version of JsonReaderToUStruct
+	 *
+	 * @param JsonReader Reader positioned before the object's opening brace
+	 * @param OutStruct The UStruct instance to copy in to
+	 * @param CheckFlags Only convert properties that match at least one of these flags. If 0 check all properties.
+	 * @param SkipFlags Skip properties that match any of these flags
+	 *
+	 * @return False if the json could not be read or any properties matched but failed to deserialize
+	 */
+	template<typename OutStructType>
+	static bool JsonReaderToUStruct(TJsonReader<TCHAR>& JsonReader, OutStructType* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0)
+	{
+		return JsonReaderToUStruct(JsonReader, OutStructType::StaticStruct(), OutStruct, CheckFlags, SkipFlags);
+	}
+
 	/**
 	 * Converts from a json string containing an object to a UStruct
 	 *
@@ -231,14 +262,8 @@ public: // JSON -> UStruct
 	template<typename OutStructType>
 	static bool JsonObjectStringToUStruct(const FString& JsonString, OutStructType* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0)
 	{
-		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(JsonString);
-		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
-		{
-			UE_LOG(LogJson, Warning, TEXT("JsonObjectStringToUStruct - Unable to parse json=[%s]"), *JsonString);
-			return false;
-		}
-		if (!FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), OutStruct, CheckFlags, SkipFlags))
+		if (!FJsonObjectConverter::JsonReaderToUStruct(*JsonReader, OutStruct, CheckFlags, SkipFlags))
 		{
 			UE_LOG(LogJson, Warning, TEXT("JsonObjectStringToUStruct - Unable to deserialize. json=[%s]"), *JsonString);
 			return false;
@@ -86,6 +86,14 @@ FAutoConsoleVariableRef CVarLandscapeLODDistributionScale(
 	ECVF_Scalability
 );
 
+int32 GLandscapeReuseSectionLODs = 1;
+static FAutoConsoleVariableRef CVarLandscapeReuseSectionLODs(
+	TEXT("r.LandscapeReuseSectionLODs"),
+	GLandscapeReuseSectionLODs,
+	TEXT("Reuse the per section LOD values computed for a view in the previous frame when the view's LOD inputs did not change, instead of recomputing them for every section."),
+	ECVF_RenderThreadSafe
+);
+
 float GShadowMapWorldUnitsToTexelFactor = -1.0f;
 static FAutoConsoleVariableRef CVarShadowMapWorldUnitsToTexelFactor(
 	TEXT("Landscape.ShadowMapWorldUnitsToTexelFactor"),
@@ -837,19 +845,28 @@ void FLandscapeRenderSystem::ResizeAndMoveTo(FIntPoint NewMin, FIntPoint NewSize
 	SectionLODBiases.SetAllowCPUAccess(true);
 	SectionTessellationFalloffC.SetAllowCPUAccess(true);
 	SectionTessellationFalloffK.SetAllowCPUAccess(true);
+
+	SectionParametersRevision++;
 }
 
 void FLandscapeRenderSystem::PrepareView(const FSceneView* View)
 {
 #if PLATFORM_SUPPORTS_LANDSCAPE_VISUAL_MESH_LOD_STREAMING
 	const int32 NumSceneProxies = SceneProxies.Num();
-	SectionCurrentFirstLODIndices.Empty(NumSceneProxies);
-	SectionCurrentFirstLODIndices.AddUninitialized(NumSceneProxies);
+	bool bFirstLODIndicesChanged = SectionCurrentFirstLODIndices.Num() != NumSceneProxies;
+	SectionCurrentFirstLODIndices.SetNumUninitialized(NumSceneProxies);
 
 	for (int32 Idx = 0; Idx < NumSceneProxies; ++Idx)
 	{
 		const FLandscapeComponentSceneProxy* Proxy = SceneProxies[Idx];
-		SectionCurrentFirstLODIndices[Idx] = Proxy ? Proxy->GetCurrentFirstLODIdx_RenderThread() : 0;
+		const uint8 FirstLODIdx = Proxy ? Proxy->GetCurrentFirstLODIdx_RenderThread() : 0;
+		bFirstLODIndicesChanged |= SectionCurrentFirstLODIndices[Idx] != FirstLODIdx;
+		SectionCurrentFirstLODIndices[Idx] = FirstLODIdx;
+	}
+
+	if (bFirstLODIndicesChanged)
+	{
+		SectionParametersRevision++;
 	}
 #endif
 	
@@ -925,6 +942,36 @@ void FLandscapeRenderSystem::ComputeSectionPerViewParameters(
 
 	float LODScale = ViewLODDistanceFactor * CVarStaticMeshLODDistanceScale.GetValueOnRenderThread();
 
+	FSectionPerViewParametersKey Key;
+	Key.ViewLODOverride = ViewLODOverride;
+	Key.LODScale = LODScale;
+	Key.bDrawCollisionPawn = bDrawCollisionPawn;
+	Key.bDrawCollisionCollision = bDrawCollisionCollision;
+	Key.ViewOrigin = ViewOrigin;
+	Key.ViewProjectionMatrix = ViewProjectionMarix;
+	Key.SectionParametersRevision = SectionParametersRevision;
+
+	if (GLandscapeReuseSectionLODs)
+	{
+		// The previous frame's values are only written on the rendering thread in BeginFrame, before any of this frame's tasks are dispatched
+		const FCachedSectionPerViewParameters* PreviousParameters = PreviousFrameSectionPerViewParameters.FindByPredicate([&Key](const FCachedSectionPerViewParameters& Cached) { return Cached.Key == Key; });
+		if (PreviousParameters)
+		{
+			FScopeLock Lock(&CachedValuesCS);
+
+			CachedSectionLODValues.Add(ViewPtrAsIdentifier, PreviousParameters->SectionLODValues);
+
+			if (TessellationFalloffSettings.UseTessellationComponentScreenSizeFalloff && NumEntitiesWithTessellation > 0)
+			{
+				CachedSectionTessellationFalloffC.Add(ViewPtrAsIdentifier, PreviousParameters->SectionTessellationFalloffC);
+				CachedSectionTessellationFalloffK.Add(ViewPtrAsIdentifier, PreviousParameters->SectionTessellationFalloffK);
+			}
+
+			CurrentFrameSectionPerViewParameters.Add(*PreviousParameters);
+			return;
+		}
+	}
+
 	for (int32 EntityIndex = 0; EntityIndex < SectionLODSettings.Num(); EntityIndex++)
 	{
 		float MeshScreenSizeSquared = ComputeBoundsScreenRadiusSquared(FVector(SectionOriginAndRadius[EntityIndex]), SectionOriginAndRadius[EntityIndex].W, ViewOrigin, ViewProjectionMarix);
@@ -970,6 +1017,15 @@ void FLandscapeRenderSystem::ComputeSectionPerViewParameters(
 			CachedSectionTessellationFalloffC.Add(ViewPtrAsIdentifier, NewSectionTessellationFalloffC);
 			CachedSectionTessellationFalloffK.Add(ViewPtrAsIdentifier, NewSectionTessellationFalloffK);
 		}
+
+		if (GLandscapeReuseSectionLODs)
+		{
+			FCachedSectionPerViewParameters& CurrentParameters = CurrentFrameSectionPerViewParameters.AddDefaulted_GetRef();
+			CurrentParameters.Key = Key;
+			CurrentParameters.SectionLODValues = MoveTemp(NewSectionLODValues);
+			CurrentParameters.SectionTessellationFalloffC = MoveTemp(NewSectionTessellationFalloffC);
+			CurrentParameters.SectionTessellationFalloffK = MoveTemp(NewSectionTessellationFalloffK);
+		}
 	}
 }
 
@@ -1090,6 +1146,9 @@ void FLandscapeRenderSystem::BeginFrame()
 
 	CachedSectionLODValues.Empty();
 
+	PreviousFrameSectionPerViewParameters = MoveTemp(CurrentFrameSectionPerViewParameters);
+	CurrentFrameSectionPerViewParameters.Reset();
+
 	if (TessellationFalloffSettings.UseTessellationComponentScreenSizeFalloff && NumEntitiesWithTessellation > 0)
 	{
 		CachedSectionTessellationFalloffC.Empty();
@@ -569,6 +569,44 @@ struct FLandscapeRenderSystem
 	TMap<const FSceneView*, FGraphEventRef> PerViewParametersTasks;
 	FGraphEventRef FetchHeightmapLODBiasesEventRef;
 
+	/** Inputs of the per view section parameters, views with equal keys get equal section LOD and tessellation values */
+	struct FSectionPerViewParametersKey
+	{
+		int32 ViewLODOverride;
+		float LODScale;
+		bool bDrawCollisionPawn;
+		bool bDrawCollisionCollision;
+		FVector ViewOrigin;
+		FMatrix ViewProjectionMatrix;
+		uint32 SectionParametersRevision;
+
+		bool operator==(const FSectionPerViewParametersKey& Other) const
+		{
+			return ViewLODOverride == Other.ViewLODOverride
+				&& LODScale == Other.LODScale
+				&& bDrawCollisionPawn == Other.bDrawCollisionPawn
+				&& bDrawCollisionCollision == Other.bDrawCollisionCollision
+				&& ViewOrigin == Other.ViewOrigin
+				&& ViewProjectionMatrix == Other.ViewProjectionMatrix
+				&& SectionParametersRevision == Other.SectionParametersRevision;
+		}
+	};
+
+	struct FCachedSectionPerViewParameters
+	{
+		FSectionPerViewParametersKey Key;
+		TResourceArray<float> SectionLODValues;
+		TResourceArray<float> SectionTessellationFalloffC;
+		TResourceArray<float> SectionTessellationFalloffK;
+	};
+
+	/** Per view section parameters of the previous and current frames, views that didn't move reuse the previous frame's values (see r.LandscapeReuseSectionLODs) */
+	TArray<FCachedSectionPerViewParameters> PreviousFrameSectionPerViewParameters;
+	TArray<FCachedSectionPerViewParameters> CurrentFrameSectionPerViewParameters;
+
+	/** Incremented whenever a per section input of ComputeSectionPerViewParameters changes */
+	uint32 SectionParametersRevision;
+
 	struct FComputeSectionPerViewParametersTask
 	{
 		FLandscapeRenderSystem& RenderSystem;
@@ -652,6 +690,7 @@ struct FLandscapeRenderSystem
 		, Min(MAX_int32, MAX_int32)
 		, Size(EForceInit::ForceInitToZero)
 		, CachedView(nullptr)
+		, SectionParametersRevision(0)
 	{
 		SectionLODValues.SetAllowCPUAccess(true);
 		SectionLODBiases.SetAllowCPUAccess(true);
@@ -672,11 +711,13 @@ struct FLandscapeRenderSystem
 	void SetSectionLODSettings(FIntPoint ComponentBase, LODSettingsComponent LODSettings)
 	{
 		SectionLODSettings[GetComponentLinearIndex(ComponentBase)] = LODSettings;
+		SectionParametersRevision++;
 	}
 
 	void SetSectionOriginAndRadius(FIntPoint ComponentBase, FVector4 OriginAndRadius)
 	{
 		SectionOriginAndRadius[GetComponentLinearIndex(ComponentBase)] = OriginAndRadius;
+		SectionParametersRevision++;
 	}
 
 	void SetSceneProxy(FIntPoint ComponentBase, FLandscapeComponentSceneProxy* SceneProxy)
@@ -33,6 +33,7 @@
 #include "Stats/StatsMallocProfilerProxy.h"
 #include "Trace/Trace.inl"
 #include "ProfilingDebugging/TraceAuxiliary.h"
+#include "ProfilingDebugging/MemorySamplingTrace.h"
 #if WITH_ENGINE
 #include "HAL/PlatformSplash.h"
 #endif
@@ -1609,6 +1610,11 @@ int32 FEngineLoop::PreInitPreStartupScreen(const TCHAR* CmdLine)
 		GMallocFrameProfilerEnabled = true;
 		GMalloc = FMallocFrameProfiler::OverrideIfEnabled(GMalloc);
 	}
+
+#if MEMORYSAMPLINGTRACE_ENABLED
+	// Samples allocations into the trace when started with -trace=memsampling, see Trace.MemSampling.Interval
+	GMalloc = FMemorySamplingTrace::OverrideIfEnabled(GMalloc);
+#endif
 #endif // !UE_BUILD_SHIPPING
 
 #if RHI_COMMAND_LIST_DEBUG_TRACES
@@ -6,6 +6,7 @@
 #include "UObject/Object.h"
 #include "EntitySystem/MovieScenePropertyBinding.h"
 #include "MovieSceneCommonHelpers.h"
+#include "HAL/IConsoleManager.h"
 
 
 namespace UE
@@ -13,6 +14,14 @@ namespace UE
 namespace MovieScene
 {
 
+bool GThreadedFastPropertySetters = true;
+FAutoConsoleVariableRef CVarThreadedFastPropertySetters(
+	TEXT("Sequencer.ThreadedEvaluation.FastPropertySetters"),
+	GThreadedFastPropertySetters,
+	TEXT("(Default: true) Whether properties set through a fast property offset, without a setter function, are written on worker threads when threaded evaluation is used.\n"),
+	ECVF_Default
+);
+
 TOptional<uint16> ComputeFastPropertyPtrOffset(UClass* ObjectClass, const FMovieScenePropertyBinding& PropertyBinding)
 {
 	using namespace UE::MovieScene;
@@ -26,6 +26,9 @@ namespace MovieScene
 
 DECLARE_CYCLE_STAT(TEXT("Apply properties"), MovieSceneEval_ApplyProperties,  STATGROUP_MovieSceneECS);
 
+/** Whether complete property values with a fast property offset are set from worker threads, see Sequencer.ThreadedEvaluation.FastPropertySetters */
+extern MOVIESCENE_API bool GThreadedFastPropertySetters;
+
 
 
 template<typename PropertyTraits, typename MetaDatatype, typename MetaDataIndices, typename CompositeIndices, typename ...CompositeTypes>
@@ -340,12 +343,35 @@ struct TPropertyComponentHandlerImpl<PropertyTraits, TPropertyMetaData<MetaDataT
 	{
 		FBuiltInComponentTypes* BuiltInComponents = FBuiltInComponentTypes::Get();
 
+		// Fast offsets are only used for properties without a setter function, and never for bools that may be bitfields, so setting
+		// them is a plain write to the object that can happen alongside the other setters. Each allocation is written by its own task.
+		const bool bThreadedFastSetters = GThreadedFastPropertySetters && Linker->EntityManager.GetThreadingModel() == EEntityThreadingModel::TaskGraph;
+		if (bThreadedFastSetters)
+		{
+			FEntityTaskBuilder()
+			.Read(BuiltInComponents->BoundObject)
+			.ReadOneOf(BuiltInComponents->FastPropertyOffset, BuiltInComponents->SlowProperty)
+			.ReadAllOf(Definition.GetMetaDataComponent<MetaDataTypes>(MetaDataIndices)...)
+			.ReadAllOf(Composites[CompositeIndices].ComponentTypeID.ReinterpretCast<CompositeTypes>()...)
+			.FilterAll({ Definition.PropertyType, BuiltInComponents->FastPropertyOffset })
+			.SetStat(GET_STATID(MovieSceneEval_ApplyProperties))
+			.SetDesiredThread(ENamedThreads::AnyHiPriThreadHiPriTask)
+			.template Dispatch_PerAllocation<CompleteSetterTask>(&Linker->EntityManager, InPrerequisites, &Subsequents, Definition.CustomPropertyRegistration);
+		}
+
+		FComponentMask ThreadedSetterMask;
+		if (bThreadedFastSetters)
+		{
+			ThreadedSetterMask.Set(BuiltInComponents->FastPropertyOffset);
+		}
+
 		FEntityTaskBuilder()
 		.Read(BuiltInComponents->BoundObject)
 		.ReadOneOf(BuiltInComponents->CustomPropertyIndex, BuiltInComponents->FastPropertyOffset, BuiltInComponents->SlowProperty)
 		.ReadAllOf(Definition.GetMetaDataComponent<MetaDataTypes>(MetaDataIndices)...)
 		.ReadAllOf(Composites[CompositeIndices].ComponentTypeID.ReinterpretCast<CompositeTypes>()...)
 		.FilterAll({ Definition.PropertyType })
+		.FilterOut(ThreadedSetterMask)
 		.SetStat(GET_STATID(MovieSceneEval_ApplyProperties))
 		.SetDesiredThread(Linker->EntityManager.GetGatherThread())
 		.template Dispatch_PerAllocation<CompleteSetterTask>(&Linker->EntityManager, InPrerequisites, &Subsequents, Definition.CustomPropertyRegistration);
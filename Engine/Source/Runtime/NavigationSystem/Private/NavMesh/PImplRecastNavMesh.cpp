@@ -17,6 +17,7 @@
 #include "NavMesh/RecastQueryFilter.h"
 #include "NavLinkCustomInterface.h"
 #include "VisualLogger/VisualLogger.h"
+#include "Hash/CityHash.h"
 
 
 //----------------------------------------------------------------------//
@@ -33,15 +34,20 @@ static_assert(RECAST_UNWALKABLE_POLY_COST == DT_UNWALKABLE_POLY_COST, "Unwalkabl
 
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY_SIMPLE(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : GetWorkerNavQuery(); \
 	NavQueryVariable.init(DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : GetWorkerNavQuery(); \
 	NavQueryVariable.init(DetourNavMesh, NumNodes, &LinkFilter);
 
+dtNavMeshQuery& FPImplRecastNavMesh::GetWorkerNavQuery()
+{
+	// init() only reallocates the node pool when a query needs more nodes than it has
+	static thread_local dtNavMeshQuery WorkerNavQuery;
+	return WorkerNavQuery;
+}
+
 static void* DetourMalloc(int Size, dtAllocHint)
 {
 	LLM_SCOPE(ELLMTag::NavigationRecast);
@@ -87,6 +93,123 @@ struct FRecastInitialSetup
 };
 static FRecastInitialSetup RecastSetup;
 
+static int32 GNavmeshShareCompressedTileCache = 0;
+static FAutoConsoleVariableRef NavmeshVarShareCompressedTileCache(TEXT("n.NavmeshShareCompressedTileCache"), GNavmeshShareCompressedTileCache,
+	TEXT("If non-zero, compressed tile cache layers of loaded navmeshes are kept in named shared memory, so processes loading the same navmesh data map a single copy.\n")
+	TEXT("Layers are copied to private memory before being rebuilt or handed over (not used in editor)."), ECVF_ReadOnly);
+
+/** Named shared memory region holding compressed tile cache layers, unmapped when the last layer pointing into it goes away */
+struct FRecastSharedTileCacheMemory
+{
+	struct FHeader
+	{
+		volatile int32 bReady;
+		int32 Padding;
+		uint64 DataSize;
+	};
+
+	FPlatformMemory::FSharedMemoryRegion* Region;
+
+	explicit FRecastSharedTileCacheMemory(FPlatformMemory::FSharedMemoryRegion* InRegion) : Region(InRegion) {}
+	~FRecastSharedTileCacheMemory()
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	}
+
+	FHeader* GetHeader() const { return (FHeader*)Region->GetAddress(); }
+	uint8* GetData() const { return (uint8*)(GetHeader() + 1); }
+};
+
+namespace RecastSharedTileCache
+{
+	/** Replaces private copies of compressed layers with a region shared by all processes that loaded identical data */
+	static void MoveLayersToSharedMemory(TMap<FIntPoint, TArray<FNavMeshTileData> >& TileCacheLayers)
+	{
+		// identical data must produce identical layout, don't depend on map order
+		TArray<FIntPoint> TileCoords;
+		TileCacheLayers.GetKeys(TileCoords);
+		TileCoords.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.X < B.X || (A.X == B.X && A.Y < B.Y); });
+
+		TArray<FNavMeshTileData*> Layers;
+		uint64 TotalSize = 0;
+		uint64 Hash = 0;
+		for (const FIntPoint& TileCoord : TileCoords)
+		{
+			for (FNavMeshTileData& LayerData : TileCacheLayers[TileCoord])
+			{
+				if (LayerData.IsValid() && !LayerData.IsInSharedMemory())
+				{
+					const int32 LayerKey[] = { TileCoord.X, TileCoord.Y, LayerData.LayerIndex, LayerData.DataSize };
+					Hash = CityHash64WithSeed((const char*)LayerKey, sizeof(LayerKey), Hash);
+					Hash = CityHash64WithSeed((const char*)LayerData.GetData(), LayerData.DataSize, Hash);
+
+					Layers.Add(&LayerData);
+					TotalSize += Align(LayerData.DataSize, 16);
+				}
+			}
+		}
+
+		if (Layers.Num() == 0)
+		{
+			return;
+		}
+
+		const FString RegionName = FString::Printf(TEXT("UE4NavTileCache_%016llx_%llu"), Hash, TotalSize);
+		FPlatformMemory::FSharedMemoryRegion* Region = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, true,
+			FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write, sizeof(FRecastSharedTileCacheMemory::FHeader) + TotalSize);
+		if (Region == nullptr)
+		{
+			UE_LOG(LogNavigation, Warning, TEXT("Failed to map shared memory for %d compressed tile cache layers (%llu bytes), keeping private copies."), Layers.Num(), TotalSize);
+			return;
+		}
+
+		TSharedPtr<FRecastSharedTileCacheMemory, ESPMode::ThreadSafe> SharedMemory = MakeShareable(new FRecastSharedTileCacheMemory(Region));
+		FRecastSharedTileCacheMemory::FHeader* Header = SharedMemory->GetHeader();
+		uint8* SharedData = SharedMemory->GetData();
+
+		// first process to map the region fills it, others only verify contents before dropping their own copies
+		const bool bFilled = FPlatformAtomics::AtomicRead(&Header->bReady) != 0;
+		if (bFilled && Header->DataSize != TotalSize)
+		{
+			UE_LOG(LogNavigation, Warning, TEXT("Shared memory region %s has unexpected size, keeping private copies of compressed tile cache layers."), *RegionName);
+			return;
+		}
+
+		uint64 Offset = 0;
+		for (FNavMeshTileData* LayerData : Layers)
+		{
+			if (!bFilled)
+			{
+				FMemory::Memcpy(SharedData + Offset, LayerData->GetData(), LayerData->DataSize);
+			}
+			else if (FMemory::Memcmp(SharedData + Offset, LayerData->GetData(), LayerData->DataSize) != 0)
+			{
+				UE_LOG(LogNavigation, Warning, TEXT("Shared memory region %s contents differ, keeping private copies of compressed tile cache layers."), *RegionName);
+				return;
+			}
+			Offset += Align(LayerData->DataSize, 16);
+		}
+
+		if (!bFilled)
+		{
+			Header->DataSize = TotalSize;
+			FPlatformAtomics::InterlockedExchange(&Header->bReady, 1);
+		}
+
+		Offset = 0;
+		for (FNavMeshTileData* LayerData : Layers)
+		{
+			TSharedPtr<FNavMeshTileData::FNavData, ESPMode::ThreadSafe> SharedNavData = MakeShareable(new FNavMeshTileData::FNavData(SharedData + Offset));
+			SharedNavData->SharedMemory = SharedMemory;
+			LayerData->NavData = SharedNavData;
+
+			Offset += Align(LayerData->DataSize, 16);
+		}
+
+		UE_LOG(LogNavigation, Log, TEXT("Compressed tile cache layers (%d, %llu bytes) %s shared memory region %s."), Layers.Num(), TotalSize, bFilled ? TEXT("mapped from") : TEXT("stored in"), *RegionName);
+	}
+}
+
 /****************************
  * helpers
  ****************************/
@@ -448,6 +571,11 @@ void FPImplRecastNavMesh::Serialize( FArchive& Ar, int32 NavMeshVersion )
 					}
 				}
 			}
+
+			if (GNavmeshShareCompressedTileCache && !GIsEditor)
+			{
+				RecastSharedTileCache::MoveLayersToSharedMemory(CompressedTileCacheLayers);
+			}
 		}
 	}
 	else if (Ar.IsSaving())
@@ -903,6 +1031,104 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartL
 	return PostProcessPathInternal(FindPathStatus, Path, NavQuery, QueryFilter, StartPolyID, EndPolyID, RecastStartPos, RecastEndPos, PathResult);
 }
 
+bool FPImplRecastNavMesh::InitSlicedFindPath(FRecastSlicedPathQuery& SlicedQuery, const FVector& StartLoc, const FVector& EndLoc, const float CostLimit, FSharedConstNavQueryFilter InQueryFilter) const
+{
+	if (DetourNavMesh == NULL || NavMeshOwner == NULL || !InQueryFilter.IsValid())
+	{
+		return false;
+	}
+
+	const FRecastQueryFilter* FilterImplementation = (const FRecastQueryFilter*)(InQueryFilter->GetImplementation());
+	const dtQueryFilter* QueryFilter = FilterImplementation ? FilterImplementation->GetAsDetourQueryFilter() : NULL;
+	if (QueryFilter == NULL)
+	{
+		UE_VLOG(NavMeshOwner, LogNavigation, Warning, TEXT("FPImplRecastNavMesh::InitSlicedFindPath failing due to QueryFilter == NULL"));
+		return false;
+	}
+
+	SlicedQuery.QueryFilter = InQueryFilter;
+	SlicedQuery.NavQuery.init(DetourNavMesh, InQueryFilter->GetMaxSearchNodes(), &SlicedQuery.LinkFilter);
+
+	const bool bCanSearch = InitPathfinding(StartLoc, EndLoc, SlicedQuery.NavQuery, QueryFilter, SlicedQuery.RecastStartPos, SlicedQuery.StartPolyID, SlicedQuery.RecastEndPos, SlicedQuery.EndPolyID);
+	if (!bCanSearch)
+	{
+		return false;
+	}
+
+	SlicedQuery.Status = SlicedQuery.NavQuery.initSlicedFindPath(SlicedQuery.StartPolyID, SlicedQuery.EndPolyID, &SlicedQuery.RecastStartPos.X, &SlicedQuery.RecastEndPos.X, CostLimit, QueryFilter);
+	return !dtStatusFailed(SlicedQuery.Status);
+}
+
+bool FPImplRecastNavMesh::UpdateSlicedFindPath(FRecastSlicedPathQuery& SlicedQuery, const int32 MaxIterations, int32& DoneIterations) const
+{
+	DoneIterations = 0;
+
+	// navmesh could have been released or reallocated since the search was started
+	if (DetourNavMesh == NULL || SlicedQuery.NavQuery.getAttachedNavMesh() != DetourNavMesh)
+	{
+		SlicedQuery.Status = DT_FAILURE;
+	}
+	else if (dtStatusInProgress(SlicedQuery.Status))
+	{
+		SlicedQuery.Status = SlicedQuery.NavQuery.updateSlicedFindPath(MaxIterations, &DoneIterations);
+	}
+
+	return !dtStatusInProgress(SlicedQuery.Status);
+}
+
+/** Exposes adding items, so path result can be built from node pool of a sliced search without finalizing it */
+struct FRecastSlicedPathResult : public dtQueryResult
+{
+	using dtQueryResult::addItem;
+};
+
+ENavigationQueryResult::Type FPImplRecastNavMesh::GetSlicedFindPathResult(const FRecastSlicedPathQuery& SlicedQuery, FNavMeshPath& Path) const
+{
+	if (DetourNavMesh == NULL || SlicedQuery.NavQuery.getAttachedNavMesh() != DetourNavMesh || dtStatusFailed(SlicedQuery.Status))
+	{
+		return ENavigationQueryResult::Error;
+	}
+
+	const dtQueryFilter* QueryFilter = ((const FRecastQueryFilter*)(SlicedQuery.QueryFilter->GetImplementation()))->GetAsDetourQueryFilter();
+
+	dtNode* BestNode = nullptr;
+	float BestNodeCost = 0.f;
+	SlicedQuery.NavQuery.getCurrentBestResult(BestNode, BestNodeCost);
+
+	dtStatus PathStatus = DT_SUCCESS;
+	FRecastSlicedPathResult PathResult;
+	if (BestNode == nullptr)
+	{
+		// search was finished right away, start and end are on the same poly
+		PathResult.addItem(SlicedQuery.StartPolyID, 0.f, &SlicedQuery.RecastStartPos.X, 0);
+	}
+	else
+	{
+		const dtNodePool* NodePool = SlicedQuery.NavQuery.getNodePool();
+		TArray<const dtNode*, TInlineAllocator<64> > PathNodes;
+		for (const dtNode* Node = BestNode; Node; Node = NodePool->getNodeAtIdx(Node->pidx))
+		{
+			PathNodes.Add(Node);
+		}
+
+		for (int32 Idx = PathNodes.Num() - 1; Idx >= 0; Idx--)
+		{
+			PathResult.addItem(PathNodes[Idx]->id, PathNodes[Idx]->cost, PathNodes[Idx]->pos, 0);
+		}
+
+		if (BestNode->id != SlicedQuery.EndPolyID)
+		{
+			PathStatus |= DT_PARTIAL_RESULT;
+		}
+	}
+
+	if (dtStatusDetail(SlicedQuery.Status, DT_OUT_OF_NODES))
+	{
+		PathStatus |= DT_OUT_OF_NODES;
+	}
+
+	return PostProcessPathInternal(PathStatus, Path, SlicedQuery.NavQuery, QueryFilter, SlicedQuery.StartPolyID, SlicedQuery.EndPolyID, SlicedQuery.RecastStartPos, SlicedQuery.RecastEndPos, PathResult);
+}
 
 ENavigationQueryResult::Type FPImplRecastNavMesh::PostProcessPathInternal(dtStatus FindPathStatus, FNavMeshPath& Path, 
 	const dtNavMeshQuery& NavQuery, const dtQueryFilter* QueryFilter, 
@@ -1014,6 +1240,224 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::TestClusterPath(const FVector&
 
 	return DTStatusToNavQueryResult(status);
 }
+
+namespace RecastClusterPath
+{
+	struct FSearchNode
+	{
+		FSearchNode(dtClusterRef InParentRef, float InCost) : ParentRef(InParentRef), Cost(InCost), bClosed(false) {}
+
+		dtClusterRef ParentRef;
+		float Cost;
+		bool bClosed;
+	};
+
+	struct FOpenEntry
+	{
+		FOpenEntry() : ClusterRef(0), Total(0.0f) {}
+		FOpenEntry(dtClusterRef InClusterRef, float InTotal) : ClusterRef(InClusterRef), Total(InTotal) {}
+
+		dtClusterRef ClusterRef;
+		float Total;
+
+		bool operator<(const FOpenEntry& Other) const { return Total < Other.Total; }
+	};
+
+	const dtCluster* GetCluster(const dtNavMesh& NavMesh, dtClusterRef ClusterRef)
+	{
+		const dtMeshTile* Tile = NavMesh.getTileByRef(ClusterRef);
+		const uint32 ClusterIdx = NavMesh.decodeClusterIdCluster(ClusterRef);
+		return (Tile && Tile->clusters && ClusterIdx < (uint32)Tile->header->clusterCount) ? &Tile->clusters[ClusterIdx] : nullptr;
+	}
+
+	/** Restricts source filter to ground polys of clusters found by cluster graph search, off-mesh links are always allowed */
+	class FCorridorFilter : public dtQueryFilter
+	{
+	public:
+		FCorridorFilter(const dtNavMesh& InNavMesh, const dtQueryFilter& InSourceFilter, const TSet<dtClusterRef>& InClusters)
+			: dtQueryFilter(true), NavMesh(InNavMesh), SourceFilter(InSourceFilter), Clusters(InClusters)
+		{
+			copyFrom(InSourceFilter);
+		}
+
+	protected:
+		virtual bool passVirtualFilter(const dtPolyRef ref, const dtMeshTile* tile, const dtPoly* poly) const override
+		{
+			if (!SourceFilter.passFilter(ref, tile, poly))
+			{
+				return false;
+			}
+
+			const uint32 PolyIdx = NavMesh.decodePolyIdPoly(ref);
+			if (tile->polyClusters == nullptr || PolyIdx >= (uint32)tile->header->offMeshBase)
+			{
+				return true;
+			}
+
+			return Clusters.Contains(NavMesh.getClusterRefBase(tile) | tile->polyClusters[PolyIdx]);
+		}
+
+		virtual float getVirtualCost(const float* pa, const float* pb,
+			const dtPolyRef prevRef, const dtMeshTile* prevTile, const dtPoly* prevPoly,
+			const dtPolyRef curRef, const dtMeshTile* curTile, const dtPoly* curPoly,
+			const dtPolyRef nextRef, const dtMeshTile* nextTile, const dtPoly* nextPoly) const override
+		{
+			return SourceFilter.getCost(pa, pb, prevRef, prevTile, prevPoly, curRef, curTile, curPoly, nextRef, nextTile, nextPoly);
+		}
+
+	private:
+		const dtNavMesh& NavMesh;
+		const dtQueryFilter& SourceFilter;
+		const TSet<dtClusterRef>& Clusters;
+	};
+
+	/** A* over cluster centers, ignores filters just like dtNavMeshQuery::testClusterPath. Fills OutCorridor with clusters of found path and their direct neighbours. */
+	bool FindCorridor(const dtNavMesh& NavMesh, dtClusterRef StartRef, dtClusterRef EndRef, int32 MaxNodes, TSet<dtClusterRef>& OutCorridor)
+	{
+		const dtCluster* EndCluster = GetCluster(NavMesh, EndRef);
+		if (GetCluster(NavMesh, StartRef) == nullptr || EndCluster == nullptr)
+		{
+			return false;
+		}
+
+		TMap<dtClusterRef, FSearchNode> Nodes;
+		TArray<FOpenEntry> OpenList;
+		Nodes.Add(StartRef, FSearchNode(0, 0.0f));
+		OpenList.HeapPush(FOpenEntry(StartRef, 0.0f));
+
+		bool bFound = false;
+		while (OpenList.Num() > 0)
+		{
+			FOpenEntry Best;
+			OpenList.HeapPop(Best, false);
+
+			FSearchNode& BestNode = Nodes.FindChecked(Best.ClusterRef);
+			if (BestNode.bClosed)
+			{
+				continue;
+			}
+			BestNode.bClosed = true;
+
+			if (Best.ClusterRef == EndRef)
+			{
+				bFound = true;
+				break;
+			}
+
+			const float BestCost = BestNode.Cost;
+			const dtMeshTile* Tile = NavMesh.getTileByRef(Best.ClusterRef);
+			const dtCluster& Cluster = Tile->clusters[NavMesh.decodeClusterIdCluster(Best.ClusterRef)];
+
+			for (unsigned int LinkIdx = Cluster.firstLink; LinkIdx != DT_NULL_LINK; LinkIdx = NavMesh.getClusterLink(Tile, LinkIdx).next)
+			{
+				const dtClusterLink& Link = NavMesh.getClusterLink(Tile, LinkIdx);
+				const dtCluster* NeighbourCluster = (Link.flags & DT_CLINK_VALID_FWD) ? GetCluster(NavMesh, Link.ref) : nullptr;
+				if (NeighbourCluster == nullptr)
+				{
+					continue;
+				}
+
+				const float NeighbourCost = BestCost + dtVdist(Cluster.center, NeighbourCluster->center);
+				FSearchNode* NeighbourNode = Nodes.Find(Link.ref);
+				if (NeighbourNode == nullptr)
+				{
+					if (Nodes.Num() >= MaxNodes)
+					{
+						continue;
+					}
+					NeighbourNode = &Nodes.Add(Link.ref, FSearchNode(Best.ClusterRef, NeighbourCost));
+				}
+				else if (NeighbourNode->bClosed || NeighbourNode->Cost <= NeighbourCost)
+				{
+					continue;
+				}
+				else
+				{
+					NeighbourNode->ParentRef = Best.ClusterRef;
+					NeighbourNode->Cost = NeighbourCost;
+				}
+
+				OpenList.HeapPush(FOpenEntry(Link.ref, NeighbourCost + dtVdist(NeighbourCluster->center, EndCluster->center)));
+			}
+		}
+
+		if (!bFound)
+		{
+			return false;
+		}
+
+		for (dtClusterRef ClusterRef = EndRef; ClusterRef != 0; ClusterRef = Nodes.FindChecked(ClusterRef).ParentRef)
+		{
+			OutCorridor.Add(ClusterRef);
+
+			// neighbours give poly search some room around borders of clusters
+			const dtMeshTile* Tile = NavMesh.getTileByRef(ClusterRef);
+			const dtCluster& Cluster = Tile->clusters[NavMesh.decodeClusterIdCluster(ClusterRef)];
+			for (unsigned int LinkIdx = Cluster.firstLink; LinkIdx != DT_NULL_LINK; LinkIdx = NavMesh.getClusterLink(Tile, LinkIdx).next)
+			{
+				OutCorridor.Add(NavMesh.getClusterLink(Tile, LinkIdx).ref);
+			}
+
+			if (ClusterRef == StartRef)
+			{
+				break;
+			}
+		}
+
+		return true;
+	}
+}
+
+ENavigationQueryResult::Type FPImplRecastNavMesh::FindClusterPath(const FVector& StartLoc, const FVector& EndLoc, const float CostLimit, FNavMeshPath& Path, const FNavigationQueryFilter& InQueryFilter, const UObject* Owner) const
+{
+	if (DetourNavMesh == NULL || NavMeshOwner == NULL)
+	{
+		return ENavigationQueryResult::Error;
+	}
+
+	const FRecastQueryFilter* FilterImplementation = (const FRecastQueryFilter*)(InQueryFilter.GetImplementation());
+	const dtQueryFilter* QueryFilter = FilterImplementation ? FilterImplementation->GetAsDetourQueryFilter() : nullptr;
+	if (QueryFilter == NULL)
+	{
+		UE_VLOG(NavMeshOwner, LogNavigation, Warning, TEXT("FPImplRecastNavMesh::FindClusterPath failing due to QueryFilter == NULL"));
+		return ENavigationQueryResult::Error;
+	}
+
+	FRecastSpeciaLinkFilter LinkFilter(FNavigationSystem::GetCurrent<UNavigationSystemV1>(NavMeshOwner->GetWorld()), Owner);
+	INITIALIZE_NAVQUERY(NavQuery, InQueryFilter.GetMaxSearchNodes(), LinkFilter);
+
+	FVector RecastStartPos, RecastEndPos;
+	NavNodeRef StartPolyID, EndPolyID;
+	const bool bCanSearch = InitPathfinding(StartLoc, EndLoc, NavQuery, QueryFilter, RecastStartPos, StartPolyID, RecastEndPos, EndPolyID);
+	if (!bCanSearch)
+	{
+		return ENavigationQueryResult::Error;
+	}
+
+	const dtClusterRef StartClusterRef = GetClusterRefFromPolyRef(StartPolyID);
+	const dtClusterRef EndClusterRef = GetClusterRefFromPolyRef(EndPolyID);
+
+	TSet<dtClusterRef> CorridorClusters;
+	if (StartClusterRef && EndClusterRef &&
+		RecastClusterPath::FindCorridor(*DetourNavMesh, StartClusterRef, EndClusterRef, FMath::TruncToInt(NavMeshOwner->DefaultMaxHierarchicalSearchNodes), CorridorClusters))
+	{
+		const RecastClusterPath::FCorridorFilter CorridorFilter(*DetourNavMesh, *QueryFilter, CorridorClusters);
+
+		dtQueryResult CorridorPathResult;
+		const dtStatus CorridorPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, CostLimit, &CorridorFilter, CorridorPathResult, 0);
+
+		// cluster graph doesn't know about filters, poly search within corridor can still fail
+		if (dtStatusSucceed(CorridorPathStatus) && !dtStatusDetail(CorridorPathStatus, DT_PARTIAL_RESULT))
+		{
+			return PostProcessPathInternal(CorridorPathStatus, Path, NavQuery, QueryFilter, StartPolyID, EndPolyID, RecastStartPos, RecastEndPos, CorridorPathResult);
+		}
+	}
+
+	dtQueryResult PathResult;
+	const dtStatus FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, CostLimit, QueryFilter, PathResult, 0);
+
+	return PostProcessPathInternal(FindPathStatus, Path, NavQuery, QueryFilter, StartPolyID, EndPolyID, RecastStartPos, RecastEndPos, PathResult);
+}
 #endif // WITH_NAVMESH_CLUSTER_LINKS
 
 bool FPImplRecastNavMesh::InitPathfinding(const FVector& UnrealStart, const FVector& UnrealEnd,
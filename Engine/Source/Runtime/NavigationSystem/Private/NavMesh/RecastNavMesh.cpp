@@ -33,13 +33,11 @@
 #if WITH_RECAST
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : FPImplRecastNavMesh::GetWorkerNavQuery(); \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY_WLINKFILTER(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : FPImplRecastNavMesh::GetWorkerNavQuery(); \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes, &LinkFilter);
 
 #endif // WITH_RECAST
@@ -65,6 +63,12 @@ namespace
 
 FNavMeshTileData::FNavData::~FNavData()
 {
+	if (SharedMemory.IsValid())
+	{
+		// owned by shared memory region
+		return;
+	}
+
 #if WITH_RECAST
 	dtFree(RawNavData);
 #else
@@ -95,6 +99,9 @@ uint8* FNavMeshTileData::Release()
 
 	if (NavData.IsValid() && NavData->RawNavData) 
 	{ 
+		// caller takes ownership of returned data, can't give away memory shared with other processes
+		MakeUnique();
+
 		RawData = NavData->RawNavData;
 		NavData->RawNavData = nullptr;
 		DEC_MEMORY_STAT_BY(STAT_Navigation_TileCacheMemory, DataSize);
@@ -107,9 +114,12 @@ uint8* FNavMeshTileData::Release()
 
 void FNavMeshTileData::MakeUnique()
 {
-	if (DataSize > 0 && !NavData.IsUnique())
+	if (DataSize > 0 && (!NavData.IsUnique() || NavData->SharedMemory.IsValid()))
 	{
-		INC_MEMORY_STAT_BY(STAT_Navigation_TileCacheMemory, DataSize);
+		if (!NavData.IsUnique())
+		{
+			INC_MEMORY_STAT_BY(STAT_Navigation_TileCacheMemory, DataSize);
+		}
 #if WITH_RECAST
 		uint8* UniqueRawData = (uint8*)dtAlloc(sizeof(uint8)*DataSize, DT_ALLOC_PERM);
 #else
@@ -335,7 +345,7 @@ ARecastNavMesh::ARecastNavMesh(const FObjectInitializer& ObjectInitializer)
 		INC_DWORD_STAT_BY( STAT_NavigationMemory, sizeof(*this) );
 
 		FindPathImplementation = FindPath;
-		FindHierarchicalPathImplementation = FindPath;
+		FindHierarchicalPathImplementation = FindHierarchicalPath;
 
 		TestPathImplementation = TestPath;
 		TestHierarchicalPathImplementation = TestHierarchicalPath;
@@ -2216,6 +2226,120 @@ FPathFindingResult ARecastNavMesh::FindPath(const FNavAgentProperties& AgentProp
 	return Result;
 }
 
+TSharedPtr<FRecastSlicedPathQuery> ARecastNavMesh::InitSlicedPath(const FPathFindingQuery& Query) const
+{
+	if (RecastNavMeshImpl == NULL || !Query.QueryFilter.IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FRecastSlicedPathQuery> SlicedQuery = MakeShareable(new FRecastSlicedPathQuery(FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()), Query.Owner.Get()));
+	const FVector AdjustedEndLocation = Query.QueryFilter->GetAdjustedEndLocation(Query.EndLocation);
+	if (!RecastNavMeshImpl->InitSlicedFindPath(*SlicedQuery, Query.StartLocation, AdjustedEndLocation, Query.CostLimit, Query.QueryFilter))
+	{
+		return nullptr;
+	}
+
+	return SlicedQuery;
+}
+
+bool ARecastNavMesh::UpdateSlicedPath(FRecastSlicedPathQuery& SlicedQuery, const int32 MaxIterations, int32& DoneIterations) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastPathfinding);
+
+	DoneIterations = 0;
+	return RecastNavMeshImpl == NULL || RecastNavMeshImpl->UpdateSlicedFindPath(SlicedQuery, MaxIterations, DoneIterations);
+}
+
+FPathFindingResult ARecastNavMesh::GetSlicedPathResult(const FRecastSlicedPathQuery& SlicedQuery, const FPathFindingQuery& Query) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastPathfinding);
+
+	FPathFindingResult Result(ENavigationQueryResult::Error);
+	if (RecastNavMeshImpl == NULL)
+	{
+		return Result;
+	}
+
+	// every result gets its own path instance, agents can keep following a partial one while search continues
+	Result.Path = CreatePathInstance<FNavMeshPath>(Query);
+	FNavMeshPath* NavMeshPath = Result.Path.IsValid() ? Result.Path->CastPath<FNavMeshPath>() : nullptr;
+	if (NavMeshPath)
+	{
+		NavMeshPath->ApplyFlags(Query.NavDataFlags);
+
+		Result.Result = RecastNavMeshImpl->GetSlicedFindPathResult(SlicedQuery, *NavMeshPath);
+		if (Result.IsPartial())
+		{
+			Result.Result = Query.bAllowPartialPaths ? ENavigationQueryResult::Success : ENavigationQueryResult::Fail;
+		}
+	}
+
+	return Result;
+}
+
+FPathFindingResult ARecastNavMesh::FindHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query)
+{
+#if WITH_NAVMESH_CLUSTER_LINKS
+	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastPathfinding);
+	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(Pathfinding);
+
+	const ANavigationData* Self = Query.NavData.Get();
+	check(Cast<const ARecastNavMesh>(Self));
+
+	const ARecastNavMesh* RecastNavMesh = (const ARecastNavMesh*)Self;
+	if (Self == NULL || RecastNavMesh->RecastNavMeshImpl == NULL)
+	{
+		return ENavigationQueryResult::Error;
+	}
+
+	FPathFindingResult Result(ENavigationQueryResult::Error);
+
+	FNavigationPath* NavPath = Query.PathInstanceToFill.Get();
+	FNavMeshPath* NavMeshPath = NavPath ? NavPath->CastPath<FNavMeshPath>() : nullptr;
+
+	if (NavMeshPath)
+	{
+		Result.Path = Query.PathInstanceToFill;
+		NavMeshPath->ResetForRepath();
+	}
+	else
+	{
+		Result.Path = Self->CreatePathInstance<FNavMeshPath>(Query);
+		NavPath = Result.Path.Get();
+		NavMeshPath = NavPath ? NavPath->CastPath<FNavMeshPath>() : nullptr;
+	}
+
+	const FNavigationQueryFilter* NavFilter = Query.QueryFilter.Get();
+	if (NavMeshPath && NavFilter)
+	{
+		NavMeshPath->ApplyFlags(Query.NavDataFlags);
+
+		const FVector AdjustedEndLocation = NavFilter->GetAdjustedEndLocation(Query.EndLocation);
+		if ((Query.StartLocation - AdjustedEndLocation).IsNearlyZero() == true)
+		{
+			Result.Path->GetPathPoints().Reset();
+			Result.Path->GetPathPoints().Add(FNavPathPoint(AdjustedEndLocation));
+			Result.Result = ENavigationQueryResult::Success;
+		}
+		else
+		{
+			Result.Result = RecastNavMesh->RecastNavMeshImpl->FindClusterPath(Query.StartLocation, AdjustedEndLocation, Query.CostLimit, *NavMeshPath, *NavFilter, Query.Owner.Get());
+
+			const bool bPartialPath = Result.IsPartial();
+			if (bPartialPath)
+			{
+				Result.Result = Query.bAllowPartialPaths ? ENavigationQueryResult::Success : ENavigationQueryResult::Fail;
+			}
+		}
+	}
+
+	return Result;
+#else
+	return FindPath(AgentProperties, Query);
+#endif // WITH_NAVMESH_CLUSTER_LINKS
+}
+
 bool ARecastNavMesh::TestPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastTestPath);
@@ -5,6 +5,8 @@
 #include "Components/PrimitiveComponent.h"
 #include "HAL/FileManager.h"
 #include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
 #include "Serialization/MemoryWriter.h"
 #include "EngineGlobals.h"
 #include "GameFramework/PlayerController.h"
@@ -60,6 +62,18 @@ struct dtTileCacheAlloc;
 static int32 GNavmeshSynchronousTileGeneration = 0;
 static FAutoConsoleVariableRef NavmeshVarSynchronous(TEXT("n.GNavmeshSynchronousTileGeneration"), GNavmeshSynchronousTileGeneration, TEXT(""), ECVF_Default);
 
+static int32 GNavmeshSortTilesWithAIAgents = 1;
+static FAutoConsoleVariableRef NavmeshVarSortTilesWithAIAgents(TEXT("n.NavmeshSortTilesWithAIAgents"), GNavmeshSortTilesWithAIAgents,
+	TEXT("If non-zero, pending dirty tiles are prioritized by distance to AI controlled pawns in addition to players."), ECVF_Default);
+
+static float GNavmeshAsyncTileApplyBudgetMs = 0.f;
+static FAutoConsoleVariableRef NavmeshVarAsyncTileApplyBudgetMs(TEXT("n.NavmeshAsyncTileApplyBudgetMs"), GNavmeshAsyncTileApplyBudgetMs,
+	TEXT("Game thread time budget (in ms) for adding finished async tile generators to navmesh each frame, at least one is always added. 0 means no limit."), ECVF_Default);
+
+static int32 GNavmeshParallelLayerGeneration = 1;
+static FAutoConsoleVariableRef NavmeshVarParallelLayerGeneration(TEXT("n.NavmeshParallelLayerGeneration"), GNavmeshParallelLayerGeneration,
+	TEXT("If non-zero, dirty layers of a tile build their regions, contours and poly meshes in parallel (not used by time sliced generation)."), ECVF_Default);
+
 #if RECAST_INTERNAL_DEBUG_DATA
 static int32 GNavmeshDisplayStep = 0;
 static int32 GNavmeshDebugTileX = MAX_int32;
@@ -3849,6 +3863,7 @@ ETimeSliceWorkResult FRecastTileGenerator::GenerateNavigationDataTimeSliced(FNav
 		GenNavDataTimeSlicedAllocator = MakeUnique<FTileCacheAllocator>();
 		GenNavDataTimeSlicedGenerationContext = MakeUnique<FTileGenerationContext>(GenNavDataTimeSlicedAllocator.Get());
 		GenNavDataTimeSlicedGenerationContext->NavigationData.Reserve(CompressedLayers.Num());
+		SortDynamicAreas();
 		GenerateNavDataTimeSlicedState = EGenerateNavDataTimeSlicedState::GenerateLayers;
 	}//fall through to next state
 	case EGenerateNavDataTimeSlicedState::GenerateLayers:
@@ -3907,21 +3922,66 @@ bool FRecastTileGenerator::GenerateNavigationData(FNavMeshBuildContext& BuildCon
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastBuildNavigation);
 
+	// modifiers are shared by all layers, sort them once before any layer is marked
+	SortDynamicAreas();
+
+	TArray<int32> LayersToGenerate;
+	for (int32 LayerIdx = 0; LayerIdx < CompressedLayers.Num(); LayerIdx++)
+	{
+		// skip layers not marked for rebuild
+		if (DirtyLayers[LayerIdx] && CompressedLayers[LayerIdx].IsValid())
+		{
+			LayersToGenerate.Add(LayerIdx);
+		}
+	}
+
+	bool bGenerateInParallel = GNavmeshParallelLayerGeneration && LayersToGenerate.Num() > 1 && FApp::ShouldUseThreadingForPerformance();
+#if RECAST_INTERNAL_DEBUG_DATA
+	// debug draw steps write to tile's debug data
+	bGenerateInParallel = bGenerateInParallel && GNavmeshDisplayStep == 0;
+#endif
+
+	if (bGenerateInParallel)
+	{
+		// every layer gets its own allocator and intermediate data, results are gathered in layer order
+		TArray<TArray<FNavMeshTileData>> LayerNavigationData;
+		LayerNavigationData.SetNum(LayersToGenerate.Num());
+		TArray<bool> LayerSucceeded;
+		LayerSucceeded.SetNumZeroed(LayersToGenerate.Num());
+
+		ParallelFor(LayersToGenerate.Num(), [&](int32 Index)
+		{
+			FTileCacheAllocator LayerAllocator;
+			FTileGenerationContext LayerContext(&LayerAllocator);
+			FTileCacheCompressor LayerCompressor;
+
+			LayerSucceeded[Index] = GenerateNavigationDataLayer(BuildContext, LayerCompressor, LayerAllocator, LayerContext, LayersToGenerate[Index]);
+			LayerNavigationData[Index] = MoveTemp(LayerContext.NavigationData);
+			LayerContext.ResetIntermediateData();
+		});
+
+		if (LayerSucceeded.Contains(false))
+		{
+			return false;
+		}
+
+		NavigationData.Reset(LayersToGenerate.Num());
+		for (TArray<FNavMeshTileData>& LayerData : LayerNavigationData)
+		{
+			NavigationData.Append(MoveTemp(LayerData));
+		}
+
+		return true;
+	}
+
 	FTileCacheAllocator GenNavAllocator;
 	FTileGenerationContext GenerationContext(&GenNavAllocator);
 	GenerationContext.NavigationData.Reserve(CompressedLayers.Num());
 	FTileCacheCompressor TileCompressor;
 	bool bGenDataLayer = true;
-	dtStatus status = DT_SUCCESS;
 
-	for (int32 LayerIdx = 0; LayerIdx < CompressedLayers.Num(); LayerIdx++)
+	for (const int32 LayerIdx : LayersToGenerate)
 	{
-		if (DirtyLayers[LayerIdx] == false || !CompressedLayers[LayerIdx].IsValid())
-		{
-			// skip layers not marked for rebuild
-			continue;
-		}
-
 		bGenDataLayer = GenerateNavigationDataLayer(BuildContext, TileCompressor, GenNavAllocator, GenerationContext, LayerIdx);
 
 		if (!bGenDataLayer)
@@ -3967,17 +4027,20 @@ void FRecastTileGenerator::ComputeRasterizationMasks(FNavMeshBuildContext& Build
 	}
 }
 
+void FRecastTileGenerator::SortDynamicAreas()
+{
+	if (AdditionalCachedData.bUseSortFunction && AdditionalCachedData.ActorOwner && Modifiers.Num() > 1)
+	{
+		AdditionalCachedData.ActorOwner->SortAreasForGenerator(Modifiers);
+	}
+}
+
 void FRecastTileGenerator::MarkDynamicAreas(dtTileCacheLayer& Layer)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastMarkAreas);
 
 	if (Modifiers.Num())
 	{
-		if (AdditionalCachedData.bUseSortFunction && AdditionalCachedData.ActorOwner && Modifiers.Num() > 1)
-		{
-			AdditionalCachedData.ActorOwner->SortAreasForGenerator(Modifiers);
-		}
-
 		// 1: if navmesh is using low areas, apply only low area replacements
 		if (TileConfig.bMarkLowHeightAreas)
 		{
@@ -5714,6 +5777,19 @@ void FRecastNavMeshGenerator::GetSeedLocations(UWorld& World, TArray<FVector2D>&
 			OutSeedLocations.Add(SeedLoc);
 		}
 	}
+
+	// Collect AI agents positions, tiles around them are needed for their pathfinding
+	if (GNavmeshSortTilesWithAIAgents)
+	{
+		for (FConstControllerIterator ControllerIt = World.GetControllerIterator(); ControllerIt; ++ControllerIt)
+		{
+			AController* Controller = ControllerIt->Get();
+			if (Controller && !Controller->IsPlayerController() && Controller->GetPawn() != NULL)
+			{
+				OutSeedLocations.Add(FVector2D(Controller->GetPawn()->GetActorLocation()));
+			}
+		}
+	}
 }
 
 TSharedRef<FRecastTileGenerator> FRecastNavMeshGenerator::CreateTileGenerator(const FIntPoint& Coord, const TArray<FBox>& DirtyAreas)
@@ -5815,6 +5891,10 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasksAsync(const int32 NumTas
 	}
 	
 	// Collect completed tasks and apply generated data to navmesh
+	const double ApplyStartTime = FPlatformTime::Seconds();
+	const double ApplyBudget = GNavmeshAsyncTileApplyBudgetMs / 1000.0;
+	bool bAppliedAnyTile = false;
+
 	for (int32 Idx = RunningDirtyTiles.Num() - 1; Idx >=0; --Idx)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_RecastNavMeshGenerator_ProcessTileTasks_FinishedTasks);
@@ -5824,6 +5904,13 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasksAsync(const int32 NumTas
 
 		if (Element.AsyncTask->IsDone())
 		{
+			// Remaining finished tasks stay in running list until next frame, which also holds back submitting new ones
+			if (ApplyBudget > 0.0 && bAppliedAnyTile && (FPlatformTime::Seconds() - ApplyStartTime) >= ApplyBudget)
+			{
+				break;
+			}
+			bAppliedAnyTile = true;
+
 			// Add generated tiles to navmesh
 			if (!Element.bShouldDiscard)
 			{
@@ -23,6 +23,8 @@
 #include "UObject/Package.h"
 #include "Components/PrimitiveComponent.h"
 #include "UObject/UObjectThreadContext.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 
 #if WITH_RECAST
 #include "NavMesh/RecastNavMesh.h"
@@ -1244,6 +1246,13 @@ void UNavigationSystemV1::Tick(float DeltaSeconds)
 		AsyncPathFindingQueries.Reset();
 	}
 
+	// Advance sliced pathfinding queries, their results are dispatched along with the async ones
+	if (SlicedPathFindingQueries.Num() > 0)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Navigation_TickAsyncPathfinding);
+		UpdateSlicedQueries(AsyncPathFindingCompletedQueriesToDispatch);
+	}
+
 	// Dispatch async pathfinding queries results from last frame
 	DispatchAsyncQueriesResults(AsyncPathFindingCompletedQueriesToDispatch);
 
@@ -1407,6 +1416,36 @@ uint32 UNavigationSystemV1::FindPathAsync(const FNavAgentProperties& AgentProper
 	return INVALID_NAVQUERYID;
 }
 
+uint32 UNavigationSystemV1::FindPathSliced(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Navigation_RequestingAsyncPathfinding);
+	check(IsInGameThread());
+
+	if (Query.NavData.IsValid() == false)
+	{
+		Query.NavData = GetNavDataForProps(AgentProperties, Query.StartLocation);
+	}
+
+#if WITH_RECAST
+	const ARecastNavMesh* NavMesh = Cast<const ARecastNavMesh>(Query.NavData.Get());
+	if (NavMesh)
+	{
+		if (Query.QueryFilter.IsValid() == false)
+		{
+			Query.QueryFilter = NavMesh->GetDefaultQueryFilter();
+		}
+
+		// query that couldn't be started is kept without search state, its failure gets reported in the next update
+		FAsyncPathFindingQuery AsyncQuery(Query, ResultDelegate, EPathFindingMode::Regular);
+		SlicedPathFindingQueries.Add(FSlicedPathFindingQuery(AsyncQuery, NavMesh->InitSlicedPath(AsyncQuery)));
+
+		return AsyncQuery.QueryID;
+	}
+#endif // WITH_RECAST
+
+	return FindPathAsync(AgentProperties, Query, ResultDelegate);
+}
+
 void UNavigationSystemV1::AbortAsyncFindPathRequest(uint32 AsynPathQueryID)
 {
 	check(IsInGameThread());
@@ -1416,11 +1455,112 @@ void UNavigationSystemV1::AbortAsyncFindPathRequest(uint32 AsynPathQueryID)
 		if (Query->QueryID == AsynPathQueryID)
 		{
 			AsyncPathFindingQueries.RemoveAtSwap(Index);
-			break;
+			return;
+		}
+	}
+
+	for (int32 Index = 0; Index < SlicedPathFindingQueries.Num(); ++Index)
+	{
+		if (SlicedPathFindingQueries[Index].Query.QueryID == AsynPathQueryID)
+		{
+			SlicedPathFindingQueries.RemoveAt(Index);
+			return;
 		}
 	}
 }
 
+static int32 GSlicedPathfindingMaxIterationsPerTick = 2048;
+static FAutoConsoleVariableRef CVarSlicedPathfindingMaxIterationsPerTick(
+	TEXT("ai.nav.SlicedPathfindingMaxIterationsPerTick"),
+	GSlicedPathfindingMaxIterationsPerTick,
+	TEXT("Number of A* iterations shared by all sliced pathfinding queries in a single navigation system update."),
+	ECVF_Default);
+
+static int32 GSlicedPathfindingMaxIterationsPerQuery = 256;
+static FAutoConsoleVariableRef CVarSlicedPathfindingMaxIterationsPerQuery(
+	TEXT("ai.nav.SlicedPathfindingMaxIterationsPerQuery"),
+	GSlicedPathfindingMaxIterationsPerQuery,
+	TEXT("Maximum number of A* iterations done by a single sliced pathfinding query in a single navigation system update."),
+	ECVF_Default);
+
+static int32 GSlicedPathfindingPartialResultInterval = 4;
+static FAutoConsoleVariableRef CVarSlicedPathfindingPartialResultInterval(
+	TEXT("ai.nav.SlicedPathfindingPartialResultInterval"),
+	GSlicedPathfindingPartialResultInterval,
+	TEXT("Number of slices between partial results reported by sliced pathfinding queries still in progress.\n")
+	TEXT("0 reports only the final result."),
+	ECVF_Default);
+
+void UNavigationSystemV1::UpdateSlicedQueries(TArray<FAsyncPathFindingQuery>& OutResultsToDispatch)
+{
+#if WITH_RECAST
+	const int32 NumQueries = SlicedPathFindingQueries.Num();
+	const int32 MaxIterationsPerQuery = FMath::Max(1, GSlicedPathfindingMaxIterationsPerQuery);
+	int32 IterationsLeft = FMath::Max(1, GSlicedPathfindingMaxIterationsPerTick);
+	int32 NumUpdated = 0;
+	TArray<int32, TInlineAllocator<16> > FinishedQueries;
+
+	// round robin, starting with the first query that didn't get any iterations last time
+	for (; NumUpdated < NumQueries && IterationsLeft > 0; ++NumUpdated)
+	{
+		const int32 Index = (NextSlicedPathFindingQuery + NumUpdated) % NumQueries;
+		FSlicedPathFindingQuery& SlicedQuery = SlicedPathFindingQueries[Index];
+
+		// navigation data used by query could have been removed since it was started
+		const ARecastNavMesh* NavMesh = Cast<const ARecastNavMesh>(SlicedQuery.Query.NavData.Get());
+		if (NavMesh == nullptr || !SlicedQuery.SearchState.IsValid())
+		{
+			SlicedQuery.Query.Result = ENavigationQueryResult::Error;
+			OutResultsToDispatch.Add(SlicedQuery.Query);
+			FinishedQueries.Add(Index);
+			continue;
+		}
+
+		int32 DoneIterations = 0;
+		const bool bFinished = NavMesh->UpdateSlicedPath(*SlicedQuery.SearchState, FMath::Min(IterationsLeft, MaxIterationsPerQuery), DoneIterations);
+		IterationsLeft -= FMath::Max(1, DoneIterations);
+		SlicedQuery.NumSlices++;
+
+		if (bFinished)
+		{
+			SlicedQuery.Query.Result = NavMesh->GetSlicedPathResult(*SlicedQuery.SearchState, SlicedQuery.Query);
+			OutResultsToDispatch.Add(SlicedQuery.Query);
+			FinishedQueries.Add(Index);
+		}
+		else if (GSlicedPathfindingPartialResultInterval > 0 && SlicedQuery.NumSlices % GSlicedPathfindingPartialResultInterval == 0)
+		{
+			// partial path to the best node so far, search continues from where it stopped
+			FAsyncPathFindingQuery PartialResult(SlicedQuery.Query);
+			PartialResult.Result = NavMesh->GetSlicedPathResult(*SlicedQuery.SearchState, SlicedQuery.Query);
+			if (PartialResult.Result.IsSuccessful())
+			{
+				OutResultsToDispatch.Add(PartialResult);
+			}
+		}
+	}
+
+	const int32 NextQuery = (NextSlicedPathFindingQuery + NumUpdated) % NumQueries;
+	int32 NumRemovedBeforeNext = 0;
+
+	FinishedQueries.Sort();
+	for (int32 Idx = FinishedQueries.Num() - 1; Idx >= 0; Idx--)
+	{
+		NumRemovedBeforeNext += (FinishedQueries[Idx] < NextQuery) ? 1 : 0;
+		SlicedPathFindingQueries.RemoveAt(FinishedQueries[Idx], 1, false);
+	}
+
+	NextSlicedPathFindingQuery = SlicedPathFindingQueries.Num() > 0 ? (NextQuery - NumRemovedBeforeNext) % SlicedPathFindingQueries.Num() : 0;
+#endif // WITH_RECAST
+}
+
+static int32 GAsyncPathfindingParallelBatchSize = 64;
+static FAutoConsoleVariableRef CVarAsyncPathfindingParallelBatchSize(
+	TEXT("ai.nav.AsyncPathfindingParallelBatchSize"),
+	GAsyncPathfindingParallelBatchSize,
+	TEXT("Number of async pathfinding queries run in parallel before checking for an abort request from the game thread.\n")
+	TEXT("0 runs the queries one after another."),
+	ECVF_Default);
+
 FAutoConsoleTaskPriority CPrio_TriggerAsyncQueries(
 	TEXT("TaskGraph.TaskPriorities.NavTriggerAsyncQueries"),
 	TEXT("Task and thread priority for UNavigationSystemV1::PerformAsyncQueries."),
@@ -1475,12 +1615,13 @@ void UNavigationSystemV1::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> Pat
 		return;
 	}
 
-	int32 NumProcessed = 0;
-	for (FAsyncPathFindingQuery& Query : PathFindingQueries)
+	const ANavigationData* DefaultNavData = GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+
+	auto PerformQuery = [DefaultNavData](FAsyncPathFindingQuery& Query)
 	{
 		// @todo this is not necessarily the safest way to use UObjects outside of main thread. 
 		//	think about something else.
-		const ANavigationData* NavData = Query.NavData.IsValid() ? Query.NavData.Get() : GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+		const ANavigationData* NavData = Query.NavData.IsValid() ? Query.NavData.Get() : DefaultNavData;
 
 		// perform query
 		if (NavData)
@@ -1498,12 +1639,42 @@ void UNavigationSystemV1::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> Pat
 		{
 			Query.Result = ENavigationQueryResult::Error;
 		}
-		++NumProcessed;
+	};
 
-		// Check for abort request from the main tread
-		if (bAbortAsyncQueriesRequested)
+	int32 NumProcessed = 0;
+	if (GAsyncPathfindingParallelBatchSize > 0 && FApp::ShouldUseThreadingForPerformance())
+	{
+		// Queries only read the navigation data and each worker thread reuses its own dtNavMeshQuery
+		while (NumProcessed < PathFindingQueries.Num())
 		{
-			break;
+			const int32 BatchSize = FMath::Min(GAsyncPathfindingParallelBatchSize, PathFindingQueries.Num() - NumProcessed);
+			FAsyncPathFindingQuery* BatchQueries = PathFindingQueries.GetData() + NumProcessed;
+
+			ParallelFor(BatchSize, [&PerformQuery, BatchQueries](int32 Index)
+			{
+				PerformQuery(BatchQueries[Index]);
+			});
+			NumProcessed += BatchSize;
+
+			// Check for abort request from the main tread
+			if (bAbortAsyncQueriesRequested)
+			{
+				break;
+			}
+		}
+	}
+	else
+	{
+		for (FAsyncPathFindingQuery& Query : PathFindingQueries)
+		{
+			PerformQuery(Query);
+			++NumProcessed;
+
+			// Check for abort request from the main tread
+			if (bAbortAsyncQueriesRequested)
+			{
+				break;
+			}
 		}
 	}
 
@@ -32,6 +32,25 @@ class FRecastNavMeshGenerator;
 
 #define RECAST_VERY_SMALL_AGENT_RADIUS 0.0f
 
+/** State of a path search advanced over multiple calls, owns its query object so search can continue on later frames */
+struct FRecastSlicedPathQuery
+{
+	FRecastSlicedPathQuery(UNavigationSystemV1* NavSys, const UObject* Owner) : LinkFilter(NavSys, Owner) {}
+
+	// declared before NavQuery, which keeps a pointer to it
+	FRecastSpeciaLinkFilter LinkFilter;
+	dtNavMeshQuery NavQuery;
+
+	/** keeps detour filter used by NavQuery alive */
+	FSharedConstNavQueryFilter QueryFilter;
+
+	FVector RecastStartPos;
+	FVector RecastEndPos;
+	NavNodeRef StartPolyID = INVALID_NAVNODEREF;
+	NavNodeRef EndPolyID = INVALID_NAVNODEREF;
+	dtStatus Status = DT_FAILURE;
+};
+
 /** Engine Private! - Private Implementation details of ARecastNavMesh */
 class NAVIGATIONSYSTEM_API FPImplRecastNavMesh
 {
@@ -84,6 +103,15 @@ public:
 	/** Generates path from the given query. Synchronous. */
 	ENavigationQueryResult::Type FindPath(const FVector& StartLoc, const FVector& EndLoc, const float CostLimit, FNavMeshPath& Path, const FNavigationQueryFilter& Filter, const UObject* Owner) const;
 
+	/** Starts a path search that is advanced by UpdateSlicedFindPath, returns false if search can't be started */
+	bool InitSlicedFindPath(FRecastSlicedPathQuery& SlicedQuery, const FVector& StartLoc, const FVector& EndLoc, const float CostLimit, FSharedConstNavQueryFilter Filter) const;
+
+	/** Performs up to MaxIterations steps of the search, returns true when search is finished */
+	bool UpdateSlicedFindPath(FRecastSlicedPathQuery& SlicedQuery, const int32 MaxIterations, int32& DoneIterations) const;
+
+	/** Generates path to the best node found so far, it's partial until the search reaches goal */
+	ENavigationQueryResult::Type GetSlicedFindPathResult(const FRecastSlicedPathQuery& SlicedQuery, FNavMeshPath& Path) const;
+
 	/** Check if path exists */
 	ENavigationQueryResult::Type TestPath(const FVector& StartLoc, const FVector& EndLoc, const FNavigationQueryFilter& Filter, const UObject* Owner, int32* NumVisitedNodes = 0) const;
 
@@ -104,6 +132,10 @@ public:
 	/** Check if path exists using cluster graph */
 	ENavigationQueryResult::Type TestClusterPath(const FVector& StartLoc, const FVector& EndLoc, int32* NumVisitedNodes = 0) const;
 
+	/** Generates path by searching the cluster graph first and then refining it on polys of clusters along the way.
+	 *	Falls back to regular poly search when the cluster graph can't connect both ends. */
+	ENavigationQueryResult::Type FindClusterPath(const FVector& StartLoc, const FVector& EndLoc, const float CostLimit, FNavMeshPath& Path, const FNavigationQueryFilter& Filter, const UObject* Owner) const;
+
 	/** Returns a random location on the navmesh within cluster */
 	bool GetRandomPointInCluster(NavNodeRef ClusterRef, FNavLocation& OutLocation) const;
 #endif // WITH_NAVMESH_CLUSTER_LINKS
@@ -244,6 +276,9 @@ public:
 	/** query used for searching data on game thread */
 	mutable dtNavMeshQuery SharedNavQuery;
 
+	/** query used for searching data on the calling worker thread, reused by all the queries done on that thread */
+	static dtNavMeshQuery& GetWorkerNavQuery();
+
 	/** Helper function to serialize a single Recast tile. */
 	static void SerializeRecastMeshTile(FArchive& Ar, int32 NavMeshVersion, unsigned char*& TileData, int32& TileDataSize);
 
@@ -45,6 +45,7 @@ class UPrimitiveComponent;
 class URecastNavMeshDataChunk;
 class ARecastNavMesh;
 struct FRecastAreaNavModifierElement;
+struct FRecastSlicedPathQuery;
 class dtNavMesh;
 class dtQueryFilter;
 class FRecastNavMeshGenerator;
@@ -342,6 +343,9 @@ struct FNavMeshTileData
 	{
 		uint8* RawNavData;
 
+		/** set when RawNavData points into memory shared with other processes, data is not freed and must be copied before modifying */
+		TSharedPtr<struct FRecastSharedTileCacheMemory, ESPMode::ThreadSafe> SharedMemory;
+
 		FNavData(uint8* InNavData) : RawNavData(InNavData) {}
 		~FNavData();
 	};
@@ -383,6 +387,8 @@ struct FNavMeshTileData
 
 	FORCEINLINE bool IsValid() const { return NavData.IsValid() && GetData() != nullptr && DataSize > 0; }
 
+	FORCEINLINE bool IsInSharedMemory() const { return NavData.IsValid() && NavData->SharedMemory.IsValid(); }
+
 	uint8* Release();
 
 	// Duplicate shared state so we will have own copy of the data
@@ -1018,6 +1024,16 @@ public:
 	
 	// @todo docuement
 	static FPathFindingResult FindPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query);
+	/** Plans on the cluster graph first and refines the path on polys of clusters along the way. Same as FindPath without WITH_NAVMESH_CLUSTER_LINKS */
+	static FPathFindingResult FindHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query);
+
+	/** Starts a path search that is advanced in slices by UpdateSlicedPath (e.g. over multiple frames), returns null if search can't be started */
+	TSharedPtr<FRecastSlicedPathQuery> InitSlicedPath(const FPathFindingQuery& Query) const;
+	/** Advances search by up to MaxIterations, returns true when it's finished */
+	bool UpdateSlicedPath(FRecastSlicedPathQuery& SlicedQuery, const int32 MaxIterations, int32& DoneIterations) const;
+	/** Creates path to the best node found so far, it's partial until the search is finished and reached goal */
+	FPathFindingResult GetSlicedPathResult(const FRecastSlicedPathQuery& SlicedQuery, const FPathFindingQuery& Query) const;
+
 	static bool TestPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes);
 	static bool TestHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes);
 	static bool NavMeshRaycast(const ANavigationData* Self, const FVector& RayStart, const FVector& RayEnd, FVector& HitLocation, FSharedConstNavQueryFilter QueryFilter, const UObject* Querier, FRaycastResult& Result);
@@ -382,6 +382,8 @@ protected:
 	void MarkRasterizationMask(rcContext* /*BuildContext*/, rcHeightfield* SolidHF,
 		const FAreaNavModifier& Modifier, const FTransform& LocalToWorld, const int32 Mask, TInlineMaskArray& OutMaskArray);
 
+	/** Sorts modifiers with owner's sort function, done once per tile before layers mark their dynamic areas */
+	void SortDynamicAreas();
 	/** apply areas from DynamicAreas to layer */
 	void MarkDynamicAreas(dtTileCacheLayer& Layer);
 	void MarkDynamicArea(const FAreaNavModifier& Modifier, const FTransform& LocalToWorld, dtTileCacheLayer& Layer);
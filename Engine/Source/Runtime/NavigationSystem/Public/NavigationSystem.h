@@ -38,6 +38,7 @@ class UNavigationPath;
 class UNavigationSystemModuleConfig;
 struct FNavigationRelevantData;
 struct FNavigationOctreeElement;
+struct FRecastSlicedPathQuery;
 
 /** delegate to let interested parties know that new nav area class has been registered */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnNavAreaChanged, const UClass* /*AreaClass*/);
@@ -97,6 +98,20 @@ namespace ENavigationBuildLock
 }
 
 
+/** Async path finding query advanced in slices on game thread, see UNavigationSystemV1::FindPathSliced */
+struct FSlicedPathFindingQuery
+{
+	FAsyncPathFindingQuery Query;
+	TSharedPtr<FRecastSlicedPathQuery> SearchState;
+	int32 NumSlices;
+
+	FSlicedPathFindingQuery(const FAsyncPathFindingQuery& InQuery, const TSharedPtr<FRecastSlicedPathQuery>& InSearchState)
+		: Query(InQuery)
+		, SearchState(InSearchState)
+		, NumSlices(0)
+	{}
+};
+
 class NAVIGATIONSYSTEM_API FNavRegenTimeSlicer
 {
 public:
@@ -506,6 +521,16 @@ public:
 	 */
 	uint32 FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode = EPathFindingMode::Regular);
 
+	/**
+	 *	Asynchronously looks for a path like FindPathAsync, but the search is advanced on game thread in slices limited by ai.nav.SlicedPathfindingMaxIterationsPerTick,
+	 *	so a long query never blocks for its whole duration.
+	 *	If query allows partial paths, ResultDelegate is called with partial paths (IsPartial) every ai.nav.SlicedPathfindingPartialResultInterval slices
+	 *	while search is in progress, so agents can start moving, and once more with the final result. Each call gets a new path instance.
+	 *	Navigation data other than recast navmesh doesn't support slicing, in that case it's a regular FindPathAsync query.
+	 *	@return request ID, can be passed to AbortAsyncFindPathRequest
+	 */
+	uint32 FindPathSliced(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate);
+
 	/** Removes query indicated by given ID from queue of path finding requests to process. */
 	void AbortAsyncFindPathRequest(uint32 AsynPathQueryID);
 	
@@ -986,6 +1011,12 @@ protected:
 	/** Queued async pathfinding results computed by the dedicated task in the last frame and ready to dispatch in the next update. */
 	TArray<FAsyncPathFindingQuery> AsyncPathFindingCompletedQueries;
 
+	/** Sliced pathfinding queries in progress, advanced on game thread. */
+	TArray<FSlicedPathFindingQuery> SlicedPathFindingQueries;
+
+	/** Index of sliced query to update first in the next update, so long searches don't starve the others. */
+	int32 NextSlicedPathFindingQuery = 0;
+
 	/** Graph event that the main thread will wait for to synchronize with the async pathfinding task, if any. */
 	FGraphEventRef AsyncPathFindingTask;
 
@@ -1146,6 +1177,9 @@ protected:
 	/** Broadcasts completion delegate for all completed async pathfinding requests. */
 	void DispatchAsyncQueriesResults(const TArray<FAsyncPathFindingQuery>& PathFindingQueries) const;
 
+	/** Advances sliced pathfinding queries within the per tick iteration budget, collects partial and final results to dispatch. */
+	void UpdateSlicedQueries(TArray<FAsyncPathFindingQuery>& OutResultsToDispatch);
+
 	/**
 	 * Requests the async pathfinding task to abort and waits for it to complete
 	 * before resuming the main thread. Pathfind task will postpone remaining queries to next frame.
@@ -211,6 +211,7 @@ namespace UE4PushModelPrivate
 			{
 				// The macros will take care of filtering out invalid objects, so we don't need to check here.
 				PerObjectStates[ObjectIndex].MarkPropertyDirty(RepIndex);
+				MarkObjectDirtyForTrackers(ObjectIndex);
 			}
 		}
 
@@ -224,6 +225,34 @@ namespace UE4PushModelPrivate
 				{
 					ObjectState.MarkPropertyDirty(RepIndex);
 				}
+				MarkObjectDirtyForTrackers(ObjectIndex);
+			}
+		}
+
+		const int32 AddDirtyObjectTracker()
+		{
+			return DirtyObjectTrackers.Add(TBitArray<>());
+		}
+
+		void RemoveDirtyObjectTracker(const int32 TrackerId)
+		{
+			if (DirtyObjectTrackers.IsValidIndex(TrackerId))
+			{
+				DirtyObjectTrackers.RemoveAt(TrackerId);
+			}
+		}
+
+		void ConsumeDirtyObjects(const int32 TrackerId, TFunctionRef<void(const FNetPushObjectId)> Visitor)
+		{
+			if (DirtyObjectTrackers.IsValidIndex(TrackerId))
+			{
+				TBitArray<>& DirtyObjects = DirtyObjectTrackers[TrackerId];
+				for (TConstSetBitIterator<> It(DirtyObjects); It; ++It)
+				{
+					Visitor(It.GetIndex());
+				}
+
+				DirtyObjects.SetRange(0, DirtyObjects.Num(), false);
 			}
 		}
 
@@ -280,6 +309,7 @@ namespace UE4PushModelPrivate
 			{
 				if (!It->HasAnyNetDriverStates())
 				{
+					ClearObjectDirtyForTrackers(It.GetIndex());
 					ObjectKeyToInternalId.Remove(It->GetObjectKey());
 					It.RemoveCurrent();
 				}
@@ -357,9 +387,41 @@ namespace UE4PushModelPrivate
 
 	private:
 
+		void MarkObjectDirtyForTrackers(const int32 ObjectIndex)
+		{
+			for (TBitArray<>& DirtyObjects : DirtyObjectTrackers)
+			{
+				if (DirtyObjects.Num() <= ObjectIndex)
+				{
+					DirtyObjects.Add(false, ObjectIndex + 1 - DirtyObjects.Num());
+				}
+
+				DirtyObjects[ObjectIndex] = true;
+			}
+		}
+
+		void ClearObjectDirtyForTrackers(const int32 ObjectIndex)
+		{
+			for (TBitArray<>& DirtyObjects : DirtyObjectTrackers)
+			{
+				if (DirtyObjects.IsValidIndex(ObjectIndex))
+				{
+					DirtyObjects[ObjectIndex] = false;
+				}
+			}
+		}
+
 		int32 NewObjectLookupPosition = 0;
 		TMap<FObjectKey, FNetPushObjectId> ObjectKeyToInternalId;
 		TSparseArray<FPushModelPerObjectState> PerObjectStates;
+
+		/**
+		 * One bit per Object ID for every registered tracker, set whenever any property on the Object is marked dirty.
+		 * This lets systems find out which Objects changed in O(dirty) without visiting every Object.
+		 * In practice there is at most one tracker per replicating NetDriver, and none unless a system opts in.
+		 */
+		TSparseArray<TBitArray<>> DirtyObjectTrackers;
+
 		FDelegateHandle PostGarbageCollectHandle;
 	};
 
@@ -435,6 +497,21 @@ namespace UE4PushModelPrivate
 	{
 		return PushObjectManager.ValidateObjectIdReassignment(CurrentId, NewId);
 	}
+
+	const int32 AddDirtyObjectTracker()
+	{
+		return PushObjectManager.AddDirtyObjectTracker();
+	}
+
+	void RemoveDirtyObjectTracker(const int32 TrackerId)
+	{
+		PushObjectManager.RemoveDirtyObjectTracker(TrackerId);
+	}
+
+	void ConsumeDirtyObjects(const int32 TrackerId, TFunctionRef<void(const FNetPushObjectId)> Visitor)
+	{
+		PushObjectManager.ConsumeDirtyObjects(TrackerId, Visitor);
+	}
 }
 
 #endif // WITH_PUSH_MODEL
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/ObjectKey.h"
+#include "Templates/Function.h"
 
 /**
  * Push Model Support for networking.
@@ -377,6 +378,23 @@ namespace UE4PushModelPrivate
 	NETCORE_API class FPushModelPerNetDriverState* GetPerNetDriverState(const FPushModelPerNetDriverHandle Handle);
 
 	NETCORE_API bool ValidateObjectIdReassignment(FNetPushObjectId CurrentId, FNetPushObjectId NewId);
+
+	/**
+	 * Registers a new Dirty Object Tracker.
+	 * From this point on, any Object that has a property marked dirty will be recorded for the tracker
+	 * until the tracker consumes it, which allows iterating only the Objects that actually changed.
+	 *
+	 * @return An ID that should be passed to ConsumeDirtyObjects and RemoveDirtyObjectTracker.
+	 */
+	NETCORE_API const int32 AddDirtyObjectTracker();
+	NETCORE_API void RemoveDirtyObjectTracker(const int32 TrackerId);
+
+	/**
+	 * Calls Visitor for every Object that was marked dirty since the last time this tracker consumed
+	 * its dirty Objects, and then clears the tracker's dirty state.
+	 * This does not affect per property dirty state, so it doesn't change what gets replicated.
+	 */
+	NETCORE_API void ConsumeDirtyObjects(const int32 TrackerId, TFunctionRef<void(const FNetPushObjectId)> Visitor);
 }
 
 
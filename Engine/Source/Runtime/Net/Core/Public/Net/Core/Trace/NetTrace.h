@@ -54,6 +54,9 @@
 */
 #define UE_NET_TRACE_OFFSET_SCOPE(Offset, Collector) UE_NET_TRACE_INTERNAL_OFFSET_SCOPE(Offset, Collector)
 
+/** Scoped cpu timing event with a (possibly dynamic) name, only emitted while net tracing is enabled at the given verbosity */
+#define UE_NET_TRACE_CPU_SCOPE(Name, Verbosity) UE_NET_TRACE_INTERNAL_CPU_SCOPE(Name, Verbosity)
+
 /** Trace event information for a static name */
 #define UE_NET_TRACE(Name, Collector, StartPos, EndPos, Verbosity) UE_NET_TRACE_INTERNAL(Name, Collector, StartPos, EndPos, Verbosity)
 
@@ -130,6 +133,7 @@
 #define UE_NET_TRACE_END_BUNCH(...)
 #define UE_NET_TRACE_BUNCH_SCOPE(...)
 #define UE_NET_TRACE_OFFSET_SCOPE(...)
+#define UE_NET_TRACE_CPU_SCOPE(...)
 
 #define UE_NET_TRACE_ASSIGNED_GUID(...)
 #define UE_NET_TRACE_NETHANDLE_CREATED(...)
@@ -10,6 +10,7 @@
 #include "Net/Core/Trace/NetDebugName.h"
 #include "Misc/NetworkGuid.h"
 #include "Templates/ChooseClass.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 // $TODO: Implement pooling of TraceCollectors
 // $TODO: Add name to game instance
@@ -495,6 +496,49 @@ void FNetTraceCollector::Reset()
 	OffsetStack[0] = 0U;
 }
 
+#if CPUPROFILERTRACE_ENABLED
+/**
+ * Scoped cpu timing event that is only emitted while net tracing is enabled at the requested verbosity, and the cpu channel is enabled.
+ * This allows net trace sessions to attribute replication cpu time next to the reported bandwidth.
+ */
+class FNetTraceCpuEventScope
+{
+public:
+	explicit FNetTraceCpuEventScope(uint32 Verbosity)
+		: bEnabled((GNetTraceRuntimeVerbosity >= Verbosity) && bool(CpuChannel))
+		, bStarted(false)
+	{
+	}
+
+	~FNetTraceCpuEventScope()
+	{
+		if (bStarted)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+	}
+
+	bool IsEnabled() const { return bEnabled; }
+
+	void Begin(const TCHAR* Name)
+	{
+		FCpuProfilerTrace::OutputBeginDynamicEvent(Name);
+		bStarted = true;
+	}
+
+private:
+	bool bEnabled;
+	bool bStarted;
+};
+
+// Name is only evaluated when the scope is enabled, so it is fine to build it dynamically
+#define UE_NET_TRACE_INTERNAL_CPU_SCOPE(Name, Verbosity) \
+	FNetTraceCpuEventScope PREPROCESSOR_JOIN(NetTraceCpuScope, __LINE__)(Verbosity); \
+	if (PREPROCESSOR_JOIN(NetTraceCpuScope, __LINE__).IsEnabled()) { PREPROCESSOR_JOIN(NetTraceCpuScope, __LINE__).Begin(Name); }
+#else
+#define UE_NET_TRACE_INTERNAL_CPU_SCOPE(...)
+#endif
+
 #define UE_NET_TRACE_DO_IF(Cond, x) do { if (Cond) { x; } } while (0)
 
 // Internal macros wrapping all operations
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "HttpNetworkReplayStreaming.h"
+#include "HttpNetworkReplayStreamingJson.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/CommandLine.h"
 #include "Misc/ConfigCacheIni.h"
@@ -47,109 +48,6 @@ static const FString GetUserStringFromUserIndex(const int32 UserIndex)
 	return FString();
 }
 
-class FNetworkReplayListItem : public FJsonSerializable
-{
-public:
-	FNetworkReplayListItem() : SizeInBytes( 0 ), DemoTimeInMs( 0 ), NumViewers( 0 ), bIsLive( false ), Changelist( 0 ), bShouldKeep( false ) {}
-	virtual ~FNetworkReplayListItem() {}
-
-	FString		AppName;
-	FString		SessionName;
-	FString		FriendlyName;
-	FDateTime	Timestamp;
-	int32		SizeInBytes;
-	int32		DemoTimeInMs;
-	int32		NumViewers;
-	bool		bIsLive;
-	int32		Changelist;
-	bool		bShouldKeep;
-
-	// FJsonSerializable
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE( "AppName",		AppName );
-		JSON_SERIALIZE( "SessionName",	SessionName );
-		JSON_SERIALIZE( "FriendlyName",	FriendlyName );
-		JSON_SERIALIZE( "Timestamp",		Timestamp );
-		JSON_SERIALIZE( "SizeInBytes",	SizeInBytes );
-		JSON_SERIALIZE( "DemoTimeInMs",	DemoTimeInMs );
-		JSON_SERIALIZE( "NumViewers",	NumViewers );
-		JSON_SERIALIZE( "bIsLive",		bIsLive );
-		JSON_SERIALIZE( "Changelist",	Changelist );
-		JSON_SERIALIZE( "shouldKeep",	bShouldKeep );
-	END_JSON_SERIALIZER
-};
-
-class FNetworkReplayList : public FJsonSerializable
-{
-public:
-	FNetworkReplayList()
-	{}
-	virtual ~FNetworkReplayList() {}
-
-	TArray< FNetworkReplayListItem > Replays;
-
-	// FJsonSerializable
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE_ARRAY_SERIALIZABLE( "replays", Replays, FNetworkReplayListItem );
-	END_JSON_SERIALIZER
-};
-
-class FNetworkReplayUserList : public FJsonSerializable
-{
-public:
-	FNetworkReplayUserList()
-	{
-	}
-	virtual ~FNetworkReplayUserList()
-	{
-	}
-
-	TArray< FString > Users;
-
-	// FJsonSerializable
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE_ARRAY( "users", Users );
-	END_JSON_SERIALIZER
-};
-
-class FNetworkReplayStartUploadingResponse : public FJsonSerializable
-{
-public:
-	FNetworkReplayStartUploadingResponse()
-	{}
-	virtual ~FNetworkReplayStartUploadingResponse() {}
-
-	FString SessionId;
-
-	// FJsonSerializable
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE("sessionId", SessionId);
-	END_JSON_SERIALIZER
-};
-
-class FNetworkReplayStartDownloadingResponse : public FJsonSerializable
-{
-public:
-	FNetworkReplayStartDownloadingResponse()
-	{}
-	virtual ~FNetworkReplayStartDownloadingResponse() {}
-
-	FString State;
-	FString Viewer;
-	int32 Time;
-	int32 NumChunks;
-	FString Metadata;
-
-	// FJsonSerializable
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE("state", State);
-		JSON_SERIALIZE("numChunks", NumChunks);
-		JSON_SERIALIZE("time", Time);
-		JSON_SERIALIZE("viewerId", Viewer);
-		JSON_SERIALIZE("meta", Metadata);
-	END_JSON_SERIALIZER
-};
-
 void FHttpStreamFArchive::Serialize( void* V, int64 Length ) 
 {
 	if ( IsLoading() )
@@ -2705,6 +2603,33 @@ bool FHttpNetworkReplayStreamer::IsCheckpointTypeSupported(EReplayCheckpointType
 
 IMPLEMENT_MODULE( FHttpNetworkReplayStreamingFactory, HttpNetworkReplayStreaming )
 
+void FHttpNetworkReplayStreamingFactory::StartupModule()
+{
+	uint32 RelayPort = 0;
+	if ( FParse::Value( FCommandLine::Get(), TEXT( "ReplayRelayPort=" ), RelayPort ) )
+	{
+		StartRelay( RelayPort );
+	}
+}
+
+void FHttpNetworkReplayStreamingFactory::ShutdownModule()
+{
+	Relay.Reset();
+}
+
+bool FHttpNetworkReplayStreamingFactory::StartRelay( uint32 Port )
+{
+	Relay = MakeUnique< FHttpReplayRelay >();
+
+	if ( !Relay->Start( Port ) )
+	{
+		Relay.Reset();
+		return false;
+	}
+
+	return true;
+}
+
 TSharedPtr< INetworkReplayStreamer > FHttpNetworkReplayStreamingFactory::CreateReplayStreamer()
 {
 	TSharedPtr< FHttpNetworkReplayStreamer > Streamer( new FHttpNetworkReplayStreamer );
@@ -2733,6 +2658,11 @@ void FHttpNetworkReplayStreamingFactory::Tick( float DeltaTime )
 			HttpStreamers.RemoveAt( i );
 		}
 	}
+
+	if ( Relay.IsValid() )
+	{
+		Relay->Tick( DeltaTime );
+	}
 }
 
 TStatId FHttpNetworkReplayStreamingFactory::GetStatId() const
@@ -0,0 +1,692 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "HttpReplayRelay.h"
+#include "HttpNetworkReplayStreaming.h"
+#include "HttpNetworkReplayStreamingJson.h"
+#include "HttpServerModule.h"
+#include "IHttpRouter.h"
+#include "HttpPath.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "HttpServerConstants.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Guid.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogHttpReplayRelay, Log, All );
+
+static TAutoConsoleVariable<int32> CVarRelayMaxLiveCheckpoints(
+	TEXT( "httpReplay.Relay.MaxLiveCheckpoints" ),
+	0,
+	TEXT( "When > 0, the relay only keeps this many checkpoints of a live session and releases the stream chunks before the oldest one, bounding memory for long broadcasts. " )
+	TEXT( "Viewers can then only scrub back as far as the oldest checkpoint, and delta checkpoints can't be used." ) );
+
+static TAutoConsoleVariable<float> CVarRelayUploadTimeout(
+	TEXT( "httpReplay.Relay.UploadTimeout" ),
+	60.0f,
+	TEXT( "Seconds without uploads after which a live session is considered finished, e.g. when the game server crashed." ) );
+
+static TAutoConsoleVariable<float> CVarRelayViewerTimeout(
+	TEXT( "httpReplay.Relay.ViewerTimeout" ),
+	60.0f,
+	TEXT( "Seconds without a refresh after which a viewer is dropped. Viewers refresh every 10 seconds." ) );
+
+static TAutoConsoleVariable<float> CVarRelayFinishedSessionLifetime(
+	TEXT( "httpReplay.Relay.FinishedSessionLifetime" ),
+	300.0f,
+	TEXT( "Seconds a finished session without viewers is kept before it's dropped." ) );
+
+namespace HttpReplayRelay
+{
+	static const FString CheckpointGroup = TEXT( "checkpoint" );
+	static const FString StreamFilePrefix = TEXT( "stream." );
+	static const FString HeaderFileName = TEXT( "replay.header" );
+
+	/** Chunks can be uploaded again when a request is retried, but never far ahead of the ones already received */
+	static const int32 MaxChunkIndexGap = 64;
+
+	static TUniquePtr<FHttpServerResponse> NotFound()
+	{
+		return FHttpServerResponse::Error( EHttpServerResponseCodes::NotFound );
+	}
+
+	static int32 GetIntParam( const FHttpServerRequest& Request, const TCHAR* Name, int32 DefaultValue = 0 )
+	{
+		const FString* Value = Request.QueryParams.Find( Name );
+		return Value ? FCString::Atoi( **Value ) : DefaultValue;
+	}
+
+	static FString GetStringParam( const FHttpServerRequest& Request, const TCHAR* Name )
+	{
+		const FString* Value = Request.QueryParams.Find( Name );
+		return Value ? *Value : FString();
+	}
+
+	/** The stream state headers FHttpNetworkReplayStreamer reads from every chunk download */
+	static void AddStreamHeaders( FHttpServerResponse& Response, int32 NumChunks, uint32 TimeInMS, bool bLive )
+	{
+		Response.Headers.Add( TEXT( "NumChunks" ), { FString::FromInt( NumChunks ) } );
+		Response.Headers.Add( TEXT( "Time" ), { FString::Printf( TEXT( "%u" ), TimeInMS ) } );
+		Response.Headers.Add( TEXT( "State" ), { bLive ? TEXT( "Live" ) : TEXT( "Final" ) } );
+	}
+}
+
+FHttpReplayRelay::~FHttpReplayRelay()
+{
+	Stop();
+}
+
+bool FHttpReplayRelay::Start( uint32 Port )
+{
+	Stop();
+
+	Router = FHttpServerModule::Get().GetHttpRouter( Port );
+	if ( !Router.IsValid() )
+	{
+		UE_LOG( LogHttpReplayRelay, Error, TEXT( "FHttpReplayRelay::Start. Unable to listen on port %u" ), Port );
+		return false;
+	}
+
+	typedef bool ( FHttpReplayRelay::*FHandler )( const FHttpServerRequest&, const FHttpResultCallback& );
+
+	auto BindRoute = [this]( const TCHAR* Path, EHttpServerRequestVerbs Verb, FHandler Handler )
+	{
+		FHttpRouteHandle Handle = Router->BindRoute( FHttpPath( Path ), Verb, [this, Handler]( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+		{
+			return ( this->*Handler )( Request, OnComplete );
+		} );
+
+		if ( Handle.IsValid() )
+		{
+			RouteHandles.Add( Handle );
+		}
+
+		return Handle.IsValid();
+	};
+
+	bool bBound = true;
+
+	bBound &= BindRoute( TEXT( "/replay" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleStartUploading );
+	bBound &= BindRoute( TEXT( "/replay" ), EHttpServerRequestVerbs::VERB_GET, &FHttpReplayRelay::HandleEnumerateSessions );
+	bBound &= BindRoute( TEXT( "/replay/:session" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleStartUploading );
+	bBound &= BindRoute( TEXT( "/replay/:session/file/:file" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleUploadFile );
+	bBound &= BindRoute( TEXT( "/replay/:session/file/:file" ), EHttpServerRequestVerbs::VERB_GET, &FHttpReplayRelay::HandleDownloadFile );
+	bBound &= BindRoute( TEXT( "/replay/:session/event" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleUploadEvent );
+	bBound &= BindRoute( TEXT( "/replay/:session/event" ), EHttpServerRequestVerbs::VERB_GET, &FHttpReplayRelay::HandleEnumerateEvents );
+	bBound &= BindRoute( TEXT( "/replay/:session/event/:event" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleUploadEvent );
+	bBound &= BindRoute( TEXT( "/replay/:session/stopUploading" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleStopUploading );
+	bBound &= BindRoute( TEXT( "/replay/:session/startDownloading" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleStartDownloading );
+	bBound &= BindRoute( TEXT( "/replay/:session/viewer/:viewer" ), EHttpServerRequestVerbs::VERB_POST, &FHttpReplayRelay::HandleRefreshViewer );
+	bBound &= BindRoute( TEXT( "/event/:event" ), EHttpServerRequestVerbs::VERB_GET, &FHttpReplayRelay::HandleDownloadEvent );
+
+	if ( !bBound )
+	{
+		UE_LOG( LogHttpReplayRelay, Error, TEXT( "FHttpReplayRelay::Start. Unable to bind the relay routes on port %u, are they already bound?" ), Port );
+		Stop();
+		return false;
+	}
+
+	FHttpServerModule::Get().StartAllListeners();
+
+	UE_LOG( LogHttpReplayRelay, Log, TEXT( "FHttpReplayRelay::Start. Relaying replays on port %u" ), Port );
+	return true;
+}
+
+void FHttpReplayRelay::Stop()
+{
+	if ( Router.IsValid() )
+	{
+		for ( const FHttpRouteHandle& Handle : RouteHandles )
+		{
+			Router->UnbindRoute( Handle );
+		}
+	}
+
+	RouteHandles.Empty();
+	Router.Reset();
+
+	Sessions.Empty();
+	EventSessions.Empty();
+}
+
+void FHttpReplayRelay::Tick( float DeltaTime )
+{
+	const double Now = FPlatformTime::Seconds();
+	const double UploadTimeout = CVarRelayUploadTimeout.GetValueOnGameThread();
+	const double ViewerTimeout = CVarRelayViewerTimeout.GetValueOnGameThread();
+	const double FinishedSessionLifetime = CVarRelayFinishedSessionLifetime.GetValueOnGameThread();
+
+	for ( auto SessionIt = Sessions.CreateIterator(); SessionIt; ++SessionIt )
+	{
+		FSession& Session = *SessionIt.Value();
+
+		for ( auto ViewerIt = Session.Viewers.CreateIterator(); ViewerIt; ++ViewerIt )
+		{
+			if ( Now - ViewerIt.Value() > ViewerTimeout )
+			{
+				ViewerIt.RemoveCurrent();
+			}
+		}
+
+		if ( Session.bLive )
+		{
+			if ( Now - Session.LastActivityTime > UploadTimeout )
+			{
+				UE_LOG( LogHttpReplayRelay, Warning, TEXT( "FHttpReplayRelay::Tick. No upload for %s in %.0f seconds, finishing it" ), *Session.Name, UploadTimeout );
+				Session.bLive = false;
+				Session.LastActivityTime = Now;
+			}
+		}
+		else if ( Session.Viewers.Num() == 0 && Now - Session.LastActivityTime > FinishedSessionLifetime )
+		{
+			UE_LOG( LogHttpReplayRelay, Log, TEXT( "FHttpReplayRelay::Tick. Dropping finished session %s" ), *Session.Name );
+
+			for ( const FEvent& Event : Session.Events )
+			{
+				EventSessions.Remove( Event.Id );
+			}
+
+			SessionIt.RemoveCurrent();
+		}
+	}
+}
+
+void FHttpReplayRelay::Dump( FOutputDevice& Ar ) const
+{
+	Ar.Logf( TEXT( "%d relayed sessions" ), Sessions.Num() );
+
+	for ( const TPair<FString, TUniquePtr<FSession>>& Pair : Sessions )
+	{
+		const FSession& Session = *Pair.Value;
+
+		int64 BufferedBytes = Session.Header.Num();
+		int32 NumReleasedChunks = 0;
+
+		for ( const FChunk& Chunk : Session.Chunks )
+		{
+			BufferedBytes += Chunk.Data.Num();
+			NumReleasedChunks += Chunk.bReleased;
+		}
+
+		for ( const FEvent& Event : Session.Events )
+		{
+			BufferedBytes += Event.Data.Num();
+		}
+
+		Ar.Logf( TEXT( "  %s (%s): %s, %.1fs, %d chunks (%d released), %d events, %.1f KB buffered, %d viewers" ),
+			*Session.Name,
+			*Session.FriendlyName,
+			Session.bLive ? TEXT( "Live" ) : TEXT( "Final" ),
+			Session.TimeInMS / 1000.0f,
+			Session.Chunks.Num(),
+			NumReleasedChunks,
+			Session.Events.Num(),
+			BufferedBytes / 1024.0f,
+			Session.Viewers.Num() );
+	}
+}
+
+FHttpReplayRelay::FSession* FHttpReplayRelay::FindSession( const FHttpServerRequest& Request )
+{
+	const FString* SessionName = Request.PathParams.Find( TEXT( "session" ) );
+	const TUniquePtr<FSession>* Session = SessionName ? Sessions.Find( *SessionName ) : nullptr;
+	return Session ? Session->Get() : nullptr;
+}
+
+bool FHttpReplayRelay::HandleStartUploading( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	const FString* CustomName = Request.PathParams.Find( TEXT( "session" ) );
+	const FString SessionName = CustomName ? *CustomName : FGuid::NewGuid().ToString( EGuidFormats::Digits ).ToLower();
+
+	if ( TUniquePtr<FSession>* Existing = Sessions.Find( SessionName ) )
+	{
+		if ( ( *Existing )->bLive )
+		{
+			OnComplete( FHttpServerResponse::Error( EHttpServerResponseCodes::Conflict, TEXT( "SessionLive" ), TEXT( "The session is already being recorded" ) ) );
+			return true;
+		}
+
+		for ( const FEvent& Event : ( *Existing )->Events )
+		{
+			EventSessions.Remove( Event.Id );
+		}
+	}
+
+	TUniquePtr<FSession>& Session = Sessions.Add( SessionName, MakeUnique<FSession>() );
+	Session->Name = SessionName;
+	Session->App = GetStringParam( Request, TEXT( "app" ) );
+	Session->FriendlyName = GetStringParam( Request, TEXT( "friendlyName" ) );
+	Session->Meta = GetStringParam( Request, TEXT( "meta" ) );
+	Session->NetworkVersion = GetIntParam( Request, TEXT( "version" ) );
+	Session->Changelist = GetIntParam( Request, TEXT( "cl" ) );
+	Session->Timestamp = FDateTime::UtcNow();
+	Session->LastActivityTime = FPlatformTime::Seconds();
+
+	UE_LOG( LogHttpReplayRelay, Log, TEXT( "FHttpReplayRelay::HandleStartUploading. Session: %s, App: %s, FriendlyName: %s" ), *SessionName, *Session->App, *Session->FriendlyName );
+
+	FNetworkReplayStartUploadingResponse Response;
+	Response.SessionId = SessionName;
+
+	OnComplete( FHttpServerResponse::Create( Response.ToJson(), TEXT( "application/json" ) ) );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleUploadFile( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	FSession* Session = FindSession( Request );
+	const FString* FileName = Request.PathParams.Find( TEXT( "file" ) );
+
+	if ( !Session || !FileName || !Session->bLive )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	if ( *FileName == HeaderFileName )
+	{
+		Session->Header = Request.Body;
+	}
+	else if ( FileName->StartsWith( StreamFilePrefix ) )
+	{
+		const int32 ChunkIndex = FCString::Atoi( *FileName->RightChop( StreamFilePrefix.Len() ) );
+		if ( ChunkIndex < 0 || ChunkIndex > Session->Chunks.Num() + MaxChunkIndexGap )
+		{
+			OnComplete( FHttpServerResponse::Error( EHttpServerResponseCodes::BadRequest, TEXT( "InvalidChunk" ) ) );
+			return true;
+		}
+
+		if ( ChunkIndex >= Session->Chunks.Num() )
+		{
+			Session->Chunks.SetNum( ChunkIndex + 1 );
+		}
+
+		FChunk& Chunk = Session->Chunks[ChunkIndex];
+		Chunk.Data = Request.Body;
+		Chunk.StartTimeInMS = GetIntParam( Request, TEXT( "mTime1" ) );
+		Chunk.EndTimeInMS = GetIntParam( Request, TEXT( "mTime2" ) );
+		Chunk.bReleased = false;
+
+		Session->SizeInBytes = GetIntParam( Request, TEXT( "absSize" ), Session->SizeInBytes );
+	}
+	else
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	Session->TimeInMS = FMath::Max<uint32>( Session->TimeInMS, GetIntParam( Request, TEXT( "time" ) ) );
+	Session->LastActivityTime = FPlatformTime::Seconds();
+
+	OnComplete( FHttpServerResponse::Ok() );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleDownloadFile( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	FSession* Session = FindSession( Request );
+	const FString* FileName = Request.PathParams.Find( TEXT( "file" ) );
+
+	if ( !Session || !FileName )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	if ( *FileName == HeaderFileName )
+	{
+		if ( Session->Header.Num() == 0 )
+		{
+			OnComplete( NotFound() );
+			return true;
+		}
+
+		TArray<uint8> Header = Session->Header;
+		OnComplete( FHttpServerResponse::Create( MoveTemp( Header ), TEXT( "application/octet-stream" ) ) );
+		return true;
+	}
+
+	if ( !FileName->StartsWith( StreamFilePrefix ) )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	const int32 ChunkIndex = FCString::Atoi( *FileName->RightChop( StreamFilePrefix.Len() ) );
+
+	if ( !Session->Chunks.IsValidIndex( ChunkIndex ) )
+	{
+		if ( Session->bLive && ChunkIndex >= 0 )
+		{
+			// Not uploaded yet, an empty response tells a live viewer to try again later
+			TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create( TArray<uint8>(), TEXT( "application/octet-stream" ) );
+			AddStreamHeaders( *Response, Session->Chunks.Num(), Session->TimeInMS, true );
+			OnComplete( MoveTemp( Response ) );
+		}
+		else
+		{
+			OnComplete( NotFound() );
+		}
+
+		return true;
+	}
+
+	const FChunk& Chunk = Session->Chunks[ChunkIndex];
+	if ( Chunk.bReleased )
+	{
+		OnComplete( FHttpServerResponse::Error( EHttpServerResponseCodes::NotFound, TEXT( "ChunkReleased" ), TEXT( "The chunk is older than the checkpoints kept by the relay" ) ) );
+		return true;
+	}
+
+	TArray<uint8> Data = Chunk.Data;
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create( MoveTemp( Data ), TEXT( "application/octet-stream" ) );
+	AddStreamHeaders( *Response, Session->Chunks.Num(), Session->TimeInMS, Session->bLive );
+	Response->Headers.Add( TEXT( "MTime1" ), { FString::Printf( TEXT( "%u" ), Chunk.StartTimeInMS ) } );
+	Response->Headers.Add( TEXT( "MTime2" ), { FString::Printf( TEXT( "%u" ), Chunk.EndTimeInMS ) } );
+
+	OnComplete( MoveTemp( Response ) );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleUploadEvent( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	FSession* Session = FindSession( Request );
+	if ( !Session )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	// Named events are updated in place, the others get a new id
+	const FString* EventName = Request.PathParams.Find( TEXT( "event" ) );
+	const FString EventId = EventName ? *EventName : FString::Printf( TEXT( "%s_%d" ), *Session->Name, Session->NextEventId++ );
+
+	FEvent* Event = Session->Events.FindByPredicate( [&EventId]( const FEvent& Existing ) { return Existing.Id == EventId; } );
+	if ( !Event )
+	{
+		Event = &Session->Events.AddDefaulted_GetRef();
+		Event->Id = EventId;
+		EventSessions.Add( EventId, Session->Name );
+	}
+
+	Event->Group = GetStringParam( Request, TEXT( "group" ) );
+	Event->Meta = GetStringParam( Request, TEXT( "meta" ) );
+	Event->Time1 = GetIntParam( Request, TEXT( "time1" ) );
+	Event->Time2 = GetIntParam( Request, TEXT( "time2" ) );
+	Event->Data = Request.Body;
+
+	Session->LastActivityTime = FPlatformTime::Seconds();
+
+	const bool bCheckpoint = Event->Group == CheckpointGroup;
+
+	OnComplete( FHttpServerResponse::Ok() );
+
+	const int32 MaxLiveCheckpoints = CVarRelayMaxLiveCheckpoints.GetValueOnGameThread();
+	if ( bCheckpoint && Session->bLive && MaxLiveCheckpoints > 0 )
+	{
+		ReleaseOldData( *Session, MaxLiveCheckpoints );
+	}
+
+	return true;
+}
+
+void FHttpReplayRelay::ReleaseOldData( FSession& Session, int32 MaxCheckpoints )
+{
+	using namespace HttpReplayRelay;
+
+	int32 NumCheckpoints = 0;
+	for ( const FEvent& Event : Session.Events )
+	{
+		NumCheckpoints += Event.Group == CheckpointGroup;
+	}
+
+	int32 NumToRemove = NumCheckpoints - MaxCheckpoints;
+	if ( NumToRemove <= 0 )
+	{
+		return;
+	}
+
+	// Checkpoints are uploaded in order, so the oldest come first
+	for ( int32 EventIndex = 0; EventIndex < Session.Events.Num() && NumToRemove > 0; )
+	{
+		if ( Session.Events[EventIndex].Group == CheckpointGroup )
+		{
+			EventSessions.Remove( Session.Events[EventIndex].Id );
+			Session.Events.RemoveAt( EventIndex );
+			--NumToRemove;
+		}
+		else
+		{
+			++EventIndex;
+		}
+	}
+
+	// The metadata of a checkpoint is the chunk playback continues from after loading it
+	const FEvent* OldestCheckpoint = Session.Events.FindByPredicate( []( const FEvent& Event ) { return Event.Group == CheckpointGroup; } );
+	const int32 FirstNeededChunk = OldestCheckpoint ? FMath::Min( FCString::Atoi( *OldestCheckpoint->Meta ), Session.Chunks.Num() ) : 0;
+
+	for ( int32 ChunkIndex = 0; ChunkIndex < FirstNeededChunk; ++ChunkIndex )
+	{
+		FChunk& Chunk = Session.Chunks[ChunkIndex];
+		if ( !Chunk.bReleased )
+		{
+			Chunk.Data.Empty();
+			Chunk.bReleased = true;
+		}
+	}
+}
+
+bool FHttpReplayRelay::HandleEnumerateEvents( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	FSession* Session = FindSession( Request );
+	if ( !Session )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	const FString Group = GetStringParam( Request, TEXT( "group" ) );
+
+	FReplayEventList EventList;
+
+	for ( const FEvent& Event : Session->Events )
+	{
+		if ( Group.IsEmpty() || Event.Group == Group )
+		{
+			FReplayEventListItem& Item = EventList.ReplayEvents.AddDefaulted_GetRef();
+			Item.ID = Event.Id;
+			Item.Group = Event.Group;
+			Item.Metadata = Event.Meta;
+			Item.Time1 = Event.Time1;
+			Item.Time2 = Event.Time2;
+		}
+	}
+
+	OnComplete( FHttpServerResponse::Create( EventList.ToJson(), TEXT( "application/json" ) ) );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleDownloadEvent( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	const FString* EventId = Request.PathParams.Find( TEXT( "event" ) );
+	const FString* SessionName = EventId ? EventSessions.Find( *EventId ) : nullptr;
+	const TUniquePtr<FSession>* Session = SessionName ? Sessions.Find( *SessionName ) : nullptr;
+	const FEvent* Event = Session ? ( *Session )->Events.FindByPredicate( [EventId]( const FEvent& Existing ) { return Existing.Id == *EventId; } ) : nullptr;
+
+	if ( !Event )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	TArray<uint8> Data = Event->Data;
+	OnComplete( FHttpServerResponse::Create( MoveTemp( Data ), TEXT( "application/octet-stream" ) ) );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleStopUploading( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	FSession* Session = FindSession( Request );
+	if ( !Session )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	Session->bLive = false;
+	Session->TimeInMS = FMath::Max<uint32>( Session->TimeInMS, GetIntParam( Request, TEXT( "time" ) ) );
+	Session->SizeInBytes = GetIntParam( Request, TEXT( "absSize" ), Session->SizeInBytes );
+	Session->LastActivityTime = FPlatformTime::Seconds();
+
+	UE_LOG( LogHttpReplayRelay, Log, TEXT( "FHttpReplayRelay::HandleStopUploading. Session: %s, Chunks: %d, DemoTime: %.1f, Viewers: %d" ), *Session->Name, Session->Chunks.Num(), Session->TimeInMS / 1000.0f, Session->Viewers.Num() );
+
+	OnComplete( FHttpServerResponse::Ok() );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleStartDownloading( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	FSession* Session = FindSession( Request );
+	if ( !Session )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	const FString ViewerName = FString::Printf( TEXT( "viewer%d" ), Session->NextViewerId++ );
+	Session->Viewers.Add( ViewerName, FPlatformTime::Seconds() );
+
+	FNetworkReplayStartDownloadingResponse Response;
+	Response.State = Session->bLive ? TEXT( "Live" ) : TEXT( "Final" );
+	Response.Viewer = ViewerName;
+	Response.Time = Session->TimeInMS;
+	Response.NumChunks = Session->Chunks.Num();
+	Response.Metadata = Session->Meta;
+
+	UE_LOG( LogHttpReplayRelay, Verbose, TEXT( "FHttpReplayRelay::HandleStartDownloading. Session: %s, Viewer: %s, Viewers: %d" ), *Session->Name, *ViewerName, Session->Viewers.Num() );
+
+	OnComplete( FHttpServerResponse::Create( Response.ToJson(), TEXT( "application/json" ) ) );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleRefreshViewer( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	FSession* Session = FindSession( Request );
+	const FString* ViewerName = Request.PathParams.Find( TEXT( "viewer" ) );
+
+	if ( !Session || !ViewerName )
+	{
+		OnComplete( NotFound() );
+		return true;
+	}
+
+	if ( GetStringParam( Request, TEXT( "final" ) ) == TEXT( "true" ) )
+	{
+		Session->Viewers.Remove( *ViewerName );
+	}
+	else
+	{
+		Session->Viewers.Add( *ViewerName, FPlatformTime::Seconds() );
+	}
+
+	if ( !Session->bLive )
+	{
+		Session->LastActivityTime = FPlatformTime::Seconds();
+	}
+
+	OnComplete( FHttpServerResponse::Ok() );
+	return true;
+}
+
+bool FHttpReplayRelay::HandleEnumerateSessions( const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete )
+{
+	using namespace HttpReplayRelay;
+
+	const FString App = GetStringParam( Request, TEXT( "app" ) );
+
+	FNetworkReplayList ReplayList;
+
+	for ( const TPair<FString, TUniquePtr<FSession>>& Pair : Sessions )
+	{
+		const FSession& Session = *Pair.Value;
+		if ( !App.IsEmpty() && Session.App != App )
+		{
+			continue;
+		}
+
+		FNetworkReplayListItem& Item = ReplayList.Replays.AddDefaulted_GetRef();
+		Item.AppName = Session.App;
+		Item.SessionName = Session.Name;
+		Item.FriendlyName = Session.FriendlyName;
+		Item.Timestamp = Session.Timestamp;
+		Item.SizeInBytes = (int32)FMath::Min<int64>( Session.SizeInBytes, MAX_int32 );
+		Item.DemoTimeInMs = Session.TimeInMS;
+		Item.NumViewers = Session.Viewers.Num();
+		Item.bIsLive = Session.bLive;
+		Item.Changelist = Session.Changelist;
+	}
+
+	OnComplete( FHttpServerResponse::Create( ReplayList.ToJson(), TEXT( "application/json" ) ) );
+	return true;
+}
+
+static FHttpNetworkReplayStreamingFactory* GetHttpReplayStreamingFactory()
+{
+	return FModuleManager::GetModulePtr<FHttpNetworkReplayStreamingFactory>( TEXT( "HttpNetworkReplayStreaming" ) );
+}
+
+static FAutoConsoleCommand HttpReplayRelayStartCmd(
+	TEXT( "httpReplay.Relay.Start" ),
+	TEXT( "Starts relaying replays on the given port, so spectators can watch live recordings through this process. Usage: httpReplay.Relay.Start <Port>" ),
+	FConsoleCommandWithArgsDelegate::CreateStatic( []( const TArray<FString>& Args )
+	{
+		FHttpNetworkReplayStreamingFactory* Factory = GetHttpReplayStreamingFactory();
+		if ( Factory && Args.Num() > 0 )
+		{
+			Factory->StartRelay( FCString::Atoi( *Args[0] ) );
+		}
+	} ) );
+
+static FAutoConsoleCommand HttpReplayRelayStopCmd(
+	TEXT( "httpReplay.Relay.Stop" ),
+	TEXT( "Stops relaying replays and drops all relayed sessions" ),
+	FConsoleCommandDelegate::CreateStatic( []()
+	{
+		if ( FHttpNetworkReplayStreamingFactory* Factory = GetHttpReplayStreamingFactory() )
+		{
+			Factory->Relay.Reset();
+		}
+	} ) );
+
+static FAutoConsoleCommandWithOutputDevice HttpReplayRelayDumpCmd(
+	TEXT( "httpReplay.Relay.Dump" ),
+	TEXT( "Logs the sessions relayed by this process" ),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic( []( FOutputDevice& Ar )
+	{
+		FHttpNetworkReplayStreamingFactory* Factory = GetHttpReplayStreamingFactory();
+		if ( Factory && Factory->Relay.IsValid() )
+		{
+			Factory->Relay->Dump( Ar );
+		}
+		else
+		{
+			Ar.Log( TEXT( "Not relaying replays" ) );
+		}
+	} ) );
@@ -6,6 +6,7 @@
 #include "NetworkReplayStreaming.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Tickable.h"
+#include "HttpReplayRelay.h"
 
 class FHttpNetworkReplayStreamer;
 
@@ -386,6 +387,10 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
 class HTTPNETWORKREPLAYSTREAMING_API FHttpNetworkReplayStreamingFactory : public INetworkReplayStreamingFactory, public FTickableGameObject
 {
 public:
+	/** IModuleInterface */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
 	/** INetworkReplayStreamingFactory */
 	virtual TSharedPtr< INetworkReplayStreamer > CreateReplayStreamer() override;
 
@@ -395,5 +400,10 @@ public:
 	virtual TStatId GetStatId() const override;
 	bool IsTickableWhenPaused() const override { return true; }
 
+	/** Starts relaying replays on the port, see FHttpReplayRelay. Started on load with -ReplayRelayPort=N. */
+	bool StartRelay( uint32 Port );
+
 	TArray< TSharedPtr< FHttpNetworkReplayStreamer > > HttpStreamers;
+
+	TUniquePtr< FHttpReplayRelay > Relay;
 };
@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpRouteHandle.h"
+#include "HttpResultCallback.h"
+
+class IHttpRouter;
+struct FHttpServerRequest;
+
+/**
+ * Serves the replay REST protocol spoken by FHttpNetworkReplayStreamer, so a live match can be watched by any number of
+ * spectators without each of them being a connection on the game server.
+ *
+ * The game server records once, pointing httpReplay at the relay, and the relay keeps the uploaded header, stream chunks
+ * and checkpoints in memory. Spectators play the replay back live from the relay: each downloads chunks at its own pace,
+ * and joins or catches up from the latest checkpoint, so the game server cost doesn't depend on the audience size.
+ * The relay starts when the module loads with -ReplayRelayPort=N, or with httpReplay.Relay.Start, and can run in a
+ * dedicated process next to the game servers:
+ *
+ *	; Game server and spectators, DefaultEngine.ini
+ *	[NetworkReplayStreaming]
+ *	DefaultFactoryName=HttpNetworkReplayStreaming
+ *
+ *	[HttpNetworkReplayStreaming]
+ *	ServerURL="http://relay-host:8085/"
+ *
+ * Only what live recording and playback needs is supported, the keep, rename, delete and user routes of a full replay
+ * service aren't, and uploads aren't authenticated so the port shouldn't be reachable from outside for recording.
+ * Sessions are dropped once they finished and no viewer refreshed them for a while.
+ */
+class HTTPNETWORKREPLAYSTREAMING_API FHttpReplayRelay
+{
+public:
+	~FHttpReplayRelay();
+
+	/** Binds the relay routes on the port and starts listening */
+	bool Start(uint32 Port);
+
+	/** Unbinds the routes and drops all sessions */
+	void Stop();
+
+	/** Drops viewers that stopped refreshing, and sessions that finished */
+	void Tick(float DeltaTime);
+
+	/** Logs the sessions with their size and viewer count */
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	struct FChunk
+	{
+		TArray<uint8> Data;
+		uint32 StartTimeInMS = 0;
+		uint32 EndTimeInMS = 0;
+		bool bReleased = false;
+	};
+
+	struct FEvent
+	{
+		FString Id;
+		FString Group;
+		FString Meta;
+		uint32 Time1 = 0;
+		uint32 Time2 = 0;
+		TArray<uint8> Data;
+	};
+
+	struct FSession
+	{
+		FString Name;
+		FString App;
+		FString FriendlyName;
+		FString Meta;
+		uint32 NetworkVersion = 0;
+		uint32 Changelist = 0;
+		FDateTime Timestamp;
+
+		bool bLive = true;
+		TArray<uint8> Header;
+		TArray<FChunk> Chunks;
+		uint32 TimeInMS = 0;
+		int64 SizeInBytes = 0;
+		TArray<FEvent> Events;
+
+		/** Last refresh of each viewer, in FPlatformTime::Seconds */
+		TMap<FString, double> Viewers;
+		int32 NextViewerId = 0;
+		int32 NextEventId = 0;
+
+		/** Last upload, or last viewer refresh once finished */
+		double LastActivityTime = 0.0;
+	};
+
+	bool HandleStartUploading(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleUploadFile(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleDownloadFile(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleUploadEvent(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleEnumerateEvents(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleDownloadEvent(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleStopUploading(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleStartDownloading(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleRefreshViewer(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleEnumerateSessions(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	FSession* FindSession(const FHttpServerRequest& Request);
+
+	/** Keeps the last MaxCheckpoints checkpoints, and releases the chunks before the oldest of them */
+	void ReleaseOldData(FSession& Session, int32 MaxCheckpoints);
+
+	TSharedPtr<IHttpRouter> Router;
+	TArray<FHttpRouteHandle> RouteHandles;
+
+	TMap<FString, TUniquePtr<FSession>> Sessions;
+
+	/** Session owning each event, events are downloaded by id alone */
+	TMap<FString, FString> EventSessions;
+};
@@ -123,6 +123,20 @@ FCurlHttpRequest::FCurlHttpRequest()
 		curl_easy_setopt(EasyHandle, CURLOPT_FORBID_REUSE, 1L);
 	}
 
+#if LIBCURL_VERSION_NUM >= 0x072F00 // 7.47.0, CURL_HTTP_VERSION_2TLS
+	if (FCurlHttpManager::CurlRequestOptions.bUseHttp2)
+	{
+		// negotiate HTTP/2 via ALPN for https (falls back to HTTP/1.1), and wait for an existing connection to multiplex on rather than opening a new one
+		curl_easy_setopt(EasyHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		curl_easy_setopt(EasyHandle, CURLOPT_PIPEWAIT, 1L);
+	}
+#endif
+
+	if (FCurlHttpManager::CurlRequestOptions.bEnableTcpKeepAlive)
+	{
+		curl_easy_setopt(EasyHandle, CURLOPT_TCP_KEEPALIVE, 1L);
+	}
+
 #if PLATFORM_LINUX && !WITH_SSL
 	static const char* const CertBundlePath = []() -> const char* {
 		static const char * KnownBundlePaths[] =
@@ -247,6 +247,33 @@ void FCurlHttpManager::InitCurl()
 	}
 
 	GConfig->GetBool(TEXT("HTTP.Curl"), TEXT("bAllowSeekFunction"), CurlRequestOptions.bAllowSeekFunction, GEngineIni);
+	GConfig->GetBool(TEXT("HTTP.Curl"), TEXT("bEnableTcpKeepAlive"), CurlRequestOptions.bEnableTcpKeepAlive, GEngineIni);
+
+	GConfig->GetBool(TEXT("HTTP.Curl"), TEXT("bUseHttp2"), CurlRequestOptions.bUseHttp2, GEngineIni);
+	if (CurlRequestOptions.bUseHttp2)
+	{
+#if LIBCURL_VERSION_NUM >= 0x072F00 // 7.47.0, CURL_HTTP_VERSION_2TLS
+		curl_version_info_data* VersionInfo = curl_version_info(CURLVERSION_NOW);
+		if (VersionInfo && (VersionInfo->features & CURL_VERSION_HTTP2))
+		{
+			const CURLMcode SetOptResult = curl_multi_setopt(GMultiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+			if (SetOptResult != CURLM_OK)
+			{
+				FUTF8ToTCHAR Converter(curl_multi_strerror(SetOptResult));
+				UE_LOG(LogInit, Warning, TEXT("Failed to enable HTTP/2 multiplexing, error %d ('%s')"), (int32)SetOptResult, Converter.Get());
+				CurlRequestOptions.bUseHttp2 = false;
+			}
+		}
+		else
+		{
+			UE_LOG(LogInit, Warning, TEXT("bUseHttp2 is set but libcurl was built without HTTP/2 support"));
+			CurlRequestOptions.bUseHttp2 = false;
+		}
+#else
+		UE_LOG(LogInit, Warning, TEXT("bUseHttp2 is set but this libcurl version is too old to support it"));
+		CurlRequestOptions.bUseHttp2 = false;
+#endif
+	}
 
 	CurlRequestOptions.MaxHostConnections = FHttpModule::Get().GetHttpMaxConnectionsPerServer();
 	if (CurlRequestOptions.MaxHostConnections > 0)
@@ -308,6 +335,13 @@ void FCurlHttpManager::FCurlRequestOptions::Log()
 		(MaxHostConnections == 0) ? TEXT("NOT ") : TEXT("")
 		);
 
+	UE_LOG(LogInit, Log, TEXT(" - bUseHttp2 = %s  - Libcurl will %smultiplex requests over HTTP/2"),
+		bUseHttp2 ? TEXT("true") : TEXT("false"),
+		bUseHttp2 ? TEXT("") : TEXT("NOT ")
+		);
+
+	UE_LOG(LogInit, Log, TEXT(" - bEnableTcpKeepAlive = %s"), bEnableTcpKeepAlive ? TEXT("true") : TEXT("false"));
+
 	UE_LOG(LogInit, Log, TEXT(" - LocalHostAddr = %s"), LocalHostAddr.IsEmpty() ? TEXT("Default") : *LocalHostAddr);
 
 	UE_LOG(LogInit, Log, TEXT(" - BufferSize = %d"), CurlRequestOptions.BufferSize);
@@ -54,6 +54,12 @@ public:
 
 		/** Do we allow seeking? */
 		bool bAllowSeekFunction = false;
+
+		/** Negotiate HTTP/2 over TLS and multiplex requests to the same host over a single connection (requires libcurl built with HTTP/2 support) */
+		bool bUseHttp2 = false;
+
+		/** Send TCP keep-alive probes so that pooled idle connections are not silently dropped between requests */
+		bool bEnableTcpKeepAlive = false;
 	}
 	CurlRequestOptions;
 
@@ -23,7 +23,9 @@ DECLARE_CYCLE_STAT(TEXT("CompleteThreadedRequest"), STAT_HTTPThread_CompleteThre
 // FHttpThread
 
 FHttpThread::FHttpThread()
-	:	Thread(nullptr)
+	:	PendingThreadedRequests(ThreadedRequestQueueCapacity)
+	,	CancelledThreadedRequests(ThreadedRequestQueueCapacity)
+	,	Thread(nullptr)
 	,	bIsSingleThread(false)
 	,	bIsStopped(true)
 {
@@ -80,12 +82,18 @@ void FHttpThread::StopThread()
 
 void FHttpThread::AddRequest(IHttpThreadedRequest* Request)
 {
-	PendingThreadedRequests.Enqueue(Request);
+	if (!PendingThreadedRequests.Enqueue(Request))
+	{
+		PendingThreadedRequestsOverflow.Enqueue(Request);
+	}
 }
 
 void FHttpThread::CancelRequest(IHttpThreadedRequest* Request)
 {
-	CancelledThreadedRequests.Enqueue(Request);
+	if (!CancelledThreadedRequests.Enqueue(Request))
+	{
+		CancelledThreadedRequestsOverflow.Enqueue(Request);
+	}
 }
 
 void FHttpThread::GetCompletedRequests(TArray<IHttpThreadedRequest*>& OutCompletedRequests)
@@ -191,16 +199,25 @@ void FHttpThread::Process(TArray<IHttpThreadedRequest*>& RequestsToCancel, TArra
 
 	// cache all cancelled and pending requests
 	{
+		IHttpThreadedRequest* Batch[64];
 		IHttpThreadedRequest* Request = nullptr;
 
 		RequestsToCancel.Reset();
-		while (CancelledThreadedRequests.Dequeue(Request))
+		while (uint32 NumDequeued = CancelledThreadedRequests.DequeueBatch(Batch, UE_ARRAY_COUNT(Batch)))
+		{
+			RequestsToCancel.Append(Batch, NumDequeued);
+		}
+		while (CancelledThreadedRequestsOverflow.Dequeue(Request))
 		{
 			RequestsToCancel.Add(Request);
 		}
 
 		RequestsToStart.Reset();
-		while (PendingThreadedRequests.Dequeue(Request))
+		while (uint32 NumDequeued = PendingThreadedRequests.DequeueBatch(Batch, UE_ARRAY_COUNT(Batch)))
+		{
+			RequestsToStart.Append(Batch, NumDequeued);
+		}
+		while (PendingThreadedRequestsOverflow.Dequeue(Request))
 		{
 			RequestsToStart.Add(Request);
 		}
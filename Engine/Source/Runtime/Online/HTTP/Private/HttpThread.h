@@ -8,6 +8,7 @@
 #include "HttpPackage.h"
 #include "Misc/SingleThreadRunnable.h"
 #include "Containers/Queue.h"
+#include "Containers/BoundedMpmcQueue.h"
 
 class IHttpThreadedRequest;
 
@@ -120,17 +121,27 @@ protected:
 	double LastTime;
 
 protected:
+	/** Number of requests the pending and cancelled hand-off rings hold before falling back to their overflow queues. */
+	static constexpr uint32 ThreadedRequestQueueCapacity = 1024;
+
 	/** 
 	 * Threaded requests that are waiting to be processed on the http thread.
 	 * Added to on (any) non-HTTP thread, processed then cleared on HTTP thread.
 	 */
-	TQueue<IHttpThreadedRequest*, EQueueMode::Mpsc> PendingThreadedRequests;
+	TBoundedMpmcQueue<IHttpThreadedRequest*> PendingThreadedRequests;
 
 	/**
 	 * Threaded requests that are waiting to be cancelled on the http thread.
 	 * Added to on (any) non-HTTP thread, processed then cleared on HTTP thread.
 	 */
-	TQueue<IHttpThreadedRequest*, EQueueMode::Mpsc> CancelledThreadedRequests;
+	TBoundedMpmcQueue<IHttpThreadedRequest*> CancelledThreadedRequests;
+
+	/**
+	 * Requests added while PendingThreadedRequests or CancelledThreadedRequests was full, so that adding never blocks
+	 * (the HTTP thread may be ticked by the adding thread itself). Drained after the rings on HTTP thread.
+	 */
+	TQueue<IHttpThreadedRequest*, EQueueMode::Mpsc> PendingThreadedRequestsOverflow;
+	TQueue<IHttpThreadedRequest*, EQueueMode::Mpsc> CancelledThreadedRequestsOverflow;
 
 	/**
 	 * Currently running threaded requests (not in any of the other lists, except potentially CancelledThreadedRequests).
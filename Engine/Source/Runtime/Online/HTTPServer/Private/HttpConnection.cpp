@@ -95,13 +95,11 @@ void FHttpConnection::TransferState(EHttpConnectionState CurrentState, EHttpConn
 
 void FHttpConnection::BeginRead(float DeltaTime)
 {
-	const FTimespan WaitTime = FTimespan::FromMilliseconds(1);
-	if (!Socket->Wait(ESocketWaitConditions::WaitForRead, WaitTime))
+	// Poll without blocking. Every idle keep-alive connection is polled each tick, so even a 1ms wait
+	// here adds up to several milliseconds of game thread time with a handful of open connections.
+	if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::Zero()))
 	{
-		const float SecondsPollingSocketThisFrame = WaitTime.GetTotalSeconds();
-		// We don't add DeltaTime on the first attempt as only 1ms has passed since we started waiting for the socket to be reachable.
-		const float SecondsPollingSocketSinceLastFrame = ReadContext.GetSecondsWaitingForReadableSocket() == 0.f ? SecondsPollingSocketThisFrame : DeltaTime + SecondsPollingSocketThisFrame;
-		ReadContext.AddSecondsWaitingForReadableSocket(SecondsPollingSocketSinceLastFrame);
+		ReadContext.AddSecondsWaitingForReadableSocket(DeltaTime);
 	}
 	else
 	{
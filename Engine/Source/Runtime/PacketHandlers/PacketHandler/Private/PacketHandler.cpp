@@ -52,6 +52,8 @@ PacketHandler::PacketHandler(FDDoSDetection* InDDoS/*=nullptr*/)
 	, HandshakeCompleteDel()
 	, OutgoingPacket()
 	, IncomingPacket()
+	, ProcessedIncomingPacket()
+	, RealignScratchPacket()
 	, HandlerComponents()
 	, MaxPacketBits(0)
 	, State(Handler::State::Uninitialized)
@@ -418,6 +420,8 @@ void PacketHandler::CountBytes(FArchive& Ar) const
 	Ar.CountBytes(sizeof(*this), sizeof(*this));
 	OutgoingPacket.CountMemory(Ar);
 	IncomingPacket.CountMemory(Ar);
+	ProcessedIncomingPacket.CountMemory(Ar);
+	RealignScratchPacket.CountMemory(Ar);
 
 	HandlerComponents.CountBytes(Ar);
 	for (const TSharedPtr<HandlerComponent>& Component : HandlerComponents)
@@ -519,7 +523,10 @@ EIncomingResult PacketHandler::Incoming_Internal(FReceivedPacketView& PacketView
 
 	if (ReturnVal == EIncomingResult::Success)
 	{
-		FBitReader ProcessedPacketReader(DataView.GetMutableData(), CountBits);
+		FBitReader& ProcessedPacketReader = ProcessedIncomingPacket;
+
+		ProcessedPacketReader.SetData(DataView.GetMutableData(), CountBits);
+
 		FIncomingPacketRef PacketRef = {ProcessedPacketReader, PacketView.Address, PacketView.Traits};
 
 		FPacketAudit::CheckStage(TEXT("PostPacketHandler"), ProcessedPacketReader);
@@ -810,19 +817,15 @@ void PacketHandler::ReplaceIncomingPacket(FBitReader& ReplacementPacket)
 {
 	if (ReplacementPacket.GetPosBits() == 0 || ReplacementPacket.GetBitsLeft() == 0)
 	{
-		IncomingPacket = MoveTemp(ReplacementPacket);
+		// Swap instead of move, so the replaced buffer is kept for reuse by the next packet
+		Swap(IncomingPacket, ReplacementPacket);
 	}
 	else
 	{
-		// @todo #JohnB: Make this directly adjust and write into IncomingPacket's buffer, instead of copying - very inefficient
-		TArray<uint8> TempPacketData;
-		TempPacketData.AddUninitialized(ReplacementPacket.GetBytesLeft());
-		TempPacketData[TempPacketData.Num()-1] = 0;
-
 		int64 NewPacketSizeBits = ReplacementPacket.GetBitsLeft();
 
-		ReplacementPacket.SerializeBits(TempPacketData.GetData(), NewPacketSizeBits);
-		IncomingPacket.SetData(MoveTemp(TempPacketData), NewPacketSizeBits);
+		// Copies the unread bits straight into IncomingPacket's (reused) buffer
+		IncomingPacket.SetData(ReplacementPacket, NewPacketSizeBits);
 	}
 }
 
@@ -834,13 +837,10 @@ void PacketHandler::RealignPacket(FBitReader& Packet)
 
 		if (BitsLeft > 0)
 		{
-			// @todo #JohnB: Based on above - when you optimize above, optimize this too
-			TArray<uint8> TempPacketData;
-			TempPacketData.AddUninitialized(Packet.GetBytesLeft());
-			TempPacketData[TempPacketData.Num()-1] = 0;
+			RealignScratchPacket.SetData(Packet, BitsLeft);
 
-			Packet.SerializeBits(TempPacketData.GetData(), BitsLeft);
-			Packet.SetData(MoveTemp(TempPacketData), BitsLeft);
+			// The scratch reader takes the old (unaligned) buffer, ready for reuse next time
+			Swap(Packet, RealignScratchPacket);
 		}
 	}
 }
@@ -632,6 +632,12 @@ private:
 	/** Used for unpacking incoming packets */
 	FBitReader IncomingPacket;
 
+	/** Persistent reader the incoming packet is processed in, swapped with IncomingPacket afterwards so neither reallocates per packet */
+	FBitReader ProcessedIncomingPacket;
+
+	/** Persistent scratch reader for RealignPacket */
+	FBitReader RealignScratchPacket;
+
 	/** The HandlerComponent pipeline, for processing incoming/outgoing packets */
 	TArray<TSharedPtr<HandlerComponent>> HandlerComponents;
 
@@ -5,6 +5,7 @@
 #include "Misc/CoreMisc.h"
 #include "Misc/CommandLine.h"
 #include "Async/AsyncWork.h"
+#include "Async/Async.h"
 #include "Serialization/MemoryReader.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/LowLevelMemTracker.h"
@@ -360,29 +361,33 @@ TMap<FName, TSharedPtr<const struct FPakSignatureFile, ESPMode::ThreadSafe>> FPa
 FCriticalSection FPakPlatformFile::PakSignatureFileCacheLock;
 TSharedPtr<const struct FPakSignatureFile, ESPMode::ThreadSafe> FPakPlatformFile::GetPakSignatureFile(const TCHAR* InFilename)
 {
-	FScopeLock Lock(&PakSignatureFileCacheLock);
-
 	FName FilenameFName(InFilename);
-	if (const TSharedPtr<const struct FPakSignatureFile, ESPMode::ThreadSafe>* SignaturesFile = PakSignatureFileCache.Find(FilenameFName))
-	{
-		return *SignaturesFile;
-	}
 
 	static FRSAKeyHandle PublicKey = InvalidRSAKeyHandle;
-	static bool bInitializedPublicKey = false;
-	if (!bInitializedPublicKey)
 	{
-		FCoreDelegates::FPakSigningKeysDelegate& Delegate = FCoreDelegates::GetPakSigningKeysDelegate();
-		if (Delegate.IsBound())
+		FScopeLock Lock(&PakSignatureFileCacheLock);
+
+		if (const TSharedPtr<const struct FPakSignatureFile, ESPMode::ThreadSafe>* SignaturesFile = PakSignatureFileCache.Find(FilenameFName))
+		{
+			return *SignaturesFile;
+		}
+
+		static bool bInitializedPublicKey = false;
+		if (!bInitializedPublicKey)
 		{
-			TArray<uint8> Exponent;
-			TArray<uint8> Modulus;
-			Delegate.Execute(Exponent, Modulus);
-			PublicKey = FRSA::CreateKey(Exponent, TArray<uint8>(), Modulus);
+			FCoreDelegates::FPakSigningKeysDelegate& Delegate = FCoreDelegates::GetPakSigningKeysDelegate();
+			if (Delegate.IsBound())
+			{
+				TArray<uint8> Exponent;
+				TArray<uint8> Modulus;
+				Delegate.Execute(Exponent, Modulus);
+				PublicKey = FRSA::CreateKey(Exponent, TArray<uint8>(), Modulus);
+			}
+			bInitializedPublicKey = true;
 		}
-		bInitializedPublicKey = true;
 	}
 
+	// Loading and validating happens outside the lock so paks mounted in parallel don't wait on each other's RSA checks
 	TSharedPtr<FPakSignatureFile, ESPMode::ThreadSafe> SignaturesFile;
 
 	if (PublicKey != InvalidRSAKeyHandle)
@@ -402,6 +407,12 @@ TSharedPtr<const struct FPakSignatureFile, ESPMode::ThreadSafe> FPakPlatformFile
 				SignaturesFile.Reset();
 			}
 
+			FScopeLock Lock(&PakSignatureFileCacheLock);
+			if (const TSharedPtr<const struct FPakSignatureFile, ESPMode::ThreadSafe>* ExistingSignaturesFile = PakSignatureFileCache.Find(FilenameFName))
+			{
+				// Another thread got there first, keep a single instance
+				return *ExistingSignaturesFile;
+			}
 			PakSignatureFileCache.Add(FilenameFName, SignaturesFile);
 		}
 		else
@@ -454,6 +465,13 @@ static FAutoConsoleVariableRef CVar_ForceDecompressionFails(
 );
 #endif
 
+static int32 GPakParallelMountThreads = 8;
+static FAutoConsoleVariableRef CVar_PakParallelMountThreads(
+	TEXT("pak.ParallelMountThreads"),
+	GPakParallelMountThreads,
+	TEXT("Number of threads opening paks in parallel when mounting several at once, 1 or less opens them on the calling thread.")
+);
+
 class FPakSizeRequest : public IAsyncReadRequest
 {
 public:
@@ -6593,6 +6611,15 @@ void FPakFile::ValidateDirectorySearch(const TSet<FString>& FullFoundFiles, cons
 }
 #endif
 
+void FPakFile::ReleasePakReaders()
+{
+	FScopeLock ScopedLock(&CriticalSection);
+
+	// The decryptor holds a pointer to the first created pak reader, the next GetSharedReader sets up both again
+	Decryptor.Reset();
+	ReaderMap.Empty();
+}
+
 bool FPakFile::RecreatePakReaders(IPlatformFile* LowerLevel)
 {
 	FScopeLock ScopedLock(&CriticalSection);
@@ -7226,13 +7253,27 @@ void FPakPlatformFile::OptimizeMemoryUsageForMountedPaks()
 
 
 bool FPakPlatformFile::Mount(const TCHAR* InPakFilename, uint32 PakOrder, const TCHAR* InPath /*= NULL*/, bool bLoadIndex /*= true*/)
+{
+	return MountOpenedPak(InPakFilename, OpenPakForMount(InPakFilename, bLoadIndex), PakOrder, InPath);
+}
+
+TRefCountPtr<FPakFile> FPakPlatformFile::OpenPakForMount(const TCHAR* InPakFilename, bool bLoadIndex)
+{
+	TUniquePtr<IFileHandle> PakHandle(LowerLevel->OpenRead(InPakFilename));
+	if (!PakHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	return new FPakFile(LowerLevel, InPakFilename, bSigned, bLoadIndex);
+}
+
+bool FPakPlatformFile::MountOpenedPak(const TCHAR* InPakFilename, TRefCountPtr<FPakFile> Pak, uint32 PakOrder, const TCHAR* InPath)
 {
 	bool bPakSuccess = false;
 	bool bIoStoreSuccess = true;
-	TSharedPtr<IFileHandle> PakHandle = MakeShareable(LowerLevel->OpenRead(InPakFilename));
-	if (PakHandle.IsValid())
+	if (Pak.IsValid())
 	{
-		TRefCountPtr<FPakFile> Pak = new FPakFile(LowerLevel, InPakFilename, bSigned, bLoadIndex);
 		if (Pak.GetReference()->IsValid())
 		{
 			if (!Pak->GetInfo().EncryptionKeyGuid.IsValid() || GetRegisteredEncryptionKeys().HasKey(Pak->GetInfo().EncryptionKeyGuid))
@@ -7294,7 +7335,6 @@ bool FPakPlatformFile::Mount(const TCHAR* InPakFilename, uint32 PakOrder, const
 				Entry.PakchunkIndex = Pak->PakchunkIndex;
 
 				Pak.SafeRelease();
-				PakHandle.Reset();
 				return false;
 			}
 		}
@@ -7498,6 +7538,7 @@ int32 FPakPlatformFile::MountAllPakFiles(const TArray<FString>& PakFolders, cons
 		}
 
 
+		TArray<FString> PakFilesToMount;
 		for (int32 PakFileIndex = 0; PakFileIndex < FoundPakFiles.Num(); PakFileIndex++)
 		{
 			const FString& PakFilename = FoundPakFiles[PakFileIndex];
@@ -7515,12 +7556,55 @@ int32 FPakPlatformFile::MountAllPakFiles(const TArray<FString>& PakFolders, cons
 				continue;
 			}
 
+			PakFilesToMount.Add(PakFilename);
+		}
+
+		// Opening a pak reads its trailer and index and validates its signatures, which is independent for each pak,
+		// so that part runs on worker threads. Adding them to the pak list stays in order on this thread.
+		TArray<TRefCountPtr<FPakFile>> OpenedPakFiles;
+		const int32 NumWorkers = FMath::Min3(GPakParallelMountThreads, FPlatformMisc::NumberOfCoresIncludingHyperthreads(), PakFilesToMount.Num());
+		if (NumWorkers > 1 && FPlatformProcess::SupportsMultithreading())
+		{
+			SCOPED_BOOT_TIMING("Pak_ParallelOpen");
+
+			OpenedPakFiles.SetNum(PakFilesToMount.Num());
+			FThreadSafeCounter NextPakFileIndex;
+
+			// The task graph isn't up yet for the startup paks, plain threads are
+			TArray<TFuture<void>> Workers;
+			for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+			{
+				Workers.Add(Async(EAsyncExecution::Thread, [this, &PakFilesToMount, &OpenedPakFiles, &NextPakFileIndex]()
+				{
+					for (int32 PakFileIndex = NextPakFileIndex.Increment() - 1; PakFileIndex < PakFilesToMount.Num(); PakFileIndex = NextPakFileIndex.Increment() - 1)
+					{
+						TRefCountPtr<FPakFile> Pak = OpenPakForMount(*PakFilesToMount[PakFileIndex], true);
+						if (Pak.IsValid())
+						{
+							// Readers are per thread, don't keep a file handle open for a thread that is about to exit
+							Pak->ReleasePakReaders();
+						}
+						OpenedPakFiles[PakFileIndex] = MoveTemp(Pak);
+					}
+				}));
+			}
+
+			for (TFuture<void>& Worker : Workers)
+			{
+				Worker.Wait();
+			}
+		}
+
+		for (int32 PakFileIndex = 0; PakFileIndex < PakFilesToMount.Num(); PakFileIndex++)
+		{
+			const FString& PakFilename = PakFilesToMount[PakFileIndex];
 			uint32 PakOrder = GetPakOrderFromPakFilePath(PakFilename);
 
 			UE_LOG(LogPakFile, Display, TEXT("Mounting pak file %s."), *PakFilename);
 
 			SCOPED_BOOT_TIMING("Pak_Mount");
-			if (Mount(*PakFilename, PakOrder))
+			TRefCountPtr<FPakFile> Pak = OpenedPakFiles.IsValidIndex(PakFileIndex) ? OpenedPakFiles[PakFileIndex] : OpenPakForMount(*PakFilename, true);
+			if (MountOpenedPak(*PakFilename, MoveTemp(Pak), PakOrder, nullptr))
 			{
 				++NumPakFilesMounted;
 			}
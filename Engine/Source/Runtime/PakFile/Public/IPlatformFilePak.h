@@ -687,6 +687,9 @@ public:
 private:
 	friend class FPakPlatformFile;
 
+	/** Closes the readers of all threads, e.g. those of a worker that opened the pak. The next GetSharedReader opens new ones. */
+	void ReleasePakReaders();
+
 	/** Pak filename. */
 	FString PakFilename;
 	FName PakFilenameName;
@@ -2059,6 +2062,12 @@ class PAKFILE_API FPakPlatformFile : public IPlatformFile
 	*/
 	static int32 GetPakOrderFromPakFilePath(const FString& PakFilePath);
 
+	/** Opens a pak to be mounted, reading its trailer, index and signatures. Safe to call from any thread. */
+	TRefCountPtr<FPakFile> OpenPakForMount(const TCHAR* InPakFilename, bool bLoadIndex);
+
+	/** Adds a pak opened by OpenPakForMount to the mounted paks, or defers it until its encryption key is registered */
+	bool MountOpenedPak(const TCHAR* InPakFilename, TRefCountPtr<FPakFile> Pak, uint32 PakOrder, const TCHAR* InPath);
+
 	/**
 	 * Handler for device delegate to prompt us to load a new pak.	 
 	 */
@@ -12,6 +12,8 @@
 #include "Misc/ConfigCacheIni.h"
 #include "Serialization/JsonWriter.h"
 #include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Misc/ScopeLock.h"
 #include "ZeroLoad.h"
 
 #include "HttpServerModule.h"
@@ -41,6 +43,7 @@ FPerfCounters::~FPerfCounters()
 	{
 		HttpRouter->UnbindRoute(StatsRouteHandle);
 		HttpRouter->UnbindRoute(ExecRouteHandle);
+		HttpRouter->UnbindRoute(MetricsRouteHandle);
 	}
 }
 
@@ -53,6 +56,9 @@ bool FPerfCounters::Initialize()
 	}
 	LastTimeInternalCountersUpdated = FPlatformTime::Seconds() - InternalCountersUpdateInterval * FMath::FRand();	// randomize between servers
 
+	TArray<double> FrameTimeBucketsMs = { 5.0, 10.0, 16.7, 20.0, 25.0, 33.3, 50.0, 66.7, 100.0, 200.0, 500.0, 1000.0 };
+	FrameTimeMetric = CreateMetricHistogram(TEXT("ue_frame_time_ms"), TEXT("Game thread frame time in milliseconds."), FrameTimeBucketsMs, FPerfMetricLabels());
+
 	// get the requested port from the command line (if specified)
 	const int32 StatsPort = IPerfCountersModule::GetHTTPStatsPort();
 	if (StatsPort < 0)
@@ -101,6 +107,21 @@ bool FPerfCounters::Initialize()
 		return false;
 	}
 
+	// Register a handler for /metrics
+	MetricsRouteHandle = HttpRouter->BindRoute(FHttpPath("/metrics"), EHttpServerRequestVerbs::VERB_GET,
+		[WeakThisPtr](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		auto SharedThis = WeakThisPtr.Pin();
+		if (!SharedThis.IsValid()) { return false; }
+		return SharedThis->ProcessMetricsRequest(Request, OnComplete);
+	});
+	if (!MetricsRouteHandle.IsValid())
+	{
+		UE_LOG(LogPerfCounters, Error,
+			TEXT("FPerfCounters unable bind route: /metrics"));
+		return false;
+	}
+
 	return true;
 }
 
@@ -167,6 +188,11 @@ bool FPerfCounters::Tick(float DeltaTime)
 
 	TickSystemCounters(DeltaTime);
 
+	if (FrameTimeMetric.IsValid())
+	{
+		FrameTimeMetric->Observe(DeltaTime * 1000.0);
+	}
+
 	// keep ticking
 	return true;
 }
@@ -270,6 +296,229 @@ bool FPerfCounters::ProcessExecRequest(const FHttpServerRequest& Request, const
 	return true;
 }
 
+bool FPerfCounters::ProcessMetricsRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	auto ResponseBody = GetAllMetricsAsPrometheusText();
+	auto Response = FHttpServerResponse::Create(ResponseBody, TEXT("text/plain; version=0.0.4"));
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+namespace PerfMetrics
+{
+	/** Metric and label names are restricted to [a-zA-Z0-9_] (colons are reserved for recording rules) */
+	static FString SanitizeName(const FString& Name)
+	{
+		FString Result = Name;
+		for (TCHAR& Char : Result)
+		{
+			if (!FChar::IsAlnum(Char) && Char != TEXT('_'))
+			{
+				Char = TEXT('_');
+			}
+		}
+		if (Result.Len() && FChar::IsDigit(Result[0]))
+		{
+			Result.InsertAt(0, TEXT('_'));
+		}
+		return Result;
+	}
+
+	static FString EscapeLabelValue(const FString& Value)
+	{
+		return Value.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\"")).Replace(TEXT("\n"), TEXT("\\n"));
+	}
+
+	/** Formats labels as the contents of the braces, without them, e.g. connection="1.2.3.4:7777" */
+	static FString FormatLabels(const FPerfMetricLabels& Labels)
+	{
+		FString Result;
+		for (const TPair<FString, FString>& Label : Labels)
+		{
+			if (Result.Len())
+			{
+				Result += TEXT(',');
+			}
+			Result += FString::Printf(TEXT("%s=\"%s\""), *SanitizeName(Label.Key), *EscapeLabelValue(Label.Value));
+		}
+		return Result;
+	}
+
+	static FString FormatValue(double Value)
+	{
+		if (FMath::IsNaN(Value))
+		{
+			return TEXT("NaN");
+		}
+		if (!FMath::IsFinite(Value))
+		{
+			return Value > 0.0 ? TEXT("+Inf") : TEXT("-Inf");
+		}
+		return FString::SanitizeFloat(Value);
+	}
+
+	static void WriteSample(FString& Out, const FString& Name, const FString& LabelsText, const FString& Value)
+	{
+		Out += Name;
+		if (LabelsText.Len())
+		{
+			Out += TEXT('{');
+			Out += LabelsText;
+			Out += TEXT('}');
+		}
+		Out += TEXT(' ');
+		Out += Value;
+		Out += TEXT('\n');
+	}
+}
+
+FPerfMetricCounterRef FPerfCounters::CreateMetricCounter(const FString& Name, const FString& Help, const FPerfMetricLabels& Labels)
+{
+	FPerfMetricCounterRef Counter = MakeShared<FPerfMetricCounter, ESPMode::ThreadSafe>();
+
+	FMetricEntry Entry;
+	Entry.Name = Name;
+	Entry.Help = Help;
+	Entry.Type = EMetricType::Counter;
+	Entry.Counter = Counter;
+	AddMetric(MoveTemp(Entry), Labels);
+
+	return Counter;
+}
+
+FPerfMetricGaugeRef FPerfCounters::CreateMetricGauge(const FString& Name, const FString& Help, const FPerfMetricLabels& Labels)
+{
+	FPerfMetricGaugeRef Gauge = MakeShared<FPerfMetricGauge, ESPMode::ThreadSafe>();
+
+	FMetricEntry Entry;
+	Entry.Name = Name;
+	Entry.Help = Help;
+	Entry.Type = EMetricType::Gauge;
+	Entry.Gauge = Gauge;
+	AddMetric(MoveTemp(Entry), Labels);
+
+	return Gauge;
+}
+
+FPerfMetricHistogramRef FPerfCounters::CreateMetricHistogram(const FString& Name, const FString& Help, const TArray<double>& BucketUpperBounds, const FPerfMetricLabels& Labels)
+{
+	FPerfMetricHistogramRef Histogram = MakeShared<FPerfMetricHistogram, ESPMode::ThreadSafe>(BucketUpperBounds);
+
+	FMetricEntry Entry;
+	Entry.Name = Name;
+	Entry.Help = Help;
+	Entry.Type = EMetricType::Histogram;
+	Entry.Histogram = Histogram;
+	AddMetric(MoveTemp(Entry), Labels);
+
+	return Histogram;
+}
+
+void FPerfCounters::AddMetric(FMetricEntry&& Entry, const FPerfMetricLabels& Labels)
+{
+	Entry.Name = PerfMetrics::SanitizeName(Entry.Name);
+	Entry.LabelsText = PerfMetrics::FormatLabels(Labels);
+
+	FScopeLock Lock(&MetricsCritical);
+	Metrics.Add(MoveTemp(Entry));
+}
+
+FString FPerfCounters::GetAllMetricsAsPrometheusText()
+{
+	using namespace PerfMetrics;
+
+	FString Out;
+
+	{
+		FScopeLock Lock(&MetricsCritical);
+
+		// drop metrics whose owners have released them, then group by name since the HELP/TYPE lines may only appear once
+		Metrics.RemoveAll([](const FMetricEntry& Entry)
+		{
+			return !Entry.Counter.IsValid() && !Entry.Gauge.IsValid() && !Entry.Histogram.IsValid();
+		});
+		Metrics.StableSort([](const FMetricEntry& A, const FMetricEntry& B) { return A.Name < B.Name; });
+
+		const FString* PreviousName = nullptr;
+		TArray<uint64> BucketCounts;
+		for (const FMetricEntry& Entry : Metrics)
+		{
+			if (PreviousName == nullptr || *PreviousName != Entry.Name)
+			{
+				static const TCHAR* TypeNames[] = { TEXT("counter"), TEXT("gauge"), TEXT("histogram") };
+				Out += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), *Entry.Name, *Entry.Help.Replace(TEXT("\n"), TEXT(" ")), *Entry.Name, TypeNames[(int32)Entry.Type]);
+				PreviousName = &Entry.Name;
+			}
+
+			switch (Entry.Type)
+			{
+			case EMetricType::Counter:
+				if (auto Counter = Entry.Counter.Pin())
+				{
+					WriteSample(Out, Entry.Name, Entry.LabelsText, LexToString(Counter->GetValue()));
+				}
+				break;
+			case EMetricType::Gauge:
+				if (auto Gauge = Entry.Gauge.Pin())
+				{
+					WriteSample(Out, Entry.Name, Entry.LabelsText, FormatValue(Gauge->GetValue()));
+				}
+				break;
+			case EMetricType::Histogram:
+				if (auto Histogram = Entry.Histogram.Pin())
+				{
+					double Sum;
+					Histogram->GetValues(BucketCounts, Sum);
+
+					const TArray<double>& UpperBounds = Histogram->GetBucketUpperBounds();
+					const FString BucketName = Entry.Name + TEXT("_bucket");
+					const FString BucketLabelsPrefix = Entry.LabelsText.Len() ? Entry.LabelsText + TEXT(",") : FString();
+					uint64 CumulativeCount = 0;
+					for (int32 BucketIndex = 0; BucketIndex < BucketCounts.Num(); ++BucketIndex)
+					{
+						CumulativeCount += BucketCounts[BucketIndex];
+						const FString UpperBound = BucketIndex < UpperBounds.Num() ? FormatValue(UpperBounds[BucketIndex]) : FString(TEXT("+Inf"));
+						WriteSample(Out, BucketName, FString::Printf(TEXT("%sle=\"%s\""), *BucketLabelsPrefix, *UpperBound), LexToString(CumulativeCount));
+					}
+					WriteSample(Out, Entry.Name + TEXT("_sum"), Entry.LabelsText, FormatValue(Sum));
+					WriteSample(Out, Entry.Name + TEXT("_count"), Entry.LabelsText, LexToString(CumulativeCount));
+				}
+				break;
+			}
+		}
+	}
+
+	// numeric perf counters are exposed as gauges so existing counters show up without changes at the call sites
+	for (const auto& It : PerfCounterMap)
+	{
+		if (It.Value.Format == FJsonVariant::Number)
+		{
+			const FString Name = SanitizeName(FString(TEXT("ue_perfcounter_")) + It.Key);
+			Out += FString::Printf(TEXT("# TYPE %s gauge\n"), *Name);
+			WriteSample(Out, Name, FString(), FormatValue(It.Value.NumberValue));
+		}
+	}
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	if (FLowLevelMemTracker::IsEnabled())
+	{
+		FLowLevelMemTracker& MemTracker = FLowLevelMemTracker::Get();
+		Out += TEXT("# HELP ue_llm_memory_bytes Memory tracked by the low level memory tracker, per tag.\n# TYPE ue_llm_memory_bytes gauge\n");
+		for (int32 Tag = 0; Tag < (int32)ELLMTag::GenericTagCount; ++Tag)
+		{
+			const int64 Amount = MemTracker.GetTagAmountForTracker(ELLMTracker::Default, (ELLMTag)Tag);
+			if (Amount != 0)
+			{
+				const FString TagName = MemTracker.FindTagDisplayName((uint64)Tag).ToString();
+				WriteSample(Out, TEXT("ue_llm_memory_bytes"), FString::Printf(TEXT("tag=\"%s\""), *EscapeLabelValue(TagName)), LexToString(Amount));
+			}
+		}
+	}
+#endif // ENABLE_LOW_LEVEL_MEM_TRACKER
+
+	return Out;
+}
+
 double FPerfCounters::GetNumber(const FString& Name, double DefaultValue)
 {
 	FJsonVariant * JsonValue = PerfCounterMap.Find(Name);
@@ -7,6 +7,7 @@
 #include "PerfCountersModule.h"
 #include "Containers/Ticker.h"
 #include "ProfilingDebugging/Histogram.h"
+#include "HAL/CriticalSection.h"
 
 #include "HttpResultCallback.h"
 #include "HttpPath.h"
@@ -57,6 +58,10 @@ public:
 	virtual bool StartMachineLoadTracking(double TickRate, const TArray<double>& FrameTimeHistogramBucketsMs) override;
 	virtual bool StopMachineLoadTracking();
 	virtual bool ReportUnplayableCondition(const FString& ConditionDescription);
+	virtual FPerfMetricCounterRef CreateMetricCounter(const FString& Name, const FString& Help, const FPerfMetricLabels& Labels) override;
+	virtual FPerfMetricGaugeRef CreateMetricGauge(const FString& Name, const FString& Help, const FPerfMetricLabels& Labels) override;
+	virtual FPerfMetricHistogramRef CreateMetricHistogram(const FString& Name, const FString& Help, const TArray<double>& BucketUpperBounds, const FPerfMetricLabels& Labels) override;
+	virtual FString GetAllMetricsAsPrometheusText() override;
 	//~ Begin IPerfCounters Interface end
 
 private:
@@ -82,6 +87,36 @@ private:
 	 */
 	bool ProcessExecRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/**
+	 * Processes a /metrics request
+	 *
+	 * @param Request The incoming request
+	 * @param OnComplete The invokable response result callback
+	 * @return true if this request was handled herein, false otherwise
+	 */
+	bool ProcessMetricsRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	enum class EMetricType : uint8
+	{
+		Counter,
+		Gauge,
+		Histogram,
+	};
+
+	/** Registered metric; only one of the weak pointers is set, according to Type */
+	struct FMetricEntry
+	{
+		FString Name;
+		FString Help;
+		FString LabelsText;
+		EMetricType Type;
+		TWeakPtr<FPerfMetricCounter, ESPMode::ThreadSafe> Counter;
+		TWeakPtr<FPerfMetricGauge, ESPMode::ThreadSafe> Gauge;
+		TWeakPtr<FPerfMetricHistogram, ESPMode::ThreadSafe> Histogram;
+	};
+
+	void AddMetric(FMetricEntry&& Entry, const FPerfMetricLabels& Labels);
+
 	/** Unique name of this instance */
 	FString UniqueInstanceId;
 
@@ -114,4 +149,14 @@ private:
 
 	/** Route handle for /exec binding */
 	FHttpRouteHandle ExecRouteHandle = nullptr;
+
+	/** Route handle for /metrics binding */
+	FHttpRouteHandle MetricsRouteHandle = nullptr;
+
+	/** Registered metrics, guarded by MetricsCritical since they can be created from any thread */
+	TArray<FMetricEntry> Metrics;
+	FCriticalSection MetricsCritical;
+
+	/** Game thread frame time, observed every tick */
+	TSharedPtr<FPerfMetricHistogram, ESPMode::ThreadSafe> FrameTimeMetric;
 };
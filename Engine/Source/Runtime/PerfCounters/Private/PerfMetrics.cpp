@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "PerfMetrics.h"
+
+FPerfMetricCounter::FPerfMetricCounter()
+	: Shards(MakeUnique<TAtomic<uint64>[]>(PerfMetrics::NumShards * PerfMetrics::CountersPerCacheLine))
+{
+}
+
+uint64 FPerfMetricCounter::GetValue() const
+{
+	uint64 Value = 0;
+	for (uint32 ShardIndex = 0; ShardIndex < PerfMetrics::NumShards; ++ShardIndex)
+	{
+		Value += Shards[ShardIndex * PerfMetrics::CountersPerCacheLine].Load(EMemoryOrder::Relaxed);
+	}
+	return Value;
+}
+
+FPerfMetricHistogram::FPerfMetricHistogram(const TArray<double>& InBucketUpperBounds)
+	: BucketUpperBounds(InBucketUpperBounds)
+{
+	BucketUpperBounds.Sort();
+
+	// bucket counts, +Inf count and sum, rounded up to whole cache lines so shards never share one
+	const uint32 NumValues = BucketUpperBounds.Num() + 2;
+	ShardStride = Align(NumValues, (uint32)PerfMetrics::CountersPerCacheLine);
+	Shards = MakeUnique<TAtomic<uint64>[]>(PerfMetrics::NumShards * ShardStride);
+}
+
+void FPerfMetricHistogram::Observe(double Value)
+{
+	// find the first bucket whose upper bound is >= Value; falls through to the +Inf bucket
+	int32 First = 0;
+	int32 Count = BucketUpperBounds.Num();
+	while (Count > 0)
+	{
+		const int32 Step = Count / 2;
+		if (BucketUpperBounds[First + Step] < Value)
+		{
+			First += Step + 1;
+			Count -= Step + 1;
+		}
+		else
+		{
+			Count = Step;
+		}
+	}
+
+	TAtomic<uint64>* Shard = &Shards[PerfMetrics::GetShardIndex() * ShardStride];
+	Shard[First] += 1;
+
+	// the shard is rarely contended so the loop almost always succeeds on the first try
+	TAtomic<uint64>& SumBits = Shard[BucketUpperBounds.Num() + 1];
+	uint64 OldBits = SumBits.Load(EMemoryOrder::Relaxed);
+	for (;;)
+	{
+		double Sum;
+		FMemory::Memcpy(&Sum, &OldBits, sizeof(Sum));
+		Sum += Value;
+
+		uint64 NewBits;
+		FMemory::Memcpy(&NewBits, &Sum, sizeof(NewBits));
+		if (SumBits.CompareExchange(OldBits, NewBits))
+		{
+			break;
+		}
+	}
+}
+
+void FPerfMetricHistogram::GetValues(TArray<uint64>& OutBucketCounts, double& OutSum) const
+{
+	const int32 NumBuckets = BucketUpperBounds.Num() + 1;
+	OutBucketCounts.Reset(NumBuckets);
+	OutBucketCounts.AddZeroed(NumBuckets);
+	OutSum = 0.0;
+
+	for (uint32 ShardIndex = 0; ShardIndex < PerfMetrics::NumShards; ++ShardIndex)
+	{
+		const TAtomic<uint64>* Shard = &Shards[ShardIndex * ShardStride];
+		for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+		{
+			OutBucketCounts[BucketIndex] += Shard[BucketIndex].Load(EMemoryOrder::Relaxed);
+		}
+
+		const uint64 SumBits = Shard[NumBuckets].Load(EMemoryOrder::Relaxed);
+		double Sum;
+		FMemory::Memcpy(&Sum, &SumBits, sizeof(Sum));
+		OutSum += Sum;
+	}
+}
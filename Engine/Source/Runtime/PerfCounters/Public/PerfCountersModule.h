@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
+#include "PerfMetrics.h"
 
 struct FHistogram;
 template <class CharType> struct TPrettyJsonPrintPolicy;
@@ -123,6 +124,21 @@ public:
 	/** Reports an unplayable condition. */
 	virtual bool ReportUnplayableCondition(const FString& ConditionDescription) = 0;
 
+	/**
+	 * Creates a counter exposed on the /metrics route. Metrics stay registered for as long as a reference to them is
+	 * held, so e.g. per-connection metrics go away with their connection. Can be called from any thread.
+	 */
+	virtual FPerfMetricCounterRef CreateMetricCounter(const FString& Name, const FString& Help, const FPerfMetricLabels& Labels = FPerfMetricLabels()) = 0;
+
+	/** Creates a gauge exposed on the /metrics route. */
+	virtual FPerfMetricGaugeRef CreateMetricGauge(const FString& Name, const FString& Help, const FPerfMetricLabels& Labels = FPerfMetricLabels()) = 0;
+
+	/** Creates a histogram exposed on the /metrics route. */
+	virtual FPerfMetricHistogramRef CreateMetricHistogram(const FString& Name, const FString& Help, const TArray<double>& BucketUpperBounds, const FPerfMetricLabels& Labels = FPerfMetricLabels()) = 0;
+
+	/** @return all metrics, numeric perf counters and LLM tag totals in the Prometheus text exposition format */
+	virtual FString GetAllMetricsAsPrometheusText() = 0;
+
 public:
 
 	/** Get overloads */
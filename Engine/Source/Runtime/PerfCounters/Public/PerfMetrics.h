@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTLS.h"
+#include "Templates/Atomic.h"
+#include "Templates/UniquePtr.h"
+
+/** Label name/value pairs which distinguish metrics sharing a name, e.g. { "connection", "1.2.3.4:7777" } */
+typedef TArray<TPair<FString, FString>> FPerfMetricLabels;
+
+/**
+ * Metrics are meant to be updated from hot paths on any thread. Each one is split into a number of cache line
+ * sized shards, picked by thread id, so that updates are a single uncontended atomic add. Shards are only summed
+ * up when the metrics are read (i.e. when /metrics is scraped).
+ */
+namespace PerfMetrics
+{
+	enum { NumShards = 16, CountersPerCacheLine = PLATFORM_CACHE_LINE_SIZE / sizeof(uint64) };
+
+	FORCEINLINE uint32 GetShardIndex()
+	{
+		return FPlatformTLS::GetCurrentThreadId() % NumShards;
+	}
+}
+
+/** Monotonically increasing count, e.g. packets or bytes sent. Exposed as a Prometheus counter. */
+class PERFCOUNTERS_API FPerfMetricCounter
+{
+public:
+	FPerfMetricCounter();
+
+	FORCEINLINE void Add(uint64 Value = 1)
+	{
+		Shards[PerfMetrics::GetShardIndex() * PerfMetrics::CountersPerCacheLine] += Value;
+	}
+
+	uint64 GetValue() const;
+
+private:
+	TUniquePtr<TAtomic<uint64>[]> Shards;
+};
+
+/** Value which can go up and down, e.g. memory in use. Exposed as a Prometheus gauge. */
+class PERFCOUNTERS_API FPerfMetricGauge
+{
+public:
+	FPerfMetricGauge()
+		: ValueBits(0)
+	{
+	}
+
+	FORCEINLINE void Set(double Value)
+	{
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		ValueBits.Store(Bits, EMemoryOrder::Relaxed);
+	}
+
+	FORCEINLINE double GetValue() const
+	{
+		const uint64 Bits = ValueBits.Load(EMemoryOrder::Relaxed);
+		double Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+private:
+	TAtomic<uint64> ValueBits;
+};
+
+/**
+ * Distribution of observed values over fixed buckets, e.g. frame times in milliseconds. Exposed as a Prometheus
+ * histogram, whose buckets are cumulative and can be summed across server instances to compute fleet-wide percentiles.
+ */
+class PERFCOUNTERS_API FPerfMetricHistogram
+{
+public:
+	/** @param InBucketUpperBounds Inclusive upper bound of each bucket, in ascending order. An implicit +Inf bucket is added. */
+	explicit FPerfMetricHistogram(const TArray<double>& InBucketUpperBounds);
+
+	void Observe(double Value);
+
+	const TArray<double>& GetBucketUpperBounds() const { return BucketUpperBounds; }
+
+	/** Returns per bucket (not cumulative) counts, including the +Inf bucket, along with the sum of all observed values. */
+	void GetValues(TArray<uint64>& OutBucketCounts, double& OutSum) const;
+
+private:
+	TArray<double> BucketUpperBounds;
+
+	/** Per shard: one count per bucket (including +Inf) followed by the bits of the double sum, padded to a cache line. */
+	TUniquePtr<TAtomic<uint64>[]> Shards;
+	uint32 ShardStride;
+};
+
+typedef TSharedRef<FPerfMetricCounter, ESPMode::ThreadSafe> FPerfMetricCounterRef;
+typedef TSharedRef<FPerfMetricGauge, ESPMode::ThreadSafe> FPerfMetricGaugeRef;
+typedef TSharedRef<FPerfMetricHistogram, ESPMode::ThreadSafe> FPerfMetricHistogramRef;
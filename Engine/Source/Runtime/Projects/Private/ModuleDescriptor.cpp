@@ -2,6 +2,8 @@
 
 #include "ModuleDescriptor.h"
 #include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
@@ -621,6 +623,38 @@ bool FModuleDescriptor::IsLoadedInCurrentConfiguration() const
 	return false;
 }
 
+/**
+ * Modules started on first use rather than in their loading phase, from the engine config:
+ *
+ *	[ModuleManager]
+ *	+DeferredModules=MyRarelyUsedModule
+ *
+ * Disabled with -NoDeferredModules.
+ */
+static bool IsDeferredModule(FName ModuleName)
+{
+	static TSet<FName> DeferredModuleNames;
+	static bool bInitialized = false;
+
+	// Config may not be up yet for the earliest phases, those just load as usual
+	if (!bInitialized && GConfig && GConfig->IsReadyForUse())
+	{
+		bInitialized = true;
+
+		if (!FParse::Param(FCommandLine::Get(), TEXT("NoDeferredModules")))
+		{
+			TArray<FString> Names;
+			GConfig->GetArray(TEXT("ModuleManager"), TEXT("DeferredModules"), Names, GEngineIni);
+			for (const FString& Name : Names)
+			{
+				DeferredModuleNames.Add(FName(*Name));
+			}
+		}
+	}
+
+	return DeferredModuleNames.Contains(ModuleName);
+}
+
 void FModuleDescriptor::LoadModulesForPhase(ELoadingPhase::Type LoadingPhase, const TArray<FModuleDescriptor>& Modules, TMap<FName, EModuleLoadResult>& ModuleLoadErrors)
 {
 	FScopedSlowTask SlowTask(Modules.Num());
@@ -634,6 +668,12 @@ void FModuleDescriptor::LoadModulesForPhase(ELoadingPhase::Type LoadingPhase, co
 		{
 			if (LoadingPhase == Descriptor.LoadingPhase && Descriptor.IsLoadedInCurrentConfiguration())
 			{
+				if (IsDeferredModule(Descriptor.Name))
+				{
+					FModuleManager::Get().AddDeferredModule(Descriptor.Name);
+					continue;
+				}
+
 				// @todo plugin: DLL search problems.  Plugins that statically depend on other modules within this plugin may not be found?  Need to test this.
 
 				// NOTE: Loading this module may cause other modules to become loaded, both in the engine or game, or other modules 
@@ -334,9 +334,9 @@ int32 FindRayTracingHitGroupIndex(FRayTracingPipelineState* Pipeline, FRHIRayTra
 	return INDEX_NONE;
 }
 
-void SetGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& Initializer, EApplyRendertargetOption ApplyFlags, bool bApplyAdditionalState)
+bool SetGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& Initializer, EApplyRendertargetOption ApplyFlags, bool bApplyAdditionalState, EGraphicsPipelineCacheFlags CacheFlags)
 {
-	FGraphicsPipelineState* PipelineState = PipelineStateCache::GetAndOrCreateGraphicsPipelineState(RHICmdList, Initializer, ApplyFlags);
+	FGraphicsPipelineState* PipelineState = PipelineStateCache::GetAndOrCreateGraphicsPipelineState(RHICmdList, Initializer, ApplyFlags, CacheFlags);
 	if (PipelineState && (PipelineState->RHIPipeline || !Initializer.bFromPSOFileCache))
 	{
 #if PIPELINESTATECACHE_VERIFYTHREADSAFE
@@ -345,7 +345,9 @@ void SetGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipeli
 #endif
 		check(IsInRenderingThread() || IsInParallelRenderingThread());
 		RHICmdList.SetGraphicsPipelineState(PipelineState, Initializer.BoundShaderState, bApplyAdditionalState);
+		return true;
 	}
+	return false;
 }
 
 /* TSharedPipelineStateCache
@@ -1329,7 +1331,7 @@ FRHIComputePipelineState* ExecuteSetComputePipelineState(FComputePipelineState*
 	return ComputePipelineState->RHIPipeline;
 }
 
-FGraphicsPipelineState* PipelineStateCache::GetAndOrCreateGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& OriginalInitializer, EApplyRendertargetOption ApplyFlags)
+FGraphicsPipelineState* PipelineStateCache::GetAndOrCreateGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& OriginalInitializer, EApplyRendertargetOption ApplyFlags, EGraphicsPipelineCacheFlags CacheFlags)
 {
 	LLM_SCOPE(ELLMTag::PSO);
 
@@ -1390,6 +1392,7 @@ FGraphicsPipelineState* PipelineStateCache::GetAndOrCreateGraphicsPipelineState(
 #endif
 
 	bool DoAsyncCompile = IsAsyncCompilationAllowed(RHICmdList);
+	const bool bNonBlocking = DoAsyncCompile && !!(CacheFlags & EGraphicsPipelineCacheFlags::NonBlocking);
 
 	FGraphicsPipelineState* OutCachedState = nullptr;
 
@@ -1407,7 +1410,10 @@ FGraphicsPipelineState* PipelineStateCache::GetAndOrCreateGraphicsPipelineState(
 		if (DoAsyncCompile)
 		{
 			OutCachedState->CompletionEvent = TGraphTask<FCompilePipelineStateTask>::CreateTask().ConstructAndDispatchWhenReady(OutCachedState, *Initializer);
-			RHICmdList.AddDispatchPrerequisite(OutCachedState->CompletionEvent);
+			if (!bNonBlocking)
+			{
+				RHICmdList.AddDispatchPrerequisite(OutCachedState->CompletionEvent);
+			}
 		}
 		else
 		{
@@ -1420,6 +1426,12 @@ FGraphicsPipelineState* PipelineStateCache::GetAndOrCreateGraphicsPipelineState(
 
 		// GGraphicsPipelineCache.Add(*Initializer, OutCachedState, LockFlags);
 		GGraphicsPipelineCache.Add(*Initializer, OutCachedState);
+
+		if (bNonBlocking)
+		{
+			// The pipeline can't be used until its task completes, the caller has to try again later
+			return nullptr;
+		}
 	}
 	else
 	{
@@ -1428,6 +1440,10 @@ FGraphicsPipelineState* PipelineStateCache::GetAndOrCreateGraphicsPipelineState(
 			FGraphEventRef& CompletionEvent = OutCachedState->CompletionEvent;
 			if ( CompletionEvent.IsValid() && !CompletionEvent->IsComplete() )
 			{
+				if (bNonBlocking)
+				{
+					return nullptr;
+				}
 				RHICmdList.AddDispatchPrerequisite(CompletionEvent);
 			}
 		}
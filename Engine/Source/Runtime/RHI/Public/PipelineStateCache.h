@@ -24,6 +24,19 @@ enum class EApplyRendertargetOption : int
 
 ENUM_CLASS_FLAGS(EApplyRendertargetOption);
 
+enum class EGraphicsPipelineCacheFlags : int
+{
+	// Query the pipeline cache, create pipeline if necessary.
+	// Compilation may happen on a task, but RHIThread will block on it before translating the RHICmdList.
+	Default = 0,
+
+	// Query the pipeline cache, create a background task to create the pipeline if necessary.
+	// GetAndOrCreateGraphicsPipelineState() returns NULL until the pipeline is ready, caller must skip the draw and retry later.
+	// Only non-blocking when async pipeline compilation is allowed on the command list, otherwise the pipeline is created immediately.
+	NonBlocking = 1 << 0,
+};
+ENUM_CLASS_FLAGS(EGraphicsPipelineCacheFlags);
+
 enum class ERayTracingPipelineCacheFlags : int
 {
 	// Query the pipeline cache, create pipeline if necessary.
@@ -40,13 +53,15 @@ enum class ERayTracingPipelineCacheFlags : int
 ENUM_CLASS_FLAGS(ERayTracingPipelineCacheFlags);
 
 extern RHI_API void SetComputePipelineState(FRHICommandList& RHICmdList, FRHIComputeShader* ComputeShader);
-extern RHI_API void SetGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& Initializer, EApplyRendertargetOption ApplyFlags = EApplyRendertargetOption::CheckApply, bool bApplyAdditionalState = true);
+// Returns false if the pipeline was not set on the command list, e.g. because it is still compiling in NonBlocking mode.
+extern RHI_API bool SetGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& Initializer, EApplyRendertargetOption ApplyFlags = EApplyRendertargetOption::CheckApply, bool bApplyAdditionalState = true, EGraphicsPipelineCacheFlags CacheFlags = EGraphicsPipelineCacheFlags::Default);
 
 namespace PipelineStateCache
 {
 	extern RHI_API FComputePipelineState*	GetAndOrCreateComputePipelineState(FRHICommandList& RHICmdList, FRHIComputeShader* ComputeShader);
 
-	extern RHI_API FGraphicsPipelineState*	GetAndOrCreateGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& OriginalInitializer, EApplyRendertargetOption ApplyFlags);
+	// May return NULL in non-blocking mode if the pipeline is not compiled yet.
+	extern RHI_API FGraphicsPipelineState*	GetAndOrCreateGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& OriginalInitializer, EApplyRendertargetOption ApplyFlags, EGraphicsPipelineCacheFlags CacheFlags = EGraphicsPipelineCacheFlags::Default);
 
 	extern RHI_API FRHIVertexDeclaration*	GetOrCreateVertexDeclaration(const FVertexDeclarationElementList& Elements);
 
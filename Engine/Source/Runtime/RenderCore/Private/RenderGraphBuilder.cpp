@@ -793,6 +793,132 @@ void FRDGBuilder::Compile()
 		PassesToCull.Init(false, Passes.Num());
 	}
 
+	// In automatic async compute mode, compute passes that can execute on async compute are moved there when enough graphics
+	// passes can run between the previous and next pass using any of their resources. Those are the only passes the async
+	// pass needs to be fenced against, the graphics passes in between overlap with it. The fork / join points and the
+	// cross-pipeline dependencies are established below, after the pipelines are final.
+
+	if (GRDGAsyncCompute == RDG_ASYNC_COMPUTE_AUTO && !GRDGImmediateMode)
+	{
+		SCOPED_NAMED_EVENT(FRDGBuilder_Compile_ScheduleAsyncCompute, FColor::Emerald);
+
+		const auto IsAsyncComputeCandidate = [&](FRDGPassHandle PassHandle)
+		{
+			const FRDGPass* Pass = Passes[PassHandle];
+			return Pass->bAsyncComputeSupported
+				&& !PassesOnAsyncCompute[PassHandle]
+				&& !PassesToCull[PassHandle]
+				&& !PassesWithEmptyParameters[PassHandle]
+				&& !PassesWithUntrackedOutputs[PassHandle]
+				&& !PassesToNeverCull[PassHandle]
+				&& EnumHasAnyFlags(Pass->GetFlags(), ERDGPassFlags::Compute)
+				&& !EnumHasAnyFlags(Pass->GetFlags(), ERDGPassFlags::UntrackedAccess);
+		};
+
+		FRDGPassBitArray PassesToMoveToAsyncCompute(false, Passes.Num());
+		TArray<int32, SceneRenderingAllocator> GraphicsPassCountBefore;
+		GraphicsPassCountBefore.SetNumUninitialized(Passes.Num() + 1);
+		GraphicsPassCountBefore[0] = 0;
+
+		for (FRDGPassHandle PassHandle = Passes.Begin(); PassHandle != Passes.End(); ++PassHandle)
+		{
+			PassesToMoveToAsyncCompute[PassHandle] = IsAsyncComputeCandidate(PassHandle);
+
+			// Candidates aren't counted as overlapping work, they may move to async compute as well.
+			const bool bStaysOnGraphics = !PassesToCull[PassHandle] && !PassesWithEmptyParameters[PassHandle] && !PassesOnAsyncCompute[PassHandle] && !PassesToMoveToAsyncCompute[PassHandle];
+			GraphicsPassCountBefore[PassHandle.GetIndex() + 1] = GraphicsPassCountBefore[PassHandle.GetIndex()] + (bStaysOnGraphics ? 1 : 0);
+		}
+
+		// Previous and next pass using a resource of each candidate, found by walking the graph in both directions.
+		TArray<FRDGPassHandle, SceneRenderingAllocator> PreviousUsers;
+		TArray<FRDGPassHandle, SceneRenderingAllocator> NextUsers;
+		PreviousUsers.Init(ProloguePassHandle, Passes.Num());
+		NextUsers.Init(EpiloguePassHandle, Passes.Num());
+
+		TMap<const FRDGParentResource*, FRDGPassHandle, SceneRenderingSetAllocator> LastUsers;
+
+		const auto VisitPassResources = [&](FRDGPassHandle PassHandle, FRDGPassHandle& OutUser, bool bForward)
+		{
+			const FRDGPass* Pass = Passes[PassHandle];
+			const bool bCandidate = PassesToMoveToAsyncCompute[PassHandle];
+
+			const auto VisitResource = [&](const FRDGParentResource* Resource)
+			{
+				FRDGPassHandle& LastUser = LastUsers.FindOrAdd(Resource);
+				if (bCandidate && LastUser.IsValid() && (bForward ? LastUser > OutUser : LastUser < OutUser))
+				{
+					OutUser = LastUser;
+				}
+				LastUser = PassHandle;
+			};
+
+			for (const auto& TexturePair : Pass->TextureStates)
+			{
+				VisitResource(TexturePair.Key);
+			}
+
+			for (const auto& BufferPair : Pass->BufferStates)
+			{
+				VisitResource(BufferPair.Key);
+			}
+		};
+
+		for (FRDGPassHandle PassHandle = Passes.Begin(); PassHandle != Passes.End(); ++PassHandle)
+		{
+			if (!PassesToCull[PassHandle])
+			{
+				VisitPassResources(PassHandle, PreviousUsers[PassHandle.GetIndex()], true);
+			}
+		}
+
+		LastUsers.Reset();
+
+		for (FRDGPassHandle PassHandle = Passes.Last(); PassHandle != ProloguePassHandle; --PassHandle)
+		{
+			if (!PassesToCull[PassHandle])
+			{
+				VisitPassResources(PassHandle, NextUsers[PassHandle.GetIndex()], false);
+			}
+		}
+
+		for (FRDGPassHandle PassHandle = Passes.Begin(); PassHandle != Passes.End(); ++PassHandle)
+		{
+			if (!PassesToMoveToAsyncCompute[PassHandle])
+			{
+				continue;
+			}
+
+			const int32 OverlapPassCount = GraphicsPassCountBefore[NextUsers[PassHandle.GetIndex()].GetIndex()] - GraphicsPassCountBefore[PreviousUsers[PassHandle.GetIndex()].GetIndex() + 1];
+			if (OverlapPassCount < GRDGAsyncComputeMinOverlapPasses)
+			{
+				continue;
+			}
+
+			FRDGPass* Pass = Passes[PassHandle];
+			Pass->Pipeline = ERHIPipeline::AsyncCompute;
+
+			for (auto& TexturePair : Pass->TextureStates)
+			{
+				for (FRDGSubresourceState& State : TexturePair.Value.State)
+				{
+					State.Pipeline = ERHIPipeline::AsyncCompute;
+				}
+			}
+
+			for (auto& BufferPair : Pass->BufferStates)
+			{
+				BufferPair.Value.State.Pipeline = ERHIPipeline::AsyncCompute;
+			}
+
+			// Async compute passes have their resources begun / ended by their fork / join passes.
+			Pass->ResourcesToBegin.Remove(Pass);
+			Pass->ResourcesToEnd.Remove(Pass);
+
+			PassesOnAsyncCompute[PassHandle] = true;
+			AsyncComputePassCount++;
+		}
+	}
+
 	// Walk the culled graph and compile barriers for each subresource. Certain transitions are redundant; read-to-read, for example.
 	// We can avoid them by traversing and merging compatible states together. The merging states removes a transition, but the merging
 	// heuristic is conservative and choosing not to merge doesn't necessarily mean a transition is performed. They are two distinct steps.
@@ -1593,6 +1719,30 @@ void FRDGBuilder::ExecutePassEpilogue(FRHIComputeCommandList& RHICmdListPass, FR
 	IF_RDG_ENABLE_DEBUG(UserValidation.ValidateExecutePassEnd(Pass));
 }
 
+static void AcquireTransientBuffer(FRDGPooledBuffer* Buffer)
+{
+	if (Buffer->Desc.UnderlyingType == FRDGBufferDesc::EUnderlyingType::StructuredBuffer)
+	{
+		RHIAcquireTransientResource(Buffer->GetStructuredBufferRHI());
+	}
+	else
+	{
+		RHIAcquireTransientResource(Buffer->GetVertexBufferRHI());
+	}
+}
+
+static void DiscardTransientBuffer(FRDGPooledBuffer* Buffer)
+{
+	if (Buffer->Desc.UnderlyingType == FRDGBufferDesc::EUnderlyingType::StructuredBuffer)
+	{
+		RHIDiscardTransientResource(Buffer->GetStructuredBufferRHI());
+	}
+	else
+	{
+		RHIDiscardTransientResource(Buffer->GetVertexBufferRHI());
+	}
+}
+
 void FRDGBuilder::ExecutePass(FRDGPass* Pass)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_FRDGBuilder_ExecutePass);
@@ -1602,6 +1752,11 @@ void FRDGBuilder::ExecutePass(FRDGPass* Pass)
 		RHIAcquireTransientResource(Texture);
 	}
 
+	for (FRDGPooledBuffer* Buffer : Pass->BuffersToAcquire)
+	{
+		AcquireTransientBuffer(Buffer);
+	}
+
 	// Note that we must do this before doing anything with RHICmdList for the pass.
 	// For example, if this pass only executes on GPU 1 we want to avoid adding a
 	// 0-duration event for this pass on GPU 0's time line.
@@ -1651,6 +1806,11 @@ void FRDGBuilder::ExecutePass(FRDGPass* Pass)
 		RHIDiscardTransientResource(Texture);
 	}
 
+	for (FRDGPooledBuffer* Buffer : Pass->BuffersToDiscard)
+	{
+		DiscardTransientBuffer(Buffer);
+	}
+
 	if (Pass->bAsyncComputeEnd)
 	{
 		if (Pass->bAsyncComputeEndExecute)
@@ -2218,12 +2378,32 @@ void FRDGBuilder::BeginResourceRHI(FRDGPassHandle PassHandle, FRDGBufferRef Buff
 
 	check(Buffer->ReferenceCount > 0 || Buffer->bExternal || IsResourceLifetimeExtended());
 
-	TRefCountPtr<FRDGPooledBuffer> PooledBuffer = GRenderGraphResourcePool.FindFreeBuffer(RHICmdList, Buffer->Desc, Buffer->Name);
+	// Buffers only used within the graph are allocated from transient memory, which the RHI aliases between the
+	// buffers that aren't acquired at the same time. Extracted and multi frame buffers outlive the graph.
+	const bool bTransient = GRDGTransientBuffers
+		&& GSupportsTransientResourceAliasing
+		&& !IsResourceLifetimeExtended()
+		&& !Buffer->bExternal
+		&& !Buffer->bExtracted
+		&& !EnumHasAnyFlags(Buffer->Flags, ERDGBufferFlags::MultiFrame);
+
+	FRDGBufferDesc PooledBufferDesc = Buffer->Desc;
+	if (bTransient)
+	{
+		PooledBufferDesc.Usage |= BUF_Transient;
+	}
+
+	TRefCountPtr<FRDGPooledBuffer> PooledBuffer = GRenderGraphResourcePool.FindFreeBuffer(RHICmdList, PooledBufferDesc, Buffer->Name);
 
 	FRDGBufferRef PreviousOwner = nullptr;
 	Buffer->SetRHI(PooledBuffer, PreviousOwner);
 	Buffer->FirstPass = PassHandle;
 
+	if (bTransient)
+	{
+		Buffer->bTransient = true;
+		Passes[PassHandle]->BuffersToAcquire.Emplace(PooledBuffer.GetReference());
+	}
 }
 
 void FRDGBuilder::BeginResourceRHI(FRDGPassHandle PassHandle, FRDGBufferSRVRef SRV)
@@ -2302,10 +2482,17 @@ void FRDGBuilder::EndResourceRHI(FRDGPassHandle PassHandle, FRDGBufferRef Buffer
 		if (Buffer->ReferenceCount == 0)
 		{
 			// External buffers should never release the reference.
-			if (!Buffer->bExternal)
+			if (!Buffer->bExternal && !Buffer->bTransient)
 			{
 				Buffer->Allocation = nullptr;
 			}
+
+			// Transient buffers keep their pooled buffer until the graph is released, their memory is reused through the discard.
+			if (Buffer->bTransient)
+			{
+				Passes[PassHandle]->BuffersToDiscard.Emplace(Buffer->PooledBuffer);
+			}
+
 			Buffer->LastPass = PassHandle;
 		}
 	}
@@ -276,7 +276,7 @@ void FRDGGPUScopeStacksByPipeline::BeginExecutePass(const FRDGPass* Pass)
 	ERHIPipeline Pipeline = Pass->GetPipeline();
 
 	/**TODO(RDG): This currently crashes certain platforms. */
-	if (GRDGAsyncCompute == RDG_ASYNC_COMPUTE_FORCE_ENABLED)
+	if (GRDGAsyncCompute == RDG_ASYNC_COMPUTE_FORCE_ENABLED || GRDGAsyncCompute == RDG_ASYNC_COMPUTE_AUTO)
 	{
 		Pipeline = ERHIPipeline::Graphics;
 	}
@@ -289,7 +289,7 @@ void FRDGGPUScopeStacksByPipeline::EndExecutePass(const FRDGPass* Pass)
 	ERHIPipeline Pipeline = Pass->GetPipeline();
 
 	/**TODO(RDG): This currently crashes certain platforms. */
-	if (GRDGAsyncCompute == RDG_ASYNC_COMPUTE_FORCE_ENABLED)
+	if (GRDGAsyncCompute == RDG_ASYNC_COMPUTE_FORCE_ENABLED || GRDGAsyncCompute == RDG_ASYNC_COMPUTE_AUTO)
 	{
 		Pipeline = ERHIPipeline::Graphics;
 	}
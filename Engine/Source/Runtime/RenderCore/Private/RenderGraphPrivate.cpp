@@ -244,7 +244,9 @@ TAutoConsoleVariable<int32> CVarRDGAsyncCompute(
 	TEXT("Controls the async compute policy.\n")
 	TEXT(" 0:disabled, no async compute is used;\n")
 	TEXT(" 1:enabled for passes tagged for async compute (default);\n")
-	TEXT(" 2:enabled for all compute passes implemented to use the compute command list;\n"),
+	TEXT(" 2:enabled for all compute passes implemented to use the compute command list;\n")
+	TEXT(" 3:enabled for passes tagged for async compute, and for the compute passes implemented to use the compute command list\n")
+	TEXT("   that enough graphics passes can overlap before their resources are used again (see r.RDG.AsyncCompute.MinOverlapPasses);\n"),
 	ECVF_RenderThreadSafe);
 
 FAutoConsoleVariableSink CVarRDGAsyncComputeSink(FConsoleCommandDelegate::CreateLambda([]()
@@ -257,6 +259,14 @@ FAutoConsoleVariableSink CVarRDGAsyncComputeSink(FConsoleCommandDelegate::Create
 	}
 }));
 
+int32 GRDGAsyncComputeMinOverlapPasses = 2;
+FAutoConsoleVariableRef CVarRDGAsyncComputeMinOverlapPasses(
+	TEXT("r.RDG.AsyncCompute.MinOverlapPasses"),
+	GRDGAsyncComputeMinOverlapPasses,
+	TEXT("With r.RDG.AsyncCompute=3, the number of graphics passes that must be able to run between the last user and the next user\n")
+	TEXT("of the resources of a compute pass for it to be moved to async compute."),
+	ECVF_RenderThreadSafe);
+
 int32 GRDGCullPasses = 1;
 FAutoConsoleVariableRef CVarRDGCullPasses(
 	TEXT("r.RDG.CullPasses"),
@@ -275,6 +285,16 @@ FAutoConsoleVariableRef CVarRDGMergeRenderPasses(
 	TEXT(" 1:on(default);\n"),
 	ECVF_RenderThreadSafe);
 
+int32 GRDGTransientBuffers = 1;
+FAutoConsoleVariableRef CVarRDGTransientBuffers(
+	TEXT("r.RDG.TransientBuffers"),
+	GRDGTransientBuffers,
+	TEXT("The graph will allocate its internal buffers from transient memory, so buffers with disjoint lifetimes share their memory.\n")
+	TEXT("Only used if the RHI supports transient resource aliasing.\n")
+	TEXT(" 0:off;\n")
+	TEXT(" 1:on(default);\n"),
+	ECVF_RenderThreadSafe);
+
 #if CSV_PROFILER
 int32 GRDGVerboseCSVStats = 0;
 FAutoConsoleVariableRef CVarRDGVerboseCSVStats(
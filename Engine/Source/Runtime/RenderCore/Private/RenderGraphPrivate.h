@@ -15,6 +15,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogRDG, Log, All);
 #define RDG_ASYNC_COMPUTE_DISABLED 0
 #define RDG_ASYNC_COMPUTE_ENABLED 1
 #define RDG_ASYNC_COMPUTE_FORCE_ENABLED 2
+#define RDG_ASYNC_COMPUTE_AUTO 3
 
 #define RDG_BREAKPOINT_WARNINGS 1
 #define RDG_BREAKPOINT_PASS_COMPILE 2
@@ -86,8 +87,10 @@ inline bool IsResourceLifetimeExtended()
 }
 
 extern int32 GRDGAsyncCompute;
+extern int32 GRDGAsyncComputeMinOverlapPasses;
 extern int32 GRDGCullPasses;
 extern int32 GRDGMergeRenderPasses;
+extern int32 GRDGTransientBuffers;
 
 #if CSV_PROFILER
 extern int32 GRDGVerboseCSVStats;
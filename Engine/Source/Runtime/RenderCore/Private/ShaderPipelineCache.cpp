@@ -159,6 +159,13 @@ static TAutoConsoleVariable<float> CVarPSOFileCacheMaxPrecompileTime(
 																ECVF_Default | ECVF_RenderThreadSafe
 																);
 
+static TAutoConsoleVariable<int32> CVarPSOFileCacheNonBlockingPrecompile(
+																TEXT("r.ShaderPipelineCache.NonBlockingPrecompile"),
+																(int32)1,
+																TEXT("Set non zero to compile graphics PSOs from the cache on task threads without the RHI thread waiting for them. Requires r.AsyncPipelineCompile."),
+																ECVF_Default | ECVF_RenderThreadSafe
+																);
+
 static bool GetShaderPipelineCacheSaveBoundPSOLog()
 {
 	static bool bOnce = false;
@@ -694,7 +701,10 @@ bool FShaderPipelineCache::Precompile(FRHICommandListImmediate& RHICmdList, ESha
 			GraphicsInitializer.bFromPSOFileCache = 1;
 			
 			// Use SetGraphicsPipelineState to call down into PipelineStateCache and also handle the fallback case used by OpenGL.
-			SetGraphicsPipelineState(RHICmdList, GraphicsInitializer, EApplyRendertargetOption::DoNothing, false);
+			// In non-blocking mode the compile task runs in the background and nothing is set on the immediate command list until it's done,
+			// so batches are no longer throttled by the RHI thread waiting for each PSO.
+			const EGraphicsPipelineCacheFlags CacheFlags = CVarPSOFileCacheNonBlockingPrecompile.GetValueOnAnyThread() ? EGraphicsPipelineCacheFlags::NonBlocking : EGraphicsPipelineCacheFlags::Default;
+			SetGraphicsPipelineState(RHICmdList, GraphicsInitializer, EApplyRendertargetOption::DoNothing, false, CacheFlags);
 			bOk = true;
 		}
 		else if(FPipelineCacheFileFormatPSO::DescriptorType::Compute == PSO.Type)
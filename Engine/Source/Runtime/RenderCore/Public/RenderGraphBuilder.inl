@@ -244,6 +244,8 @@ FRDGPassRef FRDGBuilder::AddPass(
 		OverridePassFlags(Name.GetTCHAR(), Flags, LambdaPassType::kSupportsAsyncCompute),
 		MoveTemp(ExecuteLambda));
 
+	Pass->bAsyncComputeSupported = LambdaPassType::kSupportsAsyncCompute;
+
 	IF_RDG_ENABLE_DEBUG(ClobberPassOutputs(Pass));
 	Passes.Insert(Pass);
 	SetupPass(Pass);
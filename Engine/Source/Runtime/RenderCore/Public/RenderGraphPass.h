@@ -273,7 +273,8 @@ private:
 	const FRDGEventName Name;
 	const FRDGParameterStruct ParameterStruct;
 	const ERDGPassFlags Flags;
-	const ERHIPipeline Pipeline;
+	/** Not const, the builder may move compute passes to async compute while compiling. */
+	ERHIPipeline Pipeline;
 	FRDGPassHandle Handle;
 
 	union
@@ -298,6 +299,9 @@ private:
 			/** Whether the pass writes to a UAV. */
 			uint32 bUAVAccess : 1;
 
+			/** Whether the pass lambda takes a compute command list, so that the pass can execute on async compute. */
+			uint32 bAsyncComputeSupported : 1;
+
 			/** Whether this pass allocated a texture through the pool. */
 			IF_RDG_ENABLE_DEBUG(uint32 bFirstTextureAllocated : 1);
 		};
@@ -355,6 +359,10 @@ private:
 	 */
 	TArray<FRHITexture*, SceneRenderingAllocator> TexturesToDiscard;
 
+	/** Lists of transient buffers to acquire before the pass executes and to discard after it completes. */
+	TArray<FRDGPooledBuffer*, SceneRenderingAllocator> BuffersToAcquire;
+	TArray<FRDGPooledBuffer*, SceneRenderingAllocator> BuffersToDiscard;
+
 	/** Barriers to begin / end prior to executing a pass. */
 	FRDGBarrierBatchBegin* PrologueBarriersToBegin = nullptr;
 	FRDGBarrierBatchEnd* PrologueBarriersToEnd = nullptr;
@@ -782,6 +782,18 @@ void FDeferredShadingSceneRenderer::RenderBasePass(
 {
 	const bool bEnableParallelBasePasses = GRHICommandList.UseParallelAlgorithms() && CVarParallelBasePass.GetValueOnRenderThread();
 
+	if (GGPUSceneCullMeshDrawCommands)
+	{
+		// GPU culling of the base pass has to run before its render pass begins
+		AddPass(GraphBuilder, [this](FRHICommandListImmediate& RHICmdList)
+		{
+			for (const FViewInfo& View : Views)
+			{
+				View.ParallelMeshDrawCommandPasses[EMeshPass::BasePass].DispatchGPUCulling(RHICmdList);
+			}
+		});
+	}
+
 	static const auto ClearMethodCVar = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.ClearSceneMethod"));
 	bool bRequiresRHIClear = true;
 	bool bRequiresFarZQuadClear = false;
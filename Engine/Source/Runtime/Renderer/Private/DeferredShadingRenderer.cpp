@@ -2693,6 +2693,13 @@ void FDeferredShadingSceneRenderer::Render(FRHICommandListImmediate& RHICmdList)
 			GraphBuilder.QueueTextureExtraction((*SceneTextures)->SceneDepthTexture, &ViewState->PrevFrameViewInfo.DepthBuffer);
 			GraphBuilder.QueueTextureExtraction((*SceneTextures)->SceneColorTexture, &ViewState->PrevFrameViewInfo.ScreenSpaceRayTracingInput);
 		}
+
+		if (GGPUSceneCullMeshDrawCommands && View.ViewState && !View.bStatePrevViewInfoIsReadOnly)
+		{
+			// Keep the HZB for next frame's GPU culling of mesh draw commands.
+			View.ViewState->PrevFrameViewInfo.HZB = View.HZB;
+			View.ViewState->PrevFrameViewInfo.HZBMipmap0Size = View.HZBMipmap0Size;
+		}
 	}
 
 	{
@@ -630,6 +630,12 @@ bool FDeferredShadingSceneRenderer::RenderPrePass(FRHICommandListImmediate& RHIC
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(RenderPrePass);
 	SCOPED_GPU_STAT(RHICmdList, Prepass);
 
+	// GPU culling of the depth pass has to run before its render pass begins
+	for (const FViewInfo& View : Views)
+	{
+		View.ParallelMeshDrawCommandPasses[EMeshPass::DepthPass].DispatchGPUCulling(RHICmdList);
+	}
+
 	bool bDidPrePre = false;
 	FSceneRenderTargets& SceneContext = FSceneRenderTargets::Get(RHICmdList);
 
@@ -0,0 +1,319 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	GPUSceneCulling.cpp: GPU culling of mesh draw commands against GPUScene primitive bounds.
+=============================================================================*/
+
+#include "GPUSceneCulling.h"
+#include "CoreMinimal.h"
+#include "RHI.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "RenderGraphUtils.h"
+#include "SceneRendering.h"
+#include "ScenePrivate.h"
+
+int32 GGPUSceneCullMeshDrawCommands = 0;
+FAutoConsoleVariableRef CVarGPUSceneCullMeshDrawCommands(
+	TEXT("r.GPUScene.CullMeshDrawCommands"),
+	GGPUSceneCullMeshDrawCommands,
+	TEXT("Whether to cull the instances of depth and base pass mesh draw commands on the GPU, using the GPUScene primitive bounds.\n")
+	TEXT("Culled draws are submitted with indirect args and a compacted primitive id buffer."),
+	ECVF_RenderThreadSafe
+	);
+
+int32 GGPUSceneCullMeshDrawCommandsOcclusion = 1;
+FAutoConsoleVariableRef CVarGPUSceneCullMeshDrawCommandsOcclusion(
+	TEXT("r.GPUScene.CullMeshDrawCommands.Occlusion"),
+	GGPUSceneCullMeshDrawCommandsOcclusion,
+	TEXT("Whether GPU culling of mesh draw commands also tests the instances against the previous frame's HZB."),
+	ECVF_RenderThreadSafe
+	);
+
+TGlobalResource<FMeshDrawCullingBufferPool> GMeshDrawCullingBufferPool;
+
+FMeshDrawCullingBufferPool::FMeshDrawCullingBufferPool()
+	: DiscardId(0)
+{
+}
+
+FMeshDrawCullingBufferPool::~FMeshDrawCullingBufferPool()
+{
+	check(!Entries.Num());
+}
+
+FMeshDrawCullingBuffers FMeshDrawCullingBufferPool::Allocate(int32 MaxDraws)
+{
+	check(IsInRenderingThread());
+
+	FScopeLock Lock(&AllocationCS);
+
+	MaxDraws = Align(MaxDraws, 256);
+
+	// First look for a smallest unused one.
+	int32 BestFitIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		if (Entries[Index].LastDiscardId != DiscardId && Entries[Index].MaxDraws >= MaxDraws)
+		{
+			if (BestFitIndex == INDEX_NONE || Entries[Index].MaxDraws < Entries[BestFitIndex].MaxDraws)
+			{
+				BestFitIndex = Index;
+
+				if (Entries[BestFitIndex].MaxDraws == MaxDraws)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	if (BestFitIndex != INDEX_NONE)
+	{
+		FMeshDrawCullingBuffers ReusedEntry = MoveTemp(Entries[BestFitIndex]);
+		ReusedEntry.LastDiscardId = DiscardId;
+		Entries.RemoveAt(BestFitIndex);
+		return ReusedEntry;
+	}
+
+	static_assert(sizeof(FMeshDrawCullingRecord) % sizeof(uint32) == 0, "FMeshDrawCullingRecord is read as a Buffer<uint>");
+	static_assert(sizeof(FRHIDrawIndexedIndirectParameters) % sizeof(uint32) == 0, "Indirect args are written as a RWBuffer<uint>");
+
+	FMeshDrawCullingBuffers NewEntry;
+	NewEntry.MaxDraws = MaxDraws;
+	NewEntry.LastDiscardId = DiscardId;
+	NewEntry.DrawRecords.Initialize(sizeof(uint32), MaxDraws * sizeof(FMeshDrawCullingRecord) / sizeof(uint32), PF_R32_UINT, BUF_Dynamic, TEXT("MeshDrawCullingRecords"));
+	NewEntry.PrimitiveIds.Initialize(sizeof(uint32), MaxDraws, PF_R32_UINT, BUF_Dynamic, TEXT("MeshDrawCullingPrimitiveIds"));
+	NewEntry.DrawIndirectArgs.Initialize(sizeof(uint32), MaxDraws * sizeof(FRHIDrawIndexedIndirectParameters) / sizeof(uint32), PF_R32_UINT, BUF_DrawIndirect, TEXT("MeshDrawCullingIndirectArgs"));
+	NewEntry.CulledPrimitiveIds.Initialize(sizeof(uint32), MaxDraws, PF_R32_UINT, BUF_VertexBuffer, TEXT("MeshDrawCulledPrimitiveIds"));
+	return NewEntry;
+}
+
+void FMeshDrawCullingBufferPool::ReturnToFreeList(FMeshDrawCullingBuffers Entry)
+{
+	FScopeLock Lock(&AllocationCS);
+
+	Entries.Add(MoveTemp(Entry));
+}
+
+void FMeshDrawCullingBufferPool::DiscardAll()
+{
+	FScopeLock Lock(&AllocationCS);
+
+	++DiscardId;
+
+	// Remove old unused pool entries.
+	for (int32 Index = 0; Index < Entries.Num();)
+	{
+		if (DiscardId - Entries[Index].LastDiscardId > 1000u)
+		{
+			Entries.RemoveAtSwap(Index);
+		}
+		else
+		{
+			++Index;
+		}
+	}
+}
+
+void FMeshDrawCullingBufferPool::ReleaseDynamicRHI()
+{
+	Entries.Empty();
+}
+
+bool ShouldCullMeshPassOnGPU(const FViewInfo& View, EMeshPass::Type PassType, bool bUseGPUScene, bool bDynamicInstancing, int32 InstanceFactor)
+{
+	// Culled draws are dynamically instanced, and the compacted primitive ids can't be interleaved for instanced stereo.
+	return GGPUSceneCullMeshDrawCommands != 0
+		&& (PassType == EMeshPass::DepthPass || PassType == EMeshPass::BasePass)
+		&& View.GetFeatureLevel() >= ERHIFeatureLevel::SM5
+		&& FSceneInterface::GetShadingPath(View.GetFeatureLevel()) == EShadingPath::Deferred
+		&& bUseGPUScene
+		&& bDynamicInstancing
+		&& InstanceFactor == 1
+		&& !GPUSceneUseTexture2D(View.GetShaderPlatform());
+}
+
+void BuildMeshDrawCullingRecords(
+	FMeshCommandOneFrameArray& VisibleMeshDrawCommands,
+	FDynamicMeshDrawCommandStorage& MeshDrawCommandStorage,
+	const FGraphicsMinimalPipelineStateSet& GraphicsMinimalPipelineStateSet,
+	int32 NumPrimitiveIds,
+	FRHIVertexBuffer* DrawIndirectArgsBuffer,
+	FMeshDrawCullingRecord* RESTRICT OutRecords)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BuildMeshDrawCullingRecords);
+
+	const int32 NumDrawCommands = VisibleMeshDrawCommands.Num();
+	for (int32 DrawCommandIndex = 0; DrawCommandIndex < NumDrawCommands; DrawCommandIndex++)
+	{
+		FVisibleMeshDrawCommand& VisibleMeshDrawCommand = VisibleMeshDrawCommands[DrawCommandIndex];
+		const FMeshDrawCommand& MeshDrawCommand = *VisibleMeshDrawCommand.MeshDrawCommand;
+		FMeshDrawCullingRecord& Record = OutRecords[DrawCommandIndex];
+
+		// Primitive ids of a draw run up to the next draw's, merged draws have one per instance
+		const int32 NextPrimitiveIdOffset = DrawCommandIndex + 1 < NumDrawCommands ? VisibleMeshDrawCommands[DrawCommandIndex + 1].PrimitiveIdBufferOffset : NumPrimitiveIds;
+		Record.PrimitiveIdOffset = VisibleMeshDrawCommand.PrimitiveIdBufferOffset;
+		Record.NumPrimitiveIds = NextPrimitiveIdOffset - VisibleMeshDrawCommand.PrimitiveIdBufferOffset;
+		Record.IndirectArgsOffset = ~0u;
+		Record.IndexCountPerInstance = 0;
+		Record.StartIndexLocation = 0;
+		Record.BaseVertexLocation = 0;
+
+		// Only indexed triangle lists whose instances each have a primitive id can be culled
+		const bool bCanCull = MeshDrawCommand.IndexBuffer != nullptr
+			&& MeshDrawCommand.NumPrimitives > 0
+			&& MeshDrawCommand.PrimitiveIdStreamIndex >= 0
+			&& MeshDrawCommand.NumInstances == Record.NumPrimitiveIds
+			&& MeshDrawCommand.CachedPipelineId.GetPipelineState(GraphicsMinimalPipelineStateSet).PrimitiveType == PT_TriangleList;
+
+		if (bCanCull)
+		{
+			Record.IndirectArgsOffset = DrawCommandIndex * sizeof(FRHIDrawIndexedIndirectParameters) / sizeof(uint32);
+			Record.IndexCountPerInstance = MeshDrawCommand.NumPrimitives * 3;
+			Record.StartIndexLocation = MeshDrawCommand.FirstIndex;
+			Record.BaseVertexLocation = MeshDrawCommand.VertexParams.BaseVertexIndex;
+
+			// Cached commands are shared between views, so the draw is redirected to its indirect args on a one frame copy
+			const int32 Index = MeshDrawCommandStorage.MeshDrawCommands.AddElement(MeshDrawCommand);
+			FMeshDrawCommand& CulledMeshDrawCommand = MeshDrawCommandStorage.MeshDrawCommands[Index];
+			CulledMeshDrawCommand.NumPrimitives = 0;
+			CulledMeshDrawCommand.IndirectArgs.Buffer = DrawIndirectArgsBuffer;
+			CulledMeshDrawCommand.IndirectArgs.Offset = DrawCommandIndex * sizeof(FRHIDrawIndexedIndirectParameters);
+			VisibleMeshDrawCommand.MeshDrawCommand = &CulledMeshDrawCommand;
+		}
+	}
+}
+
+class FCullMeshDrawCommandsCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FCullMeshDrawCommandsCS);
+	SHADER_USE_PARAMETER_STRUCT(FCullMeshDrawCommandsCS, FGlobalShader);
+
+	class FOcclusionCullingDim : SHADER_PERMUTATION_BOOL("OCCLUSION_CULLING");
+	using FPermutationDomain = TShaderPermutationDomain<FOcclusionCullingDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_REF(FViewUniformShaderParameters, View)
+		SHADER_PARAMETER_SRV(Buffer<uint>, DrawRecords)
+		SHADER_PARAMETER_SRV(Buffer<uint>, PrimitiveIds)
+		SHADER_PARAMETER_UAV(RWBuffer<uint>, RWDrawIndirectArgs)
+		SHADER_PARAMETER_UAV(RWBuffer<uint>, RWCulledPrimitiveIds)
+		SHADER_PARAMETER(uint32, NumDraws)
+		SHADER_PARAMETER(uint32, NumFrustumPlanes)
+		SHADER_PARAMETER_ARRAY(FVector4, FrustumPlanes, [6])
+		SHADER_PARAMETER(FMatrix, PrevWorldToClip)
+		SHADER_PARAMETER(FVector, HZBUvFactor)
+		SHADER_PARAMETER(FVector4, HZBSize)
+		SHADER_PARAMETER_TEXTURE(Texture2D, HZBTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, HZBSampler)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 64;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5) && UseGPUScene(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+IMPLEMENT_GLOBAL_SHADER(FCullMeshDrawCommandsCS, "/Engine/Private/GPUSceneCulling.usf", "CullMeshDrawCommandsCS", SF_Compute);
+
+void DispatchMeshDrawCulling(
+	FRHICommandListImmediate& RHICmdList,
+	const FViewInfo& View,
+	const FMeshDrawCullingBuffers& CullingBuffers,
+	const FMeshDrawCullingRecord* Records,
+	int32 NumRecords,
+	const void* PrimitiveIdData,
+	int32 NumPrimitiveIds)
+{
+	check(IsInRenderingThread() && RHICmdList.IsOutsideRenderPass());
+	check(NumRecords <= CullingBuffers.MaxDraws && NumPrimitiveIds <= CullingBuffers.MaxDraws);
+	SCOPED_DRAW_EVENTF(RHICmdList, CullMeshDrawCommands, TEXT("CullMeshDrawCommands %d draws"), NumRecords);
+
+	{
+		void* RESTRICT Data = RHICmdList.LockVertexBuffer(CullingBuffers.DrawRecords.Buffer, 0, NumRecords * sizeof(FMeshDrawCullingRecord), RLM_WriteOnly);
+		FMemory::Memcpy(Data, Records, NumRecords * sizeof(FMeshDrawCullingRecord));
+		RHICmdList.UnlockVertexBuffer(CullingBuffers.DrawRecords.Buffer);
+
+		Data = RHICmdList.LockVertexBuffer(CullingBuffers.PrimitiveIds.Buffer, 0, NumPrimitiveIds * sizeof(int32), RLM_WriteOnly);
+		FMemory::Memcpy(Data, PrimitiveIdData, NumPrimitiveIds * sizeof(int32));
+		RHICmdList.UnlockVertexBuffer(CullingBuffers.PrimitiveIds.Buffer);
+	}
+
+	FCullMeshDrawCommandsCS::FParameters PassParameters;
+	PassParameters.View = View.ViewUniformBuffer;
+	PassParameters.DrawRecords = CullingBuffers.DrawRecords.SRV;
+	PassParameters.PrimitiveIds = CullingBuffers.PrimitiveIds.SRV;
+	PassParameters.RWDrawIndirectArgs = CullingBuffers.DrawIndirectArgs.UAV;
+	PassParameters.RWCulledPrimitiveIds = CullingBuffers.CulledPrimitiveIds.UAV;
+	PassParameters.NumDraws = NumRecords;
+
+	const TArray<FPlane, TInlineAllocator<6>>& FrustumPlanes = View.ViewFrustum.Planes;
+	PassParameters.NumFrustumPlanes = FMath::Min(FrustumPlanes.Num(), 6);
+	for (uint32 PlaneIndex = 0; PlaneIndex < PassParameters.NumFrustumPlanes; ++PlaneIndex)
+	{
+		PassParameters.FrustumPlanes[PlaneIndex] = FVector4(FrustumPlanes[PlaneIndex], FrustumPlanes[PlaneIndex].W);
+	}
+
+	// The previous frame's HZB is only usable if the view was rendered last frame and didn't cut
+	const FPreviousViewInfo& PrevViewInfo = View.PrevViewInfo;
+	const bool bOcclusionCulling = GGPUSceneCullMeshDrawCommandsOcclusion != 0
+		&& PrevViewInfo.HZB.IsValid()
+		&& !View.bCameraCut
+		&& !View.bPrevTransformsReset;
+
+	if (bOcclusionCulling)
+	{
+		// Same mip selection as the HZB occlusion tests
+		const float kHZBTestMaxMipmap = 9.0f;
+		const float HZBMipmapCounts = FMath::Log2(FMath::Max(PrevViewInfo.HZBMipmap0Size.X, PrevViewInfo.HZBMipmap0Size.Y));
+
+		PassParameters.PrevWorldToClip = PrevViewInfo.ViewMatrices.GetViewProjectionMatrix();
+		PassParameters.HZBUvFactor = FVector(
+			float(PrevViewInfo.ViewRect.Width()) / float(2 * PrevViewInfo.HZBMipmap0Size.X),
+			float(PrevViewInfo.ViewRect.Height()) / float(2 * PrevViewInfo.HZBMipmap0Size.Y),
+			FMath::Max(HZBMipmapCounts - kHZBTestMaxMipmap, 0.0f));
+		PassParameters.HZBSize = FVector4(
+			PrevViewInfo.HZBMipmap0Size.X,
+			PrevViewInfo.HZBMipmap0Size.Y,
+			1.0f / float(PrevViewInfo.HZBMipmap0Size.X),
+			1.0f / float(PrevViewInfo.HZBMipmap0Size.Y));
+		PassParameters.HZBTexture = PrevViewInfo.HZB->GetRenderTargetItem().ShaderResourceTexture;
+	}
+	else
+	{
+		PassParameters.PrevWorldToClip = FMatrix::Identity;
+		PassParameters.HZBUvFactor = FVector::ZeroVector;
+		PassParameters.HZBSize = FVector4(0, 0, 0, 0);
+		PassParameters.HZBTexture = GBlackTexture->TextureRHI;
+	}
+	PassParameters.HZBSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+
+	FCullMeshDrawCommandsCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FCullMeshDrawCommandsCS::FOcclusionCullingDim>(bOcclusionCulling);
+	TShaderMapRef<FCullMeshDrawCommandsCS> ComputeShader(View.ShaderMap, PermutationVector);
+
+	FRHITransitionInfo UAVTransitions[] =
+	{
+		FRHITransitionInfo(CullingBuffers.DrawIndirectArgs.UAV, ERHIAccess::Unknown, ERHIAccess::UAVCompute),
+		FRHITransitionInfo(CullingBuffers.CulledPrimitiveIds.UAV, ERHIAccess::Unknown, ERHIAccess::UAVCompute)
+	};
+	RHICmdList.Transition(MakeArrayView(UAVTransitions, UE_ARRAY_COUNT(UAVTransitions)));
+
+	FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, PassParameters, FIntVector(FMath::DivideAndRoundUp(NumRecords, FCullMeshDrawCommandsCS::ThreadGroupSize), 1, 1));
+
+	FRHITransitionInfo DrawTransitions[] =
+	{
+		FRHITransitionInfo(CullingBuffers.DrawIndirectArgs.UAV, ERHIAccess::UAVCompute, ERHIAccess::IndirectArgs),
+		FRHITransitionInfo(CullingBuffers.CulledPrimitiveIds.UAV, ERHIAccess::UAVCompute, ERHIAccess::VertexOrIndexBuffer)
+	};
+	RHICmdList.Transition(MakeArrayView(DrawTransitions, UE_ARRAY_COUNT(DrawTransitions)));
+}
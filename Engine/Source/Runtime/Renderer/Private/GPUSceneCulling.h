@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	GPUSceneCulling.h: GPU culling of mesh draw commands against GPUScene primitive bounds.
+=============================================================================*/
+
+#pragma once
+
+#include "RHIUtilities.h"
+#include "MeshPassProcessor.h"
+
+class FViewInfo;
+
+/**
+ * Per draw input of the culling pass, must match the record layout in GPUSceneCulling.usf.
+ * Every visible mesh draw command of a culled pass has a record, draws that can't be culled only have their primitive ids copied.
+ */
+struct FMeshDrawCullingRecord
+{
+	/** Offset of the draw's first primitive id in the pass primitive id buffer */
+	uint32 PrimitiveIdOffset;
+	/** Number of primitive ids of the draw, one per dynamically instanced primitive */
+	uint32 NumPrimitiveIds;
+	/** Offset of the draw's FRHIDrawIndexedIndirectParameters in uint32s, or ~0u if the draw is not culled */
+	uint32 IndirectArgsOffset;
+	uint32 IndexCountPerInstance;
+	uint32 StartIndexLocation;
+	int32 BaseVertexLocation;
+};
+
+/** GPU buffers of one culled mesh pass */
+struct FMeshDrawCullingBuffers
+{
+	int32 MaxDraws = 0;
+	uint32 LastDiscardId = 0;
+
+	/** FMeshDrawCullingRecords uploaded from the pass setup task */
+	FReadBuffer DrawRecords;
+	/** Primitive ids of the pass as built by the pass setup task */
+	FReadBuffer PrimitiveIds;
+	/** Indirect args written by the culling pass, one FRHIDrawIndexedIndirectParameters per draw */
+	FRWBuffer DrawIndirectArgs;
+	/** Primitive ids of the visible instances, compacted per draw. Bound as the primitive id vertex stream of the pass. */
+	FRWBuffer CulledPrimitiveIds;
+
+	bool IsValid() const { return MaxDraws > 0; }
+};
+
+/** Pool of culling buffers, entries are reused across frames like FPrimitiveIdVertexBufferPool entries */
+class FMeshDrawCullingBufferPool : public FRenderResource
+{
+public:
+	FMeshDrawCullingBufferPool();
+	~FMeshDrawCullingBufferPool();
+
+	FMeshDrawCullingBuffers Allocate(int32 MaxDraws);
+	void ReturnToFreeList(FMeshDrawCullingBuffers Entry);
+	void DiscardAll();
+
+	virtual void ReleaseDynamicRHI() override;
+
+private:
+	uint32 DiscardId;
+	TArray<FMeshDrawCullingBuffers> Entries;
+	FCriticalSection AllocationCS;
+};
+
+extern TGlobalResource<FMeshDrawCullingBufferPool> GMeshDrawCullingBufferPool;
+
+extern int32 GGPUSceneCullMeshDrawCommands;
+
+/** Returns whether the draws of the given pass should be culled on the GPU */
+extern bool ShouldCullMeshPassOnGPU(const FViewInfo& View, EMeshPass::Type PassType, bool bUseGPUScene, bool bDynamicInstancing, int32 InstanceFactor);
+
+/**
+ * Fills a culling record for each visible mesh draw command after the pass primitive id buffer was built, and redirects the
+ * draws that can be culled to their indirect args.
+ */
+extern void BuildMeshDrawCullingRecords(
+	FMeshCommandOneFrameArray& VisibleMeshDrawCommands,
+	FDynamicMeshDrawCommandStorage& MeshDrawCommandStorage,
+	const FGraphicsMinimalPipelineStateSet& GraphicsMinimalPipelineStateSet,
+	int32 NumPrimitiveIds,
+	FRHIVertexBuffer* DrawIndirectArgsBuffer,
+	FMeshDrawCullingRecord* RESTRICT OutRecords);
+
+/** Culls the draws of a pass against the view frustum and the previous frame's HZB, writing their indirect args and visible primitive ids */
+extern void DispatchMeshDrawCulling(
+	FRHICommandListImmediate& RHICmdList,
+	const FViewInfo& View,
+	const FMeshDrawCullingBuffers& CullingBuffers,
+	const FMeshDrawCullingRecord* Records,
+	int32 NumRecords,
+	const void* PrimitiveIdData,
+	int32 NumPrimitiveIds);
@@ -897,6 +897,18 @@ public:
 					Context.ShaderPlatform,
 					Context.InstanceFactor
 				);
+
+				if (Context.bGPUCulling)
+				{
+					BuildMeshDrawCullingRecords(
+						Context.MeshDrawCommands,
+						Context.MeshDrawCommandStorage,
+						Context.MinimalPipelineStatePassSet,
+						Context.VisibleMeshDrawCommandsNum,
+						Context.CullingIndirectArgsBuffer,
+						Context.CullingRecordData
+					);
+				}
 			}
 		}
 	}
@@ -1088,6 +1100,8 @@ void FParallelMeshDrawCommandPass::DispatchPassSetup(
 		check(MobileBasePassCSMMeshPassProcessor == nullptr && InOutMobileBasePassCSMMeshDrawCommands == nullptr);
 	}
 
+	TaskContext.bGPUCulling = MaxNumDraws > 0 && ShouldCullMeshPassOnGPU(View, PassType, TaskContext.bUseGPUScene, TaskContext.bDynamicInstancing, TaskContext.InstanceFactor);
+
 	if (MaxNumDraws > 0)
 	{
 		// Preallocate resources on rendering thread based on MaxNumDraws.
@@ -1095,6 +1109,13 @@ void FParallelMeshDrawCommandPass::DispatchPassSetup(
 		TaskContext.PrimitiveIdBufferDataSize = TaskContext.InstanceFactor * MaxNumDraws * sizeof(int32);
 		TaskContext.PrimitiveIdBufferData = FMemory::Malloc(TaskContext.PrimitiveIdBufferDataSize);
 		PrimitiveIdVertexBufferPoolEntry = GPrimitiveIdVertexBufferPool.Allocate(TaskContext.PrimitiveIdBufferDataSize);
+
+		if (TaskContext.bGPUCulling)
+		{
+			CullingBuffers = GMeshDrawCullingBufferPool.Allocate(MaxNumDraws);
+			TaskContext.CullingRecordData = (FMeshDrawCullingRecord*)FMemory::Malloc(MaxNumDraws * sizeof(FMeshDrawCullingRecord));
+			TaskContext.CullingIndirectArgsBuffer = CullingBuffers.DrawIndirectArgs.Buffer;
+		}
 		TaskContext.MeshDrawCommands.Reserve(MaxNumDraws);
 		TaskContext.TempVisibleMeshDrawCommands.Reserve(MaxNumDraws);
 
@@ -1189,7 +1210,18 @@ void FParallelMeshDrawCommandPass::WaitForTasksAndEmpty()
 		FMemory::Free(TaskContext.PrimitiveIdBufferData);
 	}
 
+	if (CullingBuffers.IsValid())
+	{
+		// Parallel draws of the pass may still be translated on the RHI thread
+		FRHICommandListExecutor::GetImmediateCommandList().EnqueueLambda([CullingBuffers = CullingBuffers](FRHICommandListImmediate&) mutable {
+			GMeshDrawCullingBufferPool.ReturnToFreeList(MoveTemp(CullingBuffers));
+		});
+		CullingBuffers = FMeshDrawCullingBuffers();
+	}
+	FMemory::Free(TaskContext.CullingRecordData);
+
 	bPrimitiveIdBufferDataOwnedByRHIThread = false;
+	bGPUCullingDispatched = false;
 	MaxNumDraws = 0;
 	PassNameForStats.Empty();
 
@@ -1204,6 +1236,9 @@ void FParallelMeshDrawCommandPass::WaitForTasksAndEmpty()
 	TaskContext.TempVisibleMeshDrawCommands.Empty();
 	TaskContext.PrimitiveIdBufferData = nullptr;
 	TaskContext.PrimitiveIdBufferDataSize = 0;
+	TaskContext.bGPUCulling = false;
+	TaskContext.CullingRecordData = nullptr;
+	TaskContext.CullingIndirectArgsBuffer = nullptr;
 }
 
 FParallelMeshDrawCommandPass::~FParallelMeshDrawCommandPass()
@@ -1283,12 +1318,15 @@ void FParallelMeshDrawCommandPass::DispatchDraw(FParallelCommandListSet* Paralle
 		return;
 	}
 
-	FRHIVertexBuffer* PrimitiveIdsBuffer = PrimitiveIdVertexBufferPoolEntry.BufferRHI;
+	checkf(!TaskContext.bGPUCulling || bGPUCullingDispatched, TEXT("DispatchGPUCulling must be called before drawing a mesh pass that is culled on the GPU"));
+
+	// Draws culled on the GPU read the compacted primitive ids written by the culling pass
+	FRHIVertexBuffer* PrimitiveIdsBuffer = bGPUCullingDispatched ? CullingBuffers.CulledPrimitiveIds.Buffer.GetReference() : PrimitiveIdVertexBufferPoolEntry.BufferRHI.GetReference();
 	const int32 BasePrimitiveIdsOffset = 0;
 
 	if (ParallelCommandListSet)
 	{
-		if (TaskContext.bUseGPUScene)
+		if (TaskContext.bUseGPUScene && !bGPUCullingDispatched)
 		{
 			// Queue a command on the RHI thread which will upload PrimitiveIdVertexBuffer after finishing FMeshDrawCommandPassSetupTask.
 			FRHICommandListImmediate &RHICommandList = GetImmediateCommandList_ForRenderCommand();
@@ -1354,7 +1392,7 @@ void FParallelMeshDrawCommandPass::DispatchDraw(FParallelCommandListSet* Paralle
 
 		WaitForMeshPassSetupTask();
 
-		if (TaskContext.bUseGPUScene)
+		if (TaskContext.bUseGPUScene && !bGPUCullingDispatched)
 		{
 			// Can immediately upload vertex buffer data, as there is no parallel draw task.
 			void* RESTRICT Data = RHILockVertexBuffer(PrimitiveIdVertexBufferPoolEntry.BufferRHI, 0, TaskContext.PrimitiveIdBufferDataSize, RLM_WriteOnly);
@@ -1366,6 +1404,31 @@ void FParallelMeshDrawCommandPass::DispatchDraw(FParallelCommandListSet* Paralle
 	}
 }
 
+void FParallelMeshDrawCommandPass::DispatchGPUCulling(FRHICommandListImmediate& RHICmdList) const
+{
+	if (!TaskContext.bGPUCulling || bGPUCullingDispatched)
+	{
+		return;
+	}
+
+	// Culling records and primitive ids are built by the pass setup task.
+	WaitForMeshPassSetupTask();
+
+	if (TaskContext.MeshDrawCommands.Num() > 0)
+	{
+		DispatchMeshDrawCulling(
+			RHICmdList,
+			*TaskContext.View,
+			CullingBuffers,
+			TaskContext.CullingRecordData,
+			TaskContext.MeshDrawCommands.Num(),
+			TaskContext.PrimitiveIdBufferData,
+			TaskContext.VisibleMeshDrawCommandsNum);
+	}
+
+	bGPUCullingDispatched = true;
+}
+
 void FParallelMeshDrawCommandPass::DumpInstancingStats() const
 {
 	if (!PassNameForStats.IsEmpty() && TaskContext.VisibleMeshDrawCommandsNum > 0)
@@ -8,6 +8,7 @@ MeshDrawCommands.h: Mesh draw commands.
 
 #include "MeshPassProcessor.h"
 #include "TranslucencyPass.h"
+#include "GPUSceneCulling.h"
 
 struct FMeshBatchAndRelevance;
 class FStaticMeshBatch;
@@ -69,6 +70,9 @@ public:
 		, PrimitiveIdBufferData(nullptr)
 		, PrimitiveIdBufferDataSize(0)
 		, PrimitiveBounds(nullptr)
+		, bGPUCulling(false)
+		, CullingRecordData(nullptr)
+		, CullingIndirectArgsBuffer(nullptr)
 		, VisibleMeshDrawCommandsNum(0)
 		, NewPassVisibleMeshDrawCommandsNum(0)
 		, MaxInstances(1)
@@ -117,6 +121,11 @@ public:
 	FMatrix ViewMatrix;
 	const TArray<struct FPrimitiveBounds>* PrimitiveBounds;
 
+	// GPU culling of the pass draws, see GPUSceneCulling.h.
+	bool bGPUCulling;
+	FMeshDrawCullingRecord* CullingRecordData;
+	FRHIVertexBuffer* CullingIndirectArgsBuffer;
+
 	// For logging instancing stats.
 	int32 VisibleMeshDrawCommandsNum;
 	int32 NewPassVisibleMeshDrawCommandsNum;
@@ -132,6 +141,7 @@ class FParallelMeshDrawCommandPass
 public:
 	FParallelMeshDrawCommandPass()
 		: bPrimitiveIdBufferDataOwnedByRHIThread(false)
+		, bGPUCullingDispatched(false)
 		, MaxNumDraws(0)
 	{
 	}
@@ -163,6 +173,12 @@ public:
 	 */
 	void DispatchDraw(FParallelCommandListSet* ParallelCommandListSet, FRHICommandList& RHICmdList) const;
 
+	/**
+	 * Dispatch GPU culling of the pass draws if enabled for this pass, waiting for the pass setup task.
+	 * Must be called outside of a render pass before DispatchDraw.
+	 */
+	void DispatchGPUCulling(FRHICommandListImmediate& RHICmdList) const;
+
 	void WaitForTasksAndEmpty();
 	void SetDumpInstancingStats(const FString& InPassName);
 	bool HasAnyDraw() const { return MaxNumDraws > 0; }
@@ -181,6 +197,7 @@ public:
 
 private:
 	FPrimitiveIdVertexBufferPoolEntry PrimitiveIdVertexBufferPoolEntry;
+	FMeshDrawCullingBuffers CullingBuffers;
 	FMeshDrawCommandPassSetupTaskContext TaskContext;
 	FGraphEventRef TaskEventRef;
 	FString PassNameForStats;
@@ -188,6 +205,9 @@ private:
 	// If TaskContext::PrimitiveIdBufferData will be released by RHI Thread.
 	mutable bool bPrimitiveIdBufferDataOwnedByRHIThread;
 
+	// If the draws were culled on the GPU, and have to use the culled primitive id buffer.
+	mutable bool bGPUCullingDispatched;
+
 	// Maximum number of draws for this pass. Used to prealocate resources on rendering thread. 
 	// Has a guarantee that if there won't be any draws, then MaxNumDraws = 0;
 	int32 MaxNumDraws;
@@ -34,6 +34,15 @@ static FAutoConsoleVariableRef CVarEmitMeshDrawEvent(
 	ECVF_RenderThreadSafe
 );
 
+int32 GSkipMeshDrawsWhilePSOCompiling = 0;
+static FAutoConsoleVariableRef CVarSkipMeshDrawsWhilePSOCompiling(
+	TEXT("r.SkipMeshDrawsWhilePSOCompiling"),
+	GSkipMeshDrawsWhilePSOCompiling,
+	TEXT("Whether mesh draw commands whose pipeline state is still compiling asynchronously are skipped instead of stalling the RHI thread.\n")
+	TEXT("Skipped meshes pop in once their pipeline is ready. Only has an effect with r.AsyncPipelineCompile."),
+	ECVF_RenderThreadSafe
+);
+
 static TAutoConsoleVariable<int32> CVarSafeStateLookup(
 	TEXT("r.SafeStateLookup"),
 	1,
@@ -1135,7 +1144,13 @@ void FMeshDrawCommand::SubmitDraw(
 	{
 		FGraphicsPipelineStateInitializer GraphicsPSOInit = MeshPipelineState.AsGraphicsPipelineStateInitializer();
 		RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
-		SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
+
+		const EGraphicsPipelineCacheFlags CacheFlags = GSkipMeshDrawsWhilePSOCompiling ? EGraphicsPipelineCacheFlags::NonBlocking : EGraphicsPipelineCacheFlags::Default;
+		if (!SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, EApplyRendertargetOption::CheckApply, true, CacheFlags))
+		{
+			// Leave the state cache untouched so the next draw sets its own pipeline
+			return;
+		}
 		StateCache.SetPipelineState(MeshDrawCommand.CachedPipelineId.GetId());
 	}
 
@@ -20,6 +20,14 @@
 #include "Async/ParallelFor.h"
 #include "ProfilingDebugging/ExternalProfiler.h"
 
+static int32 GParallelUpdateSceneArraysMinPrimitives = 256;
+static FAutoConsoleVariableRef CVarParallelUpdateSceneArraysMinPrimitives(
+	TEXT("r.Scene.ParallelUpdateSceneArraysMinPrimitives"),
+	GParallelUpdateSceneArraysMinPrimitives,
+	TEXT("Minimum number of primitives added to the scene at once for their bounds and flags to be stored in the packed scene arrays from worker threads."),
+	ECVF_RenderThreadSafe
+	);
+
 /** An implementation of FStaticPrimitiveDrawInterface that stores the drawn elements for the rendering thread to use. */
 class FBatchingSPDI : public FStaticPrimitiveDrawInterface
 {
@@ -751,13 +759,22 @@ void FPrimitiveSceneInfo::AddToScene(FRHICommandListImmediate& RHICmdList, FScen
 		SCOPED_NAMED_EVENT(FPrimitiveSceneInfo_AddToScene_UpdateBounds, FColor::Cyan);
 		for (FPrimitiveSceneInfo* SceneInfo : SceneInfos)
 		{
-			FPrimitiveSceneProxy* Proxy = SceneInfo->Proxy;
-			int32 PackedIndex = SceneInfo->PackedIndex;
-
-			if (Proxy->CastsDynamicIndirectShadow())
+			if (SceneInfo->Proxy->CastsDynamicIndirectShadow())
 			{
 				Scene->DynamicIndirectCasterPrimitives.Add(SceneInfo);
 			}
+			Scene->MarkPrimitiveCullingDirty(SceneInfo->PackedIndex);
+		}
+
+		// Each primitive only writes to its own entry of the packed arrays
+		const EParallelForFlags ParallelForFlags = SceneInfos.Num() >= GParallelUpdateSceneArraysMinPrimitives && FApp::ShouldUseThreadingForPerformance()
+			? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+		ParallelForTemplate(SceneInfos.Num(), [Scene, &SceneInfos](int32 Index)
+		{
+			FPrimitiveSceneInfo* SceneInfo = SceneInfos[Index];
+			FPrimitiveSceneProxy* Proxy = SceneInfo->Proxy;
+			int32 PackedIndex = SceneInfo->PackedIndex;
 
 			Scene->PrimitiveSceneProxies[PackedIndex] = Proxy;
 			Scene->PrimitiveTransforms[PackedIndex] = Proxy->GetLocalToWorld();
@@ -814,7 +831,7 @@ void FPrimitiveSceneInfo::AddToScene(FRHICommandListImmediate& RHICmdList, FScen
 
 			// Store the component.
 			Scene->PrimitiveComponentIds[PackedIndex] = SceneInfo->PrimitiveComponentId;
-		}
+		}, ParallelForFlags);
 	}
 
 	{
@@ -3555,6 +3555,9 @@ void FScene::ApplyWorldOffset_RenderThread(const FVector& InOffset)
 		PrimitiveBounds[Idx].BoxSphereBounds.Origin+= InOffset;
 	}
 
+	++PrimitiveCullingUpdateId;
+	PrimitiveCullingWordUpdateIds.Init(PrimitiveCullingUpdateId, FMath::DivideAndRoundUp(PrimitiveBounds.Num(), (int32)NumBitsPerDWORD));
+
 	// Primitive occlusion bounds
 	for (int32 Idx = 0; Idx < PrimitiveOcclusionBounds.Num(); ++Idx)
 	{
@@ -3767,6 +3770,8 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRHICommandListImmediate& RHICmdList,
 
 	check(IsInRenderingThread());
 
+	++PrimitiveCullingUpdateId;
+
 	TArray<FPrimitiveSceneInfo*> RemovedLocalPrimitiveSceneInfos(RemovedPrimitiveSceneInfos.Array());
 	RemovedLocalPrimitiveSceneInfos.Sort(FPrimitiveArraySortKey());
 
@@ -3872,6 +3877,8 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRHICommandListImmediate& RHICmdList,
 
 							AddPrimitiveToUpdateGPU(*this, SourceIndex);
 							AddPrimitiveToUpdateGPU(*this, DestIndex);
+							MarkPrimitiveCullingDirty(SourceIndex);
+							MarkPrimitiveCullingDirty(DestIndex);
 
 							SourceIndex = DestIndex;
 						}
@@ -3923,6 +3930,7 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRHICommandListImmediate& RHICmdList,
 				FScopeCycleCounter Context(PrimitiveSceneInfo->Proxy->GetStatId());
 				int32 PrimitiveIndex = PrimitiveSceneInfo->PackedIndex;
 				PrimitiveSceneInfo->PackedIndex = INDEX_NONE;
+				MarkPrimitiveCullingDirty(PrimitiveIndex);
 
 				if (ShouldPrimitiveOutputVelocity(PrimitiveSceneInfo->Proxy, GetShaderPlatform()))
 				{
@@ -3972,6 +3980,10 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRHICommandListImmediate& RHICmdList,
 			PrimitivesNeedingStaticMeshUpdate.Reserve(PrimitivesNeedingStaticMeshUpdate.Num() + AddedLocalPrimitiveSceneInfos.Num());
 		}
 
+		// The primitives are added to the packed arrays one proxy type at a time, but only added to the scene once all of them
+		// reached their final packed index, so that the work of AddToScene is spread over a single large batch
+		TArray<FPrimitiveSceneInfo*> SceneInfosToAdd(AddedLocalPrimitiveSceneInfos);
+
 		while (AddedLocalPrimitiveSceneInfos.Num())
 		{
 			int StartIndex = AddedLocalPrimitiveSceneInfos.Num() - 1;
@@ -4078,6 +4090,8 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRHICommandListImmediate& RHICmdList,
 							TBitArraySwapElements(PrimitivesNeedingStaticMeshUpdate, DestIndex, SourceIndex);
 
 							AddPrimitiveToUpdateGPU(*this, DestIndex);
+							MarkPrimitiveCullingDirty(SourceIndex);
+							MarkPrimitiveCullingDirty(DestIndex);
 						}
 					}
 				}
@@ -4096,62 +4110,61 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRHICommandListImmediate& RHICmdList,
 				PrimitiveSceneInfo->LinkAttachmentGroup();
 			}
 
+			AddedLocalPrimitiveSceneInfos.RemoveAt(StartIndex, AddedLocalPrimitiveSceneInfos.Num() - StartIndex);
+		}
 
+		if (SceneInfosToAdd.Num())
+		{
+			SCOPED_NAMED_EVENT(FScene_AddPrimitiveSceneInfoToScene, FColor::Turquoise);
+			if (GIsEditor)
+			{
+				FPrimitiveSceneInfo::AddToScene(RHICmdList, this, SceneInfosToAdd, true);
+			}
+			else
 			{
-				SCOPED_NAMED_EVENT(FScene_AddPrimitiveSceneInfoToScene, FColor::Turquoise);
-				if (GIsEditor)
+				const bool bAddToDrawLists = !(CVarDoLazyStaticMeshUpdate.GetValueOnRenderThread());
+				if (bAddToDrawLists)
 				{
-					FPrimitiveSceneInfo::AddToScene(RHICmdList, this, TArrayView<FPrimitiveSceneInfo*>(&AddedLocalPrimitiveSceneInfos[StartIndex], AddedLocalPrimitiveSceneInfos.Num() - StartIndex), true);
+					FPrimitiveSceneInfo::AddToScene(RHICmdList, this, SceneInfosToAdd, true, true, bAsyncCreateLPIs);
 				}
 				else
 				{
-					const bool bAddToDrawLists = !(CVarDoLazyStaticMeshUpdate.GetValueOnRenderThread());
-					if (bAddToDrawLists)
-					{
-						FPrimitiveSceneInfo::AddToScene(RHICmdList, this, TArrayView<FPrimitiveSceneInfo*>(&AddedLocalPrimitiveSceneInfos[StartIndex], AddedLocalPrimitiveSceneInfos.Num() - StartIndex), true, true, bAsyncCreateLPIs);
-					}
-					else
-					{
-						FPrimitiveSceneInfo::AddToScene(RHICmdList, this, TArrayView<FPrimitiveSceneInfo*>(&AddedLocalPrimitiveSceneInfos[StartIndex], AddedLocalPrimitiveSceneInfos.Num() - StartIndex), true, false, bAsyncCreateLPIs);
+					FPrimitiveSceneInfo::AddToScene(RHICmdList, this, SceneInfosToAdd, true, false, bAsyncCreateLPIs);
 
-						for (int AddIndex = StartIndex; AddIndex < AddedLocalPrimitiveSceneInfos.Num(); AddIndex++)
-						{
-							FPrimitiveSceneInfo* PrimitiveSceneInfo = AddedLocalPrimitiveSceneInfos[AddIndex];
-							PrimitiveSceneInfo->BeginDeferredUpdateStaticMeshes();
-						}
+					for (FPrimitiveSceneInfo* PrimitiveSceneInfo : SceneInfosToAdd)
+					{
+						PrimitiveSceneInfo->BeginDeferredUpdateStaticMeshes();
 					}
 				}
 			}
+		}
 
-			for (int AddIndex = StartIndex; AddIndex < AddedLocalPrimitiveSceneInfos.Num(); AddIndex++)
-			{
-				FPrimitiveSceneInfo* PrimitiveSceneInfo = AddedLocalPrimitiveSceneInfos[AddIndex];
-				int32 PrimitiveIndex = PrimitiveSceneInfo->PackedIndex;
+		for (FPrimitiveSceneInfo* PrimitiveSceneInfo : SceneInfosToAdd)
+		{
+			int32 PrimitiveIndex = PrimitiveSceneInfo->PackedIndex;
 
-				if (ShouldPrimitiveOutputVelocity(PrimitiveSceneInfo->Proxy, GetShaderPlatform()))
-				{
-					// We must register the initial LocalToWorld with the velocity state. 
-					// In the case of a moving component with MarkRenderStateDirty() called every frame, UpdateTransform will never happen.
-					VelocityData.UpdateTransform(PrimitiveSceneInfo, PrimitiveTransforms[PrimitiveIndex], PrimitiveTransforms[PrimitiveIndex]);
-				}
+			if (ShouldPrimitiveOutputVelocity(PrimitiveSceneInfo->Proxy, GetShaderPlatform()))
+			{
+				// We must register the initial LocalToWorld with the velocity state. 
+				// In the case of a moving component with MarkRenderStateDirty() called every frame, UpdateTransform will never happen.
+				VelocityData.UpdateTransform(PrimitiveSceneInfo, PrimitiveTransforms[PrimitiveIndex], PrimitiveTransforms[PrimitiveIndex]);
+			}
 
-				AddPrimitiveToUpdateGPU(*this, PrimitiveIndex);
+			AddPrimitiveToUpdateGPU(*this, PrimitiveIndex);
 
-				// Invalidate PathTraced image because we added something to the scene
-				bPathTracingNeedsInvalidation = true;
+			// Invalidate PathTraced image because we added something to the scene
+			bPathTracingNeedsInvalidation = true;
 
-				DistanceFieldSceneData.AddPrimitive(PrimitiveSceneInfo);
+			DistanceFieldSceneData.AddPrimitive(PrimitiveSceneInfo);
 
-				// Flush virtual textures touched by primitive
-				PrimitiveSceneInfo->FlushRuntimeVirtualTexture();
+			// Flush virtual textures touched by primitive
+			PrimitiveSceneInfo->FlushRuntimeVirtualTexture();
 
-				// Set LOD parent information if valid
-				PrimitiveSceneInfo->LinkLODParentComponent();
+			// Set LOD parent information if valid
+			PrimitiveSceneInfo->LinkLODParentComponent();
 
-				// Update scene LOD tree
-				SceneLODHierarchy.UpdateNodeSceneInfo(PrimitiveSceneInfo->PrimitiveComponentId, PrimitiveSceneInfo);
-			}
-			AddedLocalPrimitiveSceneInfos.RemoveAt(StartIndex, AddedLocalPrimitiveSceneInfos.Num() - StartIndex);
+			// Update scene LOD tree
+			SceneLODHierarchy.UpdateNodeSceneInfo(PrimitiveSceneInfo->PrimitiveComponentId, PrimitiveSceneInfo);
 		}
 	}
 	{
@@ -69,6 +69,24 @@ static TAutoConsoleVariable<bool> CVarMobileEnableOcclusionExtraFrame(
 	ECVF_RenderThreadSafe
 	);
 
+static int32 GHZBOcclusionCompactResults = 0;
+static FAutoConsoleVariableRef CVarHZBOcclusionCompactResults(
+	TEXT("r.HZBOcclusion.CompactResults"),
+	GHZBOcclusionCompactResults,
+	TEXT("If not zero, the HZB occlusion tests run in a single compute dispatch that writes one visibility bit per primitive,\n")
+	TEXT("so only the bit buffer is read back instead of the full results texture."),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GHZBOcclusionNonBlockingReadback = 0;
+static FAutoConsoleVariableRef CVarHZBOcclusionNonBlockingReadback(
+	TEXT("r.HZBOcclusion.NonBlockingReadback"),
+	GHZBOcclusionNonBlockingReadback,
+	TEXT("If not zero, the render thread does not wait for the HZB occlusion results of the previous frame.\n")
+	TEXT("When they are not ready yet, the tested primitives are treated as visible and tested again."),
+	ECVF_RenderThreadSafe
+	);
+
 DEFINE_GPU_STAT(HZB);
 
 /** Random table for occlusion **/
@@ -757,6 +775,7 @@ static void ExecutePlanarReflectionOcclusionQuery(FRHICommandList& RHICmdList, u
 
 FHZBOcclusionTester::FHZBOcclusionTester()
 	: ResultsBuffer( NULL )
+	, bCompactResults( false )
 {
 	SetInvalidFrameNumber();
 }
@@ -803,6 +822,8 @@ void FHZBOcclusionTester::ReleaseDynamicRHI()
 	{
 		GRenderTargetPool.FreeUnusedResource( ResultsTextureCPU );
 		Fence.SafeRelease();
+		ResultsReadback.Reset();
+		bCompactResults = false;
 	}
 }
 
@@ -821,19 +842,32 @@ void FHZBOcclusionTester::MapResults(FRHICommandListImmediate& RHICmdList)
 
 	if (!IsInvalidFrame() )
 	{
-		uint32 IdleStart = FPlatformTime::Cycles();
+		const bool bResultsReady = bCompactResults ? ResultsReadback->IsReady() : Fence->Poll();
 
-		int32 Width = 0;
-		int32 Height = 0;
+		if (bResultsReady || !GHZBOcclusionNonBlockingReadback)
+		{
+			uint32 IdleStart = FPlatformTime::Cycles();
 
-		RHICmdList.MapStagingSurface(ResultsTextureCPU->GetRenderTargetItem().ShaderResourceTexture, Fence.GetReference(), *(void**)&ResultsBuffer, Width, Height);
+			if (bCompactResults)
+			{
+				ResultsBuffer = (const uint8*)ResultsReadback->Lock(NumResultWords * sizeof(uint32));
+			}
+			else
+			{
+				int32 Width = 0;
+				int32 Height = 0;
+
+				RHICmdList.MapStagingSurface(ResultsTextureCPU->GetRenderTargetItem().ShaderResourceTexture, Fence.GetReference(), *(void**)&ResultsBuffer, Width, Height);
+			}
 
-		// RHIMapStagingSurface will block until the results are ready (from the previous frame) so we need to consider this RT idle time
-		GRenderThreadIdle[ERenderThreadIdleTypes::WaitingForGPUQuery] += FPlatformTime::Cycles() - IdleStart;
-		GRenderThreadNumIdle[ERenderThreadIdleTypes::WaitingForGPUQuery]++;
+			// Mapping will block until the results are ready (from the previous frame) so we need to consider this RT idle time
+			GRenderThreadIdle[ERenderThreadIdleTypes::WaitingForGPUQuery] += FPlatformTime::Cycles() - IdleStart;
+			GRenderThreadNumIdle[ERenderThreadIdleTypes::WaitingForGPUQuery]++;
+		}
 	}
 	
 	// Can happen because of device removed, we might crash later but this occlusion culling system can behave gracefully.
+	// Also happens when the results are not ready with r.HZBOcclusion.NonBlockingReadback, the primitives are then tested again.
 	if( ResultsBuffer == NULL )
 	{
 		// First frame
@@ -848,7 +882,14 @@ void FHZBOcclusionTester::UnmapResults(FRHICommandListImmediate& RHICmdList)
 	check( ResultsBuffer );
 	if(!IsInvalidFrame())
 	{
-		RHICmdList.UnmapStagingSurface(ResultsTextureCPU->GetRenderTargetItem().ShaderResourceTexture);
+		if (bCompactResults)
+		{
+			ResultsReadback->Unlock();
+		}
+		else
+		{
+			RHICmdList.UnmapStagingSurface(ResultsTextureCPU->GetRenderTargetItem().ShaderResourceTexture);
+		}
 	}
 	ResultsBuffer = NULL;
 }
@@ -857,8 +898,12 @@ bool FHZBOcclusionTester::IsVisible( uint32 Index ) const
 {
 	checkSlow( ResultsBuffer );
 	checkSlow( Index < SizeX * SizeY );
-	
-	// TODO shader compress to bits
+
+	if (bCompactResults)
+	{
+		const uint32* ResultWords = (const uint32*)ResultsBuffer;
+		return (ResultWords[ Index / 32 ] & (1u << (Index % 32))) != 0;
+	}
 
 #if 0
 	return ResultsBuffer[ 4 * Index ] != 0;
@@ -886,6 +931,28 @@ bool FHZBOcclusionTester::IsVisible( uint32 Index ) const
 #endif
 }
 
+static void GetHZBTestParameters(const FViewInfo& View, FVector& OutHZBUvFactor, FVector4& OutHZBSize)
+{
+	/*
+	 * Defines the maximum number of mipmaps the HZB test is considering
+	 * to avoid memory cache trashing when rendering on high resolution.
+	 */
+	const float kHZBTestMaxMipmap = 9.0f;
+
+	const float HZBMipmapCounts = FMath::Log2(FMath::Max(View.HZBMipmap0Size.X, View.HZBMipmap0Size.Y));
+	OutHZBUvFactor = FVector(
+		float(View.ViewRect.Width()) / float(2 * View.HZBMipmap0Size.X),
+		float(View.ViewRect.Height()) / float(2 * View.HZBMipmap0Size.Y),
+		FMath::Max(HZBMipmapCounts - kHZBTestMaxMipmap, 0.0f)
+		);
+	OutHZBSize = FVector4(
+		View.HZBMipmap0Size.X,
+		View.HZBMipmap0Size.Y,
+		1.0f / float(View.HZBMipmap0Size.X),
+		1.0f / float(View.HZBMipmap0Size.Y)
+		);
+}
+
 class FHZBTestPS : public FGlobalShader
 {
 	DECLARE_SHADER_TYPE(FHZBTestPS, Global);
@@ -926,24 +993,9 @@ public:
 
 		FGlobalShader::SetParameters<FViewUniformShaderParameters>(RHICmdList, ShaderRHI, View.ViewUniformBuffer);
 
-		/*
-		 * Defines the maximum number of mipmaps the HZB test is considering
-		 * to avoid memory cache trashing when rendering on high resolution.
-		 */
-		const float kHZBTestMaxMipmap = 9.0f;
-
-		const float HZBMipmapCounts = FMath::Log2(FMath::Max(View.HZBMipmap0Size.X, View.HZBMipmap0Size.Y));
-		const FVector HZBUvFactorValue(
-			float(View.ViewRect.Width()) / float(2 * View.HZBMipmap0Size.X),
-			float(View.ViewRect.Height()) / float(2 * View.HZBMipmap0Size.Y),
-			FMath::Max(HZBMipmapCounts - kHZBTestMaxMipmap, 0.0f)
-			);
-		const FVector4 HZBSizeValue(
-			View.HZBMipmap0Size.X,
-			View.HZBMipmap0Size.Y,
-			1.0f / float(View.HZBMipmap0Size.X),
-			1.0f / float(View.HZBMipmap0Size.Y)
-			);
+		FVector HZBUvFactorValue;
+		FVector4 HZBSizeValue;
+		GetHZBTestParameters(View, HZBUvFactorValue, HZBSizeValue);
 		SetShaderValue(RHICmdList, ShaderRHI, HZBUvFactor, HZBUvFactorValue);
 		SetShaderValue(RHICmdList, ShaderRHI, HZBSize, HZBSizeValue);
 
@@ -956,6 +1008,41 @@ public:
 
 IMPLEMENT_SHADER_TYPE(,FHZBTestPS,TEXT("/Engine/Private/HZBOcclusion.usf"),TEXT("HZBTestPS"),SF_Pixel);
 
+/** Tests all the bounds of a frame in one dispatch, writing one visibility bit per primitive */
+class FHZBTestCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FHZBTestCS);
+	SHADER_USE_PARAMETER_STRUCT(FHZBTestCS, FGlobalShader);
+
+public:
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_REF(FViewUniformShaderParameters, View)
+		SHADER_PARAMETER(FVector, HZBUvFactor)
+		SHADER_PARAMETER(FVector4, HZBSize)
+		SHADER_PARAMETER(uint32, NumPrimitives)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, HZBTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, HZBSampler)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, BoundsCenterTexture)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, BoundsExtentTexture)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, RWVisibilityBits)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 64;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+IMPLEMENT_GLOBAL_SHADER(FHZBTestCS, "/Engine/Private/HZBOcclusionCompute.usf", "HZBTestCS", SF_Compute);
+
 BEGIN_SHADER_PARAMETER_STRUCT(FHZBOcclusionUpdateTexturesParameters, )
 	RDG_TEXTURE_ACCESS(BoundsCenterTexture, ERHIAccess::CopyDest)
 	RDG_TEXTURE_ACCESS(BoundsExtentTexture, ERHIAccess::CopyDest)
@@ -978,6 +1065,10 @@ void FHZBOcclusionTester::Submit(FRDGBuilder& GraphBuilder, const FViewInfo& Vie
 		return;
 	}
 
+	// Primitives are emptied once uploaded
+	const uint32 NumPrimitives = Primitives.Num();
+	bCompactResults = GHZBOcclusionCompactResults != 0;
+
 	FRDGTextureRef BoundsCenterTexture = nullptr;
 	FRDGTextureRef BoundsExtentTexture = nullptr;
 
@@ -987,12 +1078,6 @@ void FHZBOcclusionTester::Submit(FRDGBuilder& GraphBuilder, const FViewInfo& Vie
 		BoundsExtentTexture = GraphBuilder.CreateTexture(Desc, TEXT("HZBBoundsExtent"));
 	}
 
-	FRDGTextureRef ResultsTextureGPU = nullptr;
-	{
-		const FRDGTextureDesc Desc(FRDGTextureDesc::Create2D(FIntPoint(SizeX, SizeY), PF_B8G8R8A8, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_RenderTargetable));
-		ResultsTextureGPU = GraphBuilder.CreateTexture(Desc, TEXT("HZBResultsGPU"));
-	}
-
 	{
 		auto* PassParameters = GraphBuilder.AllocParameters<FHZBOcclusionUpdateTexturesParameters>();
 		PassParameters->BoundsCenterTexture = BoundsCenterTexture;
@@ -1052,6 +1137,51 @@ void FHZBOcclusionTester::Submit(FRDGBuilder& GraphBuilder, const FViewInfo& Vie
 		});
 	}
 
+	if (bCompactResults)
+	{
+		FRDGBufferRef VisibilityBits = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), NumResultWords), TEXT("HZBVisibilityBits"));
+		FRDGBufferUAVRef VisibilityBitsUAV = GraphBuilder.CreateUAV(VisibilityBits, PF_R32_UINT);
+		AddClearUAVPass(GraphBuilder, VisibilityBitsUAV, 0);
+
+		FVector HZBUvFactor;
+		FVector4 HZBSize;
+		GetHZBTestParameters(View, HZBUvFactor, HZBSize);
+
+		auto* PassParameters = GraphBuilder.AllocParameters<FHZBTestCS::FParameters>();
+		PassParameters->View = View.ViewUniformBuffer;
+		PassParameters->HZBUvFactor = HZBUvFactor;
+		PassParameters->HZBSize = HZBSize;
+		PassParameters->NumPrimitives = NumPrimitives;
+		PassParameters->HZBTexture = GraphBuilder.RegisterExternalTexture(View.HZB);
+		PassParameters->HZBSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		PassParameters->BoundsCenterTexture = BoundsCenterTexture;
+		PassParameters->BoundsExtentTexture = BoundsExtentTexture;
+		PassParameters->RWVisibilityBits = VisibilityBitsUAV;
+
+		TShaderMapRef<FHZBTestCS> ComputeShader(View.ShaderMap);
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("TestHZB(Compute)"),
+			ComputeShader,
+			PassParameters,
+			FComputeShaderUtils::GetGroupCount(NumPrimitives, FHZBTestCS::ThreadGroupSize));
+
+		if (!ResultsReadback)
+		{
+			ResultsReadback = MakeUnique<FRHIGPUBufferReadback>(TEXT("HZBResultsReadback"));
+		}
+
+		// Transfer memory GPU -> CPU, 1 bit instead of 4 bytes per primitive
+		AddEnqueueCopyPass(GraphBuilder, ResultsReadback.Get(), VisibilityBits, NumResultWords * sizeof(uint32));
+		return;
+	}
+
+	FRDGTextureRef ResultsTextureGPU = nullptr;
+	{
+		const FRDGTextureDesc Desc(FRDGTextureDesc::Create2D(FIntPoint(SizeX, SizeY), PF_B8G8R8A8, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_RenderTargetable));
+		ResultsTextureGPU = GraphBuilder.CreateTexture(Desc, TEXT("HZBResultsGPU"));
+	}
+
 	// Draw test
 	{
 		auto* PassParameters = GraphBuilder.AllocParameters<FHZBOcclusionTestHZBParameters>();
@@ -756,6 +756,58 @@ public:
 	FHLODVisibilityState HLODVisibilityState;
 	TMap<FPrimitiveComponentId, FHLODSceneNodeVisibilityState> HLODSceneNodeVisibilityStates;
 
+	/** Frustum culling results of the previous frame, reused for the primitives that didn't change while the view is static. */
+	struct FFrustumCullCache
+	{
+		const FScene* Scene = nullptr;
+		FConvexVolume::FPlaneArray Planes;
+		FVector ViewOrigin = FVector::ZeroVector;
+		float MaxDrawDistanceScale = 0.0f;
+		float FadeRadius = 0.0f;
+		uint32 CullFlags = 0;
+		int32 NumPrimitives = 0;
+		/** FScene::PrimitiveCullingUpdateId when the results were computed */
+		uint32 SceneUpdateId = 0;
+
+		/** Words of the view's PrimitiveVisibilityMap, PotentiallyFadingPrimitiveMap and DistanceCullingPrimitiveMap */
+		TArray<uint32> VisibilityWords;
+		TArray<uint32> FadingWords;
+		TArray<uint32> DistanceCulledWords;
+
+		void Reset()
+		{
+			Scene = nullptr;
+			NumPrimitives = 0;
+		}
+	};
+	FFrustumCullCache FrustumCullCache;
+
+	/** Shadow casters found by the last gather of a view dependent whole scene shadow, reused while its inputs and casters don't change. */
+	struct FCachedShadowSubjects
+	{
+		FVector ShadowBoundsCenter = FVector::ZeroVector;
+		float ShadowBoundsRadius = 0.0f;
+		FVector PreShadowTranslation = FVector::ZeroVector;
+		FVector LightDirection = FVector::ZeroVector;
+		FVector ViewOrigin = FVector::ZeroVector;
+		float LODDistanceFactor = 0.0f;
+		float MinScreenRadius = 0.0f;
+		uint32 Flags = 0;
+		FConvexVolume::FPlaneArray CasterFrustumPlanes;
+		FConvexVolume::FPlaneArray ShadowBoundsAccuratePlanes;
+
+		/** FScene::PrimitiveCullingUpdateId the casters are up to date with */
+		uint32 SceneUpdateId = 0;
+		uint32 LastUsedFrameNumber = 0;
+		bool bValid = false;
+
+		/** Primitives that passed the culling tests of the shadow, and their packed indices when they were gathered */
+		TArray<FPrimitiveSceneInfo*> Primitives;
+		TBitArray<> PrimitiveIndices;
+	};
+	/** Keyed by light and cascade */
+	TMap<TPair<const FLightSceneInfo*, int32>, FCachedShadowSubjects> CachedShadowSubjects;
+
 	// Software occlusion data
 	TUniquePtr<FSceneSoftwareOcclusion> SceneSoftwareOcclusion;
 
@@ -2491,6 +2543,24 @@ public:
 	TArray<FPrimitiveVirtualTextureLodInfo> PrimitiveVirtualTextureLod;
 
 	TBitArray<> PrimitivesNeedingStaticMeshUpdate;
+
+	/**
+	 * FScene::PrimitiveCullingUpdateId of the last change to each word of 32 packed primitives, used by the views to only
+	 * frustum cull again the primitives that were added, removed, moved or reordered since their previous frame.
+	 */
+	TArray<uint32> PrimitiveCullingWordUpdateIds;
+	/** Incremented each time the packed primitive arrays are updated */
+	uint32 PrimitiveCullingUpdateId = 0;
+
+	void MarkPrimitiveCullingDirty(int32 PackedIndex)
+	{
+		const int32 WordIndex = PackedIndex / (int32)NumBitsPerDWORD;
+		if (WordIndex >= PrimitiveCullingWordUpdateIds.Num())
+		{
+			PrimitiveCullingWordUpdateIds.SetNumZeroed(WordIndex + 1);
+		}
+		PrimitiveCullingWordUpdateIds[WordIndex] = PrimitiveCullingUpdateId;
+	}
 	TSet<FPrimitiveSceneInfo*> PrimitivesNeedingStaticMeshUpdateWithoutVisibilityCheck;
 
 	struct FTypeOffsetTableEntry
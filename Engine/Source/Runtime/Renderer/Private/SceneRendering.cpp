@@ -3558,6 +3558,7 @@ void FSceneRenderer::WaitForTasksClearSnapshotsAndDeleteSceneRenderer(FRHIComman
 
 	// Can relase only after all mesh pass tasks are finished.
 	GPrimitiveIdVertexBufferPool.DiscardAll();
+	GMeshDrawCullingBufferPool.DiscardAll();
 	FGraphicsMinimalPipelineStateId::ResetLocalPipelineIdTableSize();
 
 	delete LocalRootMark;
@@ -4031,6 +4032,7 @@ void FRendererModule::PerFrameCleanupIfSkipRenderer()
 		[](FRHICommandListImmediate&)
 	{
 		GPrimitiveIdVertexBufferPool.DiscardAll();
+		GMeshDrawCullingBufferPool.DiscardAll();
 	});
 }
 
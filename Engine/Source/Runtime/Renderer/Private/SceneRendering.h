@@ -458,12 +458,19 @@ private:
 	enum { SizeY = 256 };
 	enum { FrameNumberMask = 0x7fffffff };
 	enum { InvalidFrameNumber = 0xffffffff };
+	enum { NumResultWords = SizeX * SizeY / 32 };
 
 	TArray< FOcclusionPrimitive, SceneRenderingAllocator >	Primitives;
 
 	TRefCountPtr<IPooledRenderTarget>	ResultsTextureCPU;
 	const uint8*						ResultsBuffer;
 
+	/** Readback of the one bit per primitive results written by the compute test, see r.HZBOcclusion.CompactResults */
+	TUniquePtr<FRHIGPUBufferReadback>	ResultsReadback;
+
+	/** Whether the results in flight were written by the compute test to ResultsReadback rather than to ResultsTextureCPU */
+	bool bCompactResults;
+
 
 	bool IsInvalidFrame() const;
 
@@ -925,6 +932,10 @@ struct FPreviousViewInfo
 	// Bleed free scene color to use for screen space ray tracing.
 	TRefCountPtr<IPooledRenderTarget> ScreenSpaceRayTracingInput;
 
+	// Furthest HZB of the previous frame, for GPU culling of mesh draw commands.
+	TRefCountPtr<IPooledRenderTarget> HZB;
+	FIntPoint HZBMipmap0Size = FIntPoint::ZeroValue;
+
 	// Temporal AA result of last frame
 	FTemporalAAHistory TemporalAAHistory;
 
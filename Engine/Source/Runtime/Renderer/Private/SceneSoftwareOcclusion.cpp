@@ -12,6 +12,7 @@
 #include "RenderTargetTemp.h"
 #include "CanvasTypes.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "Async/ParallelFor.h"
 #include "Math/Vector.h"
 
 DECLARE_STATS_GROUP(TEXT("Software Occlusion"),STATGROUP_SoftwareOcclusion, STATCAT_Advanced);
@@ -61,6 +62,14 @@ static FAutoConsoleVariableRef CVarSOSIMD(
 	ECVF_RenderThreadSafe
 	);
 
+static int32 GSOParallelBins = 1;
+static FAutoConsoleVariableRef CVarSOParallelBins(
+	TEXT("r.so.ParallelBins"),
+	GSOParallelBins,
+	TEXT("Rasterize the framebuffer bins of software occlusion in parallel tasks"),
+	ECVF_RenderThreadSafe
+	);
+
 static int32 GSOVisualizeBuffer = 0;
 static FAutoConsoleVariableRef CVarSOVisualizeBuffer(
 	TEXT("r.so.VisualizeBuffer"),
@@ -554,6 +563,9 @@ static bool ProcessOccludeeGeom(const FOcclusionSceneData& SceneData, FOcclusion
 			ST.V[1] = {MaxX, MaxY};
 			ST.V[2] = {MinX, MaxY};
 			AddTriangle(ST, Depth, PrimitiveId, 0, FrameData);
+
+			// Occluded until a bin finds it visible, so bins never add to the map while rasterizing in parallel
+			VisibilityMap.FindOrAdd(PrimitiveId);
 		}
 
 		MinMax+= (RunSize*2);
@@ -830,8 +842,13 @@ static void ProcessOcclusionFrame(const FOcclusionSceneData& InSceneData, FOcclu
 		const uint8* MeshFlags = FrameData.ScreenTrianglesFlags.GetData();
 		const FPrimitiveComponentId* PrimitiveIds = FrameData.ScreenTrianglesPrimID.GetData();
 		const FScreenTriangle* Tris = FrameData.ScreenTriangles.GetData();
-						
-		for (int32 BinIdx = 0; BinIdx < BIN_NUM; ++BinIdx)
+
+		// Bins only write to their own framebuffer data, visible occludees are merged once all bins are done
+		TArray<FPrimitiveComponentId> VisibleOccludees[BIN_NUM];
+		int32 NumBinOccluderTris[BIN_NUM] = {};
+		int32 NumBinOccludeeTris[BIN_NUM] = {};
+
+		ParallelFor(BIN_NUM, [&](int32 BinIdx)
 		{
 			// Sort triangles in the bin by depth
 			FrameData.SortedTriangles[BinIdx].Sort([](const FSortedIndexDepth& A, const FSortedIndexDepth& B) { 
@@ -856,17 +873,29 @@ static void ProcessOcclusionFrame(const FOcclusionSceneData& InSceneData, FOcclu
 				{
 					// rasterize occluder
 					RasterizeOccluderTri(Tri, Bin.Data, BinMinX);
-					NumRasterizedOccluderTris++;
+					NumBinOccluderTris[BinIdx]++;
 				}
 				else
 				{
 					// rasterize occludee
-					bool& VisBit = OutResults.VisibilityMap.FindOrAdd(PrimitiveId);
-					bool bVisible = RasterizeOccludeeQuad(Tri, Bin.Data, BinMinX);
-					VisBit|= bVisible;
-					NumRasterizedOccludeeTris++;
+					if (RasterizeOccludeeQuad(Tri, Bin.Data, BinMinX))
+					{
+						VisibleOccludees[BinIdx].Add(PrimitiveId);
+					}
+					NumBinOccludeeTris[BinIdx]++;
 				}
 			}
+		}, GSOParallelBins == 0);
+
+		for (int32 BinIdx = 0; BinIdx < BIN_NUM; ++BinIdx)
+		{
+			for (FPrimitiveComponentId PrimitiveId : VisibleOccludees[BinIdx])
+			{
+				OutResults.VisibilityMap.FindChecked(PrimitiveId) = true;
+			}
+
+			NumRasterizedOccluderTris+= NumBinOccluderTris[BinIdx];
+			NumRasterizedOccludeeTris+= NumBinOccludeeTris[BinIdx];
 		}
 	}
 	
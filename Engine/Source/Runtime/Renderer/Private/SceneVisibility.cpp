@@ -475,6 +475,54 @@ static FAutoConsoleVariableRef CVarFrustumCullNumWordsPerTask(
 	ECVF_Default
 	);
 
+static int32 GFrustumCullTemporalCoherence = 1;
+static FAutoConsoleVariableRef CVarFrustumCullTemporalCoherence(
+	TEXT("r.FrustumCullTemporalCoherence"),
+	GFrustumCullTemporalCoherence,
+	TEXT("Whether views that didn't move since their previous frame reuse the frustum culling results of the primitives that didn't change.\n")
+	TEXT("Only used when neither precomputed visibility nor HLODs are active in the view."),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GFrustumCullOctreeMinPrimitives = 0;
+static FAutoConsoleVariableRef CVarFrustumCullOctreeMinPrimitives(
+	TEXT("r.FrustumCullOctreeMinPrimitives"),
+	GFrustumCullOctreeMinPrimitives,
+	TEXT("Number of primitives in the scene from which frustum culling first tests the nodes of the scene's primitive octree,\n")
+	TEXT("culling the primitives of nodes outside the frustum and skipping the frustum test of the ones of nodes inside it. 0 to disable.\n")
+	TEXT("Not used when ray tracing is enabled, as it needs the distance culling results of the primitives outside the frustum."),
+	ECVF_RenderThreadSafe
+	);
+
+/**
+ * Tests the nodes of the scene's primitive octree against the view frustum.
+ * Primitives whose bit isn't set in OutIntersectingMap are outside the frustum, the ones set in OutContainedMap are inside it.
+ */
+static void OctreeFrustumCull(const FScene* Scene, const FViewInfo& View, FSceneBitArray& OutIntersectingMap, FSceneBitArray& OutContainedMap)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FrustumCull_Octree);
+
+	OutIntersectingMap.Init(false, Scene->Primitives.Num());
+	OutContainedMap.Init(false, Scene->Primitives.Num());
+
+	// Elements only go to a child node if they fit in its loose bounds, so nodes inside the frustum only hold primitives inside it.
+	// The predicate is called right before its node is passed to the iterate function.
+	bool bNodeContained = false;
+	Scene->PrimitiveOctree.FindNodesWithPredicate(
+		[&View, &bNodeContained](const FBoxCenterAndExtent& NodeBounds)
+		{
+			return View.ViewFrustum.IntersectBox(FVector(NodeBounds.Center), FVector(NodeBounds.Extent), bNodeContained);
+		},
+		[Scene, &OutIntersectingMap, &OutContainedMap, &bNodeContained](FScenePrimitiveOctree::FNodeIndex NodeIndex)
+		{
+			for (const FPrimitiveSceneInfoCompact& Element : Scene->PrimitiveOctree.GetElementsForNode(NodeIndex))
+			{
+				const int32 PrimitiveIndex = Element.PrimitiveSceneInfo->GetIndex();
+				OutIntersectingMap[PrimitiveIndex] = true;
+				OutContainedMap[PrimitiveIndex] = bNodeContained;
+			}
+		});
+}
 
 template<bool UseCustomCulling, bool bAlsoUseSphereTest, bool bUseFastIntersect>
 static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
@@ -489,6 +537,42 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 	const bool bHLODActive = Scene->SceneLODHierarchy.IsActive();
 	const FHLODVisibilityState* const HLODState = bHLODActive && ViewState ? &ViewState->HLODVisibilityState : nullptr;
 
+	// Precomputed visibility and HLOD transitions change without the view or the primitives changing, so their results can't be reused
+	FSceneViewState::FFrustumCullCache* CullCache = nullptr;
+	int32 NumReusableWords = 0;
+	if (ViewState)
+	{
+		if (GFrustumCullTemporalCoherence && !UseCustomCulling && !HLODState)
+		{
+			CullCache = &ViewState->FrustumCullCache;
+
+			const float CacheFadeRadius = GDisableLODFade ? 0.0f : GDistanceFadeMaxTravel;
+			const uint32 CullFlags = (bAlsoUseSphereTest ? 1 : 0) | (bUseFastIntersect ? 2 : 0) | (View.Family->EngineShowFlags.DistanceCulledPrimitives ? 4 : 0);
+
+			if (CullCache->Scene == Scene
+				&& CullCache->CullFlags == CullFlags
+				&& CullCache->MaxDrawDistanceScale == MaxDrawDistanceScale
+				&& CullCache->FadeRadius == CacheFadeRadius
+				&& CullCache->ViewOrigin == View.ViewMatrices.GetViewOrigin()
+				&& CullCache->Planes == View.ViewFrustum.Planes)
+			{
+				// Only whole words, the last one changes when primitives are added or removed
+				NumReusableWords = FMath::Min(CullCache->NumPrimitives, View.PrimitiveVisibilityMap.Num()) / NumBitsPerDWORD;
+			}
+
+			CullCache->Scene = Scene;
+			CullCache->CullFlags = CullFlags;
+			CullCache->MaxDrawDistanceScale = MaxDrawDistanceScale;
+			CullCache->FadeRadius = CacheFadeRadius;
+			CullCache->ViewOrigin = View.ViewMatrices.GetViewOrigin();
+			CullCache->Planes = View.ViewFrustum.Planes;
+		}
+		else
+		{
+			ViewState->FrustumCullCache.Reset();
+		}
+	}
+
 	//Primitives per ParallelFor task
 	//Using async FrustumCull. Thanks Yager! See https://udn.unrealengine.com/questions/252385/performance-of-frustumcull.html
 	//Performance varies on total primitive count and tasks scheduled. Check the mentioned link above for some measurements.
@@ -498,8 +582,24 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 	const int32 BitArrayWords = FMath::DivideAndRoundUp(View.PrimitiveVisibilityMap.Num(), (int32)NumBitsPerDWORD);
 	const int32 NumTasks = FMath::DivideAndRoundUp(BitArrayWords, FrustumCullNumWordsPerTask);
 
+	FSceneBitArray OctreeIntersectingMap;
+	FSceneBitArray OctreeContainedMap;
+	const bool bUseOctree = GFrustumCullOctreeMinPrimitives > 0 && BitArrayNum >= GFrustumCullOctreeMinPrimitives && !IsRayTracingEnabled();
+	if (bUseOctree)
+	{
+		OctreeFrustumCull(Scene, View, OctreeIntersectingMap, OctreeContainedMap);
+	}
+
+	const uint32 CachedUpdateId = CullCache ? CullCache->SceneUpdateId : 0;
+	if (CullCache)
+	{
+		CullCache->VisibilityWords.SetNumUninitialized(BitArrayWords);
+		CullCache->FadingWords.SetNumUninitialized(BitArrayWords);
+		CullCache->DistanceCulledWords.SetNumUninitialized(BitArrayWords);
+	}
+
 	ParallelFor(NumTasks, 
-		[&NumCulledPrimitives, Scene, &View, MaxDrawDistanceScale, HLODState](int32 TaskIndex)
+		[&NumCulledPrimitives, Scene, &View, MaxDrawDistanceScale, HLODState, CullCache, NumReusableWords, CachedUpdateId, bUseOctree, &OctreeIntersectingMap, &OctreeContainedMap](int32 TaskIndex)
 		{
 			QUICK_SCOPE_CYCLE_COUNTER(STAT_FrustumCull_Loop);
 			const FPlane* PermutedPlanePtr = View.ViewFrustum.PermutedPlanes.GetData();
@@ -517,8 +617,32 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 				uint32 VisBits = 0;
 				uint32 FadingBits = 0;
 				uint32 DistanceCulledBits = 0;
-				for (int32 BitSubIndex = 0; BitSubIndex < NumBitsPerDWORD && WordIndex * NumBitsPerDWORD + BitSubIndex < BitArrayNumInner; BitSubIndex++, Mask <<= 1)
+
+				// None of the primitives of the word changed since the view's previous frame, reuse its results
+				const bool bReuseWord = WordIndex < NumReusableWords
+					&& WordIndex < Scene->PrimitiveCullingWordUpdateIds.Num()
+					&& (int32)(Scene->PrimitiveCullingWordUpdateIds[WordIndex] - CachedUpdateId) <= 0;
+
+				if (bReuseWord)
+				{
+					VisBits = CullCache->VisibilityWords[WordIndex];
+					FadingBits = CullCache->FadingWords[WordIndex];
+					DistanceCulledBits = CullCache->DistanceCulledWords[WordIndex];
+					STAT(NumCulledPrimitives.Add((int32)NumBitsPerDWORD - FMath::CountBits(VisBits | FadingBits)));
+				}
+
+				const uint32 OctreeIntersectingBits = bUseOctree ? OctreeIntersectingMap.GetData()[WordIndex] : ~0u;
+				const uint32 OctreeContainedBits = bUseOctree ? OctreeContainedMap.GetData()[WordIndex] : 0u;
+
+				for (int32 BitSubIndex = 0; !bReuseWord && BitSubIndex < NumBitsPerDWORD && WordIndex * NumBitsPerDWORD + BitSubIndex < BitArrayNumInner; BitSubIndex++, Mask <<= 1)
 				{
+					// The primitive's octree node is outside the frustum
+					if (!(OctreeIntersectingBits & Mask))
+					{
+						STAT(NumCulledPrimitives.Increment());
+						continue;
+					}
+
 					int32 Index = WordIndex * NumBitsPerDWORD + BitSubIndex;
 					const FPrimitiveBounds& Bounds = Scene->PrimitiveBounds[Index];
 					float DistanceSquared = (Bounds.BoxSphereBounds.Origin - ViewOriginForDistanceCulling).SizeSquared();
@@ -563,10 +687,13 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 						DistanceCulledBits |= Mask;
 					}
 
+					// Primitives of octree nodes inside the frustum don't need to be tested against it
+					const bool bInsideFrustum = (OctreeContainedBits & Mask) != 0;
+
 					if (bDistanceCulled ||
 						(UseCustomCulling && !View.CustomVisibilityQuery->IsVisible(VisibilityId, FBoxSphereBounds(Bounds.BoxSphereBounds.Origin, Bounds.BoxSphereBounds.BoxExtent, Bounds.BoxSphereBounds.SphereRadius))) ||
-						(bAlsoUseSphereTest && View.ViewFrustum.IntersectSphere(Bounds.BoxSphereBounds.Origin, Bounds.BoxSphereBounds.SphereRadius) == false) ||
-						(bUseFastIntersect ? IntersectBox8Plane(Bounds.BoxSphereBounds.Origin, Bounds.BoxSphereBounds.BoxExtent, PermutedPlanePtr) : View.ViewFrustum.IntersectBox(Bounds.BoxSphereBounds.Origin, Bounds.BoxSphereBounds.BoxExtent)) == false)
+						(!bInsideFrustum && bAlsoUseSphereTest && View.ViewFrustum.IntersectSphere(Bounds.BoxSphereBounds.Origin, Bounds.BoxSphereBounds.SphereRadius) == false) ||
+						(!bInsideFrustum && (bUseFastIntersect ? IntersectBox8Plane(Bounds.BoxSphereBounds.Origin, Bounds.BoxSphereBounds.BoxExtent, PermutedPlanePtr) : View.ViewFrustum.IntersectBox(Bounds.BoxSphereBounds.Origin, Bounds.BoxSphereBounds.BoxExtent)) == false))
 					{
 						STAT(NumCulledPrimitives.Increment());
 					}
@@ -608,14 +735,71 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 					check(!View.DistanceCullingPrimitiveMap.GetData()[WordIndex]); // this should start at zero
 					View.DistanceCullingPrimitiveMap.GetData()[WordIndex] = DistanceCulledBits;
 				}
+				if (CullCache && !bReuseWord)
+				{
+					CullCache->VisibilityWords[WordIndex] = VisBits;
+					CullCache->FadingWords[WordIndex] = FadingBits;
+					CullCache->DistanceCulledWords[WordIndex] = DistanceCulledBits;
+				}
 			}
 		},
 		!FApp::ShouldUseThreadingForPerformance() || (UseCustomCulling && !View.CustomVisibilityQuery->IsThreadsafe()) || CVarParallelInitViews.GetValueOnRenderThread() == 0 || !IsInActualRenderingThread()
 	);
 
+	if (CullCache)
+	{
+		CullCache->NumPrimitives = BitArrayNum;
+		CullCache->SceneUpdateId = Scene->PrimitiveCullingUpdateId;
+	}
+
 	return NumCulledPrimitives.GetValue();
 }
 
+static int32 GShareFrustumCullBetweenViews = 1;
+static FAutoConsoleVariableRef CVarShareFrustumCullBetweenViews(
+	TEXT("r.ShareFrustumCullBetweenViews"),
+	GShareFrustumCullBetweenViews,
+	TEXT("Whether views of a family with the same origin, frustum and draw distance settings, e.g. several viewports of the same\n")
+	TEXT("nDisplay camera, frustum cull the scene once and copy the results of the first of them."),
+	ECVF_RenderThreadSafe
+	);
+
+/** Frustum culling results of a view, before hidden primitives, fading and occlusion are applied */
+struct FSharedFrustumCullResult
+{
+	FSceneBitArray PrimitiveVisibilityMap;
+	FSceneBitArray PotentiallyFadingPrimitiveMap;
+	FSceneBitArray DistanceCullingPrimitiveMap;
+};
+
+/** Returns whether the view runs the standard frustum culling, which only depends on the inputs compared by AreFrustumCullInputsEqual */
+static bool CanShareFrustumCull(const FScene* Scene, const FViewInfo& View)
+{
+	// HLOD states and custom visibility queries belong to a single view
+	if (View.CustomVisibilityQuery || Scene->SceneLODHierarchy.IsActive())
+	{
+		return false;
+	}
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	const FSceneViewState* ViewState = (const FSceneViewState*)View.State;
+	if (ViewState && (ViewState->bIsFrozen || ViewState->GetViewParent()))
+	{
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+static bool AreFrustumCullInputsEqual(const FViewInfo& ViewA, const FViewInfo& ViewB)
+{
+	return ViewA.DesiredFOV == ViewB.DesiredFOV
+		&& ViewA.Family->EngineShowFlags.DistanceCulledPrimitives == ViewB.Family->EngineShowFlags.DistanceCulledPrimitives
+		&& ViewA.ViewMatrices.GetViewOrigin() == ViewB.ViewMatrices.GetViewOrigin()
+		&& ViewA.ViewFrustum.Planes == ViewB.ViewFrustum.Planes;
+}
+
 /**
  * Updated primitive fading states for the view.
  */
@@ -3813,6 +3997,34 @@ void FSceneRenderer::ComputeViewVisibility(FRHICommandListImmediate& RHICmdList,
 		Scene->PrimitivesNeedingStaticMeshUpdateWithoutVisibilityCheck.Reset();
 	}
 
+	// Views with the same frustum culling inputs as an earlier view copy its results instead of culling the scene again
+	TArray<int32, SceneRenderingAllocator> FrustumCullSourceViews;
+	TArray<FSharedFrustumCullResult, SceneRenderingAllocator> SharedFrustumCullResults;
+	FrustumCullSourceViews.Init(INDEX_NONE, Views.Num());
+	if (GShareFrustumCullBetweenViews && Views.Num() > 1)
+	{
+		SharedFrustumCullResults.AddDefaulted(Views.Num());
+
+		for (int32 ViewIndex = 1; ViewIndex < Views.Num(); ++ViewIndex)
+		{
+			if (!CanShareFrustumCull(Scene, Views[ViewIndex]))
+			{
+				continue;
+			}
+
+			for (int32 SourceViewIndex = 0; SourceViewIndex < ViewIndex; ++SourceViewIndex)
+			{
+				if (FrustumCullSourceViews[SourceViewIndex] == INDEX_NONE
+					&& CanShareFrustumCull(Scene, Views[SourceViewIndex])
+					&& AreFrustumCullInputsEqual(Views[SourceViewIndex], Views[ViewIndex]))
+				{
+					FrustumCullSourceViews[ViewIndex] = SourceViewIndex;
+					break;
+				}
+			}
+		}
+	}
+
 	uint8 ViewBit = 0x1;
 	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex, ViewBit <<= 1)
 	{
@@ -3935,9 +4147,19 @@ void FSceneRenderer::ComputeViewVisibility(FRHICommandListImmediate& RHICmdList,
 				HLODTree.ClearVisibilityState(View);
 			}
 
-			int32 NumCulledPrimitivesForView;
+			int32 NumCulledPrimitivesForView = 0;
 			const bool bUseFastIntersect = (View.ViewFrustum.PermutedPlanes.Num() == 8) && CVarUseFastIntersect.GetValueOnRenderThread();
-			if (View.CustomVisibilityQuery && View.CustomVisibilityQuery->Prepare())
+			const int32 FrustumCullSourceViewIndex = FrustumCullSourceViews[ViewIndex];
+			if (FrustumCullSourceViewIndex != INDEX_NONE)
+			{
+				QUICK_SCOPE_CYCLE_COUNTER(STAT_ViewVisibilityTime_CopySharedFrustumCull);
+
+				const FSharedFrustumCullResult& SharedResult = SharedFrustumCullResults[FrustumCullSourceViewIndex];
+				View.PrimitiveVisibilityMap = SharedResult.PrimitiveVisibilityMap;
+				View.PotentiallyFadingPrimitiveMap = SharedResult.PotentiallyFadingPrimitiveMap;
+				View.DistanceCullingPrimitiveMap = SharedResult.DistanceCullingPrimitiveMap;
+			}
+			else if (View.CustomVisibilityQuery && View.CustomVisibilityQuery->Prepare())
 			{
 				if (CVarAlsoUseSphereForFrustumCull.GetValueOnRenderThread())
 				{
@@ -3960,7 +4182,16 @@ void FSceneRenderer::ComputeViewVisibility(FRHICommandListImmediate& RHICmdList,
 				}
 			}
 			STAT(NumCulledPrimitives += NumCulledPrimitivesForView);
-			UpdatePrimitiveFading(Scene, View);			
+
+			if (FrustumCullSourceViewIndex == INDEX_NONE && FrustumCullSourceViews.Contains(ViewIndex))
+			{
+				FSharedFrustumCullResult& SharedResult = SharedFrustumCullResults[ViewIndex];
+				SharedResult.PrimitiveVisibilityMap = View.PrimitiveVisibilityMap;
+				SharedResult.PotentiallyFadingPrimitiveMap = View.PotentiallyFadingPrimitiveMap;
+				SharedResult.DistanceCullingPrimitiveMap = View.DistanceCullingPrimitiveMap;
+			}
+
+			UpdatePrimitiveFading(Scene, View);
 		}
 
 		// If any primitives are explicitly hidden, remove them now.
@@ -259,6 +259,15 @@ FAutoConsoleVariableRef CVarUseOctreeForShadowCulling(
 	ECVF_Scalability | ECVF_RenderThreadSafe
 	);
 
+int32 GCacheShadowSubjectPrimitives = 1;
+FAutoConsoleVariableRef CVarCacheShadowSubjectPrimitives(
+	TEXT("r.Shadow.CacheSubjectPrimitives"),
+	GCacheShadowSubjectPrimitives,
+	TEXT("Whether view dependent whole scene shadows keep the casters they gathered in their view state, and only gather them again once\n")
+	TEXT("the shadow's bounds change, or a caster, or a primitive inside the shadow's frustum, is added, removed or moved."),
+	ECVF_RenderThreadSafe
+	);
+
 CSV_DECLARE_CATEGORY_EXTERN(LightCount);
 
 #if !UE_BUILD_SHIPPING
@@ -3573,6 +3582,16 @@ void FSceneRenderer::GatherShadowDynamicMeshElements(FGlobalDynamicIndexBuffer&
 typedef TArray<FAddSubjectPrimitiveOp> FShadowSubjectPrimitives;
 typedef TArray<FAddSubjectPrimitiveStats, TInlineAllocator<4, SceneRenderingAllocator>> FPerShadowGatherStats;
 typedef TArray<FAddSubjectPrimitiveOverflowedIndices, SceneRenderingAllocator> FPerShadowOverflowedIndices;
+typedef TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator> FShadowCandidatePrimitives;
+
+/** Cached casters of a view dependent whole scene shadow for this frame */
+struct FShadowSubjectCacheState
+{
+	FSceneViewState::FCachedShadowSubjects* Cache = nullptr;
+	/** Whether the cached casters are up to date, otherwise the gather stores the new ones in the cache */
+	bool bReuse = false;
+};
+typedef TArray<FShadowSubjectCacheState, SceneRenderingAllocator> FPerShadowSubjectCacheStates;
 
 struct FGatherShadowPrimitivesPacket
 {
@@ -3586,6 +3605,9 @@ struct FGatherShadowPrimitivesPacket
 	const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& ViewDependentWholeSceneShadows;
 	ERHIFeatureLevel::Type FeatureLevel;
 	bool bStaticSceneOnly;
+	const FPerShadowSubjectCacheStates& ShadowCacheStates;
+	/** Shadow whose cached casters are added by this packet, or INDEX_NONE */
+	int32 CachedShadowIndex;
 
 	// Scratch
 	FPerShadowGatherStats ViewDependentWholeSceneShadowStats;
@@ -3593,6 +3615,7 @@ struct FGatherShadowPrimitivesPacket
 	FPerShadowOverflowedIndices ViewDependentWholeSceneShadowOverflowedIndices;
 	TArray<FShadowSubjectPrimitives, SceneRenderingAllocator> PreShadowSubjectPrimitives;
 	TArray<FShadowSubjectPrimitives, SceneRenderingAllocator> ViewDependentWholeSceneShadowSubjectPrimitives;
+	TArray<FShadowCandidatePrimitives, SceneRenderingAllocator> ViewDependentWholeSceneShadowCandidates;
 
 	// Outputs
 	FPerShadowGatherStats& GlobalStats;
@@ -3607,6 +3630,8 @@ struct FGatherShadowPrimitivesPacket
 		const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& InViewDependentWholeSceneShadows,
 		ERHIFeatureLevel::Type InFeatureLevel,
 		bool bInStaticSceneOnly,
+		const FPerShadowSubjectCacheStates& InShadowCacheStates,
+		int32 InCachedShadowIndex,
 		FPerShadowGatherStats& OutGlobalStats) 
 		: Scene(InScene)
 		, Views(InViews)
@@ -3617,6 +3642,8 @@ struct FGatherShadowPrimitivesPacket
 		, ViewDependentWholeSceneShadows(InViewDependentWholeSceneShadows)
 		, FeatureLevel(InFeatureLevel)
 		, bStaticSceneOnly(bInStaticSceneOnly)
+		, ShadowCacheStates(InShadowCacheStates)
+		, CachedShadowIndex(InCachedShadowIndex)
 		, GlobalStats(OutGlobalStats)
 	{
 		const int32 NumPreShadows = PreShadows.Num();
@@ -3637,13 +3664,27 @@ struct FGatherShadowPrimitivesPacket
 
 		ViewDependentWholeSceneShadowSubjectPrimitives.Empty(NumVDWSShadows);
 		ViewDependentWholeSceneShadowSubjectPrimitives.AddDefaulted(NumVDWSShadows);
+
+		ViewDependentWholeSceneShadowCandidates.Empty(NumVDWSShadows);
+		ViewDependentWholeSceneShadowCandidates.AddDefaulted(NumVDWSShadows);
 	}
 
 	void AnyThreadTask()
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_GatherShadowPrimitivesPacket);
 
-		if (NodeIndex != INDEX_NONE)
+		if (CachedShadowIndex != INDEX_NONE)
+		{
+			// The cached casters already passed the culling tests of the shadow
+			for (int32 PrimitiveIndex = StartPrimitiveIndex; PrimitiveIndex < StartPrimitiveIndex + NumPrimitives; PrimitiveIndex++)
+			{
+				FPrimitiveSceneInfo* PrimitiveSceneInfo = ShadowCacheStates[CachedShadowIndex].Cache->Primitives[PrimitiveIndex];
+				const FPrimitiveSceneInfoCompact PrimitiveSceneInfoCompact(PrimitiveSceneInfo);
+
+				AddViewDependentWholeSceneShadowSubject(CachedShadowIndex, PrimitiveSceneInfoCompact);
+			}
+		}
+		else if (NodeIndex != INDEX_NONE)
 		{
 			// Check all the primitives in this octree node.
 			for (const FPrimitiveSceneInfoCompact& PrimitiveSceneInfoCompact : Scene->PrimitiveOctree.GetElementsForNode(NodeIndex))
@@ -3732,6 +3773,12 @@ struct FGatherShadowPrimitivesPacket
 
 		for (int32 ShadowIndex = 0, Num = ViewDependentWholeSceneShadows.Num();ShadowIndex < Num;ShadowIndex++)
 		{
+			const FShadowSubjectCacheState& CacheState = ShadowCacheStates[ShadowIndex];
+			if (CacheState.bReuse)
+			{
+				continue;
+			}
+
 			const FProjectedShadowInfo* RESTRICT ProjectedShadowInfo = ViewDependentWholeSceneShadows[ShadowIndex];
 			const FLightSceneInfo& RESTRICT LightSceneInfo = ProjectedShadowInfo->GetLightSceneInfo();
 			const FLightSceneProxy& RESTRICT LightProxy = *LightSceneInfo.Proxy;
@@ -3782,30 +3829,40 @@ struct FGatherShadowPrimitivesPacket
 					// Render dynamic lit objects if CSMForDynamicObjects is enabled.
 					&& (!LightProxy.UseCSMForDynamicObjects() || !PrimitiveProxy->HasStaticLighting()))
 				{
-					FAddSubjectPrimitiveResult Result;
-					Result.Qword = ProjectedShadowInfo->AddSubjectPrimitive_AnyThread(
-						PrimitiveSceneInfoCompact,
-						nullptr,
-						FeatureLevel,
-						ViewDependentWholeSceneShadowStats[ShadowIndex],
-						ViewDependentWholeSceneShadowOverflowedIndices[ShadowIndex]);
-
-					if (!!Result.Qword)
+					if (CacheState.Cache)
 					{
-						FShadowSubjectPrimitives& SubjectPrimitives = ViewDependentWholeSceneShadowSubjectPrimitives[ShadowIndex];
-						if (!SubjectPrimitives.Num())
-						{
-							SubjectPrimitives.Reserve(16);
-						}
-						FAddSubjectPrimitiveOp& Op = SubjectPrimitives[SubjectPrimitives.AddUninitialized()];
-						Op.PrimitiveSceneInfo = PrimitiveSceneInfo;
-						Op.Result.Qword = Result.Qword;
+						ViewDependentWholeSceneShadowCandidates[ShadowIndex].Add(PrimitiveSceneInfo);
 					}
+
+					AddViewDependentWholeSceneShadowSubject(ShadowIndex, PrimitiveSceneInfoCompact);
 				}
 			}
 		}
 	}
 
+	void AddViewDependentWholeSceneShadowSubject(int32 ShadowIndex, const FPrimitiveSceneInfoCompact& PrimitiveSceneInfoCompact)
+	{
+		FAddSubjectPrimitiveResult Result;
+		Result.Qword = ViewDependentWholeSceneShadows[ShadowIndex]->AddSubjectPrimitive_AnyThread(
+			PrimitiveSceneInfoCompact,
+			nullptr,
+			FeatureLevel,
+			ViewDependentWholeSceneShadowStats[ShadowIndex],
+			ViewDependentWholeSceneShadowOverflowedIndices[ShadowIndex]);
+
+		if (!!Result.Qword)
+		{
+			FShadowSubjectPrimitives& SubjectPrimitives = ViewDependentWholeSceneShadowSubjectPrimitives[ShadowIndex];
+			if (!SubjectPrimitives.Num())
+			{
+				SubjectPrimitives.Reserve(16);
+			}
+			FAddSubjectPrimitiveOp& Op = SubjectPrimitives[SubjectPrimitives.AddUninitialized()];
+			Op.PrimitiveSceneInfo = PrimitiveSceneInfoCompact.PrimitiveSceneInfo;
+			Op.Result.Qword = Result.Qword;
+		}
+	}
+
 	void RenderThreadFinalize()
 	{
 		for (int32 ShadowIndex = 0; ShadowIndex < PreShadowSubjectPrimitives.Num(); ShadowIndex++)
@@ -3836,10 +3893,116 @@ struct FGatherShadowPrimitivesPacket
 			{
 				ProjectedShadowInfo->FinalizeAddSubjectPrimitive(SubjectPrimitives[PrimitiveIndex], nullptr, FeatureLevel, Context);
 			}
+
+			if (ViewDependentWholeSceneShadowCandidates[ShadowIndex].Num())
+			{
+				ShadowCacheStates[ShadowIndex].Cache->Primitives.Append(ViewDependentWholeSceneShadowCandidates[ShadowIndex]);
+			}
 		}
 	}
 };
 
+/** Returns the cached casters of a shadow, resetting them if the inputs of the gather changed since they were cached */
+static FSceneViewState::FCachedShadowSubjects* FindShadowSubjectCache(const FProjectedShadowInfo* ProjectedShadowInfo, bool bStaticSceneOnly, uint32 FrameNumber)
+{
+	const FViewInfo* DependentView = ProjectedShadowInfo->DependentView;
+	FSceneViewState* ViewState = DependentView ? DependentView->ViewState : nullptr;
+	if (!ViewState)
+	{
+		return nullptr;
+	}
+
+	const FLightSceneInfo& LightSceneInfo = ProjectedShadowInfo->GetLightSceneInfo();
+	const FLightSceneProxy& LightProxy = *LightSceneInfo.Proxy;
+
+	FSceneViewState::FCachedShadowSubjects& Cache = ViewState->CachedShadowSubjects.FindOrAdd(MakeTuple(&LightSceneInfo, ProjectedShadowInfo->CascadeSettings.ShadowSplitIndex));
+
+	// Already used by another shadow this frame, e.g. when the view state is shared by several views
+	if (Cache.LastUsedFrameNumber == FrameNumber)
+	{
+		return nullptr;
+	}
+
+	const float MinScreenRadius = ProjectedShadowInfo->bReflectiveShadowmap ? GMinScreenRadiusForShadowCasterRSM : GMinScreenRadiusForShadowCaster;
+	const uint32 Flags = (ProjectedShadowInfo->bReflectiveShadowmap ? 1 : 0)
+		| (bStaticSceneOnly ? 2 : 0)
+		| (LightProxy.HasStaticLighting() ? 4 : 0)
+		| (LightSceneInfo.IsPrecomputedLightingValid() ? 8 : 0)
+		| (LightProxy.UseCSMForDynamicObjects() ? 16 : 0);
+
+	const bool bInputsUnchanged = Cache.bValid
+		&& Cache.LastUsedFrameNumber + 1 >= FrameNumber
+		&& Cache.Flags == Flags
+		&& Cache.MinScreenRadius == MinScreenRadius
+		&& Cache.ShadowBoundsCenter == ProjectedShadowInfo->ShadowBounds.Center
+		&& Cache.ShadowBoundsRadius == ProjectedShadowInfo->ShadowBounds.W
+		&& Cache.PreShadowTranslation == ProjectedShadowInfo->PreShadowTranslation
+		&& Cache.LightDirection == LightProxy.GetDirection()
+		&& Cache.ViewOrigin == DependentView->ShadowViewMatrices.GetViewOrigin()
+		&& Cache.LODDistanceFactor == DependentView->LODDistanceFactor
+		&& Cache.CasterFrustumPlanes == ProjectedShadowInfo->CasterFrustum.Planes
+		&& Cache.ShadowBoundsAccuratePlanes == ProjectedShadowInfo->CascadeSettings.ShadowBoundsAccurate.Planes;
+
+	if (!bInputsUnchanged)
+	{
+		Cache.bValid = false;
+		Cache.Flags = Flags;
+		Cache.MinScreenRadius = MinScreenRadius;
+		Cache.ShadowBoundsCenter = ProjectedShadowInfo->ShadowBounds.Center;
+		Cache.ShadowBoundsRadius = ProjectedShadowInfo->ShadowBounds.W;
+		Cache.PreShadowTranslation = ProjectedShadowInfo->PreShadowTranslation;
+		Cache.LightDirection = LightProxy.GetDirection();
+		Cache.ViewOrigin = DependentView->ShadowViewMatrices.GetViewOrigin();
+		Cache.LODDistanceFactor = DependentView->LODDistanceFactor;
+		Cache.CasterFrustumPlanes = ProjectedShadowInfo->CasterFrustum.Planes;
+		Cache.ShadowBoundsAccuratePlanes = ProjectedShadowInfo->CascadeSettings.ShadowBoundsAccurate.Planes;
+	}
+	Cache.LastUsedFrameNumber = FrameNumber;
+
+	return &Cache;
+}
+
+/** Returns whether none of the cached casters changed, and no primitive that changed may have become a caster */
+static bool AreCachedShadowSubjectsValid(const FScene* Scene, const FProjectedShadowInfo* ProjectedShadowInfo, const FSceneViewState::FCachedShadowSubjects& Cache)
+{
+	if (!Cache.bValid)
+	{
+		return false;
+	}
+
+	const int32 NumPrimitives = Scene->Primitives.Num();
+	const int32 NumWords = Scene->PrimitiveCullingWordUpdateIds.Num();
+	for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+	{
+		if ((int32)(Scene->PrimitiveCullingWordUpdateIds[WordIndex] - Cache.SceneUpdateId) <= 0)
+		{
+			continue;
+		}
+
+		const int32 EndIndex = (WordIndex + 1) * NumBitsPerDWORD;
+		for (int32 PrimitiveIndex = WordIndex * NumBitsPerDWORD; PrimitiveIndex < EndIndex; PrimitiveIndex++)
+		{
+			// A cached caster was removed, moved or reordered
+			if (PrimitiveIndex < Cache.PrimitiveIndices.Num() && Cache.PrimitiveIndices[PrimitiveIndex])
+			{
+				return false;
+			}
+
+			// A primitive was added, or moved, inside the shadow's frustum
+			if (PrimitiveIndex < NumPrimitives && Scene->PrimitiveFlagsCompact[PrimitiveIndex].bCastDynamicShadow)
+			{
+				const FBoxSphereBounds& Bounds = Scene->PrimitiveBounds[PrimitiveIndex].BoxSphereBounds;
+				if (ProjectedShadowInfo->CasterFrustum.IntersectBox(Bounds.Origin, ProjectedShadowInfo->PreShadowTranslation, Bounds.BoxExtent))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
 void FSceneRenderer::GatherShadowPrimitives(
 	const TArray<FProjectedShadowInfo*,SceneRenderingAllocator>& PreShadows,
 	const TArray<FProjectedShadowInfo*,SceneRenderingAllocator>& ViewDependentWholeSceneShadows,
@@ -3855,14 +4018,63 @@ void FSceneRenderer::GatherShadowPrimitives(
 
 		GatherStats.AddDefaulted(ViewDependentWholeSceneShadows.Num());
 
-		if (GUseOctreeForShadowCulling)
+		FPerShadowSubjectCacheStates ShadowCacheStates;
+		ShadowCacheStates.AddDefaulted(ViewDependentWholeSceneShadows.Num());
+		int32 NumShadowsToGather = PreShadows.Num() + ViewDependentWholeSceneShadows.Num();
+
+		if (GCacheShadowSubjectPrimitives)
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_ValidateCachedShadowSubjects);
+
+			for (FViewInfo& View : Views)
+			{
+				if (View.ViewState)
+				{
+					for (auto It = View.ViewState->CachedShadowSubjects.CreateIterator(); It; ++It)
+					{
+						if (It.Value().LastUsedFrameNumber + 1 < ViewFamily.FrameNumber)
+						{
+							It.RemoveCurrent();
+						}
+					}
+				}
+			}
+
+			for (int32 ShadowIndex = 0; ShadowIndex < ViewDependentWholeSceneShadows.Num(); ShadowIndex++)
+			{
+				const FProjectedShadowInfo* ProjectedShadowInfo = ViewDependentWholeSceneShadows[ShadowIndex];
+				FSceneViewState::FCachedShadowSubjects* Cache = FindShadowSubjectCache(ProjectedShadowInfo, bStaticSceneOnly, ViewFamily.FrameNumber);
+				if (Cache)
+				{
+					FShadowSubjectCacheState& CacheState = ShadowCacheStates[ShadowIndex];
+					CacheState.Cache = Cache;
+					CacheState.bReuse = AreCachedShadowSubjectsValid(Scene, ProjectedShadowInfo, *Cache);
+
+					if (CacheState.bReuse)
+					{
+						NumShadowsToGather--;
+					}
+					else
+					{
+						Cache->bValid = false;
+						Cache->Primitives.Reset();
+					}
+				}
+			}
+		}
+
+		if (NumShadowsToGather == 0)
+		{
+			// All the shadows reuse their cached casters
+		}
+		else if (GUseOctreeForShadowCulling)
 		{
 			QUICK_SCOPE_CYCLE_COUNTER(STAT_ShadowSceneOctreeTraversal);
 
 			Packets.Reserve(100);
 
 			// Find primitives that are in a shadow frustum in the octree.
-			Scene->PrimitiveOctree.FindNodesWithPredicate([&PreShadows, &ViewDependentWholeSceneShadows](const FBoxCenterAndExtent& NodeBounds)
+			Scene->PrimitiveOctree.FindNodesWithPredicate([&PreShadows, &ViewDependentWholeSceneShadows, &ShadowCacheStates](const FBoxCenterAndExtent& NodeBounds)
 			{
 				// Check that the child node is in the frustum for at least one shadow.
 
@@ -3882,6 +4094,11 @@ void FSceneRenderer::GatherShadowPrimitives(
 
 				for (int32 ShadowIndex = 0, Num = ViewDependentWholeSceneShadows.Num(); ShadowIndex < Num; ShadowIndex++)
 				{
+					if (ShadowCacheStates[ShadowIndex].bReuse)
+					{
+						continue;
+					}
+
 					FProjectedShadowInfo* ProjectedShadowInfo = ViewDependentWholeSceneShadows[ShadowIndex];
 
 					//check(ProjectedShadowInfo->CasterFrustum.PermutedPlanes.Num());
@@ -3897,7 +4114,7 @@ void FSceneRenderer::GatherShadowPrimitives(
 				// the iterator's pending node stack.
 				return false;
 			},
-			[this, &PreShadows, &ViewDependentWholeSceneShadows, bStaticSceneOnly, &GatherStats, &Packets](FScenePrimitiveOctree::FNodeIndex NodeIndex)
+			[this, &PreShadows, &ViewDependentWholeSceneShadows, bStaticSceneOnly, &ShadowCacheStates, &GatherStats, &Packets](FScenePrimitiveOctree::FNodeIndex NodeIndex)
 			{
 				if (Scene->PrimitiveOctree.GetElementsForNode(NodeIndex).Num() > 0)
 				{
@@ -3911,6 +4128,8 @@ void FSceneRenderer::GatherShadowPrimitives(
 						ViewDependentWholeSceneShadows,
 						FeatureLevel,
 						bStaticSceneOnly,
+						ShadowCacheStates,
+						INDEX_NONE,
 						GatherStats);
 					Packets.Add(Packet);
 				}
@@ -3937,6 +4156,38 @@ void FSceneRenderer::GatherShadowPrimitives(
 					ViewDependentWholeSceneShadows,
 					FeatureLevel,
 					bStaticSceneOnly,
+					ShadowCacheStates,
+					INDEX_NONE,
+					GatherStats);
+				Packets.Add(Packet);
+			}
+		}
+
+		// Shadows with up to date cached casters only run the per frame part of adding them
+		for (int32 ShadowIndex = 0; ShadowIndex < ShadowCacheStates.Num(); ShadowIndex++)
+		{
+			if (!ShadowCacheStates[ShadowIndex].bReuse)
+			{
+				continue;
+			}
+
+			const int32 PacketSize = CVarParallelGatherNumPrimitivesPerPacket.GetValueOnRenderThread();
+			const int32 NumCachedPrimitives = ShadowCacheStates[ShadowIndex].Cache->Primitives.Num();
+
+			for (int32 StartPrimitiveIndex = 0; StartPrimitiveIndex < NumCachedPrimitives; StartPrimitiveIndex += PacketSize)
+			{
+				FGatherShadowPrimitivesPacket* Packet = new(FMemStack::Get()) FGatherShadowPrimitivesPacket(
+					Scene,
+					Views,
+					INDEX_NONE,
+					StartPrimitiveIndex,
+					FMath::Min(PacketSize, NumCachedPrimitives - StartPrimitiveIndex),
+					PreShadows,
+					ViewDependentWholeSceneShadows,
+					FeatureLevel,
+					bStaticSceneOnly,
+					ShadowCacheStates,
+					ShadowIndex,
 					GatherStats);
 				Packets.Add(Packet);
 			}
@@ -3970,6 +4221,23 @@ void FSceneRenderer::GatherShadowPrimitives(
 				Packet->~FGatherShadowPrimitivesPacket();
 			}
 		}
+
+		for (const FShadowSubjectCacheState& CacheState : ShadowCacheStates)
+		{
+			if (FSceneViewState::FCachedShadowSubjects* Cache = CacheState.Cache)
+			{
+				if (!CacheState.bReuse)
+				{
+					Cache->PrimitiveIndices.Init(false, Scene->Primitives.Num());
+					for (const FPrimitiveSceneInfo* PrimitiveSceneInfo : Cache->Primitives)
+					{
+						Cache->PrimitiveIndices[PrimitiveSceneInfo->GetIndex()] = true;
+					}
+					Cache->bValid = true;
+				}
+				Cache->SceneUpdateId = Scene->PrimitiveCullingUpdateId;
+			}
+		}
 	}
 }
 
@@ -77,20 +77,48 @@ namespace Audio
 
 	void FInterpolatedLPF::ProcessAudioBuffer(float *RESTRICT InputBuffer, float *RESTRICT OutputBuffer, const int32 NumSamples)
 	{
-		for (int SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
-		{
-			// cache which delay term we should be using
-			const int32 ChannelIndex = SampleIndex % NumChannels;
-
-			// step forward coefficient
-			// Multiply delta by !ChannelIndex so the coefficient only accumulates at the beginning of each frame (on channel 0)
-			B1Curr += B1Delta * !ChannelIndex;
+		checkSlow(NumChannels > 0 && (NumSamples % NumChannels) == 0);
+		const int32 NumFrames = NumSamples / NumChannels;
 
-			const float InputSample = InputBuffer[SampleIndex];
-			float Yn = InputSample + B1Curr * (Z1Data[ChannelIndex] - InputSample); // LPF
-			Yn = UnderflowClamp(Yn);
-			Z1Data[ChannelIndex] = Yn;
-			OutputBuffer[SampleIndex] = Yn;
+		// Process frame by frame so the coefficient only steps once per frame, without a per-sample modulo.
+		// Mono and stereo are by far the most common source layouts, so keep their delay terms in registers.
+		if (NumChannels == 1)
+		{
+			float Z1Mono = Z1Data[0];
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+			{
+				B1Curr += B1Delta;
+
+				const float InputSample = InputBuffer[FrameIndex];
+				Z1Mono = UnderflowClamp(InputSample + B1Curr * (Z1Mono - InputSample)); // LPF
+				OutputBuffer[FrameIndex] = Z1Mono;
+			}
+			Z1Data[0] = Z1Mono;
+		}
+		else if (NumChannels == 2)
+		{
+			float Z1L = Z1Data[0];
+			float Z1R = Z1Data[1];
+			for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex += 2)
+			{
+				B1Curr += B1Delta;
+
+				const float InputSampleL = InputBuffer[SampleIndex];
+				const float InputSampleR = InputBuffer[SampleIndex + 1];
+				Z1L = UnderflowClamp(InputSampleL + B1Curr * (Z1L - InputSampleL)); // LPF
+				Z1R = UnderflowClamp(InputSampleR + B1Curr * (Z1R - InputSampleR)); // LPF
+				OutputBuffer[SampleIndex] = Z1L;
+				OutputBuffer[SampleIndex + 1] = Z1R;
+			}
+			Z1Data[0] = Z1L;
+			Z1Data[1] = Z1R;
+		}
+		else
+		{
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+			{
+				ProcessAudioFrame(&InputBuffer[FrameIndex * NumChannels], &OutputBuffer[FrameIndex * NumChannels]);
+			}
 		}
 	}
 
@@ -176,21 +204,53 @@ namespace Audio
 
 	void FInterpolatedHPF::ProcessAudioBuffer(float *RESTRICT InputBuffer, float *RESTRICT OutputBuffer, const int32 NumSamples)
 	{
-		for (int SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
-		{
-			// cache which delay term we should be using
-			const int32 ChannelIndex = SampleIndex % NumChannels;
-
-			// step forward coefficient
-			// Multiply delta by !ChannelIndex so the coefficient only accumulates at the beginning of each frame (on channel 0)
-			A0Curr += A0Delta * !ChannelIndex;
+		checkSlow(NumChannels > 0 && (NumSamples % NumChannels) == 0);
+		const int32 NumFrames = NumSamples / NumChannels;
 
-			const float InputSample = InputBuffer[SampleIndex];
-			const float Vn = (InputSample - Z1Data[ChannelIndex]) * A0Curr;
-			const float LPF = Vn + Z1Data[ChannelIndex];
-			Z1Data[ChannelIndex] = Vn + LPF;
-
-			OutputBuffer[SampleIndex] = InputSample - LPF;
+		// See FInterpolatedLPF::ProcessAudioBuffer
+		if (NumChannels == 1)
+		{
+			float Z1Mono = Z1Data[0];
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+			{
+				A0Curr += A0Delta;
+
+				const float InputSample = InputBuffer[FrameIndex];
+				const float Vn = (InputSample - Z1Mono) * A0Curr;
+				const float LPF = Vn + Z1Mono;
+				Z1Mono = Vn + LPF;
+				OutputBuffer[FrameIndex] = InputSample - LPF;
+			}
+			Z1Data[0] = Z1Mono;
+		}
+		else if (NumChannels == 2)
+		{
+			float Z1L = Z1Data[0];
+			float Z1R = Z1Data[1];
+			for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex += 2)
+			{
+				A0Curr += A0Delta;
+
+				const float InputSampleL = InputBuffer[SampleIndex];
+				const float InputSampleR = InputBuffer[SampleIndex + 1];
+				const float VnL = (InputSampleL - Z1L) * A0Curr;
+				const float VnR = (InputSampleR - Z1R) * A0Curr;
+				const float LPFL = VnL + Z1L;
+				const float LPFR = VnR + Z1R;
+				Z1L = VnL + LPFL;
+				Z1R = VnR + LPFR;
+				OutputBuffer[SampleIndex] = InputSampleL - LPFL;
+				OutputBuffer[SampleIndex + 1] = InputSampleR - LPFR;
+			}
+			Z1Data[0] = Z1L;
+			Z1Data[1] = Z1R;
+		}
+		else
+		{
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+			{
+				ProcessAudioFrame(&InputBuffer[FrameIndex * NumChannels], &OutputBuffer[FrameIndex * NumChannels]);
+			}
 		}
 	}
 
@@ -965,6 +965,12 @@ static const FSlateClippingState* GetClipStateFromParent(const FSlateClippingMan
 	}
 }
 
+FSlateCachedElementData::~FSlateCachedElementData()
+{
+	// Cached element data is destroyed by the renderer once the rendering thread no longer reads from it
+	delete MergedRenderingData;
+}
+
 void FSlateCachedElementData::Empty()
 {
 	if (CachedElementLists.Num())
@@ -983,6 +989,10 @@ void FSlateCachedElementData::Empty()
 	CachedBatches.Empty();
 	CachedClipStates.Empty();
 	ListsWithNewData.Empty();
+
+	DestroyMergedRenderingData();
+	MergedBatches.Empty();
+	bMergedBatchesDirty = true;
 }
 
 FSlateCachedElementsHandle FSlateCachedElementData::AddCache(const SWidget* Widget)
@@ -1035,6 +1045,7 @@ FSlateRenderBatch& FSlateCachedElementData::AddCachedRenderBatch(FSlateRenderBat
 	// Check perf against add.  AddAtLowest makes it generally re-add elements at the same index it just removed which is nicer on the cache
 	int32 LowestFreedIndex = 0;
 	OutIndex = CachedBatches.EmplaceAtLowestFreeIndex(LowestFreedIndex, NewBatch);
+	bMergedBatchesDirty = true;
 	return CachedBatches[OutIndex];
 }
 
@@ -1044,6 +1055,7 @@ void FSlateCachedElementData::RemoveCachedRenderBatches(const TArray<int32>& Cac
 	{
 		CachedBatches.RemoveAt(Index);
 	}
+	bMergedBatchesDirty = true;
 }
 
 FSlateCachedClipState& FSlateCachedElementData::FindOrAddCachedClipState(const FSlateClippingState* RefClipState)
@@ -1084,6 +1096,26 @@ void FSlateCachedElementData::RemoveList(FSlateCachedElementsHandle& CacheHandle
 	CachedList->ClearCachedElements();
 }
 
+void FSlateCachedElementData::DestroyMergedRenderingData()
+{
+	if (MergedRenderingData)
+	{
+		if (FSlateApplicationBase::IsInitialized())
+		{
+			if (FSlateRenderer* SlateRenderer = FSlateApplicationBase::Get().GetRenderer())
+			{
+				SlateRenderer->DestroyCachedFastPathRenderingData(MergedRenderingData);
+			}
+		}
+		else
+		{
+			delete MergedRenderingData;
+		}
+
+		MergedRenderingData = nullptr;
+	}
+}
+
 void FSlateCachedElementData::AddReferencedObjects(FReferenceCollector& Collector)
 {
 	for (TSharedPtr<FSlateCachedElementList>& CachedElementList : CachedElementLists)
@@ -28,6 +28,13 @@ DEFINE_STAT(STAT_SlateInvalidation_RecachedElements);
 
 int32 GSlateFeathering = 0;
 
+static int32 GSlateMergeCachedBatches = 1;
+static FAutoConsoleVariableRef CVarSlateMergeCachedBatches(
+	TEXT("Slate.MergeCachedBatches"),
+	GSlateMergeCachedBatches,
+	TEXT("If not zero, the batches of invalidation roots are merged when their cached elements change instead of every frame.")
+	);
+
 
 FSlateElementBatch::FSlateElementBatch(const FSlateShaderResource* InShaderResource, const FShaderParams& InShaderParams, ESlateShader ShaderType, ESlateDrawPrimitive PrimitiveType, ESlateDrawEffect InDrawEffects, ESlateBatchDrawFlag InBatchFlags, const FSlateDrawElement& InDrawElement, int32 InstanceCount, uint32 InstanceOffset, ISlateUpdatableInstanceBuffer* InstanceData)
 	: BatchKey(InShaderParams, ShaderType, PrimitiveType, InDrawEffects, InBatchFlags, InDrawElement.GetClippingHandle(), InstanceCount, InstanceOffset, InstanceData, InDrawElement.GetSceneIndex())
@@ -104,6 +111,11 @@ void FSlateBatchData::AddCachedBatches(const TSparseArray<FSlateRenderBatch>& In
 	}
 }
 
+void FSlateBatchData::AddCachedBatches(const TArray<FSlateRenderBatch>& InCachedBatches)
+{
+	RenderBatches.Append(InCachedBatches);
+}
+
 void FSlateBatchData::FillBuffersFromNewBatch(FSlateRenderBatch& Batch, FSlateVertexArray& FinalVertices, FSlateIndexArray& FinalIndices)
 {
 	if(Batch.HasVertexData())
@@ -475,7 +487,19 @@ void FSlateElementBatcher::AddCachedElements(FSlateCachedElementData& CachedElem
 	CachedElementData.ListsWithNewData.Empty();
 
 	// Add the existing and new cached batches.
-	BatchData->AddCachedBatches(CachedElementData.GetCachedBatches());
+	if (GSlateMergeCachedBatches)
+	{
+		if (CachedElementData.bMergedBatchesDirty)
+		{
+			UpdateMergedCachedBatches(CachedElementData);
+		}
+
+		BatchData->AddCachedBatches(CachedElementData.GetMergedBatches());
+	}
+	else
+	{
+		BatchData->AddCachedBatches(CachedElementData.GetCachedBatches());
+	}
 
 	CachedElementData.CleanupUnusedClipStates();
 
@@ -485,6 +509,94 @@ void FSlateElementBatcher::AddCachedElements(FSlateCachedElementData& CachedElem
 #endif
 }
 
+void FSlateElementBatcher::UpdateMergedCachedBatches(FSlateCachedElementData& CachedElementData)
+{
+	SCOPED_NAMED_EVENT_TEXT("Slate::MergeCachedBatches", FColor::Magenta);
+
+	// The rendering thread may still be reading the previous merged data
+	CachedElementData.DestroyMergedRenderingData();
+	CachedElementData.MergedBatches.Reset();
+	CachedElementData.bMergedBatchesDirty = false;
+
+	const TSparseArray<FSlateRenderBatch>& CachedBatches = CachedElementData.GetCachedBatches();
+	if (CachedBatches.Num() == 0)
+	{
+		return;
+	}
+
+	FSlateCachedFastPathRenderingData* MergedData = new FSlateCachedFastPathRenderingData;
+	CachedElementData.MergedRenderingData = MergedData;
+
+	// Keep the clip states of the merged batches alive as long as the merged data
+	MergedData->CachedClipStates.Append(CachedElementData.CachedClipStates);
+
+	// Same order as FSlateBatchData::MergeRenderBatches, stable sort because order in the same layer should be preserved
+	TArray<const FSlateRenderBatch*, TInlineAllocator<100>> SortedBatches;
+	SortedBatches.Reserve(CachedBatches.Num());
+	for (const FSlateRenderBatch& CachedBatch : CachedBatches)
+	{
+		SortedBatches.Add(&CachedBatch);
+	}
+
+	SortedBatches.StableSort([](const FSlateRenderBatch& A, const FSlateRenderBatch& B) { return A.GetLayer() < B.GetLayer(); });
+
+	TBitArray<> MergedBatchMask(false, SortedBatches.Num());
+
+	for (int32 BatchIndex = 0; BatchIndex < SortedBatches.Num(); ++BatchIndex)
+	{
+		if (MergedBatchMask[BatchIndex])
+		{
+			continue;
+		}
+
+		const FSlateRenderBatch& SourceBatch = *SortedBatches[BatchIndex];
+		FSlateRenderBatch& MergedBatch = CachedElementData.MergedBatches.Add_GetRef(SourceBatch);
+
+		if (!SourceBatch.bIsMergable || !SourceBatch.HasVertexData())
+		{
+			// Keeps pointing at the data of its cached list
+			continue;
+		}
+
+		MergedBatch.SourceVertices = &MergedData->Vertices;
+		MergedBatch.SourceIndices = &MergedData->Indices;
+		MergedBatch.VertexOffset = MergedData->Vertices.Num();
+		MergedBatch.IndexOffset = MergedData->Indices.Num();
+
+		MergedData->Vertices.Append(&(*SourceBatch.SourceVertices)[SourceBatch.VertexOffset], SourceBatch.NumVertices);
+		MergedData->Indices.Append(&(*SourceBatch.SourceIndices)[SourceBatch.IndexOffset], SourceBatch.NumIndices);
+
+		for (int32 TestIndex = BatchIndex + 1; TestIndex < SortedBatches.Num(); ++TestIndex)
+		{
+			const FSlateRenderBatch& TestBatch = *SortedBatches[TestIndex];
+			if (TestBatch.GetLayer() != SourceBatch.GetLayer())
+			{
+				// none of the batches will be compatible since we encountered an incompatible layer
+				break;
+			}
+			else if (!MergedBatchMask[TestIndex] && TestBatch.bIsMergable && TestBatch.HasVertexData() && SourceBatch.IsBatchableWith(TestBatch))
+			{
+				// Indices are relative to the start of the batch, so offset them by the vertices already merged into it
+				const int32 BatchOffset = MergedBatch.NumVertices;
+
+				MergedData->Vertices.Append(&(*TestBatch.SourceVertices)[TestBatch.VertexOffset], TestBatch.NumVertices);
+
+				const int32 FirstIndex = MergedData->Indices.AddUninitialized(TestBatch.NumIndices);
+				SlateIndex* MergedIndices = MergedData->Indices.GetData() + FirstIndex;
+				const SlateIndex* TestIndices = TestBatch.SourceIndices->GetData() + TestBatch.IndexOffset;
+				for (int32 i = 0; i < TestBatch.NumIndices; ++i)
+				{
+					MergedIndices[i] = TestIndices[i] + BatchOffset;
+				}
+
+				MergedBatch.NumVertices += TestBatch.NumVertices;
+				MergedBatch.NumIndices += TestBatch.NumIndices;
+				MergedBatchMask[TestIndex] = true;
+			}
+		}
+	}
+}
+
 template<ESlateVertexRounding Rounding>
 void FSlateElementBatcher::AddQuadElement( const FSlateDrawElement& DrawElement )
 {
@@ -111,6 +111,9 @@ static FAutoConsoleVariableRef CVarCullingSlackFillPercent(TEXT("Slate.CullingSl
 
 #endif
 
+int32 GSlateSkipCleanPrepass = 0;
+static FAutoConsoleVariableRef CVarSlateSkipCleanPrepass(TEXT("Slate.SkipCleanPrepass"), GSlateSkipCleanPrepass, TEXT("Outside of invalidation roots, skip the prepass of child subtrees whose layout, child order and visibility have not been invalidated since their last prepass at the same layout scale. Subtrees containing volatile widgets or custom prepasses are always prepassed. Desired sizes driven by bound attributes will only update when the widget is invalidated, as with invalidation panels."), ECVF_Default);
+
 #if WITH_SLATE_DEBUGGING
 
 bool GShowClipping = false;
@@ -205,6 +208,7 @@ SWidget::SWidget()
 	, bInvisibleDueToParentOrSelfVisibility(false)
 	, bNeedsPrepass(true)
 	, bUpdatingDesiredSize(false)
+	, bCanSkipCleanPrepass(false)
 	, bHasCustomPrepass(false)
 	, bHasRelativeLayoutScale(false)
 	, bVolatilityAlwaysInvalidatesPrepass(false)
@@ -1183,6 +1187,18 @@ void SWidget::Invalidate(EInvalidateWidgetReason InvalidateReason)
 		InvalidatePrepass();
 	}
 
+	// When clean subtrees are skipped during the prepass, layout changes have to dirty the whole path to the root
+	// so that every ancestor's desired size is recomputed. The fast path handles this through its invalidation root instead.
+	if (GSlateSkipCleanPrepass && !FastPathProxyHandle.IsValid(this)
+		&& EnumHasAnyFlags(InvalidateReason, EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::ChildOrder | EInvalidateWidgetReason::Visibility))
+	{
+		InvalidatePrepass();
+		for (TSharedPtr<SWidget> Ancestor = GetParentWidget(); Ancestor.IsValid(); Ancestor = Ancestor->GetParentWidget())
+		{
+			Ancestor->bNeedsPrepass = true;
+		}
+	}
+
 	if(FastPathProxyHandle.IsValid(this))
 	{
 		// Current thinking is that visibility and volatility should be updated right away, not during fast path invalidation processing next frame
@@ -1579,6 +1595,9 @@ void SWidget::Prepass_Internal(float InLayoutScaleMultiplier)
 		bShouldPrepassChildren = CustomPrepass(InLayoutScaleMultiplier);
 	}
 
+	// Children clear this in Prepass_ChildLoop if any of them can't be skipped
+	bCanSkipCleanPrepass = !bHasCustomPrepass && !IsVolatile();
+
 	if (bCanHaveChildren && bShouldPrepassChildren)
 	{
 		// Cache child desired sizes first. This widget's desired size is
@@ -1609,8 +1628,19 @@ void SWidget::Prepass_ChildLoop(float InLayoutScaleMultiplier, FChildren* MyChil
 
 		if (Child->Visibility.Get() != EVisibility::Collapsed)
 		{
-			// Recur: Descend down the widget tree.
-			Child->Prepass_Internal(ChildLayoutScaleMultiplier);
+			const bool bSkipCleanChild = GSlateSkipCleanPrepass
+				&& !Child->bNeedsPrepass
+				&& Child->bCanSkipCleanPrepass
+				&& Child->PrepassLayoutScaleMultiplier.IsSet()
+				&& Child->PrepassLayoutScaleMultiplier.GetValue() == ChildLayoutScaleMultiplier;
+
+			if (!bSkipCleanChild)
+			{
+				// Recur: Descend down the widget tree.
+				Child->Prepass_Internal(ChildLayoutScaleMultiplier);
+			}
+
+			bCanSkipCleanPrepass &= Child->bCanSkipCleanPrepass;
 		}
 		else
 		{
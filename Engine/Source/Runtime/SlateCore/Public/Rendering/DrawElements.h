@@ -415,6 +415,8 @@ struct FSlateCachedElementData
 	friend class FSlateElementBatcher;
 	friend struct FSlateCachedElementsHandle;
 
+	SLATECORE_API ~FSlateCachedElementData();
+
 	void Empty();
 
 	FSlateCachedElementsHandle AddCache(const SWidget* Widget);
@@ -428,6 +430,7 @@ struct FSlateCachedElementData
 	void CleanupUnusedClipStates();
 
 	const TSparseArray<FSlateRenderBatch>& GetCachedBatches() const { return CachedBatches; }
+	const TArray<FSlateRenderBatch>& GetMergedBatches() const { return MergedBatches; }
 	const TArray<TSharedPtr<FSlateCachedElementList>>& GetCachedElementLists() const { return CachedElementLists; }
 
 	void AddReferencedObjects(FReferenceCollector& Collector);
@@ -436,11 +439,21 @@ private:
 	/** Removes a cache node completely from the cache */
 	void RemoveList(FSlateCachedElementsHandle& CacheHandle);
 
+	void DestroyMergedRenderingData();
+
 private:
 
 	/** List of cached batches to submit for drawing */
 	TSparseArray<FSlateRenderBatch> CachedBatches;
 
+	/** The cached batches with the batchable ones of each layer already merged. Only rebuilt when the cached batches change. */
+	TArray<FSlateRenderBatch> MergedBatches;
+
+	/** Vertices and indices of the merged batches, destroyed through the renderer like the rendering data of the cached lists */
+	FSlateCachedFastPathRenderingData* MergedRenderingData = nullptr;
+
+	bool bMergedBatchesDirty = true;
+
 	TArray<TSharedPtr<FSlateCachedElementList>> CachedElementLists;
 
 	TArray<FSlateCachedElementList*, TInlineAllocator<50>> ListsWithNewData;
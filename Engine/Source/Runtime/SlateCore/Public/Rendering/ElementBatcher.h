@@ -207,6 +207,7 @@ public:
 		int8 SceneIndex);
 
 	void AddCachedBatches(const TSparseArray<FSlateRenderBatch>& InCachedBatches);
+	void AddCachedBatches(const TArray<FSlateRenderBatch>& InCachedBatches);
 private:
 	void FillBuffersFromNewBatch(FSlateRenderBatch& Batch, FSlateVertexArray& FinalVertices, FSlateIndexArray& FinalIndices);
 	void CombineBatches(FSlateRenderBatch& FirstBatch, FSlateRenderBatch& SecondBatch, FSlateVertexArray& FinalVertices, FSlateIndexArray& FinalIndices);
@@ -279,6 +280,9 @@ private:
 	void AddElementsInternal(const FSlateDrawElementArray& DrawElements, const FVector2D& ViewportSize);
 	void AddCachedElements(FSlateCachedElementData& CachedElementData, const FVector2D& ViewportSize);
 
+	/** Merges the batchable cached batches of each layer ahead of time so unchanged cached data is not merged again every frame */
+	void UpdateMergedCachedBatches(FSlateCachedElementData& CachedElementData);
+
 	/** 
 	 * Creates vertices necessary to draw a Quad element 
 	 */
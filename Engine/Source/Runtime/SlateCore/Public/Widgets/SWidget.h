@@ -1625,6 +1625,9 @@ private:
 	/** Are we currently updating the desired size? */
 	mutable uint8 bUpdatingDesiredSize : 1;
 
+	/** True if nothing in this subtree is volatile or has a custom prepass, so a clean prepass can be skipped (see Slate.SkipCleanPrepass). */
+	uint8 bCanSkipCleanPrepass : 1;
+
 protected:
 	uint8 bHasCustomPrepass : 1;
 
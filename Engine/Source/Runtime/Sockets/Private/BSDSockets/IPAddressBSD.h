@@ -293,6 +293,7 @@ public:
 	virtual uint32 GetTypeHash() const override;
 
 	friend class FSocketBSD;
+	friend struct FUnixSendMulti;
 };
 
 #endif
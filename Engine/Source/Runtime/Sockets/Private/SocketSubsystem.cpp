@@ -607,6 +607,18 @@ bool ISocketSubsystem::IsSocketRecvMultiSupported() const
 	return false;
 }
 
+TUniquePtr<FSendMulti> ISocketSubsystem::CreateSendMulti(int32 MaxNumPackets, int32 MaxPacketSize)
+{
+	UE_LOG(LogSockets, Warning, TEXT("SendMulti is not supported by current socket subsystem."));
+
+	return nullptr;
+}
+
+bool ISocketSubsystem::IsSocketSendMultiSupported() const
+{
+	return false;
+}
+
 double ISocketSubsystem::TranslatePacketTimestamp(const FPacketTimestamp& Timestamp,
 													ETimestampTranslation Translation/*=ETimestampTranslation::LocalTimestamp*/)
 {
@@ -25,6 +25,23 @@ void FRecvMulti::CountBytes(FArchive& Ar) const
 	Ar.CountBytes(MaxNumPackets * sizeof(FRecvData), MaxNumPackets * sizeof(FRecvData));
 }
 
+
+/**
+ * FSendMulti
+ */
+
+FSendMulti::FSendMulti(int32 InMaxNumPackets, int32 InMaxPacketSize)
+	: NumPackets(0)
+	, MaxNumPackets(InMaxNumPackets)
+	, MaxPacketSize(InMaxPacketSize)
+{
+}
+
+void FSendMulti::CountBytes(FArchive& Ar) const
+{
+	Ar.CountBytes(sizeof(*this), sizeof(*this));
+}
+
 //
 // FSocket stats implementation
 //
@@ -69,6 +86,13 @@ bool FSocket::RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Flags/*
 	return false;
 }
 
+bool FSocket::SendMulti(FSendMulti& MultiData, int32 FirstPacketIdx, int32& OutNumPacketsSent)
+{
+	OutNumPacketsSent = 0;
+
+	return false;
+}
+
 bool FSocket::SetRetrieveTimestamp(bool bRetrieveTimestamp/*=true*/)
 {
 	return false;
@@ -174,6 +174,24 @@ bool FSocketSubsystemUnix::IsSocketRecvMultiSupported() const
 	return false;
 }
 
+TUniquePtr<FSendMulti> FSocketSubsystemUnix::CreateSendMulti(int32 MaxNumPackets, int32 MaxPacketSize)
+{
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_SENDMMSG
+	return MakeUnique<FUnixSendMulti>(MaxNumPackets, MaxPacketSize);
+#endif
+
+	return nullptr;
+}
+
+bool FSocketSubsystemUnix::IsSocketSendMultiSupported() const
+{
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_SENDMMSG
+	return true;
+#endif
+
+	return false;
+}
+
 double FSocketSubsystemUnix::TranslatePacketTimestamp(const FPacketTimestamp& Timestamp, ETimestampTranslation Translation)
 {
 	double ReturnVal = 0.0;
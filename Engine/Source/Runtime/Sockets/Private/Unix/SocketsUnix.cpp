@@ -115,6 +115,92 @@ void FUnixRecvMulti::CountBytes(FArchive& Ar) const
 #endif
 
 
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_SENDMMSG
+/**
+ * FUnixSendMulti
+ */
+
+FUnixSendMulti::FUnixSendMulti(int32 InMaxNumPackets, int32 InMaxPacketSize)
+	: FSendMulti(InMaxNumPackets, InMaxPacketSize)
+	, Headers(MakeUnique<mmsghdr[]>(MaxNumPackets))
+	, BufferMaps(MakeUnique<iovec[]>(MaxNumPackets))
+	, Destinations(MakeUnique<sockaddr_storage[]>(MaxNumPackets))
+	, DataBuffer(MakeUnique<uint8[]>(MaxNumPackets * MaxPacketSize))
+{
+	for (int32 i=0; i<MaxNumPackets; i++)
+	{
+		mmsghdr& CurHeader = Headers[i];
+		msghdr& CurInnerHeader = CurHeader.msg_hdr;
+		iovec& CurBufferMap = BufferMaps[i];
+
+		CurHeader.msg_len = 0;
+
+		CurInnerHeader.msg_name = &Destinations[i];
+		CurInnerHeader.msg_namelen = 0;
+		CurInnerHeader.msg_iov = &CurBufferMap;
+		CurInnerHeader.msg_iovlen = 1;
+		CurInnerHeader.msg_control = nullptr;
+		CurInnerHeader.msg_controllen = 0;
+		CurInnerHeader.msg_flags = 0;
+
+		CurBufferMap.iov_base = (void*)&DataBuffer[MaxPacketSize*i];
+		CurBufferMap.iov_len = 0;
+	}
+}
+
+bool FUnixSendMulti::AddPacket(const uint8* Data, int32 Count, const FInternetAddr& Destination)
+{
+	if (IsFull() || Count <= 0 || Count > MaxPacketSize)
+	{
+		return false;
+	}
+
+	const FInternetAddrBSD& BSDAddr = static_cast<const FInternetAddrBSD&>(Destination);
+	msghdr& CurInnerHeader = Headers[NumPackets].msg_hdr;
+	iovec& CurBufferMap = BufferMaps[NumPackets];
+
+	FMemory::Memcpy(CurBufferMap.iov_base, Data, Count);
+	CurBufferMap.iov_len = Count;
+
+	Destinations[NumPackets] = BSDAddr.Addr;
+	CurInnerHeader.msg_namelen = BSDAddr.GetStorageSize();
+
+	NumPackets++;
+
+	return true;
+}
+
+void FUnixSendMulti::CountBytes(FArchive& Ar) const
+{
+	FSendMulti::CountBytes(Ar);
+
+	int32 CurSize = sizeof(*this) - sizeof(FSendMulti);
+
+	Ar.CountBytes(CurSize, CurSize);
+
+	// Headers
+	CurSize = sizeof(mmsghdr) * MaxNumPackets;
+
+	Ar.CountBytes(CurSize, CurSize);
+
+	// BufferMaps
+	CurSize = sizeof(iovec) * MaxNumPackets;
+
+	Ar.CountBytes(CurSize, CurSize);
+
+	// Destinations
+	CurSize = sizeof(sockaddr_storage) * MaxNumPackets;
+
+	Ar.CountBytes(CurSize, CurSize);
+
+	// DataBuffer
+	CurSize = MaxNumPackets * MaxPacketSize;
+
+	Ar.CountBytes(CurSize, CurSize);
+}
+#endif
+
+
 /**
  * FSocketUnix
  */
@@ -142,6 +228,45 @@ bool FSocketUnix::RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Fla
 	return bSuccess;
 }
 
+// NOTE: Does not support TCP at the moment.
+bool FSocketUnix::SendMulti(FSendMulti& MultiData, int32 FirstPacketIdx, int32& OutNumPacketsSent)
+{
+	bool bSuccess = false;
+
+	OutNumPacketsSent = 0;
+
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_SENDMMSG
+	FUnixSendMulti& UnixMultiData = (FUnixSendMulti&)MultiData;
+	mmsghdr* Headers = UnixMultiData.Headers.Get();
+	const int32 NumPackets = UnixMultiData.NumPackets;
+	int32 CurPacketIdx = FMath::Max(0, FirstPacketIdx);
+
+	bSuccess = true;
+
+	// sendmmsg may send fewer packets than requested, so keep going until everything was sent or an error is hit
+	while (CurPacketIdx < NumPackets)
+	{
+		int NumPacketsSent = sendmmsg(Socket, &Headers[CurPacketIdx], NumPackets - CurPacketIdx, 0);
+
+		if (NumPacketsSent <= 0)
+		{
+			bSuccess = false;
+			break;
+		}
+
+		CurPacketIdx += NumPacketsSent;
+		OutNumPacketsSent += NumPacketsSent;
+	}
+
+	if (OutNumPacketsSent > 0)
+	{
+		LastActivityTime = FPlatformTime::Seconds();
+	}
+#endif
+
+	return bSuccess;
+}
+
 bool FSocketUnix::SetRetrieveTimestamp(bool bRetrieveTimestamp)
 {
 	bool bSuccess = false;
@@ -39,8 +39,41 @@ public:
 #endif
 
 
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_SENDMMSG
 /**
- * Unix specific socket implementation - primarily, adds support for recvmmsg
+ * Implements platform specific data/buffers for SendMulti in Linux
+ */
+struct FUnixSendMulti : public FSendMulti
+{
+	friend class FSocketUnix;
+
+protected:
+	/** Persistently stores preconfigured mmsghdr struct values, for use with sendmmsg */
+	TUniquePtr<mmsghdr[]>			Headers;
+
+
+private:
+	/** Maps sections of DataBuffer for sending packet data, within Headers */
+	TUniquePtr<iovec[]>				BufferMaps;
+
+	/** The destination address of each queued packet */
+	TUniquePtr<sockaddr_storage[]>	Destinations;
+
+	/** The raw data buffer where all queued packet data is stored. */
+	TUniquePtr<uint8[]>				DataBuffer;
+
+
+public:
+	FUnixSendMulti(int32 InMaxNumPackets, int32 InMaxPacketSize);
+
+	virtual bool AddPacket(const uint8* Data, int32 Count, const FInternetAddr& Destination) override;
+	virtual void CountBytes(FArchive& Ar) const override;
+};
+#endif
+
+
+/**
+ * Unix specific socket implementation - primarily, adds support for recvmmsg/sendmmsg
  */
 class FSocketUnix : public FSocketBSD
 {
@@ -55,5 +88,6 @@ public:
 	}
 
 	virtual bool RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Flags) override;
+	virtual bool SendMulti(FSendMulti& MultiData, int32 FirstPacketIdx, int32& OutNumPacketsSent) override;
 	virtual bool SetRetrieveTimestamp(bool bRetrieveTimestamp) override;
 };
@@ -337,6 +337,15 @@ public:
 	virtual TUniquePtr<FRecvMulti> CreateRecvMulti(int32 MaxNumPackets, int32 MaxPacketSize,
 													ERecvMultiFlags Flags=ERecvMultiFlags::None);
 
+	/**
+	 * Create a platform specific FSendMulti representation
+	 *
+	 * @param MaxNumPackets			The maximum number of queued packets supported
+	 * @param MaxPacketSize			The maximum supported packet size
+	 * @return						Returns the platform specific FSendMulti instance
+	 */
+	virtual TUniquePtr<FSendMulti> CreateSendMulti(int32 MaxNumPackets, int32 MaxPacketSize);
+
 	/**
 	 * @return Whether the machine has a properly configured network device or not
 	 */
@@ -462,6 +471,11 @@ public:
 	 */
 	virtual bool IsSocketRecvMultiSupported() const;
 
+	/**
+	 * Returns true if FSocket::SendMulti is supported by this socket subsystem
+	 */
+	virtual bool IsSocketSendMultiSupported() const;
+
 
 	/**
 	 * Returns true if FSocket::Wait is supported by this socket subsystem.
@@ -264,3 +264,79 @@ public:
 	 */
 	virtual void CountBytes(FArchive& Ar) const;
 };
+
+
+/**
+ * Stores the persistent state and packet buffers, for queueing packets and sending them with a single FSocket::SendMulti call.
+ * To optimize performance, use only one instance of this struct, for the lifetime of the socket.
+ */
+struct SOCKETS_API FSendMulti : public FNoncopyable, public FVirtualDestructor
+{
+	friend struct FUnixSendMulti;
+	friend class FSocketUnix;
+
+protected:
+	/** The number of packets currently queued */
+	int32							NumPackets;
+
+public:
+	/** The maximum number of packets this FSendMulti instance can queue */
+	const int32						MaxNumPackets;
+
+	/** The maximum packet size this FSendMulti instance can support */
+	const int32						MaxPacketSize;
+
+
+private:
+	/**
+	 * Initialize an FSendMulti instance, supporting the specified maximum packet count/sizes
+	 *
+	 * @param InMaxNumPackets		The maximum number of queued packets supported
+	 * @param InMaxPacketSize		The maximum supported packet size
+	 */
+	FSendMulti(int32 InMaxNumPackets, int32 InMaxPacketSize);
+
+
+public:
+	/**
+	 * Copies a packet into the next free slot of the queue
+	 *
+	 * @param Data			The packet data
+	 * @param Count			The packet size in bytes
+	 * @param Destination	The address to send the packet to
+	 * @return				Whether or not the packet was queued (fails if the queue is full, or the packet exceeds MaxPacketSize)
+	 */
+	virtual bool AddPacket(const uint8* Data, int32 Count, const FInternetAddr& Destination) = 0;
+
+	/**
+	 * Empties the queue, keeping the buffers for reuse
+	 */
+	void Reset()
+	{
+		NumPackets = 0;
+	}
+
+	/**
+	 * Retrieves the current number of queued packets
+	 */
+	int32 GetNumPackets() const
+	{
+		return NumPackets;
+	}
+
+	/**
+	 * Whether or not the queue has no free slots left
+	 */
+	bool IsFull() const
+	{
+		return NumPackets >= MaxNumPackets;
+	}
+
+
+	/**
+	 * Calculates the total memory consumption of this FSendMulti instance, including platform-specific data
+	 *
+	 * @param Ar	The archive being used to count the memory consumption
+	 */
+	virtual void CountBytes(FArchive& Ar) const;
+};
@@ -227,6 +227,19 @@ public:
 	 */
 	virtual bool RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Flags=ESocketReceiveFlags::None);
 
+	/**
+	 * Sends the packets queued in an FSendMulti instance, using as few system calls as the platform allows.
+	 * Use ISocketSubsystem::IsSocketSendMultiSupported to check if the current socket platform supports this.
+	 * Packets are sent in queue order, stopping at the first packet that fails to send.
+	 *
+	 * @param MultiData				The FSendMulti instance holding the queued packets and platform specific buffers.
+	 * @param FirstPacketIdx		The index of the first queued packet to send.
+	 * @param OutNumPacketsSent		The number of packets sent, starting from FirstPacketIdx.
+	 * @return						Whether or not all packets from FirstPacketIdx onwards were sent. On failure, the failed
+	 *								packet is at FirstPacketIdx + OutNumPacketsSent, and the error is available from the socket subsystem.
+	 */
+	virtual bool SendMulti(FSendMulti& MultiData, int32 FirstPacketIdx, int32& OutNumPacketsSent);
+
 	/**
 	 * Blocks until the specified condition is met.
 	 *
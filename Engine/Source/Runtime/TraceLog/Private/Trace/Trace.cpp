@@ -19,6 +19,7 @@ void	Writer_Shutdown();
 void	Writer_Update();
 bool	Writer_SendTo(const ANSICHAR*, uint32);
 bool	Writer_WriteTo(const ANSICHAR*);
+bool	Writer_WriteSnapshotTo(const ANSICHAR*);
 bool	Writer_IsTracing();
 
 } // namespace Private
@@ -83,6 +84,14 @@ bool WriteTo(const TCHAR* InPath)
 	return Private::Writer_WriteTo(Path);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+bool WriteSnapshotTo(const TCHAR* InPath)
+{
+	char Path[512];
+	ToAnsiCheap(Path, InPath);
+	return Private::Writer_WriteSnapshotTo(Path);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 bool IsTracing()
 {
@@ -214,9 +214,141 @@ void Writer_MemoryFree(void* Address, uint32 Size)
 static UPTRINT					GDataHandle;		// = 0
 UPTRINT							GPendingDataHandle;	// = 0
 
+
+
+////////////////////////////////////////////////////////////////////////////////
+// The tail is a fixed-size ring of the most recently sent packets that is kept
+// regardless of whether or not there is a connection. It can be written out to
+// a file at any time as a self-contained trace (see Writer_WriteSnapshotTo()).
+// Packets from the internal thread (the trace header and event descriptions)
+// are needed to decode everything else so they are kept separately and are
+// never evicted.
+struct FTailBuffer
+{
+	uint8*	Data;
+	uint32	Capacity;
+	uint32	Head;
+	uint32	Used;
+};
+
+static FTailBuffer				GTail;				// = {}
+static FTailBuffer				GTailPreamble;		// = {}
+
+////////////////////////////////////////////////////////////////////////////////
+static void Writer_TailRead(uint32 Offset, void* Dest, uint32 Size)
+{
+	Offset %= GTail.Capacity;
+	uint32 FirstSize = (Size < GTail.Capacity - Offset) ? Size : GTail.Capacity - Offset;
+	memcpy(Dest, GTail.Data + Offset, FirstSize);
+	memcpy((uint8*)Dest + FirstSize, GTail.Data, Size - FirstSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void Writer_TailWrite(uint32 Offset, const void* Src, uint32 Size)
+{
+	Offset %= GTail.Capacity;
+	uint32 FirstSize = (Size < GTail.Capacity - Offset) ? Size : GTail.Capacity - Offset;
+	memcpy(GTail.Data + Offset, Src, FirstSize);
+	memcpy(GTail.Data, (const uint8*)Src + FirstSize, Size - FirstSize);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-void Writer_SendDataRaw(const void* Data, uint32 Size)
+static void Writer_TailPreambleAppend(const void* Data, uint32 Size)
 {
+	if (GTailPreamble.Used + Size > GTailPreamble.Capacity)
+	{
+		uint32 NewCapacity = GTailPreamble.Capacity ? GTailPreamble.Capacity : (16 << 10);
+		while (GTailPreamble.Used + Size > NewCapacity)
+		{
+			NewCapacity <<= 1;
+		}
+
+		// Allocation may itself emit trace data which recurses into the tail
+		// ring, so the preamble is only swapped over once the copy is complete.
+		uint8* NewData = (uint8*)Writer_MemoryAllocate(NewCapacity, 16);
+		if (GTailPreamble.Data != nullptr)
+		{
+			memcpy(NewData, GTailPreamble.Data, GTailPreamble.Used);
+			Writer_MemoryFree(GTailPreamble.Data, GTailPreamble.Capacity);
+		}
+		GTailPreamble.Data = NewData;
+		GTailPreamble.Capacity = NewCapacity;
+	}
+
+	memcpy(GTailPreamble.Data + GTailPreamble.Used, Data, Size);
+	GTailPreamble.Used += Size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void Writer_TailAppend(uint32 ThreadId, const void* Data, uint32 Size)
+{
+	if (ThreadId == ETransportTid::Internal)
+	{
+		Writer_TailPreambleAppend(Data, Size);
+		return;
+	}
+
+	if (Size > GTail.Capacity)
+	{
+		return;
+	}
+
+	// Evict the oldest packets until there is room. All packets start with
+	// their size so the ring can be walked without any additional bookkeeping.
+	while (GTail.Used + Size > GTail.Capacity)
+	{
+		uint16 PacketSize;
+		Writer_TailRead(GTail.Head, &PacketSize, sizeof(PacketSize));
+		GTail.Head = (GTail.Head + PacketSize) % GTail.Capacity;
+		GTail.Used -= PacketSize;
+	}
+
+	Writer_TailWrite(GTail.Head + GTail.Used, Data, Size);
+	GTail.Used += Size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void Writer_TailInitialize(uint32 Capacity)
+{
+	if (GTail.Data != nullptr || Capacity == 0)
+	{
+		return;
+	}
+
+	GTail.Data = (uint8*)Writer_MemoryAllocate(Capacity, 16);
+	GTail.Capacity = Capacity;
+	GTail.Head = 0;
+	GTail.Used = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void Writer_TailShutdown()
+{
+	for (FTailBuffer* Buffer : { &GTail, &GTailPreamble })
+	{
+		if (Buffer->Data != nullptr)
+		{
+			Writer_MemoryFree(Buffer->Data, Buffer->Capacity);
+		}
+		*Buffer = {};
+	}
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+void Writer_SendDataRaw(uint32 ThreadId, const void* Data, uint32 Size)
+{
+	if (GTail.Data != nullptr)
+	{
+		Writer_TailAppend(ThreadId, Data, Size);
+	}
+
+	if (!GDataHandle)
+	{
+		return;
+	}
+
 	if (!IoWrite(GDataHandle, Data, Size))
 	{
 		IoClose(GDataHandle);
@@ -227,7 +359,7 @@ void Writer_SendDataRaw(const void* Data, uint32 Size)
 ////////////////////////////////////////////////////////////////////////////////
 uint32 Writer_SendData(uint32 ThreadId, uint8* __restrict Data, uint32 Size)
 {
-	if (!GDataHandle)
+	if (!GDataHandle && GTail.Data == nullptr)
 	{
 		return 0;
 	}
@@ -249,7 +381,7 @@ uint32 Writer_SendData(uint32 ThreadId, uint8* __restrict Data, uint32 Size)
 		Packet->ThreadId = uint16(ThreadId & 0x7fff);
 		Packet->PacketSize = uint16(Size);
 
-		Writer_SendDataRaw(Data, Size);
+		Writer_SendDataRaw(ThreadId, Data, Size);
 
 		return Size;
 	}
@@ -275,7 +407,7 @@ uint32 Writer_SendData(uint32 ThreadId, uint8* __restrict Data, uint32 Size)
 	Packet.PacketSize = Encode(Data, Packet.DecodedSize, Packet.Data, sizeof(Packet.Data));
 	Packet.PacketSize += sizeof(FPacketEncoded);
 
-	Writer_SendDataRaw(&Packet, Packet.PacketSize);
+	Writer_SendDataRaw(ThreadId, &Packet, Packet.PacketSize);
 
 	return Packet.PacketSize;
 }
@@ -323,7 +455,7 @@ static void Writer_AnnounceChannels()
 ////////////////////////////////////////////////////////////////////////////////
 static void Writer_DescribeAnnounce()
 {
-	if (!GDataHandle)
+	if (!GDataHandle && GTail.Data == nullptr)
 	{
 		return;
 	}
@@ -352,6 +484,36 @@ static void Writer_LogTimingHeader()
 		<< Timing.CycleFrequency(TimeGetFrequency());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+static bool Writer_WriteStreamHeader(UPTRINT Handle)
+{
+	// Handshake.
+	const uint32 Magic = 'TRCE';
+	bool bOk = IoWrite(Handle, &Magic, sizeof(Magic));
+
+	// Stream header
+	const struct {
+		uint8 TransportVersion	= ETransport::TidPacket;
+		uint8 ProtocolVersion	= EProtocol::Id;
+	} TransportHeader;
+	bOk &= IoWrite(Handle, &TransportHeader, sizeof(TransportHeader));
+
+	return bOk;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void Writer_SendHeaderEvents()
+{
+	TWriteBufferRedirect<512> HeaderEvents;
+	Writer_LogHeader();
+	Writer_LogTimingHeader();
+	HeaderEvents.Close();
+
+	Writer_DescribeEvents();
+
+	Writer_SendData(HeaderEvents.GetData(), HeaderEvents.GetSize());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 static bool Writer_UpdateConnection()
 {
@@ -371,39 +533,67 @@ static bool Writer_UpdateConnection()
 	GDataHandle = GPendingDataHandle;
 	GPendingDataHandle = 0;
 
-	// Handshake.
-	const uint32 Magic = 'TRCE';
-	bool bOk = IoWrite(GDataHandle, &Magic, sizeof(Magic));
-
-	// Stream header
-	const struct {
-		uint8 TransportVersion	= ETransport::TidPacket;
-		uint8 ProtocolVersion	= EProtocol::Id;
-	} TransportHeader;
-	bOk &= IoWrite(GDataHandle, &TransportHeader, sizeof(TransportHeader));
-
-	if (!bOk)
+	if (!Writer_WriteStreamHeader(GDataHandle))
 	{
 		IoClose(GDataHandle);
 		GDataHandle = 0;
 		return false;
 	}
 
-	// Send the header events
-	TWriteBufferRedirect<512> HeaderEvents;
-	Writer_LogHeader();
-	Writer_LogTimingHeader();
-	HeaderEvents.Close();
-
-	Writer_DescribeEvents();
+	// When the tail is active the header events and all descriptions so far
+	// have already been sent, into the tail's preamble.
+	if (GTail.Data != nullptr)
+	{
+		if (!IoWrite(GDataHandle, GTailPreamble.Data, GTailPreamble.Used))
+		{
+			IoClose(GDataHandle);
+			GDataHandle = 0;
+			return false;
+		}
 
-	Writer_SendData(HeaderEvents.GetData(), HeaderEvents.GetSize());
+		return true;
+	}
 
+	Writer_SendHeaderEvents();
 	return true;
 }
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+static ANSICHAR			GSnapshotPath[512];
+static int32 volatile	GSnapshotState;		// = 0; 0=idle, 1=claimed, 2=pending
+
+////////////////////////////////////////////////////////////////////////////////
+static void Writer_UpdateSnapshot()
+{
+	if (AtomicLoadAcquire(&GSnapshotState) != 2)
+	{
+		return;
+	}
+
+	if (UPTRINT Handle = FileOpen(GSnapshotPath))
+	{
+		bool bOk = Writer_WriteStreamHeader(Handle);
+		bOk = bOk && IoWrite(Handle, GTailPreamble.Data, GTailPreamble.Used);
+
+		// The ring may wrap, in which case it is written out in two parts.
+		uint32 FirstSize = GTail.Capacity - GTail.Head;
+		FirstSize = (GTail.Used < FirstSize) ? GTail.Used : FirstSize;
+		bOk = bOk && IoWrite(Handle, GTail.Data + GTail.Head, FirstSize);
+		if (GTail.Used > FirstSize)
+		{
+			bOk = bOk && IoWrite(Handle, GTail.Data, GTail.Used - FirstSize);
+		}
+
+		IoClose(Handle);
+	}
+
+	AtomicStoreRelease(&GSnapshotState, 0);
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 static UPTRINT			GWorkerThread;		// = 0;
 static volatile bool	GWorkerThreadQuit;	// = false;
@@ -415,6 +605,7 @@ static void Writer_WorkerUpdate()
 	Writer_UpdateConnection();
 	Writer_DescribeAnnounce();
 	Writer_DrainBuffers();
+	Writer_UpdateSnapshot();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -502,6 +693,7 @@ static void Writer_InternalShutdown()
 		GDataHandle = 0;
 	}
 
+	Writer_TailShutdown();
 	Writer_ShutdownControl();
 	Writer_ShutdownPool();
 
@@ -532,6 +724,14 @@ void Writer_InternalInitialize()
 ////////////////////////////////////////////////////////////////////////////////
 void Writer_Initialize(const FInitializeDesc& Desc)
 {
+	// The tail needs to see the header events and every event description, so
+	// it can only be started before anything has been sent anywhere.
+	if (Desc.TailSizeBytes && !GDataHandle && !GPendingDataHandle)
+	{
+		Writer_TailInitialize(Desc.TailSizeBytes);
+		Writer_SendHeaderEvents();
+	}
+
 	if (Desc.bUseWorkerThread)
 	{
 		Writer_WorkerCreate();
@@ -607,6 +807,32 @@ bool Writer_WriteTo(const ANSICHAR* Path)
 	return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+bool Writer_WriteSnapshotTo(const ANSICHAR* Path)
+{
+	if (GTail.Data == nullptr)
+	{
+		return false;
+	}
+
+	// Only one snapshot can be in flight at a time. The worker picks it up on
+	// its next update once the path has been published.
+	if (!AtomicCompareExchangeAcquire(&GSnapshotState, 1, 0))
+	{
+		return false;
+	}
+
+	uint32 i = 0;
+	for (; i < sizeof(GSnapshotPath) - 1 && Path[i] != '\0'; ++i)
+	{
+		GSnapshotPath[i] = Path[i];
+	}
+	GSnapshotPath[i] = '\0';
+
+	AtomicStoreRelease(&GSnapshotState, 2);
+	return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 bool Writer_IsTracing()
 {
@@ -24,6 +24,7 @@ enum WideString {};
 struct FInitializeDesc
 {
 	bool			bUseWorkerThread	= true;
+	uint32			TailSizeBytes		= 0;	// Keep the most recent trace data in memory for WriteSnapshotTo(). Zero disables.
 };
 
 typedef void*		AllocFunc(SIZE_T, uint32);
@@ -35,6 +36,7 @@ UE_TRACE_API void	Shutdown() UE_TRACE_IMPL();
 UE_TRACE_API void	Update() UE_TRACE_IMPL();
 UE_TRACE_API bool	SendTo(const TCHAR* Host, uint32 Port=0) UE_TRACE_IMPL(false);
 UE_TRACE_API bool	WriteTo(const TCHAR* Path) UE_TRACE_IMPL(false);
+UE_TRACE_API bool	WriteSnapshotTo(const TCHAR* Path) UE_TRACE_IMPL(false);
 UE_TRACE_API bool	IsTracing() UE_TRACE_IMPL(false);
 UE_TRACE_API bool	IsChannel(const TCHAR* ChanneName) UE_TRACE_IMPL(false);
 UE_TRACE_API bool	ToggleChannel(const TCHAR* ChannelName, bool bEnabled) UE_TRACE_IMPL(false);
@@ -30,6 +30,32 @@ void FUserWidgetPool::AddReferencedObjects(FReferenceCollector& Collector)
 	Collector.AddReferencedObjects<UUserWidget>(InactiveWidgets, OwningWidget.Get());
 }
 
+int32 FUserWidgetPool::PreWarm(TSubclassOf<UUserWidget> WidgetClass, int32 NumInstances, int32 MaxToCreate)
+{
+	if (!ensure(IsInitialized()) || !WidgetClass)
+	{
+		return 0;
+	}
+
+	auto IsOfClass = [&WidgetClass](const UUserWidget* Widget) { return Widget->GetClass() == WidgetClass; };
+	int32 NumMissing = NumInstances - ActiveWidgets.FilterByPredicate(IsOfClass).Num() - InactiveWidgets.FilterByPredicate(IsOfClass).Num();
+
+	UWidget* OwningWidgetPtr = OwningWidget.Get();
+	for (int32 NumCreated = 0; NumMissing > 0 && NumCreated < MaxToCreate; ++NumCreated)
+	{
+		UUserWidget* WidgetInstance = OwningWidgetPtr ? CreateWidget(OwningWidgetPtr, WidgetClass) : CreateWidget(OwningWorld.Get(), WidgetClass);
+		if (!WidgetInstance)
+		{
+			return 0;
+		}
+
+		InactiveWidgets.Add(WidgetInstance);
+		--NumMissing;
+	}
+
+	return FMath::Max(NumMissing, 0);
+}
+
 void FUserWidgetPool::Release(UUserWidget* Widget, bool bReleaseSlate)
 {
 	if (Widget != nullptr)
@@ -9,6 +9,12 @@
 
 #define LOCTEXT_NAMESPACE "UMG"
 
+static int32 GListViewPreWarmEntriesPerFrame = 2;
+static FAutoConsoleVariableRef CVarListViewPreWarmEntriesPerFrame(
+	TEXT("UMG.ListView.PreWarmEntriesPerFrame"),
+	GListViewPreWarmEntriesPerFrame,
+	TEXT("The maximum number of entry widgets a list view creates per frame when pre-warming its entry pool (see NumPreWarmedEntries)."));
+
 UListViewBase::UListViewBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, EntryWidgetPool(*this)
@@ -126,6 +132,14 @@ TSharedRef<SWidget> UListViewBase::RebuildWidget()
 	MyTableViewBase->SetFixedLineScrollOffset(bEnableFixedLineOffset ? TOptional<double>(FixedLineScrollOffset) : TOptional<double>());
 	MyTableViewBase->SetWheelScrollMultiplier(GetGlobalScrollAmount() * WheelScrollMultiplier);
 
+	if (NumPreWarmedEntries > 0 && !IsDesignTime() && !PreWarmEntriesTimerHandle.IsValid())
+	{
+		if (UWorld* World = GetWorld())
+		{
+			PreWarmEntriesTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UListViewBase::HandlePreWarmEntries);
+		}
+	}
+
 	return MyTableViewBase.ToSharedRef();
 }
 
@@ -210,6 +224,26 @@ void UListViewBase::FinishGeneratingEntry(UUserWidget& GeneratedEntry)
 	}
 }
 
+void UListViewBase::HandlePreWarmEntries()
+{
+	PreWarmEntriesTimerHandle.Invalidate();
+
+	// The pool is reset along with our Slate resources, so there is nothing to warm until the list is rebuilt
+	if (!MyTableViewBase.IsValid())
+	{
+		return;
+	}
+
+	const int32 NumMissing = EntryWidgetPool.PreWarm(EntryWidgetClass, NumPreWarmedEntries, FMath::Max(GListViewPreWarmEntriesPerFrame, 1));
+	if (NumMissing > 0)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			PreWarmEntriesTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UListViewBase::HandlePreWarmEntries);
+		}
+	}
+}
+
 void UListViewBase::HandleAnnounceGeneratedEntries()
 {
 	EntryGenAnnouncementTimerHandle.Invalidate();
@@ -66,6 +66,13 @@ public:
 		return AddActiveWidgetInternal(WidgetClass, ConstructWidgetFunc);
 	}
 
+	/**
+	 * Creates inactive instances of the given class until the pool holds at least NumInstances of it (active or inactive), creating no more than MaxToCreate in this call.
+	 * Only the UUserWidget objects are created up front; their underlying Slate is still built when they are first handed out by GetOrCreateInstance.
+	 * @return The number of instances still missing to reach NumInstances.
+	 */
+	int32 PreWarm(TSubclassOf<UUserWidget> WidgetClass, int32 NumInstances, int32 MaxToCreate = MAX_int32);
+
 	/** Return a widget object to the pool, allowing it to be reused in the future */
 	void Release(UUserWidget* Widget, bool bReleaseSlate = false);
 
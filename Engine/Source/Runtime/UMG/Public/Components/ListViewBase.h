@@ -689,9 +689,17 @@ protected:
 	UPROPERTY(EditAnywhere, Category = Scrolling, meta = (EditCondition = bEnableFixedLineOffset, ClampMin = 0.0f, ClampMax = 0.5f))
 	float FixedLineScrollOffset = 0.f;
 
+	/**
+	 * The number of entry widgets to create ahead of time, a few per frame, once the list is built.
+	 * Lists that will scroll through many entries can set this to the number of rows they expect to display so scrolling doesn't have to create entry widgets.
+	 */
+	UPROPERTY(EditAnywhere, Category = ListEntries, meta = (ClampMin = 0))
+	int32 NumPreWarmedEntries = 0;
+
 private:
 	void FinishGeneratingEntry(UUserWidget& GeneratedEntry);
 	void HandleAnnounceGeneratedEntries();
+	void HandlePreWarmEntries();
 
 private:
 	/** Called when a row widget is generated for a list item */
@@ -714,6 +722,7 @@ private:
 	FUserWidgetPool EntryWidgetPool;
 
 	FTimerHandle EntryGenAnnouncementTimerHandle;
+	FTimerHandle PreWarmEntriesTimerHandle;
 	TArray<TWeakObjectPtr<UUserWidget>> GeneratedEntriesToAnnounce;
 
 	FOnListEntryGenerated OnListEntryGeneratedEvent;
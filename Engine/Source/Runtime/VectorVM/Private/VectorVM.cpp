@@ -30,6 +30,13 @@ DEFINE_LOG_CATEGORY_STATIC(LogVectorVM, All, All);
 #define VM_FORCEINLINE FORCEINLINE
 #endif
 
+// Number of ops each kernel handler issues per loop iteration. Processing several vectors per iteration
+// (8 lanes per iteration with 4 wide SSE/NEON registers) amortizes the loop overhead and gives the CPU
+// independent work to overlap, without changing the register layout of the VM.
+#ifndef VM_KERNEL_UNROLL
+#define VM_KERNEL_UNROLL 2
+#endif
+
 #define OP_REGISTER (0)
 #define OP0_CONST (1 << 0)
 #define OP1_CONST (1 << 1)
@@ -612,7 +619,15 @@ struct TUnaryKernelHandler
 		DstHandler Dst(Context);
 
 		const int32 Loops = Context.GetNumLoops<NumInstancesPerOp>();
-		for (int32 i = 0; i < Loops; ++i)
+		int32 i = 0;
+		for (; i + VM_KERNEL_UNROLL <= Loops; i += VM_KERNEL_UNROLL)
+		{
+			for (int32 j = 0; j < VM_KERNEL_UNROLL; ++j)
+			{
+				Kernel::DoKernel(Context, Dst.GetDestAndAdvance(), Arg0.GetAndAdvance());
+			}
+		}
+		for (; i < Loops; ++i)
 		{
 			Kernel::DoKernel(Context, Dst.GetDestAndAdvance(), Arg0.GetAndAdvance());
 		}
@@ -638,7 +653,15 @@ struct TBinaryKernelHandler
 		DstHandler Dst(Context);
 
 		const int32 Loops = Context.GetNumLoops<NumInstancesPerOp>();
-		for (int32 i = 0; i < Loops; ++i)
+		int32 i = 0;
+		for (; i + VM_KERNEL_UNROLL <= Loops; i += VM_KERNEL_UNROLL)
+		{
+			for (int32 j = 0; j < VM_KERNEL_UNROLL; ++j)
+			{
+				Kernel::DoKernel(Context, Dst.GetDestAndAdvance(), Arg0.GetAndAdvance(), Arg1.GetAndAdvance());
+			}
+		}
+		for (; i < Loops; ++i)
 		{
 			Kernel::DoKernel(Context, Dst.GetDestAndAdvance(), Arg0.GetAndAdvance(), Arg1.GetAndAdvance());
 		}
@@ -666,7 +689,15 @@ struct TTrinaryKernelHandler
 		DstHandler Dst(Context);
 
 		const int32 Loops = Context.GetNumLoops<NumInstancesPerOp>();
-		for (int32 i = 0; i < Loops; ++i)
+		int32 i = 0;
+		for (; i + VM_KERNEL_UNROLL <= Loops; i += VM_KERNEL_UNROLL)
+		{
+			for (int32 j = 0; j < VM_KERNEL_UNROLL; ++j)
+			{
+				Kernel::DoKernel(Context, Dst.GetDestAndAdvance(), Arg0.GetAndAdvance(), Arg1.GetAndAdvance(), Arg2.GetAndAdvance());
+			}
+		}
+		for (; i < Loops; ++i)
 		{
 			Kernel::DoKernel(Context, Dst.GetDestAndAdvance(), Arg0.GetAndAdvance(), Arg1.GetAndAdvance(), Arg2.GetAndAdvance());
 		}